@@ -0,0 +1,69 @@
+/*
+ * Native microbenchmarks for the motor libraries.
+ *
+ * Build and run on the host with:
+ *   pio run -e native -t exec
+ *
+ * The hardware calls are replaced by the recording stand-ins in shim/, so
+ * the numbers measure the library code itself plus a counted number of
+ * (free) hardware operations.
+ */
+
+#ifndef bench_h
+#define bench_h
+
+#include <stdio.h>
+#include <chrono>
+
+#define BENCH_ITERATIONS 2000000L
+
+// Average nanoseconds per call of f() over the given number of iterations
+template <typename F>
+double nsPerCall(long iterations, F f)
+{
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for(long i = 0; i < iterations; i++)
+    f();
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+inline void reportTime(const char *name, double ns)
+{
+  printf("  %-44s %10.2f ns/call\n", name, ns);
+}
+
+inline void reportCount(const char *name, unsigned long count, const char *unit)
+{
+  printf("  %-44s %10lu %s\n", name, count, unit);
+}
+
+// Checks that fail print FAIL and count here, making the run exit non-zero
+extern int benchFailures;
+
+// Benchmark suites
+void benchStepperTimer();
+void benchStepScheduler();
+void benchStepperGroup();
+void benchMotorChannel();
+void benchStepDirStepper();
+void benchSegmentQueue();
+void benchDCMotorController();
+void benchMCPWMMotorController();
+void benchSpeedControl();
+void benchTelemetry();
+void benchControlProtocol();
+void benchControlLink();
+void benchMailbox();
+void benchHistogram();
+void benchStepTrace();
+void benchBinaryLog();
+void benchBoardProfile();
+void benchBootTimeline();
+void benchPowerManager();
+void benchReplay();
+
+// Replays a session log pulled from /session, returns the exit status
+int replaySession(const char *path);
+
+#endif
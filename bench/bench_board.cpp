@@ -0,0 +1,103 @@
+/*
+ * BoardProfile checks: every profile is built into steppers and DC motors
+ * here, whichever one the firmware selects, and stepped to see its coils
+ * only ever drive the pins its profile gives them
+ */
+
+#include "bench.h"
+#include "host_shim.h"
+#include "BoardProfile.h"
+#include "StepperTimer.h"
+#include "DCMotorController.h"
+
+// The checks have to catch a clash, not only pass the real boards
+constexpr BoardProfile clashBoard =
+{
+  "clash",
+  {
+    { {5, 4, 25, 26},   TIMER_GROUP_0, TIMER_0, {0, 4} },
+    { {17, 16, 19, 4},  TIMER_GROUP_0, TIMER_1, {1, 5} },
+    { {-1, -1, -1, -1}, TIMER_GROUP_1, TIMER_0, {2, 6} },
+    { {-1, -1, -1, -1}, TIMER_GROUP_1, TIMER_1, {3, 7} }
+  },
+  {
+    {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1},
+    {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1}
+  }
+};
+static_assert(!boardPinsApart(clashBoard), "GPIO4 on two channels not caught");
+static_assert(boardPinsDrivable(clashBoard), "clashBoard only clashes");
+
+constexpr BoardProfile flashBoard =
+{
+  "flash",
+  {
+    { {5, 4, 25, 26},   TIMER_GROUP_0, TIMER_0, {0, 4} },
+    { {17, 16, 19, 9},  TIMER_GROUP_0, TIMER_1, {1, 5} },
+    { {-1, -1, -1, -1}, TIMER_GROUP_1, TIMER_0, {2, 6} },
+    { {-1, -1, -1, -1}, TIMER_GROUP_1, TIMER_1, {3, 7} }
+  },
+  {
+    {34, 35}, {-1, -1}, {-1, -1}, {-1, -1},
+    {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1}
+  }
+};
+static_assert(!boardValid(flashBoard), "GPIO9 (flash) as an output not caught");
+static_assert(boardEncodersValid(flashBoard), "input only encoder pins refused");
+
+// Steps every fitted channel in each mode and reports the pins driven
+static void reportBoard(const BoardProfile &board)
+{
+  uint64_t expected = 0, driven = 0;
+  unsigned long stray = 0;
+  int fitted = 0;
+  StepperTimer::modeEnum modes[] = { StepperTimer::full, StepperTimer::half, StepperTimer::wave };
+  for (int c = 0; c < BOARD_CHANNELS; c++)
+  {
+    const BoardChannel &ch = board.channel[c];
+    StepperTimer stepper(200, ch.group, ch.timer, ch.pin[0], ch.pin[1], ch.pin[2], ch.pin[3]);
+    uint64_t mask = boardChannelMask(board, c);
+    expected |= mask;
+    fitted += boardFitted(board, c);
+    for (int m = 0; m < 3; m++)
+    {
+      stepper.setMode(modes[m]);
+      stepper.setSpeed(100);
+      for (int i = 0; i < 16; i++)
+      {
+        hostShim.gpioOut = 0;
+        stepper.step();
+        if (hostShim.gpioOut & ~mask)
+          stray++;
+        driven |= hostShim.gpioOut;
+      }
+    }
+  }
+
+  // both bridges of a channel drive its coil pins, as DC motors too
+  unsigned long dcMismatch = 0;
+  for (int dc = 0; dc < BOARD_DC_CHANNELS; dc++)
+  {
+    DCMotorController motor(dc, boardDCPin(board, dc, 0), boardDCPin(board, dc, 1));
+    uint64_t pins = boardPinBit(boardDCPin(board, dc, 0)) | boardPinBit(boardDCPin(board, dc, 1));
+    if ((pins & ~boardChannelMask(board, dc % BOARD_CHANNELS)) != 0)
+      dcMismatch++;
+  }
+
+  char name[64];
+  snprintf(name, sizeof(name), "%s: channels fitted", board.name);
+  reportCount(name, fitted, "of 4");
+  snprintf(name, sizeof(name), "%s: output pins [profile, driven]", board.name);
+  printf("  %-44s %10d %d\n", name, boardBitCount(expected), boardBitCount(driven));
+  snprintf(name, sizeof(name), "%s: steps touching other pins", board.name);
+  reportCount(name, stray, "steps");
+  snprintf(name, sizeof(name), "%s: DC channels off their bridge", board.name);
+  reportCount(name, dcMismatch, "channels");
+}
+
+void benchBoardProfile()
+{
+  hostShimReset();
+  reportBoard(featherBoard);
+  reportBoard(devBoard);
+}
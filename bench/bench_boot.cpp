@@ -0,0 +1,89 @@
+/*
+ * Start up benchmarks: BootTimeline stamping each phase once and the cost
+ * of re-marking one on every pass, and the WiFiFallback timeline - when
+ * the cached join is given up on and the access point opened, for a cache
+ * that works, one gone stale, no network at all and an address arriving
+ * just as a fallback is due
+ */
+
+#include <string.h>
+#include "bench.h"
+#include "BootTimeline.h"
+#include "WiFiFallback.h"
+#include "MetricsWriter.h"
+
+#define CACHED_TIMEOUT_MS   3000
+#define AP_TIMEOUT_MS       15000
+
+static void benchTimeline()
+{
+  BootTimeline timeline;
+  unsigned long restamped = 0, outOfOrder = 0;
+  for (int i = 0; i < BOOT_PHASES; i++)
+  {
+    timeline.mark((BootPhase)i);
+    int64_t first = timeline.at((BootPhase)i);
+    if (timeline.mark((BootPhase)i) || timeline.at((BootPhase)i) != first)
+      restamped++;
+    if (i > 0 && first < timeline.at((BootPhase)(i - 1)))
+      outOfOrder++;
+  }
+  reportCount("phases stamped again by a later mark()", restamped, "of 7");
+  reportCount("phases out of order", outOfOrder, "of 6");
+
+  char buffer[1024];
+  MetricsWriter writer(buffer, sizeof(buffer));
+  timeline.writeMetrics(writer);
+  int samples = 0;
+  for (const char *line = strstr(buffer, "boot_phase_seconds{"); line != NULL; line = strstr(line + 1, "boot_phase_seconds{"))
+    samples++;
+  printf("  %-44s %10d samples, %lu bytes\n", "writeMetrics()", samples, (unsigned long)writer.length());
+
+  reportTime("mark() already reached", nsPerCall(BENCH_ITERATIONS, [&]() {
+    timeline.mark(BOOT_FIRST_CONTROL);
+  }));
+}
+
+// loop() every 20ms from boot, the address arriving at connectMs (0 for
+// never) - returns what was done when
+static void runFallback(const char *name, bool cached, uint32_t connectMs, uint32_t endMs)
+{
+  WiFiFallback fallback(CACHED_TIMEOUT_MS, AP_TIMEOUT_MS);
+  fallback.begin(cached, 0);
+  unsigned long actions = 0;
+  for (uint32_t now = 20; now <= endMs; now += 20)
+  {
+    if (connectMs != 0 && now == connectMs)
+      fallback.connected();
+    if (fallback.update(now) != WIFI_WAIT)
+      actions++;
+  }
+  const char *stages[] = { "cached", "scanning", "access point", "connected" };
+  char rescan[16] = "-", ap[16] = "-";
+  if (fallback.rescannedAt)
+    snprintf(rescan, sizeof(rescan), "%.2f s", fallback.rescannedAt * 1e-3);
+  if (fallback.apOpenedAt)
+    snprintf(ap, sizeof(ap), "%.2f s", fallback.apOpenedAt * 1e-3);
+  printf("  %-44s %10s rescan, %s access point, %lu actions, %s\n", name, rescan, ap, actions,
+    stages[fallback.stage()]);
+}
+
+void benchBootTimeline()
+{
+  benchTimeline();
+
+  runFallback("cache good, address at 0.8 s", true, 800, 30000);
+  runFallback("cache stale, address at 5.2 s", true, 5200, 30000);
+  runFallback("no cache, address at 4 s", false, 4000, 30000);
+  runFallback("no network", true, 0, 30000);
+  runFallback("no network, address at 25 s", true, 25000, 30000);
+  // the event task gets in first, the fallback due on this pass is dropped
+  runFallback("address on the pass the rescan is due", true, CACHED_TIMEOUT_MS, 30000);
+
+  WiFiFallback fallback(CACHED_TIMEOUT_MS, AP_TIMEOUT_MS);
+  fallback.begin(false, 0);
+  uint32_t now = 0;
+  reportTime("update() waiting", nsPerCall(BENCH_ITERATIONS, [&]() {
+    fallback.update(now++ & 0x3FF);
+  }));
+}
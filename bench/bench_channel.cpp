@@ -0,0 +1,115 @@
+/*
+ * MotorChannel benchmarks: the cost of a mode switch, that a stepper
+ * switched away mid-run takes no further steps and leaves its pins low,
+ * and that its own timer's interrupt is only ever registered once
+ */
+
+#include "bench.h"
+#include "host_shim.h"
+#include "StepperTimer.h"
+#include "StepScheduler.h"
+#include "StepperGroup.h"
+#include "MotorChannel.h"
+
+static unsigned long dcStarts, dcStops;
+
+static void countDC(int channel, bool enable)
+{
+  if (enable)
+    dcStarts++;
+  else
+    dcStops++;
+}
+
+// Steps the scheduler as the timer would for a number of interrupts
+static void runScheduler(StepScheduler &scheduler, int interrupts)
+{
+  for (int i = 0; i < interrupts; i++)
+  {
+    hostShim.counterValue[0][0] = hostShim.alarmValue[0][0];
+    scheduler.onAlarm();
+  }
+}
+
+void benchMotorChannel()
+{
+  StepScheduler scheduler(TIMER_GROUP_0, TIMER_0);
+  hostShimReset();
+  scheduler.begin();
+  StepperTimer stepper(200, TIMER_GROUP_0, TIMER_0, 5, 4, 25, 26);
+  stepper.setScheduler(&scheduler);
+  stepper.setCoilChannels(0, 4);
+  StepperTimer other(200, TIMER_GROUP_0, TIMER_1, 17, 16, 19, 18);
+  other.setScheduler(&scheduler);
+  MotorChannel channel(0, &stepper, countDC);
+  const uint64_t coilPins = (1ULL << 5) | (1ULL << 4) | (1ULL << 25) | (1ULL << 26);
+
+  int toggle = 0;
+  reportTime("set() stepper <-> DC", nsPerCall(BENCH_ITERATIONS / 4, [&]() {
+    channel.set((toggle++ & 1) ? CHANNEL_DC : CHANNEL_STEPPER);
+  }));
+  reportTime("set() full <-> micro 16", nsPerCall(BENCH_ITERATIONS / 4, [&]() {
+    channel.set((toggle++ & 1) ? CHANNEL_MICROSTEP : CHANNEL_STEPPER, StepperTimer::full, 16);
+  }));
+  channel.set(CHANNEL_STEPPER, StepperTimer::full);
+  unsigned long switches = channel.switches;
+  reportTime("set() unchanged", nsPerCall(BENCH_ITERATIONS, [&]() {
+    channel.set(CHANNEL_STEPPER, StepperTimer::full);
+  }));
+  reportCount("switches from unchanged set()", channel.switches - switches, "");
+
+  // Switch away from a running stepper with another axis still stepping,
+  // nothing may step it or drive its pins afterwards
+  unsigned long strays = 0;
+  uint64_t left = 0;
+  StepperTimer::modeEnum modes[] = { StepperTimer::full, StepperTimer::half, StepperTimer::micro };
+  ChannelState leaving[] = { CHANNEL_STEPPER, CHANNEL_STEPPER, CHANNEL_MICROSTEP };
+  for (int m = 0; m < 3; m++)
+  {
+    for (int to = 0; to < 2; to++)
+    {
+      channel.set(leaving[m], modes[m], 16);
+      stepper.setSpeed(200);
+      other.setSpeed(150);
+      runScheduler(scheduler, 50);
+      channel.set(to ? CHANNEL_DC : CHANNEL_OFF);
+      left |= hostShim.gpioOut & coilPins;
+      for (int p = 0; p < HOST_SHIM_PINS; p++)
+        if ((coilPins >> p) & 1 && hostShim.pinChannel[p] >= 0)
+          left |= 1ULL << p;
+      int64_t position = stepper.getPosition();
+      hostShim.gpioOut &= ~coilPins;
+      runScheduler(scheduler, 200);
+      if (stepper.getPosition() != position || (hostShim.gpioOut & coilPins) != 0)
+        strays++;
+    }
+  }
+  reportCount("steps after switching away", strays, "switches");
+  reportCount("coil pins left driven", (unsigned long)__builtin_popcountll(left), "pins");
+  printf("  %-44s %10lu on, %lu off\n", "DC motor starts/stops", dcStarts, dcStops);
+
+  // A group move that loses an axis is halted, not completed
+  StepperGroup group;
+  group.add(&other);
+  group.setScheduler(&scheduler);
+  other.setSpeed(0);
+  runScheduler(scheduler, 10);
+  int32_t deltas[1] = { 100000 };
+  group.moveBy(deltas, 1000);
+  runScheduler(scheduler, 50);
+  group.halt();
+  int64_t position = other.getPosition();
+  runScheduler(scheduler, 200);
+  printf("  %-44s %10s, %lu completed\n", "group halted mid-move",
+    other.getPosition() == position && !group.isMoving() ? "stopped" : "STILL STEPPING", group.movesCompleted);
+
+  // standalone stepping restarted many times keeps its one interrupt
+  hostShimReset();
+  StepperTimer standalone(200, TIMER_GROUP_1, TIMER_1, 15, 33, 27, 12);
+  for (int i = 0; i < 100; i++)
+  {
+    standalone.spin();
+    standalone.disconnect();
+  }
+  reportCount("interrupts registered by 100 spin()", hostShim.isrRegistrations, "");
+}
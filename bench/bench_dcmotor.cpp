@@ -0,0 +1,87 @@
+/*
+ * DC motor benchmarks: SetSpeed() cost and hardware operations per
+ * direction change, for the LEDC and MCPWM drivers
+ */
+
+#include "bench.h"
+#include "host_shim.h"
+#include "DCMotorController.h"
+#include "MCPWMMotorController.h"
+
+static void reportOperations(const char *name)
+{
+  printf("  %-44s %lu gpio, %lu ledcWrite, %lu attach, %lu detach (%lu total)\n", name,
+    hostShim.gpioWrites, hostShim.ledcWrites, hostShim.ledcAttaches, hostShim.ledcDetaches,
+    hostShimOperations());
+}
+
+static void reportMcpwmOperations(const char *name)
+{
+  printf("  %-44s %lu registers, %lu driver calls, %lu routes (%lu total)\n", name,
+    hostShim.mcpwmRegisterWrites, hostShim.mcpwmCalls, hostShim.gpioMatrixRoutes, hostShimOperations());
+}
+
+void benchDCMotorController()
+{
+  DCMotorController motor(0, 5, 4);
+
+  motor.SetSpeed(100);
+  hostShimReset();
+  motor.SetSpeed(150);
+  reportOperations("SetSpeed() same direction");
+
+  hostShimReset();
+  motor.SetSpeed(-100);
+  reportOperations("SetSpeed() forward -> reverse");
+
+  hostShimReset();
+  motor.SetSpeed(100);
+  reportOperations("SetSpeed() reverse -> forward");
+
+  int speed = 0;
+  reportTime("SetSpeed() same direction", nsPerCall(BENCH_ITERATIONS, [&]() {
+    motor.SetSpeed((speed++ & 0x7f) + 1);
+  }));
+
+  speed = 0;
+  reportTime("SetSpeed() alternating direction", nsPerCall(BENCH_ITERATIONS, [&]() {
+    motor.SetSpeed((speed++ & 1) ? 100 : -100);
+  }));
+}
+
+void benchMCPWMMotorController()
+{
+  MCPWMMotorController motor(MCPWM_UNIT_0, MCPWM_TIMER_0, 5, 4);
+  motor.begin();
+  printf("  %-44s %10d at %u ticks/period\n", "full scale", motor.maxSpeed(),
+    (uint32_t)MCPWM0.timer[0].period.period);
+
+  motor.SetSpeed(100);
+  hostShimReset();
+  motor.SetSpeed(150);
+  reportMcpwmOperations("SetSpeed() same direction");
+
+  hostShimReset();
+  motor.SetSpeed(-100);
+  reportMcpwmOperations("SetSpeed() forward -> reverse");
+  printf("  %-44s A %u, B %u\n", "  comparators", (uint32_t)MCPWM0.channel[0].cmpr_value[0].cmpr_val,
+    (uint32_t)MCPWM0.channel[0].cmpr_value[1].cmpr_val);
+
+  motor.SetBreaking(true);
+  hostShimReset();
+  motor.SetSpeed(100);
+  reportMcpwmOperations("SetSpeed() reverse -> forward [braking]");
+  printf("  %-44s A %u, B %u\n", "  comparators", (uint32_t)MCPWM0.channel[0].cmpr_value[0].cmpr_val,
+    (uint32_t)MCPWM0.channel[0].cmpr_value[1].cmpr_val);
+  motor.SetBreaking(false);
+
+  int speed = 0;
+  reportTime("SetSpeed() same direction", nsPerCall(BENCH_ITERATIONS, [&]() {
+    motor.SetSpeed((speed++ & 0x7f) + 1);
+  }));
+
+  speed = 0;
+  reportTime("SetSpeed() alternating direction", nsPerCall(BENCH_ITERATIONS, [&]() {
+    motor.SetSpeed((speed++ & 1) ? 100 : -100);
+  }));
+}
@@ -0,0 +1,93 @@
+/*
+ * StepperGroup benchmarks: a coordinated move run through the scheduler on
+ * the host, checking every axis lands, how far each strays from the
+ * straight line, and how many interrupts it took - microstepped, the same
+ * move in full steps should take the same time
+ */
+
+#include <math.h>
+#include "bench.h"
+#include "host_shim.h"
+#include "StepperTimer.h"
+#include "StepScheduler.h"
+#include "StepperGroup.h"
+
+#define GROUP_BENCH_AXES 3
+
+static void runGroupMove(const char *name, const int32_t *fullSteps, uint32_t rate, unsigned long jerk,
+                         int microsteps = 1)
+{
+  int32_t deltas[GROUP_BENCH_AXES];
+  for (int i = 0; i < GROUP_BENCH_AXES; i++)
+    deltas[i] = fullSteps[i] * microsteps;
+  rate *= microsteps;
+  StepScheduler scheduler(TIMER_GROUP_0, TIMER_0);
+  StepperGroup group;
+  StepperTimer *steppers[GROUP_BENCH_AXES];
+  hostShimReset();
+  scheduler.begin();
+  group.setScheduler(&scheduler);
+  group.setAcceleration(4000, jerk);
+  int32_t longest = 0;
+  int master = 0;
+  for (int i = 0; i < GROUP_BENCH_AXES; i++)
+  {
+    steppers[i] = new StepperTimer(200, TIMER_GROUP_0, TIMER_0, 5, 4, 25, 26);
+    steppers[i]->setScheduler(&scheduler);
+    if (microsteps > 1)
+    {
+      steppers[i]->setCoilChannels(i * 2, i * 2 + 1);
+      steppers[i]->setMode(StepperTimer::micro, microsteps);
+    }
+    group.add(steppers[i]);
+    if (abs(deltas[i]) > longest)
+    {
+      longest = abs(deltas[i]);
+      master = i;
+    }
+  }
+
+  group.moveBy(deltas, rate);
+  double worst = 0;
+  unsigned long masterSteps = 0;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  while (group.isMoving() && masterSteps < 10000000)
+  {
+    hostShim.counterValue[0][0] = hostShim.alarmValue[0][0];
+    scheduler.onAlarm();
+    masterSteps++;
+    // distance of each axis from the straight line at this master step
+    double progress = fabs((double)steppers[master]->getPosition()) / longest;
+    for (int i = 0; i < GROUP_BENCH_AXES; i++)
+    {
+      double deviation = fabs(steppers[i]->getPosition() - deltas[i] * progress);
+      if (deviation > worst)
+        worst = deviation;
+    }
+  }
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+  bool landed = true;
+  for (int i = 0; i < GROUP_BENCH_AXES; i++)
+    landed = landed && steppers[i]->getPosition() == deltas[i];
+  double seconds = (double)hostShim.alarmValue[0][0] / TIMER_SCALE;
+
+  printf("  %-44s %10s, %lu interrupts for %ld master steps, %.2f s\n", name, landed ? "landed" : "MISSED",
+    scheduler.interrupts, (long)longest, seconds);
+  printf("  %-44s %10.2f ns/interrupt with checks, worst %.2f steps off the line\n", "", ns / scheduler.interrupts, worst);
+
+  for (int i = 0; i < GROUP_BENCH_AXES; i++)
+    delete steppers[i];
+}
+
+void benchStepperGroup()
+{
+  const int32_t diagonal[GROUP_BENCH_AXES] = { 1000, -1000, 1000 };
+  const int32_t skewed[GROUP_BENCH_AXES] = { 2000, -733, 41 };
+  const int32_t single[GROUP_BENCH_AXES] = { 0, 500, 0 };
+  runGroupMove("3 axes diagonal", diagonal, 2000, 0);
+  runGroupMove("3 axes 2000/-733/41", skewed, 2000, 0);
+  runGroupMove("3 axes 2000/-733/41 [s-curve]", skewed, 2000, 20000);
+  runGroupMove("3 axes 2000/-733/41, 1/16 microsteps", skewed, 2000, 0, 16);
+  runGroupMove("1 of 3 axes", single, 1000, 0);
+}
@@ -0,0 +1,20 @@
+/*
+ * Histogram benchmarks: add() cost, which sits in the control loop and in
+ * interrupt tracing
+ */
+
+#include "bench.h"
+#include "Histogram.h"
+
+void benchHistogram()
+{
+  Histogram histogram;
+  uint32_t value = 1;
+  reportTime("add()", nsPerCall(BENCH_ITERATIONS, [&]() {
+    value = value * 1103515245 + 12345;
+    histogram.add(value >> 16);
+  }));
+  reportTime("percentile()", nsPerCall(BENCH_ITERATIONS / 100, [&]() { histogram.percentile(99); }));
+  printf("  %-44s %10u p50, %u p99, %u max\n", "uniform 0..65535", histogram.percentile(50),
+    histogram.percentile(99), histogram.max);
+}
@@ -0,0 +1,179 @@
+/*
+ * ControlLink benchmarks: a simulated WiFi link with jitter and the odd
+ * retransmit stall, checking the round trip and clock offset estimates and
+ * that no setpoint older than the maximum age gets applied, and the send
+ * interval the device hands out to clients as their queues back up
+ */
+
+#include "bench.h"
+#include "ControlLink.h"
+
+#define LINK_BENCH_SECONDS    600
+#define LINK_CLOCK_OFFSET     123456   // client clock ahead of the device, ms
+#define LINK_MAX_AGE          200
+
+static uint32_t linkState = 0x2545F491;
+
+static uint32_t linkRandom()
+{
+  linkState ^= linkState << 13;
+  linkState ^= linkState >> 17;
+  linkState ^= linkState << 5;
+  return linkState;
+}
+
+// One way delay in ms: a few ms of jitter, and now and then a retransmit
+// that holds the frame back a few hundred
+static uint32_t linkDelay()
+{
+  uint32_t delay = 2 + linkRandom() % 7;
+  if (linkRandom() % 100 < 3)
+    delay += 150 + linkRandom() % 250;
+  return delay;
+}
+
+// Three clients with their sticks moving 2s out of every 10, each sending
+// on change no faster than its hinted interval, with a 500ms keepalive.
+// Telemetry reaches each at 20/s; for a minute the third only reads 10/s
+// and its queue backs up.
+static void benchSendRate()
+{
+  const int clients = 3;
+  const uint32_t keepalive = 500;
+  const uint32_t seconds = 120;
+  ControlLink links[clients];
+  uint32_t lastSend[clients] = { 0, 0, 0 };
+  uint32_t changedAt[clients] = { 0, 0, 0 };
+  bool pending[clients] = { false, false, false };
+  uint32_t queued[clients] = { 0, 0, 0 };
+  unsigned long movingSent = 0, stillSent = 0;
+  uint32_t movingTime = 0, stillTime = 0;
+  uint32_t worstDelay = 0;
+  uint16_t slowest = 0;
+
+  for (uint32_t now = 0; now < seconds * 1000; now += 10)
+  {
+    bool moving = now % 10000 < 2000;
+    bool slow = now >= 30000 && now < 90000;
+    if (moving)
+      movingTime += 10;
+    else
+      stillTime += 10;
+    for (int c = 0; c < clients; c++)
+    {
+      if (moving && !pending[c])
+      {
+        pending[c] = true;
+        changedAt[c] = now;
+      }
+      uint32_t since = now - lastSend[c];
+      bool send = pending[c] ? since >= links[c].interval : since >= keepalive;
+      if (send)
+      {
+        if (pending[c] && now - changedAt[c] > worstDelay)
+          worstDelay = now - changedAt[c];
+        links[c].accept((uint16_t)(now / 10), false, 0, now);
+        lastSend[c] = now;
+        pending[c] = false;
+        if (moving)
+          movingSent++;
+        else
+          stillSent++;
+      }
+      // telemetry is passed over while more than 4 are queued
+      if (now % 50 == 0 && queued[c] <= 4)
+        queued[c]++;
+      if (queued[c] > 0 && now % ((c == 2 && slow) ? 100 : 40) == 0)
+        queued[c]--;
+    }
+
+    if (now % 100 == 0)
+    {
+      int senders = 0;
+      for (int c = 0; c < clients; c++)
+        if (links[c].sending())
+          senders++;
+      for (int c = 0; c < clients; c++)
+      {
+        links[c].adapt(queued[c], false, senders);
+        if (links[c].interval > slowest)
+          slowest = links[c].interval;
+      }
+    }
+  }
+
+  reportCount("setpoints/s per client, fixed 150ms timer", 1000 / 150, "");
+  reportCount("setpoints/s per client, sticks moving", movingSent * 1000 / movingTime / clients, "");
+  reportCount("setpoints/s per client, sticks still", stillSent * 1000 / stillTime / clients, "");
+  reportCount("longest change to send delay", worstDelay, "ms");
+  reportCount("longest interval handed out", slowest, "ms");
+  reportCount("interval once the slow reader caught up", links[2].interval, "ms");
+}
+
+void benchControlLink()
+{
+  ControlLink link;
+  link.setMaxAge(LINK_MAX_AGE);
+  uint32_t upstream = 0;      // TCP delivers in order: nothing overtakes this
+  uint16_t sequence = 0;
+  unsigned long sent = 0;
+  uint32_t worstApplied = 0;
+  uint32_t worstOffsetError = 0;
+  unsigned long stale = 0;
+
+  for (uint32_t now = 1000; now < LINK_BENCH_SECONDS * 1000; now += 50)
+  {
+    // a ping each second, answered as it arrives
+    if (now % 1000 == 0)
+    {
+      uint32_t atClient = now + linkDelay();
+      uint32_t back = atClient + linkDelay();
+      if (back < upstream)
+        back = upstream;
+      upstream = back;
+      link.pong(now, atClient + LINK_CLOCK_OFFSET, back);
+      sequence++;
+      if (link.synced)
+      {
+        int32_t error = link.offset - LINK_CLOCK_OFFSET;
+        uint32_t magnitude = error < 0 ? -error : error;
+        if (magnitude > worstOffsetError)
+          worstOffsetError = magnitude;
+      }
+    }
+
+    // setpoints every 50ms
+    uint32_t arrival = now + linkDelay();
+    if (arrival < upstream)
+      arrival = upstream;
+    upstream = arrival;
+    sent++;
+    uint32_t age = arrival - now;
+    if (age > LINK_MAX_AGE)
+      stale++;
+    if (link.accept(sequence++, true, now + LINK_CLOCK_OFFSET, arrival) == CONTROL_ACCEPT && age > worstApplied)
+      worstApplied = age;
+  }
+
+  // a duplicate and a reordered frame
+  link.accept(sequence - 1, true, 0, 0);
+  link.accept(sequence - 5, true, 0, 0);
+
+  reportCount("smoothed round trip", link.rtt, "ms");
+  reportCount("round trip deviation", link.rttVar, "ms");
+  reportCount("worst clock offset error", worstOffsetError, "ms");
+  reportCount("setpoints sent", sent, "");
+  reportCount("setpoints older than the maximum age", stale, "");
+  reportCount("setpoints dropped as expired", link.expired, "");
+  reportCount("setpoints dropped out of order", link.outOfOrder, "(2 injected)");
+  reportCount("oldest setpoint applied", worstApplied, "ms");
+
+  uint32_t when = 0;
+  double ns = nsPerCall(BENCH_ITERATIONS, [&]() {
+    when += 50;
+    link.accept(sequence++, true, when + LINK_CLOCK_OFFSET, when + 5);
+  });
+  reportTime("accept()", ns);
+
+  benchSendRate();
+}
@@ -0,0 +1,105 @@
+/*
+ * BinaryLog benchmarks: call site cost, drain cost, and a multi-producer
+ * check that no record is lost or garbled unless counted as dropped
+ */
+
+#include <thread>
+#include <atomic>
+#include <string.h>
+#include "bench.h"
+#include "BinaryLog.h"
+
+#define LOG_BENCH_PRODUCERS 3
+
+static unsigned long sunk;
+static void countSink(const BinaryLogRecord &record, const char *text, void *arg)
+{
+  sunk++;
+}
+
+void benchBinaryLog()
+{
+  BinaryLog log;
+  log.begin(countSink, NULL, 0, 1);
+
+  // write() and drain in batches that fit the ring
+  const long batch = BINARY_LOG_RECORDS / 2;
+  long rounds = BENCH_ITERATIONS / batch / 4;
+  double ns = 0;
+  for (long r = 0; r < rounds; r++)
+  {
+    int32_t n = 0;
+    ns += nsPerCall(batch, [&]() { log.write(BLOG_NET, BLOG_INFO, "client %u sent %d bytes", n++, 42); });
+    log.drain();
+  }
+  reportTime("write()", ns / rounds);
+  reportTime("write() filtered by level", nsPerCall(BENCH_ITERATIONS, [&]() {
+    BLOG(BLOG_NET, BLOG_DEBUG, "client %u sent %d bytes", 1, 42);
+  }));
+
+  int32_t n = 0;
+  ns = 0;
+  for (long r = 0; r < rounds / 16; r++)
+  {
+    for (long i = 0; i < batch; i++)
+      log.write(BLOG_NET, BLOG_INFO, "client %u sent %d bytes", n++, 42);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    log.drain();
+    ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / batch;
+  }
+  reportTime("drain() + format, per record", ns / (rounds / 16));
+
+  // Producers tag each record with their id and a running count, the
+  // consumer checks every producer's records arrive in order
+  BinaryLog shared;
+  std::atomic<bool> done(false);
+  unsigned long received = 0, misordered = 0;
+  int32_t expected[LOG_BENCH_PRODUCERS] = {0};
+  std::thread consumer([&]() {
+    BinaryLogRecord record;
+    for (;;)
+    {
+      bool finished = done.load();
+      bool any = false;
+      while (shared.read(record))
+      {
+        any = true;
+        received++;
+        int producer = record.args[0];
+        if (record.args[1] < expected[producer])
+          misordered++;
+        expected[producer] = record.args[1] + 1;
+      }
+      if (finished && !any)
+        break;
+      std::this_thread::yield();
+    }
+  });
+  std::thread producers[LOG_BENCH_PRODUCERS];
+  for (int p = 0; p < LOG_BENCH_PRODUCERS; p++)
+    producers[p] = std::thread([&, p]() {
+      for (int32_t i = 0; i < BENCH_ITERATIONS / 4; i++)
+      {
+        shared.write(BLOG_MOTOR, BLOG_INFO, "producer %d record %d", p, i);
+        if ((i & 0x3f) == 0)
+          std::this_thread::yield();
+      }
+    });
+  for (int p = 0; p < LOG_BENCH_PRODUCERS; p++)
+    producers[p].join();
+  done = true;
+  consumer.join();
+
+  unsigned long dropped = 0;
+  for (int i = 0; i < BLOG_CATEGORIES; i++)
+    dropped += shared.dropped[i];
+  printf("  %-44s %10lu received, %lu dropped, %lu misordered, %lu lost\n", "3 producers, 1 consumer",
+    received, dropped, misordered, (unsigned long)LOG_BENCH_PRODUCERS * (BENCH_ITERATIONS / 4) - received - dropped);
+
+  char text[BINARY_LOG_LINE];
+  BinaryLogRecord record;
+  log.write(BLOG_CONTROL, BLOG_WARN, "channel %d mode %d", 2, 1);
+  log.read(record);
+  BinaryLog::format(record, text, sizeof(text));
+  printf("  %-44s %s\n", "formatted", text);
+}
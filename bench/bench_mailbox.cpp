@@ -0,0 +1,124 @@
+/*
+ * Mailbox benchmarks: publish/read cost and a two-thread check that the
+ * consumer never sees a torn snapshot. The same for MessageQueue, which
+ * must also hand every message over once and in order.
+ */
+
+#include <thread>
+#include <atomic>
+#include "bench.h"
+#include "Mailbox.h"
+#include "MessageQueue.h"
+
+struct Snapshot {
+  int16_t setpoint[8];
+  uint16_t sequence;
+};
+
+void benchMailbox()
+{
+  Mailbox<Snapshot> box;
+  uint16_t sequence = 0;
+
+  reportTime("publish()", nsPerCall(BENCH_ITERATIONS, [&]() {
+    Snapshot &next = box.write();
+    for (int i = 0; i < 8; i++)
+      next.setpoint[i] = sequence;
+    next.sequence = sequence++;
+    box.publish();
+  }));
+
+  volatile int16_t sink = 0;
+  reportTime("read() + current()", nsPerCall(BENCH_ITERATIONS, [&]() {
+    box.write().sequence = sequence++;
+    box.publish();
+    if (box.read())
+      sink = box.current().setpoint[0];
+  }));
+  reportTime("read() with nothing new", nsPerCall(BENCH_ITERATIONS, [&]() { box.read(); }));
+
+  // Producer writes every channel with the same value, so any mix of two
+  // snapshots shows up as channels that disagree
+  std::atomic<bool> done(false);
+  unsigned long reads = 0;
+  unsigned long torn = 0;
+  std::thread consumer([&]() {
+    while (!done.load())
+    {
+      if (!box.read())
+        continue;
+      const Snapshot &s = box.current();
+      reads++;
+      for (int i = 1; i < 8; i++)
+        if (s.setpoint[i] != s.setpoint[0])
+        {
+          torn++;
+          break;
+        }
+    }
+  });
+  for (long n = 0; n < BENCH_ITERATIONS * 5; n++)
+  {
+    Snapshot &next = box.write();
+    for (int i = 0; i < 8; i++)
+      next.setpoint[i] = (int16_t)n;
+    box.publish();
+    // interleave more finely when both threads share one CPU
+    if ((n & 0xff) == 0)
+      std::this_thread::yield();
+  }
+  done = true;
+  consumer.join();
+  printf("  %-44s %10lu reads, %lu torn\n", "two threads", reads, torn);
+
+  MessageQueue<Snapshot, 8> queue;
+  reportTime("queue publish() + read() + release()", nsPerCall(BENCH_ITERATIONS, [&]() {
+    Snapshot *message = queue.write();
+    message->sequence = sequence++;
+    queue.publish();
+    sink = queue.read()->sequence;
+    queue.release();
+  }));
+
+  // Every message numbered, so a lost, repeated or reordered one shows up
+  // as a gap, and torn ones as channels that disagree
+  const long messages = BENCH_ITERATIONS / 4;
+  unsigned long gaps = 0;
+  torn = 0;
+  std::thread receiver([&]() {
+    long expected = 0;
+    while (expected < messages)
+    {
+      const Snapshot *message = queue.read();
+      if (message == NULL)
+      {
+        std::this_thread::yield();
+        continue;
+      }
+      if (message->sequence != (uint16_t)expected)
+        gaps++;
+      for (int i = 1; i < 8; i++)
+        if (message->setpoint[i] != message->setpoint[0])
+        {
+          torn++;
+          break;
+        }
+      queue.release();
+      expected++;
+    }
+  });
+  unsigned long full = queue.refused;
+  for (long n = 0; n < messages; n++)
+  {
+    Snapshot *message;
+    while ((message = queue.write()) == NULL)
+      std::this_thread::yield();
+    for (int i = 0; i < 8; i++)
+      message->setpoint[i] = (int16_t)n;
+    message->sequence = (uint16_t)n;
+    queue.publish();
+  }
+  receiver.join();
+  printf("  %-44s %10ld messages, %lu out of order, %lu torn, %lu full\n", "queue, two threads",
+    messages, gaps, torn, queue.refused - full);
+}
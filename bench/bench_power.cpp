@@ -0,0 +1,197 @@
+/*
+ * PowerManager benchmarks: the holding current turned down in each step
+ * mode and back up by the next step, the idle timeline of the policy -
+ * when the current drops, the CPU clock comes down and the radio sleeps,
+ * and what a command waking it switches back - and the cost of the calls
+ * made per command frame and per loop() pass
+ */
+
+#include "bench.h"
+#include "host_shim.h"
+#include "StepperTimer.h"
+#include "StepScheduler.h"
+#include "PowerManager.h"
+
+#define HOLD_PERCENT 40
+
+static const char *modeNames[] = { "full", "half", "wave", "micro 16" };
+static const int coilPins[4] = { 5, 4, 25, 26 };
+
+// Signed duty of a coil from the shim's LEDC registers and routing, or
+// full scale from the pin levels while it is on plain GPIO
+static int coilDuty(int channel, int positivePin, int negativePin)
+{
+  int duty = LEDC.channel_group[0].channel[channel].duty.duty >> 4;
+  if (hostShim.pinChannel[positivePin] == channel)
+    return duty;
+  if (hostShim.pinChannel[negativePin] == channel)
+    return -duty;
+  if (hostShimPinLevel(positivePin))
+    return 255;
+  if (hostShimPinLevel(negativePin))
+    return -255;
+  return 0;
+}
+
+static bool routed()
+{
+  for (int i = 0; i < 4; i++)
+    if (hostShim.pinChannel[coilPins[i]] >= 0)
+      return true;
+  return false;
+}
+
+static void runScheduler(StepScheduler &scheduler)
+{
+  for (int i = 0; i < 100000; i++)
+  {
+    unsigned long steps = scheduler.steps;
+    hostShim.counterValue[0][0] = hostShim.alarmValue[0][0];
+    scheduler.onAlarm();
+    if (scheduler.steps == steps)
+      break;
+  }
+}
+
+static void benchHold()
+{
+  unsigned long wrong = 0, unrestored = 0;
+  for (int m = StepperTimer::full; m <= StepperTimer::micro; m++)
+  {
+    hostShimReset();
+    StepScheduler scheduler(TIMER_GROUP_0, TIMER_0);
+    scheduler.begin();
+    StepperTimer stepper(200, TIMER_GROUP_0, TIMER_0, coilPins[0], coilPins[1], coilPins[2], coilPins[3]);
+    stepper.setScheduler(&scheduler);
+    stepper.setCoilChannels(0, 4);
+    stepper.setMode((StepperTimer::modeEnum)m, 16);
+
+    // Land a move on an odd step, so half and wave stand on one coil
+    stepper.moveBy(m == StepperTimer::micro ? 37 : 7, 100);
+    runScheduler(scheduler);
+    int a = coilDuty(0, coilPins[0], coilPins[1]);
+    int b = coilDuty(4, coilPins[2], coilPins[3]);
+    stepper.reduceHold(HOLD_PERCENT);
+    runScheduler(scheduler);
+    int heldA = coilDuty(0, coilPins[0], coilPins[1]);
+    int heldB = coilDuty(4, coilPins[2], coilPins[3]);
+    if (!stepper.isHoldReduced() || heldA != a * HOLD_PERCENT / 100 || heldB != b * HOLD_PERCENT / 100)
+      wrong++;
+    char name[64];
+    snprintf(name, sizeof(name), "held at %d%% [%s]", HOLD_PERCENT, modeNames[m]);
+    printf("  %-44s %4d/%4d of %d/%d duty\n", name, heldA, heldB, a, b);
+
+    // The next step is at full current, full step modes back on GPIO
+    stepper.moveBy(1, 100);
+    runScheduler(scheduler);
+    a = coilDuty(0, coilPins[0], coilPins[1]);
+    b = coilDuty(4, coilPins[2], coilPins[3]);
+    if (stepper.isHoldReduced() || (m != StepperTimer::micro && routed()) || (a == 0 && b == 0) ||
+        (m != StepperTimer::micro && a != 0 && a != 255 && a != -255))
+      unrestored++;
+  }
+  reportCount("holds at the wrong current", wrong, "of 4 modes");
+  reportCount("not back to full at the next step", unrestored, "of 4 modes");
+
+  // A motor that ramped to rest is coasting, and stays off
+  hostShimReset();
+  StepScheduler scheduler(TIMER_GROUP_0, TIMER_0);
+  scheduler.begin();
+  StepperTimer stepper(200, TIMER_GROUP_0, TIMER_0, coilPins[0], coilPins[1], coilPins[2], coilPins[3]);
+  stepper.setScheduler(&scheduler);
+  stepper.setCoilChannels(0, 4);
+  stepper.setTargetSpeed(50);
+  for (int i = 0; i < 20; i++)
+  {
+    hostShim.counterValue[0][0] = hostShim.alarmValue[0][0];
+    scheduler.onAlarm();
+  }
+  stepper.setTargetSpeed(0);
+  runScheduler(scheduler);
+  stepper.reduceHold(HOLD_PERCENT);
+  runScheduler(scheduler);
+  printf("  %-44s %10s\n", "coasting motor", stepper.isHoldReduced() || routed() ? "ENERGISED" : "left off");
+}
+
+// One loop() pass every 20ms, axis 0 moving for the first two seconds and
+// a command at nine; returns when each step of the timeline happened
+static void runTimeline(PowerManager &power, bool scaling)
+{
+  int64_t heldAt = -1, idleAt = -1, wokeAt = -1;
+  int idleMhz = 0, idlePs = -1, wakeMhz = 0, wakePs = -1;
+  for (int64_t now = 0; now <= 12000000; now += 20000)
+  {
+    if (now == 1000000)
+    {
+      // WiFi up
+      hostShim.wifiStarted = true;
+      power.radioUp();
+    }
+    if (now == 9000000 && power.activity(now))
+    {
+      wokeAt = now;
+      wakeMhz = hostShim.cpuMhz;
+      wakePs = hostShim.wifiPs;
+    }
+    bool wasIdle = power.isIdle();
+    uint8_t reduce = power.update(now < 2000000 ? 1 : 0, false, now);
+    if ((reduce & 1) && heldAt < 0 && now >= 2000000)
+      heldAt = now;
+    if (!wasIdle && power.isIdle() && idleAt < 0)
+    {
+      idleAt = now;
+      idleMhz = hostShim.cpuMhz;
+      idlePs = hostShim.wifiPs;
+    }
+  }
+  const char *ps[] = { "awake", "modem sleep", "max modem" };
+  printf("  %-44s %10.2f s after stopping\n", "holding current down", (heldAt - 2000000) * 1e-6);
+  printf("  %-44s %10.2f s after stopping, %d MHz, %s\n", "idle", (idleAt - 2000000) * 1e-6,
+    idleMhz, idlePs >= 0 ? ps[idlePs] : "?");
+  printf("  %-44s %10s, %d MHz, %s\n", "command at 9 s", wokeAt >= 0 ? "woke" : "SLEPT ON", wakeMhz,
+    wakePs >= 0 ? ps[wakePs] : "?");
+  printf("  %-44s %10lu idles, %lu wakes, %.2f s idle\n", scaling ? "transitions" : "transitions, no esp_pm",
+    power.idles, power.wakes, power.idleTime(12000000) * 1e-6);
+  printf("  %-44s %10d held, %lu radio refusals\n", "CPU locks at the end", hostShim.pmLocksHeld, power.radioErrors);
+}
+
+void benchPowerManager()
+{
+  benchHold();
+
+  hostShimReset();
+  PowerManager power;
+  power.setTimeouts(500, 5000);
+  bool scaling = power.begin(240, 80);
+  runTimeline(power, scaling);
+
+  // Without power management in the build only the radio sleeps
+  hostShimReset();
+  hostShim.pmSupported = false;
+  PowerManager radioOnly;
+  radioOnly.setTimeouts(500, 5000);
+  scaling = radioOnly.begin(240, 80);
+  runTimeline(radioOnly, scaling);
+
+  hostShimReset();
+  hostShim.wifiStarted = true;
+  PowerManager hot;
+  hot.begin(240, 80);
+  int64_t now = 0;
+  reportTime("activity() awake, per command", nsPerCall(BENCH_ITERATIONS, [&]() {
+    hot.activity(now += 1000);
+  }));
+  reportTime("update() with an axis moving", nsPerCall(BENCH_ITERATIONS, [&]() {
+    hot.update(1, false, now += 20000);
+  }));
+  reportTime("update() standing still", nsPerCall(BENCH_ITERATIONS, [&]() {
+    hot.update(0, false, now += 20);
+  }));
+  int64_t sleepAt = now + 10000000;
+  hot.update(0, false, sleepAt);
+  reportTime("wake and sleep again", nsPerCall(BENCH_ITERATIONS / 10, [&]() {
+    hot.activity(sleepAt += 10000000);
+    hot.update(0, false, sleepAt += 10000000);
+  }));
+  printf("  %-44s %10lu wakes, %d locks held asleep\n", "  switches", hot.wakes, hostShim.pmLocksHeld);
+}
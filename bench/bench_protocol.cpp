@@ -0,0 +1,146 @@
+/*
+ * ControlProtocol benchmarks: decoder throughput under fragmentation and a
+ * randomised fuzz run checking the decoder always resynchronises
+ */
+
+#include <string.h>
+#include "bench.h"
+#include "ControlProtocol.h"
+
+#define PROTOCOL_BENCH_FRAMES 4096
+#define PROTOCOL_FUZZ_ROUNDS  200000
+
+static uint32_t fuzzState = 0x12345678;
+
+// xorshift32, deterministic so fuzz failures reproduce
+static uint32_t fuzzRandom()
+{
+  fuzzState ^= fuzzState << 13;
+  fuzzState ^= fuzzState >> 17;
+  fuzzState ^= fuzzState << 5;
+  return fuzzState;
+}
+
+struct DecodeCheck {
+  unsigned long frames;
+  unsigned long setpointSum;
+};
+
+static void countFrame(const ControlFrame &frame, void *arg)
+{
+  DecodeCheck *check = (DecodeCheck *)arg;
+  check->frames++;
+  for (int i = 0; i + 1 < frame.length; i += 2)
+    check->setpointSum += (uint16_t)controlReadInt16(frame.payload + i);
+}
+
+static size_t buildSetpoints(uint8_t *out, size_t size, uint16_t sequence)
+{
+  uint8_t payload[CONTROL_CHANNELS * 2];
+  for (int i = 0; i < CONTROL_CHANNELS; i++)
+    controlWriteInt16(payload + i * 2, (int16_t)(fuzzRandom() & 0xFFFF));
+  return controlEncode(out, size, CONTROL_SETPOINTS, sequence, payload, sizeof(payload));
+}
+
+static void benchThroughput(const char *name, size_t maxFragment)
+{
+  static uint8_t stream[PROTOCOL_BENCH_FRAMES * CONTROL_MAX_FRAME];
+  size_t length = 0;
+  for (int i = 0; i < PROTOCOL_BENCH_FRAMES; i++)
+    length += buildSetpoints(stream + length, sizeof(stream) - length, (uint16_t)i);
+
+  ControlDecoder decoder;
+  DecodeCheck check = { 0, 0 };
+  const long passes = 200;
+  double ns = nsPerCall(passes, [&]() {
+    size_t offset = 0;
+    uint32_t random = 0x9E3779B9;
+    while (offset < length)
+    {
+      random = random * 1664525 + 1013904223;
+      size_t chunk = maxFragment == 0 ? length : 1 + (random >> 8) % maxFragment;
+      if (chunk > length - offset)
+        chunk = length - offset;
+      decoder.feed(stream + offset, chunk, countFrame, &check);
+      offset += chunk;
+    }
+  });
+
+  char label[64];
+  snprintf(label, sizeof(label), "decode %s", name);
+  printf("  %-44s %10.2f ns/frame, %.1f MB/s\n", label, ns / PROTOCOL_BENCH_FRAMES, length * 1000.0 / ns);
+  if (check.frames != (unsigned long)passes * PROTOCOL_BENCH_FRAMES)
+    printf("  !! decoded %lu of %lu frames\n", check.frames, (unsigned long)passes * PROTOCOL_BENCH_FRAMES);
+}
+
+/*
+ * Feeds random garbage, truncated and corrupted frames, each followed by a
+ * good frame, and checks the good frame still gets through
+ */
+static void benchFuzz()
+{
+  ControlDecoder decoder;
+  DecodeCheck check = { 0, 0 };
+  uint8_t buffer[CONTROL_MAX_FRAME * 2];
+  unsigned long expected = 0;
+  unsigned long delayed = 0;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (long round = 0; round < PROTOCOL_FUZZ_ROUNDS; round++)
+  {
+    size_t length = 0;
+    switch (fuzzRandom() % 4)
+    {
+      case 0:   // random bytes, no magic so nothing can swallow the good frame
+        length = fuzzRandom() % sizeof(buffer);
+        for (size_t i = 0; i < length; i++)
+        {
+          buffer[i] = (uint8_t)fuzzRandom();
+          if (buffer[i] == CONTROL_MAGIC)
+            buffer[i] = 0;
+        }
+        break;
+      case 1:   // a frame with one flipped bit
+        length = buildSetpoints(buffer, sizeof(buffer), (uint16_t)round);
+        buffer[1 + fuzzRandom() % (length - 1)] ^= 1 << (fuzzRandom() % 8);
+        break;
+      case 2:   // a frame claiming an oversized payload
+        length = buildSetpoints(buffer, sizeof(buffer), (uint16_t)round);
+        buffer[7] = 0xFF;
+        break;
+      case 3:   // a good frame
+        length = buildSetpoints(buffer, sizeof(buffer), (uint16_t)round);
+        expected++;
+        break;
+    }
+    unsigned long before = check.frames;
+    decoder.feed(buffer, length, countFrame, &check);
+
+    // A corrupted length can leave the decoder waiting for more bytes, the
+    // good frame is then only recovered once later data fails the CRC
+    length = buildSetpoints(buffer, sizeof(buffer), (uint16_t)round);
+    expected++;
+    decoder.feed(buffer, length, countFrame, &check);
+    if (check.frames == before)
+      delayed++;
+  }
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  printf("  %-44s %10ld rounds, %lu/%lu frames, %lu delayed by a resync\n", "fuzz",
+    (long)PROTOCOL_FUZZ_ROUNDS, check.frames, expected, delayed);
+  printf("  %-44s %10lu crc, %lu length, %lu version errors, %lu bytes skipped (%.0f ms)\n", "",
+    decoder.crcErrors, decoder.lengthErrors, decoder.versionErrors, decoder.droppedBytes,
+    std::chrono::duration<double, std::milli>(end - start).count());
+}
+
+void benchControlProtocol()
+{
+  const uint8_t check[] = "123456789";
+  if (controlCrc16(check, 9) != 0x29B1)
+    printf("  !! CRC-16/CCITT-FALSE check value mismatch\n");
+
+  benchThroughput("whole stream", 0);
+  benchThroughput("fragments <= 64 bytes", 64);
+  benchThroughput("fragments <= 7 bytes", 7);
+  benchFuzz();
+}
@@ -0,0 +1,739 @@
+/*
+ * Session replay: a control session recorded by SessionRecorder is played
+ * back on a simulated clock through the frame handling of main.cpp, into
+ * the real ControlDecoder, ControlLink, MotorChannel, StepperTimer,
+ * StepScheduler, StepperGroup, SegmentQueue and DCMotorController code,
+ * with a simple model of each motor on the outputs. Reports how closely
+ * the motors followed, the step timing, and the latency from a frame
+ * arriving to the outputs answering it, so two builds can be compared on
+ * the same session:
+ *
+ *   bench replay session.bin      replays a log pulled from /session
+ *
+ * Without a log, benchReplay() runs a scripted session live, recording it
+ * as the firmware would, then replays the recording twice and checks all
+ * three runs come out the same.
+ *
+ * The frame handling, channel setups and setpoints are MotorControl, the
+ * same code main.cpp runs; only its wiring to the network and outputs is
+ * done again here. DC channels are all on LEDC, the firmware's MCPWM
+ * driver has no motor model here.
+ */
+
+#include <math.h>
+#include <string.h>
+#include <vector>
+#include "bench.h"
+#include "host_shim.h"
+#include "StepperTimer.h"
+#include "StepScheduler.h"
+#include "StepperGroup.h"
+#include "SegmentQueue.h"
+#include "MotorChannel.h"
+#include "DCMotorController.h"
+#include "ControlProtocol.h"
+#include "Histogram.h"
+#include "BoardProfile.h"
+#include "SessionRecorder.h"
+#include "MotorControl.h"
+
+// As in main.cpp
+static const int stepsPerRevolution = 200;
+static const long dcMaxSpeed = 255;
+static const uint32_t setpointMaxAgeMs = 200;
+static const float pathAcceleration = 4000;
+static const float junctionDeviation = 2;
+static const BoardProfile &board = featherBoard;
+
+#define REPLAY_SUBSTEPS         10        // motor model steps per control cycle
+#define REPLAY_TICKS_PER_US     (TIMER_SCALE / 1000000)
+#define REPLAY_SETTLE_US        2000000   // run on after the last record
+
+// Stepper rotor pulled towards the commanded position by a torque that
+// goes as sin(error) over four full steps, damped against the commanded
+// speed. Positions in full steps.
+#define ROTOR_STIFFNESS         5.7e5     // full steps/s^2 at the peak torque, ~150Hz
+#define ROTOR_DAMPING           565.0     // 1/s
+#define ROTOR_SLIP              2.0       // full steps behind or ahead, out of sync
+
+// DC motor as a first order lag from duty cycle to speed, setpoint units
+#define DC_TAU                  0.05      // s
+
+struct StepperPlant {
+  double angle;
+  double velocity;
+  double commandedVelocity;   // from the last step interval
+  bool slipped;
+
+  void run(double commanded, double seconds)
+  {
+    double error = commanded - this->angle;
+    double accel = ROTOR_STIFFNESS * sin(error * M_PI / 2) +
+      ROTOR_DAMPING * (this->commandedVelocity - this->velocity);
+    this->velocity += accel * seconds;
+    this->angle += this->velocity * seconds;
+  }
+};
+
+// The motor on the output, and the same motor driven by the setpoint
+// itself as it arrived. The difference is what the device adds - duty
+// resolution and how late the output follows - and not the motor's own
+// lag, which a step in the setpoint would otherwise show as an error of
+// the whole step.
+struct DCPlant {
+  double rate;
+  double ideal;
+
+  void run(double drive, double setpoint, double seconds)
+  {
+    this->rate += (drive - this->rate) * seconds / DC_TAU;
+    this->ideal += (setpoint - this->ideal) * seconds / DC_TAU;
+  }
+};
+
+struct ReplayResult {
+  Histogram stepperError;     // millisteps between commanded and rotor position
+  Histogram dcError;          // setpoint units between the motor and one driven by the setpoint
+  Histogram stepInterval;     // us between steps of an axis
+  Histogram applyLatency;     // us from setpoints arriving to the control loop using them
+  Histogram stepLatency;      // us from setpoints arriving to the next step of a changed axis
+  unsigned long frames;
+  unsigned long accepted;
+  unsigned long outOfOrder;
+  unsigned long expired;
+  unsigned long steps;
+  unsigned long slips;
+  unsigned long movesDone;
+  unsigned long movesCancelled;
+  unsigned long segmentsCompleted;  // as last credited to the client
+  unsigned long segmentsRejected;
+  unsigned long channelsChecked;
+  unsigned long channelsMismatched;
+  uint64_t simulatedUs;
+  uint64_t digest;            // FNV-1a over every step and switch, equal runs match
+};
+
+static void digestAdd(uint64_t &digest, uint64_t value)
+{
+  for (int i = 0; i < 8; i++)
+  {
+    digest ^= (value >> (i * 8)) & 0xFF;
+    digest *= 0x100000001B3ULL;
+  }
+}
+
+static StepperTimer replayStepper(int c)
+{
+  const BoardChannel &ch = board.channel[c];
+  return StepperTimer(stepsPerRevolution, ch.group, ch.timer, ch.pin[0], ch.pin[1], ch.pin[2], ch.pin[3]);
+}
+
+static DCMotorController replayDCMotor(int dc)
+{
+  return DCMotorController(dc, boardDCPin(board, dc, 0), boardDCPin(board, dc, 1));
+}
+
+class ReplayDevice {
+  public:
+    ReplayDevice(uint16_t controlRateHz, uint32_t startMs, SessionRecorder *recorder);
+
+    void connect(int client, uint64_t now);
+    void disconnect(int client, uint64_t now);
+    // A frame from a client, through its decoder
+    void receive(int client, const ControlFrame &frame, uint64_t now);
+    // A channel switch the device recorded, checked a cycle later
+    void expect(const SessionRecord &record);
+    // Runs the outputs, motors and control loop up to a time, us
+    void advance(uint64_t until);
+    bool isIdle();
+    // Records every channel's state, as /session?record=1 does
+    void recordChannels();
+
+    ReplayResult result;
+
+  private:
+    static void onFrame(const ControlFrame &frame, void *arg);
+    static void switchDC(int channel, bool enable);
+    static void dcOutput(int motor, long setpoint, void *arg);
+    static void switched(int channel, void *arg);
+    static void send(int slot, uint8_t type, const uint8_t *payload, uint16_t length, void *arg);
+    void controlStep();
+    void runSteps(uint64_t untilTicks);
+    void runPlants(double seconds);
+    uint32_t millis() { return this->startMs + (uint32_t)(this->now / 1000); }
+
+    uint16_t controlRateHz;
+    uint32_t startMs;
+    uint64_t now;               // us
+    uint64_t nextCycle;
+    uint64_t nextNotify;
+    int receiving;              // client slot of the frame being decoded
+
+    StepScheduler scheduler;
+    StepperTimer steppers[4];
+    MotorChannel channels[4];
+    DCMotorController dcMotors[8];
+    StepperGroup group;
+    SegmentQueue segments;
+    MotorControl control;       // what main.cpp runs
+    bool connected[MOTOR_CONTROL_CLIENTS];
+    int commanded[8];           // setpoints as accepted
+
+    StepperPlant stepperPlant[4];
+    DCPlant dcPlant[8];
+    int64_t lastPosition[4];
+    uint64_t lastStep[4];       // us
+    uint64_t lastInterval[4];   // us, 0 before the second step
+    uint64_t waiting[4];        // arrival of setpoints not yet stepped on, 0 for none
+
+    bool expecting[4];
+    uint64_t expectAt[4];
+    SessionRecord expected[4];
+};
+
+static ReplayDevice *replayDevice;  // for the channel switch callback
+
+ReplayDevice::ReplayDevice(uint16_t controlRateHz, uint32_t startMs, SessionRecorder *recorder)
+  : scheduler(TIMER_GROUP_0, TIMER_0),
+    steppers{ replayStepper(0), replayStepper(1), replayStepper(2), replayStepper(3) },
+    channels{ MotorChannel(0, &steppers[0], switchDC), MotorChannel(1, &steppers[1], switchDC),
+              MotorChannel(2, &steppers[2], switchDC), MotorChannel(3, &steppers[3], switchDC) },
+    dcMotors{ replayDCMotor(0), replayDCMotor(1), replayDCMotor(2), replayDCMotor(3),
+              replayDCMotor(4), replayDCMotor(5), replayDCMotor(6), replayDCMotor(7) },
+    segments(group),
+    control(board, steppers, channels, group, segments)
+{
+  hostShimReset();
+  replayDevice = this;
+  this->result.frames = this->result.accepted = this->result.outOfOrder = this->result.expired = 0;
+  this->result.steps = this->result.slips = this->result.movesDone = this->result.movesCancelled = 0;
+  this->result.segmentsCompleted = this->result.segmentsRejected = 0;
+  this->result.channelsChecked = this->result.channelsMismatched = 0;
+  this->result.simulatedUs = 0;
+  this->result.digest = 0xCBF29CE484222325ULL;
+  this->controlRateHz = controlRateHz;
+  this->startMs = startMs;
+  this->now = 0;
+  this->nextCycle = 0;
+  this->nextNotify = 0;
+  this->receiving = 0;
+
+  // as setup() in main.cpp
+  this->scheduler.begin();
+  for (int i = 0; i < 4; i++)
+  {
+    const BoardChannel &ch = board.channel[i];
+    this->steppers[i].setScheduler(&this->scheduler);
+    this->steppers[i].setCoilChannels(ch.coilChannel[0], ch.coilChannel[1]);
+    this->group.add(&this->steppers[i]);
+  }
+  this->group.setScheduler(&this->scheduler);
+  this->segments.setLimits(pathAcceleration, junctionDeviation);
+  this->control.setOutputs(dcOutput, switched, send, this);
+  this->control.setRecorder(recorder);
+  this->control.setMaxAge(setpointMaxAgeMs);
+
+  memset(this->connected, 0, sizeof(this->connected));
+  memset(this->commanded, 0, sizeof(this->commanded));
+  memset(this->stepperPlant, 0, sizeof(this->stepperPlant));
+  memset(this->dcPlant, 0, sizeof(this->dcPlant));
+  memset(this->lastPosition, 0, sizeof(this->lastPosition));
+  memset(this->lastStep, 0, sizeof(this->lastStep));
+  memset(this->lastInterval, 0, sizeof(this->lastInterval));
+  memset(this->waiting, 0, sizeof(this->waiting));
+  memset(this->expecting, 0, sizeof(this->expecting));
+}
+
+// Brings both DC motors of a channel up stopped, or stops and detaches them
+void ReplayDevice::switchDC(int channel, bool enable)
+{
+  for (int k = channel; k < 8; k += 4)
+  {
+    if (enable)
+      replayDevice->dcMotors[k].SetSpeed(0);
+    else
+      replayDevice->dcMotors[k].Disconnect();
+  }
+}
+
+// All LEDC, no encoders
+void ReplayDevice::dcOutput(int motor, long setpoint, void *arg)
+{
+  ReplayDevice *device = (ReplayDevice *)arg;
+  device->dcMotors[motor].SetSpeed(setpoint * dcMaxSpeed / CONTROL_SETPOINT_MAX);
+}
+
+void ReplayDevice::switched(int channel, void *arg)
+{
+  ReplayDevice *device = (ReplayDevice *)arg;
+  StepperTimer &stepper = device->steppers[channel];
+  digestAdd(device->result.digest, ((uint64_t)channel << 32) | device->channels[channel].state);
+
+  // the rotor starts from wherever the new mode puts it
+  device->stepperPlant[channel].angle = (double)stepper.getPosition() / stepper.microsteps;
+  device->stepperPlant[channel].velocity = 0;
+  device->stepperPlant[channel].commandedVelocity = 0;
+  device->lastPosition[channel] = stepper.getPosition();
+  device->lastInterval[channel] = 0;
+}
+
+void ReplayDevice::send(int slot, uint8_t type, const uint8_t *payload, uint16_t length, void *arg)
+{
+  ReplayDevice *device = (ReplayDevice *)arg;
+  if (type == CONTROL_MOVE_DONE && payload[1] == CONTROL_MOVE_CANCELLED)
+    device->result.movesCancelled++;
+  else if (type == CONTROL_MOVE_DONE)
+    device->result.movesDone++;
+  else if (type == CONTROL_CREDITS && length >= 12)
+  {
+    device->result.segmentsCompleted = (uint32_t)controlReadInt32(payload + 4);
+    device->result.segmentsRejected = (uint32_t)controlReadInt32(payload + 8);
+  }
+}
+
+void ReplayDevice::connect(int client, uint64_t now)
+{
+  if (client < 0 || client >= MOTOR_CONTROL_CLIENTS)
+    return;
+  this->connected[client] = true;
+  this->control.connect(client, now);
+}
+
+void ReplayDevice::disconnect(int client, uint64_t now)
+{
+  if (client < 0 || client >= MOTOR_CONTROL_CLIENTS)
+    return;
+  this->connected[client] = false;
+  this->control.disconnect(client, now);
+}
+
+// Back into bytes and through the client's own decoder, as onEvent() feeds it
+void ReplayDevice::receive(int client, const ControlFrame &frame, uint64_t now)
+{
+  if (client < 0 || client >= MOTOR_CONTROL_CLIENTS)
+    return;
+  // a log started with the client already connected
+  if (!this->connected[client])
+    connect(client, now);
+  uint8_t bytes[CONTROL_MAX_FRAME];
+  size_t length = controlEncode(bytes, sizeof(bytes), frame.type, frame.sequence, frame.payload, frame.length);
+  this->receiving = client;
+  this->control.decoders[client].feed(bytes, length, onFrame, this);
+}
+
+void ReplayDevice::onFrame(const ControlFrame &frame, void *arg)
+{
+  ReplayDevice *device = (ReplayDevice *)arg;
+  device->result.frames++;
+  ControlVerdict verdict = device->control.handle(device->receiving, frame, device->now, device->millis());
+  if (frame.type != CONTROL_SETPOINTS)
+    return;
+  if (verdict == CONTROL_EXPIRED)
+    device->result.expired++;
+  else if (verdict == CONTROL_OUT_OF_ORDER)
+    device->result.outOfOrder++;
+  else
+  {
+    device->result.accepted++;
+    for (int i = 0; i < 8; i++)
+      device->commanded[i] = i*2+2 <= frame.length ? controlReadInt16(frame.payload + i*2) : 0;
+  }
+}
+
+// What each channel was when recording began is applied straight away,
+// later switches are checked against the replay's own
+void ReplayDevice::expect(const SessionRecord &record)
+{
+  int i = record.channel;
+  if (i >= 4)
+    return;
+  if (record.time == 0 && this->result.frames == 0)
+  {
+    this->channels[i].set((ChannelState)record.state, (StepperTimer::modeEnum)record.mode, record.microsteps);
+    return;
+  }
+  this->expecting[i] = true;
+  this->expectAt[i] = record.time + 1000000 / this->controlRateHz;
+  this->expected[i] = record;
+}
+
+// controlStep() in main.cpp, timing each stepper change to its next step
+void ReplayDevice::controlStep()
+{
+  int before[8];
+  memcpy(before, this->control.setpoint, sizeof(before));
+  if (this->control.step(this->now))
+  {
+    for (int i = 0; i < 4; i++)
+    {
+      int setpoint = this->control.setpoint[i];
+      StepperTimer &stepper = this->steppers[i];
+      if (!this->channels[i].isStepper() || this->group.isMoving() || (setpoint == 0 && stepper.isMoving()))
+        continue;
+      if (setpoint != before[i] && this->waiting[i] == 0 && (setpoint != 0 || stepper.isRunning()))
+        this->waiting[i] = this->control.setpointsArrived;
+    }
+  }
+
+  for (int i = 0; i < 4; i++)
+  {
+    if (!this->expecting[i] || this->now < this->expectAt[i])
+      continue;
+    this->expecting[i] = false;
+    this->result.channelsChecked++;
+    const SessionRecord &record = this->expected[i];
+    if (this->channels[i].state != record.state || this->steppers[i].mode != record.mode ||
+        this->steppers[i].microsteps != record.microsteps)
+      this->result.channelsMismatched++;
+  }
+}
+
+// Takes every step due by a time, as the timer interrupt would
+void ReplayDevice::runSteps(uint64_t untilTicks)
+{
+  for (;;)
+  {
+    uint64_t alarm = hostShim.alarmValue[0][0];
+    if (alarm > untilTicks)
+      break;
+    hostShim.counterValue[0][0] = alarm;
+    unsigned long before = this->scheduler.steps;
+    this->scheduler.onAlarm();
+    // nothing left scheduled, the alarm is a stale one
+    if (this->scheduler.steps == before)
+      break;
+
+    uint64_t at = alarm / REPLAY_TICKS_PER_US;
+    for (int i = 0; i < 4; i++)
+    {
+      int64_t position = this->steppers[i].getPosition();
+      if (position == this->lastPosition[i])
+        continue;
+      int64_t moved = position - this->lastPosition[i];
+      this->lastPosition[i] = position;
+      this->result.steps += moved < 0 ? -moved : moved;
+      digestAdd(this->result.digest, at);
+      digestAdd(this->result.digest, (uint64_t)position);
+      if (this->lastStep[i] != 0 && at > this->lastStep[i])
+      {
+        uint64_t interval = at - this->lastStep[i];
+        this->result.stepInterval.add((uint32_t)interval);
+        this->lastInterval[i] = interval;
+        this->stepperPlant[i].commandedVelocity = (moved > 0 ? 1e6 : -1e6) / interval / this->steppers[i].microsteps;
+      }
+      this->lastStep[i] = at;
+      if (this->waiting[i] != 0)
+      {
+        this->result.stepLatency.add((uint32_t)(at - this->waiting[i]));
+        this->waiting[i] = 0;
+      }
+    }
+  }
+  hostShim.counterValue[0][0] = untilTicks;
+}
+
+void ReplayDevice::runPlants(double seconds)
+{
+  for (int i = 0; i < 4; i++)
+  {
+    StepperPlant &plant = this->stepperPlant[i];
+    double commanded = (double)this->steppers[i].getPosition() / this->steppers[i].microsteps;
+    if (!this->channels[i].isStepper())
+    {
+      plant.angle = commanded;
+      plant.velocity = 0;
+      continue;
+    }
+    // group and path moves step the axis without its own planner, so it
+    // counts as stopped once a step is well overdue
+    if (this->lastInterval[i] == 0 || this->now - this->lastStep[i] > 2 * this->lastInterval[i])
+      plant.commandedVelocity = 0;
+    plant.run(commanded, seconds);
+    double error = fabs(commanded - plant.angle);
+    this->result.stepperError.add((uint32_t)(error * 1000));
+    if (error > ROTOR_SLIP && !plant.slipped)
+    {
+      plant.slipped = true;
+      this->result.slips++;
+    }
+    else if (error < 1)
+      plant.slipped = false;
+  }
+
+  for (int k = 0; k < 8; k++)
+  {
+    double drive = 0, setpoint = 0;
+    if (this->channels[k & 3].isDC())
+    {
+      // the PWM is on pin 1 going forward, pin 2 in reverse
+      bool forward = hostShim.pinChannel[boardDCPin(board, k, 0)] == k;
+      drive = (double)hostShim.ledcDuty[k] * CONTROL_SETPOINT_MAX / dcMaxSpeed * (forward ? 1 : -1);
+      setpoint = this->commanded[k];
+    }
+    this->dcPlant[k].run(drive, setpoint, seconds);
+    if (this->channels[k & 3].isDC())
+      this->result.dcError.add((uint32_t)fabs(this->dcPlant[k].ideal - this->dcPlant[k].rate));
+  }
+}
+
+void ReplayDevice::advance(uint64_t until)
+{
+  uint64_t cycle = 1000000 / this->controlRateHz;
+  while (this->now < until)
+  {
+    if (this->now >= this->nextCycle)
+    {
+      controlStep();
+      this->nextCycle += cycle;
+      // loop() comes round every 20ms
+      if (this->now >= this->nextNotify)
+      {
+        this->control.notifyMoves();
+        this->nextNotify += 20000;
+      }
+    }
+    uint64_t to = this->now + cycle / REPLAY_SUBSTEPS;
+    if (to > this->nextCycle)
+      to = this->nextCycle;
+    if (to > until)
+      to = until;
+    runSteps(to * REPLAY_TICKS_PER_US);
+    double seconds = (to - this->now) * 1e-6;
+    this->now = to;
+    runPlants(seconds);
+  }
+  this->result.simulatedUs = this->now;
+  this->result.applyLatency = this->control.applyLatency;
+}
+
+bool ReplayDevice::isIdle()
+{
+  for (int i = 0; i < 4; i++)
+    if (this->steppers[i].isRunning())
+      return false;
+  return this->segments.isIdle();
+}
+
+// Records from before a log's first channel switch or frame are the state
+// it started in, as main.cpp writes them when recording starts
+void ReplayDevice::recordChannels()
+{
+  this->control.recordChannels(this->now);
+}
+
+// Plays a log through a fresh device, then lets the motors come to rest
+static bool replayLog(const uint8_t *data, size_t size, ReplayResult &result, bool &truncated)
+{
+  SessionReader reader(data, size);
+  if (!reader.valid())
+    return false;
+  ReplayDevice device(reader.controlRateHz, reader.startMs, NULL);
+  SessionRecord record;
+  uint64_t end = 0;
+  while (reader.next(record))
+  {
+    device.advance(record.time);
+    if (record.kind == SESSION_FRAME)
+      device.receive(record.client, record.frame, record.time);
+    else if (record.kind == SESSION_CONNECT)
+      device.connect(record.client, record.time);
+    else if (record.kind == SESSION_DISCONNECT)
+      device.disconnect(record.client, record.time);
+    else if (record.kind == SESSION_CHANNEL)
+      device.expect(record);
+    end = record.time;
+  }
+  for (uint64_t t = end + 100000; t < end + REPLAY_SETTLE_US && !device.isIdle(); t += 100000)
+    device.advance(t);
+  device.advance(device.result.simulatedUs + 100000);
+  truncated = reader.truncated;
+  result = device.result;
+  return true;
+}
+
+static void reportReplay(const ReplayResult &r, double wallMs)
+{
+  ReplayResult v = r;
+  printf("  %-44s %10.2f s, %.0fx real time\n", "simulated", r.simulatedUs * 1e-6, r.simulatedUs * 1e-3 / wallMs);
+  printf("  %-44s %10lu, %lu accepted, %lu out of order, %lu expired\n", "frames", r.frames, r.accepted, r.outOfOrder, r.expired);
+  printf("  %-44s %10lu steps, %lu moves done, %lu cancelled, %lu slips\n", "steppers", r.steps, r.movesDone,
+    r.movesCancelled, r.slips);
+  printf("  %-44s %10lu segments credited, %lu rejected\n", "path", r.segmentsCompleted, r.segmentsRejected);
+  printf("  %-44s %10u p50, p99 %u, max %u\n", "stepper lag (millisteps)",
+    v.stepperError.percentile(50), v.stepperError.percentile(99), v.stepperError.max);
+  printf("  %-44s %10u p50, p99 %u, max %u\n", "DC speed error past motor lag (units)",
+    v.dcError.percentile(50), v.dcError.percentile(99), v.dcError.max);
+  printf("  %-44s %10u p50, p99 %u, min %u\n", "step interval (us)",
+    v.stepInterval.percentile(50), v.stepInterval.percentile(99), v.stepInterval.min);
+  printf("  %-44s %10u p50, p99 %u, max %u\n", "setpoint to control loop (us)",
+    v.applyLatency.percentile(50), v.applyLatency.percentile(99), v.applyLatency.max);
+  printf("  %-44s %10u p50, p99 %u, max %u\n", "setpoint to next step (us)",
+    v.stepLatency.percentile(50), v.stepLatency.percentile(99), v.stepLatency.max);
+  if (r.channelsChecked > 0)
+    printf("  %-44s %10lu of %lu matched\n", "channel switches",
+      r.channelsChecked - r.channelsMismatched, r.channelsChecked);
+}
+
+static double msSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int replaySession(const char *path)
+{
+  FILE *file = fopen(path, "rb");
+  if (file == NULL)
+  {
+    printf("%s: can't open\n", path);
+    return 1;
+  }
+  std::vector<uint8_t> log;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    log.insert(log.end(), chunk, chunk + n);
+  fclose(file);
+
+  ReplayResult result;
+  bool truncated = false;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  if (log.empty() || !replayLog(&log[0], log.size(), result, truncated))
+  {
+    printf("%s: not a session log\n", path);
+    return 1;
+  }
+  printf("Replay %s (%lu bytes%s)\n", path, (unsigned long)log.size(), truncated ? ", truncated" : "");
+  reportReplay(result, msSince(start));
+  return 0;
+}
+
+/*
+ * The scripted session: one client syncs its clock, sets up two steppers,
+ * a DC channel and a half stepper, and drives them with stick sweeps every
+ * 20ms - some sent late or resent - then a move, a channel switched while
+ * running, a group move with a move and another group move refused while
+ * it runs, a short path, and a disconnect.
+ */
+#define SCRIPT_START_MS     12345
+#define SCRIPT_CLIENT_CLOCK 5000    // ms the client's clock is ahead
+#define SCRIPT_TRANSIT_US   4000
+
+static uint16_t scriptSequence;
+
+static void scriptSend(ReplayDevice &device, uint64_t at, uint8_t type, const uint8_t *payload, uint16_t length,
+                       uint16_t sequence)
+{
+  device.advance(at);
+  ControlFrame frame = { CONTROL_VERSION, type, 0, sequence, length, payload };
+  device.receive(0, frame, at);
+}
+
+static void runScript(ReplayDevice &device)
+{
+  device.advance(1000);
+  device.connect(0, 1000);
+
+  // a ping answered 10ms later
+  uint8_t pong[8];
+  controlWriteInt32(pong, SCRIPT_START_MS + 20);
+  controlWriteInt32(pong + 4, SCRIPT_START_MS + 25 + SCRIPT_CLIENT_CLOCK);
+  scriptSend(device, 30000, CONTROL_PONG, pong, sizeof(pong), scriptSequence++);
+
+  uint8_t setup[8] = { 1, 1, 2, 1, CONTROL_STEP_FULL, CONTROL_STEP_MICRO_16, CONTROL_STEP_FULL, CONTROL_STEP_HALF };
+  scriptSend(device, 40000, CONTROL_SETUP, setup, sizeof(setup), scriptSequence++);
+
+  uint8_t setpoints[20];
+  for (int n = 0; n < 200; n++)
+  {
+    // arriving anywhere in a control cycle
+    uint64_t at = 60000 + n * 20000ULL + (n * 337) % 1000;
+    double t = at * 1e-6;
+    memset(setpoints, 0, sizeof(setpoints));
+    controlWriteInt16(setpoints + 0, (int16_t)(CONTROL_SETPOINT_MAX * sin(t * 2)));
+    controlWriteInt16(setpoints + 2, (int16_t)(n < 100 ? n * 300 : 0));
+    controlWriteInt16(setpoints + 4, (int16_t)((n / 25) & 1 ? 16000 : -16000));
+    controlWriteInt16(setpoints + 12, (int16_t)(CONTROL_SETPOINT_MAX * fabs(fmod(t, 2.0) - 1)));
+    // stamped on the client clock when sent, every 40th held up on the way
+    uint32_t sent = SCRIPT_START_MS + (uint32_t)((at - SCRIPT_TRANSIT_US) / 1000) + SCRIPT_CLIENT_CLOCK;
+    if (n % 40 == 39)
+      sent -= 300;
+    controlWriteInt32(setpoints + 16, (int32_t)sent);
+    // and every 50th repeated behind the next one
+    uint16_t sequence = scriptSequence++;
+    scriptSend(device, at, CONTROL_SETPOINTS, setpoints, sizeof(setpoints), sequence);
+    if (n % 50 == 49)
+      scriptSend(device, at + 10000, CONTROL_SETPOINTS, setpoints, sizeof(setpoints), sequence - 1);
+  }
+
+  // let the sticks go, then move the half stepper and switch channel 1 to DC under it
+  memset(setpoints, 0, sizeof(setpoints));
+  controlWriteInt32(setpoints + 16, SCRIPT_START_MS + 4100 + SCRIPT_CLIENT_CLOCK);
+  scriptSend(device, 4100000, CONTROL_SETPOINTS, setpoints, sizeof(setpoints), scriptSequence++);
+  uint8_t move[8] = { 3, CONTROL_MOVE_BY };
+  controlWriteInt32(move + 2, 2000);
+  controlWriteInt16(move + 6, 0);
+  scriptSend(device, 4200000, CONTROL_MOVE, move, sizeof(move), scriptSequence++);
+  setup[1] = 2;
+  scriptSend(device, 4500000, CONTROL_SETUP, setup, sizeof(setup), scriptSequence++);
+
+  uint8_t groupMove[19] = { CONTROL_MOVE_BY };
+  controlWriteInt16(groupMove + 1, 0);
+  controlWriteInt32(groupMove + 3, 500);
+  controlWriteInt32(groupMove + 15, -300);
+  scriptSend(device, 7000000, CONTROL_GROUP_MOVE, groupMove, sizeof(groupMove), scriptSequence++);
+  // both cancelled, the axes are the group's until it lands
+  move[0] = 0;
+  scriptSend(device, 7050000, CONTROL_MOVE, move, sizeof(move), scriptSequence++);
+  scriptSend(device, 7060000, CONTROL_GROUP_MOVE, groupMove, sizeof(groupMove), scriptSequence++);
+
+  // a path of three segments over the two steppers left
+  uint8_t path[3 * CONTROL_SEGMENT_SIZE];
+  memset(path, 0, sizeof(path));
+  for (int i = 0; i < 3; i++)
+  {
+    uint8_t *segment = path + i * CONTROL_SEGMENT_SIZE;
+    controlWriteInt16(segment, 1500);
+    controlWriteInt32(segment + 2, 200);
+    controlWriteInt32(segment + 14, i == 1 ? 0 : 150);
+  }
+  scriptSend(device, 8000000, CONTROL_SEGMENTS, path, sizeof(path), scriptSequence++);
+
+  device.advance(9500000);
+  device.disconnect(0, 9500000);
+  device.advance(10000000);
+}
+
+static SessionRecorder scriptRecorder;
+
+void benchReplay()
+{
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  ReplayResult live;
+  {
+    ReplayDevice device(1000, SCRIPT_START_MS, &scriptRecorder);
+    scriptRecorder.start(1000, 0, SCRIPT_START_MS);
+    device.recordChannels();
+    runScript(device);
+    scriptRecorder.stop();
+    live = device.result;
+  }
+  printf("  %-44s %10lu records, %lu bytes, %lu dropped\n", "recorded live", scriptRecorder.records,
+    (unsigned long)scriptRecorder.size(), scriptRecorder.dropped);
+  reportReplay(live, msSince(start));
+
+  ReplayResult first, second;
+  bool truncated = false;
+  start = std::chrono::steady_clock::now();
+  replayLog(scriptRecorder.data(), scriptRecorder.size(), first, truncated);
+  double wallMs = msSince(start);
+  replayLog(scriptRecorder.data(), scriptRecorder.size(), second, truncated);
+  printf("  %-44s %10s, %.1f ms for %.1f s\n", "replayed",
+    first.digest == live.digest && second.digest == live.digest ? "identical" : "DIFFERENT",
+    wallMs, first.simulatedUs * 1e-6);
+  printf("  %-44s %10lu of %lu matched\n", "replayed channel switches",
+    first.channelsChecked - first.channelsMismatched, first.channelsChecked);
+
+  // a log cut short reads up to the cut
+  replayLog(scriptRecorder.data(), scriptRecorder.size() - 7, first, truncated);
+  printf("  %-44s %10s, %lu frames\n", "log cut short", truncated ? "truncated" : "NOT NOTICED", first.frames);
+}
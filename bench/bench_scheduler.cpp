@@ -0,0 +1,50 @@
+/*
+ * StepScheduler benchmarks: interrupt cost and how many steps each
+ * interrupt covers as more axes share the one timer
+ */
+
+#include "bench.h"
+#include "host_shim.h"
+#include "StepperTimer.h"
+#include "StepScheduler.h"
+
+#define SCHEDULER_BENCH_AXES 16
+
+// Runs the scheduler as the timer would, jumping the counter to each alarm
+static void runAxes(const char *name, int axes, bool sameSpeed)
+{
+  StepScheduler scheduler(TIMER_GROUP_0, TIMER_0);
+  StepperTimer *steppers[SCHEDULER_BENCH_AXES];
+  hostShimReset();
+  scheduler.begin();
+  for (int i = 0; i < axes; i++)
+  {
+    steppers[i] = new StepperTimer(200, TIMER_GROUP_0, TIMER_0, 5, 4, 25, 26);
+    steppers[i]->setScheduler(&scheduler);
+    steppers[i]->setSpeed(sameSpeed ? 200 : 150 + i * 7);
+  }
+
+  const long interrupts = BENCH_ITERATIONS / 4;
+  double ns = nsPerCall(interrupts, [&]() {
+    hostShim.counterValue[0][0] = hostShim.alarmValue[0][0];
+    scheduler.onAlarm();
+  });
+
+  char label[64];
+  snprintf(label, sizeof(label), "%s interrupt", name);
+  reportTime(label, ns);
+  printf("  %-44s %10.2f steps/interrupt, %.1f ns/step\n", "", (double)scheduler.steps / scheduler.interrupts,
+    ns * scheduler.interrupts / scheduler.steps);
+
+  for (int i = 0; i < axes; i++)
+    delete steppers[i];
+}
+
+void benchStepScheduler()
+{
+  runAxes("1 axis", 1, true);
+  runAxes("4 axes, same speed", 4, true);
+  runAxes("4 axes, different speeds", 4, false);
+  runAxes("8 axes, different speeds", 8, false);
+  runAxes("16 axes, different speeds", 16, false);
+}
@@ -0,0 +1,294 @@
+/*
+ * SegmentQueue benchmarks: a polygon path streamed in bursts against the
+ * queue's credit, run through the scheduler on the host - with lookahead
+ * the path runs without stopping at the corners. Then the same path from
+ * websocket clients through MotorControl and the credit protocol, the
+ * reports reaching them late, where no segment may be rejected.
+ */
+
+#include <math.h>
+#include <string.h>
+#include "bench.h"
+#include "host_shim.h"
+#include "StepperTimer.h"
+#include "StepScheduler.h"
+#include "StepperGroup.h"
+#include "SegmentQueue.h"
+#include "MotorChannel.h"
+#include "MotorControl.h"
+
+#define PATH_SEGMENTS 72
+#define PATH_RADIUS   3000.0
+
+// A circle on two axes, rounded to whole steps per segment
+static void circlePath(int32_t path[PATH_SEGMENTS][STEPPER_GROUP_MAX_AXES], int axis, int32_t *expected)
+{
+  long x = (long)PATH_RADIUS, y = 0;
+  expected[0] = expected[1] = 0;
+  for (int s = 0; s < PATH_SEGMENTS; s++)
+  {
+    double angle = 2 * M_PI * (s + 1) / PATH_SEGMENTS;
+    long nx = lround(PATH_RADIUS * cos(angle)), ny = lround(PATH_RADIUS * sin(angle));
+    memset(path[s], 0, sizeof(path[s]));
+    path[s][axis] = nx - x;
+    path[s][axis + 1] = ny - y;
+    expected[0] += path[s][axis];
+    expected[1] += path[s][axis + 1];
+    x = nx;
+    y = ny;
+  }
+}
+
+static void runPath(const char *name, float junctionDeviation, int burstInterrupts)
+{
+  StepScheduler scheduler(TIMER_GROUP_0, TIMER_0);
+  StepperGroup group;
+  StepperTimer *steppers[STEPPER_GROUP_MAX_AXES];
+  hostShimReset();
+  scheduler.begin();
+  group.setScheduler(&scheduler);
+  for (int i = 0; i < STEPPER_GROUP_MAX_AXES; i++)
+  {
+    steppers[i] = new StepperTimer(200, TIMER_GROUP_0, TIMER_0, 5, 4, 25, 26);
+    steppers[i]->setScheduler(&scheduler);
+    group.add(steppers[i]);
+  }
+  SegmentQueue queue(group);
+  queue.setLimits(4000, junctionDeviation);
+
+  int32_t path[PATH_SEGMENTS][STEPPER_GROUP_MAX_AXES];
+  int32_t expected[2];
+  circlePath(path, 0, expected);
+
+  int sent = 0;
+  unsigned long interrupts = 0, starved = 0;
+  while ((sent < PATH_SEGMENTS || !queue.isIdle()) && interrupts < 10000000)
+  {
+    // The sender only gets a look in every so often, and never sends
+    // more than it has credit for
+    if (interrupts % burstInterrupts == 0)
+      while (sent < PATH_SEGMENTS && queue.free() > 0)
+        queue.push(path[sent++], 1500);
+    if (!group.isMoving())
+    {
+      if (sent < PATH_SEGMENTS)
+        starved++;
+      queue.start();
+      if (!group.isMoving())
+      {
+        interrupts++;
+        continue;
+      }
+    }
+    hostShim.counterValue[0][0] = hostShim.alarmValue[0][0];
+    scheduler.onAlarm();
+    interrupts++;
+  }
+
+  bool landed = steppers[0]->getPosition() == expected[0] && steppers[1]->getPosition() == expected[1];
+  printf("  %-44s %10s, %lu segments, %.2f s, %lu rejected, %lu starved\n", name, landed ? "landed" : "MISSED",
+    queue.completed, (double)hostShim.alarmValue[0][0] / TIMER_SCALE, queue.rejected, starved);
+
+  for (int i = 0; i < STEPPER_GROUP_MAX_AXES; i++)
+    delete steppers[i];
+}
+
+#define STREAM_CLIENTS   2
+#define STREAM_REPORTS   64
+#define STREAM_CYCLE     (TIMER_SCALE / 1000)   // timer ticks of a 1kHz control loop
+
+// A websocket client sending a circle on its own two axes within its credit
+struct StreamClient {
+  int32_t path[PATH_SEGMENTS][STEPPER_GROUP_MAX_AXES];
+  int32_t expected[2];
+  int sent;
+  uint32_t granted;
+  uint32_t rejected;
+  uint16_t sequence;
+};
+
+// Credit reports on their way to the clients
+struct StreamReport {
+  unsigned long due;        // control cycle it arrives
+  int slot;
+  uint32_t granted;
+  uint32_t rejected;
+};
+
+struct StreamBench {
+  StreamClient clients[STREAM_CLIENTS];
+  StreamReport reports[STREAM_REPORTS];
+  int pending;
+  unsigned long cycle;
+  unsigned long delay;      // control cycles a report takes to arrive
+  unsigned long reportsLost;
+};
+
+static void streamSend(int slot, uint8_t type, const uint8_t *payload, uint16_t length, void *arg)
+{
+  StreamBench *bench = (StreamBench *)arg;
+  if (type != CONTROL_CREDITS || slot < 0)
+    return;
+  if (bench->pending == STREAM_REPORTS)
+  {
+    bench->reportsLost++;
+    return;
+  }
+  StreamReport &report = bench->reports[bench->pending++];
+  report.due = bench->cycle + bench->delay;
+  report.slot = slot;
+  report.granted = (uint32_t)controlReadInt32(payload);
+  report.rejected = (uint32_t)controlReadInt32(payload + 8);
+}
+
+static void streamSwitchDC(int channel, bool enable)
+{
+}
+
+// Sends as much of a client's path as its credit allows, up to 7 segments
+// a frame as the web client does, or all of it once it has any credit
+static void streamPump(MotorControl &control, StreamClient &client, int slot, bool greedy, int64_t now)
+{
+  uint8_t payload[7 * CONTROL_SEGMENT_SIZE];
+  if (client.granted == 0)
+    return;
+  for (;;)
+  {
+    int n = PATH_SEGMENTS - client.sent;
+    if (!greedy && (int)(client.granted - client.sent) < n)
+      n = (int)(client.granted - client.sent);
+    if (n > 7)
+      n = 7;
+    if (n <= 0)
+      return;
+    for (int k = 0; k < n; k++)
+    {
+      const int32_t *segment = client.path[client.sent + k];
+      controlWriteInt16(payload + k * CONTROL_SEGMENT_SIZE, 1500);
+      for (int i = 0; i < 4; i++)
+        controlWriteInt32(payload + k * CONTROL_SEGMENT_SIZE + 2 + i * 4, segment[i]);
+    }
+    client.sent += n;
+    ControlFrame frame = { CONTROL_VERSION, CONTROL_SEGMENTS, 0, client.sequence++,
+                           (uint16_t)(n * CONTROL_SEGMENT_SIZE), payload };
+    control.handle(slot, frame, now, (uint32_t)(now / 1000));
+  }
+}
+
+static void runStreamed(const char *name, int clientCount, unsigned long delay, bool greedy)
+{
+  StepScheduler scheduler(TIMER_GROUP_0, TIMER_0);
+  StepperGroup group;
+  StepperTimer steppers[4] = {
+    StepperTimer(200, TIMER_GROUP_0, TIMER_0, 5, 4, 25, 26), StepperTimer(200, TIMER_GROUP_0, TIMER_0, 5, 4, 25, 26),
+    StepperTimer(200, TIMER_GROUP_0, TIMER_0, 5, 4, 25, 26), StepperTimer(200, TIMER_GROUP_0, TIMER_0, 5, 4, 25, 26)
+  };
+  MotorChannel channels[4] = {
+    MotorChannel(0, &steppers[0], streamSwitchDC), MotorChannel(1, &steppers[1], streamSwitchDC),
+    MotorChannel(2, &steppers[2], streamSwitchDC), MotorChannel(3, &steppers[3], streamSwitchDC)
+  };
+  hostShimReset();
+  scheduler.begin();
+  group.setScheduler(&scheduler);
+  for (int i = 0; i < 4; i++)
+  {
+    steppers[i].setScheduler(&scheduler);
+    group.add(&steppers[i]);
+  }
+  SegmentQueue queue(group);
+  queue.setLimits(4000, 2);
+  MotorControl control(featherBoard, steppers, channels, group, queue);
+  static StreamBench bench;
+  memset(&bench, 0, sizeof(bench));
+  bench.delay = delay;
+  control.setOutputs(NULL, NULL, streamSend, &bench);
+
+  // every channel a full stepper, then the clients connect
+  uint8_t setup[8] = { 1, 1, 1, 1, CONTROL_STEP_FULL, CONTROL_STEP_FULL, CONTROL_STEP_FULL, CONTROL_STEP_FULL };
+  ControlFrame frame = { CONTROL_VERSION, CONTROL_SETUP, 0, 0, sizeof(setup), setup };
+  control.handle(0, frame, 0, 0);
+  for (int c = 0; c < clientCount; c++)
+  {
+    circlePath(bench.clients[c].path, c * 2, bench.clients[c].expected);
+    control.connect(c, 0);
+  }
+
+  // until the path has run and the last reports have had time to arrive
+  unsigned long busyCycle = 0;
+  while (bench.cycle - busyCycle < delay + 100 && bench.cycle < 200000)
+  {
+    // the step interrupts up to the next control cycle
+    uint64_t until = (uint64_t)(bench.cycle + 1) * STREAM_CYCLE;
+    for (;;)
+    {
+      uint64_t alarm = hostShim.alarmValue[0][0];
+      if (alarm > until)
+        break;
+      hostShim.counterValue[0][0] = alarm;
+      unsigned long before = scheduler.steps;
+      scheduler.onAlarm();
+      if (scheduler.steps == before)
+        break;
+    }
+    hostShim.counterValue[0][0] = until;
+    bench.cycle++;
+    int64_t now = (int64_t)(until / (TIMER_SCALE / 1000000));
+
+    // reports that have arrived, and the clients answering them at once
+    for (int r = 0; r < bench.pending;)
+    {
+      StreamReport &report = bench.reports[r];
+      if (report.due > bench.cycle)
+      {
+        r++;
+        continue;
+      }
+      bench.clients[report.slot].granted = report.granted;
+      bench.clients[report.slot].rejected = report.rejected;
+      bench.reports[r] = bench.reports[--bench.pending];
+    }
+    for (int c = 0; c < clientCount; c++)
+      streamPump(control, bench.clients[c], c, greedy, now);
+
+    control.step(now);
+    if (bench.cycle % 20 == 0)
+      control.notifyMoves();
+
+    bool busy = !queue.isIdle() || bench.pending > 0;
+    for (int c = 0; c < clientCount; c++)
+      if (bench.clients[c].sent < PATH_SEGMENTS)
+        busy = true;
+    if (busy)
+      busyCycle = bench.cycle;
+  }
+
+  // clients keeping to their credit land every segment, one that doesn't
+  // is told it lost some
+  unsigned long rejected = queue.rejected + control.segmentsDropped + control.segmentsOverCredit;
+  bool landed = true, told = false;
+  for (int c = 0; c < clientCount; c++)
+  {
+    const StreamClient &client = bench.clients[c];
+    if (steppers[c * 2].getPosition() != client.expected[0] || steppers[c * 2 + 1].getPosition() != client.expected[1])
+      landed = false;
+    if (client.rejected > 0)
+      told = true;
+  }
+  bool pass = greedy ? rejected > 0 && told : rejected == 0 && landed;
+  if (!pass)
+    benchFailures++;
+  printf("  %-44s %10s, %lu segments, %.2f s, %lu rejected%s\n", name, pass ? (landed ? "landed" : "told") : "FAIL",
+    queue.completed, (double)hostShim.counterValue[0][0] / TIMER_SCALE, rejected,
+    greedy ? (told ? ", reported" : ", NOT REPORTED") : "");
+}
+
+void benchSegmentQueue()
+{
+  runPath("72-gon, stop at every corner", 0, 200);
+  runPath("72-gon, junction deviation 2", 2, 200);
+  runPath("72-gon, junction deviation 2, rare sender", 2, 3000);
+  runStreamed("credit, reports 5 cycles late", 1, 5, false);
+  runStreamed("credit, 2 clients, reports 5 cycles late", 2, 5, false);
+  runStreamed("credit, 2 clients, reports 50 cycles late", 2, 50, false);
+  runStreamed("sender ignoring its credit", 1, 5, true);
+}
@@ -0,0 +1,149 @@
+/*
+ * Closed loop DC speed benchmarks: QuadratureEncoder + SpeedPid cost for
+ * all 8 channels, and a simulated motor under load and supply sag
+ */
+
+#include <math.h>
+#include "bench.h"
+#include "host_shim.h"
+#include "QuadratureEncoder.h"
+#include "SpeedPid.h"
+
+#define SPEED_RATE_HZ     1000
+#define SPEED_FULL_SCALE  32767
+#define SPEED_MAX_RATE    6000.0    // counts/s at full scale output, no load
+
+// First order motor, time constant tau, driving the PCNT counter stand-in
+struct SimulatedMotor {
+  double rate;
+  double position;
+  double supply;      // fraction of nominal
+  double load;        // counts/s lost to load
+  double tau;
+
+  void run(pcnt_unit_t unit, int32_t output, double seconds)
+  {
+    double drive = output * SPEED_MAX_RATE / SPEED_FULL_SCALE * this->supply - this->load;
+    this->rate += (drive - this->rate) * seconds / this->tau;
+    this->position += this->rate * seconds;
+    hostShim.pcntCounter[unit] = (int16_t)((int64_t)floor(this->position) % QUADRATURE_ENCODER_WRAP);
+  }
+};
+
+struct SpeedResult {
+  double errorBefore;   // mean |error| over the last 100ms before the disturbance, counts/s
+  double errorAfter;    // and at the end
+  double settle;        // ms from the disturbance until within 2% for good
+  double overshoot;     // counts/s above the target after leaving saturation
+};
+
+// Runs target for 1s, then sags the supply and adds load for 1s
+static SpeedResult simulate(SpeedPid &pid, int32_t target)
+{
+  hostShimReset();
+  QuadratureEncoder encoder(PCNT_UNIT_0, 34, 39);
+  encoder.begin();
+  SimulatedMotor motor = { 0, 0, 1.0, 0, 0.05 };
+  pid.reset();
+
+  SpeedResult result = { 0, 0, 0, 0 };
+  int lastOutside = 0;
+  for (int t = 0; t < 2 * SPEED_RATE_HZ; t++)
+  {
+    if (t == SPEED_RATE_HZ)
+    {
+      motor.supply = 0.8;
+      motor.load = 600;
+    }
+    encoder.sample(SPEED_RATE_HZ);
+    int32_t output = pid.update(target, encoder.rate);
+    motor.run(PCNT_UNIT_0, output, 1.0 / SPEED_RATE_HZ);
+
+    double error = fabs(motor.rate - target);
+    if (t >= SPEED_RATE_HZ - 100 && t < SPEED_RATE_HZ)
+      result.errorBefore += error / 100;
+    if (t >= 2 * SPEED_RATE_HZ - 100)
+      result.errorAfter += error / 100;
+    if (t >= SPEED_RATE_HZ && error > target * 0.02)
+      lastOutside = t;
+  }
+  result.settle = (lastOutside - SPEED_RATE_HZ) * 1000.0 / SPEED_RATE_HZ;
+  return result;
+}
+
+// Asks for more than the motor can do, then drops back to the target and
+// reports how far it then overshoots below it and how long it takes to settle
+static void reportSaturation(const char *name, SpeedPid &pid, int32_t target)
+{
+  hostShimReset();
+  QuadratureEncoder encoder(PCNT_UNIT_0, 34, 39);
+  encoder.begin();
+  SimulatedMotor motor = { 0, 0, 1.0, 0, 0.05 };
+  pid.reset();
+
+  double overshoot = 0;
+  bool crossed = false;
+  int lastOutside = 0;
+  for (int t = 0; t < 2 * SPEED_RATE_HZ; t++)
+  {
+    bool saturating = t < SPEED_RATE_HZ / 2;
+    encoder.sample(SPEED_RATE_HZ);
+    int32_t output = pid.update(saturating ? (int32_t)(SPEED_MAX_RATE * 1.5) : target, encoder.rate);
+    motor.run(PCNT_UNIT_0, output, 1.0 / SPEED_RATE_HZ);
+    if (saturating)
+      continue;
+    crossed = crossed || motor.rate < target;
+    if (crossed && target - motor.rate > overshoot)
+      overshoot = target - motor.rate;
+    if (fabs(motor.rate - target) > target * 0.02)
+      lastOutside = t;
+  }
+  printf("  %-44s %6.0f counts/s under, settles %4.0f ms\n", name, overshoot,
+    (lastOutside - SPEED_RATE_HZ / 2) * 1000.0 / SPEED_RATE_HZ);
+}
+
+static void reportSpeed(const char *name, SpeedPid &pid)
+{
+  SpeedResult result = simulate(pid, 3000);
+  printf("  %-44s %6.0f -> %4.0f counts/s off, settles %4.0f ms\n", name, result.errorBefore, result.errorAfter,
+    result.settle);
+}
+
+void benchSpeedControl()
+{
+  // gains relative to the open loop feed-forward, as main.cpp sets them
+  float scale = SPEED_FULL_SCALE / SPEED_MAX_RATE;
+  SpeedPid pid;
+  pid.setLimit(SPEED_FULL_SCALE);
+
+  pid.setGains(0, 0, 0, scale, SPEED_RATE_HZ);
+  reportSpeed("open loop, 3000 then sag + load", pid);
+  pid.setGains(1.0 * scale, 20.0 * scale, 0, scale, SPEED_RATE_HZ);
+  reportSpeed("PID, 3000 then sag + load", pid);
+  reportSaturation("PID, 9000 (saturated) then 3000", pid, 3000);
+
+  // Cost of one control cycle over all 8 channels
+  QuadratureEncoder *encoders[8];
+  SpeedPid pids[8];
+  for (int i = 0; i < 8; i++)
+  {
+    encoders[i] = new QuadratureEncoder((pcnt_unit_t)i, 34, 39);
+    encoders[i]->begin();
+    pids[i].setGains(1.0 * scale, 20.0 * scale, 0.001 * scale, scale, SPEED_RATE_HZ);
+    pids[i].setLimit(SPEED_FULL_SCALE);
+  }
+  int16_t counter = 0;
+  double ns = nsPerCall(BENCH_ITERATIONS / 8, [&]() {
+    counter += 3;
+    for (int i = 0; i < 8; i++)
+    {
+      hostShim.pcntCounter[i] = counter;
+      encoders[i]->sample(SPEED_RATE_HZ);
+      pids[i].update(3000, encoders[i]->rate);
+    }
+  });
+  reportTime("sample() + update(), 8 channels", ns);
+  printf("  %-44s %10.3f %%\n", "  of a 1kHz control period", ns / 1e6 * 100);
+  for (int i = 0; i < 8; i++)
+    delete encoders[i];
+}
@@ -0,0 +1,143 @@
+/*
+ * StepDirStepper benchmarks: the cost of encoding a step into an RMT item,
+ * and moves played through the stand-in transmitter to check that every
+ * encoded step comes out as one pulse, in the right direction, with the
+ * driver's pulse width and setup time, for one interrupt per half block
+ */
+
+#include "bench.h"
+#include "host_shim.h"
+#include "StepDirStepper.h"
+
+#define STEP_PIN 32
+#define DIR_PIN  33
+
+static volatile rmt_item32_t scratch[STEP_DIR_BLOCK];
+
+// Plays the channel until it stops, returns the items played
+static unsigned long play(StepDirStepper &stepper)
+{
+  unsigned long items = 0;
+  for (int i = 0; i < 1000 && stepper.isRunning(); i++)
+    items += hostShimRmtTransmit(RMT_CHANNEL_0, DIR_PIN, 100000);
+  return items;
+}
+
+void benchStepDirStepper()
+{
+  // encode() on its own at a steady rate, per step
+  long rates[] = { 1000, 50000, 400000 };
+  for (int r = 0; r < 3; r++)
+  {
+    StepDirStepper stepper(RMT_CHANNEL_0, STEP_PIN, DIR_PIN);
+    stepper.planner.setRate((int32_t)rates[r] << STEP_PLANNER_RATE_SHIFT);
+    stepper.planner.start();
+    char name[48];
+    snprintf(name, sizeof(name), "encode() per step at %ld steps/s", rates[r]);
+    double ns = nsPerCall(BENCH_ITERATIONS / 64, [&]() {
+      stepper.encode(scratch, STEP_DIR_BLOCK);
+    });
+    reportTime(name, ns / STEP_DIR_BLOCK);
+  }
+
+  hostShimReset();
+  StepDirStepper stepper(RMT_CHANNEL_0, STEP_PIN, DIR_PIN);
+  stepper.begin();
+  stepper.setAcceleration(200000, 0);
+
+  // Moves out and back, some short enough never to reach full speed
+  int64_t targets[] = { 20000, -5000, -4990, 3, 0, 100000, 99999, 0 };
+  long speeds[] = { 200000, 400000, 50000, 1000, 100000, 400000, 400000, 300000 };
+  unsigned long missed = 0, items = 0;
+  for (int m = 0; m < 8; m++)
+  {
+    long steps = hostShim.rmt[0].steps;
+    int64_t from = stepper.getPosition();
+    stepper.moveTo(targets[m], speeds[m]);
+    items += play(stepper);
+    int64_t moved = stepper.getPosition() - from;
+    if (stepper.isRunning() || stepper.getPosition() != targets[m] || hostShim.rmt[0].steps - steps != moved)
+      missed++;
+  }
+  HostRmtChannel &tx = hostShim.rmt[0];
+  reportCount("moves off target", missed, "of 8");
+  printf("  %-44s %10lu pulses, %ld net, position %ld\n", "played", tx.pulses, tx.steps, (long)stepper.getPosition());
+  printf("  %-44s %10lu completed, %lu runs\n", "moves", stepper.movesCompleted, stepper.runs);
+  reportCount("shortest step pulse", tx.minHigh, "ticks (0.1us)");
+  reportCount("shortest dir setup after reversal", tx.minReversalGap, "ticks (0.1us)");
+  printf("  %-44s %10lu reversals\n", "direction changes", tx.reversals);
+  printf("  %-44s %10.4f per step (%lu refills)\n", "interrupts", (double)hostShim.rmtInterrupts / tx.pulses, stepper.refills);
+  reportCount("items per step", items * 1000 / tx.pulses, "/1000");
+
+  // A long, slow step gap spills into idle items without losing time
+  hostShimReset();
+  stepper.begin();
+  stepper.setPosition(0);
+  stepper.setAcceleration(4000, 0);
+  stepper.moveTo(3, 1);
+  play(stepper);
+  printf("  %-44s %10lu ticks apart, %lu pulses\n", "slowest steps", (unsigned long)hostShim.rmt[0].maxPeriod, hostShim.rmt[0].pulses);
+
+  // Full speed, then halted: the pulses stop at the next item
+  hostShimReset();
+  stepper.begin();
+  stepper.setAcceleration(2000000, 0);
+  stepper.setTargetSpeed(400000);
+  hostShimRmtTransmit(RMT_CHANNEL_0, DIR_PIN, 200000);
+  reportCount("fastest step rate", STEP_DIR_TICK_RATE / hostShim.rmt[0].minPeriod, "steps/s");
+  stepper.halt();
+  unsigned long pulses = hostShim.rmt[0].pulses;
+  play(stepper);
+  printf("  %-44s %10s, %lu pulses after\n", "halt() at full speed",
+    stepper.isRunning() ? "STILL RUNNING" : "stopped", hostShim.rmt[0].pulses - pulses);
+
+  // Halted anywhere in the block, ramping or cruising, either way: the
+  // position has to be what reached the pin, and a move after lands
+  unsigned long off = 0, offAfter = 0, halts = 0;
+  for (int n = 1; n < 400; n += 7)
+  {
+    hostShimReset();
+    stepper.begin();
+    stepper.setPosition(0);
+    stepper.setAcceleration(n & 1 ? 200000 : 2000000, 0);
+    stepper.setTargetSpeed(n & 2 ? -300000 : 300000);
+    hostShimRmtTransmit(RMT_CHANNEL_0, DIR_PIN, n);
+    stepper.halt();
+    play(stepper);
+    halts++;
+    if (stepper.getPosition() != hostShim.rmt[0].steps)
+      off++;
+    stepper.moveTo(1000, 100000);
+    play(stepper);
+    if (hostShim.rmt[0].steps != 1000)
+      offAfter++;
+  }
+  printf("  %-44s %10lu of %lu, %lu moves after off target\n", "position off the pin after halt()",
+    off, halts, offAfter);
+
+  // Several axes share the one interrupt, each refilled from its own status bits
+  hostShimReset();
+  StepDirStepper a1(RMT_CHANNEL_1, 25, 26), a2(RMT_CHANNEL_2, 27, 14), a3(RMT_CHANNEL_3, 12, 13);
+  StepDirStepper *axes[] = { &stepper, &a1, &a2, &a3 };
+  int dirPins[] = { DIR_PIN, 26, 14, 13 };
+  for (int a = 0; a < 4; a++)
+  {
+    axes[a]->begin();
+    axes[a]->setAcceleration(2000000, 0);
+    axes[a]->setTargetSpeed(a & 1 ? -300000 : 300000);
+  }
+  for (int i = 0; i < 100; i++)
+    for (int a = 0; a < 4; a++)
+      hostShimRmtTransmit(a, dirPins[a], 1000);
+  unsigned long wrong = 0;
+  for (int a = 0; a < 4; a++)
+  {
+    // 1000 items each round, less the setup time before the first step
+    long pulses = (long)hostShim.rmt[a].pulses;
+    if (pulses != 100000 - 1 || hostShim.rmt[a].steps != (a & 1 ? -pulses : pulses))
+      wrong++;
+    axes[a]->halt();
+  }
+  printf("  %-44s %10lu axes wrong, %.4f interrupts per step\n", "4 axes at 300k steps/s",
+    wrong, (double)hostShim.rmtInterrupts / 400000);
+}
@@ -0,0 +1,226 @@
+/*
+ * StepperTimer benchmarks: step() per mode, setSpeed(), setTargetSpeed(),
+ * the planner ramp, position moves, the microstep coil currents and the
+ * braking distance against its exact value
+ */
+
+#include <math.h>
+#include "bench.h"
+#include "host_shim.h"
+#include "StepperTimer.h"
+
+static const char *modeNames[] = { "full", "half", "wave", "micro 16" };
+
+// Signed duty a coil is driven with, from the shim's LEDC registers and
+// which side of the bridge its channel is routed to
+static int coilDuty(int channel, int positivePin, int negativePin)
+{
+  int duty = LEDC.channel_group[0].channel[channel].duty.duty >> 4;
+  if (hostShim.pinChannel[positivePin] == channel)
+    return duty;
+  if (hostShim.pinChannel[negativePin] == channel)
+    return -duty;
+  return 0;
+}
+
+// Steps one electrical cycle forward, checking the coil currents trace a
+// circle at the angle of each phase - every full step lands at the same
+// angle as the full sequence, 45 degrees plus a quarter turn per step
+static void reportMicrostepping(StepperTimer &stepper, int microsteps)
+{
+  stepper.setMode(StepperTimer::micro, microsteps);
+  stepper.setSpeed(100);
+  double minimum = 1e9, maximum = 0, worstAngle = 0;
+  for (int i = 0; i < 4 * microsteps; i++)
+  {
+    stepper.step();
+    int a = coilDuty(0, 5, 4);
+    int b = coilDuty(4, 25, 26);
+    double magnitude = sqrt((double)a * a + (double)b * b);
+    if (magnitude < minimum)
+      minimum = magnitude;
+    if (magnitude > maximum)
+      maximum = magnitude;
+    double expected = fmod((stepper.step_number % (4 * microsteps)) * 2 * M_PI / (4 * microsteps) + M_PI / 4, 2 * M_PI);
+    double error = fabs(remainder(atan2((double)b, (double)a) - expected, 2 * M_PI));
+    if (error > worstAngle)
+      worstAngle = error;
+  }
+  char name[64];
+  snprintf(name, sizeof(name), "coil current 1/%d [duty range, angle]", microsteps);
+  printf("  %-44s %4.0f-%3.0f of 255, %.2f deg worst\n", name, minimum, maximum, worstAngle * 180 / M_PI);
+}
+
+// Steps and simulated time taken to ramp from standstill to the target speed
+static void reportRamp(const char *name, StepperTimer &stepper, long targetSpeed)
+{
+  stepper.setSpeed(0);
+  stepper.step();
+  stepper.setTargetSpeed(targetSpeed);
+  unsigned long steps = 0;
+  uint64_t ticks = 0;
+  while (stepper.planner.rate != stepper.planner.target && steps < 1000000)
+  {
+    stepper.step();
+    ticks += stepper.stepWaitTicks;
+    steps++;
+  }
+  printf("  %-44s %10lu steps, %.1f ms\n", name, steps, ticks * 1000.0 / TIMER_SCALE);
+}
+
+// Steps a move to completion, reports where it landed and how long it took
+// brakingSteps() over rates up to the RMT's, and at the top of 16 bits
+// where the square comes closest to overflowing, never short of v^2/2a
+static void reportBraking(const char *name, uint32_t acceleration)
+{
+  StepPlanner planner(TIMER_SCALE);
+  planner.setLimits(acceleration, 0);
+  unsigned long short_ = 0;
+  double worst = 0;
+  static const uint32_t edges[] = { 0xFFFE, 0xFFFF, 0x1FFFC, 0x1FFFE, 0x3FFF8, 0x3FFFC };
+  uint32_t speed = 1;
+  for (unsigned e = 0; e < sizeof(edges) / sizeof(edges[0]) || speed < 0x100000; )
+  {
+    uint32_t at = speed < 0x100000 ? speed : edges[e++];
+    speed += speed < 0x100000 ? speed / 64 + 1 : 0;
+    planner.rate = (int32_t)(at << STEP_PLANNER_RATE_SHIFT);
+    double exact = (double)at * at / (2.0 * acceleration);
+    uint32_t steps = planner.stoppingSteps();
+    if (steps < exact)
+      short_++;
+    if (steps - exact > worst)
+      worst = steps - exact;
+  }
+  printf("  %-44s %10lu short, worst %.1f steps over\n", name, short_, worst);
+}
+
+static void reportMove(const char *name, StepperTimer &stepper, int64_t target, long maxSpeed)
+{
+  unsigned long completed = stepper.movesCompleted;
+  stepper.moveTo(target, maxSpeed);
+  unsigned long steps = 0;
+  uint64_t ticks = 0;
+  while (stepper.isMoving() && steps < 1000000)
+  {
+    if (stepper.step() != 0)
+      steps++;
+    ticks += stepper.stepWaitTicks;
+  }
+  printf("  %-44s %10lld landed, %lu steps, %.1f ms%s\n", name, (long long)stepper.getPosition(), steps,
+    ticks * 1000.0 / TIMER_SCALE, stepper.movesCompleted == completed + 1 ? "" : " (not completed)");
+}
+
+void benchStepperTimer()
+{
+  StepperTimer stepper(200, TIMER_GROUP_0, TIMER_0, 5, 4, 25, 26);
+  stepper.setCoilChannels(0, 4);
+  char name[64];
+
+  for(int m = StepperTimer::full; m <= StepperTimer::micro; m++)
+  {
+    stepper.setMode((StepperTimer::modeEnum)m, 16);
+
+    stepper.setSpeed(100);
+    hostShimReset();
+    double ns = nsPerCall(BENCH_ITERATIONS, [&]() { stepper.step(); });
+    snprintf(name, sizeof(name), "step() forward [%s]", modeNames[m]);
+    reportTime(name, ns);
+    snprintf(name, sizeof(name), "  gpio writes per step [%s]", modeNames[m]);
+    reportCount(name, (hostShim.gpioWrites + hostShim.gpioRegisterWrites) / BENCH_ITERATIONS, "writes");
+    if (m == StepperTimer::micro)
+    {
+      snprintf(name, sizeof(name), "  pin reroutes per 1000 steps [%s]", modeNames[m]);
+      reportCount(name, hostShim.gpioMatrixRoutes * 1000 / BENCH_ITERATIONS, "routes");
+    }
+
+    stepper.setSpeed(-100);
+    ns = nsPerCall(BENCH_ITERATIONS, [&]() { stepper.step(); });
+    snprintf(name, sizeof(name), "step() reverse [%s]", modeNames[m]);
+    reportTime(name, ns);
+  }
+
+  for (int microsteps = 4; microsteps <= 32; microsteps <<= 1)
+    reportMicrostepping(stepper, microsteps);
+
+  stepper.setMode(StepperTimer::full);
+  stepper.setSpeed(0);
+  reportTime("step() stopped (coast)", nsPerCall(BENCH_ITERATIONS, [&]() { stepper.step(); }));
+
+  long speed = 0;
+  hostShimReset();
+  reportTime("setSpeed()", nsPerCall(BENCH_ITERATIONS, [&]() { stepper.setSpeed((speed++ & 0xff) + 1); }));
+  reportCount("  timer calls per setSpeed()", hostShim.timerCalls / BENCH_ITERATIONS, "calls");
+
+  stepper.setSpeed(100);
+  speed = 0;
+  reportTime("setTargetSpeed()", nsPerCall(BENCH_ITERATIONS, [&]() { stepper.setTargetSpeed((speed++ & 0xff) + 1); }));
+
+  reportTime("updateSpeed()", nsPerCall(BENCH_ITERATIONS, [&]() { stepper.updateSpeed(); }));
+
+  // Keep the planner ramping by flipping the target every few steps
+  long iteration = 0;
+  stepper.setAcceleration(4000, 0);
+  stepper.setSpeed(100);
+  reportTime("step() ramping [trapezoid]", nsPerCall(BENCH_ITERATIONS, [&]() {
+    if ((iteration++ & 0x3f) == 0)
+      stepper.setTargetSpeed(stepper.targetSpeed == 0 ? 255 : 0);
+    stepper.step();
+  }));
+  reportRamp("ramp 0 -> 255 [trapezoid 4000]", stepper, 255);
+
+  stepper.setAcceleration(4000, 20000);
+  stepper.setSpeed(100);
+  reportTime("step() ramping [s-curve]", nsPerCall(BENCH_ITERATIONS, [&]() {
+    if ((iteration++ & 0x3f) == 0)
+      stepper.setTargetSpeed(stepper.targetSpeed == 0 ? 255 : 0);
+    stepper.step();
+  }));
+  reportRamp("ramp 0 -> 255 [s-curve 4000/20000]", stepper, 255);
+
+  stepper.setAcceleration(4000, 0);
+  stepper.setSpeed(0);
+  stepper.step();
+  stepper.setPosition(0);
+  reportMove("moveTo(2000) [trapezoid]", stepper, 2000, 255);
+  reportMove("moveTo(-150) [trapezoid]", stepper, -150, 255);
+  reportMove("moveTo(-149)", stepper, -149, 255);
+
+  // Retarget halfway through a fast move, forcing an overshoot
+  stepper.moveTo(5000, 255);
+  for (int i = 0; i < 1000; i++)
+    stepper.step();
+  reportMove("moveTo(500) after overshoot", stepper, 500, 255);
+
+  stepper.setAcceleration(4000, 20000);
+  reportMove("moveTo(3000) [s-curve]", stepper, 3000, 255);
+
+  stepper.setAcceleration(4000, 0);
+  iteration = 0;
+  reportTime("step() during moves", nsPerCall(BENCH_ITERATIONS, [&]() {
+    if (!stepper.isMoving())
+      stepper.moveTo((iteration++ & 1) ? 0 : 4000, 255);
+    stepper.step();
+  }));
+
+  reportBraking("brakingSteps() [4000 steps/s^2]", 4000);
+  reportBraking("brakingSteps() [4000 x 32 microsteps]", 4000 * 32);
+  reportBraking("brakingSteps() [4000000 steps/s^2]", 4000000);
+
+  // Distinct planner targets a forward setpoint (0..32767) can ask for,
+  // through 255 speed units and as a rate of the same top speed
+  StepperTimer fine(200, TIMER_GROUP_0, TIMER_0, 5, 4, 25, 26);
+  unsigned long speeds = 0, rates = 0;
+  int32_t lastSpeed = -1, lastRate = -1;
+  for (long setpoint = 0; setpoint <= 32767; setpoint++)
+  {
+    fine.setTargetSpeed(setpoint * 255 / 32767);
+    if (fine.planner.target != lastSpeed)
+      speeds++;
+    lastSpeed = fine.planner.target;
+    fine.setTargetRate((int32_t)((int64_t)setpoint * (2125 << STEP_PLANNER_RATE_SHIFT) / 32767));
+    if (fine.planner.target != lastRate)
+      rates++;
+    lastRate = fine.planner.target;
+  }
+  printf("  %-44s %10lu speeds, %lu as rates\n", "setpoint resolution", speeds, rates);
+}
@@ -0,0 +1,215 @@
+/*
+ * TelemetryPublisher benchmarks: encode cost per publish cycle, frame size
+ * against sending every field, and a run with several viewers, some of
+ * them slow, checking their queues stay bounded and that every viewer
+ * decodes back exactly the state that was published
+ */
+
+#include <string.h>
+#include "bench.h"
+#include "TelemetryPublisher.h"
+#include "ControlProtocol.h"
+
+#define TELEMETRY_BENCH_CYCLES   20000
+#define TELEMETRY_BENCH_VIEWERS  6
+#define TELEMETRY_BENCH_QUEUE    4
+
+// Four steppers ramping and running, two encoders, the rest idle - what a
+// busy machine publishes each cycle
+static void sample(TelemetryPublisher &telemetry, long cycle)
+{
+  for (int i = 0; i < 4; i++)
+  {
+    int base = i * CONTROL_TELEMETRY_AXIS;
+    int32_t speed = (int32_t)((cycle * (i + 1)) % 400) - 200;
+    telemetry.set(base + CONTROL_TELEMETRY_SPEED, speed);
+    telemetry.set(base + CONTROL_TELEMETRY_TARGET_SPEED, (int32_t)(cycle / 50 % 2 ? 200 : -200));
+    telemetry.set(base + CONTROL_TELEMETRY_STEP_TICKS, speed ? 1000000 / (speed < 0 ? -speed : speed) : 0);
+    telemetry.set(base + CONTROL_TELEMETRY_POSITION, (int32_t)(cycle * speed / 20));
+    telemetry.set(base + CONTROL_TELEMETRY_STATE, speed ? 1 : 0);
+  }
+  telemetry.set(CONTROL_TELEMETRY_DC_SPEED, (int32_t)(16000 + cycle % 7));
+  telemetry.set(CONTROL_TELEMETRY_DC_SPEED + 1, (int32_t)(-8000 - cycle % 5));
+}
+
+// The client side of the format, as the web page applies it
+struct Viewer {
+  int32_t values[TELEMETRY_MAX_FIELDS];
+  int sequence;
+  size_t queued;
+  unsigned long received;
+  unsigned long rejected;
+
+  void apply(const uint8_t *payload)
+  {
+    bool key = payload[0] & TELEMETRY_KEY;
+    int sequence = payload[1] | (payload[2] << 8);
+    if (!key && sequence != ((this->sequence + 1) & 0xFFFF))
+    {
+      this->rejected++;
+      return;
+    }
+    uint32_t mask = payload[3] | (payload[4] << 8) | (payload[5] << 16) | ((uint32_t)payload[6] << 24);
+    const uint8_t *p = payload + TELEMETRY_HEADER_SIZE;
+    for (int f = 0; f < TELEMETRY_MAX_FIELDS; f++)
+    {
+      if (!(mask & (1UL << f)))
+        continue;
+      uint32_t zigzag = 0;
+      int shift = 0;
+      uint8_t c;
+      do {
+        c = *p++;
+        zigzag |= (uint32_t)(c & 0x7F) << shift;
+        shift += 7;
+      } while (c & 0x80);
+      int32_t value = (int32_t)((zigzag >> 1) ^ -(zigzag & 1));
+      this->values[f] = key ? value : (int32_t)((uint32_t)this->values[f] + (uint32_t)value);
+    }
+    this->sequence = sequence;
+    this->received++;
+  }
+};
+
+static void benchEncode()
+{
+  TelemetryPublisher telemetry(CONTROL_TELEMETRY_FIELDS);
+  uint8_t payload[TELEMETRY_MAX_PAYLOAD];
+  long cycle = 0;
+  size_t sink = 0;
+  double ns = nsPerCall(BENCH_ITERATIONS / 4, [&]() {
+    sample(telemetry, cycle++);
+    if (telemetry.changed())
+      sink += telemetry.encode(payload, sizeof(payload), false);
+    telemetry.commit();
+  });
+  reportTime("sample, delta encode and commit, 28 fields", ns);
+  ns = nsPerCall(BENCH_ITERATIONS / 4, [&]() {
+    sink += telemetry.encode(payload, sizeof(payload), true);
+  });
+  reportTime("key frame encode", ns);
+
+  TelemetryPublisher sizes(CONTROL_TELEMETRY_FIELDS);
+  unsigned long deltaBytes = 0;
+  unsigned long deltas = 0;
+  for (long i = 0; i < TELEMETRY_BENCH_CYCLES; i++)
+  {
+    sample(sizes, i);
+    if (sizes.changed())
+    {
+      deltaBytes += sizes.encode(payload, sizeof(payload), false);
+      deltas++;
+    }
+    sizes.commit();
+  }
+  reportCount("payload, every field as int32", CONTROL_TELEMETRY_FIELDS * 4, "bytes");
+  reportCount("payload, key frame", sizes.encode(payload, sizeof(payload), true), "bytes");
+  reportCount("payload, delta (average)", deltas ? deltaBytes / deltas : 0, "bytes");
+  if (sink == 0)
+    printf("  (no frames encoded)\n");
+}
+
+// Viewers drain their socket queue at different speeds. The publisher side
+// mirrors publishTelemetry() in main.cpp: one delta and one key frame
+// encoded at most per cycle, skipped while a queue is over the limit.
+static void benchViewers()
+{
+  TelemetryPublisher telemetry(CONTROL_TELEMETRY_FIELDS);
+  Viewer viewers[TELEMETRY_BENCH_VIEWERS];
+  memset(viewers, 0, sizeof(viewers));
+  // cycles between drained messages, 1 keeps up, higher fall behind
+  const int drainEvery[TELEMETRY_BENCH_VIEWERS] = { 1, 1, 1, 1, 3, 10 };
+  uint8_t delta[TELEMETRY_MAX_PAYLOAD];
+  uint8_t key[TELEMETRY_MAX_PAYLOAD];
+  unsigned long built = 0;
+  unsigned long maxBuilt = 0;
+  size_t maxQueue = 0;
+  unsigned long mismatches = 0;
+
+  for (long cycle = 0; cycle < TELEMETRY_BENCH_CYCLES; cycle++)
+  {
+    sample(telemetry, cycle);
+    bool changed = telemetry.changed();
+    bool haveDelta = false;
+    bool haveKey = false;
+    unsigned long buildsThisCycle = 0;
+    for (int v = 0; v < TELEMETRY_BENCH_VIEWERS; v++)
+    {
+      Viewer &viewer = viewers[v];
+      uint32_t id = v + 1;
+      if (viewer.queued > 0 && cycle % drainEvery[v] == 0)
+        viewer.queued--;
+      if (viewer.queued > TELEMETRY_BENCH_QUEUE)
+      {
+        telemetry.skipped(id);
+        continue;
+      }
+      const uint8_t *frame;
+      if (telemetry.needsKey(id))
+      {
+        if (!haveKey)
+        {
+          telemetry.encode(key, sizeof(key), true);
+          haveKey = true;
+          buildsThisCycle++;
+        }
+        frame = key;
+      }
+      else if (changed)
+      {
+        if (!haveDelta)
+        {
+          telemetry.encode(delta, sizeof(delta), false);
+          haveDelta = true;
+          buildsThisCycle++;
+        }
+        frame = delta;
+      }
+      else
+        continue;
+      viewer.apply(frame);
+      viewer.queued++;
+      if (viewer.queued > maxQueue)
+        maxQueue = viewer.queued;
+      telemetry.delivered(id);
+    }
+    telemetry.commit();
+    built += buildsThisCycle;
+    if (buildsThisCycle > maxBuilt)
+      maxBuilt = buildsThisCycle;
+
+    // A viewer that got this cycle's frame must now hold exactly the
+    // published state
+    uint8_t check[TELEMETRY_MAX_PAYLOAD];
+    telemetry.encode(check, sizeof(check), true);
+    Viewer truth;
+    memset(&truth, 0, sizeof(truth));
+    truth.apply(check);
+    for (int v = 0; v < TELEMETRY_BENCH_VIEWERS; v++)
+      if (!telemetry.needsKey(v + 1) && memcmp(viewers[v].values, truth.values, sizeof(truth.values)) != 0)
+        mismatches++;
+  }
+
+  reportCount("viewers", TELEMETRY_BENCH_VIEWERS, "");
+  reportCount("frames encoded per cycle (average x100)", built * 100 / TELEMETRY_BENCH_CYCLES, "");
+  reportCount("frames encoded per cycle (max)", maxBuilt, "");
+  reportCount("deepest viewer queue", maxQueue, "messages");
+  for (int v = 0; v < TELEMETRY_BENCH_VIEWERS; v++)
+  {
+    char name[48];
+    snprintf(name, sizeof(name), "viewer draining every %d cycles, frames", drainEvery[v]);
+    reportCount(name, viewers[v].received, "");
+  }
+  reportCount("skipped sends", telemetry.skips, "");
+  unsigned long rejected = 0;
+  for (int v = 0; v < TELEMETRY_BENCH_VIEWERS; v++)
+    rejected += viewers[v].rejected;
+  reportCount("deltas a viewer could not apply", rejected, "(should be 0)");
+  reportCount("viewer state mismatches", mismatches, "(should be 0)");
+}
+
+void benchTelemetry()
+{
+  benchEncode();
+  benchViewers();
+}
@@ -0,0 +1,110 @@
+/*
+ * StepTrace benchmarks: what tracing adds to the step interrupt, and the
+ * size of a /metrics scrape
+ */
+
+#include <string.h>
+#include "bench.h"
+#include "host_shim.h"
+#include "StepperTimer.h"
+#include "StepScheduler.h"
+#include "StepTrace.h"
+#include "MetricsWriter.h"
+
+#define TRACE_BENCH_AXES 4
+
+static double interruptCost(StepScheduler &scheduler)
+{
+  return nsPerCall(BENCH_ITERATIONS / 4, [&]() {
+    hostShim.counterValue[0][0] = hostShim.alarmValue[0][0] + 3;
+    scheduler.onAlarm();
+  });
+}
+
+// A response body that takes what fits, as a stream runs out of memory
+struct TraceStream {
+  char data[4096];
+  size_t size;
+  size_t used;
+};
+
+static size_t traceSink(const char *text, size_t length, void *arg)
+{
+  TraceStream *stream = (TraceStream *)arg;
+  size_t taken = length < stream->size - stream->used ? length : stream->size - stream->used;
+  memcpy(stream->data + stream->used, text, taken);
+  stream->used += taken;
+  return taken;
+}
+
+void benchStepTrace()
+{
+  StepScheduler scheduler(TIMER_GROUP_0, TIMER_0);
+  StepTrace trace;
+  StepperTimer *steppers[TRACE_BENCH_AXES];
+  hostShimReset();
+  scheduler.begin();
+  scheduler.setTrace(&trace);
+  for (int i = 0; i < TRACE_BENCH_AXES; i++)
+  {
+    steppers[i] = new StepperTimer(200, TIMER_GROUP_0, TIMER_0, 5, 4, 25, 26);
+    steppers[i]->setScheduler(&scheduler);
+    steppers[i]->setSpeed(150 + i * 7);
+  }
+
+  reportTime("4 axes interrupt, trace off", interruptCost(scheduler));
+  trace.enabled = true;
+  reportTime("4 axes interrupt, trace on", interruptCost(scheduler));
+
+  static char buffer[4096];
+  MetricsWriter writer(buffer, sizeof(buffer));
+  double ns = nsPerCall(100, [&]() {
+    writer = MetricsWriter(buffer, sizeof(buffer));
+    trace.writeMetrics(writer, TIMER_SCALE, 240);
+  });
+  reportTime("writeMetrics", ns);
+  reportCount("metrics length", writer.length(), writer.overflowed() ? "bytes (overflowed)" : "bytes");
+
+  // streamed a line at a time it reads the same, and a stream running out
+  // is flagged for the scrape to be thrown away
+  static TraceStream stream;
+  stream.size = sizeof(stream.data);
+  stream.used = 0;
+  MetricsWriter streamed(traceSink, &stream);
+  trace.writeMetrics(streamed, TIMER_SCALE, 240);
+  bool same = stream.used == writer.length() && memcmp(stream.data, buffer, stream.used) == 0;
+  printf("  %-44s %10s\n", "streamed", same ? "identical" : "DIFFERENT");
+  stream.size = writer.length() / 2;
+  stream.used = 0;
+  MetricsWriter cut(traceSink, &stream);
+  trace.writeMetrics(cut, TIMER_SCALE, 240);
+  printf("  %-44s %10lu of %lu bytes, %s\n", "streamed out of memory", (unsigned long)cut.length(),
+    (unsigned long)writer.length(), cut.overflowed() ? "overflowed" : "NOT FLAGGED");
+
+  // first lines of the scrape
+  char *end = buffer;
+  for (int lines = 0; lines < 12 && end != NULL; lines++)
+    end = strchr(end + 1, '\n');
+  if (end != NULL)
+    *end = 0;
+  printf("%s\n", buffer);
+
+  // a reset waits for the interrupt to clear up, reading empty until then
+  StepTraceRecord records[STEP_TRACE_RING];
+  trace.reset();
+  int waiting = trace.copyRing(0, records);
+  for (int i = 0; i < 10; i++)
+  {
+    hostShim.counterValue[0][0] = hostShim.alarmValue[0][0] + 3;
+    scheduler.onAlarm();
+  }
+  unsigned long steps = trace.steps[0];
+  int kept = trace.copyRing(0, records);
+  bool cleared = waiting == 0 && steps > 0 && steps < 100 && kept == (int)steps;
+  printf("  %-44s %10s %lu steps since\n", "reset by the interrupt", cleared ? "cleared" : "FAIL", steps);
+  if (!cleared)
+    benchFailures++;
+
+  for (int i = 0; i < TRACE_BENCH_AXES; i++)
+    delete steppers[i];
+}
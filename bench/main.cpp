@@ -0,0 +1,79 @@
+/*
+ * Native benchmark runner - see bench.h
+ */
+
+#include "bench.h"
+#include "host_shim.h"
+#include <string.h>
+
+int benchFailures = 0;
+
+int main(int argc, char **argv)
+{
+  if (argc == 3 && strcmp(argv[1], "replay") == 0)
+    return replaySession(argv[2]);
+
+  hostShimReset();
+
+  printf("StepperTimer\n");
+  benchStepperTimer();
+
+  printf("StepScheduler\n");
+  benchStepScheduler();
+
+  printf("StepperGroup\n");
+  benchStepperGroup();
+
+  printf("MotorChannel\n");
+  benchMotorChannel();
+
+  printf("StepDirStepper\n");
+  benchStepDirStepper();
+
+  printf("SegmentQueue\n");
+  benchSegmentQueue();
+
+  printf("DCMotorController\n");
+  benchDCMotorController();
+
+  printf("MCPWMMotorController\n");
+  benchMCPWMMotorController();
+
+  printf("Speed control\n");
+  benchSpeedControl();
+
+  printf("TelemetryPublisher\n");
+  benchTelemetry();
+
+  printf("ControlProtocol\n");
+  benchControlProtocol();
+
+  printf("ControlLink\n");
+  benchControlLink();
+
+  printf("Mailbox\n");
+  benchMailbox();
+
+  printf("Histogram\n");
+  benchHistogram();
+
+  printf("StepTrace\n");
+  benchStepTrace();
+
+  printf("BinaryLog\n");
+  benchBinaryLog();
+
+  printf("BoardProfile\n");
+  benchBoardProfile();
+
+  printf("Start up\n");
+  benchBootTimeline();
+
+  printf("PowerManager\n");
+  benchPowerManager();
+
+  printf("Session replay\n");
+  benchReplay();
+
+  return benchFailures > 0 ? 1 : 0;
+}
@@ -0,0 +1,566 @@
+/*
+ * Host shim implementation - see host_shim.h
+ */
+
+#include <string.h>
+#include <chrono>
+#include <thread>
+#include "host_shim.h"
+#include "driver/gpio.h"
+#include "driver/timer.h"
+#include "soc/timer_group_struct.h"
+#include "soc/gpio_struct.h"
+#include "soc/gpio_sig_map.h"
+#include "soc/ledc_struct.h"
+#include "rom/gpio.h"
+#include "soc/mcpwm_struct.h"
+#include "driver/mcpwm.h"
+#include "driver/pcnt.h"
+#include "driver/rmt.h"
+#include "esp32-hal-gpio.h"
+#include "esp32-hal-ledc.h"
+#include "esp32-hal-matrix.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "esp_pm.h"
+#include "esp_wifi.h"
+#include "xtensa/core-macros.h"
+
+HostShim hostShim;
+timg_dev_t TIMERG0;
+timg_dev_t TIMERG1;
+gpio_dev_t GPIO;
+ledc_dev_t LEDC;
+mcpwm_dev_t MCPWM0;
+mcpwm_dev_t MCPWM1;
+rmt_dev_t RMT;
+rmt_mem_t RMTMEM;
+static void (*rmtHandler)(void *);
+static void *rmtHandlerArg;
+
+void hostShimReset()
+{
+  memset(&hostShim, 0, sizeof(hostShim));
+  for(int i = 0; i < HOST_SHIM_PINS; i++)
+    hostShim.pinChannel[i] = -1;
+  memset(&LEDC, 0, sizeof(LEDC));
+  memset((void *)&RMT, 0, sizeof(RMT));
+  memset((void *)&RMTMEM, 0, sizeof(RMTMEM));
+  for(int i = 0; i < 8; i++)
+  {
+    hostShim.rmt[i].minHigh = UINT32_MAX;
+    hostShim.rmt[i].minPeriod = UINT32_MAX;
+    hostShim.rmt[i].minReversalGap = UINT32_MAX;
+  }
+  hostShim.pmSupported = true;
+  hostShim.cpuMhz = 240;
+}
+
+int hostShimPinLevel(int pin)
+{
+  return (hostShim.gpioOut >> pin) & 1;
+}
+
+static void setPinLevel(int pin, uint32_t level)
+{
+  if(pin < 0 || pin >= HOST_SHIM_PINS)
+    return;
+  if(level)
+    hostShim.gpioOut |= 1ULL << pin;
+  else
+    hostShim.gpioOut &= ~(1ULL << pin);
+}
+
+unsigned long hostShimOperations()
+{
+  return hostShim.gpioWrites + hostShim.gpioRegisterWrites + hostShim.gpioConfigs + hostShim.timerCalls +
+    hostShim.gpioMatrixRoutes + hostShim.pcntCalls + hostShim.mcpwmCalls + hostShim.mcpwmRegisterWrites + hostShim.ledcWrites + hostShim.ledcAttaches + hostShim.ledcDetaches + hostShim.ledcSetups;
+}
+
+// gpio driver
+esp_err_t gpio_config(const gpio_config_t *pGPIOConfig)
+{
+  hostShim.gpioConfigs++;
+  return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+  hostShim.gpioWrites++;
+  setPinLevel(gpio_num, level);
+  return ESP_OK;
+}
+
+// gpio registers
+template <int firstPin, bool set>
+HostGpioRegister<firstPin, set> &HostGpioRegister<firstPin, set>::operator=(uint32_t mask)
+{
+  hostShim.gpioRegisterWrites++;
+  if(set)
+    hostShim.gpioOut |= (uint64_t)mask << firstPin;
+  else
+    hostShim.gpioOut &= ~((uint64_t)mask << firstPin);
+  return *this;
+}
+
+template struct HostGpioRegister<0, true>;
+template struct HostGpioRegister<0, false>;
+template struct HostGpioRegister<32, true>;
+template struct HostGpioRegister<32, false>;
+
+// ROM gpio matrix
+void gpio_matrix_out(uint32_t gpio, uint32_t signal_idx, bool out_inv, bool oen_inv)
+{
+  hostShim.gpioMatrixRoutes++;
+  if(gpio >= HOST_SHIM_PINS)
+    return;
+  if(signal_idx >= LEDC_HS_SIG_OUT0_IDX && signal_idx < LEDC_LS_SIG_OUT0_IDX + 8)
+    hostShim.pinChannel[gpio] = signal_idx - LEDC_HS_SIG_OUT0_IDX;
+  else
+    hostShim.pinChannel[gpio] = -1;
+}
+
+void pinMatrixOutDetach(uint8_t pin, bool invertOut, bool invertEnable)
+{
+  gpio_matrix_out(pin, SIG_GPIO_OUT_IDX, invertOut, invertEnable);
+}
+
+// mcpwm driver and registers
+esp_err_t mcpwm_gpio_init(mcpwm_unit_t mcpwm_num, mcpwm_io_signals_t io_signal, int gpio_num)
+{
+  hostShim.mcpwmCalls++;
+  return ESP_OK;
+}
+
+esp_err_t mcpwm_init(mcpwm_unit_t mcpwm_num, mcpwm_timer_t timer_num, const mcpwm_config_t *mcpwm_conf)
+{
+  hostShim.mcpwmCalls++;
+  return ESP_OK;
+}
+
+esp_err_t mcpwm_set_duty_type(mcpwm_unit_t mcpwm_num, mcpwm_timer_t timer_num, mcpwm_operator_t op_num,
+                              mcpwm_duty_type_t duty_num)
+{
+  hostShim.mcpwmCalls++;
+  return ESP_OK;
+}
+
+HostMcpwmRegister &HostMcpwmRegister::operator=(uint32_t v)
+{
+  hostShim.mcpwmRegisterWrites++;
+  this->value = v;
+  return *this;
+}
+
+// pcnt driver
+esp_err_t pcnt_unit_config(const pcnt_config_t *pcnt_config)
+{
+  hostShim.pcntCalls++;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_set_filter_value(pcnt_unit_t unit, uint16_t filter_val)
+{
+  hostShim.pcntCalls++;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_filter_enable(pcnt_unit_t unit)
+{
+  hostShim.pcntCalls++;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_counter_pause(pcnt_unit_t pcnt_unit)
+{
+  hostShim.pcntCalls++;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_counter_resume(pcnt_unit_t pcnt_unit)
+{
+  hostShim.pcntCalls++;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_counter_clear(pcnt_unit_t pcnt_unit)
+{
+  hostShim.pcntCalls++;
+  hostShim.pcntCounter[pcnt_unit] = 0;
+  return ESP_OK;
+}
+
+esp_err_t pcnt_get_counter_value(pcnt_unit_t pcnt_unit, int16_t *count)
+{
+  hostShim.pcntCalls++;
+  *count = hostShim.pcntCounter[pcnt_unit];
+  return ESP_OK;
+}
+
+// timer driver
+esp_err_t timer_init(timer_group_t group_num, timer_idx_t timer_num, const timer_config_t *config)
+{
+  hostShim.timerCalls++;
+  return ESP_OK;
+}
+
+esp_err_t timer_set_counter_value(timer_group_t group_num, timer_idx_t timer_num, uint64_t load_val)
+{
+  hostShim.timerCalls++;
+  hostShim.counterValue[group_num][timer_num] = load_val;
+  return ESP_OK;
+}
+
+esp_err_t timer_get_counter_value(timer_group_t group_num, timer_idx_t timer_num, uint64_t *timer_val)
+{
+  hostShim.timerCalls++;
+  *timer_val = hostShim.counterValue[group_num][timer_num];
+  return ESP_OK;
+}
+
+esp_err_t timer_set_alarm_value(timer_group_t group_num, timer_idx_t timer_num, uint64_t alarm_value)
+{
+  hostShim.timerCalls++;
+  hostShim.alarmValue[group_num][timer_num] = alarm_value;
+  return ESP_OK;
+}
+
+esp_err_t timer_set_alarm(timer_group_t group_num, timer_idx_t timer_num, timer_alarm_t alarm_en)
+{
+  hostShim.timerCalls++;
+  return ESP_OK;
+}
+
+esp_err_t timer_set_auto_reload(timer_group_t group_num, timer_idx_t timer_num, timer_autoreload_t reload)
+{
+  hostShim.timerCalls++;
+  return ESP_OK;
+}
+
+esp_err_t timer_enable_intr(timer_group_t group_num, timer_idx_t timer_num)
+{
+  hostShim.timerCalls++;
+  return ESP_OK;
+}
+
+esp_err_t timer_disable_intr(timer_group_t group_num, timer_idx_t timer_num)
+{
+  hostShim.timerCalls++;
+  return ESP_OK;
+}
+
+esp_err_t timer_isr_register(timer_group_t group_num, timer_idx_t timer_num, void (*fn)(void *), void *arg,
+                             int intr_alloc_flags, timer_isr_handle_t *handle)
+{
+  hostShim.timerCalls++;
+  hostShim.isrRegistrations++;
+  static int allocated;
+  if (handle != NULL)
+    *handle = &allocated;
+  return ESP_OK;
+}
+
+esp_err_t timer_start(timer_group_t group_num, timer_idx_t timer_num)
+{
+  hostShim.timerCalls++;
+  return ESP_OK;
+}
+
+esp_err_t timer_pause(timer_group_t group_num, timer_idx_t timer_num)
+{
+  hostShim.timerCalls++;
+  return ESP_OK;
+}
+
+// Arduino gpio
+void pinMode(uint8_t pin, uint8_t mode)
+{
+  hostShim.gpioConfigs++;
+}
+
+void digitalWrite(uint8_t pin, uint8_t val)
+{
+  hostShim.gpioWrites++;
+  setPinLevel(pin, val);
+}
+
+// Arduino ledc
+double ledcSetup(uint8_t channel, double freq, uint8_t resolution_bits)
+{
+  hostShim.ledcSetups++;
+  return freq;
+}
+
+void ledcWrite(uint8_t channel, uint32_t duty)
+{
+  hostShim.ledcWrites++;
+  if(channel < 16)
+    hostShim.ledcDuty[channel] = duty;
+}
+
+void ledcAttachPin(uint8_t pin, uint8_t channel)
+{
+  hostShim.ledcAttaches++;
+  if(pin < HOST_SHIM_PINS)
+    hostShim.pinChannel[pin] = channel;
+}
+
+void ledcDetachPin(uint8_t pin)
+{
+  hostShim.ledcDetaches++;
+  if(pin < HOST_SHIM_PINS)
+    hostShim.pinChannel[pin] = -1;
+}
+
+// FreeRTOS
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t pvTaskCode, const char *pcName, uint32_t usStackDepth,
+                                   void *pvParameters, UBaseType_t uxPriority, TaskHandle_t *pvCreatedTask,
+                                   BaseType_t xCoreID)
+{
+  hostShim.tasksCreated++;
+  if(pvCreatedTask)
+    *pvCreatedTask = NULL;
+  return pdPASS;
+}
+
+TickType_t xTaskGetTickCount()
+{
+  return (TickType_t)(esp_timer_get_time() / (1000 * portTICK_PERIOD_MS));
+}
+
+void vTaskDelay(TickType_t xTicksToDelay)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(xTicksToDelay * portTICK_PERIOD_MS));
+}
+
+void vTaskDelayUntil(TickType_t *pxPreviousWakeTime, TickType_t xTimeIncrement)
+{
+  *pxPreviousWakeTime += xTimeIncrement;
+  TickType_t now = xTaskGetTickCount();
+  if((int32_t)(*pxPreviousWakeTime - now) > 0)
+    vTaskDelay(*pxPreviousWakeTime - now);
+}
+
+void vTaskDelete(TaskHandle_t xTaskToDelete)
+{
+}
+
+// esp_timer
+int64_t esp_timer_get_time()
+{
+  static std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+// esp_pm, the CPU runs at the top of the range while any lock is held
+static struct esp_pm_lock { int held; } pmLock;
+
+static void pmClock()
+{
+  if(hostShim.maxMhz != 0)
+    hostShim.cpuMhz = hostShim.pmLocksHeld > 0 ? hostShim.maxMhz : hostShim.minMhz;
+}
+
+esp_err_t esp_pm_configure(const void *config)
+{
+  hostShim.pmCalls++;
+  if(!hostShim.pmSupported)
+    return ESP_ERR_NOT_SUPPORTED;
+  const esp_pm_config_esp32_t *pm = (const esp_pm_config_esp32_t *)config;
+  hostShim.maxMhz = pm->max_freq_mhz;
+  hostShim.minMhz = pm->min_freq_mhz;
+  pmClock();
+  return ESP_OK;
+}
+
+esp_err_t esp_pm_lock_create(esp_pm_lock_type_t lock_type, int arg, const char *name, esp_pm_lock_handle_t *out_handle)
+{
+  hostShim.pmCalls++;
+  if(!hostShim.pmSupported)
+    return ESP_ERR_NOT_SUPPORTED;
+  pmLock.held = 0;
+  *out_handle = &pmLock;
+  return ESP_OK;
+}
+
+esp_err_t esp_pm_lock_acquire(esp_pm_lock_handle_t handle)
+{
+  hostShim.pmCalls++;
+  handle->held++;
+  hostShim.pmLocksHeld++;
+  pmClock();
+  return ESP_OK;
+}
+
+esp_err_t esp_pm_lock_release(esp_pm_lock_handle_t handle)
+{
+  hostShim.pmCalls++;
+  if(handle->held == 0)
+    return ESP_FAIL;
+  handle->held--;
+  hostShim.pmLocksHeld--;
+  pmClock();
+  return ESP_OK;
+}
+
+// esp_wifi
+esp_err_t esp_wifi_set_ps(wifi_ps_type_t type)
+{
+  hostShim.wifiPsCalls++;
+  if(!hostShim.wifiStarted)
+    return ESP_ERR_WIFI_NOT_INIT;
+  hostShim.wifiPs = type;
+  return ESP_OK;
+}
+
+// CCOUNT
+uint32_t hostShimCycles()
+{
+  static std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return (uint32_t)(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count() * 240 / 1000);
+}
+
+// rmt driver
+esp_err_t rmt_config(const rmt_config_t *rmt_param)
+{
+  hostShim.rmtCalls++;
+  RMT.conf_ch[rmt_param->channel].conf0.div_cnt = rmt_param->clk_div;
+  RMT.conf_ch[rmt_param->channel].conf0.mem_size = rmt_param->mem_block_num;
+  RMT.conf_ch[rmt_param->channel].conf1.tx_conti_mode = rmt_param->tx_config.loop_en;
+  return ESP_OK;
+}
+
+esp_err_t rmt_set_tx_thr_intr_en(rmt_channel_t channel, bool en, uint16_t evt_thresh)
+{
+  hostShim.rmtCalls++;
+  RMT.tx_lim_ch[channel].limit = evt_thresh;
+  if(en)
+    RMT.int_ena.val |= 1 << (24 + channel);
+  else
+    RMT.int_ena.val &= ~(1 << (24 + channel));
+  return ESP_OK;
+}
+
+esp_err_t rmt_set_tx_intr_en(rmt_channel_t channel, bool en)
+{
+  hostShim.rmtCalls++;
+  if(en)
+    RMT.int_ena.val |= 1 << (3 * channel);
+  else
+    RMT.int_ena.val &= ~(1 << (3 * channel));
+  return ESP_OK;
+}
+
+esp_err_t rmt_isr_register(void (*fn)(void *), void *arg, int intr_alloc_flags, rmt_isr_handle_t *handle)
+{
+  hostShim.rmtCalls++;
+  rmtHandler = fn;
+  rmtHandlerArg = arg;
+  if(handle != NULL)
+    *handle = (rmt_isr_handle_t)&rmtHandler;
+  return ESP_OK;
+}
+
+static void rmtInterrupt(uint32_t status)
+{
+  status &= RMT.int_ena.val;
+  if(status == 0 || rmtHandler == NULL)
+    return;
+  hostShim.rmtInterrupts++;
+  RMT.int_st.val = status;
+  rmtHandler(rmtHandlerArg);
+  RMT.int_st.val = 0;
+}
+
+// One half of an item at its level, timing the edges
+static void rmtPlay(int channel, int dirPin, uint32_t level, uint32_t duration)
+{
+  HostRmtChannel &tx = hostShim.rmt[channel];
+  if(level && !tx.level)
+  {
+    int direction = hostShimPinLevel(dirPin) ? 1 : -1;
+    if(tx.pulses > 0)
+    {
+      uint32_t period = (uint32_t)(tx.ticks - tx.lastRise);
+      if(period < tx.minPeriod)
+        tx.minPeriod = period;
+      if(period > tx.maxPeriod)
+        tx.maxPeriod = period;
+      if(direction != tx.lastDirection)
+      {
+        tx.reversals++;
+        uint32_t gap = (uint32_t)(tx.ticks - tx.lastFall);
+        if(gap < tx.minReversalGap)
+          tx.minReversalGap = gap;
+      }
+    }
+    tx.pulses++;
+    tx.steps += direction;
+    tx.lastDirection = direction;
+    tx.lastRise = tx.ticks;
+  }
+  else if(!level && tx.level)
+  {
+    uint32_t high = (uint32_t)(tx.ticks - tx.lastRise);
+    if(high < tx.minHigh)
+      tx.minHigh = high;
+    tx.lastFall = tx.ticks;
+  }
+  tx.level = level;
+  tx.ticks += duration;
+}
+
+// Reads the item at the read pointer as the transmitter moves onto it
+static void rmtLatch(int channel)
+{
+  HostRmtChannel &tx = hostShim.rmt[channel];
+  tx.current = RMTMEM.chan[channel].data32[tx.position].val;
+  RMT.status_ch[channel].mem_raddr_ex = channel * 64 + tx.position;
+}
+
+unsigned long hostShimRmtTransmit(int channel, int dirPin, unsigned long maxItems)
+{
+  HostRmtChannel &tx = hostShim.rmt[channel];
+  unsigned long sent = 0;
+  while(sent < maxItems)
+  {
+    if(!tx.running)
+    {
+      // every start resets the read pointer
+      if(!RMT.conf_ch[channel].conf1.tx_start)
+        break;
+      tx.running = true;
+      tx.position = 0;
+      tx.sinceThreshold = 0;
+      rmtLatch(channel);
+    }
+    // the item being sent was read when it was reached, a write over it
+    // since only shows the next time round
+    rmt_item32_t item;
+    item.val = tx.current;
+    bool end = item.duration0 == 0 || item.duration1 == 0;
+    if(item.duration0 != 0)
+      rmtPlay(channel, dirPin, item.level0, item.duration0);
+    if(item.duration0 != 0 && item.duration1 != 0)
+      rmtPlay(channel, dirPin, item.level1, item.duration1);
+    sent++;
+    if(end)
+    {
+      // idles low, the driver restarts it from the interrupt or not at all
+      rmtPlay(channel, dirPin, 0, 0);
+      tx.running = false;
+      rmtInterrupt(1 << (3 * channel));
+      if(!RMT.conf_ch[channel].conf1.tx_start)
+        break;
+      continue;
+    }
+    tx.position = (tx.position + 1) % 64;
+    rmtLatch(channel);
+    if(++tx.sinceThreshold == (int)RMT.tx_lim_ch[channel].limit)
+    {
+      tx.sinceThreshold = 0;
+      rmtInterrupt(1 << (24 + channel));
+    }
+  }
+  return sent;
+}
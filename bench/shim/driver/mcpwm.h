@@ -0,0 +1,27 @@
+#ifndef mcpwm_h
+#define mcpwm_h
+
+#include "esp_types.h"
+#include "esp_err.h"
+
+typedef enum { MCPWM_UNIT_0 = 0, MCPWM_UNIT_1, MCPWM_UNIT_MAX } mcpwm_unit_t;
+typedef enum { MCPWM_TIMER_0 = 0, MCPWM_TIMER_1, MCPWM_TIMER_2, MCPWM_TIMER_MAX } mcpwm_timer_t;
+typedef enum { MCPWM_OPR_A = 0, MCPWM_OPR_B, MCPWM_OPR_MAX } mcpwm_operator_t;
+typedef enum { MCPWM0A = 0, MCPWM0B, MCPWM1A, MCPWM1B, MCPWM2A, MCPWM2B } mcpwm_io_signals_t;
+typedef enum { MCPWM_DUTY_MODE_0 = 0, MCPWM_DUTY_MODE_1, MCPWM_DUTY_MODE_MAX } mcpwm_duty_type_t;
+typedef enum { MCPWM_UP_COUNTER = 1, MCPWM_DOWN_COUNTER, MCPWM_UP_DOWN_COUNTER } mcpwm_counter_type_t;
+
+typedef struct {
+  uint32_t frequency;
+  float cmpr_a;
+  float cmpr_b;
+  mcpwm_duty_type_t duty_mode;
+  mcpwm_counter_type_t counter_mode;
+} mcpwm_config_t;
+
+esp_err_t mcpwm_gpio_init(mcpwm_unit_t mcpwm_num, mcpwm_io_signals_t io_signal, int gpio_num);
+esp_err_t mcpwm_init(mcpwm_unit_t mcpwm_num, mcpwm_timer_t timer_num, const mcpwm_config_t *mcpwm_conf);
+esp_err_t mcpwm_set_duty_type(mcpwm_unit_t mcpwm_num, mcpwm_timer_t timer_num, mcpwm_operator_t op_num,
+                              mcpwm_duty_type_t duty_num);
+
+#endif
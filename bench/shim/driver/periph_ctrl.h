@@ -0,0 +1,4 @@
+#ifndef periph_ctrl_h
+#define periph_ctrl_h
+
+#endif
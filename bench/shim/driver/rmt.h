@@ -0,0 +1,42 @@
+#ifndef rmt_h
+#define rmt_h
+
+#include "esp_types.h"
+#include "esp_err.h"
+#include "esp_intr_alloc.h"
+#include "driver/gpio.h"
+#include "soc/rmt_struct.h"
+
+typedef enum { RMT_CHANNEL_0 = 0, RMT_CHANNEL_1, RMT_CHANNEL_2, RMT_CHANNEL_3, RMT_CHANNEL_4, RMT_CHANNEL_5,
+               RMT_CHANNEL_6, RMT_CHANNEL_7, RMT_CHANNEL_MAX } rmt_channel_t;
+typedef enum { RMT_MODE_TX = 0, RMT_MODE_RX, RMT_MODE_MAX } rmt_mode_t;
+typedef enum { RMT_IDLE_LEVEL_LOW = 0, RMT_IDLE_LEVEL_HIGH, RMT_IDLE_LEVEL_MAX } rmt_idle_level_t;
+typedef enum { RMT_CARRIER_LEVEL_LOW = 0, RMT_CARRIER_LEVEL_HIGH, RMT_CARRIER_LEVEL_MAX } rmt_carrier_level_t;
+
+typedef struct {
+  bool loop_en;
+  uint32_t carrier_freq_hz;
+  uint8_t carrier_duty_percent;
+  rmt_carrier_level_t carrier_level;
+  bool carrier_en;
+  rmt_idle_level_t idle_level;
+  bool idle_output_en;
+} rmt_tx_config_t;
+
+typedef struct {
+  rmt_mode_t rmt_mode;
+  rmt_channel_t channel;
+  uint8_t clk_div;
+  gpio_num_t gpio_num;
+  uint8_t mem_block_num;
+  rmt_tx_config_t tx_config;
+} rmt_config_t;
+
+typedef void *rmt_isr_handle_t;
+
+esp_err_t rmt_config(const rmt_config_t *rmt_param);
+esp_err_t rmt_set_tx_thr_intr_en(rmt_channel_t channel, bool en, uint16_t evt_thresh);
+esp_err_t rmt_set_tx_intr_en(rmt_channel_t channel, bool en);
+esp_err_t rmt_isr_register(void (*fn)(void *), void *arg, int intr_alloc_flags, rmt_isr_handle_t *handle);
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef timer_h
+#define timer_h
+
+#include "esp_types.h"
+#include "esp_err.h"
+#include "esp_intr_alloc.h"
+
+#define TIMER_BASE_CLK 80000000
+
+typedef enum { TIMER_GROUP_0 = 0, TIMER_GROUP_1 = 1, TIMER_GROUP_MAX } timer_group_t;
+typedef enum { TIMER_0 = 0, TIMER_1 = 1, TIMER_MAX } timer_idx_t;
+typedef enum { TIMER_COUNT_DOWN = 0, TIMER_COUNT_UP = 1 } timer_count_dir_t;
+typedef enum { TIMER_PAUSE = 0, TIMER_START = 1 } timer_start_t;
+typedef enum { TIMER_ALARM_DIS = 0, TIMER_ALARM_EN = 1 } timer_alarm_t;
+typedef enum { TIMER_INTR_LEVEL = 0 } timer_intr_mode_t;
+typedef enum { TIMER_AUTORELOAD_DIS = 0, TIMER_AUTORELOAD_EN = 1 } timer_autoreload_t;
+
+typedef struct {
+  bool alarm_en;
+  bool counter_en;
+  timer_intr_mode_t intr_type;
+  timer_count_dir_t counter_dir;
+  bool auto_reload;
+  uint32_t divider;
+} timer_config_t;
+
+typedef void *timer_isr_handle_t;
+
+esp_err_t timer_init(timer_group_t group_num, timer_idx_t timer_num, const timer_config_t *config);
+esp_err_t timer_set_counter_value(timer_group_t group_num, timer_idx_t timer_num, uint64_t load_val);
+esp_err_t timer_get_counter_value(timer_group_t group_num, timer_idx_t timer_num, uint64_t *timer_val);
+esp_err_t timer_set_alarm_value(timer_group_t group_num, timer_idx_t timer_num, uint64_t alarm_value);
+esp_err_t timer_set_alarm(timer_group_t group_num, timer_idx_t timer_num, timer_alarm_t alarm_en);
+esp_err_t timer_set_auto_reload(timer_group_t group_num, timer_idx_t timer_num, timer_autoreload_t reload);
+esp_err_t timer_enable_intr(timer_group_t group_num, timer_idx_t timer_num);
+esp_err_t timer_disable_intr(timer_group_t group_num, timer_idx_t timer_num);
+esp_err_t timer_isr_register(timer_group_t group_num, timer_idx_t timer_num, void (*fn)(void *), void *arg,
+                             int intr_alloc_flags, timer_isr_handle_t *handle);
+esp_err_t timer_start(timer_group_t group_num, timer_idx_t timer_num);
+esp_err_t timer_pause(timer_group_t group_num, timer_idx_t timer_num);
+
+#endif
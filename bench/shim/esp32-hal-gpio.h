@@ -0,0 +1,14 @@
+#ifndef esp32_hal_gpio_h
+#define esp32_hal_gpio_h
+
+#include <stdint.h>
+
+#define LOW     0x0
+#define HIGH    0x1
+#define INPUT   0x01
+#define OUTPUT  0x02
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+
+#endif
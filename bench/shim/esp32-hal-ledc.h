@@ -0,0 +1,11 @@
+#ifndef esp32_hal_ledc_h
+#define esp32_hal_ledc_h
+
+#include <stdint.h>
+
+double ledcSetup(uint8_t channel, double freq, uint8_t resolution_bits);
+void ledcWrite(uint8_t channel, uint32_t duty);
+void ledcAttachPin(uint8_t pin, uint8_t channel);
+void ledcDetachPin(uint8_t pin);
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef esp32_hal_matrix_h
+#define esp32_hal_matrix_h
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void pinMatrixOutDetach(uint8_t pin, bool invertOut, bool invertEnable);
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef esp_attr_h
+#define esp_attr_h
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+
+#endif
@@ -0,0 +1,10 @@
+#ifndef esp_err_h
+#define esp_err_h
+
+typedef int esp_err_t;
+
+#define ESP_OK    0
+#define ESP_FAIL  -1
+#define ESP_ERR_NOT_SUPPORTED  0x106
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef esp_intr_alloc_h
+#define esp_intr_alloc_h
+
+#define ESP_INTR_FLAG_IRAM (1 << 10)
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef esp_timer_h
+#define esp_timer_h
+
+#include <stdint.h>
+
+// Microseconds since the host program started
+int64_t esp_timer_get_time();
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef esp_types_h
+#define esp_types_h
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#endif
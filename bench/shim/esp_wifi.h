@@ -0,0 +1,12 @@
+#ifndef esp_wifi_h
+#define esp_wifi_h
+
+#include "esp_err.h"
+
+#define ESP_ERR_WIFI_NOT_INIT  0x3001
+
+typedef enum { WIFI_PS_NONE, WIFI_PS_MIN_MODEM, WIFI_PS_MAX_MODEM } wifi_ps_type_t;
+
+esp_err_t esp_wifi_set_ps(wifi_ps_type_t type);
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef FreeRTOS_h
+#define FreeRTOS_h
+
+#include <stdint.h>
+
+// The host build is single threaded, critical sections compile away
+typedef struct {
+  uint32_t owner;
+  uint32_t count;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED { 0, 0 }
+
+#define portENTER_CRITICAL(mux)       ((void)(mux))
+#define portEXIT_CRITICAL(mux)        ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux)   ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux)    ((void)(mux))
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdFALSE               0
+#define pdTRUE                1
+#define pdPASS                1
+#define configTICK_RATE_HZ    1000
+#define portTICK_PERIOD_MS    (1000 / configTICK_RATE_HZ)
+#define configMAX_PRIORITIES  25
+#define tskNO_AFFINITY        0x7FFFFFFF
+
+#endif
@@ -0,0 +1,110 @@
+/*
+ * Host shim - recording stand-ins for the ESP32 IDF / Arduino calls used by
+ * the motor libraries, so they can be built and benchmarked natively.
+ *
+ * Every stand-in bumps a counter in hostShim and keeps the last value it was
+ * given, which lets the benchmarks report how many hardware operations a call
+ * would have issued on the real chip.
+ */
+
+#ifndef host_shim_h
+#define host_shim_h
+
+#include <stdint.h>
+
+#define HOST_SHIM_PINS 40
+
+// One RMT transmitter as played by hostShimRmtTransmit()
+struct HostRmtChannel {
+  bool running;
+  int position;             // item being sent, as in the status register
+  uint32_t current;         // and its value, latched when it was reached
+  int sinceThreshold;       // items sent since the last threshold event
+  int level;
+  uint64_t ticks;           // time played, RMT clock ticks
+  uint64_t lastRise;
+  uint64_t lastFall;
+  int lastDirection;
+  long steps;               // rising edges, signed by the direction pin
+  unsigned long pulses;
+  unsigned long reversals;
+  uint32_t minHigh;
+  uint32_t minPeriod;       // between rising edges
+  uint32_t maxPeriod;
+  uint32_t minReversalGap;  // falling edge to the first rise the other way
+};
+
+struct HostShim {
+  // gpio_set_level / digitalWrite
+  unsigned long gpioWrites;
+  // GPIO.out_w1ts / out_w1tc and the GPIO32-39 equivalents
+  unsigned long gpioRegisterWrites;
+  unsigned long gpioConfigs;
+  uint64_t gpioOut;  // output level of each pin, bit n is GPIOn
+
+  // timer_* driver calls
+  unsigned long timerCalls;
+  uint64_t alarmValue[2][2];
+  uint64_t counterValue[2][2];  // what timer_get_counter_value reports
+  unsigned long isrRegistrations;
+
+  // ledc* calls
+  unsigned long ledcWrites;
+  unsigned long ledcAttaches;
+  unsigned long ledcDetaches;
+  unsigned long ledcSetups;
+  int pinChannel[HOST_SHIM_PINS];
+  uint32_t ledcDuty[16];
+  // gpio_matrix_out / pinMatrixOutDetach
+  unsigned long gpioMatrixRoutes;
+
+  // mcpwm_* driver calls and MCPWM register writes
+  unsigned long mcpwmCalls;
+  unsigned long mcpwmRegisterWrites;
+
+  // pcnt_* driver calls, pcntCounter is what pcnt_get_counter_value reports
+  unsigned long pcntCalls;
+  int16_t pcntCounter[8];
+
+  // FreeRTOS tasks
+  unsigned long tasksCreated;
+
+  // rmt_* driver calls, and what hostShimRmtTransmit() played on each channel
+  unsigned long rmtCalls;
+  unsigned long rmtInterrupts;
+  HostRmtChannel rmt[8];
+
+  // esp_pm: the clock range configured, and the CPU clock the locks held
+  // leave it at. pmSupported false has esp_pm_configure() refuse, as a
+  // build without power management does.
+  bool pmSupported;
+  unsigned long pmCalls;
+  int pmLocksHeld;
+  int cpuMhz;
+  int maxMhz;
+  int minMhz;
+
+  // esp_wifi_set_ps, refused until wifiStarted
+  bool wifiStarted;
+  unsigned long wifiPsCalls;
+  int wifiPs;
+};
+
+extern HostShim hostShim;
+
+// Clears all counters and recorded state
+void hostShimReset();
+
+// Output level last written to a pin
+int hostShimPinLevel(int pin);
+
+// Total number of hardware operations recorded since the last reset
+unsigned long hostShimOperations();
+
+// Plays up to maxItems of an RMT channel's memory the way the transmitter
+// would in wrap mode, raising the threshold and end interrupts through the
+// handler given to rmt_isr_register(). Steps are signed by dirPin.
+// Returns the items played.
+unsigned long hostShimRmtTransmit(int channel, int dirPin, unsigned long maxItems);
+
+#endif
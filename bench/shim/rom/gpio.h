@@ -0,0 +1,14 @@
+#ifndef rom_gpio_h
+#define rom_gpio_h
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Stand-in for the ROM GPIO matrix routing. Counted in
+ * hostShim.gpioMatrixRoutes, an LEDC signal is recorded in
+ * hostShim.pinChannel as its channel and anything else as -1.
+ */
+void gpio_matrix_out(uint32_t gpio, uint32_t signal_idx, bool out_inv, bool oen_inv);
+
+#endif
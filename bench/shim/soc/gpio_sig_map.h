@@ -0,0 +1,9 @@
+#ifndef gpio_sig_map_h
+#define gpio_sig_map_h
+
+// GPIO matrix output signals used by the motor libraries
+#define LEDC_HS_SIG_OUT0_IDX  71
+#define LEDC_LS_SIG_OUT0_IDX  79
+#define SIG_GPIO_OUT_IDX      256
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef gpio_struct_h
+#define gpio_struct_h
+
+#include <stdint.h>
+
+/*
+ * Stand-in for the GPIO output registers. Each write is counted in
+ * hostShim.gpioRegisterWrites and applied to hostShim.gpioOut.
+ */
+template <int firstPin, bool set>
+struct HostGpioRegister {
+  HostGpioRegister &operator=(uint32_t mask);
+};
+
+typedef struct {
+  HostGpioRegister<0, true> out_w1ts;
+  HostGpioRegister<0, false> out_w1tc;
+  struct {
+    HostGpioRegister<32, true> val;
+  } out1_w1ts;
+  struct {
+    HostGpioRegister<32, false> val;
+  } out1_w1tc;
+} gpio_dev_t;
+
+extern gpio_dev_t GPIO;
+
+#endif
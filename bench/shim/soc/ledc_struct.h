@@ -0,0 +1,49 @@
+#ifndef ledc_struct_h
+#define ledc_struct_h
+
+#include <stdint.h>
+
+/*
+ * Stand-in for the LEDC channel registers, laid out like the real ones for
+ * the fields the motor libraries touch. Plain memory, so the last duty
+ * written to each channel can be read back.
+ */
+typedef struct {
+  union {
+    struct {
+      uint32_t timer_sel: 2;
+      uint32_t sig_out_en: 1;
+      uint32_t idle_lv: 1;
+      uint32_t reserved4: 27;
+      uint32_t clk_en: 1;
+    };
+    uint32_t val;
+  } conf0;
+  union {
+    struct {
+      uint32_t duty: 25;
+      uint32_t reserved25: 7;
+    };
+    uint32_t val;
+  } duty;
+  union {
+    struct {
+      uint32_t duty_scale: 10;
+      uint32_t duty_cycle: 10;
+      uint32_t duty_num: 10;
+      uint32_t duty_inc: 1;
+      uint32_t duty_start: 1;
+    };
+    uint32_t val;
+  } conf1;
+} host_ledc_channel_t;
+
+typedef struct {
+  struct {
+    host_ledc_channel_t channel[8];
+  } channel_group[2];
+} ledc_dev_t;
+
+extern ledc_dev_t LEDC;
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef mcpwm_struct_h
+#define mcpwm_struct_h
+
+#include <stdint.h>
+
+/*
+ * Stand-in for the MCPWM registers the motor libraries touch. Each write is
+ * counted in hostShim.mcpwmRegisterWrites and the value kept for reading
+ * back.
+ */
+struct HostMcpwmRegister {
+  uint32_t value;
+  HostMcpwmRegister &operator=(uint32_t v);
+  operator uint32_t() const { return this->value; }
+};
+
+typedef struct {
+  struct {
+    HostMcpwmRegister prescale;
+  } clk_cfg;
+  struct {
+    struct {
+      HostMcpwmRegister prescale;
+      HostMcpwmRegister period;
+    } period;
+  } timer[3];
+  struct {
+    struct {
+      HostMcpwmRegister cmpr_val;
+    } cmpr_value[2];
+  } channel[3];
+} mcpwm_dev_t;
+
+extern mcpwm_dev_t MCPWM0;
+extern mcpwm_dev_t MCPWM1;
+
+#endif
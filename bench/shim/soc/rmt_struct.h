@@ -0,0 +1,95 @@
+#ifndef rmt_struct_h
+#define rmt_struct_h
+
+#include <stdint.h>
+
+/*
+ * Stand-in for the RMT registers and channel memory, the fields the motor
+ * libraries touch. Plain memory, hostShimRmtTransmit() plays it back.
+ */
+typedef struct {
+  union {
+    struct {
+      uint32_t duration0: 15;
+      uint32_t level0: 1;
+      uint32_t duration1: 15;
+      uint32_t level1: 1;
+    };
+    uint32_t val;
+  };
+} rmt_item32_t;
+
+typedef volatile struct rmt_dev_s {
+  struct {
+    union {
+      struct {
+        uint32_t div_cnt: 8;
+        uint32_t idle_thres: 16;
+        uint32_t mem_size: 4;
+        uint32_t carrier_en: 1;
+        uint32_t carrier_out_lv: 1;
+        uint32_t mem_pd: 1;
+        uint32_t clk_en: 1;
+      };
+      uint32_t val;
+    } conf0;
+    union {
+      struct {
+        uint32_t tx_start: 1;
+        uint32_t rx_en: 1;
+        uint32_t mem_wr_rst: 1;
+        uint32_t mem_rd_rst: 1;
+        uint32_t apb_mem_rst: 1;
+        uint32_t mem_owner: 1;
+        uint32_t tx_conti_mode: 1;
+        uint32_t rx_filter_en: 1;
+        uint32_t rx_filter_thres: 8;
+        uint32_t ref_cnt_rst: 1;
+        uint32_t ref_always_on: 1;
+        uint32_t idle_out_lv: 1;
+        uint32_t idle_out_en: 1;
+        uint32_t reserved20: 12;
+      };
+      uint32_t val;
+    } conf1;
+  } conf_ch[8];
+  union {
+    struct {
+      uint32_t mem_waddr_ex: 10;
+      uint32_t reserved10: 1;
+      uint32_t mem_raddr_ex: 10;  // channel memory address of the item being sent
+      uint32_t reserved21: 11;
+    };
+    uint32_t val;
+  } status_ch[8];
+  union { uint32_t val; } int_raw;
+  union { uint32_t val; } int_st;
+  union { uint32_t val; } int_ena;
+  union { uint32_t val; } int_clr;
+  union {
+    struct {
+      uint32_t limit: 9;
+      uint32_t reserved9: 23;
+    };
+    uint32_t val;
+  } tx_lim_ch[8];
+  union {
+    struct {
+      uint32_t fifo_mask: 1;
+      uint32_t mem_tx_wrap_en: 1;
+      uint32_t reserved2: 30;
+    };
+    uint32_t val;
+  } apb_conf;
+} rmt_dev_t;
+
+typedef volatile struct rmt_mem_s {
+  struct {
+    rmt_item32_t data32[64];
+  } chan[8];
+} rmt_mem_t;
+
+extern rmt_dev_t RMT;
+extern rmt_mem_t RMTMEM;
+
+#endif
@@ -0,0 +1,16 @@
+#ifndef timer_group_struct_h
+#define timer_group_struct_h
+
+#include <stdint.h>
+
+typedef struct {
+  struct {
+    uint32_t t0;
+    uint32_t t1;
+  } int_clr_timers;
+} timg_dev_t;
+
+extern timg_dev_t TIMERG0;
+extern timg_dev_t TIMERG1;
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef core_macros_h
+#define core_macros_h
+
+#include <stdint.h>
+
+// CCOUNT stand-in, a 240MHz cycle counter derived from the host clock
+uint32_t hostShimCycles();
+
+#define XTHAL_GET_CCOUNT() hostShimCycles()
+
+#endif
@@ -0,0 +1,150 @@
+/*
+ * BinaryLog - asynchronous binary logging, see BinaryLog.h
+ *
+ * The ring is a bounded multi-producer queue: every slot carries a sequence
+ * number that says whose turn it is. A producer claims a slot by advancing
+ * head with compare-and-swap when the slot's sequence equals head, fills
+ * it, then publishes it by storing head + 1 into the sequence. The consumer
+ * reads a slot once its sequence is tail + 1 and frees it for the next lap
+ * by storing tail + BINARY_LOG_RECORDS.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "BinaryLog.h"
+#include "esp_timer.h"
+
+#define BINARY_LOG_STACK 3072
+
+BinaryLog binaryLog;
+
+static const char *categoryNames[BLOG_CATEGORIES] = { "sys", "net", "ctl", "mot" };
+static const char levelNames[] = "-EWID";
+
+BinaryLog::BinaryLog()
+{
+  for (int i = 0; i < BINARY_LOG_RECORDS; i++)
+    this->ring[i].sequence = i;
+  for (int i = 0; i < BLOG_CATEGORIES; i++)
+  {
+    this->levels[i] = BLOG_INFO;
+    this->dropped[i] = 0;
+  }
+  this->head = 0;
+  this->tail = 0;
+  this->written = 0;
+  this->reportedDrops = 0;
+  this->drainMs = 20;
+  this->sink = NULL;
+  this->sinkArg = NULL;
+  this->handle = NULL;
+}
+
+bool BinaryLog::begin(BinaryLogSink sink, void *arg, int core, int priority)
+{
+  this->sink = sink;
+  this->sinkArg = arg;
+  return xTaskCreatePinnedToCore(task, "log", BINARY_LOG_STACK, this, priority, &this->handle, core) == pdPASS;
+}
+
+bool IRAM_ATTR BinaryLog::write(int category, int level, const char *format, int32_t a, int32_t b, int32_t c, int32_t d)
+{
+  if (level > this->levels[category])
+    return false;
+
+  BinaryLogRecord *record;
+  uint32_t position = __atomic_load_n(&this->head, __ATOMIC_RELAXED);
+  for (;;)
+  {
+    record = &this->ring[position & (BINARY_LOG_RECORDS - 1)];
+    int32_t lap = (int32_t)(__atomic_load_n(&record->sequence, __ATOMIC_ACQUIRE) - position);
+    if (lap == 0)
+    {
+      // our turn - claim it, or go again with the head another producer moved
+      if (__atomic_compare_exchange_n(&this->head, &position, position + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        break;
+    }
+    else if (lap < 0)
+    {
+      // the consumer hasn't freed this slot yet, the ring is full
+      this->dropped[category]++;
+      return false;
+    }
+    else
+    {
+      position = __atomic_load_n(&this->head, __ATOMIC_RELAXED);
+    }
+  }
+
+  record->timestamp = (uint32_t)esp_timer_get_time();
+  record->format = format;
+  record->category = category;
+  record->level = level;
+  record->args[0] = a;
+  record->args[1] = b;
+  record->args[2] = c;
+  record->args[3] = d;
+  __atomic_store_n(&record->sequence, position + 1, __ATOMIC_RELEASE);
+  this->written++;
+  return true;
+}
+
+bool BinaryLog::read(BinaryLogRecord &record)
+{
+  BinaryLogRecord &slot = this->ring[this->tail & (BINARY_LOG_RECORDS - 1)];
+  if (__atomic_load_n(&slot.sequence, __ATOMIC_ACQUIRE) != this->tail + 1)
+    return false;
+  record = slot;
+  __atomic_store_n(&slot.sequence, this->tail + BINARY_LOG_RECORDS, __ATOMIC_RELEASE);
+  this->tail++;
+  return true;
+}
+
+int BinaryLog::format(const BinaryLogRecord &record, char *text, size_t size)
+{
+  int length = snprintf(text, size, "%10u %s %c: ", (unsigned)record.timestamp,
+    record.category < BLOG_CATEGORIES ? categoryNames[record.category] : "?",
+    levelNames[record.level <= BLOG_DEBUG ? record.level : 0]);
+  if (length < 0 || (size_t)length >= size)
+    return length;
+  // extra arguments are ignored by printf
+  int message = snprintf(text + length, size - length, record.format,
+    record.args[0], record.args[1], record.args[2], record.args[3]);
+  return message < 0 ? message : length + message;
+}
+
+int BinaryLog::drain()
+{
+  char text[BINARY_LOG_LINE];
+  BinaryLogRecord record;
+  int count = 0;
+
+  unsigned long drops = 0;
+  for (int i = 0; i < BLOG_CATEGORIES; i++)
+    drops += this->dropped[i];
+  if (drops != this->reportedDrops)
+  {
+    // reported through the ring itself, so it lands in order
+    if (write(BLOG_SYSTEM, BLOG_WARN, "log: %u records dropped", (int32_t)(drops - this->reportedDrops)))
+      this->reportedDrops = drops;
+  }
+
+  while (read(record))
+  {
+    format(record, text, sizeof(text));
+    if (this->sink != NULL)
+      this->sink(record, text, this->sinkArg);
+    count++;
+  }
+  return count;
+}
+
+void BinaryLog::task(void *arg)
+{
+  BinaryLog *log = (BinaryLog *)arg;
+  for (;;)
+  {
+    log->drain();
+    vTaskDelay(log->drainMs / portTICK_PERIOD_MS);
+  }
+}
@@ -0,0 +1,108 @@
+/*
+ * BinaryLog - asynchronous binary logging
+ *
+ * The call site stores a fixed size record - timestamp, category, level, a
+ * pointer to the (constant) format string and up to four 32-bit arguments -
+ * in a lock-free ring and returns. No formatting and no UART on the caller's
+ * time: a low priority task drains the ring, formats each record with
+ * snprintf and hands it to a sink (Serial, a websocket, ...).
+ *
+ * Any number of tasks (and interrupts) can log at once. When the ring is
+ * full the record is dropped and counted instead of waiting, and the drain
+ * task reports how many were lost.
+ *
+ *   BLOG(BLOG_NET, BLOG_INFO, "client %u connected", client->id());
+ *
+ * Formats must be string literals and only take 32-bit integer arguments
+ * (%d %u %x %c), the string itself is read when the record is formatted.
+ */
+
+#ifndef BinaryLog_h
+#define BinaryLog_h
+
+#include <stddef.h>
+#include "esp_attr.h"
+#include "esp_types.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define BINARY_LOG_RECORDS  128     // power of two
+#define BINARY_LOG_ARGS     4
+#define BINARY_LOG_LINE     128
+
+enum BinaryLogLevel {
+  BLOG_NONE = 0,
+  BLOG_ERROR,
+  BLOG_WARN,
+  BLOG_INFO,
+  BLOG_DEBUG
+};
+
+enum BinaryLogCategory {
+  BLOG_SYSTEM = 0,
+  BLOG_NET,
+  BLOG_CONTROL,
+  BLOG_MOTOR,
+  BLOG_CATEGORIES
+};
+
+struct BinaryLogRecord {
+  uint32_t sequence;      // ring bookkeeping
+  uint32_t timestamp;     // us since boot, wraps after 71 minutes
+  const char *format;
+  uint8_t category;
+  uint8_t level;
+  int32_t args[BINARY_LOG_ARGS];
+};
+
+// Receives each drained record and its formatted text
+typedef void (*BinaryLogSink)(const BinaryLogRecord &record, const char *text, void *arg);
+
+class BinaryLog {
+  public:
+    BinaryLog();
+
+    // Starts the drain task
+    bool begin(BinaryLogSink sink, void *arg, int core, int priority);
+
+    // Would a record at this level be kept
+    bool enabled(int category, int level) { return level <= this->levels[category]; }
+
+    // Queues a record, false if it was filtered out or dropped
+    bool write(int category, int level, const char *format,
+               int32_t a = 0, int32_t b = 0, int32_t c = 0, int32_t d = 0);
+
+    // Consumer side, one consumer only - takes the oldest record
+    bool read(BinaryLogRecord &record);
+    // Formats a record as "timestamp category level: message"
+    static int format(const BinaryLogRecord &record, char *text, size_t size);
+    // Reads and sinks everything queued, returns the number of records
+    int drain();
+
+    uint8_t levels[BLOG_CATEGORIES];
+    uint32_t drainMs;
+
+    // statistics
+    volatile unsigned long written;
+    volatile unsigned long dropped[BLOG_CATEGORIES];
+
+  private:
+    static void task(void *arg);
+
+    BinaryLogRecord ring[BINARY_LOG_RECORDS];
+    uint32_t head;          // next slot to claim, shared by producers
+    uint32_t tail;          // next slot to read, consumer only
+    unsigned long reportedDrops;
+
+    BinaryLogSink sink;
+    void *sinkArg;
+    TaskHandle_t handle;
+};
+
+extern BinaryLog binaryLog;
+
+// Skips the call (and evaluating the arguments) when the level is off
+#define BLOG(category, level, ...) \
+  do { if (binaryLog.enabled(category, level)) binaryLog.write(category, level, __VA_ARGS__); } while (0)
+
+#endif
@@ -0,0 +1,212 @@
+/*
+ * BoardProfile - which GPIOs, timers and LEDC channels a board wires to
+ * each motor channel
+ *
+ * A board is one constexpr BoardProfile. Each of the four channels is a
+ * pair of H-bridges: as a stepper its four pins drive coils A and B, as
+ * DC motors each bridge is a DC channel of its own, DC channel n on one
+ * bridge and DC channel n + 4 on the other. The bridge on a coil uses the
+ * LEDC channel of its DC channel, so coilChannel also says which bridge is
+ * which DC channel. A channel not fitted on the board has its pins at -1.
+ *
+ * Everything here is evaluated by the compiler. main.cpp builds its motor
+ * objects from the selected profile and the static_asserts at the end
+ * check every profile, so a pin given to two channels or to one the chip
+ * can't drive fails the build rather than the motors. Adding a board is
+ * adding a profile and its static_assert.
+ */
+
+#ifndef BoardProfile_h
+#define BoardProfile_h
+
+#include <stdint.h>
+#include "driver/timer.h"
+
+#define BOARD_CHANNELS      4
+#define BOARD_DC_CHANNELS   (2 * BOARD_CHANNELS)
+#define BOARD_GPIO_COUNT    40
+
+// GPIO6-11 are the SPI flash, 1 and 3 the serial port and 34-39 input only
+#define BOARD_RESERVED_PINS  (0x0FC0ULL | 0x0AULL)
+#define BOARD_INPUT_ONLY     (0x3FULL << 34)
+
+struct BoardChannel {
+  int pin[4];               // motor_pin_1 to 4 - coil A +/-, coil B +/-
+  timer_group_t group;      // only used when the stepper is driven standalone
+  timer_idx_t timer;
+  int coilChannel[2];       // LEDC channel, and so DC channel, of coil A and B
+};
+
+struct BoardProfile {
+  const char *name;
+  BoardChannel channel[BOARD_CHANNELS];
+  int encoder[BOARD_DC_CHANNELS][2];   // quadrature A and B per DC channel
+};
+
+// Adafruit Feather ESP32 or TTGO ESP32
+constexpr BoardProfile featherBoard =
+{
+  "feather",
+  {
+    { {5, 4, 25, 26},   TIMER_GROUP_0, TIMER_0, {0, 4} },
+    { {17, 16, 19, 18}, TIMER_GROUP_0, TIMER_1, {1, 5} },
+    { {23, 22, 14, 32}, TIMER_GROUP_1, TIMER_0, {2, 6} },
+    { {15, 33, 27, 12}, TIMER_GROUP_1, TIMER_1, {3, 7} }
+  },
+  // most pins go to the bridges, GPIO34-39 are input only and free for these
+  {
+    {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1},
+    {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1}
+  }
+};
+
+// Dev board - setup your own pins here...
+constexpr BoardProfile devBoard =
+{
+  "dev",
+  {
+    { {16, 17, 22, 23}, TIMER_GROUP_0, TIMER_0, {4, 0} },
+    { {-1, -1, -1, -1}, TIMER_GROUP_0, TIMER_1, {5, 1} },
+    { {-1, -1, -1, -1}, TIMER_GROUP_1, TIMER_0, {6, 2} },
+    { {-1, -1, -1, -1}, TIMER_GROUP_1, TIMER_1, {7, 3} }
+  },
+  {
+    {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1},
+    {-1, -1}, {-1, -1}, {-1, -1}, {-1, -1}
+  }
+};
+
+/*
+ * Lookups, usable in constant expressions (C++11 constexpr, so one return
+ * each and recursion for loops)
+ */
+
+constexpr uint64_t boardPinBit(int pin)
+{
+  return pin < 0 ? 0 : 1ULL << pin;
+}
+
+// Every GPIO a stepper channel drives
+constexpr uint64_t boardChannelMask(const BoardProfile &board, int c)
+{
+  return boardPinBit(board.channel[c].pin[0]) | boardPinBit(board.channel[c].pin[1]) |
+         boardPinBit(board.channel[c].pin[2]) | boardPinBit(board.channel[c].pin[3]);
+}
+
+constexpr uint64_t boardOutputMask(const BoardProfile &board, int c = 0)
+{
+  return c >= BOARD_CHANNELS ? 0 : boardChannelMask(board, c) | boardOutputMask(board, c + 1);
+}
+
+constexpr bool boardFitted(const BoardProfile &board, int c)
+{
+  return board.channel[c].pin[0] >= 0;
+}
+
+// Pin n (0 or 1) of the bridge behind DC channel dc
+constexpr int boardDCPin(const BoardProfile &board, int dc, int n)
+{
+  return board.channel[dc % BOARD_CHANNELS].pin[
+    (board.channel[dc % BOARD_CHANNELS].coilChannel[0] == dc ? 0 : 2) + n];
+}
+
+/*
+ * Checks
+ */
+
+constexpr int boardBitCount(uint64_t mask)
+{
+  return mask == 0 ? 0 : (int)(mask & 1) + boardBitCount(mask >> 1);
+}
+
+constexpr bool boardPinInRange(int pin)
+{
+  return pin >= -1 && pin < BOARD_GPIO_COUNT;
+}
+
+// All four pins given and different, or none
+constexpr bool boardChannelPinsValid(const BoardChannel &ch)
+{
+  return boardPinInRange(ch.pin[0]) && boardPinInRange(ch.pin[1]) &&
+         boardPinInRange(ch.pin[2]) && boardPinInRange(ch.pin[3]) &&
+         ((ch.pin[0] < 0 && ch.pin[1] < 0 && ch.pin[2] < 0 && ch.pin[3] < 0) ||
+          boardBitCount(boardPinBit(ch.pin[0]) | boardPinBit(ch.pin[1]) |
+                        boardPinBit(ch.pin[2]) | boardPinBit(ch.pin[3])) == 4);
+}
+
+constexpr bool boardPinsValid(const BoardProfile &board, int c = 0)
+{
+  return c >= BOARD_CHANNELS ||
+         (boardChannelPinsValid(board.channel[c]) && boardPinsValid(board, c + 1));
+}
+
+// No GPIO on two channels
+constexpr bool boardPinsApart(const BoardProfile &board, int c = 0, int d = 1)
+{
+  return c >= BOARD_CHANNELS ||
+         (d >= BOARD_CHANNELS ? boardPinsApart(board, c + 1, c + 2) :
+          (boardChannelMask(board, c) & boardChannelMask(board, d)) == 0 && boardPinsApart(board, c, d + 1));
+}
+
+constexpr bool boardPinsDrivable(const BoardProfile &board)
+{
+  return (boardOutputMask(board) & (BOARD_RESERVED_PINS | BOARD_INPUT_ONLY)) == 0;
+}
+
+// A stepper's standalone timer isn't shared with another channel
+constexpr bool boardTimersApart(const BoardProfile &board, int c = 0, int d = 1)
+{
+  return c >= BOARD_CHANNELS ||
+         (d >= BOARD_CHANNELS ? boardTimersApart(board, c + 1, c + 2) :
+          (board.channel[c].group != board.channel[d].group || board.channel[c].timer != board.channel[d].timer) &&
+          boardTimersApart(board, c, d + 1));
+}
+
+// The coil bridges of channel c are DC channels c and c + 4, in either order
+constexpr bool boardCoilChannelsValid(const BoardProfile &board, int c = 0)
+{
+  return c >= BOARD_CHANNELS ||
+         (((board.channel[c].coilChannel[0] == c && board.channel[c].coilChannel[1] == c + BOARD_CHANNELS) ||
+           (board.channel[c].coilChannel[1] == c && board.channel[c].coilChannel[0] == c + BOARD_CHANNELS)) &&
+          boardCoilChannelsValid(board, c + 1));
+}
+
+constexpr uint64_t boardEncoderMask(const BoardProfile &board, int dc = 0)
+{
+  return dc >= BOARD_DC_CHANNELS ? 0 :
+         boardPinBit(board.encoder[dc][0]) | boardPinBit(board.encoder[dc][1]) | boardEncoderMask(board, dc + 1);
+}
+
+constexpr int boardEncoderPinCount(const BoardProfile &board, int dc = 0)
+{
+  return dc >= BOARD_DC_CHANNELS ? 0 :
+         (board.encoder[dc][0] >= 0) + (board.encoder[dc][1] >= 0) + boardEncoderPinCount(board, dc + 1);
+}
+
+constexpr bool boardEncoderPinsInRange(const BoardProfile &board, int dc = 0)
+{
+  return dc >= BOARD_DC_CHANNELS ||
+         (boardPinInRange(board.encoder[dc][0]) && boardPinInRange(board.encoder[dc][1]) &&
+          boardEncoderPinsInRange(board, dc + 1));
+}
+
+// Encoder pins are inputs of their own, off the bridges, flash and serial
+constexpr bool boardEncodersValid(const BoardProfile &board)
+{
+  return boardEncoderPinsInRange(board) &&
+         boardBitCount(boardEncoderMask(board)) == boardEncoderPinCount(board) &&
+         (boardEncoderMask(board) & (boardOutputMask(board) | BOARD_RESERVED_PINS)) == 0;
+}
+
+constexpr bool boardValid(const BoardProfile &board)
+{
+  return boardPinsValid(board) && boardPinsApart(board) && boardPinsDrivable(board) &&
+         boardTimersApart(board) && boardCoilChannelsValid(board) && boardEncodersValid(board);
+}
+
+// Every profile above is checked wherever this is included, not only the
+// one being built for
+static_assert(boardValid(featherBoard), "featherBoard: pin, timer or LEDC channel conflict");
+static_assert(boardValid(devBoard), "devBoard: pin, timer or LEDC channel conflict");
+
+#endif
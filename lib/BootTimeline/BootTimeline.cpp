@@ -0,0 +1,43 @@
+/*
+ * BootTimeline - start up phase stamps, see BootTimeline.h
+ */
+
+#include "BootTimeline.h"
+#include <stdio.h>
+#include "esp_timer.h"
+
+static const char *phaseNames[BOOT_PHASES] = {
+  "motors", "wifi_start", "wifi_up", "ap_up", "server", "first_client", "first_control"
+};
+
+BootTimeline::BootTimeline()
+{
+  for (int i = 0; i < BOOT_PHASES; i++)
+    this->times[i] = -1;
+}
+
+bool BootTimeline::mark(BootPhase phase)
+{
+  if (this->times[phase] >= 0)
+    return false;
+  this->times[phase] = esp_timer_get_time();
+  return true;
+}
+
+const char *BootTimeline::name(BootPhase phase)
+{
+  return phaseNames[phase];
+}
+
+void BootTimeline::writeMetrics(MetricsWriter &writer)
+{
+  char labels[32];
+  writer.header("boot_phase_seconds", "gauge", "Time after boot each start up phase was reached");
+  for (int i = 0; i < BOOT_PHASES; i++)
+  {
+    if (this->times[i] < 0)
+      continue;
+    snprintf(labels, sizeof(labels), "phase=\"%s\"", phaseNames[i]);
+    writer.sample("boot_phase_seconds", labels, this->times[i] * 1e-6);
+  }
+}
@@ -0,0 +1,42 @@
+/*
+ * BootTimeline - when each stage of start up was first reached
+ *
+ * Each phase is stamped once, in microseconds since boot, the first time
+ * mark() is called for it. Later calls only cost a load and compare, so
+ * the phases that repeat, like a control packet arriving, can be marked
+ * on every pass.
+ */
+
+#ifndef BootTimeline_h
+#define BootTimeline_h
+
+#include "esp_types.h"
+#include "MetricsWriter.h"
+
+enum BootPhase {
+  BOOT_MOTORS = 0,          // motor drivers and control loop running
+  BOOT_WIFI_START,          // station started joining
+  BOOT_WIFI_UP,             // station has an address
+  BOOT_AP_UP,               // fallback access point up
+  BOOT_SERVER,              // web server listening
+  BOOT_FIRST_CLIENT,        // first websocket client connected
+  BOOT_FIRST_CONTROL,       // first setpoints applied
+  BOOT_PHASES
+};
+
+class BootTimeline {
+  public:
+    BootTimeline();
+    // True if this call stamped the phase
+    bool mark(BootPhase phase);
+    bool reached(BootPhase phase) { return this->times[phase] >= 0; }
+    // Microseconds since boot, -1 if not reached
+    int64_t at(BootPhase phase) { return this->times[phase]; }
+    static const char *name(BootPhase phase);
+    void writeMetrics(MetricsWriter &writer);
+
+  private:
+    volatile int64_t times[BOOT_PHASES];
+};
+
+#endif
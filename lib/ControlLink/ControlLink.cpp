@@ -0,0 +1,124 @@
+/*
+ * ControlLink - round trip, clock offset and setpoint freshness, see ControlLink.h
+ */
+
+#include "ControlLink.h"
+
+#define CONTROL_LINK_MAX_AGE 200
+
+ControlLink::ControlLink()
+{
+  this->maxAge = CONTROL_LINK_MAX_AGE;
+  reset();
+}
+
+void ControlLink::reset()
+{
+  this->synced = false;
+  this->rtt = 0;
+  this->rttVar = 0;
+  this->lastRtt = 0;
+  this->offset = 0;
+  this->lastAge = 0;
+  this->accepted = 0;
+  this->outOfOrder = 0;
+  this->expired = 0;
+  this->srttQ3 = 0;
+  this->rttvarQ2 = 0;
+  this->bestRtt = 0;
+  this->lastSequence = 0;
+  this->started = false;
+  this->interval = CONTROL_LINK_MIN_INTERVAL;
+  this->hinted = 0;
+  this->acceptedSeen = 0;
+}
+
+void ControlLink::setMaxAge(uint32_t ms)
+{
+  this->maxAge = ms;
+}
+
+void ControlLink::pong(uint32_t sent, uint32_t clientTime, uint32_t now)
+{
+  uint32_t sample = now - sent;
+  // an echo from before a reset, or not ours at all
+  if ((int32_t)sample < 0 || sample > 60000)
+    return;
+
+  if (!this->synced)
+  {
+    this->srttQ3 = sample << 3;
+    this->rttvarQ2 = sample << 1;
+    this->bestRtt = sample;
+  }
+  else
+  {
+    int32_t error = (int32_t)sample - (int32_t)(this->srttQ3 >> 3);
+    this->srttQ3 += error;
+    this->rttvarQ2 += (error < 0 ? -error : error) - (this->rttvarQ2 >> 2);
+  }
+  this->lastRtt = sample;
+  this->rtt = this->srttQ3 >> 3;
+  this->rttVar = this->rttvarQ2 >> 2;
+
+  // The client answered about halfway round, which is closest to true on
+  // the quickest round trips. The best one ages a ms a ping so the offset
+  // still follows the clocks drifting apart.
+  this->bestRtt++;
+  if (sample <= this->bestRtt)
+  {
+    this->bestRtt = sample;
+    this->offset = (int32_t)(clientTime - (sent + sample / 2));
+  }
+  this->synced = true;
+}
+
+ControlVerdict ControlLink::accept(uint16_t sequence, bool stamped, uint32_t clientTime, uint32_t now)
+{
+  if (this->started && (int16_t)(sequence - this->lastSequence) <= 0)
+  {
+    this->outOfOrder++;
+    return CONTROL_OUT_OF_ORDER;
+  }
+  if (stamped && this->synced)
+  {
+    // when it was sent, on the device clock
+    int32_t age = (int32_t)(now - (clientTime - this->offset));
+    this->lastAge = age < 0 ? 0 : age;
+    if ((uint32_t)this->lastAge > this->maxAge)
+    {
+      this->expired++;
+      return CONTROL_EXPIRED;
+    }
+  }
+  this->lastSequence = sequence;
+  this->started = true;
+  this->accepted++;
+  return CONTROL_ACCEPT;
+}
+
+bool ControlLink::sending()
+{
+  return this->accepted != this->acceptedSeen;
+}
+
+bool ControlLink::adapt(size_t queued, bool congested, int senders)
+{
+  this->acceptedSeen = this->accepted;
+  uint32_t floor = CONTROL_LINK_MIN_INTERVAL * (senders > 1 ? senders : 1);
+  uint32_t interval = this->interval;
+  if (queued > CONTROL_LINK_MAX_QUEUE || congested)
+    interval *= 2;
+  else if (interval > CONTROL_LINK_STEP)
+    interval -= CONTROL_LINK_STEP;
+  if (interval < floor)
+    interval = floor;
+  if (interval > CONTROL_LINK_MAX_INTERVAL)
+    interval = CONTROL_LINK_MAX_INTERVAL;
+  this->interval = interval;
+
+  if (this->interval == this->hinted)
+    return false;
+  this->hinted = this->interval;
+  return true;
+}
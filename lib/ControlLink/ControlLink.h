@@ -0,0 +1,82 @@
+/*
+ * ControlLink - round trip time and command freshness for one websocket
+ * client
+ *
+ * The device pings each client with its own clock, the client answers with
+ * that time and its own. The smoothed round trip follows TCP (RFC 6298):
+ * srtt and rttvar with gains of 1/8 and 1/4. The quickest recent pong
+ * also gives the offset between the two clocks, taken as the client's
+ * clock at half its round trip.
+ *
+ * Setpoints are stamped with the client's clock, so once the offset is
+ * known their age on arrival is known too. TCP never reorders, but a
+ * retransmit holds back everything behind it: accept() drops setpoints
+ * older than the maximum age, or older by sequence than one already
+ * applied, so a stalled command can't override a newer one.
+ *
+ * The link also sets how often the client may send setpoints. adapt() is
+ * called on a fixed period: while the client's send queue is backed up or
+ * the device is short of time the interval doubles, otherwise it comes
+ * back down step by step to a floor shared between the clients sending.
+ * The client sends when its sticks move, no faster than the interval, and
+ * otherwise only its keepalive.
+ */
+
+#ifndef ControlLink_h
+#define ControlLink_h
+
+#include "esp_types.h"
+
+#define CONTROL_LINK_MIN_INTERVAL   20    // ms, per client sending
+#define CONTROL_LINK_MAX_INTERVAL   320
+#define CONTROL_LINK_STEP           10    // ms back off per adapt()
+#define CONTROL_LINK_MAX_QUEUE      2     // messages
+
+enum ControlVerdict {
+  CONTROL_ACCEPT = 0,
+  CONTROL_OUT_OF_ORDER = 1,
+  CONTROL_EXPIRED = 2
+};
+
+class ControlLink {
+  public:
+    ControlLink();
+    void reset();
+    void setMaxAge(uint32_t ms);
+    // A pong: the ping time it echoes, the client's clock when it answered
+    // and the device clock now, all in ms
+    void pong(uint32_t sent, uint32_t clientTime, uint32_t now);
+    // Whether a setpoint frame should still be applied, clientTime only
+    // counts if stamped
+    ControlVerdict accept(uint16_t sequence, bool stamped, uint32_t clientTime, uint32_t now);
+    // Whether setpoints arrived since the last adapt()
+    bool sending();
+    // Rework the send interval from the messages queued to this client,
+    // whether the device fell behind and how many clients are sending.
+    // True if the client needs to be told.
+    bool adapt(size_t queued, bool congested, int senders);
+
+    bool synced;              // offset is known
+    uint32_t rtt;             // smoothed round trip, ms
+    uint32_t rttVar;          // its mean deviation, ms
+    uint32_t lastRtt;
+    int32_t offset;           // client clock minus device clock, ms
+    int32_t lastAge;          // of the last stamped setpoint, ms
+    uint16_t interval;        // least ms between setpoints, as hinted
+
+    unsigned long accepted;
+    unsigned long outOfOrder;
+    unsigned long expired;
+
+  private:
+    uint32_t srttQ3;          // rtt in ms, times 8
+    uint32_t rttvarQ2;        // rttVar in ms, times 4
+    uint32_t bestRtt;         // quickest recent round trip, ms
+    uint32_t maxAge;
+    uint16_t lastSequence;
+    bool started;             // lastSequence is valid
+    unsigned long acceptedSeen;   // accepted at the last adapt()
+    uint16_t hinted;              // interval the client was last told
+};
+
+#endif
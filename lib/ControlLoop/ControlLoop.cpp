@@ -0,0 +1,71 @@
+/*
+ * ControlLoop - fixed rate control task, see ControlLoop.h
+ */
+
+#include "ControlLoop.h"
+#include "esp_timer.h"
+
+#define CONTROL_LOOP_STACK 4096
+
+ControlLoop::ControlLoop(ControlLoopBody body, void *arg)
+{
+  this->body = body;
+  this->arg = arg;
+  this->periodUs = 0;
+  this->periodTicks = 1;
+  this->cycles = 0;
+  this->overruns = 0;
+  this->handle = NULL;
+}
+
+bool ControlLoop::begin(uint32_t rateHz, int core, int priority)
+{
+  this->periodTicks = configTICK_RATE_HZ / rateHz;
+  if (this->periodTicks < 1)
+    this->periodTicks = 1;
+  this->periodUs = this->periodTicks * portTICK_PERIOD_MS * 1000;
+  return xTaskCreatePinnedToCore(task, "control", CONTROL_LOOP_STACK, this, priority, &this->handle, core) == pdPASS;
+}
+
+void ControlLoop::task(void *arg)
+{
+  ((ControlLoop *)arg)->run();
+}
+
+void ControlLoop::run()
+{
+  TickType_t wake = xTaskGetTickCount();
+  int64_t ideal = 0;
+  for (;;)
+  {
+    vTaskDelayUntil(&wake, this->periodTicks);
+
+    int64_t start = esp_timer_get_time();
+    // The first wake-up is tick aligned, the schedule is measured from it
+    if (this->cycles == 0)
+      ideal = start;
+    else
+      ideal += this->periodUs;
+    this->body(this->arg);
+    int64_t end = esp_timer_get_time();
+
+    int64_t late = start - ideal;
+    if (late < 0)
+      late = 0;
+    // After a long stall vTaskDelayUntil runs the missed cycles back to back,
+    // count them once and start the schedule again from now
+    if (late > (int64_t)this->periodUs)
+    {
+      this->overruns++;
+      ideal = start;
+      wake = xTaskGetTickCount();
+    }
+    else if (end > ideal + this->periodUs)
+    {
+      this->overruns++;
+    }
+    this->jitter.add((uint32_t)late);
+    this->duration.add((uint32_t)(end - start));
+    this->cycles++;
+  }
+}
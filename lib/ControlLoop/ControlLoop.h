@@ -0,0 +1,45 @@
+/*
+ * ControlLoop - fixed rate control task pinned to one core
+ *
+ * Runs a body function every period from its own FreeRTOS task using
+ * vTaskDelayUntil, so the rate doesn't drift with how long the body takes.
+ * Each wake-up's lateness against its ideal start time goes into a
+ * histogram (microseconds), and cycles whose body ran past the next start
+ * are counted as overruns.
+ *
+ * The period is rounded to whole FreeRTOS ticks (1ms on the Arduino core).
+ */
+
+#ifndef ControlLoop_h
+#define ControlLoop_h
+
+#include "esp_types.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "Histogram.h"
+
+typedef void (*ControlLoopBody)(void *arg);
+
+class ControlLoop {
+  public:
+    ControlLoop(ControlLoopBody body, void *arg);
+    // Starts the task, rateHz at most the FreeRTOS tick rate
+    bool begin(uint32_t rateHz, int core, int priority);
+
+    uint32_t periodUs;
+    Histogram jitter;           // wake-up lateness, us
+    Histogram duration;         // body run time, us
+    volatile unsigned long cycles;
+    volatile unsigned long overruns;
+
+  private:
+    static void task(void *arg);
+    void run();
+
+    ControlLoopBody body;
+    void *arg;
+    TickType_t periodTicks;
+    TaskHandle_t handle;
+};
+
+#endif
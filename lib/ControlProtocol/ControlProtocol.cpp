@@ -0,0 +1,161 @@
+/*
+ * ControlProtocol - frame encoder and streaming decoder, see ControlProtocol.h
+ */
+
+#include <string.h>
+#include "ControlProtocol.h"
+
+// CRC-16/CCITT-FALSE (poly 0x1021), a nibble at a time
+static const uint16_t crcTable[16] = {
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+  0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+uint16_t controlCrc16(const uint8_t *data, size_t len, uint16_t crc)
+{
+  for (size_t i = 0; i < len; i++)
+  {
+    crc = (uint16_t)(crc << 4) ^ crcTable[(crc >> 12) ^ (data[i] >> 4)];
+    crc = (uint16_t)(crc << 4) ^ crcTable[(crc >> 12) ^ (data[i] & 0x0F)];
+  }
+  return crc;
+}
+
+size_t controlEncode(uint8_t *out, size_t size, uint8_t type, uint16_t sequence,
+                     const uint8_t *payload, uint16_t length)
+{
+  size_t total = CONTROL_HEADER_SIZE + length + CONTROL_CRC_SIZE;
+  if (length > CONTROL_MAX_PAYLOAD || total > size)
+    return 0;
+
+  out[0] = CONTROL_MAGIC;
+  out[1] = CONTROL_VERSION;
+  out[2] = type;
+  out[3] = 0;
+  out[4] = (uint8_t)sequence;
+  out[5] = (uint8_t)(sequence >> 8);
+  out[6] = (uint8_t)length;
+  out[7] = (uint8_t)(length >> 8);
+  if (length)
+    memcpy(out + CONTROL_HEADER_SIZE, payload, length);
+  uint16_t crc = controlCrc16(out + 1, CONTROL_HEADER_SIZE - 1 + length);
+  out[CONTROL_HEADER_SIZE + length] = (uint8_t)crc;
+  out[CONTROL_HEADER_SIZE + length + 1] = (uint8_t)(crc >> 8);
+  return total;
+}
+
+ControlDecoder::ControlDecoder()
+{
+  this->frames = 0;
+  this->crcErrors = 0;
+  this->versionErrors = 0;
+  this->lengthErrors = 0;
+  this->droppedBytes = 0;
+  reset();
+}
+
+void ControlDecoder::reset()
+{
+  this->count = 0;
+  this->expected = CONTROL_HEADER_SIZE;
+}
+
+void ControlDecoder::feed(const uint8_t *data, size_t len, ControlFrameHandler handler, void *arg)
+{
+  for (;;)
+  {
+    // Act on everything already buffered first, a resync can leave more
+    // than one frame's worth behind
+    while (this->count >= this->expected)
+      advance(handler, arg);
+    if (len == 0)
+      return;
+
+    if (this->count == 0)
+    {
+      // Hunt for the start of a frame
+      const uint8_t *start = (const uint8_t *)memchr(data, CONTROL_MAGIC, len);
+      if (start == NULL)
+      {
+        this->droppedBytes += len;
+        return;
+      }
+      this->droppedBytes += start - data;
+      len -= start - data;
+      data = start;
+    }
+
+    size_t take = this->expected - this->count;
+    if (take > len)
+      take = len;
+    memcpy(this->buffer + this->count, data, take);
+    this->count += take;
+    data += take;
+    len -= take;
+  }
+}
+
+/*
+ * Called once the header or the whole frame has been buffered
+ */
+void ControlDecoder::advance(ControlFrameHandler handler, void *arg)
+{
+  if (this->expected == CONTROL_HEADER_SIZE)
+  {
+    // Header complete, now we know how long the frame is
+    uint16_t length = this->buffer[6] | (this->buffer[7] << 8);
+    if (this->buffer[1] != CONTROL_VERSION)
+    {
+      this->versionErrors++;
+      discard(1);
+    }
+    else if (length > CONTROL_MAX_PAYLOAD)
+    {
+      this->lengthErrors++;
+      discard(1);
+    }
+    else
+    {
+      this->expected = CONTROL_HEADER_SIZE + length + CONTROL_CRC_SIZE;
+    }
+    return;
+  }
+
+  size_t size = this->expected;
+  uint16_t crc = this->buffer[size - 2] | (this->buffer[size - 1] << 8);
+  if (controlCrc16(this->buffer + 1, size - 3) != crc)
+  {
+    // Whatever we took for a frame wasn't one, look for a real start
+    // inside the bytes we swallowed
+    this->crcErrors++;
+    discard(1);
+    return;
+  }
+
+  ControlFrame frame;
+  frame.version = this->buffer[1];
+  frame.type = this->buffer[2];
+  frame.flags = this->buffer[3];
+  frame.sequence = this->buffer[4] | (this->buffer[5] << 8);
+  frame.length = (uint16_t)(size - CONTROL_HEADER_SIZE - CONTROL_CRC_SIZE);
+  frame.payload = this->buffer + CONTROL_HEADER_SIZE;
+  this->frames++;
+  handler(frame, arg);
+  discard(size);
+}
+
+/*
+ * Drops bytes from the front of the buffer and moves the next magic byte,
+ * if any, to the front
+ */
+void ControlDecoder::discard(size_t bytes)
+{
+  size_t rest = this->count - bytes;
+  const uint8_t *start = (const uint8_t *)memchr(this->buffer + bytes, CONTROL_MAGIC, rest);
+  size_t skip = start == NULL ? rest : start - (this->buffer + bytes);
+  this->droppedBytes += skip;
+  rest -= skip;
+  memmove(this->buffer, this->buffer + bytes + skip, rest);
+  this->count = rest;
+  this->expected = CONTROL_HEADER_SIZE;
+}
@@ -0,0 +1,186 @@
+/*
+ * ControlProtocol - binary websocket protocol between the web client and
+ * the motor controller
+ *
+ * Every frame, in either direction, is laid out little-endian as:
+ *
+ *   offset  size  field
+ *        0     1  magic (0xA5)
+ *        1     1  version
+ *        2     1  type (ControlPacketType)
+ *        3     1  flags, reserved - send 0
+ *        4     2  sequence number
+ *        6     2  payload length
+ *        8     n  payload
+ *      8+n     2  CRC-16/CCITT-FALSE over bytes 1 to 8+n-1
+ *
+ * ControlDecoder is a streaming parser. It is fed whatever bytes arrive,
+ * however the websocket split them into fragments, and calls a handler for
+ * every complete frame that passes its CRC. It never allocates, the largest
+ * frame is buffered in the decoder itself.
+ */
+
+#ifndef ControlProtocol_h
+#define ControlProtocol_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define CONTROL_MAGIC         0xA5
+#define CONTROL_VERSION       1
+#define CONTROL_HEADER_SIZE   8
+#define CONTROL_CRC_SIZE      2
+#define CONTROL_MAX_PAYLOAD   192
+#define CONTROL_MAX_FRAME     (CONTROL_HEADER_SIZE + CONTROL_MAX_PAYLOAD + CONTROL_CRC_SIZE)
+
+#define CONTROL_CHANNELS      8
+#define CONTROL_SETPOINT_MAX  32767  // full scale, forward or reverse
+
+enum ControlPacketType {
+  // client -> device: one mode byte per stepper/dual DC channel, optionally
+  // followed by one ControlStepMode byte per channel (full if left out)
+  CONTROL_SETUP = 0x01,
+  // client -> device: one int16 setpoint per motor channel, optionally
+  // followed by the u32 client clock (ms) it was sent at - stamped
+  // setpoints older than the maximum age are dropped
+  CONTROL_SETPOINTS = 0x02,
+  // client -> device: stepper channel u8, ControlMoveKind u8, int32 steps,
+  // int16 cruise speed (setpoint units, 0 = full scale) - answered
+  // cancelled straight away if the channel isn't a stepper or a group move
+  // or path is running
+  CONTROL_MOVE = 0x03,
+  // device -> client: stepper channel u8, ControlMoveStatus u8, int32
+  // position, sent when a move lands or is cancelled
+  CONTROL_MOVE_DONE = 0x04,
+  // client -> device: ControlMoveKind u8, int16 cruise speed of the longest
+  // axis, int32 steps per stepper channel - one straight line move over
+  // every stepper channel, answered with a CONTROL_MOVE_DONE per channel -
+  // or cancelled for all four while another group move or path is running
+  // or an axis is busy
+  CONTROL_GROUP_MOVE = 0x05,
+  // client -> device: one or more path segments of CONTROL_SEGMENT_SIZE,
+  // each u16 feed (steps/s along the path) then int32 steps per stepper
+  // channel - only send within the grant of the last CONTROL_CREDITS. A
+  // rejected segment shifts the rest of the path, so stop on one.
+  CONTROL_SEGMENTS = 0x06,
+  // device -> client: u32 segments granted since connecting, u32 segments
+  // completed, u32 of this client's segments rejected since connecting -
+  // the client may send granted less what it has sent since connecting.
+  // Sent on connect and whenever the grant or rejections change.
+  CONTROL_CREDITS = 0x07,
+  // device -> client: a TelemetryPublisher delta or key frame of the
+  // ControlTelemetryField values, sent at the telemetry rate while anything
+  // changes and to every client that connects
+  CONTROL_TELEMETRY = 0x08,
+  // device -> client: u32 device clock (ms), u16 smoothed round trip (ms),
+  // u32 setpoints dropped out of order, u32 setpoints dropped as expired -
+  // sent to each client every second, answered with CONTROL_PONG
+  CONTROL_PING = 0x09,
+  // client -> device: u32 device clock echoed from the ping, u32 client
+  // clock (ms) when answering
+  CONTROL_PONG = 0x0A,
+  // device -> client: u16 least ms between CONTROL_SETPOINTS - send only
+  // when they change, no faster than this, plus a keepalive
+  CONTROL_RATE = 0x0B
+};
+
+#define CONTROL_SEGMENT_SIZE  18
+
+// Telemetry fields, CONTROL_TELEMETRY_AXIS fields per stepper channel from
+// channel * CONTROL_TELEMETRY_AXIS, then one per DC channel
+enum ControlTelemetryField {
+  CONTROL_TELEMETRY_SPEED = 0,         // steps/s
+  CONTROL_TELEMETRY_TARGET_SPEED = 1,  // steps/s
+  CONTROL_TELEMETRY_STEP_TICKS = 2,    // timer ticks between steps
+  CONTROL_TELEMETRY_POSITION = 3,      // low 32 bits of the step position
+  CONTROL_TELEMETRY_STATE = 4,         // bit 0 running, bit 1 moving
+  CONTROL_TELEMETRY_AXIS = 5,
+  CONTROL_TELEMETRY_DC_SPEED = 20,     // measured, setpoint units, 0 without an encoder
+  CONTROL_TELEMETRY_FIELDS = 28
+};
+
+enum ControlStepMode {
+  CONTROL_STEP_FULL = 0,
+  CONTROL_STEP_HALF = 1,
+  CONTROL_STEP_WAVE = 2,
+  CONTROL_STEP_MICRO_4 = 3, // sine PWM coil currents, 4 to 32 per full step
+  CONTROL_STEP_MICRO_8 = 4,
+  CONTROL_STEP_MICRO_16 = 5,
+  CONTROL_STEP_MICRO_32 = 6
+};
+
+enum ControlMoveKind {
+  CONTROL_MOVE_TO = 0,      // absolute position
+  CONTROL_MOVE_BY = 1       // relative to where the channel is now
+};
+
+enum ControlMoveStatus {
+  CONTROL_MOVE_REACHED = 0,
+  CONTROL_MOVE_CANCELLED = 1
+};
+
+struct ControlFrame {
+  uint8_t version;
+  uint8_t type;
+  uint8_t flags;
+  uint16_t sequence;
+  uint16_t length;
+  const uint8_t *payload;   // only valid inside the handler
+};
+
+typedef void (*ControlFrameHandler)(const ControlFrame &frame, void *arg);
+
+class ControlDecoder {
+  public:
+    ControlDecoder();
+    void reset();
+    // Parses a chunk of the byte stream, calling handler for each good frame
+    void feed(const uint8_t *data, size_t len, ControlFrameHandler handler, void *arg);
+
+    // statistics
+    unsigned long frames;
+    unsigned long crcErrors;
+    unsigned long versionErrors;
+    unsigned long lengthErrors;
+    unsigned long droppedBytes;   // skipped while hunting for the next magic
+
+  private:
+    void advance(ControlFrameHandler handler, void *arg);
+    void discard(size_t bytes);
+
+    uint8_t buffer[CONTROL_MAX_FRAME];
+    size_t count;                 // bytes buffered of the current frame
+    size_t expected;              // total size of the current frame once known
+};
+
+uint16_t controlCrc16(const uint8_t *data, size_t len, uint16_t crc = 0xFFFF);
+
+// Builds a frame into out, returns its size or 0 if it does not fit
+size_t controlEncode(uint8_t *out, size_t size, uint8_t type, uint16_t sequence,
+                     const uint8_t *payload, uint16_t length);
+
+inline int16_t controlReadInt16(const uint8_t *p)
+{
+  return (int16_t)(p[0] | (p[1] << 8));
+}
+
+inline void controlWriteInt16(uint8_t *p, int16_t value)
+{
+  p[0] = (uint8_t)value;
+  p[1] = (uint8_t)((uint16_t)value >> 8);
+}
+
+inline int32_t controlReadInt32(const uint8_t *p)
+{
+  return (int32_t)((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+inline void controlWriteInt32(uint8_t *p, int32_t value)
+{
+  p[0] = (uint8_t)value;
+  p[1] = (uint8_t)((uint32_t)value >> 8);
+  p[2] = (uint8_t)((uint32_t)value >> 16);
+  p[3] = (uint8_t)((uint32_t)value >> 24);
+}
+
+#endif
@@ -5,8 +5,10 @@ DCMotorController::DCMotorController(int channel, int pin1, int pin2)
     this->ledChannel = channel;
     this->pin1 = pin1;
     this->pin2 = pin2;
-    pinMode(this->pin1, OUTPUT);
-    pinMode(this->pin2, OUTPUT);
+    if(pin1 >= 0 && pin2 >= 0) {   // -1 when the board hasn't this channel
+        pinMode(this->pin1, OUTPUT);
+        pinMode(this->pin2, OUTPUT);
+    }
     ledcSetup(this->ledChannel, this->freq, this->resolution);
     this->pwmPin = -1;
 }
@@ -25,7 +27,7 @@ void DCMotorController::SetSpeed(int speed)
         ledcAttachPin(this->pin2, this->ledChannel);
         this->pwmPin = this->pin2;
     }
-    ledcWrite(this->ledChannel, (speed < 0)?(255-speed):speed);    
+    ledcWrite(this->ledChannel, (speed < 0)?-speed:speed);
 }
 
 void DCMotorController::SetBreaking(bool breaking)
@@ -40,4 +42,5 @@ void DCMotorController::Disconnect()
     ledcDetachPin(this->pin2);     
     digitalWrite(this->pin1, LOW);
     digitalWrite(this->pin2, LOW);  
+    this->pwmPin = -1;
 }
\ No newline at end of file
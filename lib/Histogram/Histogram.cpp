@@ -0,0 +1,90 @@
+/*
+ * Histogram - log-linear histogram, see Histogram.h
+ */
+
+#include <string.h>
+#include "Histogram.h"
+#include "freertos/FreeRTOS.h"
+
+static portMUX_TYPE histogramMux = portMUX_INITIALIZER_UNLOCKED;
+
+Histogram::Histogram()
+{
+  reset();
+}
+
+void IRAM_ATTR Histogram::reset()
+{
+  this->min = 0xFFFFFFFF;
+  this->max = 0;
+  this->count = 0;
+  this->sum = 0;
+  memset(this->buckets, 0, sizeof(this->buckets));
+}
+
+/*
+ * Values below 2^SUB_BITS get a bucket each, above that the bucket is the
+ * position of the top bit plus the SUB_BITS bits that follow it
+ */
+int IRAM_ATTR Histogram::bucketOf(uint32_t value)
+{
+  if (value < (1 << HISTOGRAM_SUB_BITS))
+    return value;
+  int top = 31 - __builtin_clz(value);
+  int shift = top - HISTOGRAM_SUB_BITS;
+  return ((shift + 1) << HISTOGRAM_SUB_BITS) + ((value >> shift) & ((1 << HISTOGRAM_SUB_BITS) - 1));
+}
+
+// Largest value that falls into a bucket
+uint32_t Histogram::bucketLimit(int bucket)
+{
+  if (bucket < (1 << HISTOGRAM_SUB_BITS))
+    return bucket;
+  int shift = (bucket >> HISTOGRAM_SUB_BITS) - 1;
+  uint64_t base = (uint64_t)((bucket & ((1 << HISTOGRAM_SUB_BITS) - 1)) | (1 << HISTOGRAM_SUB_BITS)) << shift;
+  uint64_t limit = base + (1ULL << shift) - 1;
+  return limit > 0xFFFFFFFF ? 0xFFFFFFFF : (uint32_t)limit;
+}
+
+void IRAM_ATTR Histogram::add(uint32_t value)
+{
+  this->buckets[bucketOf(value)]++;
+  this->count++;
+  this->sum += value;
+  if (value < this->min)
+    this->min = value;
+  if (value > this->max)
+    this->max = value;
+}
+
+uint32_t Histogram::percentile(uint32_t percent)
+{
+  if (this->count == 0)
+    return 0;
+  unsigned long rank = (unsigned long)(((uint64_t)this->count * percent + 99) / 100);
+  if (rank == 0)
+    rank = 1;
+  unsigned long seen = 0;
+  for (int b = 0; b < HISTOGRAM_BUCKETS; b++)
+  {
+    seen += this->buckets[b];
+    if (seen >= rank)
+    {
+      uint32_t limit = bucketLimit(b);
+      return limit > this->max ? this->max : limit;
+    }
+  }
+  return this->max;
+}
+
+uint32_t Histogram::mean()
+{
+  return this->count ? (uint32_t)(this->sum / this->count) : 0;
+}
+
+void Histogram::snapshot(Histogram &into)
+{
+  portENTER_CRITICAL(&histogramMux);
+  memcpy(&into, this, sizeof(Histogram));
+  portEXIT_CRITICAL(&histogramMux);
+}
@@ -0,0 +1,43 @@
+/*
+ * Histogram - fixed size log-linear histogram for timing measurements
+ *
+ * Values are bucketed by their highest set bit and the two bits below it,
+ * giving four buckets per power of two - about 20% resolution over the
+ * whole 32-bit range in 512 bytes. add() is a handful of instructions with
+ * no division, so it and reset() can be called from an interrupt.
+ */
+
+#ifndef Histogram_h
+#define Histogram_h
+
+#include "esp_attr.h"
+#include "esp_types.h"
+
+#define HISTOGRAM_SUB_BITS  2
+#define HISTOGRAM_BUCKETS   ((32 - HISTOGRAM_SUB_BITS + 1) << HISTOGRAM_SUB_BITS)
+
+class Histogram {
+  public:
+    Histogram();
+    void reset();
+    void add(uint32_t value);
+
+    // Upper bound of the bucket holding the given percentile (0 - 100)
+    uint32_t percentile(uint32_t percent);
+    uint32_t mean();
+
+    // Copies with interrupts masked, so an add() on this core can't land
+    // halfway through the copy
+    void snapshot(Histogram &into);
+
+    uint32_t min;
+    uint32_t max;
+    unsigned long count;
+    uint64_t sum;
+    unsigned long buckets[HISTOGRAM_BUCKETS];
+
+    static int bucketOf(uint32_t value);
+    static uint32_t bucketLimit(int bucket);
+};
+
+#endif
@@ -0,0 +1,104 @@
+/*
+ * MCPWMMotorController - H-bridge on an MCPWM operator, see MCPWMMotorController.h
+ */
+
+#include "MCPWMMotorController.h"
+#include "esp32-hal-gpio.h"
+#include "esp32-hal-matrix.h"
+
+// MCPWM unit clock with its prescaler at 0
+#define MCPWM_BASE_CLK 160000000
+
+MCPWMMotorController::MCPWMMotorController(mcpwm_unit_t unit, mcpwm_timer_t timer, int pin1, int pin2,
+                                           uint32_t frequency, int resolution)
+{
+  this->unit = unit;
+  this->timer = timer;
+  this->device = unit == MCPWM_UNIT_0 ? &MCPWM0 : &MCPWM1;
+  this->pin1 = pin1;
+  this->pin2 = pin2;
+  this->frequency = frequency;
+  this->period = 1UL << resolution;
+  this->attached = false;
+  this->breakMotor = false;
+  this->speed = 0;
+}
+
+void MCPWMMotorController::begin()
+{
+  mcpwm_config_t config;
+  config.frequency = this->frequency;
+  config.cmpr_a = 0;
+  config.cmpr_b = 0;
+  config.counter_mode = MCPWM_UP_COUNTER;
+  config.duty_mode = MCPWM_DUTY_MODE_0;
+  mcpwm_init(this->unit, this->timer, &config);
+
+  // The driver's 1MHz timer clock leaves 50 steps at 20kHz, run the timer
+  // from the full unit clock so the period is 2^resolution ticks
+  uint32_t prescale = (MCPWM_BASE_CLK + this->frequency * this->period / 2) / (this->frequency * this->period);
+  if (prescale < 1)
+    prescale = 1;
+  if (prescale > 256)
+    prescale = 256;
+  this->device->clk_cfg.prescale = 0;
+  this->device->timer[this->timer].period.prescale = prescale - 1;
+  this->device->timer[this->timer].period.period = this->period;
+
+  SetBreaking(this->breakMotor);
+}
+
+void MCPWMMotorController::attach()
+{
+  mcpwm_gpio_init(this->unit, (mcpwm_io_signals_t)(MCPWM0A + 2 * this->timer), this->pin1);
+  mcpwm_gpio_init(this->unit, (mcpwm_io_signals_t)(MCPWM0B + 2 * this->timer), this->pin2);
+  this->attached = true;
+}
+
+/*
+ * One write per comparator whatever the direction. The comparator that
+ * isn't driving sits at 0, where its edge wins over the start of period
+ * edge and holds that output at its idle level.
+ */
+void MCPWMMotorController::SetSpeed(int speed)
+{
+  if (!this->attached)
+    attach();
+  if (speed > maxSpeed())
+    speed = maxSpeed();
+  if (speed < -maxSpeed())
+    speed = -maxSpeed();
+  this->speed = speed;
+
+  uint32_t duty = speed < 0 ? -speed : speed;
+  // braking drives forward by pulling B low against A held high
+  bool driveA = (speed > 0) != this->breakMotor;
+  this->device->channel[this->timer].cmpr_value[0].cmpr_val = driveA ? duty : 0;
+  this->device->channel[this->timer].cmpr_value[1].cmpr_val = driveA ? 0 : duty;
+}
+
+/*
+ * Coasting pulses an output high from the start of the period to its
+ * comparator, braking pulses it low instead
+ */
+void MCPWMMotorController::SetBreaking(bool breaking)
+{
+  this->breakMotor = breaking;
+  mcpwm_duty_type_t mode = breaking ? MCPWM_DUTY_MODE_1 : MCPWM_DUTY_MODE_0;
+  mcpwm_set_duty_type(this->unit, this->timer, MCPWM_OPR_A, mode);
+  mcpwm_set_duty_type(this->unit, this->timer, MCPWM_OPR_B, mode);
+  if (this->attached)
+    SetSpeed(this->speed);
+}
+
+void MCPWMMotorController::Disconnect()
+{
+  this->device->channel[this->timer].cmpr_value[0].cmpr_val = 0;
+  this->device->channel[this->timer].cmpr_value[1].cmpr_val = 0;
+  pinMatrixOutDetach(this->pin1, false, false);
+  pinMatrixOutDetach(this->pin2, false, false);
+  digitalWrite(this->pin1, LOW);
+  digitalWrite(this->pin2, LOW);
+  this->attached = false;
+  this->speed = 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * MCPWMMotorController - drives a two input H-bridge from one MCPWM operator
+ *
+ * Both bridge inputs stay routed to the operator's A and B outputs for as
+ * long as the motor is connected. Output A is driven by comparator A and
+ * output B by comparator B, and the side that isn't driving has its
+ * comparator at 0 so it sits at its idle level all period. Speed and
+ * direction are then just the two comparator values, latched together at
+ * the start of the next PWM period - reversing never touches the pins.
+ *
+ * Coasting (fast decay) idles the outputs low between pulses, braking (slow
+ * decay) idles them high, shorting the motor through the bridge.
+ *
+ * The two MCPWM units have three operators each, so at most six of these.
+ */
+
+#ifndef MCPWMMotorController_h
+#define MCPWMMotorController_h
+
+#include "driver/mcpwm.h"
+#include "soc/mcpwm_struct.h"
+
+class MCPWMMotorController {
+  public:
+    // resolution in bits, speeds run from -(2^resolution - 1) to 2^resolution - 1
+    MCPWMMotorController(mcpwm_unit_t unit, mcpwm_timer_t timer, int pin1, int pin2,
+                         uint32_t frequency = 20000, int resolution = 10);
+    // Sets up the operator's timer, call once from setup()
+    void begin();
+    void SetSpeed(int speed);
+    void SetBreaking(bool breaking);
+    void Disconnect();
+    int maxSpeed() { return this->period - 1; }
+
+  private:
+    mcpwm_unit_t unit;
+    mcpwm_timer_t timer;
+    mcpwm_dev_t *device;
+    int pin1;
+    int pin2;
+    uint32_t frequency;
+    uint32_t period;          // timer ticks per PWM period, 2^resolution
+    bool attached;            // pins routed to the operator
+    bool breakMotor;
+    int speed;
+
+    void attach();
+};
+
+#endif
@@ -0,0 +1,68 @@
+/*
+ * Mailbox - wait-free single producer / single consumer "latest value" box
+ *
+ * A triple buffer: the producer fills its own slot and publishes it with one
+ * atomic exchange, the consumer picks up the newest published slot with
+ * another. Neither side ever waits for or retries against the other, and
+ * the consumer always sees a complete snapshot, never a mix of two writes.
+ * Snapshots the consumer didn't get to in time are simply superseded.
+ *
+ *   producer:  T &next = box.write(); ...fill next...; box.publish();
+ *   consumer:  if (box.read()) use(box.current());
+ */
+
+#ifndef Mailbox_h
+#define Mailbox_h
+
+#include <stdint.h>
+
+template <typename T>
+class Mailbox {
+  public:
+    Mailbox()
+    {
+      this->back = 0;
+      this->shared = 1;
+      this->front = 2;
+      this->published = 0;
+    }
+
+    // The slot the producer may fill, private to it until publish()
+    T &write() { return this->slots[this->back]; }
+
+    // Hands the filled slot over and takes the stale one back
+    void publish()
+    {
+      uint32_t old = __atomic_exchange_n(&this->shared, this->back | FRESH, __ATOMIC_ACQ_REL);
+      this->back = old & INDEX;
+      this->published++;
+    }
+
+    // Takes the newest snapshot if there is one, returns false if nothing
+    // was published since the last read
+    bool read()
+    {
+      if ((__atomic_load_n(&this->shared, __ATOMIC_ACQUIRE) & FRESH) == 0)
+        return false;
+      uint32_t old = __atomic_exchange_n(&this->shared, this->front, __ATOMIC_ACQ_REL);
+      this->front = old & INDEX;
+      return true;
+    }
+
+    // The snapshot taken by the last successful read()
+    const T &current() { return this->slots[this->front]; }
+
+    // producer side count, for statistics
+    unsigned long published;
+
+  private:
+    static const uint32_t INDEX = 0x3;
+    static const uint32_t FRESH = 0x4;
+
+    T slots[3];
+    uint32_t back;      // producer's slot
+    uint32_t shared;    // slot in the middle, FRESH when unread
+    uint32_t front;     // consumer's slot
+};
+
+#endif
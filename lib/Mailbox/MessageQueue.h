@@ -0,0 +1,86 @@
+/*
+ * MessageQueue - wait-free single producer / single consumer FIFO
+ *
+ * Where a Mailbox hands over only the newest value, a MessageQueue hands
+ * over every message in order: commands that must each be run once, and
+ * the replies to them. A ring of N slots (a power of two); the producer
+ * fills the slot at the tail and publishes it by advancing the tail, the
+ * consumer reads the slot at the head and gives it back by advancing the
+ * head. Each index is written by one side only, so neither ever waits on
+ * the other. A full queue refuses the message, it is up to the producer
+ * what that means.
+ *
+ *   producer:  T *next = queue.write(); if (next) { ...fill *next...; queue.publish(); }
+ *   consumer:  while (const T *message = queue.read()) { use(*message); queue.release(); }
+ */
+
+#ifndef MessageQueue_h
+#define MessageQueue_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+template <typename T, uint32_t N>
+class MessageQueue {
+  public:
+    MessageQueue()
+    {
+      this->head = 0;
+      this->tail = 0;
+      this->published = 0;
+      this->refused = 0;
+    }
+
+    // The slot the producer may fill, NULL when the queue is full
+    T *write()
+    {
+      uint32_t head = __atomic_load_n(&this->head, __ATOMIC_ACQUIRE);
+      if (this->tail - head >= N)
+      {
+        this->refused++;
+        return NULL;
+      }
+      return &this->slots[this->tail & (N - 1)];
+    }
+
+    // Slots free for the producer
+    uint32_t space()
+    {
+      return N - (this->tail - __atomic_load_n(&this->head, __ATOMIC_ACQUIRE));
+    }
+
+    // Hands the filled slot over
+    void publish()
+    {
+      __atomic_store_n(&this->tail, this->tail + 1, __ATOMIC_RELEASE);
+      this->published++;
+    }
+
+    // The oldest message, NULL when there is none
+    const T *read()
+    {
+      uint32_t tail = __atomic_load_n(&this->tail, __ATOMIC_ACQUIRE);
+      if (this->head == tail)
+        return NULL;
+      return &this->slots[this->head & (N - 1)];
+    }
+
+    // Gives the slot read() returned back to the producer
+    void release()
+    {
+      __atomic_store_n(&this->head, this->head + 1, __ATOMIC_RELEASE);
+    }
+
+    // producer side counts, for statistics
+    unsigned long published;
+    unsigned long refused;
+
+  private:
+    static_assert((N & (N - 1)) == 0, "MessageQueue size must be a power of two");
+
+    T slots[N];
+    uint32_t head;      // next to read, written by the consumer
+    uint32_t tail;      // next to fill, written by the producer
+};
+
+#endif
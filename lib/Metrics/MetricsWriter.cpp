@@ -0,0 +1,102 @@
+/*
+ * MetricsWriter - Prometheus text format writer, see MetricsWriter.h
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include "MetricsWriter.h"
+
+MetricsWriter::MetricsWriter(char *buffer, size_t size)
+{
+  this->buffer = buffer;
+  this->size = size;
+  this->sink = NULL;
+  this->arg = NULL;
+  this->used = 0;
+  this->overflow = false;
+  if (size > 0)
+    buffer[0] = 0;
+}
+
+MetricsWriter::MetricsWriter(MetricsSink sink, void *arg)
+{
+  this->buffer = NULL;
+  this->size = 0;
+  this->sink = sink;
+  this->arg = arg;
+  this->used = 0;
+  this->overflow = false;
+}
+
+void MetricsWriter::append(const char *format, ...)
+{
+  if (this->overflow)
+    return;
+  va_list args;
+  va_start(args, format);
+  if (this->sink != NULL)
+  {
+    // A line at a time, the whole of it or nothing from here on
+    char line[METRICS_LINE_SIZE];
+    int written = vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    if (written < 0 || (size_t)written >= sizeof(line) || this->sink(line, written, this->arg) != (size_t)written)
+    {
+      this->overflow = true;
+      return;
+    }
+    this->used += written;
+    return;
+  }
+  int written = vsnprintf(this->buffer + this->used, this->size - this->used, format, args);
+  va_end(args);
+  if (written < 0 || (size_t)written >= this->size - this->used)
+  {
+    // Roll back the partial line
+    this->buffer[this->used] = 0;
+    this->overflow = true;
+    return;
+  }
+  this->used += written;
+}
+
+void MetricsWriter::header(const char *name, const char *type, const char *help)
+{
+  append("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+void MetricsWriter::sample(const char *name, const char *labels, double value)
+{
+  if (labels != NULL)
+    append("%s{%s} %.9g\n", name, labels, value);
+  else
+    append("%s %.9g\n", name, value);
+}
+
+void MetricsWriter::sample(const char *name, const char *labels, unsigned long value)
+{
+  if (labels != NULL)
+    append("%s{%s} %lu\n", name, labels, value);
+  else
+    append("%s %lu\n", name, value);
+}
+
+void MetricsWriter::summary(const char *name, const char *help, const char *labels, Histogram &histogram, double scale)
+{
+  static const uint32_t quantiles[] = { 50, 90, 99 };
+  const char *open = labels != NULL ? "{" : "";
+  const char *close = labels != NULL ? "}" : "";
+  const char *separator = labels != NULL ? "," : "";
+  if (labels == NULL)
+    labels = "";
+
+  if (help != NULL)
+    header(name, "summary", help);
+  for (int i = 0; i < 3; i++)
+    append("%s{%s%squantile=\"0.%02u\"} %.9g\n", name, labels, separator, (unsigned)quantiles[i],
+      histogram.percentile(quantiles[i]) * scale);
+  append("%s_sum%s%s%s %.9g\n", name, open, labels, close, histogram.sum * scale);
+  append("%s_count%s%s%s %lu\n", name, open, labels, close, histogram.count);
+  append("%s_min%s%s%s %.9g\n", name, open, labels, close, histogram.count ? histogram.min * scale : 0.0);
+  append("%s_max%s%s%s %.9g\n", name, open, labels, close, histogram.max * scale);
+}
@@ -0,0 +1,50 @@
+/*
+ * MetricsWriter - formats metrics in the Prometheus text exposition format
+ * into a caller supplied buffer, or a line at a time to a sink such as a
+ * streamed HTTP response
+ *
+ * Output that doesn't fit is dropped whole lines at a time and flagged by
+ * overflowed(), so a scrape never sees half a sample.
+ */
+
+#ifndef MetricsWriter_h
+#define MetricsWriter_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include "Histogram.h"
+
+#define METRICS_LINE_SIZE 256
+
+// Takes one formatted line, returning how much of it was taken
+typedef size_t (*MetricsSink)(const char *text, size_t length, void *arg);
+
+class MetricsWriter {
+  public:
+    MetricsWriter(char *buffer, size_t size);
+    MetricsWriter(MetricsSink sink, void *arg);
+
+    // "# HELP" and "# TYPE" lines, once per metric name
+    void header(const char *name, const char *type, const char *help);
+    // One sample, labels is the inside of the braces or NULL
+    void sample(const char *name, const char *labels, double value);
+    void sample(const char *name, const char *labels, unsigned long value);
+    // A summary with 50/90/99th percentiles, min and max from a histogram,
+    // values multiplied by scale (e.g. to convert ticks to seconds)
+    void summary(const char *name, const char *help, const char *labels, Histogram &histogram, double scale);
+
+    size_t length() { return this->used; }
+    bool overflowed() { return this->overflow; }
+
+  private:
+    void append(const char *format, ...);
+
+    char *buffer;
+    size_t size;
+    MetricsSink sink;
+    void *arg;
+    size_t used;
+    bool overflow;
+};
+
+#endif
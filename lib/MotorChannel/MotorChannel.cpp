@@ -0,0 +1,68 @@
+/*
+ * MotorChannel - per channel output state machine, see MotorChannel.h
+ */
+
+#include "MotorChannel.h"
+
+MotorChannel::MotorChannel(int index, StepperTimer *stepper, ChannelDCOutput dcOutput)
+{
+  this->index = index;
+  this->stepper = stepper;
+  this->dcOutput = dcOutput;
+  this->state = CHANNEL_OFF;
+  this->requested = CHANNEL_OFF;
+  this->mode = StepperTimer::full;
+  this->microsteps = 1;
+  this->switches = 0;
+}
+
+// The step mode a state runs in, only a microstepper has microsteps
+void MotorChannel::normalise(ChannelState state, StepperTimer::modeEnum &mode, int &microsteps)
+{
+  if (state == CHANNEL_MICROSTEP)
+    mode = StepperTimer::micro;
+  else if (state != CHANNEL_STEPPER || mode == StepperTimer::micro)
+    mode = StepperTimer::full;
+  if (mode != StepperTimer::micro)
+    microsteps = 1;
+}
+
+bool MotorChannel::changes(ChannelState state, StepperTimer::modeEnum mode, int microsteps)
+{
+  normalise(state, mode, microsteps);
+  return state != this->requested || mode != this->mode || microsteps != this->microsteps;
+}
+
+bool MotorChannel::set(ChannelState state, StepperTimer::modeEnum mode, int microsteps)
+{
+  if (!changes(state, mode, microsteps))
+    return false;
+  normalise(state, mode, microsteps);
+
+  // Off to everyone else until the new outputs are up
+  ChannelState from = this->state;
+  this->state = CHANNEL_OFF;
+  if (from == CHANNEL_STEPPER || from == CHANNEL_MICROSTEP)
+    this->stepper->disconnect();
+  else if (from == CHANNEL_DC)
+    this->dcOutput(this->index, false);
+
+  ChannelState to = state;
+  if (state == CHANNEL_STEPPER || state == CHANNEL_MICROSTEP)
+  {
+    this->stepper->setMode(mode, microsteps);
+    if (this->stepper->mode != StepperTimer::micro)
+      to = CHANNEL_STEPPER;
+  }
+  else if (state == CHANNEL_DC)
+  {
+    this->dcOutput(this->index, true);
+  }
+
+  this->requested = state;
+  this->mode = mode;
+  this->microsteps = microsteps;
+  this->switches++;
+  this->state = to;
+  return true;
+}
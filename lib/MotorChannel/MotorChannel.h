@@ -0,0 +1,65 @@
+/*
+ * MotorChannel - what one pair of H-bridges drives, and switching it
+ *
+ * A channel is off, a stepper stepping its coils from GPIO (full, half or
+ * wave), a microstepper with its coils on two LEDC channels, or two DC
+ * motors. Timers, the scheduler slot and the interrupts are all set up
+ * once at boot, so a switch only quiesces what the old state drove and
+ * hands the pins to the new one: a stepper is taken off the scheduler,
+ * which waits out a step in progress on the other core, and its coils
+ * released low; DC motors are stopped and their PWM detached. All pins sit
+ * low between the two and the switch takes a few register writes.
+ *
+ * Once running, the outputs are driven by the control loop alone: channel
+ * setups, setpoints, moves, path segments and holding current are all
+ * handed to it and applied there, and the step interrupts do the rest.
+ * set() is only called from it, anything else reads state, which reads as
+ * off for the length of a switch.
+ */
+
+#ifndef MotorChannel_h
+#define MotorChannel_h
+
+#include "StepperTimer.h"
+
+enum ChannelState {
+  CHANNEL_OFF = 0,
+  CHANNEL_STEPPER,
+  CHANNEL_MICROSTEP,
+  CHANNEL_DC
+};
+
+// Starts (enable) or stops and detaches the two DC motors on a channel
+typedef void (*ChannelDCOutput)(int channel, bool enable);
+
+class MotorChannel {
+  public:
+    MotorChannel(int index, StepperTimer *stepper, ChannelDCOutput dcOutput);
+
+    // Moves to a state. mode is the stepping for CHANNEL_STEPPER, microsteps
+    // the division for CHANNEL_MICROSTEP. False when already there, a
+    // repeated request doesn't disturb a running motor.
+    bool set(ChannelState state, StepperTimer::modeEnum mode = StepperTimer::full, int microsteps = 16);
+    // Whether set() with these would switch anything
+    bool changes(ChannelState state, StepperTimer::modeEnum mode = StepperTimer::full, int microsteps = 16);
+
+    bool isStepper() { return this->state == CHANNEL_STEPPER || this->state == CHANNEL_MICROSTEP; }
+    bool isDC() { return this->state == CHANNEL_DC; }
+
+    volatile ChannelState state;
+
+    // statistics
+    unsigned long switches;
+
+  private:
+    static void normalise(ChannelState state, StepperTimer::modeEnum &mode, int &microsteps);
+    int index;
+    StepperTimer *stepper;
+    ChannelDCOutput dcOutput;
+    // last request, a microstepper without coil channels runs full steps
+    ChannelState requested;
+    StepperTimer::modeEnum mode;
+    int microsteps;
+};
+
+#endif
@@ -0,0 +1,576 @@
+/*
+ * MotorControl - frame handling, channel setups and setpoints, see MotorControl.h
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "MotorControl.h"
+
+MotorControl::MotorControl(const BoardProfile &board, StepperTimer *steppers, MotorChannel *channels,
+                           StepperGroup &group, SegmentQueue &segments)
+  : board(board), group(group), segments(segments)
+{
+  this->steppers = steppers;
+  this->channels = channels;
+  this->recorder = NULL;
+  this->maxAge = 200;
+  this->dcOutput = NULL;
+  this->switched = NULL;
+  this->send = NULL;
+  this->arg = NULL;
+  memset(this->setpoint, 0, sizeof(this->setpoint));
+  this->setpointsArrived = 0;
+  this->setpointsAccepted = 0;
+  this->setpointsOutOfOrder = 0;
+  this->setpointsExpired = 0;
+  this->movesRefused = 0;
+  this->segmentsDropped = 0;
+  this->segmentsOverCredit = 0;
+  this->holdReductions = 0;
+  this->holdPending = 0;
+  this->holdPercent = 100;
+  memset(&this->channelSetup, 0, sizeof(this->channelSetup));
+  for (int i = 0; i < 4; i++)
+  {
+    this->moveActive[i] = false;
+    this->moveCompleted[i] = 0;
+    this->groupMember[i] = false;
+  }
+  this->groupActive = false;
+  this->groupCompleted = 0;
+  for (int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
+  {
+    this->connection[i] = 0;
+    this->dropped[i] = 0;
+  }
+  memset(this->credit, 0, sizeof(this->credit));
+}
+
+void MotorControl::setOutputs(MotorControlDCOutput dcOutput, MotorControlSwitched switched, MotorControlSend send, void *arg)
+{
+  this->dcOutput = dcOutput;
+  this->switched = switched;
+  this->send = send;
+  this->arg = arg;
+}
+
+void MotorControl::connect(int slot, int64_t now)
+{
+  this->decoders[slot].reset();
+  this->links[slot].reset();
+  this->links[slot].setMaxAge(this->maxAge);
+  if (this->recorder != NULL)
+    this->recorder->connect(slot, now);
+  // the control loop grants the new connection its credit
+  this->dropped[slot] = 0;
+  uint32_t connection = this->connection[slot];
+  __atomic_store_n(&this->connection[slot], connection + ((connection & 1) ? 2 : 1), __ATOMIC_RELEASE);
+}
+
+void MotorControl::disconnect(int slot, int64_t now)
+{
+  if (this->recorder != NULL)
+    this->recorder->disconnect(slot, now);
+  uint32_t connection = this->connection[slot];
+  if (connection & 1)
+    __atomic_store_n(&this->connection[slot], connection + 1, __ATOMIC_RELEASE);
+}
+
+int32_t MotorControl::stepperRate(long setpoint)
+{
+  return (int32_t)((int64_t)setpoint * (MOTOR_CONTROL_MAX_RATE << STEP_PLANNER_RATE_SHIFT) / CONTROL_SETPOINT_MAX);
+}
+
+bool MotorControl::isCommand(const ControlFrame &frame)
+{
+  if (frame.type == CONTROL_SETPOINTS)
+  {
+    for (int i = 0; i < 8 && i*2+2 <= frame.length; i++)
+      if (controlReadInt16(frame.payload + i*2) != 0)
+        return true;
+    return false;
+  }
+  return frame.type == CONTROL_MOVE || frame.type == CONTROL_GROUP_MOVE ||
+         frame.type == CONTROL_SEGMENTS || frame.type == CONTROL_SETUP;
+}
+
+ControlVerdict MotorControl::handle(int slot, const ControlFrame &frame, int64_t now, uint32_t nowMs)
+{
+  ControlLink *link = &this->links[slot];
+  if (this->recorder != NULL)
+    this->recorder->frame(slot, frame, now);
+
+  // control input packet - publish all channels at once to the control loop
+  if (frame.type == CONTROL_SETPOINTS)
+  {
+    // Drop setpoints that were overtaken or held up on the way, the next
+    // fresh ones are never far behind
+    bool stamped = frame.length >= 20;
+    ControlVerdict verdict = link->accept(frame.sequence, stamped,
+      stamped ? (uint32_t)controlReadInt32(frame.payload + 16) : 0, nowMs);
+    if (verdict == CONTROL_EXPIRED)
+      this->setpointsExpired++;
+    else if (verdict == CONTROL_OUT_OF_ORDER)
+      this->setpointsOutOfOrder++;
+    if (verdict != CONTROL_ACCEPT)
+      return verdict;
+    this->setpointsAccepted++;
+    SetpointSnapshot &snapshot = this->setpointMailbox.write();
+    for (int i = 0; i < 8; i++)
+    {
+      if (i*2+2 <= frame.length)
+        snapshot.setpoint[i] = controlReadInt16(frame.payload + i*2);
+      else
+        snapshot.setpoint[i] = 0;
+    }
+    snapshot.sequence = frame.sequence;
+    snapshot.arrived = now;
+    this->setpointMailbox.publish();
+  }
+
+  // ping answered, round trip and clock offset
+  if (frame.type == CONTROL_PONG && frame.length >= 8)
+  {
+    link->pong((uint32_t)controlReadInt32(frame.payload), (uint32_t)controlReadInt32(frame.payload + 4), nowMs);
+    this->roundTrip.add(link->lastRtt * 1000);
+  }
+
+  // position move for a stepper channel, started by the control loop -
+  // if it can't be queued the client hears straight away
+  if (frame.type == CONTROL_MOVE && frame.length >= 8 && frame.payload[0] < 4 && !queueCommand(slot, frame))
+  {
+    this->movesRefused++;
+    sendMoveDone(frame.payload[0], CONTROL_MOVE_CANCELLED);
+  }
+
+  // straight line move over every stepper channel, the same
+  if (frame.type == CONTROL_GROUP_MOVE && frame.length >= 19 && !queueCommand(slot, frame))
+  {
+    this->movesRefused++;
+    for (int i = 0; i < 4; i++)
+      sendMoveDone(i, CONTROL_MOVE_CANCELLED);
+  }
+
+  // path segments, queued by the control loop within the credit the client
+  // was given - any that can't get there are rejected in its next report
+  if (frame.type == CONTROL_SEGMENTS && !queueCommand(slot, frame))
+  {
+    this->dropped[slot] += frame.length / CONTROL_SEGMENT_SIZE;
+    this->segmentsDropped += frame.length / CONTROL_SEGMENT_SIZE;
+  }
+
+  //setup packet - channel, switched over by the control loop
+  if (frame.type == CONTROL_SETUP)
+  {
+    for (int i = 0; i < 4 && i < frame.length; i++)
+    {
+      this->channelSetup.mode[i] = frame.payload[i];
+      this->channelSetup.step[i] = (4 + i < frame.length) ? frame.payload[4 + i] : CONTROL_STEP_FULL;
+    }
+    this->setupMailbox.write() = this->channelSetup;
+    this->setupMailbox.publish();
+  }
+  return CONTROL_ACCEPT;
+}
+
+// A frame over to the control loop, false if the queue is full
+bool MotorControl::queueCommand(int slot, const ControlFrame &frame)
+{
+  MotorCommand *command = this->commands.write();
+  if (command == NULL)
+    return false;
+  command->slot = slot;
+  command->type = frame.type;
+  command->length = frame.length;
+  command->connection = this->connection[slot];
+  memcpy(command->payload, frame.payload, frame.length);
+  this->commands.publish();
+  return true;
+}
+
+bool MotorControl::step(int64_t now)
+{
+  // Channel switches first, so setpoints meet the new outputs
+  if (this->setupMailbox.read())
+    applyChannelSetup(this->setupMailbox.current(), now);
+
+  // Pick up the newest setpoints from the websocket task
+  bool fresh = this->setpointMailbox.read();
+  if (fresh)
+  {
+    const SetpointSnapshot &snapshot = this->setpointMailbox.current();
+    this->applyLatency.add((uint32_t)(now - snapshot.arrived));
+    applySetpoints(snapshot);
+  }
+
+  // Then the moves, after the setpoints that were already waiting, as
+  // long as their answers have somewhere to go
+  const MotorCommand *command;
+  while (this->replies.space() >= MOTOR_CONTROL_REPLY_ROOM && (command = this->commands.read()) != NULL)
+  {
+    runCommand(*command);
+    this->commands.release();
+  }
+  checkMoves();
+
+  // Steppers loop() found standing still, unless something has moved them since
+  uint8_t hold = __atomic_exchange_n(&this->holdPending, 0, __ATOMIC_ACQUIRE);
+  for (int i = 0; i < 4; i++)
+    if ((hold & (1 << i)) && this->channels[i].isStepper() && !this->steppers[i].isRunning() &&
+        this->steppers[i].reduceHold(this->holdPercent))
+      this->holdReductions++;
+
+  // Ramping happens in the timer interrupt, this only refreshes the reported speed
+  for (int i = 0; i < 4; i++)
+    if (this->channels[i].isStepper())
+      this->steppers[i].updateSpeed();
+  return fresh;
+}
+
+void MotorControl::reduceHold(uint8_t mask, int percent)
+{
+  this->holdPercent = percent;
+  __atomic_fetch_or(&this->holdPending, mask, __ATOMIC_RELEASE);
+}
+
+void MotorControl::runCommand(const MotorCommand &command)
+{
+  if (command.type == CONTROL_MOVE)
+    runMove(command);
+  else if (command.type == CONTROL_GROUP_MOVE)
+    runGroupMove(command);
+  else if (command.type == CONTROL_SEGMENTS)
+    runSegments(command);
+}
+
+// A position move for a stepper channel, in the control loop. Refused
+// when the channel isn't a stepper or a group move or path holds it.
+void MotorControl::runMove(const MotorCommand &command)
+{
+  int channel = command.payload[0];
+  if (!this->channels[channel].isStepper() || this->group.isMoving() || !this->segments.isIdle())
+  {
+    this->movesRefused++;
+    postMoveDone(channel, CONTROL_MOVE_CANCELLED);
+    return;
+  }
+  StepperTimer &stepper = this->steppers[channel];
+  int32_t steps = controlReadInt32(command.payload + 2);
+  long speed = controlReadInt16(command.payload + 6);
+  int32_t rate = stepperRate(speed == 0 ? CONTROL_SETPOINT_MAX : labs(speed));
+  unsigned long completed = stepper.movesCompleted;
+  if (command.payload[1] == CONTROL_MOVE_BY)
+    stepper.moveToRate(stepper.getPosition() + steps, rate);
+  else
+    stepper.moveToRate(steps, rate);
+  this->moveCompleted[channel] = completed;
+  this->moveActive[channel] = true;
+}
+
+// A straight line move over every stepper channel, in the control loop.
+// Refused with every channel cancelled while a group move or path runs,
+// or when an axis is busy with a move or speed of its own.
+void MotorControl::runGroupMove(const MotorCommand &command)
+{
+  long speed = controlReadInt16(command.payload + 1);
+  int32_t deltas[4];
+  int axes = 0;
+  int master = -1;
+  uint32_t longest = 0;
+  for (int i = 0; i < 4; i++)
+  {
+    deltas[i] = 0;
+    if (!this->channels[i].isStepper())
+      continue;
+    int32_t steps = controlReadInt32(command.payload + 3 + i*4);
+    deltas[i] = command.payload[0] == CONTROL_MOVE_BY ? steps : (int32_t)(steps - this->steppers[i].getPosition());
+    uint32_t length = deltas[i] < 0 ? 0 - (uint32_t)deltas[i] : (uint32_t)deltas[i];
+    if (master < 0 || length > longest)
+    {
+      master = i;
+      longest = length;
+    }
+    axes++;
+  }
+
+  // The speed is full steps/s of the longest axis, as for a single move,
+  // and the group's rate is in that axis' own steps
+  int64_t rate = stepperRate(speed == 0 ? CONTROL_SETPOINT_MAX : labs(speed));
+  if (master >= 0)
+    rate *= this->steppers[master].microsteps;
+  unsigned long completed = this->group.movesCompleted;
+  if (axes > 0 && !this->group.isMoving() && this->segments.isIdle() &&
+      this->group.moveBy(deltas, (uint32_t)(rate >> STEP_PLANNER_RATE_SHIFT)))
+  {
+    for (int i = 0; i < 4; i++)
+      this->groupMember[i] = this->channels[i].isStepper();
+    this->groupCompleted = completed;
+    this->groupActive = true;
+    return;
+  }
+  this->movesRefused++;
+  for (int i = 0; i < 4; i++)
+    postMoveDone(i, CONTROL_MOVE_CANCELLED);
+}
+
+// Path segments onto the queue, in the control loop, each against the
+// sender's credit. Those of a connection since closed are dropped.
+void MotorControl::runSegments(const MotorCommand &command)
+{
+  SegmentCredit &credit = this->credit[command.slot];
+  syncCredit(command.slot);
+  if (command.connection != credit.connection)
+    return;
+  for (int offset = 0; offset + CONTROL_SEGMENT_SIZE <= command.length; offset += CONTROL_SEGMENT_SIZE)
+  {
+    if (credit.unsent == 0)
+    {
+      credit.rejected++;
+      this->segmentsOverCredit++;
+      continue;
+    }
+    credit.unsent--;
+    const uint8_t *segment = command.payload + offset;
+    uint32_t feed = (uint16_t)controlReadInt16(segment);
+    int32_t deltas[4];
+    for (int i = 0; i < 4; i++)
+      deltas[i] = this->channels[i].isStepper() ? controlReadInt32(segment + 2 + i*4) : 0;
+    if (!this->segments.push(deltas, feed))
+      credit.rejected++;
+  }
+}
+
+// A slot's credit starts over with each connection, what the last one
+// held is free again
+void MotorControl::syncCredit(int slot)
+{
+  SegmentCredit &credit = this->credit[slot];
+  uint32_t connection = __atomic_load_n(&this->connection[slot], __ATOMIC_ACQUIRE);
+  if (connection == credit.connection)
+    return;
+  memset(&credit, 0, sizeof(credit));
+  credit.connection = connection;
+}
+
+/*
+ * Hands out the queue slots that are free and not promised yet, each open
+ * connection up to its share of the queue in granted but unsent segments,
+ * and reports to every client whose credit or rejections changed.
+ */
+void MotorControl::grantCredits()
+{
+  int open = 0;
+  int available = this->segments.free();
+  for (int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
+  {
+    syncCredit(i);
+    SegmentCredit &credit = this->credit[i];
+    // segments the websocket task had no room for were sent on credit too
+    unsigned long dropped = this->dropped[i];
+    if (dropped != credit.dropped)
+    {
+      uint32_t lost = dropped - credit.dropped;
+      credit.dropped = dropped;
+      credit.rejected += lost;
+      credit.unsent -= lost < credit.unsent ? lost : credit.unsent;
+    }
+    if (credit.connection & 1)
+      open++;
+    available -= credit.unsent;
+  }
+  if (open == 0)
+    return;
+
+  uint32_t share = SEGMENT_QUEUE_SIZE / open;
+  for (int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
+  {
+    SegmentCredit &credit = this->credit[i];
+    if (!(credit.connection & 1))
+      continue;
+    if (available > 0 && credit.unsent < share)
+    {
+      uint32_t grant = share - credit.unsent;
+      if (grant > (uint32_t)available)
+        grant = available;
+      credit.granted += grant;
+      credit.unsent += grant;
+      available -= grant;
+    }
+    // a report may wait, never at the expense of room for a command's replies
+    if ((!credit.reported || credit.granted != credit.reportedGranted || credit.rejected != credit.reportedRejected) &&
+        this->replies.space() > MOTOR_CONTROL_REPLY_ROOM)
+      postCredits(i);
+  }
+}
+
+// Moves that have ended, landed or cancelled, posted for loop() to send.
+// One that can't be posted yet is tried again next cycle.
+void MotorControl::checkMoves()
+{
+  for (int i = 0; i < 4; i++)
+  {
+    if (!this->moveActive[i] || this->steppers[i].isMoving())
+      continue;
+    if (postMoveDone(i, this->steppers[i].movesCompleted != this->moveCompleted[i] ? CONTROL_MOVE_REACHED : CONTROL_MOVE_CANCELLED))
+      this->moveActive[i] = false;
+  }
+
+  // halted by a channel switch if it didn't complete
+  if (this->groupActive && !this->group.isMoving() && this->replies.space() >= MOTOR_CONTROL_REPLY_ROOM)
+  {
+    this->groupActive = false;
+    bool reached = this->group.movesCompleted != this->groupCompleted;
+    for (int i = 0; i < 4; i++)
+      if (this->groupMember[i])
+        postMoveDone(i, reached ? CONTROL_MOVE_REACHED : CONTROL_MOVE_CANCELLED);
+  }
+
+  // Restart a path that ran dry just as more segments arrived, and hand
+  // the room of finished segments back out
+  this->segments.start();
+  grantCredits();
+}
+
+// A reply for loop() to send, false if the queue is full
+bool MotorControl::post(int slot, uint8_t type, const uint8_t *payload, uint8_t length)
+{
+  MotorReply *reply = this->replies.write();
+  if (reply == NULL)
+    return false;
+  reply->slot = slot;
+  reply->type = type;
+  reply->length = length;
+  reply->connection = slot >= 0 ? this->credit[slot].connection : 0;
+  memcpy(reply->payload, payload, length);
+  this->replies.publish();
+  return true;
+}
+
+// Switch the channels to a new setup, on the control side
+void MotorControl::applyChannelSetup(const ChannelSetup &setup, int64_t now)
+{
+  for (int i = 0; i < 4; i++)
+  {
+    int step = setup.step[i];
+    ChannelState state = CHANNEL_OFF;
+    StepperTimer::modeEnum mode = StepperTimer::full;
+    int microsteps = 1;
+    // a channel the board doesn't have stays off
+    if (!boardFitted(this->board, i))
+      state = CHANNEL_OFF;
+    else if (setup.mode[i] == 2)
+      state = CHANNEL_DC;
+    else if (setup.mode[i] == 1 && step >= CONTROL_STEP_MICRO_4 && step <= CONTROL_STEP_MICRO_32)
+    {
+      state = CHANNEL_MICROSTEP;
+      microsteps = 4 << (step - CONTROL_STEP_MICRO_4);
+    }
+    else if (setup.mode[i] == 1)
+    {
+      state = CHANNEL_STEPPER;
+      if (step == CONTROL_STEP_HALF)
+        mode = StepperTimer::half;
+      else if (step == CONTROL_STEP_WAVE)
+        mode = StepperTimer::wave;
+    }
+    if (!this->channels[i].changes(state, mode, microsteps))
+      continue;
+
+    // a coordinated move or path can't carry on with an axis switched away
+    if (this->channels[i].isStepper() && !this->segments.isIdle())
+      this->segments.clear();
+    this->channels[i].set(state, mode, microsteps);
+    if (this->recorder != NULL)
+      this->recorder->channel(i, this->channels[i].state, this->steppers[i].mode, this->steppers[i].microsteps, now);
+    if (this->switched != NULL)
+      this->switched(i, this->arg);
+  }
+}
+
+// Apply a setpoint snapshot, on the control side
+void MotorControl::applySetpoints(const SetpointSnapshot &snapshot)
+{
+  this->setpointsArrived = snapshot.arrived;
+  for (int i = 0; i < 8; i++)
+  {
+    this->setpoint[i] = snapshot.setpoint[i];
+    // an idle stick doesn't cancel a position move, moving it does
+    // and nothing interrupts a coordinated move or path
+    if (i < 4 && this->channels[i].isStepper() && this->group.isMoving())
+      continue;
+    if (i < 4 && this->channels[i].isStepper() && !(this->setpoint[i] == 0 && this->steppers[i].isMoving()))
+      this->steppers[i].setTargetRate(stepperRate(this->setpoint[i]));
+    if (this->channels[i & 3].isDC() && this->dcOutput != NULL)
+      this->dcOutput(i, this->setpoint[i], this->arg);
+  }
+}
+
+void MotorControl::recordChannels(int64_t now)
+{
+  for (int i = 0; i < 4; i++)
+    this->recorder->channel(i, this->channels[i].state, this->steppers[i].mode, this->steppers[i].microsteps, now);
+}
+
+// Tells a client how many segments it may have sent, and how many of its own were rejected
+bool MotorControl::postCredits(int slot)
+{
+  SegmentCredit &credit = this->credit[slot];
+  uint8_t payload[12];
+  controlWriteInt32(payload, (int32_t)credit.granted);
+  controlWriteInt32(payload + 4, (int32_t)this->segments.completed);
+  controlWriteInt32(payload + 8, (int32_t)credit.rejected);
+  if (!post(slot, CONTROL_CREDITS, payload, sizeof(payload)))
+    return false;
+  credit.reportedGranted = credit.granted;
+  credit.reportedRejected = credit.rejected;
+  credit.reported = true;
+  return true;
+}
+
+// Tells the clients about moves that have ended, landed or cancelled
+void MotorControl::moveDone(uint8_t *payload, int channel, uint8_t status)
+{
+  payload[0] = channel;
+  payload[1] = status;
+  controlWriteInt32(payload + 2, (int32_t)this->steppers[channel].getPosition());
+}
+
+void MotorControl::sendMoveDone(int channel, uint8_t status)
+{
+  uint8_t payload[6];
+  moveDone(payload, channel, status);
+  if (this->send != NULL)
+    this->send(MOTOR_CONTROL_ALL, CONTROL_MOVE_DONE, payload, sizeof(payload), this->arg);
+}
+
+bool MotorControl::postMoveDone(int channel, uint8_t status)
+{
+  uint8_t payload[6];
+  moveDone(payload, channel, status);
+  return post(MOTOR_CONTROL_ALL, CONTROL_MOVE_DONE, payload, sizeof(payload));
+}
+
+void MotorControl::notifyMoves()
+{
+  // A client's credit report only ever supersedes the last, so just the
+  // latest goes out, and nothing meant for a connection since closed
+  MotorReply credit[MOTOR_CONTROL_CLIENTS];
+  bool creditDue[MOTOR_CONTROL_CLIENTS];
+  memset(creditDue, 0, sizeof(creditDue));
+  const MotorReply *reply;
+  while ((reply = this->replies.read()) != NULL)
+  {
+    bool current = reply->slot < 0 || reply->connection == this->connection[reply->slot];
+    if (current && reply->type == CONTROL_CREDITS)
+    {
+      credit[reply->slot] = *reply;
+      creditDue[reply->slot] = true;
+    }
+    else if (current && this->send != NULL)
+      this->send(reply->slot, reply->type, reply->payload, reply->length, this->arg);
+    this->replies.release();
+  }
+  for (int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
+    if (creditDue[i] && this->send != NULL)
+      this->send(i, CONTROL_CREDITS, credit[i].payload, credit[i].length, this->arg);
+}
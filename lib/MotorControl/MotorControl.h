@@ -0,0 +1,228 @@
+/*
+ * MotorControl - control frames in, channel setups and setpoints out to
+ * the motors
+ *
+ * Everything between the websocket and the outputs that doesn't need the
+ * network: a decoder and ControlLink per client slot, the frame handling,
+ * and the channel setups and setpoint snapshots handed from the websocket
+ * task to the control loop through Mailboxes. Moves and path segments are
+ * commands, each run once, so they go over in order through a
+ * MessageQueue and only the control loop starts them or touches the
+ * segment queue; what became of them comes back the same way for loop()
+ * to send.
+ *
+ * Each client streams path segments within its own credit: a running
+ * total of segments it may have sent since it connected, so a credit
+ * report crossing segments on the way never hands the same slots out
+ * twice. Queue slots are only granted while they are free and not already
+ * promised to another client, each client holding at most its share of
+ * the queue, so a client keeping to its credit is never rejected. The firmware feeds it from its websocket events and
+ * control loop, the host replay feeds it a recorded session, so both run
+ * the same code.
+ *
+ *   websocket task:  connect(), disconnect(), handle() each decoded frame
+ *   control loop:    step() every cycle
+ *   loop():          notifyMoves() every pass, reduceHold()
+ *
+ * What it can't do itself is handed out through callbacks: a DC motor's
+ * setpoint goes to whichever driver or speed loop is behind it, a channel
+ * switch is reported once made, and replies to the clients (credits and
+ * move completions) are given as payloads for the caller to frame and
+ * send. It never logs, the caller does from what it is handed back.
+ */
+
+#ifndef MotorControl_h
+#define MotorControl_h
+
+#include "esp_types.h"
+#include "StepperTimer.h"
+#include "StepperGroup.h"
+#include "SegmentQueue.h"
+#include "MotorChannel.h"
+#include "ControlProtocol.h"
+#include "ControlLink.h"
+#include "Mailbox.h"
+#include "MessageQueue.h"
+#include "Histogram.h"
+#include "BoardProfile.h"
+#include "SessionRecorder.h"
+
+#define MOTOR_CONTROL_CLIENTS     8
+#define MOTOR_CONTROL_ALL         -1      // send() slot for every client
+// full steps/s a full scale setpoint asks of a stepper, where the old 255
+// speed steps topped out
+#define MOTOR_CONTROL_MAX_RATE    2125
+#define MOTOR_CONTROL_COMMANDS    8       // moves and segments waiting for the control loop
+#define MOTOR_CONTROL_REPLIES     16      // replies waiting for loop()
+// replies a command may post, it waits until there is room for them
+#define MOTOR_CONTROL_REPLY_ROOM  4
+#define MOTOR_REPLY_PAYLOAD       12
+
+/* Set from the web frontend, per channel...
+ * 0 = off
+ * 1 = stepper
+ * 2 = dc brushed x2
+ */
+struct ChannelSetup {
+  uint8_t mode[4];
+  uint8_t step[4];          // ControlStepMode of each stepper channel
+};
+
+// All channels in one snapshot, so they are never applied half old, half new
+struct SetpointSnapshot {
+  int16_t setpoint[CONTROL_CHANNELS];
+  uint16_t sequence;
+  int64_t arrived;          // us
+};
+
+// A frame for the control loop to run, from the slot that sent it
+struct MotorCommand {
+  int8_t slot;
+  uint8_t type;
+  uint16_t length;
+  uint32_t connection;      // the slot's connection it came in on
+  uint8_t payload[CONTROL_MAX_PAYLOAD];
+};
+
+// A reply from the control loop, for a slot or MOTOR_CONTROL_ALL
+struct MotorReply {
+  int8_t slot;
+  uint8_t type;
+  uint8_t length;
+  uint32_t connection;      // the slot's connection it is for
+  uint8_t payload[MOTOR_REPLY_PAYLOAD];
+};
+
+// A client's share of the segment queue, kept by the control loop
+struct SegmentCredit {
+  uint32_t connection;      // the slot's connection it belongs to, odd while open
+  uint32_t granted;         // segments it may have sent since connecting
+  uint32_t unsent;          // of those, not arrived yet
+  uint32_t rejected;        // segments refused since connecting
+  unsigned long dropped;    // of the websocket task's count, taken into account
+  uint32_t reportedGranted; // as last posted
+  uint32_t reportedRejected;
+  bool reported;
+};
+
+// A DC motor's setpoint (+/- CONTROL_SETPOINT_MAX), in the control loop
+typedef void (*MotorControlDCOutput)(int motor, long setpoint, void *arg);
+// A channel has been switched over, in the control loop
+typedef void (*MotorControlSwitched)(int channel, void *arg);
+// A reply for one client slot, or MOTOR_CONTROL_ALL, to frame and send
+typedef void (*MotorControlSend)(int slot, uint8_t type, const uint8_t *payload, uint16_t length, void *arg);
+
+class MotorControl {
+  public:
+    // Four of each, in channel order. The group holds the four steppers and
+    // the queue runs on it.
+    MotorControl(const BoardProfile &board, StepperTimer *steppers, MotorChannel *channels,
+                 StepperGroup &group, SegmentQueue &segments);
+    void setOutputs(MotorControlDCOutput dcOutput, MotorControlSwitched switched, MotorControlSend send, void *arg);
+    // Frames, connections and channel switches are recorded while it is
+    void setRecorder(SessionRecorder *recorder) { this->recorder = recorder; }
+    // Setpoints older than this on arrival are dropped rather than applied late
+    void setMaxAge(uint32_t ms) { this->maxAge = ms; }
+
+    // A client slot opening and closing, now in us
+    void connect(int slot, int64_t now);
+    void disconnect(int slot, int64_t now);
+    // A frame decoded from a slot's stream, now in us and ms of the device
+    // clock. Setpoints not applied say why, everything else is accepted.
+    ControlVerdict handle(int slot, const ControlFrame &frame, int64_t now, uint32_t nowMs);
+
+    // One control loop cycle: switches channels, applies the newest
+    // setpoints, runs the commands waiting, keeps a path going and notes
+    // moves and segments that have finished. True if there were new
+    // setpoints.
+    bool step(int64_t now);
+
+    // Sends the move completions and credit the control loop has posted
+    void notifyMoves();
+    // Steppers (a bit per channel) to turn down to percent of full current,
+    // from loop(), done by the next step()
+    void reduceHold(uint8_t mask, int percent);
+
+    // Every channel's state into the recorder, for a log to start from
+    void recordChannels(int64_t now);
+
+    // Whether a frame asks for anything - a keepalive of idle sticks doesn't
+    static bool isCommand(const ControlFrame &frame);
+    // A setpoint as a planner rate, Q24.8 full steps/s
+    static int32_t stepperRate(long setpoint);
+
+    ControlDecoder decoders[MOTOR_CONTROL_CLIENTS];
+    ControlLink links[MOTOR_CONTROL_CLIENTS];
+    // Setpoints as last applied, and when they arrived (us)
+    int setpoint[CONTROL_CHANNELS];
+    int64_t setpointsArrived;
+
+    // statistics
+    Histogram roundTrip;        // us
+    Histogram applyLatency;     // us from setpoints arriving to the control loop applying them
+    unsigned long setpointsAccepted;
+    unsigned long setpointsOutOfOrder;
+    unsigned long setpointsExpired;
+    unsigned long movesRefused;     // moves with the axes busy or no room to queue them
+    unsigned long segmentsDropped;  // segments with no room to queue them
+    unsigned long segmentsOverCredit; // segments sent beyond a client's credit
+    unsigned long holdReductions;   // steppers standing still turned down to holding current
+
+  private:
+    void applyChannelSetup(const ChannelSetup &setup, int64_t now);
+    void applySetpoints(const SetpointSnapshot &snapshot);
+    bool queueCommand(int slot, const ControlFrame &frame);
+    void runCommand(const MotorCommand &command);
+    void runMove(const MotorCommand &command);
+    void runGroupMove(const MotorCommand &command);
+    void runSegments(const MotorCommand &command);
+    void checkMoves();
+    bool post(int slot, uint8_t type, const uint8_t *payload, uint8_t length);
+    void syncCredit(int slot);
+    void grantCredits();
+    bool postCredits(int slot);
+    // the payload of a MOVE_DONE, and sent from either side
+    void moveDone(uint8_t *payload, int channel, uint8_t status);
+    void sendMoveDone(int channel, uint8_t status);
+    bool postMoveDone(int channel, uint8_t status);
+
+    const BoardProfile &board;
+    StepperTimer *steppers;
+    MotorChannel *channels;
+    StepperGroup &group;
+    SegmentQueue &segments;
+    SessionRecorder *recorder;
+    uint32_t maxAge;
+
+    MotorControlDCOutput dcOutput;
+    MotorControlSwitched switched;
+    MotorControlSend send;
+    void *arg;
+
+    ChannelSetup channelSetup;      // as last sent, in the websocket task
+    Mailbox<ChannelSetup> setupMailbox;
+    Mailbox<SetpointSnapshot> setpointMailbox;
+    MessageQueue<MotorCommand, MOTOR_CONTROL_COMMANDS> commands;
+    MessageQueue<MotorReply, MOTOR_CONTROL_REPLIES> replies;
+
+    // Position moves in flight, in the control loop, reported back to the
+    // clients when they end - moveCompleted holds the stepper's
+    // movesCompleted from when each started
+    bool moveActive[4];
+    unsigned long moveCompleted[4];
+    // Coordinated moves over the stepper channels, in the control loop
+    bool groupMember[4];
+    bool groupActive;
+    unsigned long groupCompleted;
+    // Each slot's connection, counted up by the websocket task on connect
+    // and disconnect so it is odd while open, and the segments it had no
+    // room to queue
+    volatile uint32_t connection[MOTOR_CONTROL_CLIENTS];
+    volatile unsigned long dropped[MOTOR_CONTROL_CLIENTS];
+    SegmentCredit credit[MOTOR_CONTROL_CLIENTS];
+    // holding current reductions asked for by loop(), taken by the control loop
+    uint8_t holdPending;
+    volatile int holdPercent;
+};
+
+#endif
@@ -0,0 +1,176 @@
+/*
+ * PowerManager - idle policy, see PowerManager.h
+ */
+
+#include "PowerManager.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+
+#define POWER_HOLD_MS   500
+#define POWER_IDLE_MS   5000
+
+PowerManager::PowerManager()
+{
+  this->cpuLock = NULL;
+  this->holdUs = POWER_HOLD_MS * 1000LL;
+  this->idleUs = POWER_IDLE_MS * 1000LL;
+  for (int i = 0; i < POWER_MAX_AXES; i++)
+    this->stillSince[i] = 0;
+  this->held = 0;
+  this->lastActivity = 0;
+  this->idleSince = 0;
+  this->idleTotal = 0;
+  this->idle = false;
+  this->cpuIdle = false;
+  this->radioIdle = -1;
+  this->switching = false;
+  this->idles = 0;
+  this->wakes = 0;
+  this->radioErrors = 0;
+  portMUX_TYPE unlocked = portMUX_INITIALIZER_UNLOCKED;
+  this->mux = unlocked;
+}
+
+bool PowerManager::begin(int maxMhz, int minMhz)
+{
+  esp_pm_config_esp32_t config;
+  config.max_freq_mhz = maxMhz;
+  config.min_freq_mhz = minMhz;
+  config.light_sleep_enable = false;
+  if (esp_pm_configure(&config) != ESP_OK)
+    return false;
+  if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "active", &this->cpuLock) != ESP_OK)
+  {
+    this->cpuLock = NULL;
+    return false;
+  }
+  // awake until the first idle timeout
+  esp_pm_lock_acquire(this->cpuLock);
+  this->cpuIdle = false;
+  return true;
+}
+
+void PowerManager::setTimeouts(uint32_t holdMs, uint32_t idleMs)
+{
+  this->holdUs = holdMs * 1000LL;
+  this->idleUs = idleMs * 1000LL;
+}
+
+bool PowerManager::activity(int64_t now)
+{
+  bool woke = false;
+  portENTER_CRITICAL(&this->mux);
+  this->lastActivity = now;
+  if (this->idle)
+  {
+    this->idle = false;
+    this->idleTotal += now - this->idleSince;
+    this->wakes++;
+    woke = true;
+  }
+  portEXIT_CRITICAL(&this->mux);
+  if (woke)
+    settle();
+  return woke;
+}
+
+uint8_t PowerManager::update(uint8_t moved, bool busy, int64_t now)
+{
+  uint8_t reduce = 0;
+  for (int i = 0; i < POWER_MAX_AXES; i++)
+  {
+    uint8_t bit = 1 << i;
+    if (moved & bit)
+    {
+      this->stillSince[i] = now;
+      this->held &= ~bit;
+    }
+    else if (!(this->held & bit) && now - this->stillSince[i] >= this->holdUs)
+    {
+      this->held |= bit;
+      reduce |= bit;
+    }
+  }
+
+  // Something moving keeps it awake as a command would
+  if (moved || busy)
+  {
+    activity(now);
+    return reduce;
+  }
+
+  bool sleep = false;
+  portENTER_CRITICAL(&this->mux);
+  if (!this->idle && now - this->lastActivity >= this->idleUs)
+  {
+    this->idle = true;
+    this->idleSince = now;
+    this->idles++;
+    sleep = true;
+  }
+  portEXIT_CRITICAL(&this->mux);
+  if (sleep)
+    settle();
+  return reduce;
+}
+
+void PowerManager::radioUp()
+{
+  portENTER_CRITICAL(&this->mux);
+  this->radioIdle = -1;
+  portEXIT_CRITICAL(&this->mux);
+  settle();
+}
+
+uint64_t PowerManager::idleTime(int64_t now)
+{
+  portENTER_CRITICAL(&this->mux);
+  uint64_t total = this->idleTotal;
+  if (this->idle)
+    total += now - this->idleSince;
+  portEXIT_CRITICAL(&this->mux);
+  return total;
+}
+
+/*
+ * Brings the CPU lock and the radio round to the state wanted, until it
+ * stops changing. Only one task switches at a time, the lock and the
+ * WiFi driver can't be called from inside a critical section.
+ */
+void PowerManager::settle()
+{
+  for (;;)
+  {
+    portENTER_CRITICAL(&this->mux);
+    bool idle = this->idle;
+    if (this->switching || (idle == this->cpuIdle && this->radioIdle == idle))
+    {
+      portEXIT_CRITICAL(&this->mux);
+      return;
+    }
+    this->switching = true;
+    bool cpu = idle != this->cpuIdle;
+    bool radio = this->radioIdle != idle;
+    portEXIT_CRITICAL(&this->mux);
+
+    int64_t start = esp_timer_get_time();
+    if (cpu && this->cpuLock != NULL)
+    {
+      if (idle)
+        esp_pm_lock_release(this->cpuLock);
+      else
+        esp_pm_lock_acquire(this->cpuLock);
+    }
+    // refused before WiFi is up, radioUp() tries again then
+    if (radio && esp_wifi_set_ps(idle ? WIFI_PS_MIN_MODEM : WIFI_PS_NONE) != ESP_OK)
+      this->radioErrors++;
+    if (cpu && !idle)
+      this->wakeTime.add((uint32_t)(esp_timer_get_time() - start));
+
+    portENTER_CRITICAL(&this->mux);
+    this->cpuIdle = idle;
+    this->radioIdle = idle;
+    this->switching = false;
+    portEXIT_CRITICAL(&this->mux);
+  }
+}
@@ -0,0 +1,92 @@
+/*
+ * PowerManager - idle policy for battery rigs: holding current, CPU clock
+ * and radio sleep
+ *
+ * Two timeouts run from when things stop:
+ *
+ *   holdMs   after an axis stands still this long its holding current
+ *            should be turned down - update() hands back which axes, the
+ *            caller has the motors to do it
+ *   idleMs   after this long with no command arriving and nothing moving
+ *            or driven, the device goes idle: the lock holding the CPU at
+ *            its top clock is released, so power management lets it drop
+ *            to the bottom one, and the radio goes into modem sleep
+ *
+ * The next command wakes it straight away from whichever task decoded it,
+ * taking the lock and waking the radio before the command is handled. A
+ * keepalive isn't a command, the caller decides which frames are.
+ *
+ * The bottom clock should stay at 80MHz or above: the APB clock, and the
+ * step timers on it, follow the CPU clock below that.
+ *
+ * The switching is done outside the lock, by whichever task finds the
+ * hardware behind the state; a task arriving mid switch leaves the new
+ * state for that one to apply, so the CPU lock always stays balanced.
+ *
+ * Transitions are counted and timed, and the age of the commands that woke
+ * it is kept apart from those arriving awake, to show what the radio
+ * sleeping costs in latency.
+ */
+
+#ifndef PowerManager_h
+#define PowerManager_h
+
+#include "esp_types.h"
+#include "freertos/FreeRTOS.h"
+#include "esp_pm.h"
+#include "Histogram.h"
+
+#define POWER_MAX_AXES  8
+
+class PowerManager {
+  public:
+    PowerManager();
+
+    // Configures the clock range in MHz and takes the lock keeping it at
+    // the top. False if power management isn't in the build, the clock
+    // then stays where it is and only the radio sleeps.
+    bool begin(int maxMhz, int minMhz);
+    void setTimeouts(uint32_t holdMs, uint32_t idleMs);
+
+    // A command arrived, now in us: wakes at once if idle. True if it did.
+    bool activity(int64_t now);
+    // Called periodically with a bit for each axis that moved since the
+    // last call, and whether any other output is being driven. Returns
+    // the axes that have now stood still for the hold timeout.
+    uint8_t update(uint8_t moved, bool busy, int64_t now);
+    // WiFi came up, it takes the radio sleep mode of the state from now
+    void radioUp();
+
+    bool isIdle() { return this->idle; }
+    bool isScaling() { return this->cpuLock != NULL; }
+    // Total us spent idle, up to now
+    uint64_t idleTime(int64_t now);
+
+    // statistics
+    volatile unsigned long idles;
+    volatile unsigned long wakes;
+    unsigned long radioErrors;  // sleep modes the WiFi driver refused
+    Histogram wakeTime;         // us taken to wake the CPU and radio
+    Histogram wakeAge;          // us, age of the setpoints that woke it
+    Histogram activeAge;        // us, age of those arriving awake
+
+  private:
+    void settle();
+
+    esp_pm_lock_handle_t cpuLock;
+    int64_t holdUs;
+    int64_t idleUs;
+    int64_t stillSince[POWER_MAX_AXES];
+    uint8_t held;               // axes already handed back for reducing
+    int64_t lastActivity;       // last command or anything moving
+    int64_t idleSince;
+    uint64_t idleTotal;
+
+    volatile bool idle;         // the state wanted
+    bool cpuIdle;               // what the CPU lock was last left at
+    int8_t radioIdle;           // and the radio, -1 when not known
+    bool switching;
+    portMUX_TYPE mux;
+};
+
+#endif
@@ -0,0 +1,78 @@
+/*
+ * QuadratureEncoder - PCNT quadrature counting, see QuadratureEncoder.h
+ */
+
+#include "QuadratureEncoder.h"
+
+QuadratureEncoder::QuadratureEncoder(pcnt_unit_t unit, int pinA, int pinB)
+{
+  this->unit = unit;
+  this->pinA = pinA;
+  this->pinB = pinB;
+  this->enabled = false;
+  this->count = 0;
+  this->rate = 0;
+  this->filterShift = 3;
+  this->last = 0;
+  this->rateFiltered = 0;
+}
+
+bool QuadratureEncoder::begin()
+{
+  if (this->pinA < 0 || this->pinB < 0)
+    return false;
+
+  // channel 0 counts A edges, reversed while B is low, and channel 1 counts
+  // B edges the opposite way round
+  pcnt_config_t config;
+  config.unit = this->unit;
+  config.counter_h_lim = QUADRATURE_ENCODER_WRAP;
+  config.counter_l_lim = -QUADRATURE_ENCODER_WRAP;
+
+  config.channel = PCNT_CHANNEL_0;
+  config.pulse_gpio_num = this->pinA;
+  config.ctrl_gpio_num = this->pinB;
+  config.pos_mode = PCNT_COUNT_DEC;
+  config.neg_mode = PCNT_COUNT_INC;
+  config.lctrl_mode = PCNT_MODE_REVERSE;
+  config.hctrl_mode = PCNT_MODE_KEEP;
+  pcnt_unit_config(&config);
+
+  config.channel = PCNT_CHANNEL_1;
+  config.pulse_gpio_num = this->pinB;
+  config.ctrl_gpio_num = this->pinA;
+  config.pos_mode = PCNT_COUNT_INC;
+  config.neg_mode = PCNT_COUNT_DEC;
+  pcnt_unit_config(&config);
+
+  pcnt_set_filter_value(this->unit, QUADRATURE_ENCODER_FILTER);
+  pcnt_filter_enable(this->unit);
+  pcnt_counter_pause(this->unit);
+  pcnt_counter_clear(this->unit);
+  pcnt_counter_resume(this->unit);
+
+  this->last = 0;
+  this->count = 0;
+  this->rate = 0;
+  this->rateFiltered = 0;
+  this->enabled = true;
+  return true;
+}
+
+void QuadratureEncoder::sample(uint32_t rateHz)
+{
+  int16_t counter;
+  pcnt_get_counter_value(this->unit, &counter);
+  int32_t delta = counter - this->last;
+  if (delta > QUADRATURE_ENCODER_WRAP / 2)
+    delta -= QUADRATURE_ENCODER_WRAP;
+  else if (delta < -QUADRATURE_ENCODER_WRAP / 2)
+    delta += QUADRATURE_ENCODER_WRAP;
+  this->last = counter;
+  this->count += delta;
+
+  // One count per sample is a rate of rateHz, average out the quantisation
+  int64_t instant = (int64_t)delta * rateHz << 8;
+  this->rateFiltered += (instant - this->rateFiltered) >> this->filterShift;
+  this->rate = (int32_t)(this->rateFiltered >> 8);
+}
@@ -0,0 +1,45 @@
+/*
+ * QuadratureEncoder - counts a quadrature encoder on one PCNT unit
+ *
+ * Both PCNT channels of the unit count, each on one signal with the other
+ * as its direction control, so every edge of A and B is counted (x4).
+ *
+ * The hardware counter is 16 bits and resets to 0 when it reaches either
+ * limit, which leaves it counting modulo QUADRATURE_ENCODER_WRAP. sample()
+ * reads it at a fixed rate and takes the difference modulo the same, so no
+ * overflow interrupt is needed as long as fewer than half that many counts
+ * arrive between samples.
+ */
+
+#ifndef QuadratureEncoder_h
+#define QuadratureEncoder_h
+
+#include "esp_types.h"
+#include "driver/pcnt.h"
+
+#define QUADRATURE_ENCODER_WRAP    32000
+#define QUADRATURE_ENCODER_FILTER  100    // glitch filter, APB cycles (1.25us)
+
+class QuadratureEncoder {
+  public:
+    // pins of -1 leave the encoder disabled
+    QuadratureEncoder(pcnt_unit_t unit, int pinA, int pinB);
+    bool begin();
+    bool isEnabled() { return this->enabled; }
+    // Reads the counter, call at rateHz
+    void sample(uint32_t rateHz);
+
+    volatile int32_t count;   // counts since begin()
+    volatile int32_t rate;    // counts/s, averaged over about 2^filterShift samples
+    int filterShift;
+
+  private:
+    pcnt_unit_t unit;
+    int pinA;
+    int pinB;
+    bool enabled;
+    int16_t last;             // counter at the previous sample
+    int64_t rateFiltered;     // rate in Q8
+};
+
+#endif
@@ -0,0 +1,193 @@
+/*
+ * SegmentQueue - streamed segments with lookahead, see SegmentQueue.h
+ */
+
+#include <math.h>
+#include "SegmentQueue.h"
+
+#define SEGMENT_MASK (SEGMENT_QUEUE_SIZE - 1)
+
+SegmentQueue::SegmentQueue(StepperGroup &group) : group(group)
+{
+  this->head = 0;
+  this->tail = 0;
+  this->running = false;
+  this->completed = 0;
+  this->rejected = 0;
+  this->cancelled = 0;
+  setLimits(4000, 2);
+  group.setNext(onNext, this);
+}
+
+void SegmentQueue::setLimits(float acceleration, float junctionDeviation)
+{
+  this->acceleration = acceleration;
+  this->junctionDeviation = junctionDeviation;
+  this->group.setAcceleration((unsigned long)acceleration, 0);
+}
+
+int SegmentQueue::free()
+{
+  return SEGMENT_QUEUE_SIZE - (int)(this->tail - this->head);
+}
+
+bool SegmentQueue::push(const int32_t *deltas, uint32_t feed)
+{
+  if (free() <= 0 || feed == 0)
+  {
+    this->rejected++;
+    return false;
+  }
+
+  MotionSegment &segment = this->segments[this->tail & SEGMENT_MASK];
+  float length = 0;
+  uint32_t master = 0;
+  int masterAxis = 0;
+  for (int i = 0; i < STEPPER_GROUP_MAX_AXES; i++)
+  {
+    segment.delta[i] = deltas[i];
+    length += (float)deltas[i] * deltas[i];
+    uint32_t steps = deltas[i] >= 0 ? deltas[i] : -deltas[i];
+    if (steps > master)
+    {
+      master = steps;
+      masterAxis = i;
+    }
+  }
+  length = sqrtf(length);
+  if (master == 0)
+    return true;
+
+  segment.length = length;
+  segment.scale = master / length;
+  segment.nominal = feed;
+  segment.accel = this->acceleration * this->group.microsteps(masterAxis) / segment.scale;
+  for (int i = 0; i < STEPPER_GROUP_MAX_AXES; i++)
+    segment.unit[i] = deltas[i] / length;
+  segment.cruise = (int32_t)(feed * segment.scale * (1 << STEP_PLANNER_RATE_SHIFT));
+  segment.exitRate = 0;
+  segment.entry = 0;
+
+  // Junction with the segment queued before, if it hasn't finished yet
+  segment.maxEntry = 0;
+  segment.carry = 1 << 16;
+  if (this->tail != this->head)
+  {
+    const MotionSegment &previous = this->segments[(this->tail - 1) & SEGMENT_MASK];
+    float cosine = 0;
+    for (int i = 0; i < STEPPER_GROUP_MAX_AXES; i++)
+      cosine -= previous.unit[i] * segment.unit[i];
+    // cosine is -1 going straight on, +1 for a full reversal
+    if (cosine < 0.999f)
+    {
+      float accel = segment.accel > previous.accel ? segment.accel : previous.accel;
+      if (cosine < -0.999f)
+      {
+        segment.maxEntry = 1e9f;
+      }
+      else
+      {
+        float sinHalf = sqrtf(0.5f * (1.0f - cosine));
+        segment.maxEntry = sqrtf(accel * this->junctionDeviation * sinHalf / (1.0f - sinHalf));
+      }
+    }
+    segment.carry = (uint32_t)(segment.scale / previous.scale * 65536.0f);
+  }
+
+  __sync_synchronize();
+  this->tail++;
+  replan();
+  start();
+  return true;
+}
+
+/*
+ * Backward pass from the last segment, which must be able to stop, then a
+ * forward pass from the segment being run; each segment's exit rate is
+ * the next one's entry speed in its own master axis units.
+ */
+void SegmentQueue::replan()
+{
+  uint32_t first = this->head;
+  uint32_t last = this->tail;
+  if (first == last)
+    return;
+
+  float exit = 0;
+  for (uint32_t i = last; i-- != first + 1;)
+  {
+    MotionSegment &segment = this->segments[i & SEGMENT_MASK];
+    float accel = segment.accel;
+    float entry = sqrtf(exit * exit + 2 * accel * segment.length);
+    if (entry > segment.maxEntry)
+      entry = segment.maxEntry;
+    if (entry > segment.nominal)
+      entry = segment.nominal;
+    segment.entry = entry;
+    exit = entry;
+  }
+
+  for (uint32_t i = first; i != last; i++)
+  {
+    MotionSegment &segment = this->segments[i & SEGMENT_MASK];
+    float exitSpeed = 0;
+    if (i + 1 != last)
+    {
+      MotionSegment &following = this->segments[(i + 1) & SEGMENT_MASK];
+      float accel = segment.accel;
+      float reachable = sqrtf(segment.entry * segment.entry + 2 * accel * segment.length);
+      if (following.entry > reachable)
+        following.entry = reachable;
+      exitSpeed = following.entry;
+    }
+    int32_t exitRate = (int32_t)(exitSpeed * segment.scale * (1 << STEP_PLANNER_RATE_SHIFT));
+    segment.exitRate = exitRate;
+    // the segment being run already has its exit rate loaded in the group
+    if (i == first && this->running && this->head == first)
+      this->group.setExitRate(exitRate);
+  }
+}
+
+void SegmentQueue::start()
+{
+  if (this->group.isMoving() || this->head == this->tail)
+    return;
+  const MotionSegment &segment = this->segments[this->head & SEGMENT_MASK];
+  this->running = true;
+  if (!this->group.begin(segment.delta, segment.cruise, segment.exitRate))
+    this->running = false;
+}
+
+void SegmentQueue::clear()
+{
+  // the interrupt is done with the queue once the group has halted
+  this->group.halt();
+  this->running = false;
+  this->cancelled += this->tail - this->head;
+  this->head = this->tail;
+}
+
+bool IRAM_ATTR SegmentQueue::onNext(StepperGroup &group, void *arg)
+{
+  return ((SegmentQueue *)arg)->next();
+}
+
+// The group finished the head segment, chain the one after it
+bool IRAM_ATTR SegmentQueue::next()
+{
+  if (!this->running)
+    return false;
+  this->head++;
+  this->completed++;
+  while (this->head != this->tail)
+  {
+    const MotionSegment &segment = this->segments[this->head & SEGMENT_MASK];
+    if (this->group.chain(segment.delta, segment.cruise, segment.exitRate, segment.carry))
+      return true;
+    // nothing to step on the group's axes, skip it
+    this->head++;
+    this->completed++;
+  }
+  this->running = false;
+  return false;
+}
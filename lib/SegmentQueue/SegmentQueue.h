@@ -0,0 +1,91 @@
+/*
+ * SegmentQueue - streamed straight line segments with lookahead
+ *
+ * Segments (a step delta per axis and a feed rate along the path) are
+ * queued from the control loop and run back to back by a StepperGroup,
+ * chained from its interrupt so there is no gap between them. push(),
+ * start() and clear() are all called from that one task.
+ *
+ * Every push replans the queue, as grbl does: each junction gets a maximum
+ * speed from the angle between its segments (junction deviation), a
+ * backward pass limits every entry speed to what can still brake to a stop
+ * by the end of the queue, and a forward pass to what can be reached from
+ * the segment being run. The group then brakes each segment only as far as
+ * the next one's entry speed.
+ *
+ * Speeds are planned along the path in steps/s with floats, outside the
+ * interrupt. Each axis is held to the acceleration limit, so the path may
+ * accelerate faster when several axes share the motion.
+ *
+ * The queue is bounded; free() is the sender's credit. A push without
+ * credit is rejected and counted, never blocks.
+ */
+
+#ifndef SegmentQueue_h
+#define SegmentQueue_h
+
+#include "esp_attr.h"
+#include "esp_types.h"
+#include "StepperGroup.h"
+
+#define SEGMENT_QUEUE_SIZE 16     // power of two
+
+struct MotionSegment {
+  int32_t delta[STEPPER_GROUP_MAX_AXES];
+
+  // planning, path units
+  float unit[STEPPER_GROUP_MAX_AXES];   // direction
+  float length;             // steps along the path
+  float scale;              // master axis steps per path step
+  float nominal;            // feed, steps/s
+  float accel;              // the master axis' limit along the path, steps/s^2
+  float maxEntry;           // junction limit with the previous segment
+  float entry;              // planned entry speed
+
+  // execution, master axis Q24.8 steps/s
+  int32_t cruise;
+  volatile int32_t exitRate;
+  uint32_t carry;           // Q16, previous segment's master rate -> this one's
+};
+
+class SegmentQueue {
+  public:
+    SegmentQueue(StepperGroup &group);
+
+    // Per axis acceleration in full steps/s^2, scaled by the master axis'
+    // microsteps for each segment as a StepperTimer does, junction
+    // deviation in steps
+    void setLimits(float acceleration, float junctionDeviation);
+
+    // Queues a segment and replans, false if there is no credit
+    bool push(const int32_t *deltas, uint32_t feed);
+    // Starts the group on the queue if it is idle with segments waiting
+    void start();
+    // Halts the group and drops every queued segment
+    void clear();
+
+    // Free slots, the sender's credit
+    int free();
+    bool isIdle() { return this->head == this->tail && !this->group.isMoving(); }
+
+    // statistics
+    volatile unsigned long completed;
+    unsigned long rejected;
+    unsigned long cancelled;  // dropped by clear()
+
+  private:
+    static bool onNext(StepperGroup &group, void *arg);
+    bool next();
+    void replan();
+
+    StepperGroup &group;
+    MotionSegment segments[SEGMENT_QUEUE_SIZE];
+    volatile uint32_t head;   // segment being run, advanced by the interrupt
+    volatile uint32_t tail;   // next free slot, advanced by push()
+    bool running;             // the group is running our segments
+
+    float acceleration;       // full steps/s^2
+    float junctionDeviation;
+};
+
+#endif
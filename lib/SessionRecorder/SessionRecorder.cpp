@@ -0,0 +1,210 @@
+/*
+ * SessionRecorder - control stream capture and read back, see SessionRecorder.h
+ */
+
+#include "SessionRecorder.h"
+#include <string.h>
+
+static const uint8_t sessionMagic[4] = { 'S', 'R', 'E', 'C' };
+
+static size_t writeVarint(uint8_t *out, uint32_t value)
+{
+  size_t length = 0;
+  while (value >= 0x80)
+  {
+    out[length++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  out[length++] = (uint8_t)value;
+  return length;
+}
+
+SessionRecorder::SessionRecorder()
+{
+  this->used = 0;
+  this->last = 0;
+  this->recording = false;
+  this->records = 0;
+  this->dropped = 0;
+  portMUX_TYPE unlocked = portMUX_INITIALIZER_UNLOCKED;
+  this->mux = unlocked;
+}
+
+void SessionRecorder::start(uint16_t controlRateHz, int64_t now, uint32_t nowMs)
+{
+  portENTER_CRITICAL(&this->mux);
+  memcpy(this->buffer, sessionMagic, sizeof(sessionMagic));
+  this->buffer[4] = SESSION_VERSION;
+  this->buffer[5] = 0;
+  this->buffer[6] = controlRateHz & 0xFF;
+  this->buffer[7] = controlRateHz >> 8;
+  controlWriteInt32(this->buffer + 8, (int32_t)nowMs);
+  this->used = SESSION_HEADER_SIZE;
+  this->last = now;
+  this->records = 0;
+  this->dropped = 0;
+  this->recording = true;
+  portEXIT_CRITICAL(&this->mux);
+}
+
+void SessionRecorder::stop()
+{
+  this->recording = false;
+}
+
+/*
+ * Times go down as the gap from the previous record. The two recording
+ * tasks read the clock before taking the lock, so one can arrive a little
+ * behind the other, it is then stored at the time of the one before.
+ */
+bool SessionRecorder::append(uint8_t kind, int64_t now, const uint8_t *head, size_t headLength,
+                             const uint8_t *payload, size_t length)
+{
+  if (!this->recording)
+    return false;
+
+  uint8_t record[1 + 5];
+  bool stored = false;
+  portENTER_CRITICAL(&this->mux);
+  int64_t gap = now - this->last;
+  if (gap < 0)
+    gap = 0;
+  else if (gap > 0xFFFFFFFFLL)
+    gap = 0xFFFFFFFFLL;
+  record[0] = kind;
+  size_t prefix = 1 + writeVarint(record + 1, (uint32_t)gap);
+  if (this->used + prefix + headLength + length <= SESSION_RECORDER_BYTES)
+  {
+    uint8_t *out = this->buffer + this->used;
+    memcpy(out, record, prefix);
+    memcpy(out + prefix, head, headLength);
+    if (length > 0)
+      memcpy(out + prefix + headLength, payload, length);
+    this->used += prefix + headLength + length;
+    this->last += gap;
+    this->records++;
+    stored = true;
+  }
+  else
+    this->dropped++;
+  portEXIT_CRITICAL(&this->mux);
+  return stored;
+}
+
+bool SessionRecorder::frame(int client, const ControlFrame &frame, int64_t now)
+{
+  uint8_t head[5];
+  head[0] = (uint8_t)client;
+  head[1] = frame.type;
+  head[2] = frame.sequence & 0xFF;
+  head[3] = frame.sequence >> 8;
+  head[4] = (uint8_t)frame.length;
+  return append(SESSION_FRAME, now, head, sizeof(head), frame.payload, frame.length);
+}
+
+bool SessionRecorder::connect(int client, int64_t now)
+{
+  uint8_t head = (uint8_t)client;
+  return append(SESSION_CONNECT, now, &head, 1, NULL, 0);
+}
+
+bool SessionRecorder::disconnect(int client, int64_t now)
+{
+  uint8_t head = (uint8_t)client;
+  return append(SESSION_DISCONNECT, now, &head, 1, NULL, 0);
+}
+
+bool SessionRecorder::channel(int channel, int state, int mode, int microsteps, int64_t now)
+{
+  uint8_t head[4] = { (uint8_t)channel, (uint8_t)state, (uint8_t)mode, (uint8_t)microsteps };
+  return append(SESSION_CHANNEL, now, head, sizeof(head), NULL, 0);
+}
+
+SessionReader::SessionReader(const uint8_t *data, size_t size)
+{
+  this->data = data;
+  this->size = size;
+  this->offset = SESSION_HEADER_SIZE;
+  this->time = 0;
+  this->truncated = false;
+  this->controlRateHz = 0;
+  this->startMs = 0;
+  if (size >= SESSION_HEADER_SIZE && memcmp(data, sessionMagic, sizeof(sessionMagic)) == 0 &&
+      data[4] == SESSION_VERSION)
+  {
+    this->controlRateHz = data[6] | (data[7] << 8);
+    this->startMs = (uint32_t)controlReadInt32(data + 8);
+  }
+}
+
+bool SessionReader::next(SessionRecord &record)
+{
+  if (!valid() || this->offset >= this->size)
+    return false;
+
+  const uint8_t *p = this->data + this->offset;
+  size_t left = this->size - this->offset;
+  size_t at = 1;
+  uint32_t gap = 0;
+  for (int shift = 0; ; shift += 7)
+  {
+    if (at >= left || shift > 28)
+    {
+      this->truncated = true;
+      return false;
+    }
+    uint8_t byte = p[at++];
+    gap |= (uint32_t)(byte & 0x7F) << shift;
+    if (!(byte & 0x80))
+      break;
+  }
+
+  memset(&record, 0, sizeof(record));
+  record.kind = p[0];
+  size_t length;
+  switch (record.kind)
+  {
+    case SESSION_FRAME:
+      length = at + 5 <= left ? 5 + p[at + 4] : 5;
+      break;
+    case SESSION_CONNECT:
+    case SESSION_DISCONNECT:
+      length = 1;
+      break;
+    case SESSION_CHANNEL:
+      length = 4;
+      break;
+    default:
+      // an unknown kind can't be skipped, its length isn't known
+      this->truncated = true;
+      return false;
+  }
+  if (at + length > left)
+  {
+    this->truncated = true;
+    return false;
+  }
+
+  const uint8_t *body = p + at;
+  this->time += gap;
+  record.time = this->time;
+  if (record.kind == SESSION_CHANNEL)
+  {
+    record.channel = body[0];
+    record.state = body[1];
+    record.mode = body[2];
+    record.microsteps = body[3];
+  }
+  else
+    record.client = body[0];
+  if (record.kind == SESSION_FRAME)
+  {
+    record.frame.version = CONTROL_VERSION;
+    record.frame.type = body[1];
+    record.frame.sequence = body[2] | (body[3] << 8);
+    record.frame.length = body[4];
+    record.frame.payload = body + 5;
+  }
+  this->offset += at + length;
+  return true;
+}
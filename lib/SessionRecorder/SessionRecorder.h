@@ -0,0 +1,125 @@
+/*
+ * SessionRecorder - captures the control stream so a session can be replayed
+ *
+ * While recording, every decoded control frame, client connect and
+ * disconnect, and channel mode switch is appended to a buffer in RAM with
+ * its time, for pulling off the device (/session) and replaying on the
+ * host against the same libraries. The log is:
+ *
+ *   offset  size  field
+ *        0     4  magic "SREC"
+ *        4     1  version
+ *        5     1  reserved - 0
+ *        6     2  control loop rate, Hz
+ *        8     4  device clock when recording started, ms
+ *       12        records
+ *
+ * and each record is a kind byte, the us since the previous record as a
+ * varint, then by kind:
+ *
+ *   SESSION_FRAME       client slot u8, type u8, sequence u16, length u8,
+ *                       the payload
+ *   SESSION_CONNECT     client slot u8
+ *   SESSION_DISCONNECT  client slot u8
+ *   SESSION_CHANNEL     channel u8, ChannelState u8, StepperTimer mode u8,
+ *                       microsteps u8 - as switched by the control loop, and
+ *                       at time 0 what each channel was when recording began
+ *
+ * A stamped setpoint frame takes 29 bytes, so the 32KB buffer holds over
+ * 20s of a client sending at its fastest, every 20ms, and minutes of one
+ * only sending as its sticks move. Recording stops when the buffer is full
+ * rather than overwriting the start, everything after is counted as
+ * dropped.
+ *
+ * The websocket task and the control loop both record, appends are
+ * serialised by a spinlock held for the copy.
+ */
+
+#ifndef SessionRecorder_h
+#define SessionRecorder_h
+
+#include <stddef.h>
+#include "esp_types.h"
+#include "freertos/FreeRTOS.h"
+#include "ControlProtocol.h"
+
+#define SESSION_RECORDER_BYTES    32768
+#define SESSION_VERSION           1
+#define SESSION_HEADER_SIZE       12
+// kind, time, then the largest frame
+#define SESSION_MAX_RECORD        (1 + 5 + 5 + CONTROL_MAX_PAYLOAD)
+
+enum SessionRecordKind {
+  SESSION_FRAME = 1,
+  SESSION_CONNECT = 2,
+  SESSION_DISCONNECT = 3,
+  SESSION_CHANNEL = 4
+};
+
+struct SessionRecord {
+  uint8_t kind;
+  uint64_t time;            // us since recording started
+  uint8_t client;           // slot, frames and connections
+  ControlFrame frame;       // SESSION_FRAME, payload points into the log
+  uint8_t channel;          // SESSION_CHANNEL
+  uint8_t state;
+  uint8_t mode;
+  uint8_t microsteps;
+};
+
+class SessionRecorder {
+  public:
+    SessionRecorder();
+
+    // Clears the buffer and starts a new log, now in us and ms of the device clock
+    void start(uint16_t controlRateHz, int64_t now, uint32_t nowMs);
+    void stop();
+    bool isRecording() { return this->recording; }
+
+    // All false when not recording or out of room
+    bool frame(int client, const ControlFrame &frame, int64_t now);
+    bool connect(int client, int64_t now);
+    bool disconnect(int client, int64_t now);
+    bool channel(int channel, int state, int mode, int microsteps, int64_t now);
+
+    // The log so far, only ever appended to until the next start()
+    const uint8_t *data() { return this->buffer; }
+    size_t size() { return this->used; }
+
+    // statistics
+    volatile unsigned long records;
+    volatile unsigned long dropped;
+
+  private:
+    bool append(uint8_t kind, int64_t now, const uint8_t *head, size_t headLength,
+                const uint8_t *payload, size_t length);
+
+    uint8_t buffer[SESSION_RECORDER_BYTES];
+    volatile size_t used;
+    int64_t last;             // time of the previous record, us
+    volatile bool recording;
+    portMUX_TYPE mux;
+};
+
+// Reads a log back, one record at a time
+class SessionReader {
+  public:
+    SessionReader(const uint8_t *data, size_t size);
+
+    // False if the header isn't a session log of a version this reads
+    bool valid() { return this->controlRateHz != 0; }
+    // The next record, false at the end of the log or a truncated record
+    bool next(SessionRecord &record);
+
+    uint16_t controlRateHz;
+    uint32_t startMs;
+    bool truncated;           // the log ended partway through a record
+
+  private:
+    const uint8_t *data;
+    size_t size;
+    size_t offset;
+    uint64_t time;
+};
+
+#endif
@@ -0,0 +1,72 @@
+/*
+ * SpeedPid - fixed-point speed PID, see SpeedPid.h
+ */
+
+#include "SpeedPid.h"
+
+static int32_t toFixed(float value)
+{
+  return (int32_t)(value * (1 << SPEED_PID_SHIFT) + (value < 0 ? -0.5f : 0.5f));
+}
+
+SpeedPid::SpeedPid()
+{
+  this->kp = 0;
+  this->ki = 0;
+  this->kd = 0;
+  this->kff = 0;
+  this->limit = 0x7FFF;
+  reset();
+}
+
+void SpeedPid::setGains(float kp, float ki, float kd, float kff, uint32_t rateHz)
+{
+  this->kp = toFixed(kp);
+  this->ki = toFixed(ki / rateHz);
+  this->kd = toFixed(kd * rateHz);
+  this->kff = toFixed(kff);
+}
+
+void SpeedPid::setLimit(int32_t limit)
+{
+  this->limit = limit;
+}
+
+void SpeedPid::reset()
+{
+  this->integral = 0;
+  this->lastMeasured = 0;
+  this->primed = false;
+  this->output = 0;
+}
+
+int32_t SpeedPid::update(int32_t target, int32_t measured)
+{
+  int32_t error = target - measured;
+  int64_t terms = (int64_t)this->kff * target + (int64_t)this->kp * error;
+  if (this->primed)
+    terms -= (int64_t)this->kd * (measured - this->lastMeasured);
+  this->lastMeasured = measured;
+  this->primed = true;
+
+  // room left under the limit either side, never less than none
+  int64_t above = ((int64_t)this->limit << SPEED_PID_SHIFT) - terms;
+  int64_t below = -((int64_t)this->limit << SPEED_PID_SHIFT) - terms;
+  if (above < 0)
+    above = 0;
+  if (below > 0)
+    below = 0;
+  this->integral += (int64_t)this->ki * error;
+  if (this->integral > above)
+    this->integral = above;
+  if (this->integral < below)
+    this->integral = below;
+
+  int64_t output = (terms + this->integral) >> SPEED_PID_SHIFT;
+  if (output > this->limit)
+    output = this->limit;
+  if (output < -this->limit)
+    output = -this->limit;
+  this->output = (int32_t)output;
+  return this->output;
+}
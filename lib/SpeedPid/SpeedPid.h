@@ -0,0 +1,48 @@
+/*
+ * SpeedPid - fixed-point PID speed controller with feed-forward
+ *
+ * Gains are set once as floats and held in Q16, update() is then integer
+ * only: 64-bit products of 32-bit terms, no divide. The derivative acts on
+ * the measured rate so a setpoint step doesn't kick the output, and the
+ * feed-forward term carries the open loop output for the target so the
+ * PID only has to correct for load.
+ *
+ * Anti-windup clamps the integral to whatever room the other terms leave
+ * under the output limit, without pushing it past zero - it never winds up
+ * while the output is saturated and unwinds as soon as there is room.
+ */
+
+#ifndef SpeedPid_h
+#define SpeedPid_h
+
+#include "esp_types.h"
+
+#define SPEED_PID_SHIFT 16
+
+class SpeedPid {
+  public:
+    SpeedPid();
+    // Output units per count/s: kp on the error, ki on the error integrated
+    // over seconds, kd on the rate of change of the measured rate, kff on
+    // the target. rateHz is how often update() is called.
+    void setGains(float kp, float ki, float kd, float kff, uint32_t rateHz);
+    // output is clamped to +/- limit
+    void setLimit(int32_t limit);
+    void reset();
+    // target and measured rates in counts/s, returns the new output
+    int32_t update(int32_t target, int32_t measured);
+
+    int32_t output;
+
+  private:
+    int32_t kp;               // Q16 per update
+    int32_t ki;
+    int32_t kd;
+    int32_t kff;
+    int32_t limit;
+    int64_t integral;         // Q16 output units
+    int32_t lastMeasured;
+    bool primed;              // lastMeasured is valid
+};
+
+#endif
@@ -0,0 +1,395 @@
+/*
+ * StepDirStepper - RMT generated step pulses, see StepDirStepper.h
+ */
+
+#include "StepDirStepper.h"
+#include "driver/gpio.h"
+
+// Owner of each RMT channel, for the shared interrupt
+static StepDirStepper *stepDirChannels[RMT_CHANNEL_MAX];
+static rmt_isr_handle_t stepDirIsr = NULL;
+
+// Highest rate a pulse and the shortest low time fit in, Q24.8 steps/s
+#define STEP_DIR_MAX_RATE  ((int32_t)(STEP_DIR_TICK_RATE / STEP_DIR_MIN_INTERVAL) << STEP_PLANNER_RATE_SHIFT)
+
+static inline uint32_t IRAM_ATTR stepDirItem(uint32_t duration0, uint32_t level0, uint32_t duration1, uint32_t level1)
+{
+  return duration0 | (level0 << 15) | (duration1 << 16) | (level1 << 31);
+}
+
+static int32_t toRate(long stepsPerSecond)
+{
+  int32_t rate = STEP_DIR_MAX_RATE;
+  if (stepsPerSecond > -(STEP_DIR_MAX_RATE >> STEP_PLANNER_RATE_SHIFT) &&
+      stepsPerSecond < (STEP_DIR_MAX_RATE >> STEP_PLANNER_RATE_SHIFT))
+    rate = (int32_t)stepsPerSecond << STEP_PLANNER_RATE_SHIFT;
+  else if (stepsPerSecond < 0)
+    rate = -rate;
+  return rate;
+}
+
+StepDirStepper::StepDirStepper(rmt_channel_t channel, int stepPin, int dirPin) : planner(STEP_DIR_TICK_RATE)
+{
+  this->channel = channel;
+  this->stepPin = stepPin;
+  this->dirPin = dirPin;
+  portMUX_TYPE unlocked = portMUX_INITIALIZER_UNLOCKED;
+  this->mux = unlocked;
+
+  this->transmitting = false;
+  this->ended = true;
+  this->forward = true;
+  this->idle = 0;
+  this->held = 0;
+  this->refillHalf = 0;
+
+  this->position = 0;
+  this->moveTarget = 0;
+  this->moving = false;
+  this->moveRate = 0;
+  this->movesCompleted = 0;
+  this->runs = 0;
+  this->refills = 0;
+  this->planner.setLimits(4000, 0);
+}
+
+void StepDirStepper::begin()
+{
+  gpio_config_t io_conf;
+  io_conf.intr_type = GPIO_INTR_DISABLE;
+  io_conf.mode = GPIO_MODE_OUTPUT;
+  io_conf.pin_bit_mask = 1ULL << this->dirPin;
+  io_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
+  io_conf.pull_up_en = GPIO_PULLUP_DISABLE;
+  gpio_config(&io_conf);
+  setDirection(true);
+
+  rmt_config_t config;
+  config.rmt_mode = RMT_MODE_TX;
+  config.channel = this->channel;
+  config.clk_div = STEP_DIR_CLK_DIV;
+  config.gpio_num = (gpio_num_t)this->stepPin;
+  config.mem_block_num = 1;
+  config.tx_config.loop_en = false;
+  config.tx_config.carrier_freq_hz = 0;
+  config.tx_config.carrier_duty_percent = 0;
+  config.tx_config.carrier_level = RMT_CARRIER_LEVEL_LOW;
+  config.tx_config.carrier_en = false;
+  config.tx_config.idle_level = RMT_IDLE_LEVEL_LOW;
+  config.tx_config.idle_output_en = true;
+  rmt_config(&config);
+
+  // Wrap round the block, the threshold event marks each half played
+  RMT.apb_conf.mem_tx_wrap_en = 1;
+  rmt_set_tx_thr_intr_en(this->channel, true, STEP_DIR_HALF);
+  rmt_set_tx_intr_en(this->channel, true);
+
+  stepDirChannels[this->channel] = this;
+  if (stepDirIsr == NULL)
+    rmt_isr_register(rmtInt, NULL, ESP_INTR_FLAG_IRAM, &stepDirIsr);
+}
+
+void StepDirStepper::setAcceleration(unsigned long acceleration, unsigned long jerk)
+{
+  this->planner.setLimits(acceleration, jerk);
+}
+
+void StepDirStepper::setTargetSpeed(long stepsPerSecond)
+{
+  this->moving = false;
+  this->planner.setTarget(toRate(stepsPerSecond));
+  if (stepsPerSecond != 0)
+    start();
+}
+
+void StepDirStepper::moveTo(int64_t target, long maxSpeed)
+{
+  // The interrupt stops steering while the target is rewritten
+  this->moving = false;
+  __sync_synchronize();
+  this->moveTarget = target;
+  int32_t rate = toRate(maxSpeed);
+  this->moveRate = rate < 0 ? -rate : rate;
+  if (this->moveRate < (int32_t)this->planner.minimumRate())
+    this->moveRate = this->planner.minimumRate();
+  __sync_synchronize();
+  this->moving = true;
+
+  if (!this->transmitting && target == getPosition())
+  {
+    this->moving = false;
+    this->movesCompleted++;
+    return;
+  }
+  start();
+}
+
+void StepDirStepper::moveBy(int64_t steps, long maxSpeed)
+{
+  moveTo(getPosition() + steps, maxSpeed);
+}
+
+/*
+ * End markers over the whole block stop the transmitter at its next item.
+ * The steps encoded beyond the item it is sending never reach the pin, so
+ * they come back off the position.
+ */
+void StepDirStepper::halt()
+{
+  portENTER_CRITICAL(&this->mux);
+  if (this->transmitting)
+    this->position -= this->forward ? unplayed() : -unplayed();
+  for (int i = 0; i < STEP_DIR_BLOCK; i++)
+    RMTMEM.chan[this->channel].data32[i].val = 0;
+  this->ended = true;
+  this->idle = 0;
+  this->held = 0;
+  this->moving = false;
+  this->planner.stop();
+  portEXIT_CRITICAL(&this->mux);
+}
+
+/*
+ * Steps encoded after the item being sent, with the lock held: the rest of
+ * its half, then the other half if the interrupt has refilled it since it
+ * was played - with a threshold event still pending it holds steps already
+ * sent. Up to the end marker, if the run has one.
+ */
+int StepDirStepper::unplayed()
+{
+  volatile rmt_item32_t *items = RMTMEM.chan[this->channel].data32;
+  int read = (RMT.status_ch[this->channel].val >> STEP_DIR_RADDR_SHIFT) & (STEP_DIR_BLOCK - 1);
+  int half = read / STEP_DIR_HALF;
+  int end = half * STEP_DIR_HALF + (this->refillHalf == half ? STEP_DIR_BLOCK : STEP_DIR_HALF);
+  if (items[read].duration0 == 0 || items[read].duration1 == 0)
+    return 0;
+  int steps = 0;
+  for (int i = read + 1; i < end; i++)
+  {
+    rmt_item32_t item;
+    item.val = items[i & (STEP_DIR_BLOCK - 1)].val;
+    if (item.duration0 == 0 || item.duration1 == 0)
+      break;
+    if (item.level0)
+      steps++;
+  }
+  return steps;
+}
+
+int64_t StepDirStepper::getPosition()
+{
+  int64_t position;
+  do {
+    position = this->position;
+  } while (position != this->position);
+  return position;
+}
+
+void StepDirStepper::setPosition(int64_t position)
+{
+  if (!this->transmitting)
+    this->position = position;
+}
+
+// Same steering as StepperTimer::steerMove(), run as steps are encoded
+bool IRAM_ATTR StepDirStepper::steerMove()
+{
+  int64_t remaining = this->moveTarget - this->position;
+  int32_t rate = this->planner.rate;
+  uint32_t speed = rate > 0 ? rate : -rate;
+  uint32_t creep = this->planner.minimumRate();
+
+  if (remaining == 0 && speed <= 2 * creep)
+    return false;
+
+  int32_t direction;
+  if (remaining == 0)
+    direction = rate > 0 ? -1 : 1;
+  else
+    direction = remaining > 0 ? 1 : -1;
+
+  uint64_t distance = remaining < 0 ? -remaining : remaining;
+  bool braking = distance <= this->planner.stoppingSteps();
+  this->planner.braking = braking;
+  this->planner.target = direction * (braking ? (int32_t)creep : this->moveRate);
+  return true;
+}
+
+// Ticks to the next step, or 0 once the motor has come to rest
+uint32_t IRAM_ATTR StepDirStepper::nextInterval()
+{
+  if (this->moving && !steerMove())
+  {
+    this->planner.stop();
+    this->moving = false;
+    this->movesCompleted++;
+    return 0;
+  }
+  return this->planner.next();
+}
+
+/*
+ * Each step is one item, the pulse then as much of the low time to the
+ * next step as fits in a half. Longer gaps carry on in idle items, never
+ * leaving a half of 0 ticks, which would read as the end marker.
+ */
+int IRAM_ATTR StepDirStepper::encode(volatile rmt_item32_t *items, int count)
+{
+  int n = 0;
+  while (n < count)
+  {
+    if (this->idle > 0)
+    {
+      uint32_t ticks = this->idle;
+      if (ticks > 2 * STEP_DIR_MAX_DURATION)
+        ticks = ticks - 2 * STEP_DIR_MAX_DURATION >= 2 ? 2 * STEP_DIR_MAX_DURATION : ticks - 2;
+      items[n++].val = stepDirItem(ticks - ticks / 2, 0, ticks / 2, 0);
+      this->idle -= ticks;
+      continue;
+    }
+
+    uint32_t ticks = this->held;
+    this->held = 0;
+    if (ticks == 0)
+    {
+      ticks = nextInterval();
+      if (ticks == 0)
+      {
+        this->ended = true;
+        break;
+      }
+      if (this->planner.forward() != this->forward)
+      {
+        // the direction pin only changes between runs
+        this->held = ticks;
+        this->ended = true;
+        break;
+      }
+    }
+
+    if (ticks < STEP_DIR_MIN_INTERVAL)
+      ticks = STEP_DIR_MIN_INTERVAL;
+    uint32_t low = ticks - STEP_DIR_PULSE_TICKS;
+    if (low > STEP_DIR_MAX_DURATION)
+    {
+      this->idle = low - STEP_DIR_MAX_DURATION;
+      low = STEP_DIR_MAX_DURATION;
+      if (this->idle == 1)
+      {
+        low--;
+        this->idle++;
+      }
+    }
+    items[n++].val = stepDirItem(STEP_DIR_PULSE_TICKS, 1, low, 0);
+    this->position += this->forward ? 1 : -1;
+  }
+  return n;
+}
+
+// Encodes into the channel memory, closing a run with an end marker
+void IRAM_ATTR StepDirStepper::fill(int offset, int count)
+{
+  volatile rmt_item32_t *items = &RMTMEM.chan[this->channel].data32[offset];
+  int n = encode(items, count);
+  if (n < count)
+    items[n].val = 0;
+}
+
+void IRAM_ATTR StepDirStepper::setDirection(bool forward)
+{
+  this->forward = forward;
+  uint32_t bit = 1UL << (this->dirPin & 31);
+  if (this->dirPin < 32)
+  {
+    if (forward)
+      GPIO.out_w1ts = bit;
+    else
+      GPIO.out_w1tc = bit;
+  }
+  else
+  {
+    if (forward)
+      GPIO.out1_w1ts.val = bit;
+    else
+      GPIO.out1_w1tc.val = bit;
+  }
+}
+
+// Fills the whole block and sets the transmitter going, with the lock held.
+// The first step is planned before the direction pin is set for it.
+void IRAM_ATTR StepDirStepper::startRun()
+{
+  if (this->held == 0)
+    this->held = nextInterval();
+  if (this->held == 0)
+    return;
+  setDirection(this->planner.forward());
+  this->idle = 2 * STEP_DIR_SETUP_TICKS;
+  this->ended = false;
+  this->refillHalf = 0;
+  fill(0, STEP_DIR_HALF);
+  if (!this->ended)
+    fill(STEP_DIR_HALF, STEP_DIR_HALF);
+
+  RMT.conf_ch[this->channel].conf1.mem_rd_rst = 1;
+  RMT.conf_ch[this->channel].conf1.mem_rd_rst = 0;
+  RMT.conf_ch[this->channel].conf1.mem_owner = 0;   // transmitter
+  this->transmitting = true;
+  this->runs++;
+  RMT.conf_ch[this->channel].conf1.tx_start = 1;
+}
+
+// Starts a run from rest, a run in progress picks up the new target itself
+void StepDirStepper::start()
+{
+  portENTER_CRITICAL(&this->mux);
+  if (!this->transmitting)
+  {
+    this->planner.start();
+    startRun();
+  }
+  portEXIT_CRITICAL(&this->mux);
+}
+
+void IRAM_ATTR StepDirStepper::rmtInt(void *arg)
+{
+  uint32_t status = RMT.int_st.val;
+  RMT.int_clr.val = status;
+  for (int c = 0; c < RMT_CHANNEL_MAX; c++)
+  {
+    StepDirStepper *stepper = stepDirChannels[c];
+    if (stepper == NULL)
+      continue;
+    if (status & (1UL << (24 + c)))
+      stepper->onThreshold();
+    if (status & (1UL << (3 * c)))
+      stepper->onEnd();
+  }
+}
+
+// Half the block has been played, encode the next steps into it
+void IRAM_ATTR StepDirStepper::onThreshold()
+{
+  portENTER_CRITICAL_ISR(&this->mux);
+  if (this->transmitting && !this->ended)
+  {
+    fill(this->refillHalf * STEP_DIR_HALF, STEP_DIR_HALF);
+    this->refillHalf ^= 1;
+    this->refills++;
+  }
+  portEXIT_CRITICAL_ISR(&this->mux);
+}
+
+// The transmitter reached the end marker: turn round, carry on if there is
+// somewhere to go now, or stay stopped
+void IRAM_ATTR StepDirStepper::onEnd()
+{
+  portENTER_CRITICAL_ISR(&this->mux);
+  RMT.conf_ch[this->channel].conf1.tx_start = 0;
+  this->transmitting = false;
+  if (this->held == 0 && (this->moving || this->planner.target != 0))
+    this->planner.start();
+  if (this->held != 0 || this->planner.isRunning())
+    startRun();
+  portEXIT_CRITICAL_ISR(&this->mux);
+}
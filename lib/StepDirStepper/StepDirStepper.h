@@ -0,0 +1,115 @@
+/*
+ * StepDirStepper - a stepper on an external step/dir driver (A4988,
+ * DRV8825, TMC...) with its step pulses generated by an RMT channel
+ *
+ * The same StepPlanner as StepperTimer ramps the rate, ticking at the RMT
+ * clock rather than the step timer. Steps are encoded ahead into RMT
+ * items - the step pulse and the low time to the next step - and the
+ * channel plays them out of its 64 item memory block in wrap mode. The
+ * RMT interrupt comes once every half block and encodes the next steps
+ * into the half just played, so the CPU is interrupted once per 32 steps
+ * rather than per step, and every edge is timed by the peripheral to the
+ * 0.1us tick. Pulse trains of a few hundred kHz run on each of the eight
+ * channels.
+ *
+ * A run of pulses ends with an end marker when the motor comes to rest or
+ * has to reverse. The direction pin is only switched there, with the
+ * driver's setup time before the first pulse the other way.
+ *
+ * getPosition() counts steps as they are encoded, which is up to a block
+ * (64 steps) ahead of the pulses on the pin while running. halt() takes
+ * back the steps the transmitter hadn't reached, from its read address in
+ * the channel status, so the position is the pin's again once stopped.
+ *
+ * The RMT interrupt is registered once for every StepDirStepper, so the
+ * IDF RMT driver (rmt_driver_install) can't be used alongside.
+ */
+
+#ifndef StepDirStepper_h
+#define StepDirStepper_h
+
+#include "esp_attr.h"
+#include "esp_types.h"
+#include "driver/rmt.h"
+#include "soc/rmt_struct.h"
+#include "soc/gpio_struct.h"
+#include "freertos/FreeRTOS.h"
+#include "StepPlanner.h"
+
+#define STEP_DIR_CLK_DIV        8                                // 80MHz APB clock / 8
+#define STEP_DIR_TICK_RATE      (80000000 / STEP_DIR_CLK_DIV)    // 0.1us ticks
+#define STEP_DIR_BLOCK          64      // items in a channel's memory block
+#define STEP_DIR_HALF           (STEP_DIR_BLOCK / 2)
+#define STEP_DIR_MAX_DURATION   32767   // ticks in one half of an item
+#define STEP_DIR_PULSE_TICKS    20      // 2us high, DRV8825 wants 1.9us
+#define STEP_DIR_SETUP_TICKS    20      // direction to step setup time
+#define STEP_DIR_MIN_INTERVAL   (STEP_DIR_PULSE_TICKS + 2)
+#define STEP_DIR_RADDR_SHIFT    11      // RMT_MEM_RADDR_EX_CHn in RMT_CHnSTATUS_REG
+
+class StepDirStepper {
+  public:
+    StepDirStepper(rmt_channel_t channel, int stepPin, int dirPin);
+
+    // Configures the RMT channel, and the shared interrupt the first time
+    void begin();
+
+    // acceleration in steps/s^2, jerk in steps/s^3 (0 = trapezoidal)
+    void setAcceleration(unsigned long acceleration, unsigned long jerk);
+    // Ramps towards a rate in steps/s, cancelling any move
+    void setTargetSpeed(long stepsPerSecond);
+    // Runs to a position at up to maxSpeed steps/s, braking to land on it
+    void moveTo(int64_t target, long maxSpeed);
+    void moveBy(int64_t steps, long maxSpeed);
+    // Stops dead, pulses in flight are cut off at the next item and the
+    // steps that never went out taken off the position
+    void halt();
+
+    int64_t getPosition();
+    void setPosition(int64_t position);
+    bool isRunning() { return this->transmitting; }
+    bool isMoving() { return this->moving; }
+
+    // Encodes the next steps into count items. Stops short, with the run
+    // ended, when the motor comes to rest or has to reverse.
+    int encode(volatile rmt_item32_t *items, int count);
+    // Whether the run in progress has been encoded to its end
+    bool runEnded() { return this->ended; }
+
+    StepPlanner planner;
+    volatile unsigned long movesCompleted;
+
+    // statistics
+    volatile unsigned long runs;       // pulse trains started
+    volatile unsigned long refills;    // half blocks encoded by the interrupt
+
+  private:
+    static void rmtInt(void *arg);
+    void onThreshold();
+    void onEnd();
+    void start();
+    void startRun();
+    void fill(int offset, int count);
+    int unplayed();
+    uint32_t nextInterval();
+    bool steerMove();
+    void setDirection(bool forward);
+
+    rmt_channel_t channel;
+    int stepPin;
+    int dirPin;
+    portMUX_TYPE mux;
+
+    volatile bool transmitting;
+    bool ended;               // end marker written, nothing more to encode this run
+    bool forward;             // direction pin
+    uint32_t idle;            // low ticks still to encode after the last pulse
+    uint32_t held;            // first interval of the next run, after a reversal
+    int refillHalf;           // half of the block the transmitter leaves next
+
+    volatile int64_t position;
+    volatile int64_t moveTarget;
+    volatile bool moving;
+    int32_t moveRate;         // Q24.8 steps/s
+};
+
+#endif
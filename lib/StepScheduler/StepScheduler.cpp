@@ -0,0 +1,215 @@
+/*
+ * StepScheduler - single timer multi-axis step scheduler, see StepScheduler.h
+ */
+
+#include "StepScheduler.h"
+#include "xtensa/core-macros.h"
+
+// Bound on how many times one interrupt goes round for steps that fell due
+// while it was running, so a flood of fast axes can't lock out the CPU
+#define STEP_SCHEDULER_MAX_PASSES 4
+
+static void IRAM_ATTR stepSchedulerInt(void *para)
+{
+  ((StepScheduler *)para)->onAlarm();
+}
+
+StepScheduler::StepScheduler(timer_group_t group, timer_idx_t index)
+{
+  this->group = group;
+  this->index = index;
+  this->coalesceTicks = 1;
+  this->interrupts = 0;
+  this->steps = 0;
+  this->axisCount = 0;
+  this->heapCount = 0;
+  this->trace = NULL;
+  portMUX_TYPE unlocked = portMUX_INITIALIZER_UNLOCKED;
+  this->mux = unlocked;
+}
+
+void StepScheduler::begin()
+{
+  timer_config_t config;
+  config.divider = TIMER_DIVIDER;
+  config.counter_dir = TIMER_COUNT_UP;
+  config.counter_en = TIMER_PAUSE;
+  config.alarm_en = TIMER_ALARM_DIS;
+  config.intr_type = TIMER_INTR_LEVEL;
+  config.auto_reload = false;
+
+  timer_init(this->group, this->index, &config);
+  timer_set_counter_value(this->group, this->index, 0x00000000ULL);
+  timer_enable_intr(this->group, this->index);
+  timer_isr_register(this->group, this->index, stepSchedulerInt, (void *)this, ESP_INTR_FLAG_IRAM, NULL);
+  timer_start(this->group, this->index);
+}
+
+int StepScheduler::attach(StepCallback callback, void *arg)
+{
+  if (this->axisCount >= STEP_SCHEDULER_MAX_AXES)
+    return -1;
+  int slot = this->axisCount;
+  this->callbacks[slot] = callback;
+  this->args[slot] = arg;
+  this->queued[slot] = false;
+  this->axisCount++;
+  return slot;
+}
+
+void StepScheduler::wake(int slot, uint32_t delay)
+{
+  if (slot < 0 || slot >= this->axisCount)
+    return;
+
+  uint64_t now;
+  timer_get_counter_value(this->group, this->index, &now);
+
+  portENTER_CRITICAL(&this->mux);
+  if (!this->queued[slot])
+  {
+    this->queued[slot] = true;
+    push(now + delay, slot);
+    if (this->heap[0].slot == slot)
+      arm();
+  }
+  portEXIT_CRITICAL(&this->mux);
+}
+
+void StepScheduler::cancel(int slot)
+{
+  if (slot < 0 || slot >= this->axisCount)
+    return;
+
+  // The interrupt holds the lock while it steps, so taking it waits out a
+  // step in progress. The heap is rebuilt without the slot, it never holds
+  // more than STEP_SCHEDULER_MAX_AXES events.
+  portENTER_CRITICAL(&this->mux);
+  if (this->queued[slot])
+  {
+    this->queued[slot] = false;
+    StepEvent events[STEP_SCHEDULER_MAX_AXES];
+    int count = this->heapCount;
+    for (int i = 0; i < count; i++)
+      events[i] = this->heap[i];
+    this->heapCount = 0;
+    for (int i = 0; i < count; i++)
+      if (events[i].slot != slot)
+        push(events[i].deadline, events[i].slot);
+    if (this->heapCount > 0)
+      arm();
+  }
+  portEXIT_CRITICAL(&this->mux);
+}
+
+void IRAM_ATTR StepScheduler::onAlarm()
+{
+  // When tracing, note the entry time and the real counter - scheduling
+  // itself still works from the deadlines so tracing doesn't change it
+  StepTrace *trace = this->trace;
+  bool tracing = trace != NULL && trace->enabled;
+  uint32_t entry = 0;
+  uint64_t observed = 0;
+  if (tracing)
+  {
+    entry = XTHAL_GET_CCOUNT();
+    timer_get_counter_value(this->group, this->index, &observed);
+  }
+
+  // Clear Timer
+  if (this->group == TIMER_GROUP_0)
+  {
+    if (this->index == TIMER_0)
+      TIMERG0.int_clr_timers.t0 = 1;
+    else
+      TIMERG0.int_clr_timers.t1 = 1;
+  }
+  else
+  {
+    if (this->index == TIMER_0)
+      TIMERG1.int_clr_timers.t0 = 1;
+    else
+      TIMERG1.int_clr_timers.t1 = 1;
+  }
+
+  portENTER_CRITICAL_ISR(&this->mux);
+  this->interrupts++;
+
+  // The alarm only fires once the earliest deadline has passed
+  uint64_t now = this->heapCount > 0 ? this->heap[0].deadline : 0;
+  uint32_t late = observed > now ? (uint32_t)(observed - now) : 0;
+  for (int pass = 0; pass < STEP_SCHEDULER_MAX_PASSES && this->heapCount > 0; pass++)
+  {
+    uint64_t due = now + this->coalesceTicks;
+    while (this->heapCount > 0 && this->heap[0].deadline <= due)
+    {
+      StepEvent event = pop();
+      uint32_t ticks = this->callbacks[event.slot](this->args[event.slot]);
+      this->steps++;
+      if (tracing)
+        trace->recordStep(event.slot, XTHAL_GET_CCOUNT(),
+          observed > event.deadline ? (uint32_t)(observed - event.deadline) : 0);
+      if (ticks != 0)
+        push(event.deadline + ticks, event.slot);
+      else
+        this->queued[event.slot] = false;
+    }
+    if (this->heapCount == 0)
+      break;
+    // Go round again if the next deadline slipped by while stepping
+    timer_get_counter_value(this->group, this->index, &now);
+    if (tracing)
+      observed = now;
+    if (this->heap[0].deadline > now + this->coalesceTicks)
+      break;
+  }
+
+  if (this->heapCount > 0)
+    arm();
+  if (tracing)
+    trace->recordInterrupt(late, XTHAL_GET_CCOUNT() - entry);
+  portEXIT_CRITICAL_ISR(&this->mux);
+}
+
+// Set the alarm to the earliest deadline
+void IRAM_ATTR StepScheduler::arm()
+{
+  timer_set_alarm_value(this->group, this->index, this->heap[0].deadline);
+  timer_set_alarm(this->group, this->index, TIMER_ALARM_EN);
+}
+
+void IRAM_ATTR StepScheduler::push(uint64_t deadline, uint8_t slot)
+{
+  int i = this->heapCount++;
+  while (i > 0)
+  {
+    int parent = (i - 1) >> 1;
+    if (this->heap[parent].deadline <= deadline)
+      break;
+    this->heap[i] = this->heap[parent];
+    i = parent;
+  }
+  this->heap[i].deadline = deadline;
+  this->heap[i].slot = slot;
+}
+
+StepScheduler::StepEvent IRAM_ATTR StepScheduler::pop()
+{
+  StepEvent top = this->heap[0];
+  StepEvent last = this->heap[--this->heapCount];
+  int i = 0;
+  for (;;)
+  {
+    int child = (i << 1) + 1;
+    if (child >= this->heapCount)
+      break;
+    if (child + 1 < this->heapCount && this->heap[child + 1].deadline < this->heap[child].deadline)
+      child++;
+    if (last.deadline <= this->heap[child].deadline)
+      break;
+    this->heap[i] = this->heap[child];
+    i = child;
+  }
+  this->heap[i] = last;
+  return top;
+}
@@ -0,0 +1,85 @@
+/*
+ * StepScheduler - drives any number of step sources from one hardware timer
+ *
+ * Every attached axis has its next step deadline (in timer ticks) in a small
+ * binary min-heap. The timer counts freely and its alarm is always set to
+ * the earliest deadline, so only one interrupt is taken no matter how many
+ * axes are running. Steps that fall due within coalesceTicks of each other
+ * are all taken in the same interrupt.
+ *
+ * Deadlines are absolute, each new one is the previous deadline plus the
+ * interval returned by the axis, so a late interrupt never accumulates into
+ * drift.
+ */
+
+#ifndef StepScheduler_h
+#define StepScheduler_h
+
+#include "esp_attr.h"
+#include "esp_types.h"
+#include "driver/timer.h"
+#include "soc/timer_group_struct.h"
+#include "freertos/FreeRTOS.h"
+#include "StepTrace.h"
+
+#define TIMER_DIVIDER         16  //  Hardware timer clock divider
+#define TIMER_SCALE           (TIMER_BASE_CLK / TIMER_DIVIDER)  // convert counter value to seconds
+
+#define STEP_SCHEDULER_MAX_AXES 16
+
+/*
+ * Takes one step for an axis, returns the ticks until its next step or 0 to
+ * stop scheduling it. Called from the timer interrupt, so it must be in IRAM.
+ */
+typedef uint32_t (*StepCallback)(void *arg);
+
+class StepScheduler {
+  public:
+    StepScheduler(timer_group_t group, timer_idx_t index);
+
+    // Configures the timer and registers the interrupt, call once at boot
+    void begin();
+    // Adds an axis, returns its slot or -1 when full
+    int attach(StepCallback callback, void *arg);
+    // Schedules a stopped axis to step after the given number of ticks
+    void wake(int slot, uint32_t delay);
+    // Takes an axis off the schedule, its callback isn't called again
+    // (nor still running on the other core) once this returns, until the
+    // next wake()
+    void cancel(int slot);
+    // Timer interrupt body
+    void onAlarm();
+    // Records interrupt and step timing into trace while trace->enabled
+    void setTrace(StepTrace *trace) { this->trace = trace; }
+
+    uint32_t coalesceTicks;
+
+    // statistics
+    volatile unsigned long interrupts;
+    volatile unsigned long steps;
+
+  private:
+    struct StepEvent {
+      uint64_t deadline;
+      uint8_t slot;
+    };
+
+    void push(uint64_t deadline, uint8_t slot);
+    StepEvent pop();
+    void arm();
+
+    timer_group_t group;
+    timer_idx_t index;
+    portMUX_TYPE mux;
+    StepTrace *trace;
+
+    StepCallback callbacks[STEP_SCHEDULER_MAX_AXES];
+    void *args[STEP_SCHEDULER_MAX_AXES];
+    bool queued[STEP_SCHEDULER_MAX_AXES];
+    int axisCount;
+
+    StepEvent heap[STEP_SCHEDULER_MAX_AXES];
+    int heapCount;
+};
+
+#endif
@@ -0,0 +1,134 @@
+/*
+ * StepTrace - step interrupt timing trace, see StepTrace.h
+ */
+
+#include <string.h>
+#include <stdio.h>
+#include "StepTrace.h"
+
+StepTrace::StepTrace()
+{
+  this->enabled = false;
+  this->delayThreshold = 50;    // 10us at the usual 5MHz step timer
+  clear();
+}
+
+void StepTrace::reset()
+{
+  __atomic_store_n(&this->resetPending, true, __ATOMIC_RELEASE);
+}
+
+// Interrupt side, the ring itself is left alone as the heads say what is
+// in it
+void IRAM_ATTR StepTrace::clear()
+{
+  this->latency.reset();
+  this->duration.reset();
+  memset(this->steps, 0, sizeof(this->steps));
+  memset(this->delayed, 0, sizeof(this->delayed));
+  memset(this->head, 0, sizeof(this->head));
+  __atomic_store_n(&this->resetPending, false, __ATOMIC_RELEASE);
+}
+
+void IRAM_ATTR StepTrace::recordStep(int axis, uint32_t cycles, uint32_t late)
+{
+  if (axis >= STEP_TRACE_AXES)
+    return;
+  if (this->resetPending)
+    clear();
+  uint32_t index = this->head[axis];
+  StepTraceRecord &record = this->ring[axis][index & (STEP_TRACE_RING - 1)];
+  record.cycles = cycles;
+  record.late = late;
+  __atomic_store_n(&this->head[axis], index + 1, __ATOMIC_RELEASE);
+  this->steps[axis]++;
+  if (late > this->delayThreshold)
+    this->delayed[axis]++;
+}
+
+void IRAM_ATTR StepTrace::recordInterrupt(uint32_t late, uint32_t cycles)
+{
+  if (this->resetPending)
+    clear();
+  this->latency.add(late);
+  this->duration.add(cycles);
+}
+
+/*
+ * The interrupt may step on while copying. The record it is writing when
+ * the copy ends sits one lap behind the head read then, so everything
+ * from there back was overwritten; a head that went backwards was reset.
+ */
+int StepTrace::copyRing(int axis, StepTraceRecord *records)
+{
+  if (__atomic_load_n(&this->resetPending, __ATOMIC_ACQUIRE))
+    return 0;
+  uint32_t head = __atomic_load_n(&this->head[axis], __ATOMIC_ACQUIRE);
+  int count = head < STEP_TRACE_RING ? head : STEP_TRACE_RING;
+  for (int i = 0; i < count; i++)
+    records[i] = this->ring[axis][(head - count + i) & (STEP_TRACE_RING - 1)];
+  __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  uint32_t after = __atomic_load_n(&this->head[axis], __ATOMIC_ACQUIRE);
+  if ((int32_t)(after - head) < 0)
+    return 0;
+  int lost = (int)(after - head) + 1 - (STEP_TRACE_RING - count);
+  if (lost <= 0)
+    return count;
+  if (lost >= count)
+    return 0;
+  memmove(records, records + lost, (count - lost) * sizeof(StepTraceRecord));
+  return count - lost;
+}
+
+void StepTrace::writeMetrics(MetricsWriter &writer, uint32_t tickRate, uint32_t cpuMhz)
+{
+  double tickSeconds = 1.0 / tickRate;
+  double cycleSeconds = 1.0 / (cpuMhz * 1000000.0);
+  char labels[24];
+
+  writer.header("stepper_trace_enabled", "gauge", "1 while step interrupt tracing is on");
+  writer.sample("stepper_trace_enabled", NULL, (unsigned long)(this->enabled ? 1 : 0));
+
+  // A reset the interrupt hasn't got round to yet reads as empty
+  bool pending = __atomic_load_n(&this->resetPending, __ATOMIC_ACQUIRE);
+  Histogram view;
+  if (!pending)
+    this->latency.snapshot(view);
+  writer.summary("stepper_isr_latency_seconds", "Step interrupt entry after its alarm", NULL, view, tickSeconds);
+  if (!pending)
+    this->duration.snapshot(view);
+  writer.summary("stepper_isr_duration_seconds", "Step interrupt run time", NULL, view, cycleSeconds);
+
+  writer.header("stepper_steps_total", "counter", "Steps taken while tracing");
+  for (int axis = 0; axis < STEP_TRACE_AXES; axis++)
+  {
+    if (pending || this->steps[axis] == 0)
+      continue;
+    snprintf(labels, sizeof(labels), "axis=\"%d\"", axis);
+    writer.sample("stepper_steps_total", labels, this->steps[axis]);
+  }
+
+  writer.header("stepper_steps_delayed_total", "counter", "Steps taken later than the delay threshold");
+  for (int axis = 0; axis < STEP_TRACE_AXES; axis++)
+  {
+    if (pending || this->steps[axis] == 0)
+      continue;
+    snprintf(labels, sizeof(labels), "axis=\"%d\"", axis);
+    writer.sample("stepper_steps_delayed_total", labels, this->delayed[axis]);
+  }
+
+  // Lateness of the most recent steps on each axis, from the ring
+  writer.header("stepper_step_late_seconds", "summary", "Lateness of the last steps of each axis");
+  StepTraceRecord records[STEP_TRACE_RING];
+  for (int axis = 0; axis < STEP_TRACE_AXES; axis++)
+  {
+    int count = copyRing(axis, records);
+    if (count == 0)
+      continue;
+    view.reset();
+    for (int i = 0; i < count; i++)
+      view.add(records[i].late);
+    snprintf(labels, sizeof(labels), "axis=\"%d\"", axis);
+    writer.summary("stepper_step_late_seconds", NULL, labels, view, tickSeconds);
+  }
+}
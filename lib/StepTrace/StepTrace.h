@@ -0,0 +1,71 @@
+/*
+ * StepTrace - low overhead timing trace for the step interrupt
+ *
+ * When enabled, StepScheduler records for every interrupt how late it was
+ * entered relative to its alarm (timer ticks) and how long it ran (CCOUNT
+ * cycles), and for every step the CCOUNT timestamp and how late that step
+ * was taken. Steps go into a small per-axis ring buffer, interrupts into
+ * histograms, all updated from IRAM without locks or division.
+ *
+ * Tracing can be switched on and off at runtime, when off the interrupt
+ * pays one load and branch.
+ *
+ * The interrupt never waits for the readers. reset() only asks for a
+ * clear, which the interrupt does itself on its next record, and until
+ * then the readers report nothing. Each ring head is stored after its
+ * record is written, so copyRing() can tell which records the interrupt
+ * overwrote while they were being copied and drops those. The counters
+ * and histograms are read as they stand, a scrape taken while the motors
+ * run may see them a step apart.
+ */
+
+#ifndef StepTrace_h
+#define StepTrace_h
+
+#include "esp_attr.h"
+#include "esp_types.h"
+#include "Histogram.h"
+#include "MetricsWriter.h"
+
+#define STEP_TRACE_AXES   16
+#define STEP_TRACE_RING   32    // power of two
+
+struct StepTraceRecord {
+  uint32_t cycles;      // CCOUNT when the step was taken
+  uint32_t late;        // ticks after its deadline
+};
+
+class StepTrace {
+  public:
+    StepTrace();
+    // Takes effect at the next traced interrupt
+    void reset();
+
+    // interrupt side
+    void recordStep(int axis, uint32_t cycles, uint32_t late);
+    void recordInterrupt(uint32_t late, uint32_t cycles);
+
+    // Copies an axis' ring, oldest first, returns the number of records
+    // still intact when the copy finished
+    int copyRing(int axis, StepTraceRecord *records);
+
+    // tickRate is the step timer frequency, cpuMhz scales CCOUNT
+    void writeMetrics(MetricsWriter &writer, uint32_t tickRate, uint32_t cpuMhz);
+
+    volatile bool enabled;
+    uint32_t delayThreshold;            // ticks late before a step counts as delayed
+
+    Histogram latency;                  // interrupt entry after alarm, ticks
+    Histogram duration;                 // interrupt run time, cycles
+    unsigned long steps[STEP_TRACE_AXES];
+    unsigned long delayed[STEP_TRACE_AXES];
+
+  private:
+    void clear();
+
+    volatile bool resetPending;
+    StepTraceRecord ring[STEP_TRACE_AXES][STEP_TRACE_RING];
+    uint32_t head[STEP_TRACE_AXES];
+};
+
+#endif
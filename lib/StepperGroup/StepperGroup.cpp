@@ -0,0 +1,191 @@
+/*
+ * StepperGroup - coordinated multi-axis moves, see StepperGroup.h
+ */
+
+#include "StepperGroup.h"
+
+StepperGroup::StepperGroup() : planner(TIMER_SCALE)
+{
+  this->axisCount = 0;
+  this->acceleration = 4000;
+  this->jerk = 0;
+  this->total = 0;
+  this->done = 0;
+  this->cruise = 0;
+  this->exitRate = 0;
+  this->moving = false;
+  this->next = NULL;
+  this->nextArg = NULL;
+  this->movesCompleted = 0;
+  this->scheduler = NULL;
+  this->slot = -1;
+}
+
+int StepperGroup::add(StepperTimer *stepper)
+{
+  if (this->moving || this->axisCount >= STEPPER_GROUP_MAX_AXES)
+    return -1;
+  this->axes[this->axisCount] = stepper;
+  this->count[this->axisCount] = 0;
+  return this->axisCount++;
+}
+
+void StepperGroup::clear()
+{
+  if (!this->moving)
+    this->axisCount = 0;
+}
+
+void StepperGroup::halt()
+{
+  if (this->scheduler != NULL)
+    this->scheduler->cancel(this->slot);
+  this->planner.stop();
+  this->moving = false;
+}
+
+void StepperGroup::setScheduler(StepScheduler *scheduler)
+{
+  this->scheduler = scheduler;
+  this->slot = scheduler->attach(onStep, this);
+}
+
+void StepperGroup::setAcceleration(unsigned long acceleration, unsigned long jerk)
+{
+  this->acceleration = acceleration;
+  this->jerk = jerk;
+  this->planner.setLimits(acceleration, jerk);
+}
+
+void StepperGroup::setNext(StepperGroupNext next, void *arg)
+{
+  this->next = next;
+  this->nextArg = arg;
+}
+
+bool StepperGroup::moveBy(const int32_t *deltas, uint32_t rate)
+{
+  return begin(deltas, rate << STEP_PLANNER_RATE_SHIFT, 0);
+}
+
+bool StepperGroup::begin(const int32_t *deltas, int32_t cruise, int32_t exitRate)
+{
+  if (this->moving || this->scheduler == NULL || this->slot < 0)
+    return false;
+  for (int i = 0; i < this->axisCount; i++)
+    if (this->axes[i]->isRunning())
+      return false;
+  for (int i = 0; i < this->axisCount; i++)
+  {
+    int microsteps = this->axes[i]->microsteps;
+    this->planner.limitsFor(this->acceleration * microsteps, this->jerk * microsteps, this->limits[i]);
+  }
+
+  if (load(deltas) == 0)
+  {
+    this->movesCompleted++;
+    return true;
+  }
+  int32_t minimum = this->planner.minimumRate();
+  this->cruise = cruise < minimum ? minimum : cruise;
+  this->exitRate = exitRate;
+  this->planner.setRate(0);
+  this->planner.start();
+  this->moving = true;
+  this->scheduler->wake(this->slot, 1);
+  return true;
+}
+
+bool IRAM_ATTR StepperGroup::chain(const int32_t *deltas, int32_t cruise, int32_t exitRate, uint32_t carry)
+{
+  if (load(deltas) == 0)
+    return false;
+  int32_t minimum = this->planner.minimumRate();
+  this->cruise = cruise < minimum ? minimum : cruise;
+  this->exitRate = exitRate;
+  this->planner.rate = (int32_t)(((uint64_t)this->planner.rate * carry) >> 16);
+  return true;
+}
+
+// Sets up the interpolator and the master's limits for a move, returns
+// its master step count
+uint32_t IRAM_ATTR StepperGroup::load(const int32_t *deltas)
+{
+  uint32_t total = 0;
+  int master = 0;
+  for (int i = 0; i < this->axisCount; i++)
+  {
+    this->forward[i] = deltas[i] >= 0;
+    this->count[i] = deltas[i] >= 0 ? deltas[i] : -deltas[i];
+    if (this->count[i] > total)
+    {
+      total = this->count[i];
+      master = i;
+    }
+  }
+  if (total > 0)
+    this->planner.useLimits(this->limits[master]);
+
+  // Start each error term half way, so slaved steps fall in the middle of
+  // their share of the master's steps rather than at one end
+  for (int i = 0; i < this->axisCount; i++)
+    this->error[i] = total >> 1;
+  this->total = total;
+  this->done = 0;
+  return total;
+}
+
+bool StepperGroup::moveTo(const int64_t *targets, uint32_t rate)
+{
+  int32_t deltas[STEPPER_GROUP_MAX_AXES];
+  for (int i = 0; i < this->axisCount; i++)
+    deltas[i] = (int32_t)(targets[i] - this->axes[i]->getPosition());
+  return moveBy(deltas, rate);
+}
+
+uint32_t IRAM_ATTR StepperGroup::onStep(void *arg)
+{
+  return ((StepperGroup *)arg)->step();
+}
+
+uint32_t IRAM_ATTR StepperGroup::step()
+{
+  uint32_t remaining = this->total - this->done;
+  if (remaining == 0)
+  {
+    this->movesCompleted++;
+    if (this->next != NULL && this->next(*this, this->nextArg))
+    {
+      remaining = this->total;
+    }
+    else
+    {
+      this->planner.stop();
+      this->moving = false;
+      return 0;
+    }
+  }
+
+  // Cruise, then brake to the exit rate - the minimum rate when stopping -
+  // for the last steps
+  int32_t exitRate = this->exitRate;
+  int32_t minimum = this->planner.minimumRate();
+  if (exitRate < minimum)
+    exitRate = minimum;
+  bool braking = remaining <= this->planner.brakingSteps(exitRate);
+  this->planner.braking = braking;
+  this->planner.target = braking ? exitRate : this->cruise;
+  uint32_t ticks = this->planner.next();
+
+  for (int i = 0; i < this->axisCount; i++)
+  {
+    this->error[i] += this->count[i];
+    if ((uint32_t)this->error[i] >= this->total)
+    {
+      this->error[i] -= this->total;
+      this->axes[i]->stepOnce(this->forward[i]);
+    }
+  }
+  this->done++;
+  return ticks;
+}
@@ -0,0 +1,103 @@
+/*
+ * StepperGroup - coordinated straight line moves over several steppers
+ *
+ * One StepPlanner ramps the axis with the most steps to go (the master),
+ * and a DDA (Bresenham) interpolator slaves the other axes to its step
+ * clock: every master step adds each axis' step count to its error term
+ * and steps the axis whenever that overflows the master's count. All axes
+ * start and finish together and stay within half a step of the straight
+ * line between, driven by one scheduler slot - one interrupt per master
+ * step however many axes move.
+ *
+ * Moves can be chained: a continuation callback, called from the interrupt
+ * as a move's last step is taken, may load the next move with chain() and
+ * the group carries on at its current rate, braking only to the exit rate
+ * the caller planned for the junction.
+ *
+ * Members must be idle when a move starts, and must not be given speed or
+ * move commands of their own until it ends.
+ */
+
+#ifndef StepperGroup_h
+#define StepperGroup_h
+
+#include "esp_attr.h"
+#include "esp_types.h"
+#include "StepperTimer.h"
+#include "StepScheduler.h"
+#include "StepPlanner.h"
+
+#define STEPPER_GROUP_MAX_AXES 4
+
+class StepperGroup;
+
+// Called from the interrupt when a move is done, true if it chained another
+typedef bool (*StepperGroupNext)(StepperGroup &group, void *arg);
+
+class StepperGroup {
+  public:
+    StepperGroup();
+
+    // Adds an axis, returns its index or -1 when full
+    int add(StepperTimer *stepper);
+    void clear();
+    void setScheduler(StepScheduler *scheduler);
+    // acceleration in full steps/s^2, jerk in full steps/s^3, applied along
+    // the master axis - scaled by its microsteps as each move is loaded, as
+    // a StepperTimer does its own
+    void setAcceleration(unsigned long acceleration, unsigned long jerk);
+    // Steps per full step of an axis in its current mode
+    int microsteps(int axis) { return axis < this->axisCount ? this->axes[axis]->microsteps : 1; }
+
+    // Moves every axis by its delta, the master axis at up to rate steps/s.
+    // False if an axis is still busy or there is no scheduler.
+    bool moveBy(const int32_t *deltas, uint32_t rate);
+    bool moveTo(const int64_t *targets, uint32_t rate);
+    bool isMoving() { return this->moving; }
+    // Stops dead wherever the move is, it isn't counted as completed
+    void halt();
+
+    // Starts a move from rest that cruises at cruise and ends at exitRate
+    // (both Q24.8 steps/s of the master axis), for a continuation to chain on
+    bool begin(const int32_t *deltas, int32_t cruise, int32_t exitRate);
+    // From the continuation only: loads the next move, carrying the current
+    // rate over scaled by carry (Q16) as the master axis may change
+    bool chain(const int32_t *deltas, int32_t cruise, int32_t exitRate, uint32_t carry);
+    void setNext(StepperGroupNext next, void *arg);
+    // Lowers or raises the current move's exit rate while it runs
+    void setExitRate(int32_t exitRate) { this->exitRate = exitRate; }
+
+    // Takes one master step, returns the ticks to the next or 0 when done
+    uint32_t step();
+
+    StepPlanner planner;
+    volatile unsigned long movesCompleted;
+
+  private:
+    static uint32_t onStep(void *arg);
+    uint32_t load(const int32_t *deltas);
+
+    StepperTimer *axes[STEPPER_GROUP_MAX_AXES];
+    uint32_t count[STEPPER_GROUP_MAX_AXES];   // steps of each axis in this move
+    int32_t error[STEPPER_GROUP_MAX_AXES];
+    bool forward[STEPPER_GROUP_MAX_AXES];
+    int axisCount;
+    unsigned long acceleration;   // full steps/s^2
+    unsigned long jerk;
+    // the limits with each axis as the master, converted when a move
+    // starts - members don't change mode while it runs
+    StepPlannerLimits limits[STEPPER_GROUP_MAX_AXES];
+
+    uint32_t total;           // master steps in this move
+    uint32_t done;
+    int32_t cruise;           // Q24.8 steps/s
+    volatile int32_t exitRate;
+    volatile bool moving;
+    StepperGroupNext next;
+    void *nextArg;
+
+    StepScheduler *scheduler;
+    int slot;
+};
+
+#endif
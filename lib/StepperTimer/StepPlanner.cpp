@@ -0,0 +1,206 @@
+/*
+ * StepPlanner - fixed-point acceleration planner, see StepPlanner.h
+ */
+
+#include "StepPlanner.h"
+
+static uint32_t isqrt(uint32_t value)
+{
+  uint32_t root = 0;
+  uint32_t bit = 1UL << 30;
+  while (bit > value)
+    bit >>= 2;
+  while (bit != 0) {
+    if (value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+  return root;
+}
+
+StepPlanner::StepPlanner(uint32_t tickRate)
+{
+  this->tickRate = tickRate;
+  this->tickScale = tickRate << STEP_PLANNER_RATE_SHIFT;
+  this->target = 0;
+  this->rate = 0;
+  this->accel = 0;
+  this->braking = false;
+  this->interval = 0;
+  this->running = false;
+  setLimits(4000, 0);
+}
+
+/*
+ * Converts the limits into per-tick increments once, so next() never has to
+ * divide by the tick rate.
+ */
+void StepPlanner::setLimits(uint32_t acceleration, uint32_t jerk)
+{
+  StepPlannerLimits limits;
+  limitsFor(acceleration, jerk, limits);
+  useLimits(limits);
+}
+
+void StepPlanner::limitsFor(uint32_t acceleration, uint32_t jerk, StepPlannerLimits &limits)
+{
+  if (acceleration < 1)
+    acceleration = 1;
+  // twice it still fits in 32 bits for brakingSteps()
+  if (acceleration > 0x7FFFFFFF)
+    acceleration = 0x7FFFFFFF;
+  if (jerk > 0xFFFFFF)
+    jerk = 0xFFFFFF;
+  limits.acceleration = acceleration;
+
+  // steps/s^2 -> Q8 steps/s gained per tick, scaled by 2^16
+  limits.accelMax = (uint32_t)(((uint64_t)acceleration << (STEP_PLANNER_RATE_SHIFT + STEP_PLANNER_ACCEL_SHIFT)) / this->tickRate);
+  // steps/s^3 -> accelMax units gained per tick, scaled by 2^16
+  limits.jerkStep = (uint32_t)((((uint64_t)jerk << 40) / this->tickRate) / this->tickRate);
+  if (jerk != 0 && limits.jerkStep == 0)
+    limits.jerkStep = 1;
+
+  // The first step of a ramp from standstill, c0 = sqrt(2 / a)
+  uint32_t minimum = isqrt(acceleration / 2);
+  limits.rateMin = (minimum < 1 ? 1 : minimum) << STEP_PLANNER_RATE_SHIFT;
+}
+
+void IRAM_ATTR StepPlanner::useLimits(const StepPlannerLimits &limits)
+{
+  this->acceleration = limits.acceleration;
+  this->accelMax = limits.accelMax;
+  this->jerkStep = limits.jerkStep;
+  this->rateMin = limits.rateMin;
+}
+
+void StepPlanner::setTarget(int32_t rate)
+{
+  this->target = rate;
+  this->braking = false;
+}
+
+void StepPlanner::setRate(int32_t rate)
+{
+  this->target = rate;
+  this->rate = rate;
+  this->accel = 0;
+  this->braking = false;
+}
+
+void StepPlanner::start()
+{
+  this->interval = 0;
+  this->running = true;
+}
+
+void StepPlanner::stop()
+{
+  this->target = 0;
+  this->rate = 0;
+  this->accel = 0;
+  this->braking = false;
+  this->interval = 0;
+  this->running = false;
+}
+
+uint32_t IRAM_ATTR StepPlanner::stoppingSteps()
+{
+  return brakingSteps(0);
+}
+
+/*
+ * (v^2 - u^2) / 2a at the full acceleration, see braking. Rounded up with a
+ * couple of steps of margin, as the ramp only changes the rate once per step.
+ * Rates over 16 bits (RMT step generation) are squared at a coarser
+ * resolution, rounded up, to stay in 32 bits. The rounding is done after
+ * the divide, so a large acceleration (microstepped, or RMT) can't carry
+ * the sum past 32 bits either.
+ */
+uint32_t IRAM_ATTR StepPlanner::brakingSteps(uint32_t toRate)
+{
+  int32_t rate = this->rate;
+  uint32_t speed = (uint32_t)(rate > 0 ? rate : -rate) >> STEP_PLANNER_RATE_SHIFT;
+  uint32_t end = toRate >> STEP_PLANNER_RATE_SHIFT;
+  if (speed < end)
+    return 0;
+  int shift = 0;
+  while (speed > 0xFFFF)
+  {
+    speed = (speed + 1) >> 1;
+    end >>= 1;
+    shift += 2;
+  }
+  uint32_t twice = this->acceleration << 1;
+  uint32_t squares = speed * speed - end * end;
+  uint32_t steps = squares / twice;
+  if (squares % twice != 0)
+    steps++;
+  if (steps > (0xFFFFFFFFUL >> shift) - 2)
+    return 0xFFFFFFFFUL;
+  return (steps << shift) + 2;
+}
+
+uint32_t IRAM_ATTR StepPlanner::next()
+{
+  uint32_t dt = this->interval;
+  int32_t target = this->target;
+  int32_t rate = this->rate;
+  int32_t err = target - rate;
+
+  if (err == 0) {
+    this->accel = 0;
+  } else if (dt != 0) {
+    int32_t accelMax = err > 0 ? (int32_t)this->accelMax : -(int32_t)this->accelMax;
+    int32_t accel = this->accel;
+
+    if (this->jerkStep == 0 || this->braking) {
+      accel = accelMax;
+    } else {
+      int32_t change = (int32_t)(((uint64_t)this->jerkStep * dt) >> STEP_PLANNER_ACCEL_SHIFT);
+      uint32_t distance = err > 0 ? err : -err;
+      uint32_t magnitude = accel > 0 ? accel : -accel;
+      // The rate still gained while the acceleration is ramped back to
+      // zero is a^2 / 2j, start easing off once that covers the remainder
+      bool easing = ((accel > 0) == (err > 0)) && accel != 0 &&
+        (uint64_t)distance * 2 * this->jerkStep <= (uint64_t)magnitude * magnitude;
+      if (easing) {
+        if (magnitude <= (uint32_t)change)
+          accel = 0;
+        else
+          accel += accel > 0 ? -change : change;
+      } else if (accel < accelMax) {
+        accel = (accelMax - accel < change) ? accelMax : accel + change;
+      } else if (accel > accelMax) {
+        accel = (accel - accelMax < change) ? accelMax : accel - change;
+      }
+    }
+
+    rate += (int32_t)(((int64_t)accel * dt) >> STEP_PLANNER_ACCEL_SHIFT);
+    if ((err > 0 && rate >= target) || (err < 0 && rate <= target)) {
+      rate = target;
+      accel = 0;
+    }
+    this->accel = accel;
+    this->rate = rate;
+  }
+
+  uint32_t magnitude = rate > 0 ? rate : -rate;
+  if (magnitude < this->rateMin) {
+    if (target == 0) {
+      // Came to rest
+      this->rate = 0;
+      this->accel = 0;
+      this->interval = 0;
+      this->running = false;
+      return 0;
+    }
+    magnitude = this->rateMin;
+  }
+
+  this->interval = this->tickScale / magnitude;
+  return this->interval;
+}
@@ -0,0 +1,87 @@
+/*
+ * StepPlanner - fixed-point acceleration planner for StepperTimer
+ *
+ * Computes the interval to the next step incrementally, one step at a time,
+ * from inside the timer interrupt. Rates are held in steps/s as Q24.8 fixed
+ * point and the acceleration is integrated over the interval that has just
+ * elapsed, so the profile only depends on the step clock and not on how
+ * often loop() runs.
+ *
+ * With jerk set to 0 the profile is trapezoidal (the acceleration jumps to
+ * its limit). With a non-zero jerk the acceleration itself is ramped, and
+ * ramped back down early enough to arrive at the target rate with zero
+ * acceleration (S-curve).
+ *
+ * next() only uses integer adds, multiplies, shifts and a single 32-bit
+ * divide - no floating point and no 64-bit divide library calls, so it is
+ * safe to run from IRAM.
+ */
+
+#ifndef StepPlanner_h
+#define StepPlanner_h
+
+#include "esp_attr.h"
+#include "esp_types.h"
+
+#define STEP_PLANNER_RATE_SHIFT   8     // rates are Q24.8 steps/s
+#define STEP_PLANNER_ACCEL_SHIFT  16    // acceleration fraction bits per tick
+
+// Limits converted to the planner's per tick units, see limitsFor()
+struct StepPlannerLimits {
+  uint32_t acceleration;    // steps/s^2
+  uint32_t accelMax;
+  uint32_t jerkStep;
+  uint32_t rateMin;
+};
+
+class StepPlanner {
+  public:
+    // tickRate is the step timer frequency in Hz (at most 16MHz)
+    StepPlanner(uint32_t tickRate);
+
+    // acceleration in steps/s^2, jerk in steps/s^3 (0 = trapezoidal)
+    void setLimits(uint32_t acceleration, uint32_t jerk);
+    // The same conversion done ahead, for useLimits() to switch to from
+    // the interrupt without dividing
+    void limitsFor(uint32_t acceleration, uint32_t jerk, StepPlannerLimits &limits);
+    void useLimits(const StepPlannerLimits &limits);
+    // rate to ramp towards, steps/s in Q24.8
+    void setTarget(int32_t rate);
+    // jump to a rate immediately, without ramping
+    void setRate(int32_t rate);
+    // prepare to take the first step after being stopped
+    void start();
+    // stop dead, for when the last step of a move has been taken
+    void stop();
+    // advance one step, returns the ticks until the next step or 0 to stop
+    uint32_t next();
+
+    bool isRunning() { return this->running; }
+    bool forward() { return this->rate > 0 || (this->rate == 0 && this->target > 0); }
+    // slowest rate stepped at, safe to stop dead from
+    uint32_t minimumRate() { return this->rateMin; }
+    // steps needed to brake from the current rate to a stop, or to a lower
+    // rate (Q24.8)
+    uint32_t stoppingSteps();
+    uint32_t brakingSteps(uint32_t toRate);
+
+    volatile int32_t target;  // Q24.8 steps/s
+    volatile int32_t rate;    // Q24.8 steps/s
+    int32_t accel;            // Q8 steps/s per tick, scaled by 2^16
+    // Brake at the full acceleration regardless of jerk, so a position move
+    // stops within stoppingSteps() - a jerk limited ramp can't promise that
+    // once it is already accelerating the other way
+    bool braking;
+
+  private:
+    uint32_t tickScale;       // tickRate in Q24.8, divided by a rate to give an interval
+    uint32_t tickRate;
+    uint32_t acceleration;    // steps/s^2
+    uint32_t accelMax;
+    uint32_t jerkStep;
+    uint32_t rateMin;         // slowest rate we step at, also the start rate
+    uint32_t interval;        // ticks since the previous step
+    volatile bool running;
+};
+
+#endif
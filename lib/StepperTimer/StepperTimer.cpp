@@ -54,15 +54,45 @@
 
 #include "StepperTimer.h"
 
+// Coil sequences, bit 0 drives motor_pin_1 through to bit 3 for motor_pin_4.
+// Every other half step lines up with the full step of half its phase.
+static constexpr uint8_t halfSequence[8] = { 0x5, 0x4, 0x6, 0x2, 0xA, 0x8, 0x9, 0x1 };
+static constexpr uint8_t fullSequence[4] = { 0x5, 0x6, 0xA, 0x9 };
+static constexpr uint8_t waveSequence[4] = { 0x1, 0x4, 0x2, 0x8 };
+
+// PWM duty over a quarter of a sine wave in 32 steps, read from the step
+// interrupt so it is kept in DRAM
+static const DRAM_ATTR uint8_t quarterSine[33] = {
+  0, 13, 25, 37, 50, 62, 74, 86, 98, 109, 120, 131, 142, 152, 162, 171, 180,
+  189, 197, 205, 212, 219, 225, 231, 236, 240, 244, 247, 250, 252, 254, 255, 255
+};
+
+// Signed duty at an angle in 128ths of a turn
+static inline int32_t IRAM_ATTR sineDuty(unsigned angle)
+{
+  unsigned index = angle & 31;
+  int32_t duty = (angle & 32) ? quarterSine[32 - index] : quarterSine[index];
+  return (angle & 64) ? -duty : duty;
+}
+
 /*
  *   constructor for four-pin version
  *   Sets which wires should control the motor.
  */
 StepperTimer::StepperTimer(int number_of_steps, timer_group_t group, timer_idx_t index, 
-    int motor_pin_1, int motor_pin_2, int motor_pin_3, int motor_pin_4)
+    int motor_pin_1, int motor_pin_2, int motor_pin_3, int motor_pin_4) : planner(TIMER_SCALE)
 {
   this->step_number = 0;    // which step the motor is on
   this->number_of_steps = number_of_steps; // total number of steps for this motor
+  this->speed = 0;
+  this->targetSpeed = 0;
+  this->stepWaitTicks = 8000UL;
+
+  // A speed of 1 is one full step every number_of_steps * 3000 ticks
+  this->microsteps = 1;
+  this->rateScale = (int32_t)(((uint64_t)TIMER_SCALE << STEP_PLANNER_RATE_SHIFT) / ((uint64_t)number_of_steps * 3000));
+  this->acceleration = 4000;
+  this->jerk = 0;
 
   // Arduino pins for the motor control connection:
   this->motor_pin_1 = motor_pin_1;
@@ -76,77 +106,548 @@ StepperTimer::StepperTimer(int number_of_steps, timer_group_t group, timer_idx_t
   this->index = index;
   this->group = group;
   this->pin_count = 4;
+  this->scheduler = NULL;
+  this->slot = -1;
+  this->isr = NULL;
+
+  this->position = 0;
+  this->moveTarget = 0;
+  this->moving = false;
+  this->moveRate = 0;
+  this->movesCompleted = 0;
+
+  this->phase = 0;
+  this->microShift = 0;
+  this->sequence = fullSequence;
+  this->energised = false;
+  this->holdReduced = false;
+  this->holdRequest = 0;
+  for (int c = 0; c < 2; c++)
+  {
+    this->coilChannel[c] = -1;
+    this->coilSign[c] = 0;
+  }
+  buildPhaseTable();
 }
 
-void StepperTimer::setTargetSpeed(signed long whatSpeed)
+/*
+ * Turns the coil sequence for the current mode into set/clear register
+ * masks for our pins, one entry per phase
+ */
+void StepperTimer::buildPhaseTable()
 {
-  this->targetSpeed = whatSpeed;
-  if(abs(this->speed) < 100)
+  const uint8_t *sequence = fullSequence;
+  int length = 4 * this->microsteps;
+  if (this->mode == half) {
+    sequence = halfSequence;
+  } else if (this->mode == wave) {
+    sequence = waveSequence;
+  } else if (this->mode == micro) {
+    // the table has 32 entries per full step
+    sequence = NULL;
+    this->microShift = 0;
+    while ((this->microsteps << this->microShift) < 32)
+      this->microShift++;
+  }
+
+  this->sequence = sequence;
+
+  int pins[4] = { this->motor_pin_1, this->motor_pin_2, this->motor_pin_3, this->motor_pin_4 };
+  uint64_t all = 0;
+  for (int c = 0; c < 4; c++)
+    if (pins[c] >= 0)
+      all |= 1ULL << pins[c];
+  this->coilMask[0] = (uint32_t)all;
+  this->coilMask[1] = (uint32_t)(all >> 32);
+  this->highBank = this->coilMask[1] != 0;
+
+  for (int p = 0; sequence != NULL && p < length; p++)
   {
-    setSpeed(whatSpeed);
+    uint64_t on = 0;
+    for (int c = 0; c < 4; c++)
+      if ((sequence[p] & (1 << c)) && pins[c] >= 0)
+        on |= 1ULL << pins[c];
+    uint64_t off = all & ~on;
+    this->phaseSet[p][0] = (uint32_t)on;
+    this->phaseSet[p][1] = (uint32_t)(on >> 32);
+    this->phaseClear[p][0] = (uint32_t)off;
+    this->phaseClear[p][1] = (uint32_t)(off >> 32);
   }
+
+  this->phaseMask = length - 1;
+  this->phase &= this->phaseMask;
+  this->stepsPerCycle = this->number_of_steps * this->microsteps;
+  if (this->step_number >= this->stepsPerCycle)
+    this->step_number = 0;
 }
 
-void StepperTimer::updateSpeed()
+/*
+ * Hands stepping over to a shared scheduler, this axis' own timer is then
+ * left alone
+ */
+void StepperTimer::setScheduler(StepScheduler *scheduler)
 {
-  if(this->speed < targetSpeed)
+  this->scheduler = scheduler;
+  this->slot = scheduler->attach(onStep, this);
+}
+
+uint32_t IRAM_ATTR StepperTimer::onStep(void *arg)
+{
+  return ((StepperTimer *)arg)->step();
+}
+
+int32_t StepperTimer::toRate(signed long whatSpeed)
+{
+  return (int32_t)whatSpeed * this->rateScale;
+}
+
+/*
+ * Ramps towards a speed at the planner's acceleration, the ramp itself
+ * is computed step by step in the timer interrupt
+ */
+void StepperTimer::setTargetSpeed(signed long whatSpeed)
+{
+  this->moving = false;
+  this->targetSpeed = whatSpeed;
+  this->planner.setTarget(toRate(whatSpeed));
+  if(whatSpeed != 0 && !this->planner.isRunning())
   {
-    setSpeed(this->speed+1);
+    start();
   }
-  if(this->speed > targetSpeed)
+}
+
+/*
+ * A full step rate scales to steps of the current mode, the speed units
+ * are only worked out for reporting
+ */
+void StepperTimer::setTargetRate(int32_t rate)
+{
+  this->moving = false;
+  rate *= this->microsteps;
+  this->targetSpeed = rate / this->rateScale;
+  this->planner.setTarget(rate);
+  if(rate != 0 && !this->planner.isRunning())
   {
-    setSpeed(this->speed-1);
+    start();
   }
 }
 
 /*
- * Sets the speed in revs per minute
+ * Refreshes speed from the planner's current rate, for reporting only -
+ * ramping no longer depends on this being called
+ */
+void StepperTimer::updateSpeed()
+{
+  this->speed = this->planner.rate / this->rateScale;
+}
+
+/*
+ * Sets the speed in revs per minute, immediately and without ramping
  */
 void StepperTimer::setSpeed(signed long whatSpeed)
 {
+  this->moving = false;
   this->speed = whatSpeed;
+  this->targetSpeed = whatSpeed;
+  this->planner.setRate(toRate(whatSpeed));
   if(whatSpeed != 0)
   {
-    this->stepWaitTicks = (long)(((double)this->number_of_steps / (double)abs(whatSpeed)) * 3000.0);
-    // Reset Alarm and set new value
-    timer_set_alarm_value(this->group, this->index, this->stepWaitTicks);
-    timer_set_alarm(this->group, this->index, TIMER_ALARM_EN);
+    if(!this->planner.isRunning())
+      start();
   } else {
     this->stepWaitTicks = 8000UL;
   }
 }
 
-void StepperTimer::setMode(modeEnum mode)
+/*
+ * Acceleration in steps/s^2 and jerk in steps/s^3 (0 for a trapezoidal ramp)
+ */
+void StepperTimer::setAcceleration(unsigned long acceleration, unsigned long jerk)
+{
+  this->acceleration = acceleration;
+  this->jerk = jerk;
+  this->planner.setLimits(acceleration * this->microsteps, jerk * this->microsteps);
+}
+
+bool StepperTimer::isRunning()
+{
+  return this->planner.isRunning();
+}
+
+/*
+ * The interrupt updates the 64-bit position in two halves, read it until
+ * two reads agree
+ */
+int64_t StepperTimer::getPosition()
+{
+  int64_t position;
+  do {
+    position = this->position;
+  } while (position != this->position);
+  return position;
+}
+
+void StepperTimer::setPosition(int64_t position)
+{
+  if (!this->planner.isRunning())
+    this->position = position;
+}
+
+void StepperTimer::moveTo(int64_t target, signed long maxSpeed)
+{
+  runTo(target, toRate(maxSpeed));
+}
+
+void StepperTimer::moveToRate(int64_t target, int32_t maxRate)
+{
+  runTo(target, maxRate * this->microsteps);
+}
+
+// rate in steps of the current mode
+void StepperTimer::runTo(int64_t target, int32_t rate)
+{
+  // The interrupt stops steering while the target is rewritten
+  this->moving = false;
+  __sync_synchronize();
+  this->moveTarget = target;
+  this->moveRate = rate < 0 ? -rate : rate;
+  if (this->moveRate < (int32_t)this->planner.minimumRate())
+    this->moveRate = this->planner.minimumRate();
+  __sync_synchronize();
+  this->moving = true;
+
+  if (!this->planner.isRunning())
+  {
+    if (target == getPosition())
+    {
+      this->moving = false;
+      this->movesCompleted++;
+      return;
+    }
+    start();
+  }
+}
+
+void StepperTimer::moveBy(int64_t steps, signed long maxSpeed)
+{
+  moveTo(getPosition() + steps, maxSpeed);
+}
+
+/*
+ * Sets the planner's target for a move from the steps left to go: cruise
+ * towards the target, brake to creep at the minimum rate once inside the
+ * braking distance, and turn round after an overshoot. Returns false once the
+ * target is reached at a rate it is safe to stop dead from - a one step
+ * ramp ends at up to sqrt(2a), twice the minimum rate.
+ */
+bool IRAM_ATTR StepperTimer::steerMove()
+{
+  int64_t remaining = this->moveTarget - this->position;
+  int32_t rate = this->planner.rate;
+  uint32_t speed = rate > 0 ? rate : -rate;
+  uint32_t creep = this->planner.minimumRate();
+
+  if (remaining == 0 && speed <= 2 * creep)
+    return false;
+
+  int32_t direction;
+  if (remaining == 0)
+    direction = rate > 0 ? -1 : 1;
+  else
+    direction = remaining > 0 ? 1 : -1;
+
+  uint64_t distance = remaining < 0 ? -remaining : remaining;
+  bool braking = distance <= this->planner.stoppingSteps();
+  this->planner.braking = braking;
+  this->planner.target = direction * (braking ? (int32_t)creep : this->moveRate);
+  return true;
+}
+
+// Arm the alarm for the first step of a ramp from standstill
+void StepperTimer::start()
+{
+  this->planner.start();
+  this->stepWaitTicks = 1;
+  if (this->scheduler != NULL)
+  {
+    this->scheduler->wake(this->slot, this->stepWaitTicks);
+    return;
+  }
+  timer_set_alarm_value(this->group, this->index, this->stepWaitTicks);
+  timer_set_alarm(this->group, this->index, TIMER_ALARM_EN);
+}
+
+void StepperTimer::setMode(modeEnum mode, int microsteps)
 {
+  if (mode == micro && (this->coilChannel[0] < 0 || this->coilChannel[1] < 0))
+    mode = full;  // nothing to drive the coils with
+
+  // a power of two from 4 to 32 for micro
+  int steps = mode == half ? 2 : mode == micro ? 4 : 1;
+  while (mode == micro && steps < microsteps && steps < 32)
+    steps <<= 1;
+  if (mode == this->mode && steps == this->microsteps)
+    return;
+
+  this->coast();
+  if (this->mode == micro && mode != micro)
+    releaseCoils();
+
+  // Keep the rotor where it is, in steps of the new mode
+  int previous = this->microsteps;
+  this->position = this->position * steps / previous;
+  this->phase = this->phase * steps / previous;
+  this->step_number = this->step_number * steps / previous;
+
   this->mode = mode;
+  this->microsteps = steps;
+  this->rateScale = this->rateScale / previous * steps;
+  this->planner.setLimits(this->acceleration * steps, this->jerk * steps);
+  buildPhaseTable();
+}
+
+void StepperTimer::setCoilChannels(int channelA, int channelB)
+{
+  this->coilChannel[0] = channelA;
+  this->coilChannel[1] = channelB;
+}
+
+/*
+ * Sets one coil's current from a signed duty. The PWM goes to the pin on
+ * the side of the bridge for the sign and the other side is held low, the
+ * routing only changes when the current changes sign.
+ */
+void IRAM_ATTR StepperTimer::driveCoil(int coil, int32_t duty)
+{
+  int8_t sign = duty < 0 ? -1 : duty > 0 ? 1 : this->coilSign[coil];
+  int channel = this->coilChannel[coil];
+  if (sign != this->coilSign[coil] && sign != 0)
+  {
+    int positive = coil == 0 ? this->motor_pin_1 : this->motor_pin_3;
+    int negative = coil == 0 ? this->motor_pin_2 : this->motor_pin_4;
+    uint32_t signal = channel < 8 ? LEDC_HS_SIG_OUT0_IDX + channel : LEDC_LS_SIG_OUT0_IDX + channel - 8;
+    gpio_matrix_out(sign > 0 ? negative : positive, SIG_GPIO_OUT_IDX, false, false);
+    gpio_matrix_out(sign > 0 ? positive : negative, signal, false, false);
+    this->coilSign[coil] = sign;
+  }
+
+  // as ledcWrite(), which takes a lock and so can't be used here
+  int group = channel >> 3;
+  int index = channel & 7;
+  LEDC.channel_group[group].channel[index].duty.duty = (uint32_t)(duty < 0 ? -duty : duty) << 4;
+  LEDC.channel_group[group].channel[index].conf0.sig_out_en = 1;
+  LEDC.channel_group[group].channel[index].conf1.duty_start = 1;
+  if (group)
+    LEDC.channel_group[group].channel[index].conf0.val |= 1 << 4;  // low speed update
+}
+
+// Hands the coil pins back to plain GPIO, leaving them low
+void IRAM_ATTR StepperTimer::releaseCoils()
+{
+  int pins[4] = { this->motor_pin_1, this->motor_pin_2, this->motor_pin_3, this->motor_pin_4 };
+  for (int c = 0; c < 4; c++)
+    if (pins[c] >= 0)
+      gpio_matrix_out(pins[c], SIG_GPIO_OUT_IDX, false, false);
+  this->coilSign[0] = 0;
+  this->coilSign[1] = 0;
+}
+
+bool StepperTimer::reduceHold(int percent)
+{
+  if (percent < 1)
+    percent = 1;
+  if (percent >= 100 || !this->energised || this->coilChannel[0] < 0 || this->coilChannel[1] < 0)
+    return false;
+  this->holdRequest = percent;
+  if (this->scheduler != NULL)
+    this->scheduler->wake(this->slot, 1);
+  else if (!this->planner.isRunning())
+  {
+    // nothing else steps a standalone motor that isn't running
+    this->holdRequest = 0;
+    applyHold(percent);
+  }
+  return true;
+}
+
+/*
+ * The coil currents of the phase the motor stands on, scaled down, through
+ * the same PWM routing as micro mode. The full step patterns drive each
+ * energised coil at the full duty, micro mode its sine and cosine.
+ */
+void IRAM_ATTR StepperTimer::applyHold(int percent)
+{
+  if (!this->energised)
+    return;
+  int32_t a, b;
+  if (this->mode == micro)
+  {
+    unsigned angle = (this->phase << this->microShift) + 16;
+    a = sineDuty(angle + 32);
+    b = sineDuty(angle);
+  }
+  else
+  {
+    uint8_t coils = this->sequence[this->phase];
+    a = (coils & 0x1) ? 255 : (coils & 0x2) ? -255 : 0;
+    b = (coils & 0x4) ? 255 : (coils & 0x8) ? -255 : 0;
+  }
+  driveCoil(0, a * percent / 100);
+  driveCoil(1, b * percent / 100);
+  this->holdReduced = true;
+}
+
+// Back to full current, the pins of a full step mode back on GPIO
+void IRAM_ATTR StepperTimer::restoreCoils()
+{
+  if (this->mode != micro)
+    releaseCoils();
+  this->holdReduced = false;
 }
 
-void StepperTimer::step()
+/*
+ * Called from the timer interrupt at every step boundary. Takes the step
+ * and reloads the alarm with the planner's interval to the next one.
+ * Returns that interval, or 0 once the motor has come to rest.
+ */
+unsigned long IRAM_ATTR StepperTimer::step()
 {
-  if (this->speed == 0)
+  // Woken only to turn the holding current down, a step started since
+  // takes precedence
+  uint8_t hold = this->holdRequest;
+  this->holdRequest = 0;
+  if (hold != 0 && !this->moving && !this->planner.isRunning())
+  {
+    applyHold(hold);
+    return 0;
+  }
+
+  if (this->moving && !steerMove())
+  {
+    // Landed, hold the coils where they are
+    this->planner.stop();
+    this->moving = false;
+    this->movesCompleted++;
+    return 0;
+  }
+
+  unsigned long ticks = this->planner.next();
+  if (ticks == 0)
   {
      this->coast();
   } else {
-    if (this->speed > 0)
+    this->stepOnce(this->planner.forward());
+    if (ticks != this->stepWaitTicks)
     {
-      this->step_number++;
-      if (this->step_number >= this->number_of_steps * (this->mode == half ? 2 : 1)) {
-        this->step_number = 0;
-      }
-    } else {
-      if (this->step_number == 0) {
-        this->step_number = this->number_of_steps * (this->mode == half ? 2 : 1);
-      }
-      this->step_number--;
+      this->stepWaitTicks = ticks;
+      if (this->scheduler == NULL)
+        timer_set_alarm_value(this->group, this->index, ticks);
+    }
+  }
+  return ticks;
+}
+
+/*
+ * Advances the coil phase and position one step and drives the coils.
+ * Only call from the step interrupt, or while nothing else steps this motor.
+ */
+void IRAM_ATTR StepperTimer::stepOnce(bool forward)
+{
+  if (forward)
+  {
+    this->phase = (this->phase + 1) & this->phaseMask;
+    this->position++;
+    this->step_number++;
+    if (this->step_number >= this->stepsPerCycle) {
+      this->step_number = 0;
     }
-    this->stepMotor(this->step_number % (this->mode == half ? 8 : 4));
+  } else {
+    this->phase = (this->phase - 1) & this->phaseMask;
+    this->position--;
+    if (this->step_number == 0) {
+      this->step_number = this->stepsPerCycle;
+    }
+    this->step_number--;
   }
+  this->stepMotor(this->phase);
+}
+
+// Timer Interrupt when driven standalone
+static void IRAM_ATTR stepperTimerInt(void *para)
+{
+  StepperTimer *stepper = (StepperTimer *)para;
+  // Clear Timer
+  if (stepper->group == TIMER_GROUP_0)
+  {
+    if (stepper->index == TIMER_0)
+      TIMERG0.int_clr_timers.t0 = 1;
+    else
+      TIMERG0.int_clr_timers.t1 = 1;
+  }
+  else
+  {
+    if (stepper->index == TIMER_0)
+      TIMERG1.int_clr_timers.t0 = 1;
+    else
+      TIMERG1.int_clr_timers.t1 = 1;
+  }
+  // Reset Timer
+  if (stepper->step() != 0)
+    timer_set_alarm(stepper->group, stepper->index, TIMER_ALARM_EN);
+}
+
+/*
+ * Starts this motor's own timer, only needed when it is not attached to a
+ * StepScheduler. The timer and its interrupt are only set up the first
+ * time, later calls just restart it.
+ */
+void StepperTimer::spin()
+{
+  if (this->isr != NULL)
+  {
+    timer_set_alarm(this->group, this->index, TIMER_ALARM_EN);
+    timer_start(this->group, this->index);
+    return;
+  }
+
+  timer_config_t config;
+  config.divider = TIMER_DIVIDER;
+  config.counter_dir = TIMER_COUNT_UP;
+  config.counter_en = TIMER_PAUSE;
+  config.alarm_en = TIMER_ALARM_EN;
+  config.intr_type = TIMER_INTR_LEVEL;
+  config.auto_reload = true;
+
+  timer_init(this->group, this->index, &config);
+  timer_set_counter_value(this->group, this->index, 0x00000000ULL);
+  timer_set_alarm_value(this->group, this->index, this->stepWaitTicks);
+  timer_set_auto_reload(this->group, this->index, TIMER_AUTORELOAD_EN);
+  timer_enable_intr(this->group, this->index);
+  timer_isr_register(this->group, this->index, stepperTimerInt, (void *)this, ESP_INTR_FLAG_IRAM, &this->isr);
+  timer_start(this->group, this->index);
 }
 
 void StepperTimer::disconnect()
 {
-  timer_disable_intr(this->group, this->index);
-  timer_pause(this->group, this->index);
+  if (this->scheduler != NULL)
+    this->scheduler->cancel(this->slot);
+  else
+    timer_set_alarm(this->group, this->index, TIMER_ALARM_DIS);
+
+  this->moving = false;
+  this->planner.stop();
+  this->speed = 0;
+  this->targetSpeed = 0;
+  this->stepWaitTicks = 8000UL;
+  this->holdRequest = 0;
+  this->energised = false;
+
+  if (this->mode == micro || this->holdReduced)
+    releaseCoils();
+  this->holdReduced = false;
+  GPIO.out_w1tc = this->coilMask[0];
+  if (this->highBank)
+    GPIO.out1_w1tc.val = this->coilMask[1];
 }
 
 void StepperTimer::setPinMode(int motor_pin_1, int motor_pin_2, int motor_pin_3, int motor_pin_4)
@@ -157,7 +658,13 @@ void StepperTimer::setPinMode(int motor_pin_1, int motor_pin_2, int motor_pin_3,
   //set as output mode
   io_conf.mode = GPIO_MODE_OUTPUT;
   //bit mask of the pins that you want to set,e.g.all pins
-  io_conf.pin_bit_mask = ((1ULL<<motor_pin_1)|(1ULL<<motor_pin_2)|(1ULL<<motor_pin_3)|(1ULL<<motor_pin_4));
+  io_conf.pin_bit_mask = 0;
+  int pins[4] = { motor_pin_1, motor_pin_2, motor_pin_3, motor_pin_4 };
+  for (int c = 0; c < 4; c++)
+    if (pins[c] >= 0)   // -1, not fitted on this board
+      io_conf.pin_bit_mask |= 1ULL << pins[c];
+  if (io_conf.pin_bit_mask == 0)
+    return;
   //disable pull-down mode
   io_conf.pull_down_en = GPIO_PULLDOWN_DISABLE;
   //disable pull-up mode
@@ -168,122 +675,44 @@ void StepperTimer::setPinMode(int motor_pin_1, int motor_pin_2, int motor_pin_3,
 
 /*
  * Moves the motor forward or backwards.
+ * Clears then sets the coils with one register write each, so every coil
+ * in a bank switches at the same instant and never overlaps the next phase.
  */
-void StepperTimer::stepMotor(int thisStep)
+void IRAM_ATTR StepperTimer::stepMotor(int thisStep)
 {
-  if(this->mode == half)
+  if (this->holdReduced)
+    restoreCoils();
+  this->energised = true;
+  if (this->mode == micro)
   {
-    switch (thisStep) {
-      case 0:
-        gpio_set_level((gpio_num_t)motor_pin_1, 1);
-        gpio_set_level((gpio_num_t)motor_pin_2, 0);
-        gpio_set_level((gpio_num_t)motor_pin_3, 0);
-        gpio_set_level((gpio_num_t)motor_pin_4, 1);
-      break;
-      case 1: 
-        gpio_set_level((gpio_num_t)motor_pin_1, 1);
-        gpio_set_level((gpio_num_t)motor_pin_2, 0);
-        gpio_set_level((gpio_num_t)motor_pin_3, 0);
-        gpio_set_level((gpio_num_t)motor_pin_4, 0);
-      break;
-      case 2: 
-        gpio_set_level((gpio_num_t)motor_pin_1, 1);
-        gpio_set_level((gpio_num_t)motor_pin_2, 0);
-        gpio_set_level((gpio_num_t)motor_pin_3, 1);
-        gpio_set_level((gpio_num_t)motor_pin_4, 0);
-      break;
-      case 3:
-        gpio_set_level((gpio_num_t)motor_pin_1, 0);
-        gpio_set_level((gpio_num_t)motor_pin_2, 0);
-        gpio_set_level((gpio_num_t)motor_pin_3, 1);
-        gpio_set_level((gpio_num_t)motor_pin_4, 0);
-      break;
-      case 4:
-        gpio_set_level((gpio_num_t)motor_pin_1, 0);
-        gpio_set_level((gpio_num_t)motor_pin_2, 1);
-        gpio_set_level((gpio_num_t)motor_pin_3, 1);
-        gpio_set_level((gpio_num_t)motor_pin_4, 0);
-      break;
-      case 5:  
-        gpio_set_level((gpio_num_t)motor_pin_1, 0);
-        gpio_set_level((gpio_num_t)motor_pin_2, 1);
-        gpio_set_level((gpio_num_t)motor_pin_3, 0);
-        gpio_set_level((gpio_num_t)motor_pin_4, 0);
-      break;
-      case 6: 
-        gpio_set_level((gpio_num_t)motor_pin_1, 0);
-        gpio_set_level((gpio_num_t)motor_pin_2, 1);
-        gpio_set_level((gpio_num_t)motor_pin_3, 0);
-        gpio_set_level((gpio_num_t)motor_pin_4, 1);
-      break;
-      case 7: 
-        gpio_set_level((gpio_num_t)motor_pin_1, 0);
-        gpio_set_level((gpio_num_t)motor_pin_2, 0);
-        gpio_set_level((gpio_num_t)motor_pin_3, 0);
-        gpio_set_level((gpio_num_t)motor_pin_4, 1);
-      break;        
-    }
-  } else if(this->mode == full) {
-    switch (thisStep) {
-      case 0:  // 1010
-        gpio_set_level((gpio_num_t)motor_pin_1, 1);
-        gpio_set_level((gpio_num_t)motor_pin_2, 0);
-        gpio_set_level((gpio_num_t)motor_pin_3, 1);
-        gpio_set_level((gpio_num_t)motor_pin_4, 0);
-      break;
-      case 1:  // 0110
-        gpio_set_level((gpio_num_t)motor_pin_1, 0);
-        gpio_set_level((gpio_num_t)motor_pin_2, 1);
-        gpio_set_level((gpio_num_t)motor_pin_3, 1);
-        gpio_set_level((gpio_num_t)motor_pin_4, 0);
-      break;
-      case 2:  //0101
-        gpio_set_level((gpio_num_t)motor_pin_1, 0);
-        gpio_set_level((gpio_num_t)motor_pin_2, 1);
-        gpio_set_level((gpio_num_t)motor_pin_3, 0);
-        gpio_set_level((gpio_num_t)motor_pin_4, 1);
-      break;
-      case 3:  //1001
-        gpio_set_level((gpio_num_t)motor_pin_1, 1);
-        gpio_set_level((gpio_num_t)motor_pin_2, 0);
-        gpio_set_level((gpio_num_t)motor_pin_3, 0);
-        gpio_set_level((gpio_num_t)motor_pin_4, 1);
-      break;
-    }
-  } else if(this->mode == wave) {
-    switch (thisStep) {
-      case 0: 
-        gpio_set_level((gpio_num_t)motor_pin_1, 1);
-        gpio_set_level((gpio_num_t)motor_pin_2, 0);
-        gpio_set_level((gpio_num_t)motor_pin_3, 0);
-        gpio_set_level((gpio_num_t)motor_pin_4, 0);
-      break;
-      case 1:
-        gpio_set_level((gpio_num_t)motor_pin_1, 0);
-        gpio_set_level((gpio_num_t)motor_pin_2, 0);
-        gpio_set_level((gpio_num_t)motor_pin_3, 1);
-        gpio_set_level((gpio_num_t)motor_pin_4, 0);
-      break;
-      case 2: 
-        gpio_set_level((gpio_num_t)motor_pin_1, 0);
-        gpio_set_level((gpio_num_t)motor_pin_2, 1);
-        gpio_set_level((gpio_num_t)motor_pin_3, 0);
-        gpio_set_level((gpio_num_t)motor_pin_4, 0);
-      break;
-      case 3: 
-        gpio_set_level((gpio_num_t)motor_pin_1, 0);
-        gpio_set_level((gpio_num_t)motor_pin_2, 0);
-        gpio_set_level((gpio_num_t)motor_pin_3, 0);
-        gpio_set_level((gpio_num_t)motor_pin_4, 1);
-      break;
-    }    
+    // coil A follows cosine and coil B sine, 45 degrees in so that every
+    // full step lands on the same coil currents as the full sequence
+    unsigned angle = (thisStep << this->microShift) + 16;
+    driveCoil(0, sineDuty(angle + 32));
+    driveCoil(1, sineDuty(angle));
+    return;
+  }
+  GPIO.out_w1tc = this->phaseClear[thisStep][0];
+  GPIO.out_w1ts = this->phaseSet[thisStep][0];
+  if (this->highBank)
+  {
+    GPIO.out1_w1tc.val = this->phaseClear[thisStep][1];
+    GPIO.out1_w1ts.val = this->phaseSet[thisStep][1];
   }
 }
 
-void StepperTimer::coast()
+void IRAM_ATTR StepperTimer::coast()
 {
-    gpio_set_level((gpio_num_t)motor_pin_1, 0);
-    gpio_set_level((gpio_num_t)motor_pin_2, 0);
-    gpio_set_level((gpio_num_t)motor_pin_3, 0);
-    gpio_set_level((gpio_num_t)motor_pin_4, 0);  
+  if (this->holdReduced)
+    restoreCoils();
+  this->energised = false;
+  if (this->mode == micro)
+  {
+    driveCoil(0, 0);
+    driveCoil(1, 0);
+    return;
+  }
+  GPIO.out_w1tc = this->coilMask[0];
+  if (this->highBank)
+    GPIO.out1_w1tc.val = this->coilMask[1];
 }
@@ -61,15 +61,20 @@
 #include "soc/timer_group_struct.h"
 #include "driver/periph_ctrl.h"
 #include "driver/gpio.h"
+#include "soc/gpio_struct.h"
+#include "soc/gpio_sig_map.h"
+#include "soc/ledc_struct.h"
+#include "rom/gpio.h"
 #include "esp_types.h"
-
-#define TIMER_DIVIDER         16  //  Hardware timer clock divider
-#define TIMER_SCALE           (TIMER_BASE_CLK / TIMER_DIVIDER)  // convert counter value to seconds
+#include "StepPlanner.h"
+#include "StepScheduler.h"
 
 // library interface description
 class StepperTimer {
   public:
-    enum modeEnum { full, half, wave };
+    // micro drives the coils with sine/cosine PWM through the LEDC channels
+    // given to setCoilChannels(), microsteps per full step set by setMode()
+    enum modeEnum { full, half, wave, micro };
 
     // constructor:
     StepperTimer(int number_of_steps, timer_group_t group, timer_idx_t index, int motor_pin_1, int motor_pin_2,
@@ -78,11 +83,45 @@ class StepperTimer {
     void setSpeed(signed long whatSpeed);
     void updateSpeed();
     void setTargetSpeed(signed long whatSpeed);
+    // The same as a rate in full steps/s, Q24.8 as the planner takes it,
+    // for callers with finer steps than whole speed units
+    void setTargetRate(int32_t rate);
+    void setAcceleration(unsigned long acceleration, unsigned long jerk);
+    void setScheduler(StepScheduler *scheduler);
+    bool isRunning();
+    // Absolute position in steps of the current mode, counted since boot
+    // or the last setPosition()
+    int64_t getPosition();
+    void setPosition(int64_t position);
+    // Runs to a position at up to maxSpeed, braking to land on it exactly.
+    // Any speed command cancels the move.
+    void moveTo(int64_t target, signed long maxSpeed);
+    void moveBy(int64_t steps, signed long maxSpeed);
+    // With the cruise rate in full steps/s, Q24.8
+    void moveToRate(int64_t target, int32_t maxRate);
+    bool isMoving() { return this->moving; }
+    volatile unsigned long movesCompleted;  // moves that landed on their target
+    // Stops dead, cancelling any move, and leaves every coil pin low on
+    // plain GPIO. No step interrupt touches the pins after this returns.
     void disconnect();
-    void step();
+    unsigned long step();
+    // One step without the planner, for an axis slaved to a StepperGroup
+    void stepOnce(bool forward);
     void spin();
     void coast();
-    void setMode(modeEnum mode);
+    // Change mode while stopped. Speeds and accelerations stay in full steps,
+    // positions are rescaled to steps of the new mode.
+    void setMode(modeEnum mode, int microsteps = 16);
+    // LEDC channels already set up on motor_pin_1/2 and motor_pin_3/4, the
+    // two coil bridges, for the micro mode
+    void setCoilChannels(int channelA, int channelB);
+    // Turns the current of a motor holding still down to a percentage of
+    // full through the coil channels, in any mode. Done by the step
+    // interrupt, so it can't cross a step starting; the next step drives
+    // the coils at full current again. Nothing happens to coils that
+    // aren't energised, or without coil channels - false then.
+    bool reduceHold(int percent);
+    bool isHoldReduced() { return this->holdReduced; }
     timer_idx_t index;
     timer_group_t group;
 
@@ -93,8 +132,51 @@ class StepperTimer {
     void stepMotor(int this_step);
     signed long speed;
     modeEnum mode = full;
+    int microsteps;           // steps per full step in the current mode
+    StepPlanner planner;
 
   private:
+    // phase output, rebuilt by setMode() so step() only indexes tables
+    uint8_t phase;            // position in the coil sequence
+    uint8_t phaseMask;        // sequence length - 1
+    int stepsPerCycle;        // step_number wraps at this
+    bool highBank;            // any of our pins on GPIO32-39
+    uint32_t phaseSet[8][2];  // W1TS masks per phase, [0] GPIO0-31, [1] GPIO32-39
+    uint32_t phaseClear[8][2];
+    uint32_t coilMask[2];
+    void buildPhaseTable();
+    int8_t coilChannel[2];    // LEDC channel per coil, -1 until set
+    int8_t coilSign[2];       // which pin of each bridge has the PWM, 0 = neither
+    uint8_t microShift;       // phase -> quarter sine table index shift
+    void driveCoil(int coil, int32_t duty);
+    void releaseCoils();
+
+    const uint8_t *sequence;  // coil pattern per phase, NULL in micro
+    volatile bool energised;  // coils left driven by the last step
+    volatile bool holdReduced;
+    volatile uint8_t holdRequest;   // percent for the interrupt to apply, 0 for none
+    void applyHold(int percent);
+    void restoreCoils();
+
+    int32_t rateScale;        // planner rate (Q24.8 steps/s) per unit of speed
+    uint32_t acceleration;    // full steps/s^2, scaled by microsteps for the planner
+    uint32_t jerk;
+    int32_t toRate(signed long whatSpeed);
+    void runTo(int64_t target, int32_t rate);
+    bool steerMove();
+    void start();
+    static uint32_t onStep(void *arg);
+
+    // when set, steps come from a shared scheduler instead of our own timer
+    StepScheduler *scheduler;
+    int slot;
+    timer_isr_handle_t isr;   // our own timer's interrupt, registered once by spin()
+
+    // position moves, moveTarget is only read by the interrupt while moving
+    volatile int64_t position;
+    volatile int64_t moveTarget;
+    volatile bool moving;
+    int32_t moveRate;         // cruise rate, Q24.8 steps/s
     int pin_count;            // how many pins are in use.
 
     // motor pin numbers:
@@ -0,0 +1,134 @@
+/*
+ * TelemetryPublisher - delta encoded state frames, see TelemetryPublisher.h
+ */
+
+#include "TelemetryPublisher.h"
+#include <string.h>
+
+TelemetryPublisher::TelemetryPublisher(int fields)
+{
+  this->fields = fields > TELEMETRY_MAX_FIELDS ? TELEMETRY_MAX_FIELDS : fields;
+  memset(this->current, 0, sizeof(this->current));
+  memset(this->previous, 0, sizeof(this->previous));
+  memset(this->clients, 0, sizeof(this->clients));
+  memset(this->synced, 0, sizeof(this->synced));
+  this->sequence = 0;
+  this->frames = 0;
+  this->keyFrames = 0;
+  this->skips = 0;
+  this->bytes = 0;
+}
+
+void TelemetryPublisher::set(int field, int32_t value)
+{
+  if (field >= 0 && field < this->fields)
+    this->current[field] = value;
+}
+
+bool TelemetryPublisher::changed()
+{
+  return memcmp(this->current, this->previous, this->fields * sizeof(int32_t)) != 0;
+}
+
+size_t TelemetryPublisher::encode(uint8_t *payload, size_t size, bool key)
+{
+  if (size < TELEMETRY_HEADER_SIZE + (size_t)this->fields * 5)
+    return 0;
+
+  uint16_t sequence = this->sequence + (changed() ? 1 : 0);
+  uint32_t mask = 0;
+  size_t length = TELEMETRY_HEADER_SIZE;
+  for (int i = 0; i < this->fields; i++)
+  {
+    // the difference wraps the same way the values do
+    int32_t value = key ? this->current[i] : (int32_t)((uint32_t)this->current[i] - (uint32_t)this->previous[i]);
+    if (!key && value == 0)
+      continue;
+    mask |= 1UL << i;
+    uint32_t zigzag = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+    while (zigzag >= 0x80)
+    {
+      payload[length++] = (uint8_t)(zigzag | 0x80);
+      zigzag >>= 7;
+    }
+    payload[length++] = (uint8_t)zigzag;
+  }
+
+  payload[0] = key ? TELEMETRY_KEY : 0;
+  payload[1] = sequence & 0xFF;
+  payload[2] = sequence >> 8;
+  payload[3] = mask & 0xFF;
+  payload[4] = (mask >> 8) & 0xFF;
+  payload[5] = (mask >> 16) & 0xFF;
+  payload[6] = mask >> 24;
+
+  this->frames++;
+  if (key)
+    this->keyFrames++;
+  this->bytes += length;
+  return length;
+}
+
+void TelemetryPublisher::commit()
+{
+  if (!changed())
+    return;
+  memcpy(this->previous, this->current, this->fields * sizeof(int32_t));
+  this->sequence++;
+}
+
+int TelemetryPublisher::slot(uint32_t client, bool claim)
+{
+  for (int i = 0; i < TELEMETRY_MAX_CLIENTS; i++)
+    if (this->clients[i] == client)
+      return i;
+  if (claim)
+  {
+    for (int i = 0; i < TELEMETRY_MAX_CLIENTS; i++)
+    {
+      if (this->clients[i] == 0)
+      {
+        this->clients[i] = client;
+        this->synced[i] = false;
+        return i;
+      }
+    }
+  }
+  return -1;
+}
+
+// Clients we aren't tracking, new ones or past the table, always get keys
+bool TelemetryPublisher::needsKey(uint32_t client)
+{
+  int i = slot(client, false);
+  return i < 0 || !this->synced[i];
+}
+
+void TelemetryPublisher::delivered(uint32_t client)
+{
+  int i = slot(client, true);
+  if (i >= 0)
+    this->synced[i] = true;
+}
+
+void TelemetryPublisher::skipped(uint32_t client)
+{
+  int i = slot(client, false);
+  if (i >= 0)
+    this->synced[i] = false;
+  this->skips++;
+}
+
+void TelemetryPublisher::retain(const uint32_t *clients, int count)
+{
+  for (int i = 0; i < TELEMETRY_MAX_CLIENTS; i++)
+  {
+    if (this->clients[i] == 0)
+      continue;
+    bool kept = false;
+    for (int k = 0; k < count && !kept; k++)
+      kept = clients[k] == this->clients[i];
+    if (!kept)
+      this->clients[i] = 0;
+  }
+}
@@ -0,0 +1,67 @@
+/*
+ * TelemetryPublisher - delta encoded state frames shared by every viewer
+ *
+ * Each publish cycle the caller set()s every field, encodes at most one
+ * delta and one key frame payload, hands the same buffers to every client
+ * and then commit()s. A delta holds only the fields that changed since the
+ * last commit, a key frame holds all of them:
+ *
+ *   offset  size  field
+ *        0     1  flags, bit 0 set for a key frame
+ *        1     2  sequence, bumped by every commit() that changed something
+ *        3     4  mask, bit n set if field n follows
+ *        7     n  one zigzag varint per field in the mask - the change for
+ *                 a delta, the value for a key frame
+ *
+ * A viewer can only apply a delta on top of the sequence before it, so the
+ * publisher remembers which clients have every frame so far. A client that
+ * is skipped because its send queue is backed up gets a key frame instead
+ * the next time it has room, so a slow viewer costs one frame per cycle at
+ * most rather than a growing queue.
+ */
+
+#ifndef TelemetryPublisher_h
+#define TelemetryPublisher_h
+
+#include "esp_types.h"
+
+#define TELEMETRY_MAX_FIELDS    32
+#define TELEMETRY_MAX_CLIENTS   8
+#define TELEMETRY_HEADER_SIZE   7
+#define TELEMETRY_MAX_PAYLOAD   (TELEMETRY_HEADER_SIZE + TELEMETRY_MAX_FIELDS * 5)
+#define TELEMETRY_KEY           0x01
+
+class TelemetryPublisher {
+  public:
+    TelemetryPublisher(int fields);
+    void set(int field, int32_t value);
+    // True if a delta this cycle would carry anything
+    bool changed();
+    // Encodes this cycle's delta or key frame payload, returns its length
+    size_t encode(uint8_t *payload, size_t size, bool key);
+    // What was set() this cycle becomes the base of the next delta
+    void commit();
+
+    // Client tracking, by websocket client id, all from the one task that
+    // publishes - retain() forgets every client not in the list given
+    bool needsKey(uint32_t client);
+    void delivered(uint32_t client);
+    void skipped(uint32_t client);
+    void retain(const uint32_t *clients, int count);
+
+    uint16_t sequence;
+    volatile unsigned long frames;      // payloads encoded
+    volatile unsigned long keyFrames;
+    volatile unsigned long skips;       // frames a congested client went without
+    volatile unsigned long bytes;       // payload bytes encoded
+
+  private:
+    int fields;
+    int32_t current[TELEMETRY_MAX_FIELDS];
+    int32_t previous[TELEMETRY_MAX_FIELDS];
+    uint32_t clients[TELEMETRY_MAX_CLIENTS];
+    bool synced[TELEMETRY_MAX_CLIENTS];   // has every frame up to sequence
+    int slot(uint32_t client, bool claim);
+};
+
+#endif
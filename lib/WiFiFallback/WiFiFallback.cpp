@@ -0,0 +1,59 @@
+/*
+ * WiFiFallback - network join fallbacks, see WiFiFallback.h
+ */
+
+#include "WiFiFallback.h"
+
+WiFiFallback::WiFiFallback(uint32_t cachedTimeoutMs, uint32_t apTimeoutMs)
+{
+  this->cachedTimeoutMs = cachedTimeoutMs;
+  this->apTimeoutMs = apTimeoutMs;
+  this->current = WIFI_SCAN;
+  this->stageStart = 0;
+  this->rescannedAt = 0;
+  this->apOpenedAt = 0;
+}
+
+void WiFiFallback::begin(bool cached, uint32_t nowMs)
+{
+  this->stageStart = nowMs;
+  this->rescannedAt = 0;
+  this->apOpenedAt = 0;
+  __atomic_store_n(&this->current, (uint32_t)(cached ? WIFI_CACHED : WIFI_SCAN), __ATOMIC_RELEASE);
+}
+
+WiFiAction WiFiFallback::update(uint32_t nowMs)
+{
+  WiFiStage stage = this->stage();
+  if (stage == WIFI_CACHED && nowMs - this->stageStart >= this->cachedTimeoutMs)
+  {
+    if (!advance(WIFI_CACHED, WIFI_SCAN, nowMs))
+      return WIFI_WAIT;
+    this->rescannedAt = nowMs;
+    return WIFI_RESCAN;
+  }
+  if (stage == WIFI_SCAN && nowMs - this->stageStart >= this->apTimeoutMs)
+  {
+    if (!advance(WIFI_SCAN, WIFI_ACCESS_POINT, nowMs))
+      return WIFI_WAIT;
+    this->apOpenedAt = nowMs;
+    return WIFI_OPEN_AP;
+  }
+  return WIFI_WAIT;
+}
+
+void WiFiFallback::connected()
+{
+  __atomic_store_n(&this->current, (uint32_t)WIFI_CONNECTED, __ATOMIC_RELEASE);
+}
+
+// Moves on only if still in the stage it was read in, connected() may have
+// come in from the event task since
+bool WiFiFallback::advance(WiFiStage from, WiFiStage to, uint32_t nowMs)
+{
+  uint32_t expected = from;
+  if (!__atomic_compare_exchange_n(&this->current, &expected, (uint32_t)to, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+    return false;
+  this->stageStart = nowMs;
+  return true;
+}
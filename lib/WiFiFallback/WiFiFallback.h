@@ -0,0 +1,53 @@
+/*
+ * WiFiFallback - when to give up on each way onto the network
+ *
+ * The station rejoins from what was cached of the last good connection -
+ * address, access point and channel - skipping the scan and DHCP. If that
+ * hasn't worked after the cached timeout it scans and asks DHCP instead,
+ * and after the access point timeout more it opens its own access point
+ * as well, the station carrying on trying alongside it.
+ *
+ * It only decides: update() is called periodically and hands back what
+ * the caller should do with the WiFi driver, connected() is called from
+ * the WiFi event task when an address arrives. A stage only moves on from
+ * the one it was read in, so an address arriving mid update() is never
+ * overwritten by a fallback.
+ */
+
+#ifndef WiFiFallback_h
+#define WiFiFallback_h
+
+#include "esp_types.h"
+
+enum WiFiStage { WIFI_CACHED, WIFI_SCAN, WIFI_ACCESS_POINT, WIFI_CONNECTED };
+
+enum WiFiAction {
+  WIFI_WAIT = 0,            // nothing to do
+  WIFI_RESCAN,              // drop the cached settings, scan and ask DHCP
+  WIFI_OPEN_AP              // open the access point, keep the station trying
+};
+
+class WiFiFallback {
+  public:
+    WiFiFallback(uint32_t cachedTimeoutMs, uint32_t apTimeoutMs);
+
+    // Joining has started, from the cache or with a scan, now in ms
+    void begin(bool cached, uint32_t nowMs);
+    WiFiAction update(uint32_t nowMs);
+    void connected();
+
+    WiFiStage stage() { return (WiFiStage)__atomic_load_n(&this->current, __ATOMIC_ACQUIRE); }
+    // ms since boot each fallback was taken, 0 if it wasn't
+    uint32_t rescannedAt;
+    uint32_t apOpenedAt;
+
+  private:
+    bool advance(WiFiStage from, WiFiStage to, uint32_t nowMs);
+
+    uint32_t cachedTimeoutMs;
+    uint32_t apTimeoutMs;
+    uint32_t current;         // WiFiStage
+    uint32_t stageStart;
+};
+
+#endif
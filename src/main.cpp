@@ -8,12 +8,13 @@
  *  3 - Install the espressif32 Platform
  *  4 - Set your WiFi SSID and Password Below
  *  5 - PlatformIO: Build (in the taskbar at the bottom)
- *  6 - In WebResponseImpl.h (ESP Async WebServer/src/WebResponseImpl.h)
- *       change line 62 to: #define TEMPLATE_PLACEHOLDER '@'
- *  7 - Plug in your Adafruit Feather32 or TTGO Esp32
- *  8 - PlatformIO: Upload (in the taskbar at the bottom)
- *  9 - Connect the the Serial Monitor (in the taskbar at the bottom)
- *  10 - Note the IP address of the ESP32, and connect to this with your browser
+ *       The web client in web/ is packed into src/assets.h on every build
+ *  6 - Plug in your Adafruit Feather32 or TTGO Esp32
+ *  7 - PlatformIO: Upload (in the taskbar at the bottom)
+ *  8 - Connect the the Serial Monitor (in the taskbar at the bottom)
+ *  9 - Note the IP address of the ESP32, and connect to this with your browser
+ *       (if it can't join your network it opens the ESP32RemoteControl
+ *       access point after about 15 seconds, then browse to 192.168.4.1)
  * 
  * This software is free software; you can redistribute it and/or
  * modify it under the terms of the GNU Lesser General Public
@@ -34,250 +35,993 @@
 // https://github.com/me-no-dev/ESPAsyncWebServer
 
 #include <WiFi.h>
+#include <Preferences.h>
 #include <ESPAsyncWebServer.h>
 #include "StepperTimer.h"
+#include "StepScheduler.h"
+#include "StepperGroup.h"
+#include "MotorChannel.h"
+#include "SegmentQueue.h"
+#include "MotorControl.h"
 #include "DCMotorController.h"
+#include "MCPWMMotorController.h"
+#include "QuadratureEncoder.h"
+#include "SpeedPid.h"
+#include "TelemetryPublisher.h"
+#include "ControlProtocol.h"
+#include "ControlLink.h"
+#include "ControlLoop.h"
+#include "StepTrace.h"
+#include "MetricsWriter.h"
+#include "BinaryLog.h"
+#include "BootTimeline.h"
+#include "WiFiFallback.h"
+#include "BoardProfile.h"
+#include "SessionRecorder.h"
+#include "PowerManager.h"
 #include <rom/rtc.h>
-#include "pages.h"
+#include "esp_timer.h"
+#include "assets.h"
 
 using namespace std;
 
 // Set your WiFi name & password here...
 const char *ssid = "WiFiSSID";
 const char *password = "Password123";
+// ...and the access point opened when that network can't be joined
+const char *apSsid = "ESP32RemoteControl";
+const char *apPassword = "Password123";   // 8 characters or more
 
 // for stepper motors
 const int stepsPerRevolution = 200; // change this to fit the number of steps per revolution
 
+// All stepper channels share this one timer, the timers given to each
+// StepperTimer below are only used when it is driven standalone
+StepScheduler stepScheduler(TIMER_GROUP_0, TIMER_0);
+// Step interrupt timing, off until enabled with /metrics?trace=1
+StepTrace stepTrace;
+
 #define feather  // comment this line out for Dev board configuration...
+#define mcpwm    // comment this line out to drive every DC channel from LEDC
+// Pins, timers and LEDC channels of each board are in BoardProfile.h
 #ifdef feather
-// Feather or TTGO ESP32 pin definitions
+constexpr const BoardProfile &board = featherBoard;
+#else
+constexpr const BoardProfile &board = devBoard;
+#endif
+
+StepperTimer boardStepper(int c)
+{
+  const BoardChannel &ch = board.channel[c];
+  return StepperTimer(stepsPerRevolution, ch.group, ch.timer, ch.pin[0], ch.pin[1], ch.pin[2], ch.pin[3]);
+}
+
+// DC channel n on LEDC channel n
+DCMotorController boardDCMotor(int dc)
+{
+  return DCMotorController(dc, boardDCPin(board, dc, 0), boardDCPin(board, dc, 1));
+}
+
+// DC channel n on MCPWM unit n / 3, timer n % 3
+MCPWMMotorController boardMCPWMMotor(int dc)
+{
+  return MCPWMMotorController((mcpwm_unit_t)(dc / 3), (mcpwm_timer_t)(dc % 3),
+                              boardDCPin(board, dc, 0), boardDCPin(board, dc, 1));
+}
+
 StepperTimer mySteppers[4] =
 {
-  StepperTimer(stepsPerRevolution, TIMER_GROUP_0, TIMER_0, 5, 4, 25, 26),
-  StepperTimer(stepsPerRevolution, TIMER_GROUP_0, TIMER_1, 17, 16, 19, 18),
-  StepperTimer(stepsPerRevolution, TIMER_GROUP_1, TIMER_0, 23, 22, 14, 32),
-  StepperTimer(stepsPerRevolution, TIMER_GROUP_1, TIMER_1, 15, 33, 27, 12)
+  boardStepper(0), boardStepper(1), boardStepper(2), boardStepper(3)
 };
 
 DCMotorController dcMotors[8] = 
 {
   // Primaries (xA) - A channels
-  DCMotorController(0, 5, 4), 
-  DCMotorController(1, 17, 16), 
-  DCMotorController(2, 23, 22), 
-  DCMotorController(3, 15, 33), 
+  boardDCMotor(0), boardDCMotor(1), boardDCMotor(2), boardDCMotor(3),
   // Secondaries (xB) - B channels
-  DCMotorController(4, 25, 26), 
-  DCMotorController(5, 19, 18), 
-  DCMotorController(6, 14, 32), 
-  DCMotorController(7, 27, 12)
+  boardDCMotor(4), boardDCMotor(5), boardDCMotor(6), boardDCMotor(7)
 };
-#else
-// Dev board - setup your own pins here...
-StepperTimer mySteppers[4] =
+
+// The first DC channels again, on the MCPWM operators
+MCPWMMotorController mcpwmMotors[6] =
 {
-  StepperTimer(stepsPerRevolution, TIMER_GROUP_0, TIMER_0, 16, 17, 22, 23),
-  StepperTimer(stepsPerRevolution, TIMER_GROUP_0, TIMER_1, 1, 1, 1, 1),
-  StepperTimer(stepsPerRevolution, TIMER_GROUP_1, TIMER_0, 1, 1, 1, 1),
-  StepperTimer(stepsPerRevolution, TIMER_GROUP_1, TIMER_1, 1, 1, 1, 1)
+  boardMCPWMMotor(0), boardMCPWMMotor(1), boardMCPWMMotor(2),
+  boardMCPWMMotor(3), boardMCPWMMotor(4), boardMCPWMMotor(5)
 };
 
-DCMotorController dcMotors[8] = 
+// A DC channel with an encoder runs closed loop, its setpoint is then a
+// speed and a PID in the control loop sets the output
+QuadratureEncoder encoders[8] =
 {
-  // Primaries (xA) - A channels
-  DCMotorController(0, 22, 23), 
-  DCMotorController(1, 1, 1), 
-  DCMotorController(2, 1, 1), 
-  DCMotorController(3, 1, 1), 
-  // Secondaries (xB) - B channels
-  DCMotorController(4, 16, 17), 
-  DCMotorController(5, 1, 1), 
-  DCMotorController(6, 1, 1), 
-  DCMotorController(7, 1, 1)
+  QuadratureEncoder(PCNT_UNIT_0, board.encoder[0][0], board.encoder[0][1]),
+  QuadratureEncoder(PCNT_UNIT_1, board.encoder[1][0], board.encoder[1][1]),
+  QuadratureEncoder(PCNT_UNIT_2, board.encoder[2][0], board.encoder[2][1]),
+  QuadratureEncoder(PCNT_UNIT_3, board.encoder[3][0], board.encoder[3][1]),
+  QuadratureEncoder(PCNT_UNIT_4, board.encoder[4][0], board.encoder[4][1]),
+  QuadratureEncoder(PCNT_UNIT_5, board.encoder[5][0], board.encoder[5][1]),
+  QuadratureEncoder(PCNT_UNIT_6, board.encoder[6][0], board.encoder[6][1]),
+  QuadratureEncoder(PCNT_UNIT_7, board.encoder[7][0], board.encoder[7][1])
 };
+SpeedPid speedPid[8];
+int32_t dcTarget[8] = {0,0,0,0,0,0,0,0};  // counts/s
+const float encoderMaxRate = 6000;         // counts/s a full scale setpoint asks for
+// PID gains relative to the open loop feed-forward, ki in 1/s and kd in s
+const float speedKp = 1.0;
+const float speedKi = 20.0;
+const float speedKd = 0;
+
+// DC channels below this run on MCPWM, the rest on LEDC
+#ifdef mcpwm
+const int mcpwmChannels = 6;
+#else
+const int mcpwmChannels = 0;
 #endif
 
-/* This is set from the Web Frontend...
- * 0 = off
- * 1 = stepper
- * 2 = dc brushed x2
- */
-int channelMode[4] = {0, 0, 0, 0};
+// what a full scale setpoint maps to on an LEDC channel
+const long dcMaxSpeed = 255;
+
+// Frames to the clients, numbered as they go out - from the websocket
+// task and loop() both, so taken atomically
+uint16_t txSequence = 0;
+
+uint16_t nextTxSequence()
+{
+  return __atomic_fetch_add(&txSequence, 1, __ATOMIC_RELAXED);
+}
+
+// Coordinated moves over the stepper channels - the group holds all four,
+// channels that aren't steppers are given no steps
+StepperGroup stepperGroup;
+
+// Streamed path segments, run by the group
+SegmentQueue segmentQueue(stepperGroup);
+const float pathAcceleration = 4000;      // full steps/s^2 per axis
+const float junctionDeviation = 2;        // steps
+
+// The control loop runs at a fixed rate in its own task on the core the
+// WiFi and network stack don't use
+const uint32_t controlRateHz = 1000;
+#define CONTROL_CORE      1
+#define CONTROL_PRIORITY  5
+
+// Log records are formatted and written out by a low priority task on the
+// network core
+#define LOG_CORE          0
+#define LOG_PRIORITY      1
+
+// Each websocket client has a slot on the control side, with a protocol
+// decoder of its own so fragments from different clients can't interleave,
+// and its round trip and setpoint freshness - decoderClient holds the
+// client id in each slot
+volatile uint32_t decoderClient[MOTOR_CONTROL_CLIENTS] = {0};
+// Setpoints older than this on arrival are dropped rather than applied late
+const uint32_t setpointMaxAgeMs = 200;
 
-// temporary storage:
-int motorSpeed[8] = {0,0,0,0,0,0,0,0};
+// Axis state streamed back to the clients, one frame built per cycle and
+// shared by all of them. A client with more than telemetryMaxQueue
+// messages still waiting is passed over and caught up with a key frame.
+TelemetryPublisher telemetry(CONTROL_TELEMETRY_FIELDS);
+const uint32_t telemetryRateHz = 20;
+const size_t telemetryMaxQueue = 4;
+
+// WiFi comes up in the background while the motors are already running.
+// The address, access point and channel of the last good connection are
+// kept in flash, so after a reset it rejoins without a scan or DHCP. If
+// that hasn't worked after wifiCachedTimeoutMs it scans and asks DHCP, and
+// after wifiApTimeoutMs more it opens its own access point as well.
+const uint32_t wifiCachedTimeoutMs = 3000;
+const uint32_t wifiApTimeoutMs = 15000;
+WiFiFallback wifiFallback(wifiCachedTimeoutMs, wifiApTimeoutMs);
+Preferences wifiCache;
+
+BootTimeline bootTimeline;
+
+// Control frames and channel switches, recorded while /session?record=1
+// and pulled from /session for replaying on the host
+SessionRecorder sessionRecorder;
+
+// Battery rigs sit idle most of the time: a stepper standing still has its
+// holding current turned down after powerHoldMs, and with no command for
+// powerIdleMs the CPU clock comes down and the radio sleeps until the next
+PowerManager power;
+const uint32_t powerHoldMs = 500;
+const uint32_t powerIdleMs = 5000;
+const int holdCurrentPercent = 40;
+const int cpuMaxMhz = 240;
+const int cpuIdleMhz = 80;        // not below, the step timers' clock would follow
 
 AsyncWebServer server(80);
 AsyncWebSocket ws("/ws");
+// Streams the log as text lines to anyone connected
+AsyncWebSocket logSocket("/log");
 
-// Timer Interrupt for Stepper Motors
-void IRAM_ATTR timerInt(void *para)
+// Every page goes out gzipped straight from flash. A browser revalidating
+// with the ETag it holds gets a 304, and the scripts and styles, linked by
+// content hash, it never needs to ask for again.
+void sendAsset(AsyncWebServerRequest *request, const StaticAsset *asset)
 {
-  int index = (int)para;
-  // Clear Timer
-  if (mySteppers[index].group == TIMER_GROUP_0)
+  AsyncWebServerResponse *response;
+  if (request->hasHeader("If-None-Match") && request->header("If-None-Match") == asset->etag)
+    response = request->beginResponse(304);
+  else
   {
-    if (mySteppers[index].index == TIMER_0)
-      TIMERG0.int_clr_timers.t0 = 1;
-    else
-      TIMERG0.int_clr_timers.t1 = 1;
+    response = request->beginResponse_P(200, asset->contentType, asset->data, asset->length);
+    response->addHeader("Content-Encoding", "gzip");
   }
+  response->addHeader("ETag", asset->etag);
+  response->addHeader("Cache-Control", asset->immutable ? "public, max-age=31536000, immutable" : "no-cache");
+  request->send(response);
+}
+
+// Log output, in the log task
+void logSink(const BinaryLogRecord &record, const char *text, void *arg)
+{
+  Serial.println(text);
+  if (logSocket.count() > 0)
+    logSocket.textAll(text);
+}
+
+// DC output for a setpoint, through whichever driver owns the channel
+void setDCSpeed(int channel, long setpoint)
+{
+  if(channel < mcpwmChannels)
+    mcpwmMotors[channel].SetSpeed(setpoint * mcpwmMotors[channel].maxSpeed() / CONTROL_SETPOINT_MAX);
+  else
+    dcMotors[channel].SetSpeed(setpoint * dcMaxSpeed / CONTROL_SETPOINT_MAX);
+}
+
+void disconnectDC(int channel)
+{
+  if(channel < mcpwmChannels)
+    mcpwmMotors[channel].Disconnect();
   else
+    dcMotors[channel].Disconnect();
+}
+
+// Brings both DC motors of a channel up stopped, or stops and detaches them
+void switchDC(int channel, bool enable)
+{
+  for(int k = channel; k < 8; k += 4)
   {
-    if (mySteppers[index].index == TIMER_0)
-      TIMERG1.int_clr_timers.t0 = 1;
+    if(enable)
+    {
+      speedPid[k].reset();
+      dcTarget[k] = 0;
+      setDCSpeed(k, 0);
+    }
     else
-      TIMERG1.int_clr_timers.t1 = 1;
+      disconnectDC(k);
   }
-  mySteppers[index].step();
-  // Reset Timer
-  if (mySteppers[index].speed != 0)
-    timer_set_alarm(mySteppers[index].group, mySteppers[index].index, TIMER_ALARM_EN);
 }
 
-// Start spinning a Stepper Motor
-static void spin(int index)
-{
-  timer_config_t config;
-  config.divider = TIMER_DIVIDER;
-  config.counter_dir = TIMER_COUNT_UP;
-  config.counter_en = TIMER_PAUSE;
-  config.alarm_en = TIMER_ALARM_EN;
-  config.intr_type = TIMER_INTR_LEVEL;
-  config.auto_reload = true;
-
-  timer_init(mySteppers[index].group, mySteppers[index].index, &config);
-  timer_set_counter_value(mySteppers[index].group, mySteppers[index].index, 0x00000000ULL);
-  timer_set_alarm_value(mySteppers[index].group, mySteppers[index].index, mySteppers[index].stepWaitTicks);
-  timer_set_auto_reload(mySteppers[index].group, mySteppers[index].index, TIMER_AUTORELOAD_EN);
-  timer_enable_intr(mySteppers[index].group, mySteppers[index].index);
-  timer_isr_register(mySteppers[index].group, mySteppers[index].index, timerInt, (void *)index, ESP_INTR_FLAG_IRAM, NULL);
-  timer_start(mySteppers[index].group, mySteppers[index].index);
+// What each channel drives, only switched by the control loop
+MotorChannel channels[4] =
+{
+  MotorChannel(0, &mySteppers[0], switchDC),
+  MotorChannel(1, &mySteppers[1], switchDC),
+  MotorChannel(2, &mySteppers[2], switchDC),
+  MotorChannel(3, &mySteppers[3], switchDC)
+};
+
+// Frames, channel setups and setpoints, the same code the host replay runs
+MotorControl control(board, mySteppers, channels, stepperGroup, segmentQueue);
+
+// A DC motor's setpoint from the control loop, to the speed loop when it
+// has an encoder, else straight to the output
+void dcOutput(int motor, long setpoint, void *arg)
+{
+  if(encoders[motor].isEnabled())
+    dcTarget[motor] = (int32_t)(setpoint * encoderMaxRate / CONTROL_SETPOINT_MAX);
+  else
+    setDCSpeed(motor, setpoint);
 }
 
-// replace %IP_ADDRESS% with the IP Address into html response
-String processor(const String &var)
+void channelSwitched(int channel, void *arg)
 {
-  if (var == "IP_ADDRESS")
-    return WiFi.localIP().toString();
-  return String();
+  BLOG(BLOG_CONTROL, BLOG_INFO, "channel %d state %d mode %d microsteps %d", channel,
+    (int)channels[channel].state, (int)mySteppers[channel].mode, mySteppers[channel].microsteps);
 }
 
-// Handle WebSocket event
-void onEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)
+// A reply from the control side, framed for one client or all of them
+void sendReply(int slot, uint8_t type, const uint8_t *payload, uint16_t length, void *arg)
 {
-  if (len)
+  uint8_t buffer[CONTROL_MAX_FRAME];
+  size_t size = controlEncode(buffer, sizeof(buffer), type, nextTxSequence(), payload, length);
+  if (slot == MOTOR_CONTROL_ALL)
   {
-    AwsFrameInfo *info = (AwsFrameInfo *)arg;
-    if (info->final && info->index == 0 && info->len == len && info->opcode == WS_BINARY)
+    ws.binaryAll(buffer, size);
+    return;
+  }
+  AsyncWebSocketClient *client = decoderClient[slot] ? ws.client(decoderClient[slot]) : NULL;
+  if (client != NULL)
+    client->binary(buffer, size);
+}
+
+// Find the slot of a client, or claim a free one for it, -1 if none
+int slotFor(AsyncWebSocketClient *client, bool claim)
+{
+  for(int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
+    if(decoderClient[i] == client->id())
+      return i;
+  if(claim)
+  {
+    for(int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
     {
-      unsigned int packetType = data[0];
-      
-      // control input packet
-      if (packetType == 1)
+      if(decoderClient[i] == 0)
       {
-        for(int i = 0; i < 8; i++)
-        {
-          if(i*2+2 <= len)
-          {
-            motorSpeed[i] = (signed long)data[i*2+2] * ((signed long)data[i*2+1] - 1L);
-            Serial.printf("%d: %d\n", i, motorSpeed[i]);
-          } else {
-            motorSpeed[i] = 0x00000000ULL;
-          }
-          if(i < 4 && channelMode[i] == 1)
-          {
-            mySteppers[i].setTargetSpeed(motorSpeed[i]);
-            
-          }
-          if(channelMode[(i<4)?i:(i-4)] == 2)
-          {
-            dcMotors[i].SetSpeed(motorSpeed[i]);
-          }
-        }
+        decoderClient[i] = client->id();
+        control.connect(i, esp_timer_get_time());
+        return i;
       }
+    }
+  }
+  return -1;
+}
+
+// Handle a decoded control frame, in the websocket task
+void onControlFrame(const ControlFrame &frame, void *arg)
+{
+  int slot = slotFor((AsyncWebSocketClient *)arg, false);
+  if (slot < 0)
+    return;
+
+  // A command brings the CPU clock and radio back up before it is handled
+  bool woke = MotorControl::isCommand(frame) && power.activity(esp_timer_get_time());
+  if (woke)
+    BLOG(BLOG_CONTROL, BLOG_INFO, "power: woken by frame type %u", frame.type);
+
+  ControlVerdict verdict = control.handle(slot, frame, esp_timer_get_time(), millis());
+
+  if (frame.type == CONTROL_SETPOINTS)
+  {
+    // how late commands arrive with the radio asleep, against awake
+    ControlLink &link = control.links[slot];
+    if (frame.length >= 20 && link.synced && verdict != CONTROL_OUT_OF_ORDER)
+      (woke ? power.wakeAge : power.activeAge).add(link.lastAge * 1000);
+    if (verdict == CONTROL_EXPIRED)
+      BLOG(BLOG_CONTROL, BLOG_DEBUG, "setpoints %u expired, age %dms", frame.sequence, link.lastAge);
+    else if (verdict == CONTROL_OUT_OF_ORDER)
+      BLOG(BLOG_CONTROL, BLOG_DEBUG, "setpoints %u out of order", frame.sequence);
+    else if (frame.length >= 6)
+      BLOG(BLOG_CONTROL, BLOG_DEBUG, "setpoints %u: %d %d %d", frame.sequence, controlReadInt16(frame.payload),
+        controlReadInt16(frame.payload + 2), controlReadInt16(frame.payload + 4));
+  }
+  else if (frame.type == CONTROL_MOVE && frame.length >= 8)
+  {
+    if (frame.payload[1] == CONTROL_MOVE_BY)
+      BLOG(BLOG_MOTOR, BLOG_INFO, "channel %d move by %d", frame.payload[0], controlReadInt32(frame.payload + 2));
+    else
+      BLOG(BLOG_MOTOR, BLOG_INFO, "channel %d move to %d", frame.payload[0], controlReadInt32(frame.payload + 2));
+  }
+  else if (frame.type == CONTROL_GROUP_MOVE && frame.length >= 19)
+    BLOG(BLOG_MOTOR, BLOG_INFO, "group move, speed %d", controlReadInt16(frame.payload + 1));
+}
 
-      //setup packet - channel
-      if (packetType == 0)
+// Handle WebSocket event
+void onEvent(AsyncWebSocket *server, AsyncWebSocketClient *client, AwsEventType type, void *arg, uint8_t *data, size_t len)
+{
+  if (type == WS_EVT_CONNECT)
+  {
+    if(slotFor(client, true) < 0)
+      BLOG(BLOG_NET, BLOG_WARN, "client %u: no free decoder", client->id());
+    else
+    {
+      if(bootTimeline.mark(BOOT_FIRST_CLIENT))
+        BLOG(BLOG_NET, BLOG_INFO, "first client %ums after boot", (uint32_t)(bootTimeline.at(BOOT_FIRST_CLIENT) / 1000));
+      BLOG(BLOG_NET, BLOG_INFO, "client %u connected", client->id());
+    }
+  }
+  else if (type == WS_EVT_DISCONNECT)
+  {
+    BLOG(BLOG_NET, BLOG_INFO, "client %u disconnected", client->id());
+    for(int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
+    {
+      if(decoderClient[i] == client->id())
       {
-        for(int i = 0; i < 4; i++)
-        {
-          channelMode[i] = data[i+1];
-          if(channelMode[i] == 1) {
-            dcMotors[i].Disconnect();
-            dcMotors[i+4].Disconnect();
-
-            mySteppers[i].setMode(StepperTimer::modeEnum::full);
-            mySteppers[i].setSpeed(0);
-            spin(i);
-          } if(channelMode[i] == 2) {
-            mySteppers[i].disconnect();
-
-            dcMotors[i].SetSpeed(0);
-            dcMotors[i+4].SetSpeed(0);
-          }
-        }
+        control.disconnect(i, esp_timer_get_time());
+        decoderClient[i] = 0;
       }
     }
   }
+  else if (type == WS_EVT_DATA && len)
+  {
+    // Fragments and continuation frames are all fed to the same stream
+    // decoder, which reassembles them into control frames
+    AwsFrameInfo *info = (AwsFrameInfo *)arg;
+    int slot = slotFor(client, true);
+    if (slot >= 0 && info->message_opcode == WS_BINARY)
+      control.decoders[slot].feed(data, len, onControlFrame, client);
+  }
+}
+
+// One cycle of the control loop
+void controlStep(void *arg)
+{
+  // Channel switches and the newest setpoints from the websocket task
+  if(control.step(esp_timer_get_time()) && bootTimeline.mark(BOOT_FIRST_CONTROL))
+    BLOG(BLOG_CONTROL, BLOG_INFO, "first setpoints applied %ums after boot", (uint32_t)(bootTimeline.at(BOOT_FIRST_CONTROL) / 1000));
+
+  // Closed loop DC channels
+  for(int i = 0; i < 8; i++)
+  {
+    if(!encoders[i].isEnabled())
+      continue;
+    encoders[i].sample(controlRateHz);
+    if(channels[i & 3].isDC())
+      setDCSpeed(i, speedPid[i].update(dcTarget[i], encoders[i].rate));
+  }
+}
+
+ControlLoop controlLoop(controlStep, NULL);
+
+// Prometheus scrape of the step trace, control loop and protocol counters,
+// streamed into the response as it is written
+size_t metricsSink(const char *text, size_t length, void *arg)
+{
+  return ((AsyncResponseStream *)arg)->write((const uint8_t *)text, length);
+}
+
+void sendMetrics(AsyncWebServerRequest *request)
+{
+  if (request->hasParam("trace"))
+  {
+    bool enable = request->getParam("trace")->value() == "1";
+    if (enable && !stepTrace.enabled)
+      stepTrace.reset();
+    stepTrace.enabled = enable;
+  }
+
+  AsyncResponseStream *response = request->beginResponseStream("text/plain; version=0.0.4");
+  MetricsWriter writer(metricsSink, response);
+  bootTimeline.writeMetrics(writer);
+  writer.header("boot_reset_reason", "gauge", "Why the last reset happened, RESET_REASON of core 0");
+  writer.sample("boot_reset_reason", NULL, (unsigned long)rtc_get_reset_reason(0));
+  stepTrace.writeMetrics(writer, TIMER_SCALE, getCpuFrequencyMhz());
+
+  Histogram view;
+  controlLoop.jitter.snapshot(view);
+  writer.summary("control_loop_jitter_seconds", "Control loop wake up error", NULL, view, 1e-6);
+  controlLoop.duration.snapshot(view);
+  writer.summary("control_loop_duration_seconds", "Control loop cycle run time", NULL, view, 1e-6);
+  writer.header("control_loop_cycles_total", "counter", "Control loop cycles run");
+  writer.sample("control_loop_cycles_total", NULL, controlLoop.cycles);
+  writer.header("control_loop_overruns_total", "counter", "Control loop cycles that missed their period");
+  writer.sample("control_loop_overruns_total", NULL, controlLoop.overruns);
+
+  unsigned long frames = 0, crcErrors = 0, droppedBytes = 0;
+  for(int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
+  {
+    frames += control.decoders[i].frames;
+    crcErrors += control.decoders[i].crcErrors;
+    droppedBytes += control.decoders[i].droppedBytes;
+  }
+  writer.header("control_frames_total", "counter", "Control frames decoded");
+  writer.sample("control_frames_total", NULL, frames);
+  writer.header("control_crc_errors_total", "counter", "Control frames rejected by CRC");
+  writer.sample("control_crc_errors_total", NULL, crcErrors);
+  writer.header("control_dropped_bytes_total", "counter", "Bytes skipped resynchronising the decoders");
+  writer.sample("control_dropped_bytes_total", NULL, droppedBytes);
+
+  control.roundTrip.snapshot(view);
+  writer.summary("control_round_trip_seconds", "Websocket ping round trip", NULL, view, 1e-6);
+  writer.header("control_setpoints_out_of_order_total", "counter", "Setpoints dropped behind a newer one");
+  writer.sample("control_setpoints_out_of_order_total", NULL, control.setpointsOutOfOrder);
+  writer.header("control_setpoints_expired_total", "counter", "Setpoints dropped for arriving too late");
+  writer.sample("control_setpoints_expired_total", NULL, control.setpointsExpired);
+
+  writer.header("control_send_interval_seconds", "gauge", "Least time between setpoints asked of each client");
+  for(int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
+  {
+    if(decoderClient[i] == 0)
+      continue;
+    char labels[24];
+    snprintf(labels, sizeof(labels), "client=\"%u\"", decoderClient[i]);
+    writer.sample("control_send_interval_seconds", labels, control.links[i].interval * 1e-3);
+  }
+
+  writer.header("dc_speed_counts_per_second", "gauge", "Measured DC channel speed");
+  for(int i = 0; i < 8; i++)
+  {
+    if(!encoders[i].isEnabled())
+      continue;
+    char labels[16];
+    snprintf(labels, sizeof(labels), "channel=\"%d\"", i);
+    writer.sample("dc_speed_counts_per_second", labels, (double)encoders[i].rate);
+  }
+
+  writer.header("telemetry_frames_total", "counter", "Telemetry frames encoded");
+  writer.sample("telemetry_frames_total", NULL, telemetry.frames);
+  writer.header("telemetry_key_frames_total", "counter", "Telemetry key frames encoded");
+  writer.sample("telemetry_key_frames_total", NULL, telemetry.keyFrames);
+  writer.header("telemetry_skipped_total", "counter", "Telemetry frames held back from a congested client");
+  writer.sample("telemetry_skipped_total", NULL, telemetry.skips);
+  writer.header("telemetry_bytes_total", "counter", "Telemetry payload bytes encoded");
+  writer.sample("telemetry_bytes_total", NULL, telemetry.bytes);
+
+  writer.header("path_segments_completed_total", "counter", "Path segments run");
+  writer.sample("path_segments_completed_total", NULL, segmentQueue.completed);
+  writer.header("path_segments_rejected_total", "counter", "Path segments refused beyond credit or for want of room");
+  writer.sample("path_segments_rejected_total", NULL, segmentQueue.rejected + control.segmentsDropped +
+    control.segmentsOverCredit);
+  writer.header("path_segments_cancelled_total", "counter", "Path segments dropped when an axis was switched away");
+  writer.sample("path_segments_cancelled_total", NULL, segmentQueue.cancelled);
+
+  writer.header("channel_switches_total", "counter", "Channel mode switches");
+  for(int i = 0; i < 4; i++)
+  {
+    char labels[16];
+    snprintf(labels, sizeof(labels), "channel=\"%d\"", i);
+    writer.sample("channel_switches_total", labels, channels[i].switches);
+  }
+
+  writer.header("power_idle", "gauge", "Whether the device is idle, CPU clock down and radio asleep");
+  writer.sample("power_idle", NULL, (unsigned long)power.isIdle());
+  writer.header("power_idle_seconds_total", "counter", "Time spent idle");
+  writer.sample("power_idle_seconds_total", NULL, power.idleTime(esp_timer_get_time()) * 1e-6);
+  writer.header("power_idles_total", "counter", "Times the device went idle");
+  writer.sample("power_idles_total", NULL, power.idles);
+  writer.header("power_wakes_total", "counter", "Times a command or motion woke the device");
+  writer.sample("power_wakes_total", NULL, power.wakes);
+  writer.header("power_hold_reductions_total", "counter", "Steppers standing still turned down to holding current");
+  writer.sample("power_hold_reductions_total", NULL, control.holdReductions);
+  power.wakeTime.snapshot(view);
+  writer.summary("power_wake_seconds", "Time taken to bring the CPU clock and radio back up", NULL, view, 1e-6);
+  power.wakeAge.snapshot(view);
+  writer.summary("power_command_age_seconds", "Setpoint age on arrival, waking the device or awake", "state=\"waking\"", view, 1e-6);
+  power.activeAge.snapshot(view);
+  writer.summary("power_command_age_seconds", NULL, "state=\"awake\"", view, 1e-6);
+
+  writer.header("session_records_total", "counter", "Records in the session log");
+  writer.sample("session_records_total", NULL, sessionRecorder.records);
+  writer.header("session_dropped_total", "counter", "Records left out of a full session log");
+  writer.sample("session_dropped_total", NULL, sessionRecorder.dropped);
+  writer.header("session_bytes", "gauge", "Session log size");
+  writer.sample("session_bytes", NULL, (unsigned long)sessionRecorder.size());
+
+  unsigned long logDropped = 0;
+  for(int i = 0; i < BLOG_CATEGORIES; i++)
+    logDropped += binaryLog.dropped[i];
+  writer.header("log_records_total", "counter", "Log records queued");
+  writer.sample("log_records_total", NULL, binaryLog.written);
+  writer.header("log_dropped_total", "counter", "Log records dropped on a full ring");
+  writer.sample("log_dropped_total", NULL, logDropped);
+
+  // a scrape cut short would read as counters gone back, so none at all
+  if (writer.overflowed())
+  {
+    BLOG(BLOG_NET, BLOG_WARN, "metrics: out of memory after %u bytes", (unsigned)writer.length());
+    delete response;
+    request->send(500, "text/plain", "metrics out of memory\n");
+    return;
+  }
+  request->send(response);
+}
+
+// The session log so far as a download. ?record=1 starts a fresh one,
+// ?record=0 stops it, pull it once stopped to have all of it
+void sendSession(AsyncWebServerRequest *request)
+{
+  if (request->hasParam("record"))
+  {
+    if (request->getParam("record")->value() == "1")
+    {
+      int64_t now = esp_timer_get_time();
+      sessionRecorder.start(controlRateHz, now, millis());
+      // what the channels are already doing, for the replay to start from
+      control.recordChannels(now);
+      BLOG(BLOG_CONTROL, BLOG_INFO, "session recording started");
+    }
+    else if (sessionRecorder.isRecording())
+    {
+      sessionRecorder.stop();
+      BLOG(BLOG_CONTROL, BLOG_INFO, "session recording stopped, %u records %u bytes",
+        (uint32_t)sessionRecorder.records, (uint32_t)sessionRecorder.size());
+    }
+  }
+  AsyncWebServerResponse *response = request->beginResponse_P(200, "application/octet-stream",
+    sessionRecorder.data(), sessionRecorder.size());
+  response->addHeader("Content-Disposition", "attachment; filename=\"session.bin\"");
+  response->addHeader("Cache-Control", "no-store");
+  request->send(response);
+}
+
+// Listen once there is a network to listen on, from whichever comes first
+void startServer()
+{
+  if(bootTimeline.reached(BOOT_SERVER))
+    return;
+  server.begin();
+  bootTimeline.mark(BOOT_SERVER);
+  digitalWrite(LED_BUILTIN, HIGH);
+  BLOG(BLOG_NET, BLOG_INFO, "server up %ums after boot", (uint32_t)(bootTimeline.at(BOOT_SERVER) / 1000));
+}
+
+// Remember how we got on, rewritten only when it changes to spare the flash
+void saveWiFiCache()
+{
+  uint8_t bssid[6];
+  memcpy(bssid, WiFi.BSSID(), sizeof(bssid));
+  uint8_t channel = WiFi.channel();
+  uint32_t ip = WiFi.localIP(), gateway = WiFi.gatewayIP(), subnet = WiFi.subnetMask(), dns = WiFi.dnsIP();
+  uint8_t cachedBssid[6] = {0};
+  wifiCache.getBytes("bssid", cachedBssid, sizeof(cachedBssid));
+  if(wifiCache.getString("ssid") == ssid && wifiCache.getUInt("ip") == ip && wifiCache.getUInt("gateway") == gateway &&
+     wifiCache.getUInt("subnet") == subnet && wifiCache.getUInt("dns") == dns && wifiCache.getUChar("channel") == channel &&
+     memcmp(cachedBssid, bssid, sizeof(bssid)) == 0)
+    return;
+  wifiCache.putString("ssid", ssid);
+  wifiCache.putUInt("ip", ip);
+  wifiCache.putUInt("gateway", gateway);
+  wifiCache.putUInt("subnet", subnet);
+  wifiCache.putUInt("dns", dns);
+  wifiCache.putUChar("channel", channel);
+  wifiCache.putBytes("bssid", bssid, sizeof(bssid));
+  BLOG(BLOG_NET, BLOG_INFO, "wifi: cached channel %u", channel);
+}
+
+// Join straight from the cache when it is for this network, else scan
+void beginWiFi()
+{
+  wifiCache.begin("wifi", false);
+  uint8_t bssid[6];
+  uint8_t channel = wifiCache.getUChar("channel", 0);
+  uint32_t ip = wifiCache.getUInt("ip", 0);
+  if(wifiCache.getString("ssid") == ssid && channel != 0 && ip != 0 &&
+     wifiCache.getBytes("bssid", bssid, sizeof(bssid)) == sizeof(bssid))
+  {
+    WiFi.config(IPAddress(ip), IPAddress(wifiCache.getUInt("gateway")), IPAddress(wifiCache.getUInt("subnet")),
+      IPAddress(wifiCache.getUInt("dns")));
+    WiFi.begin(ssid, password, channel, bssid);
+    wifiFallback.begin(true, millis());
+    BLOG(BLOG_NET, BLOG_INFO, "wifi: joining cached channel %u", channel);
+  }
+  else
+  {
+    WiFi.begin(ssid, password);
+    wifiFallback.begin(false, millis());
+    BLOG(BLOG_NET, BLOG_INFO, "wifi: scanning");
+  }
+}
+
+// In the WiFi event task
+void onWiFiEvent(WiFiEvent_t event)
+{
+  switch(event)
+  {
+    case SYSTEM_EVENT_STA_GOT_IP:
+    {
+      wifiFallback.connected();
+      bootTimeline.mark(BOOT_WIFI_UP);
+      // You can connect to the serial monitor to see the IP to connect to:
+      IPAddress ip = WiFi.localIP();
+      BLOG(BLOG_NET, BLOG_INFO, "wifi: %u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+      saveWiFiCache();
+      power.radioUp();
+      startServer();
+      break;
+    }
+    case SYSTEM_EVENT_AP_START:
+    {
+      bootTimeline.mark(BOOT_AP_UP);
+      IPAddress ip = WiFi.softAPIP();
+      BLOG(BLOG_NET, BLOG_WARN, "wifi: access point up at %u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+      power.radioUp();
+      startServer();
+      break;
+    }
+    case SYSTEM_EVENT_STA_DISCONNECTED:
+      BLOG(BLOG_NET, BLOG_DEBUG, "wifi: disconnected");
+      break;
+    default:
+      break;
+  }
+}
+
+// Fall back a stage at a time while the station doesn't get on, from loop()
+void serviceWiFi()
+{
+  switch(wifiFallback.update(millis()))
+  {
+    case WIFI_RESCAN:
+      BLOG(BLOG_NET, BLOG_WARN, "wifi: cached join failed, scanning");
+      WiFi.disconnect();
+      WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+      WiFi.begin(ssid, password);
+      break;
+    case WIFI_OPEN_AP:
+      // the station keeps trying alongside the access point
+      WiFi.mode(WIFI_AP_STA);
+      WiFi.softAP(apSsid, apPassword);
+      break;
+    default:
+      break;
+  }
 }
 
 void setup()
 {
   Serial.begin(115200);
+  binaryLog.begin(logSink, NULL, LOG_CORE, LOG_PRIORITY);
+  BLOG(BLOG_CONTROL, BLOG_INFO, "reset reason %d", (int)rtc_get_reset_reason(0));
 
-  WiFi.begin(ssid, password);
-  while (WiFi.status() != WL_CONNECTED)
+  // One timer interrupt drives every stepper channel
+  stepScheduler.setTrace(&stepTrace);
+  stepScheduler.begin();
+  for(int i = 0; i < 4; i++)
   {
-    delay(1000);
-    Serial.println("Connecting to WiFi..");
+    mySteppers[i].setScheduler(&stepScheduler);
+    mySteppers[i].setCoilChannels(board.channel[i].coilChannel[0], board.channel[i].coilChannel[1]);
   }
-  // You can connect to the serial monitor to see the IP to connect to:
-  Serial.println(WiFi.localIP());
+  for(int i = 0; i < mcpwmChannels; i++)
+    mcpwmMotors[i].begin();
+  for(int i = 0; i < 8; i++)
+  {
+    if(encoders[i].begin())
+      BLOG(BLOG_MOTOR, BLOG_INFO, "channel %d encoder on GPIO%d/%d", i, board.encoder[i][0], board.encoder[i][1]);
+    float scale = CONTROL_SETPOINT_MAX / encoderMaxRate;
+    speedPid[i].setGains(speedKp * scale, speedKi * scale, speedKd * scale, scale, controlRateHz);
+    speedPid[i].setLimit(CONTROL_SETPOINT_MAX);
+  }
+  for(int i = 0; i < 4; i++)
+    stepperGroup.add(&mySteppers[i]);
+  stepperGroup.setScheduler(&stepScheduler);
+  segmentQueue.setLimits(pathAcceleration, junctionDeviation);
+  control.setOutputs(dcOutput, channelSwitched, sendReply, NULL);
+  control.setRecorder(&sessionRecorder);
+  control.setMaxAge(setpointMaxAgeMs);
+  controlLoop.begin(controlRateHz, CONTROL_CORE, CONTROL_PRIORITY);
+  bootTimeline.mark(BOOT_MOTORS);
+
+  power.setTimeouts(powerHoldMs, powerIdleMs);
+  if(!power.begin(cpuMaxMhz, cpuIdleMhz))
+    BLOG(BLOG_CONTROL, BLOG_WARN, "power: no esp_pm in this build, the CPU clock stays up");
 
   // attach AsyncWebSocket
   ws.onEvent(onEvent);
   server.addHandler(&ws);
+  server.addHandler(&logSocket);
 
   // Handlers for HTML server requests
-  server.on("/", HTTP_GET, [](AsyncWebServerRequest *request) {
-    request->send_P(200, "text/html", html, processor);
-  });
+  for(size_t i = 0; i < STATIC_ASSET_COUNT; i++)
+  {
+    const StaticAsset *asset = &staticAssets[i];
+    server.on(asset->path, HTTP_GET, [asset](AsyncWebServerRequest *request) {
+      sendAsset(request, asset);
+    });
+  }
 
-  server.on("/style.css", HTTP_GET, [](AsyncWebServerRequest *request) {
-    request->send(200, "text/css", css);
-  });
+  server.on("/metrics", HTTP_GET, sendMetrics);
+  server.on("/session", HTTP_GET, sendSession);
 
-  server.on("/virt_joystick.js", HTTP_GET, [](AsyncWebServerRequest *request) {
-    request->send(200, "application/javascript", virt_joystick);
-  });
+  // The led comes on with the server
+  pinMode(LED_BUILTIN, OUTPUT);
+  digitalWrite(LED_BUILTIN, LOW);
 
-  server.on("/interact.js", HTTP_GET, [](AsyncWebServerRequest *request) {
-    AsyncWebServerResponse *response = request->beginResponse_P(200, "application/javascript", interact, sizeof(interact));
-    response->addHeader("Content-Encoding", "gzip");
-    request->send(response);
-  });
+  WiFi.onEvent(onWiFiEvent);
+  WiFi.mode(WIFI_STA);
+  beginWiFi();
+  bootTimeline.mark(BOOT_WIFI_START);
+}
 
-  server.on("/jquery.js", HTTP_GET, [](AsyncWebServerRequest *request) {
-    AsyncWebServerResponse *response = request->beginResponse_P(200, "application/javascript", jquery, sizeof(jquery));
-    response->addHeader("Content-Encoding", "gzip");
-    request->send(response);
-  });
+// Turn the holding current down on steppers standing still, and let the
+// device go idle once nothing has moved or been asked for a while
+void servicePower()
+{
+  static int64_t lastPosition[4] = {0, 0, 0, 0};
+  uint8_t moved = 0;
+  bool busy = stepperGroup.isMoving() || !segmentQueue.isIdle();
+  for(int i = 0; i < 4; i++)
+  {
+    // a move short enough to fit between two passes still counts
+    int64_t position = mySteppers[i].getPosition();
+    if(channels[i].isStepper() && (mySteppers[i].isRunning() || position != lastPosition[i]))
+      moved |= 1 << i;
+    lastPosition[i] = position;
+    if(channels[i].isDC() && (control.setpoint[i] != 0 || control.setpoint[i + 4] != 0))
+      busy = true;
+  }
 
-  // Start the server
-  server.begin();
+  bool wasIdle = power.isIdle();
+  uint8_t reduce = power.update(moved, busy, esp_timer_get_time());
+  if(reduce)
+    control.reduceHold(reduce, holdCurrentPercent);
+  if(power.isIdle() && !wasIdle)
+    BLOG(BLOG_CONTROL, BLOG_INFO, "power: idle, CPU at %uMHz", getCpuFrequencyMhz());
+  else if(!power.isIdle() && wasIdle)
+    BLOG(BLOG_CONTROL, BLOG_INFO, "power: awake, CPU at %uMHz", getCpuFrequencyMhz());
+}
 
-  // Turn on connected led
-  pinMode(LED_BUILTIN, OUTPUT);
-  digitalWrite(LED_BUILTIN, HIGH);
+// Ping every client with the device clock, carrying back what its link
+// has measured and dropped so far
+void sendPings()
+{
+  for(int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
+  {
+    AsyncWebSocketClient *client = decoderClient[i] ? ws.client(decoderClient[i]) : NULL;
+    if (client == NULL || client->status() != WS_CONNECTED)
+      continue;
+    uint8_t payload[14];
+    controlWriteInt32(payload, (int32_t)millis());
+    controlWriteInt16(payload + 4, (int16_t)(control.links[i].rtt > 0x7FFF ? 0x7FFF : control.links[i].rtt));
+    controlWriteInt32(payload + 6, (int32_t)control.links[i].outOfOrder);
+    controlWriteInt32(payload + 10, (int32_t)control.links[i].expired);
+    uint8_t buffer[CONTROL_HEADER_SIZE + sizeof(payload) + CONTROL_CRC_SIZE];
+    size_t length = controlEncode(buffer, sizeof(buffer), CONTROL_PING, nextTxSequence(), payload, sizeof(payload));
+    client->binary(buffer, length);
+  }
 }
 
-void loop()
+// Pace each client's setpoints by its backlog and whether the control
+// loop is keeping up, telling it whenever its interval moves
+void adaptRates()
+{
+  static unsigned long overruns = 0;
+  bool congested = controlLoop.overruns != overruns;
+  overruns = controlLoop.overruns;
+
+  int senders = 0;
+  for(int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
+    if(decoderClient[i] && control.links[i].sending())
+      senders++;
+
+  for(int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
+  {
+    AsyncWebSocketClient *client = decoderClient[i] ? ws.client(decoderClient[i]) : NULL;
+    if (client == NULL || client->status() != WS_CONNECTED)
+      continue;
+    if (!control.links[i].adapt(client->queueLen(), congested, senders))
+      continue;
+    uint8_t payload[2];
+    controlWriteInt16(payload, (int16_t)control.links[i].interval);
+    uint8_t buffer[CONTROL_HEADER_SIZE + sizeof(payload) + CONTROL_CRC_SIZE];
+    size_t length = controlEncode(buffer, sizeof(buffer), CONTROL_RATE, nextTxSequence(), payload, sizeof(payload));
+    client->binary(buffer, length);
+    BLOG(BLOG_NET, BLOG_DEBUG, "client %u: setpoints every %ums", client->id(), control.links[i].interval);
+  }
+}
+
+// Telemetry frames still on their way out. The buffers are ours rather
+// than the socket's, each is freed here once every client it was queued
+// to has sent it, so nothing reaches into the socket's own buffer list.
+#define TELEMETRY_BUFFERS 8
+AsyncWebSocketMessageBuffer *telemetryBuffers[TELEMETRY_BUFFERS] = {NULL};
+
+// Wrap a telemetry payload in a shared websocket buffer, once per cycle
+AsyncWebSocketMessageBuffer *telemetryBuffer(bool key)
+{
+  int free = -1;
+  for (int i = 0; i < TELEMETRY_BUFFERS; i++)
+  {
+    if (telemetryBuffers[i] != NULL && telemetryBuffers[i]->canDelete())
+    {
+      delete telemetryBuffers[i];
+      telemetryBuffers[i] = NULL;
+    }
+    if (telemetryBuffers[i] == NULL && free < 0)
+      free = i;
+  }
+  // every buffer still queued somewhere, the clients are caught up with a key frame later
+  if (free < 0)
+    return NULL;
+
+  uint8_t payload[TELEMETRY_MAX_PAYLOAD];
+  size_t length = telemetry.encode(payload, sizeof(payload), key);
+  AsyncWebSocketMessageBuffer *buffer = new AsyncWebSocketMessageBuffer(CONTROL_HEADER_SIZE + length + CONTROL_CRC_SIZE);
+  if (buffer == NULL || buffer->get() == NULL)
+  {
+    delete buffer;
+    return NULL;
+  }
+  controlEncode((uint8_t *)buffer->get(), buffer->length(), CONTROL_TELEMETRY, nextTxSequence(), payload, length);
+  buffer->lock();
+  telemetryBuffers[free] = buffer;
+  return buffer;
+}
+
+// Sample the axes and send each client whatever it needs to catch up -
+// nothing, the delta since the last cycle or a key frame
+void publishTelemetry()
 {
-  // Gradually update the speed of stepper motors
   for(int i = 0; i < 4; i++)
-    if(channelMode[i] == 1)
-      mySteppers[i].updateSpeed();
-  delay(5);
-}
\ No newline at end of file
+  {
+    int base = i * CONTROL_TELEMETRY_AXIS;
+    bool stepper = channels[i].isStepper();
+    telemetry.set(base + CONTROL_TELEMETRY_SPEED, stepper ? mySteppers[i].speed : 0);
+    telemetry.set(base + CONTROL_TELEMETRY_TARGET_SPEED, stepper ? mySteppers[i].targetSpeed : 0);
+    telemetry.set(base + CONTROL_TELEMETRY_STEP_TICKS, stepper ? mySteppers[i].stepWaitTicks : 0);
+    telemetry.set(base + CONTROL_TELEMETRY_POSITION, (int32_t)mySteppers[i].getPosition());
+    telemetry.set(base + CONTROL_TELEMETRY_STATE, stepper ? (mySteppers[i].isRunning() ? 1 : 0) | (mySteppers[i].isMoving() ? 2 : 0) : 0);
+  }
+  for(int i = 0; i < 8; i++)
+  {
+    long speed = encoders[i].isEnabled() ? (long)(encoders[i].rate * CONTROL_SETPOINT_MAX / encoderMaxRate) : 0;
+    telemetry.set(CONTROL_TELEMETRY_DC_SPEED + i, speed);
+  }
+
+  // the clients as the websocket task has them now, those gone are
+  // forgotten here rather than from under this loop
+  uint32_t clients[MOTOR_CONTROL_CLIENTS];
+  for(int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
+    clients[i] = decoderClient[i];
+  telemetry.retain(clients, MOTOR_CONTROL_CLIENTS);
+
+  AsyncWebSocketMessageBuffer *delta = NULL;
+  AsyncWebSocketMessageBuffer *key = NULL;
+  bool changed = telemetry.changed();
+  for(int i = 0; i < MOTOR_CONTROL_CLIENTS; i++)
+  {
+    AsyncWebSocketClient *client = clients[i] ? ws.client(clients[i]) : NULL;
+    if (client == NULL || client->status() != WS_CONNECTED)
+      continue;
+    // Don't queue behind a viewer that isn't keeping up, it gets one key
+    // frame once it has drained instead of every delta in between
+    if (client->queueLen() > telemetryMaxQueue)
+    {
+      telemetry.skipped(client->id());
+      continue;
+    }
+    AsyncWebSocketMessageBuffer *buffer;
+    if (telemetry.needsKey(client->id()))
+      buffer = key ? key : (key = telemetryBuffer(true));
+    else if (changed)
+      buffer = delta ? delta : (delta = telemetryBuffer(false));
+    else
+      continue;
+    if (buffer == NULL)
+    {
+      telemetry.skipped(client->id());
+      continue;
+    }
+    client->binary(buffer);
+    telemetry.delivered(client->id());
+  }
+  telemetry.commit();
+
+  if (key != NULL)
+    key->unlock();
+  if (delta != NULL)
+    delta->unlock();
+}
+
+void loop()
+{
+  // Control runs in its own task, this reports move completions and how
+  // well the control loop keeps time
+  static unsigned long lastReport = 0;
+  static unsigned long lastTelemetry = 0;
+  static unsigned long lastPing = 0;
+  static unsigned long lastRates = 0;
+  static unsigned long movesRefused = 0;
+  delay(20);
+  serviceWiFi();
+  control.notifyMoves();
+  if(control.movesRefused != movesRefused)
+  {
+    BLOG(BLOG_MOTOR, BLOG_WARN, "%u moves refused, axes busy", (uint32_t)(control.movesRefused - movesRefused));
+    movesRefused = control.movesRefused;
+  }
+  servicePower();
+  if(millis() - lastRates >= 100 && ws.count() > 0)
+  {
+    lastRates = millis();
+    adaptRates();
+  }
+  if(millis() - lastPing >= 1000 && ws.count() > 0)
+  {
+    lastPing = millis();
+    sendPings();
+  }
+  if(millis() - lastTelemetry >= 1000 / telemetryRateHz && ws.count() > 0)
+  {
+    lastTelemetry = millis();
+    publishTelemetry();
+  }
+  if(millis() - lastReport < 10000)
+    return;
+  lastReport = millis();
+
+  Histogram jitter;
+  controlLoop.jitter.snapshot(jitter);
+  BLOG(BLOG_CONTROL, BLOG_INFO, "control: %u overruns, jitter p50 %uus p99 %uus max %uus",
+    controlLoop.overruns, jitter.percentile(50), jitter.percentile(99), jitter.max);
+}
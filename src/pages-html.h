@@ -1,3 +0,0 @@
-#include "pgmspace.h"
-
-const char html[] PROGMEM = "<!DOCTYPE html><html><head><meta name=viewport content=\"width=device-width, user-scalable=no, minimum-scale=1.0, maximum-scale=1.0, initial-scale=1\"><link href='https://fonts.googleapis.com/css?family=Roboto' rel=stylesheet><link href=http://@IP_ADDRESS@/style.css rel=stylesheet><script src=http://@IP_ADDRESS@/jquery.js></script><script src=http://@IP_ADDRESS@/virt_joystick.js></script><script src=http://@IP_ADDRESS@/interact.js></script></head><body><script>var iconSpanner='<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"24\" height=\"24\" viewBox=\"0 0 24 24\"><path clip-rule=\"evenodd\" fill=\"none\" d=\"M0 0h24v24H0z\"/><path d=\"M22.7 19l-9.1-9.1c.9-2.3.4-5-1.5-6.9-2-2-5-2.4-7.4-1.3L9 6 6 9 1.6 4.7C.4 7.1.9 10.1 2.9 12.1c1.9 1.9 4.6 2.4 6.9 1.5l9.1 9.1c.4.4 1 .4 1.4 0l2.3-2.3c.5-.4.5-1.1.1-1.4z\"/></svg>';var iconDelete='<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"24\" height=\"24\" viewBox=\"0 0 24 24\"><path fill=\"none\" d=\"M0 0h24v24H0V0z\"/><path d=\"M6 19c0 1.1.9 2 2 2h8c1.1 0 2-.9 2-2V7H6v12zm2.46-7.12l1.41-1.41L12 12.59l2.12-2.12 1.41 1.41L13.41 14l2.12 2.12-1.41 1.41L12 15.41l-2.12 2.12-1.41-1.41L10.59 14l-2.13-2.12zM15.5 4l-1-1h-5l-1 1H5v2h14V4z\"/><path fill=\"none\" d=\"M0 0h24v24H0z\"/></svg>';var iconMove='<svg xmlns=\"http://www.w3.org/2000/svg\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" width=\"24\" height=\"24\" viewBox=\"0 0 24 24\"><defs><path id=\"a\" d=\"M0 0h24v24H0z\"/></defs><clipPath id=\"b\"><use xlink:href=\"#a\" overflow=\"visible\"/></clipPath><path clip-path=\"url(#b)\" d=\"M23 5.5V20c0 2.2-1.8 4-4 4h-7.3c-1.08 0-2.1-.43-2.85-1.19L1 14.83s1.26-1.23 1.3-1.25c.22-.19.49-.29.79-.29.22 0 .42.06.6.16.04.01 4.31 2.46 4.31 2.46V4c0-.83.67-1.5 1.5-1.5S11 3.17 11 4v7h1V1.5c0-.83.67-1.5 1.5-1.5S15 .67 15 1.5V11h1V2.5c0-.83.67-1.5 1.5-1.5s1.5.67 1.5 1.5V11h1V5.5c0-.83.67-1.5 1.5-1.5s1.5.67 1.5 1.5z\"/></svg>';var iconConfig='<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"30\" height=\"30\" viewBox=\"0 0 20 20\"><path fill=\"none\" d=\"M0 0h20v20H0V0z\"/><path d=\"M15.95 10.78c.03-.25.05-.51.05-.78s-.02-.53-.06-.78l1.69-1.32c.15-.12.19-.34.1-.51l-1.6-2.77c-.1-.18-.31-.24-.49-.18l-1.99.8c-.42-.32-.86-.58-1.35-.78L12 2.34c-.03-.2-.2-.34-.4-.34H8.4c-.2 0-.36.14-.39.34l-.3 2.12c-.49.2-.94.47-1.35.78l-1.99-.8c-.18-.07-.39 0-.49.18l-1.6 2.77c-.1.18-.06.39.1.51l1.69 1.32c-.04.25-.07.52-.07.78s.02.53.06.78L2.37 12.1c-.15.12-.19.34-.1.51l1.6 2.77c.1.18.31.24.49.18l1.99-.8c.42.32.86.58 1.35.78l.3 2.12c.04.2.2.34.4.34h3.2c.2 0 .37-.14.39-.34l.3-2.12c.49-.2.94-.47 1.35-.78l1.99.8c.18.07.39 0 .49-.18l1.6-2.77c.1-.18.06-.39-.1-.51l-1.67-1.32zM10 13c-1.65 0-3-1.35-3-3s1.35-3 3-3 3 1.35 3 3-1.35 3-3 3z\"/></svg>';var iconAdd='<svg xmlns=\"http://www.w3.org/2000/svg\" width=\"30\" height=\"30\" viewBox=\"0 0 24 24\"><path d=\"M19 13h-6v6h-2v-6H5v-2h6V5h2v6h6v2z\"/><path d=\"M0 0h24v24H0z\" fill=\"none\"/></svg>';var config={sendRate:0.15,channels:[1,1,1,1],};var widgetTypes=[{type:\"Joystick\",value:1,motors:[\"Steering\",\"Forward/Back\"]},{type:\"Tank/2-Wheel Joystick\",value:2,motors:[\"Left\",\"Right\"]},{type:\"Wheel\",value:3,motors:[\"Primary\",\"Secondary (opt)\"]},{type:\"Slider\",value:4,motors:[\"Primary\",\"Secondary (opt)\"]},{type:\"Buttons\",value:5,motors:[\"Primary\",\"Secondary (opt)\"]},{type:\"Voltage Meter\",value:6,motors:[\"N/A\",\"N/A\"]}];var widgets=[];var widgetTemplate={type:\"Tank/2-Wheel Joystick\",key:0,position:[\"25%\",\"25%\"],size:[\"50%\",\"50%\"],layout:0,motors:[{number:0,channel:\"0\",invert:false,range:[100,-100],speed:[100,-100],return:true,zero:false,steps:200,divider:2,inputValue:0},{number:1,channel:\"1\",invert:false,range:[100,-100],speed:[100,-100],return:true,zero:false,steps:200,divider:2,inputValue:0}]};var editmode=false;var editedWidgetIndex=0;var editedMotorIndex=0;function getIndex(number){return widgets.map(function(e){return e.key;}).indexOf(parseInt(number));}function addRadiobutton(container,name,value,checked){var inputs=container.find('input');var id=inputs.length+1;$('<input />',{type:'radio',name:container.attr('id'),id:container.attr('id')+'_cb_'+id,value:value,checked:checked}).appendTo(container);$('<label />',{'for':container.attr('id')+'_cb_'+id,text:name}).appendTo(container);}function refreshControls(event,ui){widgets.forEach(function(widget){if(widget.type==\"Joystick\"||widget.type==\"Tank/2-Wheel Joystick\"){widget.object._buildJoystickStick();widget.object._buildJoystickBase();}});}function deleteWidget(elem,onlyFromScreen,i){var index=(elem!=null)?getIndex(elem.parent().parent().attr('widget')):i;$(\"[widget='\"+widgets[index].key+\"']\").remove();if(!onlyFromScreen)widgets.splice(index,1);}function addWidget(){var widget=JSON.parse(JSON.stringify(widgetTemplate));widget.key=widgets.length==0?1:Math.max.apply(0,widgets.map(function(v){return v.key}))+1;widgets.push(widget);createWidget(widget,true);}function createWidget(widget,editMode){var elem=$(\"<div class='widget'></div>\").css(\"left\",widget.position[0]).css(\"top\",widget.position[1]).attr(\"widget\",widget.key);$(\".widget-canvas\").append(elem[0]);elem[0].style.left=widget.position[0];elem[0].style.top=widget.position[1];elem[0].style.width=widget.size[0];elem[0].style.height=widget.size[1];elem[0].style.zindex=widget.key;if(widget.type==\"Joystick\"||widget.type==\"Tank/2-Wheel Joystick\"){widget.object=new VirtualJoystick({mouseSupport:true,limitStickTravel:true,stickRadius:255,container:elem[0]});}if(widget.type==\"Buttons\"){elem.append($('<svg class=\"buttons-widget button-vertical d1\" xmlns=\"http://www.w3.org/2000/svg\" width=\"100%\" height=\"100%\" viewBox=\"0 0 24 24\"><path fill=\"none\" d=\"M0 0h24v24H0V0z\"/><path d=\"M4 12l1.41 1.41L11 7.83V20h2V7.83l5.58 5.59L20 12l-8-8-8 8z\"/></svg><svg class=\"buttons-widget button-vertical d2\"xmlns=\"http://www.w3.org/2000/svg\" width=\"100%\" height=\"100%\" viewBox=\"0 0 24 24\"><path fill=\"none\" d=\"M0 0h24v24H0V0z\"/><path d=\"M20 12l-1.41-1.41L13 16.17V4h-2v12.17l-5.58-5.59L4 12l8 8 8-8z\"/></svg>'));interact(\".buttons-widget.d1\").on(\"down\",function(event){event.preventDefault();var index=getIndex(event.target.parentElement.getAttribute(\"widget\"));if(index==-1)index=getIndex(event.target.parentElement.parentElement.getAttribute(\"widget\"));widgets[index].motors[0].inputValue=100;widgets[index].motors[1].inputValue=100;});interact(\".buttons-widget.d2\").on(\"down\",function(event){event.preventDefault();var index=getIndex(event.target.parentElement.getAttribute(\"widget\"));if(index==-1)index=getIndex(event.target.parentElement.parentElement.getAttribute(\"widget\"));widgets[index].motors[0].inputValue=-100;widgets[index].motors[1].inputValue=-100;});interact(\".buttons-widget\").on(\"up\",function(event){event.preventDefault();var index=getIndex(event.target.parentElement.getAttribute(\"widget\"));if(index==-1)index=getIndex(event.target.parentElement.parentElement.getAttribute(\"widget\"));widgets[index].motors[0].inputValue=0;widgets[index].motors[1].inputValue=0;});}if(editMode){editWidgets();editWidgets();}}function updateConfigScreen(indx){for(var x=0;x<2;x++){if(this.widgets[indx].motors.length>x){$('#motorChannel'+x).empty();addRadiobutton($('#motorChannel'+x),\"None\",-1,this.widgets[indx].motors[x].channel==-1);config.channels.forEach(function(channel,i){if(channel==1){addRadiobutton($('#motorChannel'+x),i,i,this.widgets[indx].motors[x].channel==i);}else if(channel==2){addRadiobutton($('#motorChannel'+x),i+\"a\",i+\"a\",this.widgets[indx].motors[x].channel==i+\"a\");addRadiobutton($('#motorChannel'+x),i+\"b\",i+\"b\",this.widgets[indx].motors[x].channel==i+\"b\");}});}else{addRadiobutton($('#motorChannel'+x),\"None\",-1,true);}}$('#configType').empty();widgetTypes.forEach(function(type,i){addRadiobutton($('#configType'),type.type,type.type,this.widgets[indx].type==type.type);});updateMotorLabels();$('input[type=radio][name=configType]').change(function(){widgets[editedWidgetIndex].type=this.value;updateMotorLabels();});}function updateMotorLabels(){for(var x=0;x<2;x++){$('#motor'+(x+1)+'label').html('<b>Channnel for '+this.widgetTypes[this.widgetTypes.map(function(e){return e.type;}).indexOf(this.widgets[editedWidgetIndex].type)].motors[x]+' Motor</b>');}}function editWidget(elem){var index=elem.parent().parent().attr('widget');editedWidgetIndex=getIndex(index);this.widgets[editedWidgetIndex].position=[elem.parent().parent().css('left'),elem.parent().parent().css('top')];this.widgets[editedWidgetIndex].size=[elem.parent().parent().css('width'),elem.parent().parent().css('height')];var modal=document.getElementById('widgetConfig');modal.style.display=\"block\";updateConfigScreen(editedWidgetIndex);}function closeEditWidget(){document.getElementById('widgetConfig').style.display=\"none\";widgets[editedWidgetIndex].motors[0].channel=document.querySelector('input[name=\"motorChannel0\"]:checked')&&document.querySelector('input[name=\"motorChannel0\"]:checked').value;if(widgets[editedWidgetIndex].motors.length>1)widgets[editedWidgetIndex].motors[1].channel=document.querySelector('input[name=\"motorChannel1\"]:checked')&&document.querySelector('input[name=\"motorChannel1\"]:checked').value;widgets[editedWidgetIndex].type=document.querySelector('input[name=\"configType\"]:checked')&&document.querySelector('input[name=\"configType\"]:checked').value;deleteWidget(null,true,editedWidgetIndex);createWidget(widgets[editedWidgetIndex],true);}function systemConfig(){document.getElementById('systemConfig').style.display=\"block\";document.getElementById('sendRateSlider').value=config.sendRate;config.channels.forEach(function(channel,i){$(\"#\"+\"channel\"+(i+1)+\"Setup_0\").prop(\"checked\",channel==0);$(\"#\"+\"channel\"+(i+1)+\"Setup_1\").prop(\"checked\",channel==1);$(\"#\"+\"channel\"+(i+1)+\"Setup_2\").prop(\"checked\",channel==2);});}function closeSystemConfig(){document.getElementById('systemConfig').style.display=\"none\";config.sendRate=document.getElementById('sendRateSlider').value;config.channels.forEach(function(channel,i){config.channels[i]=$(\"#channel\"+(i+1)+\"Setup_0\").prop(\"checked\")?0:$(\"#channel\"+(i+1)+\"Setup_1\").prop(\"checked\")?1:2;});localStorage.setItem(\"config\",JSON.stringify(config));sendConfig();}function configMotor(index){editedMotorIndex=index;var motor=widgets[editedWidgetIndex].motors[editedMotorIndex];document.getElementById('motorConfig').style.display=\"block\";document.getElementById('mySpeed').value=motor.speed[0];document.getElementById('myRange').value=motor.range[0];document.getElementById('invertDirection').checked=motor.invert;document.getElementById('returnToZero').checked=motor.return;document.getElementById('holdZero').checked=motor.zero;}function closeMotorConfig(){document.getElementById('motorConfig').style.display=\"none\";widgets[editedWidgetIndex].motors[editedMotorIndex].speed[0]=document.getElementById('mySpeed').value;widgets[editedWidgetIndex].motors[editedMotorIndex].range[0]=document.getElementById('myRange').value;widgets[editedWidgetIndex].motors[editedMotorIndex].invert=document.getElementById('invertDirection').checked;widgets[editedWidgetIndex].motors[editedMotorIndex].return=document.getElementById('returnToZero').checked;widgets[editedWidgetIndex].motors[editedMotorIndex].zero=document.getElementById('holdZero').checked;}function pixelsToPercent(){widgets.forEach(function(widget,i){var elem=$(\"[widget='\"+widget.key+\"']\")[0];var height=window.innerHeight;var width=window.innerWidth;elem.style.height=elem.style.height.replace(\"px\",\"\")/height*100+\"%\";elem.style.width=elem.style.width.replace(\"px\",\"\")/width*100+\"%\";elem.style.top=elem.style.top.replace(\"px\",\"\")/height*100+\"%\";elem.style.left=elem.style.left.replace(\"px\",\"\")/width*100+\"%\";});}function percentToPixels(){widgets.forEach(function(widget,i){var elem=$(\"[widget='\"+widget.key+\"']\")[0];var height=window.innerHeight;var width=window.innerWidth;elem.style.height=elem.style.height.replace(\"%\",\"\")/100*height+\"px\";elem.style.width=elem.style.width.replace(\"%\",\"\")/100*width+\"px\";elem.style.top=elem.style.top.replace(\"%\",\"\")/100*height+\"px\";elem.style.left=elem.style.left.replace(\"%\",\"\")/100*width+\"px\";elem.setAttribute('data-x',elem.style.left.replace(\"px\",\"\"));elem.setAttribute('data-y',elem.style.top.replace(\"px\",\"\"));});}function dragMoveListener(event){var target=event.target,x=(parseFloat(target.getAttribute('data-x'))||0)+event.dx,y=(parseFloat(target.getAttribute('data-y'))||0)+event.dy;target.style.left=x+'px';target.style.top=y+'px';target.setAttribute('data-x',x);target.setAttribute('data-y',y);}window.dragMoveListener=dragMoveListener;function editWidgets(){editmode=!editmode;if(editmode){percentToPixels();var widget=$(\".widget\").addClass('widget-edit').append($(\"<div class='edit-widget-container'></div>\").append('<div class=\"edit-widget-button\" onclick=\"editWidget($(this))\" ontouchstart=\"editWidget($(this));event.preventDefault();\">'+iconSpanner+'</div>').append('<div class=\"edit-widget-button\" onclick=\"deleteWidget($(this), false)\" ontouchstart=\"deleteWidget($(this), false);event.preventDefault();\">'+iconDelete+'</div>').append('<div class=\"drag-widget-button\" style=\"cursor: move\">'+iconMove+'</div>'));interact(\".widget\").draggable({enabled:true,onmove:window.dragMoveListener,restrict:{restriction:'parent',elementRect:{top:0,left:0,bottom:1,right:1}},inertia:true,}).resizable({enabled:true,edges:{left:true,right:true,bottom:true,top:true},restrictEdges:{outer:'parent',endOnly:true,},restrictSize:{min:{width:100,height:50},},inertia:true,}).on('resizemove',function(event){var target=event.target,x,y;target.style.width=event.rect.width+'px';target.style.height=event.rect.height+'px';x=event.rect.left;y=event.rect.top;target.style.left=x+'px';target.style.top=y+'px';target.setAttribute('data-x',x);target.setAttribute('data-y',y);});$(\".edit-button\").addClass('edit-active-button');$('.toolbar').append(\"<div class='button toolbar-button' onclick='systemConfig()'>\"+iconConfig+\"</div>\");$('.toolbar').append(\"<div class='button toolbar-button' onclick='addWidget()'>\"+iconAdd+\"</div>\");widgets.forEach(function(widget,i){if(widget.object!=null){widget.object.destroy();delete widget.object;}});}else{interact(\".widget\").unset();$(\".widget\").removeClass('widget-edit');$(\".edit-button\").removeClass('edit-active-button');$(\".edit-widget-button\").remove();$(\".toolbar-button\").remove();$(\".edit-widget-container\").remove();pixelsToPercent();widgets.forEach(function(widget,i){elem=$(\"[widget='\"+widget.key+\"']\")[0];widget.position=[elem.style.left,elem.style.top];widget.size=[elem.style.width,elem.style.height];if(widget.type==\"Joystick\"||widget.type==\"Tank/2-Wheel Joystick\"){widget.object=new VirtualJoystick({mouseSupport:true,limitStickTravel:true,stickRadius:255,container:elem});}});localStorage.setItem(\"widgets\",JSON.stringify(widgets,function(key,value){return key==\"object\"?undefined:value}));}}setInterval(function(){updatePositions();},config.sendRate*1000);var lastBuf=null;function updatePositions(){var buf=new Uint8Array(2*8+1);buf[0]=1;var axes=[0,0];widgets.forEach(function(widget,i){if(widget.object!=null){if(widget.type!=\"Tank Joystick\"){var max=widget.object._stickRadius;var x=widget.object.deltaY();var y=-widget.object.deltaX();var v=(max-Math.abs(x))*(y/max)+y;var w=(max-Math.abs(y))*(x/max)+x;axes[0]=(v-w)/2;axes[1]=(v+w)/2;}else if(widget.type==\"Joystick\"){axes[0]=widget.object.deltaX()/widget.object._stickRadius*255;axes[1]=widget.object.deltaY()/widget.object._stickRadius*255;}}if(widget.type==\"Buttons\"){widget.motors.forEach(function(motor,index){axes[index]=widget.motors[index].inputValue*2.55;});}widget.motors.forEach(function(motor,index){var channelNumber=-1;if((typeof motor.channel==='string'||motor.channel instanceof String)&&(motor.channel.indexOf('a')!=-1||motor.channel.indexOf('b')!=-1)){if(motor.channel.indexOf('b')!=-1){channelNumber=parseInt(motor.channel.substring(0,1))+4;}else{channelNumber=parseInt(motor.channel.substring(0,1));}}else{channelNumber=parseInt(motor.channel);}if(channelNumber!=-1&&Math.abs(axes[index])>buf[channelNumber*2+2]){buf[channelNumber*2+1]=(Math.sign(axes[index])*(motor.invert==true?-1:1))+1;buf[channelNumber*2+2]=Math.abs(axes[index]);}});});if(buf!=lastBuf){sendPos(buf);lastBuf=buf;}}var ws;var openingWS=true;$(function(){if(localStorage.getItem(\"widgets\")){widgets=JSON.parse(localStorage.getItem(\"widgets\"));}widgets.forEach(function(widget,i){createWidget(widget);});ws=initWS();});config_stored=JSON.parse(localStorage.getItem(\"config\"));if(config_stored!=null)config=config_stored;function connectionError(){document.getElementById(\"connect\").classList.remove(\"connected\");document.getElementById(\"connect\").classList.add(\"connection-error\");}function initWS(){var ws=new WebSocket(\"ws://@IP_ADDRESS@/ws\",['arduino']);ws.binaryType=\"arraybuffer\";ws.onopen=function(){openingWS=false;document.getElementById(\"connect\").classList.add(\"connected\");document.getElementById(\"connect\").classList.remove(\"connection-error\");sendConfig();};ws.onerror=function(){connectionError();};ws.onclose=function(){connectionError();};openingWS=true;return ws;}function sendPos(buf){if(ws&&ws.readyState!=1&&!openingWS){connectionError();}else if(ws&&ws.readyState==1)ws.send(buf);}function sendConfig(){var buf=new Uint8Array(5);buf[0]=0;for(var i=0;i<3;i++)buf[i+1]=config.channels[i];if(ws&&ws.readyState!=1&&!openingWS){connectionError();}else if(ws)ws.send(buf);}function connect(){ws=initWS();}</script><div class=widget-canvas></div><div class=connect-toolbar><div class=button id=connect onclick=connect()><svg xmlns=http://www.w3.org/2000/svg width=24 height=24 viewBox=\"0 0 24 24\"><path fill=none d=\"M0 0h24v24H0z\"/><path d=\"M1 9l2 2c4.97-4.97 13.03-4.97 18 0l2-2C16.93 2.93 7.08 2.93 1 9zm8 8l3 3 3-3c-1.65-1.66-4.34-1.66-6 0zm-4-4l2 2c2.76-2.76 7.24-2.76 10 0l2-2C15.14 9.14 8.87 9.14 5 13z\"/></svg></div></div><div class=toolbar><div class=\"button edit-button\" onclick=editWidgets()><svg xmlns=http://www.w3.org/2000/svg width=24 height=24 viewBox=\"0 0 24 24\"><path clip-rule=evenodd fill=none d=\"M0 0h24v24H0z\"/><path d=\"M22.7 19l-9.1-9.1c.9-2.3.4-5-1.5-6.9-2-2-5-2.4-7.4-1.3L9 6 6 9 1.6 4.7C.4 7.1.9 10.1 2.9 12.1c1.9 1.9 4.6 2.4 6.9 1.5l9.1 9.1c.4.4 1 .4 1.4 0l2.3-2.3c.5-.4.5-1.1.1-1.4z\"/></svg></div></div><div id=widgetConfig class=modal><div class=modal-content><span class=\"button close\" onclick=closeEditWidget()>&times;</span><label for=configType><b>Type</b></label><div class=radio-toolbar id=configType></div><br><label for=layout><b>Layout</b></label><div class=radio-toolbar><input type=radio checked name=layout value=vert id=cb1><label for=cb1>Vertical</label><input type=radio name=layout value=hor id=cb2><label for=cb2>Horizontal</label></div><br><label for=motorChannel0 id=motor1label><b>Channel for Left Motor</b></label><div class=radio-toolbar id=motorChannel0></div><div class=\"button edit-button\" onclick=configMotor(0)><svg xmlns=http://www.w3.org/2000/svg width=24 height=24 viewBox=\"0 0 24 24\"><path d=\"M3 17.25V21h3.75L17.81 9.94l-3.75-3.75L3 17.25zM20.71 7.04c.39-.39.39-1.02 0-1.41l-2.34-2.34c-.39-.39-1.02-.39-1.41 0l-1.83 1.83 3.75 3.75 1.83-1.83z\"/><path d=\"M0 0h24v24H0z\" fill=\"none\"/></svg></div><label for=motorChannel1 id=motor2label><b>Channel for Right Motor</b></label><div class=radio-toolbar id=motorChannel1></div><div class=\"button edit-button\" onclick=configMotor(1)><svg xmlns=http://www.w3.org/2000/svg width=24 height=24 viewBox=\"0 0 24 24\"><path d=\"M3 17.25V21h3.75L17.81 9.94l-3.75-3.75L3 17.25zM20.71 7.04c.39-.39.39-1.02 0-1.41l-2.34-2.34c-.39-.39-1.02-.39-1.41 0l-1.83 1.83 3.75 3.75 1.83-1.83z\"/><path d=\"M0 0h24v24H0z\" fill=\"none\"/></svg></div></div></div><div id=motorConfig class=modal><div class=modal-content><span class=\"button close\" onclick=closeMotorConfig()>&times;</span><label for=speed><b>Speed</b></label><div class=slidecontainer><input type=range name=speed min=1 max=100 value=50 class=slider id=mySpeed></div><br><label for=range><b>Range</b></label><div class=slidecontainer><input type=range name=range min=1 max=100 value=50 class=slider id=myRange></div><br><label for=invert><b>Flip Direction</b></label><div name=invert><label class=switch><input type=checkbox id=invertDirection><span class=\"cbslider round\"></span></label></div><br><label for=return><b>Return to zero</b></label><div name=return><label class=switch><input type=checkbox id=returnToZero><span class=\"cbslider round\"></span></label></div><br><label for=invert><b>Hold Zero</b></label><div name=zero><label class=switch><input type=checkbox id=holdZero><span class=\"cbslider round\"></span></label></div><br><label for=steps><b>Steps/Revolution</b></label><input type=number name=steps min=1><br></div></div><div id=systemConfig class=modal><div class=modal-content><span class=\"button close\" onclick=closeSystemConfig()>&times;</span><label for=speed id=rateLabel><b>Send Rate</b>: 0.15 s/message</label><div class=slidecontainer><input type=range name=speed min=0.05 max=1.05 step=0.05 value=0.15 class=slider id=sendRateSlider onchange=\"$('#rateLabel').html('<b>Send Rate</b>: '+this.value+' s/message')\"></div><br><label for=channel1Setup><b>Channel 1 Configuration</b></label><div class=radio-toolbar id=channel1Setup><input type=radio name=channel1Setup id=channel1Setup_0 value=disabled><label for=channel1Setup_0>Disabled</label><input type=radio name=channel1Setup id=channel1Setup_1 value=stepper><label for=channel1Setup_1>Stepper</label><input type=radio name=channel1Setup id=channel1Setup_2 value=brushed><label for=channel1Setup_2>2x Brushed Motors</label></div><label for=channel2Setup><b>Channel 2 Configuration</b></label><div class=radio-toolbar id=channel2Setup><input type=radio name=channel2Setup id=channel2Setup_0 value=disabled><label for=channel2Setup_0>Disabled</label><input type=radio name=channel2Setup id=channel2Setup_1 value=stepper><label for=channel2Setup_1>Stepper</label><input type=radio name=channel2Setup id=channel2Setup_2 value=brushed><label for=channel2Setup_2>2x Brushed Motors</label></div><label for=channel3Setup><b>Channel 3 Configuration</b></label><div class=radio-toolbar id=channel3Setup><input type=radio name=channel3Setup id=channel3Setup_0 value=disabled><label for=channel3Setup_0>Disabled</label><input type=radio name=channel3Setup id=channel3Setup_1 value=stepper><label for=channel3Setup_1>Stepper</label><input type=radio name=channel3Setup id=channel3Setup_2 value=brushed><label for=channel3Setup_2>2x Brushed Motors</label></div><label for=channel4Setup><b>Channel 4 Configuration</b></label><div class=radio-toolbar id=channel4Setup><input type=radio name=channel4Setup id=channel4Setup_0 value=disabled><label for=channel4Setup_0>Disabled</label><input type=radio name=channel4Setup id=channel4Setup_1 value=stepper><label for=channel4Setup_1>Stepper</label><input type=radio name=channel4Setup id=channel4Setup_2 value=brushed><label for=channel4Setup_2>2x Brushed Motors</label></div></div></div></body></html>";
@@ -1,6 +0,0 @@
-#include "pgmspace.h"
-
-const uint8_t interact[] PROGMEM = 
-{
-    0x1f, 0x8b, 0x08, 0x00, 0x40, 0xc5, 0x13, 0x5b, 0x00, 0xff, 0xd5, 0xbd, 0x7b, 0x73, 0x1b, 0xd7, 0x95, 0x2f, 0xfa, 0x7f, 0x3e, 0x05, 0x85, 0x3b, 0xa5, 0x03, 0x48, 0x20, 0x48, 0x4a, 0xb6, 0x33, 0x01, 0x04, 0xb1, 0x6c, 0x4b, 0x39, 0xa3, 0xba, 0x76, 0xe4, 0x13, 0xc9, 0x19, 0xab, 0x38, 0x8c, 0xab, 0x09, 0x34, 0x49, 0x4c, 0x40, 0x34, 0x06, 0x0f, 0x92, 0x18, 0x92, 0xdf, 0xfd, 0xfc, 0x7e, 0x6b, 0xad, 0xfd, 0xea, 0xde, 0x20, 0x29, 0x39, 0x99, 0x9b, 0x5b, 0x85, 0x47, 0xf7, 0x7e, 0x3f, 0xd7, 0x5e, 0x7b, 0x3d, 0xf7, 0x9e, 0xed, 0x4c, 0x66, 0xab, 0x72, 0x51, 0x8c, 0x56, 0xbd, 0xff, 0x5c, 0xee, 0x5c, 0x1e, 0xf4, 0x5e, 0xf6, 0xbe, 0xda, 0xb9, 0xdd, 0x39, 0x5f, 0xad, 0xe6, 0xcb, 0xfe, 0xde, 0xde, 0xa2, 0xb8, 0xea, 0x9d, 0x4d, 0x56, 0xe7, 0xeb, 0x93, 0xde, 0xa8, 0xba, 0xd8, 0x5b, 0x15, 0x9b, 0x72, 0x2f, 0xca, 0xb0, 0x77, 0x51, 0x2c, 0xf1, 0xb2, 0xf7, 0xc3, 0xbb, 0xef, 0xdf, 0xfe, 0xe9, 0xc3, 0xdb, 0x9d, 0x67, 0x7b, 0xbf, 0x7b, 0x72, 0xba, 0x9e, 0x8d, 0x56, 0x93, 0x6a, 0xd6, 0x5e, 0x75, 0x6e, 0x26, 0xa7, 0xed, 0x56, 0x75, 0xf2, 0x9f, 0xe5, 0x68, 0xd5, 0x1a, 0x0e, 0x57, 0x9b, 0x79, 0x59, 0x9d, 0xee, 0x94, 0xd7, 0xf3, 0x6a, 0xb1, 0x5a, 0x3e, 0x7d, 0xda, 0x5a, 0xcf, 0xc6, 0xe5, 0xe9, 0x64, 0x56, 0x8e, 0x5b, 0x4f, 0x5c, 0xe4, 0x45, 0x35, 0x5e, 0x4f, 0xcb, 0x8e, 0xfe, 0xf5, 0x2c, 0xe9, 0x70, 0xd5, 0xee, 0x0c, 0xca, 0xe9, 0xb2, 0xdc, 0x61, 0x79, 0xae, 0xfc, 0x50, 0xa2, 0x96, 0xf2, 0xf4, 0xa9, 0xfe, 0xf7, 0x8a, 0x8b, 0x71, 0x47, 0x1f, 0xdb, 0x47, 0xc7, 0xdd, 0x95, 0x66, 0xbd, 0xb9, 0x2c, 0x16, 0x3b, 0xe5, 0xa0, 0x1c, 0xe6, 0x6a, 0xbd, 0x9a, 0xcc, 0xc6, 0xd5, 0xd5, 0xa1, 0xfe, 0xf5, 0x73, 0x29, 0xce, 0xa6, 0xd5, 0x49, 0x31, 0x3d, 0xd4, 0xbf, 0x6c, 0x8a, 0x65, 0x39, 0x3d, 0x3d, 0xe4, 0x4f, 0x7f, 0x75, 0x3e, 0x59, 0x76, 0xcb, 0x9e, 0x1b, 0x26, 0xb6, 0xfe, 0xee, 0xae, 0xed, 0x87, 0xa5, 0x73, 0xb3, 0x28, 0x57, 0xeb, 0xc5, 0x6c, 0xc7, 0x85, 0xec, 0xac, 0xda, 0x65, 0x77, 0xd6, 0x5d, 0x74, 0x6e, 0x7c, 0xc8, 0xa4, 0xbd, 0xec, 0x16, 0x32, 0x7c, 0x4f, 0x66, 0x47, 0xcb, 0x63, 0x7d, 0x2a, 0xe5, 0x89, 0xfd, 0x18, 0x0d, 0x33, 0xa3, 0xb0, 0x28, 0xff, 0x6b, 0x3d, 0x59, 0x60, 0x18, 0xec, 0x61, 0xc0, 0x3c, 0xc5, 0xd3, 0xa7, 0xa3, 0x8e, 0xd5, 0x37, 0x42, 0xa1, 0x4f, 0xf6, 0x3b, 0x0c, 0xaf, 0x5c, 0x58, 0x65, 0x61, 0x2c, 0x75, 0x3a, 0x9c, 0x95, 0x57, 0x3b, 0x6f, 0x17, 0x8b, 0x6a, 0xd1, 0x6e, 0x7d, 0x5f, 0xcc, 0x66, 0xd5, 0x6a, 0x07, 0x9d, 0x1c, 0xdb, 0xa4, 0xec, 0xfc, 0xaf, 0xd6, 0xf3, 0xe5, 0xf3, 0xd6, 0xff, 0x6a, 0x75, 0x06, 0xab, 0xf3, 0x45, 0x75, 0xb5, 0x33, 0xc5, 0x92, 0x18, 0x63, 0x40, 0x7f, 0x7c, 0xff, 0xe6, 0xe7, 0x1f, 0xde, 0xfe, 0xfa, 0xa7, 0xf7, 0x1f, 0x7f, 0xfd, 0xe3, 0xfb, 0x9f, 0xff, 0xf4, 0xa6, 0xd5, 0x9d, 0xde, 0xb1, 0xbc, 0xf9, 0x90, 0x6d, 0x1f, 0xde, 0xd8, 0x2c, 0xf6, 0x6f, 0xee, 0xee, 0x06, 0xec, 0xc3, 0xd1, 0xfe, 0x71, 0x6f, 0x54, 0x4c, 0xa7, 0xed, 0xb9, 0x9b, 0xe0, 0x6e, 0xbc, 0x66, 0x98, 0x75, 0x36, 0x94, 0x84, 0x07, 0xc7, 0x47, 0xab, 0xe3, 0x81, 0x35, 0x75, 0xd2, 0x9e, 0xdd, 0xde, 0xae, 0x3a, 0x77, 0xdd, 0x79, 0x37, 0x64, 0x5c, 0x75, 0x75, 0xe8, 0xee, 0x2c, 0x11, 0x6b, 0x74, 0x91, 0x77, 0xa7, 0xe8, 0x08, 0x4b, 0xab, 0x1e, 0x33, 0x5c, 0xdd, 0xe5, 0x70, 0x7f, 0xb0, 0x7c, 0xb5, 0xe8, 0x4d, 0xcb, 0xd9, 0xd9, 0xea, 0x7c, 0xb0, 0x7c, 0xfe, 0xbc, 0x33, 0x69, 0x2f, 0x38, 0xe6, 0xbe, 0x05, 0x77, 0xed, 0x9b, 0x83, 0xfe, 0x51, 0x68, 0x2c, 0x2b, 0xef, 0xdc, 0xb4, 0xd6, 0x58, 0x99, 0xcb, 0xd5, 0x62, 0x82, 0x55, 0x3e, 0x88, 0x96, 0x86, 0xaf, 0xca, 0x96, 0x57, 0x58, 0xcf, 0xbe, 0x84, 0xd2, 0x2f, 0x86, 0x55, 0xbb, 0xd5, 0xdb, 0x5b, 0x2e, 0x46, 0x7b, 0xeb, 0xd5, 0x64, 0xba, 0xdc, 0xd3, 0x2c, 0xad, 0x0e, 0x56, 0xd1, 0x04, 0xcb, 0xa3, 0xd3, 0xf5, 0xf1, 0x88, 0x28, 0xaf, 0x5b, 0x9d, 0xbb, 0x7e, 0xbc, 0x3d, 0x6a, 0x71, 0xdd, 0x9b, 0x24, 0xa0, 0x7f, 0xf0, 0x87, 0x6e, 0xae, 0xf4, 0xfe, 0xd7, 0x2f, 0xee, 0x8e, 0xbb, 0x2f, 0x1e, 0xe8, 0x91, 0x5f, 0x94, 0x0b, 0x46, 0xeb, 0x52, 0x6c, 0xaf, 0x00, 0x36, 0x96, 0xab, 0x62, 0x36, 0x92, 0x1d, 0xdd, 0xe9, 0xe8, 0x8a, 0xe0, 0xfa, 0xf9, 0x88, 0x3e, 0xa7, 0x6b, 0x88, 0x73, 0xbd, 0x53, 0xec, 0x8c, 0xa6, 0xc5, 0x72, 0xb9, 0x53, 0xe0, 0xe3, 0x57, 0x3e, 0x9a, 0x1a, 0x2d, 0x79, 0x29, 0xdd, 0xcd, 0xd9, 0x0c, 0xb3, 0x31, 0x7b, 0x55, 0xba, 0xd9, 0x98, 0x61, 0x36, 0x64, 0x65, 0x2c, 0x06, 0x0b, 0xac, 0x8d, 0xd9, 0xb1, 0xac, 0xd8, 0xc9, 0x70, 0xc1, 0xd5, 0xbc, 0xea, 0x4d, 0x2e, 0x2e, 0xca, 0xf1, 0xa4, 0x58, 0x95, 0x3f, 0x2d, 0xaa, 0x79, 0x71, 0x56, 0xb0, 0xc4, 0x0f, 0xab, 0x6a, 0x3e, 0x2f, 0xc7, 0x9d, 0x93, 0x45, 0x59, 0xfc, 0x6d, 0x80, 0xe2, 0xb1, 0x0b, 0x75, 0x35, 0xc8, 0x78, 0xe9, 0x48, 0x94, 0xd7, 0xab, 0x72, 0x36, 0x06, 0x24, 0x6b, 0x75, 0xb0, 0x00, 0xa2, 0x3d, 0x1a, 0x6f, 0x4e, 0x4c, 0x52, 0x5b, 0x36, 0xf5, 0x0a, 0xf3, 0x80, 0xff, 0x5e, 0x35, 0x67, 0xd4, 0x72, 0x58, 0xb5, 0x6f, 0xee, 0xba, 0xe5, 0xed, 0xed, 0xcd, 0x9d, 0x5f, 0x80, 0xab, 0xde, 0x7c, 0x51, 0xad, 0x2a, 0xce, 0x7c, 0xef, 0x14, 0xcb, 0x2a, 0x94, 0x69, 0x4b, 0xbb, 0x1c, 0x5e, 0x56, 0x93, 0xf1, 0xce, 0x7e, 0x77, 0x36, 0x6c, 0x61, 0x04, 0x9e, 0xaf, 0x7a, 0x4c, 0xdb, 0x5d, 0x0c, 0xa5, 0x64, 0x05, 0x30, 0x83, 0x76, 0x29, 0xaf, 0x47, 0x1a, 0x79, 0xdc, 0x79, 0xfa, 0x54, 0x87, 0x47, 0xaa, 0x47, 0xef, 0x9f, 0x3e, 0xb5, 0x07, 0x94, 0xda, 0x7d, 0x22, 0x75, 0xd6, 0xba, 0x8d, 0x75, 0xfd, 0xf4, 0x29, 0x8a, 0x59, 0x34, 0xca, 0xb8, 0xeb, 0xc6, 0x6d, 0xac, 0x66, 0x51, 0x0b, 0x39, 0x01, 0x5a, 0xef, 0xf1, 0xa1, 0xfd, 0xf7, 0xe6, 0xeb, 0xe5, 0x39, 0x86, 0x40, 0xa0, 0x1a, 0xde, 0x87, 0x47, 0xe5, 0x71, 0xad, 0x84, 0xd3, 0xd3, 0x5a, 0x11, 0x3a, 0x7f, 0x96, 0x01, 0x3d, 0x9b, 0x1d, 0xce, 0xb0, 0x8e, 0xb1, 0x12, 0xdf, 0x9f, 0xb2, 0xa4, 0xdd, 0x83, 0xc1, 0xee, 0xc1, 0x93, 0xe1, 0x10, 0x0d, 0x9c, 0xf5, 0x96, 0xf3, 0xe9, 0x64, 0x54, 0xb6, 0x17, 0xdd, 0x83, 0x4e, 0xb7, 0x3d, 0x7b, 0xfa, 0x74, 0x7f, 0x38, 0x1c, 0xce, 0x6c, 0xd6, 0x6f, 0x6f, 0x9f, 0x94, 0x68, 0xb6, 0x8c, 0x3d, 0xab, 0xd6, 0x81, 0x63, 0x07, 0xee, 0x78, 0x20, 0xf8, 0xf5, 0xbf, 0xd4, 0x05, 0x5f, 0x9f, 0xd1, 0xfe, 0x57, 0x07, 0x58, 0xde, 0x2f, 0xff, 0x3f, 0x5d, 0xde, 0xba, 0x4a, 0x1b, 0x0b, 0x0e, 0xab, 0x2d, 0x59, 0x86, 0x67, 0xe5, 0xea, 0xfd, 0x62, 0x72, 0x36, 0x99, 0xfd, 0xf2, 0x49, 0x16, 0xa2, 0x44, 0x01, 0x8e, 0x14, 0xeb, 0xe9, 0xea, 0xbd, 0x2e, 0x36, 0x84, 0x17, 0x71, 0x96, 0x0f, 0x93, 0xb3, 0x59, 0x31, 0x45, 0x70, 0x0f, 0xcd, 0x6a, 0x77, 0xba, 0xa3, 0x6d, 0xab, 0x17, 0xf0, 0x71, 0xd4, 0x9d, 0x02, 0x6a, 0xae, 0x75, 0x66, 0xc6, 0xc3, 0x62, 0x71, 0xb6, 0xbe, 0x28, 0x67, 0xab, 0xa5, 0x8d, 0xf3, 0xeb, 0x6f, 0x9e, 0x3e, 0xd5, 0xb1, 0xc5, 0xac, 0xf8, 0xc8, 0xa3, 0x6f, 0xb0, 0xcc, 0xe2, 0xb7, 0x81, 0xdf, 0x05, 0xb2, 0xf9, 0x4e, 0x87, 0x65, 0x6f, 0x85, 0xf8, 0x72, 0xd5, 0xbd, 0x1c, 0xb6, 0x4f, 0x9f, 0x3e, 0x3d, 0x75, 0xfb, 0xe2, 0xf6, 0x76, 0xd9, 0xe9, 0x8d, 0xcb, 0xe9, 0xaa, 0xf8, 0x50, 0xad, 0x17, 0xa3, 0xb2, 0x7b, 0x86, 0x9d, 0x72, 0x8a, 0x16, 0x8c, 0x3a, 0xdd, 0xf3, 0x61, 0x0b, 0x03, 0xbb, 0x20, 0x3e, 0x30, 0x9c, 0x76, 0x2f, 0x86, 0x2d, 0x8e, 0x86, 0x3c, 0x6f, 0x86, 0xe7, 0x00, 0x91, 0x12, 0xf9, 0x7d, 0x55, 0x2d, 0xc6, 0x4b, 0x40, 0xb8, 0xd1, 0x7a, 0xa1, 0xcf, 0xdd, 0x6b, 0xd4, 0x36, 0x5f, 0x94, 0x97, 0x6f, 0x2f, 0xd1, 0x9a, 0xc1, 0x7c, 0x38, 0xbf, 0xbd, 0xc5, 0x02, 0x98, 0x96, 0x6c, 0x9c, 0x34, 0xe7, 0x64, 0x38, 0xe1, 0x6e, 0xdc, 0xf4, 0xb0, 0x11, 0xb0, 0x51, 0xae, 0xdc, 0xeb, 0x68, 0x3a, 0x41, 0x92, 0xce, 0xe0, 0xa4, 0x77, 0xbd, 0x3b, 0x3c, 0xeb, 0x5d, 0x77, 0x4f, 0x7a, 0x1b, 0x3e, 0x6c, 0xba, 0x57, 0x2e, 0xe4, 0xca, 0x85, 0xc8, 0x16, 0x1c, 0xad, 0x16, 0xd3, 0xff, 0xb7, 0xdc, 0x60, 0x15, 0xda, 0x93, 0x06, 0x17, 0xd3, 0x95, 0x86, 0xea, 0x83, 0x06, 0x2e, 0xcf, 0x27, 0xa7, 0x16, 0xec, 0x1e, 0x35, 0xe2, 0xa2, 0x5c, 0x15, 0x1a, 0x6e, 0x4f, 0x1a, 0x7c, 0xb2, 0x5e, 0xad, 0xb0, 0xe3, 0x66, 0xf6, 0x10, 0x07, 0x2e, 0x7d, 0x28, 0x46, 0x98, 0xc1, 0x3a, 0xb6, 0xc3, 0xb9, 0xb5, 0x6a, 0xbd, 0x58, 0xa0, 0x1f, 0x1f, 0x93, 0xc0, 0x45, 0x39, 0x05, 0xcc, 0x1b, 0x5b, 0xe0, 0xfa, 0xf6, 0x76, 0xb6, 0x9e, 0x4e, 0x35, 0x0a, 0x63, 0xf5, 0x76, 0x36, 0x1e, 0x8e, 0xad, 0x2c, 0xac, 0xda, 0xe1, 0xe8, 0x79, 0x7b, 0x7a, 0x7b, 0xdb, 0xc2, 0x42, 0x92, 0x30, 0x87, 0x9f, 0x60, 0xc6, 0x86, 0x65, 0x1a, 0x54, 0x9c, 0x4c, 0x01, 0xb8, 0x2c, 0xeb, 0xbe, 0xcc, 0x0b, 0xce, 0x8b, 0xd9, 0xc7, 0xc9, 0x45, 0xb9, 0x3c, 0x8a, 0x9e, 0x6d, 0xfd, 0xec, 0x1e, 0x1c, 0xf7, 0xaf, 0x91, 0x50, 0xe6, 0xe1, 0xed, 0xf0, 0x26, 0x2a, 0xb9, 0x5f, 0x76, 0x4b, 0xce, 0x58, 0x7f, 0xd6, 0xb5, 0x80, 0x51, 0x77, 0x7e, 0x5e, 0x2c, 0xcb, 0xfe, 0xb4, 0x6b, 0xb3, 0xd7, 0x9f, 0x77, 0xad, 0x1f, 0xfd, 0x75, 0x97, 0x93, 0xd7, 0x3f, 0xe9, 0xea, 0xa4, 0xf5, 0xaf, 0xba, 0x23, 0x5d, 0x09, 0x9b, 0xae, 0xac, 0x8b, 0xc9, 0xec, 0xac, 0x7f, 0xde, 0xc5, 0x8a, 0xe1, 0xc3, 0x45, 0x37, 0x5a, 0x62, 0xfd, 0xcb, 0xee, 0x44, 0x96, 0x86, 0xc0, 0xa9, 0xbb, 0x41, 0x21, 0xc0, 0xb7, 0xdd, 0x5a, 0x96, 0xab, 0xdd, 0xeb, 0x4d, 0xab, 0xfb, 0xb6, 0xd3, 0xbd, 0x38, 0x94, 0xe5, 0x2b, 0xeb, 0xe3, 0x97, 0xe1, 0xb5, 0xfe, 0xdb, 0x60, 0xe1, 0xf1, 0x93, 0x05, 0x7d, 0xb2, 0xf1, 0x96, 0x16, 0x30, 0x9d, 0x3d, 0xc5, 0xc1, 0x4c, 0x6b, 0x4f, 0x9d, 0x7e, 0x5c, 0x2a, 0x16, 0x59, 0x5c, 0x22, 0x96, 0x5a, 0x5a, 0x1a, 0x96, 0x5c, 0x5a, 0x0e, 0x96, 0x9e, 0x4d, 0xc7, 0xf5, 0x3e, 0x56, 0x78, 0xb4, 0xfa, 0xa5, 0x08, 0xac, 0x50, 0x2e, 0x50, 0x49, 0xb0, 0xc9, 0x26, 0xd8, 0x20, 0x41, 0x5a, 0x49, 0x3d, 0x99, 0x06, 0xc7, 0x25, 0x59, 0xe5, 0x5b, 0x12, 0x6a, 0x89, 0xf1, 0x00, 0xca, 0x38, 0xcb, 0x18, 0xea, 0x8a, 0xc0, 0xd4, 0x7f, 0x58, 0x15, 0x17, 0xf3, 0xe1, 0x26, 0x3c, 0x6b, 0xd4, 0x78, 0xc5, 0x6d, 0x5a, 0xc9, 0x02, 0x78, 0xc3, 0x5c, 0x8d, 0x04, 0xeb, 0x85, 0x9c, 0x52, 0x7a, 0xda, 0xf9, 0xc8, 0x5d, 0x5b, 0x6a, 0xb6, 0xab, 0xe6, 0x65, 0x39, 0xae, 0x15, 0x74, 0x74, 0x79, 0xac, 0xe1, 0x9a, 0xe4, 0xb2, 0x9c, 0x56, 0xa3, 0xc9, 0x6a, 0xf3, 0x4b, 0x26, 0xd9, 0xa5, 0x75, 0xd3, 0xa5, 0xf9, 0x94, 0x4b, 0xe3, 0x36, 0xf0, 0xd5, 0x04, 0x3b, 0xe3, 0x02, 0xdb, 0x02, 0x28, 0x1b, 0x16, 0x18, 0xae, 0x33, 0x0e, 0x38, 0xc9, 0x09, 0xd8, 0xc3, 0xc6, 0xfa, 0xc0, 0x34, 0xed, 0x4e, 0x5f, 0x36, 0x97, 0x1b, 0x17, 0x00, 0x5d, 0x8e, 0x48, 0xee, 0xd8, 0x77, 0x59, 0x62, 0x80, 0xcc, 0x9d, 0x81, 0x9b, 0x40, 0x6d, 0xdf, 0x29, 0xf2, 0xe2, 0xc1, 0x9a, 0x76, 0xf0, 0xd5, 0x37, 0xfb, 0xfb, 0x40, 0x74, 0x6b, 0xe3, 0x13, 0xa5, 0xf2, 0xa1, 0xaf, 0x0f, 0xbe, 0xde, 0x77, 0x88, 0x3c, 0x1b, 0x27, 0xfb, 0xaf, 0x1c, 0x1e, 0xfc, 0xeb, 0xfe, 0xb3, 0x1f, 0x8b, 0xd5, 0x79, 0xaf, 0xc0, 0x09, 0xf6, 0x22, 0xa9, 0xc0, 0x0f, 0x89, 0x9c, 0xe0, 0xf5, 0xd0, 0x5f, 0x3a, 0x7b, 0x92, 0xef, 0xa7, 0x77, 0x83, 0xf2, 0xd5, 0x3e, 0xd1, 0x87, 0xe7, 0xc3, 0x97, 0xdf, 0xd8, 0xed, 0x60, 0x36, 0x3c, 0x38, 0x78, 0xd1, 0xfb, 0xfa, 0xd5, 0x10, 0x28, 0x73, 0xf9, 0xea, 0xc5, 0x57, 0xbf, 0xef, 0x7d, 0x8d, 0xa3, 0xfd, 0xc5, 0x7e, 0x08, 0x7b, 0xf9, 0x92, 0x61, 0x93, 0xe1, 0x13, 0x1c, 0xe3, 0xed, 0x17, 0x7f, 0xd0, 0x08, 0x80, 0xe9, 0x57, 0xdf, 0x20, 0xdc, 0x21, 0xd1, 0x37, 0xeb, 0x79, 0x7f, 0xd1, 0x25, 0x04, 0xe9, 0x3f, 0x01, 0x02, 0xf0, 0x22, 0x64, 0x3f, 0xf8, 0x9a, 0xd9, 0xa7, 0xe5, 0x29, 0x81, 0x05, 0x0e, 0xc3, 0xf3, 0x55, 0x7f, 0xd2, 0x2d, 0x66, 0x67, 0xd3, 0x12, 0x40, 0x44, 0x46, 0xa6, 0xdf, 0x18, 0xab, 0xae, 0x6b, 0x7a, 0xff, 0xe6, 0x3a, 0x89, 0xf5, 0x5d, 0xea, 0x6e, 0xb2, 0xe1, 0x9f, 0xee, 0xee, 0x52, 0x2c, 0x86, 0x49, 0x90, 0xe0, 0x8d, 0x9e, 0xb9, 0xf1, 0xd4, 0xa5, 0xe9, 0x96, 0x40, 0xaf, 0xde, 0x65, 0xb0, 0xcd, 0x38, 0x87, 0x4e, 0xf3, 0x76, 0x94, 0x54, 0xd7, 0x41, 0x13, 0x67, 0x1b, 0x3e, 0xd9, 0x6f, 0x56, 0x76, 0x5f, 0x1d, 0xdb, 0x8a, 0x20, 0x7a, 0x54, 0x00, 0xb5, 0x4b, 0xb6, 0x6f, 0x13, 0x11, 0x05, 0xde, 0x2c, 0xa3, 0x02, 0x54, 0x14, 0x8f, 0x61, 0x59, 0x12, 0x19, 0x55, 0xc8, 0x00, 0x38, 0x8b, 0x09, 0x5d, 0x25, 0x87, 0x79, 0x35, 0x5c, 0x1c, 0x96, 0xfd, 0x59, 0x74, 0x1a, 0xb7, 0x14, 0x72, 0x70, 0xd7, 0x4c, 0x0e, 0xdb, 0x38, 0x1f, 0x78, 0x58, 0x1b, 0x34, 0xda, 0xad, 0x3c, 0x00, 0x45, 0xc4, 0xc6, 0x47, 0x7c, 0xf2, 0x11, 0x04, 0xa1, 0x96, 0x47, 0x80, 0x28, 0x22, 0x14, 0x34, 0x5b, 0x7a, 0x01, 0xa5, 0x16, 0xf8, 0xa9, 0x73, 0x07, 0x4c, 0xa7, 0xb7, 0x54, 0xdc, 0x67, 0x58, 0x20, 0x8d, 0x43, 0x02, 0x47, 0x8a, 0x04, 0xd6, 0x90, 0xa6, 0xfe, 0xc1, 0xbf, 0xf2, 0xea, 0x93, 0xa2, 0x4c, 0xfd, 0x97, 0x5f, 0x85, 0x40, 0x43, 0xc8, 0x80, 0x2c, 0x86, 0xb0, 0x18, 0x1d, 0xeb, 0x7f, 0xc5, 0x4b, 0xd2, 0x57, 0xff, 0x5c, 0x58, 0xe4, 0x68, 0x5a, 0xcd, 0xca, 0x3a, 0x12, 0x39, 0xd1, 0x4b, 0x4c, 0x8c, 0x6c, 0x72, 0x7a, 0x1a, 0x98, 0xa3, 0x47, 0x41, 0x47, 0x1a, 0xaa, 0x93, 0xbe, 0xdc, 0x3b, 0xc1, 0xb1, 0x8c, 0xd0, 0xa9, 0xdd, 0x27, 0x47, 0xd5, 0x9c, 0xaf, 0x73, 0x7d, 0x95, 0x99, 0x26, 0x5e, 0x80, 0xa0, 0xf5, 0x16, 0xfc, 0x14, 0x0b, 0x7b, 0x3b, 0x7e, 0x7a, 0x1a, 0x47, 0x8e, 0xab, 0x8b, 0x9f, 0xf9, 0x80, 0x4c, 0x97, 0xc3, 0x53, 0x42, 0xcc, 0xb7, 0x8a, 0x0c, 0xfc, 0x19, 0xa4, 0x22, 0xa0, 0x8b, 0xa7, 0xbd, 0x19, 0x48, 0x0b, 0xdf, 0x57, 0xa8, 0x12, 0x43, 0x08, 0xa4, 0xf1, 0xb4, 0xb7, 0x5a, 0x6c, 0x3e, 0x00, 0x63, 0x18, 0xad, 0xaa, 0x05, 0xd0, 0xc6, 0xd3, 0xde, 0x45, 0xb1, 0x1a, 0x9d, 0x97, 0x4b, 0x1f, 0xb6, 0x89, 0xcb, 0x77, 0xd7, 0x67, 0xa0, 0x8d, 0x1b, 0x96, 0xfe, 0xef, 0xf2, 0xde, 0x3d, 0x89, 0xd3, 0x14, 0x8b, 0x05, 0x12, 0x5c, 0xe1, 0x90, 0x1e, 0xb9, 0x7a, 0xde, 0xc6, 0xf1, 0x27, 0x98, 0xac, 0x65, 0xc9, 0x34, 0x1f, 0x87, 0x6f, 0x7b, 0x57, 0xe7, 0x65, 0x39, 0xd5, 0xe5, 0x3e, 0x4d, 0xf0, 0xa4, 0xe5, 0xf0, 0x48, 0x2f, 0xa3, 0x1f, 0xb6, 0x23, 0xe0, 0xf1, 0x05, 0x12, 0xd8, 0x1f, 0x2f, 0x8c, 0x09, 0x8e, 0x67, 0xe8, 0x97, 0x4e, 0x97, 0x50, 0x61, 0xec, 0xb8, 0xfc, 0x95, 0x4d, 0xc3, 0x7c, 0x11, 0x19, 0xd5, 0xa7, 0xdb, 0xdb, 0x29, 0xf0, 0xaf, 0x91, 0x20, 0xe5, 0x96, 0x06, 0x9d, 0x1d, 0x5e, 0xb7, 0x79, 0x49, 0xd3, 0x23, 0xcb, 0x65, 0xea, 0xdb, 0x7d, 0xb1, 0xf7, 0x2b, 0x32, 0x28, 0xcc, 0x61, 0xda, 0x90, 0x7d, 0x1c, 0x9f, 0x65, 0x37, 0xda, 0x16, 0xc0, 0x5a, 0xc3, 0xe2, 0x01, 0x85, 0xe3, 0x7e, 0x2a, 0x59, 0x0b, 0xf9, 0xe5, 0x41, 0x4a, 0xc2, 0x5e, 0x9c, 0xf6, 0x8a, 0xf1, 0xf8, 0x8d, 0x15, 0xa8, 0x98, 0x10, 0x6b, 0x0b, 0x2d, 0x63, 0x92, 0x64, 0xb8, 0xf4, 0x42, 0xc9, 0x78, 0x6b, 0x1d, 0x40, 0x54, 0x7b, 0x96, 0x3d, 0x48, 0x11, 0xf3, 0x7e, 0x26, 0x63, 0x1e, 0x5d, 0xcd, 0xa3, 0x1b, 0xa6, 0xde, 0x9f, 0x1d, 0x75, 0xa6, 0xea, 0x05, 0xb2, 0x0a, 0x60, 0x9f, 0xc0, 0x2f, 0x77, 0x7b, 0xb4, 0xa1, 0x3d, 0x9a, 0x3d, 0xb7, 0xdb, 0xc7, 0x31, 0x00, 0x8b, 0x4b, 0xd3, 0xad, 0xe5, 0xbc, 0xa8, 0x2e, 0xfd, 0xb5, 0x33, 0xca, 0xc8, 0x60, 0xcb, 0x27, 0x29, 0xea, 0xd9, 0xb0, 0xa7, 0x32, 0xb9, 0xb8, 0xd3, 0x34, 0x13, 0xe3, 0xeb, 0x79, 0x62, 0xa4, 0x23, 0x93, 0x39, 0xc1, 0x49, 0xb4, 0x94, 0x24, 0x87, 0x0c, 0x60, 0xed, 0xc8, 0x28, 0x57, 0x3f, 0x95, 0x8b, 0x6f, 0x15, 0xad, 0x4f, 0x07, 0xcd, 0x93, 0x56, 0x00, 0x96, 0x00, 0x8e, 0xe4, 0x6f, 0x8d, 0x7b, 0x35, 0xea, 0xad, 0x7a, 0x4a, 0xa5, 0x6d, 0x93, 0xb4, 0xd2, 0x31, 0x44, 0xd9, 0xd6, 0x01, 0x52, 0x20, 0x10, 0xd7, 0xa9, 0x66, 0xa0, 0x50, 0x3e, 0xba, 0x45, 0x26, 0xa6, 0x2b, 0x05, 0xa1, 0xbb, 0x56, 0xee, 0xba, 0x37, 0x77, 0xad, 0x62, 0x04, 0x88, 0xbf, 0xe5, 0x8c, 0xcb, 0x61, 0x8c, 0x3e, 0xee, 0xa4, 0x91, 0x6e, 0x18, 0x92, 0xf2, 0x7a, 0x96, 0x7c, 0xf8, 0x84, 0x94, 0x03, 0x16, 0xee, 0x42, 0x3a, 0x9d, 0x7e, 0xd5, 0x3b, 0xa9, 0xaa, 0xa9, 0xb6, 0xfd, 0xe9, 0xd3, 0x6d, 0x75, 0xea, 0xe6, 0xc8, 0x97, 0xca, 0xac, 0x7d, 0x7f, 0x05, 0xe6, 0x5b, 0xb6, 0x15, 0x12, 0xd3, 0xa9, 0x51, 0x50, 0xb0, 0x69, 0x08, 0xb5, 0x12, 0x42, 0x8f, 0x5b, 0xcc, 0x43, 0xec, 0xd7, 0x68, 0xa3, 0x63, 0x3c, 0x78, 0x60, 0xcc, 0xce, 0xb4, 0x6c, 0x0d, 0x44, 0x93, 0x9f, 0x54, 0xee, 0x2a, 0x8b, 0xcc, 0xac, 0xd9, 0x76, 0xab, 0x6d, 0xe4, 0xde, 0x7f, 0xad, 0xcb, 0x00, 0xfd, 0x92, 0xbc, 0x80, 0x9f, 0x24, 0x6c, 0x25, 0x0d, 0x5a, 0x20, 0xd9, 0xf7, 0xe7, 0xe5, 0xe8, 0x6f, 0xe5, 0x22, 0xd7, 0xa8, 0x68, 0x09, 0xae, 0xdc, 0x54, 0xbb, 0x3e, 0x28, 0x48, 0x51, 0x54, 0x17, 0xa7, 0xf9, 0xea, 0xb0, 0x8d, 0x93, 0xbf, 0x5c, 0x95, 0x3b, 0xf1, 0x58, 0xb8, 0xd4, 0x96, 0x36, 0x2e, 0x20, 0x6d, 0xc8, 0xaf, 0x27, 0xc5, 0xe8, 0x6f, 0xdf, 0x57, 0x17, 0xf3, 0xc2, 0x0e, 0x89, 0xda, 0x82, 0xc4, 0x21, 0x49, 0xa8, 0x75, 0x7b, 0x1b, 0x96, 0x5f, 0xc7, 0x30, 0x9b, 0x30, 0xec, 0xc3, 0x72, 0x90, 0xd2, 0x04, 0x47, 0xbd, 0x59, 0x11, 0xee, 0x9e, 0x29, 0x65, 0xd0, 0xe2, 0x62, 0xfa, 0x60, 0x52, 0xdc, 0x84, 0x04, 0xe5, 0x61, 0xe9, 0x81, 0x0d, 0xb7, 0x4f, 0xf4, 0x1c, 0x55, 0x5b, 0xa3, 0x71, 0x09, 0x36, 0x90, 0x9d, 0x62, 0x99, 0xa8, 0x7a, 0x47, 0xc1, 0xf5, 0x90, 0x1c, 0x2d, 0x40, 0xfc, 0xb4, 0xa4, 0x08, 0x93, 0xca, 0x14, 0xd7, 0x22, 0x92, 0x43, 0x3c, 0x0a, 0xeb, 0x26, 0xc2, 0xaa, 0x30, 0x0f, 0xc9, 0x04, 0xc4, 0x85, 0x24, 0xd3, 0x90, 0x49, 0x90, 0x56, 0xef, 0xce, 0x93, 0x26, 0x37, 0x22, 0x59, 0x71, 0x69, 0xa6, 0xc9, 0x8c, 0x27, 0x71, 0x92, 0xad, 0x3e, 0x00, 0xae, 0x5c, 0xb4, 0xb5, 0x07, 0xdc, 0x1e, 0x37, 0x2d, 0x3b, 0x13, 0x6e, 0x6f, 0x6d, 0xb1, 0xbb, 0x24, 0x8d, 0x11, 0x69, 0x50, 0x49, 0xe3, 0x82, 0x15, 0x16, 0xea, 0x39, 0x95, 0x85, 0x77, 0xbf, 0x56, 0xb3, 0xf7, 0xa7, 0xa7, 0x3f, 0x02, 0x0f, 0x99, 0xcc, 0x49, 0xb4, 0x48, 0x90, 0x34, 0xf2, 0x54, 0xc8, 0xed, 0x70, 0xbb, 0x8e, 0x60, 0x5d, 0x48, 0x8f, 0x84, 0x93, 0xc5, 0x62, 0x74, 0xde, 0x6e, 0xed, 0xb4, 0xb8, 0xe1, 0x4a, 0xd2, 0xb2, 0x16, 0x93, 0x8b, 0x76, 0x47, 0x08, 0x92, 0xab, 0xf6, 0xde, 0xce, 0xf3, 0x3d, 0x6c, 0xae, 0xaa, 0x07, 0x2c, 0xa1, 0xd8, 0xc8, 0xba, 0x74, 0xab, 0x70, 0x82, 0x55, 0x38, 0x09, 0x94, 0xe9, 0x89, 0x5b, 0x7f, 0xcb, 0xc1, 0x12, 0xf0, 0x61, 0xa2, 0x2b, 0xaf, 0x18, 0x2e, 0x65, 0xe5, 0x61, 0x25, 0xb5, 0x8b, 0x98, 0x43, 0x01, 0xfc, 0x5c, 0x5a, 0x14, 0x2d, 0x78, 0x57, 0xf0, 0x48, 0xe1, 0xb2, 0xcb, 0x36, 0x02, 0x0c, 0x1d, 0x1d, 0x03, 0x79, 0xb0, 0x03, 0x0e, 0x39, 0xb7, 0x93, 0x6e, 0xad, 0xb3, 0xc9, 0x9c, 0x24, 0x23, 0x83, 0x15, 0x89, 0xd5, 0xa8, 0xc9, 0x04, 0x12, 0xf6, 0xdb, 0x2d, 0xc1, 0x69, 0xb8, 0xbe, 0x70, 0xff, 0xc2, 0x10, 0x7c, 0x04, 0x36, 0x84, 0xdb, 0xa2, 0x0c, 0x39, 0x11, 0x54, 0x30, 0xb1, 0x0c, 0x68, 0xda, 0x2c, 0x68, 0x3d, 0x84, 0xb7, 0x19, 0x28, 0x76, 0x08, 0x12, 0x19, 0x50, 0x01, 0x80, 0x0b, 0x5c, 0x48, 0x30, 0x59, 0x11, 0xd4, 0x4b, 0xe7, 0x5f, 0xdb, 0xd0, 0x97, 0xe4, 0x49, 0x32, 0x8d, 0xd0, 0xe5, 0x7c, 0x0f, 0x89, 0xf9, 0x31, 0x5d, 0x3d, 0x3d, 0xfd, 0xcd, 0x7d, 0x3d, 0x05, 0xad, 0xfa, 0xbe, 0xce, 0x2e, 0x4a, 0x62, 0x01, 0x9f, 0xd3, 0x5f, 0xcd, 0xf1, 0xc8, 0x2e, 0xe3, 0x1c, 0x4f, 0xd8, 0x44, 0xd1, 0x8a, 0xb9, 0xbd, 0x45, 0x07, 0x78, 0xf0, 0x26, 0xbc, 0x88, 0x09, 0xce, 0x3b, 0x62, 0xf0, 0xee, 0xb6, 0xce, 0x77, 0x7f, 0xfe, 0x75, 0x3c, 0x0c, 0xc5, 0xfa, 0x05, 0x27, 0x90, 0x54, 0xc9, 0xf3, 0x6a, 0xfc, 0x06, 0x77, 0x17, 0x5b, 0xbc, 0x00, 0x9d, 0x21, 0xec, 0x68, 0x71, 0x9c, 0xc2, 0xcd, 0x05, 0xcf, 0xff, 0x35, 0xfe, 0x02, 0xce, 0xe6, 0xb1, 0x0c, 0xd0, 0xee, 0x81, 0xe5, 0xc9, 0xaa, 0x5d, 0x1e, 0xe3, 0x10, 0x46, 0x22, 0xcf, 0x79, 0x2b, 0xb0, 0x57, 0x8a, 0x57, 0xb8, 0x4c, 0x96, 0x2b, 0xde, 0x25, 0x97, 0x3f, 0x4a, 0x15, 0x1e, 0x76, 0x17, 0x6e, 0xef, 0x4c, 0x07, 0xb8, 0x75, 0xd4, 0x53, 0x1d, 0x15, 0xba, 0x97, 0xe6, 0xc3, 0x69, 0xda, 0x9a, 0xf9, 0xf1, 0x50, 0xfb, 0x8a, 0xa7, 0xee, 0x5c, 0x76, 0x8d, 0x31, 0x44, 0xe6, 0x6c, 0xc0, 0x1c, 0x0d, 0xb0, 0xd5, 0xe1, 0x30, 0x5c, 0x94, 0x0c, 0x0c, 0xd7, 0x21, 0xb6, 0x65, 0x13, 0xb1, 0xb5, 0xd1, 0x4c, 0xe7, 0x60, 0x3d, 0x4b, 0x66, 0x41, 0x60, 0x49, 0x76, 0x1a, 0x5b, 0xb8, 0xbc, 0xf1, 0x36, 0x96, 0x5b, 0x2a, 0x1d, 0x37, 0x16, 0xbc, 0x0d, 0xee, 0x08, 0x68, 0x96, 0x15, 0x33, 0x56, 0xc4, 0xd6, 0xdd, 0xc5, 0x1b, 0x11, 0xe4, 0x7c, 0x72, 0x19, 0xe8, 0xa1, 0xbf, 0x04, 0xd3, 0x94, 0xc0, 0x35, 0x14, 0x0c, 0x92, 0x89, 0x83, 0xe6, 0x71, 0xa4, 0x5b, 0x76, 0x5c, 0xe5, 0x21, 0xb7, 0x63, 0xb3, 0xec, 0x93, 0xcd, 0x12, 0xf2, 0xd5, 0x82, 0xa7, 0x13, 0x30, 0xf3, 0x01, 0xbb, 0xeb, 0xe1, 0xa1, 0x18, 0xc7, 0x97, 0xc1, 0x28, 0xe3, 0x1c, 0x25, 0x96, 0x00, 0x20, 0x99, 0x0e, 0x49, 0x80, 0xf3, 0x88, 0x70, 0x7d, 0xfa, 0xc1, 0x4a, 0x7e, 0x54, 0xe2, 0x9f, 0x97, 0xe5, 0xf7, 0xc5, 0x1c, 0xf3, 0x57, 0x92, 0x35, 0x7d, 0x27, 0x8c, 0xff, 0x24, 0x9b, 0x8d, 0xf7, 0xc0, 0xcd, 0xae, 0xcc, 0x13, 0xe6, 0x37, 0x37, 0xab, 0xf5, 0xdb, 0x87, 0xf5, 0xac, 0x1e, 0xec, 0xd8, 0x53, 0x7a, 0x2f, 0x39, 0x08, 0xfb, 0x45, 0x71, 0x8e, 0x28, 0xbd, 0x32, 0x38, 0x8e, 0x8e, 0x3b, 0x59, 0x04, 0x24, 0x97, 0x30, 0xe1, 0x56, 0xba, 0x2b, 0x9f, 0x4e, 0x17, 0x78, 0x72, 0x21, 0x3d, 0x16, 0x0e, 0x71, 0xc1, 0x49, 0xef, 0x57, 0xa5, 0x70, 0x33, 0x92, 0x14, 0x20, 0x88, 0x0f, 0xd8, 0x72, 0x0e, 0x85, 0x1b, 0x91, 0x67, 0x4b, 0x37, 0xec, 0x32, 0x5d, 0x43, 0xb7, 0x70, 0xc8, 0xc5, 0xb7, 0xc7, 0x5a, 0x17, 0x65, 0x3e, 0x1a, 0x5d, 0x52, 0x2e, 0x1e, 0x3a, 0x80, 0xa5, 0xbf, 0x88, 0xda, 0x0e, 0xf6, 0x62, 0x7c, 0xe8, 0x97, 0x9e, 0x0c, 0x69, 0x4d, 0xdd, 0x3d, 0xb8, 0x6b, 0x0c, 0x3d, 0xb3, 0xd6, 0x89, 0x28, 0x51, 0x25, 0x46, 0x1c, 0x8d, 0x3b, 0xc0, 0x54, 0xd1, 0x3a, 0xef, 0x78, 0x59, 0x00, 0xf2, 0x36, 0xc3, 0x6e, 0x03, 0x44, 0xc4, 0x9d, 0x7a, 0x11, 0xf0, 0x14, 0x04, 0x75, 0x0e, 0x17, 0x82, 0xc5, 0x36, 0x9b, 0x81, 0x6e, 0xbf, 0x2d, 0x46, 0xe7, 0xa0, 0x74, 0x8e, 0x40, 0x57, 0xc8, 0xdf, 0x90, 0xee, 0x19, 0x11, 0x4c, 0xb2, 0x1b, 0x13, 0x9b, 0x54, 0xd0, 0x5c, 0xf4, 0xea, 0xc0, 0x41, 0x0a, 0xcd, 0x72, 0x53, 0xdd, 0x39, 0x4c, 0xb1, 0xfb, 0x0b, 0xd4, 0xe5, 0xe3, 0xfa, 0x1c, 0x3d, 0xff, 0xa6, 0xcb, 0x21, 0x74, 0x02, 0xbd, 0x04, 0x4e, 0xd1, 0x9e, 0x10, 0xcd, 0x77, 0x97, 0x93, 0xa5, 0x1b, 0xea, 0x25, 0xd0, 0x81, 0x0f, 0xd1, 0x09, 0x36, 0x9c, 0xc6, 0x2f, 0x90, 0x7c, 0xf9, 0xe0, 0xe9, 0x64, 0x63, 0x3e, 0xa7, 0xc0, 0x75, 0x78, 0xd4, 0x8a, 0x90, 0xc4, 0x56, 0xd7, 0x23, 0xac, 0xad, 0x94, 0x12, 0x8a, 0x80, 0xe8, 0x3e, 0xd1, 0xc2, 0xc5, 0xce, 0x53, 0xdc, 0x3e, 0x28, 0xc5, 0x2d, 0x50, 0x86, 0xfa, 0x2f, 0x48, 0x42, 0x4b, 0xc8, 0x49, 0xfd, 0x6f, 0x18, 0x94, 0x27, 0xca, 0x29, 0x85, 0xa9, 0xff, 0xf2, 0xe5, 0x03, 0x14, 0x3a, 0x12, 0x6a, 0xfa, 0x2f, 0xbf, 0x0e, 0x01, 0x8e, 0x32, 0xd3, 0x7f, 0x29, 0xa5, 0xc7, 0x24, 0xb1, 0xfe, 0xcb, 0xdf, 0x87, 0x20, 0x4f, 0x65, 0xea, 0xbf, 0x14, 0x01, 0x88, 0x84, 0x28, 0xd6, 0xff, 0x6a, 0xff, 0x7e, 0x22, 0x20, 0xc8, 0x69, 0xfd, 0xaf, 0xa2, 0x0a, 0x12, 0xa1, 0x89, 0xaf, 0xff, 0x69, 0x84, 0x26, 0x1a, 0xe2, 0x44, 0xc4, 0x16, 0x74, 0x11, 0x8f, 0xb8, 0xe5, 0x7e, 0x52, 0xce, 0x07, 0x6b, 0xa0, 0x1c, 0x09, 0xef, 0x48, 0x24, 0xb7, 0xc9, 0x4a, 0x91, 0x55, 0xb7, 0x64, 0x30, 0x96, 0x31, 0x0e, 0x11, 0xd2, 0x76, 0x21, 0x74, 0x83, 0x05, 0x0d, 0x9a, 0x16, 0x9a, 0x3c, 0xef, 0x2d, 0xd7, 0x73, 0x99, 0xec, 0x8f, 0xd5, 0x7a, 0x74, 0xfe, 0xf4, 0xe9, 0xde, 0x8a, 0xff, 0x7b, 0xbd, 0x55, 0xb9, 0x04, 0x26, 0x22, 0x6c, 0x45, 0x20, 0xb0, 0xe7, 0xc3, 0x36, 0x3b, 0xf1, 0x06, 0xb0, 0xbb, 0xc3, 0xc2, 0xc9, 0x1b, 0x04, 0x70, 0x72, 0xbb, 0x69, 0x8a, 0xdd, 0x34, 0x05, 0xc2, 0x3c, 0x3a, 0x07, 0x35, 0x1f, 0xdc, 0x4a, 0x16, 0x11, 0xee, 0x6f, 0x53, 0xb7, 0xb3, 0xd6, 0x83, 0x35, 0xa9, 0xc3, 0x49, 0xa2, 0xa3, 0xa9, 0xee, 0xb2, 0xd3, 0xe1, 0x9a, 0x84, 0x42, 0x50, 0x06, 0xc7, 0x0e, 0x73, 0xbf, 0xc4, 0x4a, 0x14, 0xc9, 0x89, 0x49, 0x67, 0x60, 0x44, 0xa5, 0xa3, 0xcb, 0xee, 0x19, 0x40, 0x01, 0x9a, 0x72, 0xd1, 0xbe, 0x31, 0x8e, 0x0f, 0xfb, 0xdd, 0x07, 0xa5, 0x0a, 0x38, 0x81, 0x9c, 0x24, 0x52, 0xd5, 0x06, 0x64, 0x04, 0x11, 0x8f, 0x0a, 0x1d, 0xb4, 0x61, 0x92, 0x71, 0x41, 0x3f, 0x2f, 0x2a, 0xcc, 0x66, 0xbd, 0x9f, 0xae, 0x43, 0xd7, 0xe8, 0xd0, 0xf5, 0xab, 0x22, 0x81, 0xf4, 0xd6, 0x1d, 0xc0, 0xef, 0xcd, 0xe0, 0x1a, 0x5d, 0xda, 0x0c, 0x41, 0x30, 0x42, 0x19, 0x10, 0x10, 0x1b, 0xa6, 0x29, 0x8f, 0xae, 0x21, 0x54, 0x11, 0x1a, 0x07, 0x1e, 0xfb, 0xb6, 0xe8, 0x77, 0xcb, 0x37, 0xb8, 0x4b, 0x0d, 0x36, 0xc3, 0x0d, 0x4e, 0xdc, 0xcc, 0x08, 0xef, 0x9e, 0xbf, 0xfa, 0x9a, 0xbc, 0x22, 0xca, 0x4c, 0xa0, 0x91, 0x8e, 0x2d, 0xc4, 0x0b, 0xc6, 0x93, 0x8d, 0x0e, 0xea, 0x49, 0x18, 0x30, 0x70, 0x62, 0xfd, 0x80, 0x9d, 0xa0, 0xc0, 0x13, 0x21, 0x34, 0x36, 0x47, 0x8a, 0x67, 0xb4, 0x0e, 0x67, 0xd9, 0x3d, 0xe1, 0xb0, 0xb9, 0x6e, 0x5f, 0xa1, 0xdb, 0x57, 0xaf, 0xfc, 0xc4, 0x5d, 0xb9, 0x89, 0x7b, 0x3b, 0x5c, 0x1e, 0x5d, 0x1d, 0x93, 0x4a, 0xca, 0x25, 0xf4, 0x01, 0x7f, 0x07, 0xc7, 0x83, 0x0f, 0xbd, 0x5f, 0xd7, 0xf3, 0x31, 0xda, 0x9b, 0xac, 0xb4, 0x49, 0xb7, 0xea, 0x74, 0x3f, 0xf0, 0x76, 0xf3, 0x11, 0x9b, 0x86, 0x6f, 0xe0, 0xc3, 0xf8, 0xd5, 0x5c, 0x71, 0x35, 0xbb, 0xda, 0x4a, 0xd4, 0x56, 0xe6, 0x07, 0x79, 0x50, 0xba, 0xaa, 0x67, 0x83, 0x59, 0x7d, 0x74, 0x4b, 0x5d, 0x31, 0x90, 0x3a, 0x19, 0x2c, 0x40, 0xdf, 0xc1, 0x15, 0x03, 0xb4, 0x67, 0x43, 0x14, 0xf0, 0x4a, 0xcc, 0xa1, 0x7b, 0xa3, 0x3c, 0x69, 0xc0, 0xe1, 0x88, 0x53, 0xbd, 0x80, 0x10, 0x4f, 0x68, 0xcb, 0x32, 0x11, 0x65, 0xe1, 0xa1, 0x89, 0xad, 0xa3, 0x03, 0xed, 0x70, 0x85, 0x16, 0x2e, 0x30, 0xad, 0xce, 0xa1, 0x90, 0x40, 0xfb, 0x53, 0x43, 0x50, 0xfc, 0xaa, 0x9f, 0x10, 0xdd, 0x2b, 0x1a, 0xe8, 0xde, 0xa2, 0x0d, 0xb2, 0x2a, 0xce, 0xa4, 0x26, 0x66, 0x54, 0x8f, 0x49, 0xd1, 0x20, 0x5f, 0x6e, 0xc5, 0x72, 0x4f, 0xa4, 0x9c, 0xaa, 0x7b, 0x72, 0x54, 0x01, 0x03, 0xee, 0x4d, 0x96, 0xef, 0xde, 0x7f, 0x38, 0xbc, 0x99, 0x03, 0x56, 0x4c, 0x2e, 0xcb, 0xfe, 0x93, 0x83, 0x3b, 0x23, 0x66, 0x29, 0xeb, 0xc0, 0xa8, 0xff, 0x8e, 0xa2, 0x6f, 0x64, 0x7f, 0x81, 0x6a, 0x81, 0xde, 0x5f, 0xe3, 0x18, 0x18, 0xd9, 0xbf, 0x4e, 0x0a, 0x37, 0xd2, 0xbf, 0x87, 0xaf, 0xef, 0xe5, 0x52, 0xd2, 0x20, 0xfe, 0x47, 0xe3, 0xfa, 0x47, 0x0e, 0x17, 0xb3, 0x26, 0x0c, 0x80, 0x3a, 0x77, 0xe0, 0x12, 0x17, 0x1a, 0xec, 0xee, 0xa3, 0x96, 0x63, 0xd4, 0x62, 0xe1, 0xf3, 0x2c, 0xd2, 0xb7, 0x1f, 0x49, 0x7a, 0xf5, 0x6f, 0x3f, 0xcf, 0xf1, 0xac, 0x8b, 0xcb, 0x76, 0xad, 0x1c, 0x52, 0x1c, 0x7d, 0xf7, 0x7e, 0x0c, 0x96, 0x01, 0x6e, 0x1e, 0xc9, 0xca, 0x20, 0x4c, 0x73, 0x83, 0x08, 0x06, 0xc2, 0x36, 0x51, 0x2f, 0x13, 0x3f, 0x8c, 0xb7, 0x68, 0x10, 0x7c, 0x49, 0xa8, 0xf6, 0x41, 0xd8, 0xc2, 0x8e, 0xf7, 0x28, 0x04, 0x87, 0xe8, 0xbc, 0x58, 0x80, 0xb2, 0x78, 0x43, 0x82, 0x94, 0xb1, 0x8e, 0xaf, 0x71, 0x13, 0x95, 0xa7, 0x72, 0x7c, 0x56, 0xea, 0xa3, 0xf1, 0x01, 0xac, 0x32, 0x39, 0xb6, 0xe3, 0x80, 0x77, 0x3c, 0xa8, 0x2d, 0x48, 0xa4, 0x2e, 0x74, 0x1f, 0xa5, 0x61, 0x94, 0xc4, 0x08, 0x19, 0x71, 0x7a, 0x2b, 0x3f, 0x7f, 0x88, 0xf5, 0x00, 0x61, 0x0a, 0x30, 0x46, 0xf7, 0xc1, 0x04, 0x05, 0x5b, 0xd0, 0x84, 0x2a, 0x42, 0x80, 0x87, 0x18, 0xf2, 0x62, 0x52, 0x26, 0x5f, 0x9e, 0x39, 0x92, 0x25, 0xf8, 0x92, 0xec, 0x31, 0x8b, 0xbe, 0x96, 0xbf, 0x7b, 0xc9, 0x87, 0x4b, 0x3e, 0x29, 0x23, 0xb8, 0x59, 0x62, 0x2e, 0x49, 0xb3, 0x0e, 0x8e, 0x97, 0x6c, 0xc4, 0x68, 0xaa, 0x18, 0x66, 0xeb, 0x86, 0x8b, 0x50, 0xef, 0x25, 0x8a, 0x49, 0xd5, 0xe7, 0xf9, 0x57, 0x8c, 0x4f, 0x04, 0xcf, 0xd2, 0xf9, 0x56, 0x66, 0x68, 0x1c, 0x16, 0x43, 0x71, 0x9c, 0x38, 0x49, 0xe8, 0xbf, 0x17, 0x4b, 0xae, 0x6a, 0x12, 0xb4, 0xad, 0xec, 0xe8, 0x1e, 0x10, 0x02, 0xf5, 0x26, 0x50, 0xcf, 0xcc, 0x45, 0x39, 0x9c, 0x79, 0xb0, 0x26, 0xfc, 0x1b, 0xbd, 0xb9, 0xd4, 0xe0, 0x65, 0xe0, 0xb5, 0xe4, 0xf8, 0x2b, 0xd1, 0x5e, 0xbb, 0x07, 0x31, 0xef, 0x25, 0x5b, 0x4d, 0xe2, 0x05, 0x1e, 0x59, 0xe5, 0x1c, 0x3e, 0x40, 0x54, 0x2b, 0x0b, 0x30, 0x55, 0x61, 0xab, 0xc9, 0xfd, 0xe8, 0x40, 0x81, 0x95, 0xe4, 0x06, 0x83, 0xb0, 0x13, 0x02, 0x00, 0x31, 0xe0, 0xd5, 0x9b, 0x5a, 0x9d, 0xf3, 0x8d, 0xb5, 0xd4, 0x68, 0x54, 0x2a, 0x3f, 0xc1, 0xfb, 0x12, 0x44, 0x04, 0x9b, 0x63, 0x6d, 0x34, 0xf7, 0xb0, 0x87, 0xec, 0xdc, 0x78, 0xd5, 0x6e, 0x61, 0xdf, 0x11, 0xa2, 0x0a, 0x51, 0x55, 0x68, 0xc5, 0x87, 0x2f, 0xfa, 0x07, 0xa4, 0xa8, 0xec, 0x1e, 0x20, 0xa8, 0x36, 0x7a, 0xc9, 0xa5, 0xb0, 0x7e, 0x4e, 0xc7, 0x7c, 0xac, 0x11, 0x6e, 0x28, 0xf3, 0x8d, 0x91, 0x43, 0x92, 0xfd, 0x5f, 0x87, 0x19, 0x8e, 0xd3, 0xe7, 0x00, 0x86, 0x9f, 0x43, 0x2d, 0x75, 0x57, 0x59, 0x3d, 0xe1, 0x2a, 0xeb, 0xc6, 0xc7, 0x46, 0x35, 0x5d, 0xc4, 0x38, 0xab, 0x6b, 0x42, 0x0c, 0x01, 0x5c, 0x36, 0xe8, 0x65, 0xba, 0x45, 0x27, 0x17, 0x6b, 0x88, 0x5a, 0x21, 0x18, 0x5d, 0xce, 0x4c, 0x2e, 0x30, 0x41, 0x70, 0xd7, 0x4b, 0xdb, 0xc5, 0x9a, 0x22, 0xc8, 0xe0, 0x25, 0xa0, 0xaa, 0xa3, 0x84, 0x26, 0xb0, 0xa5, 0x93, 0x44, 0x26, 0xb6, 0xe4, 0xc8, 0x11, 0x01, 0x1c, 0x59, 0x84, 0x12, 0x6a, 0xea, 0xe9, 0x37, 0xdb, 0xd2, 0x6f, 0x1a, 0xe9, 0x9d, 0x38, 0x53, 0x26, 0x87, 0x8b, 0xda, 0x96, 0x27, 0x57, 0x8b, 0x8b, 0x02, 0xea, 0x6b, 0x72, 0xb9, 0xfe, 0x36, 0xd7, 0x5c, 0x58, 0xc0, 0xee, 0x72, 0x7b, 0x98, 0x97, 0xd1, 0xfa, 0x30, 0x78, 0xa9, 0xab, 0x3a, 0x68, 0xf4, 0x31, 0x64, 0xd5, 0xe7, 0x9b, 0xb9, 0x35, 0x8f, 0x09, 0x2d, 0xd5, 0x41, 0xc8, 0xa8, 0x77, 0xbe, 0x99, 0x57, 0xab, 0x76, 0xd5, 0x5d, 0x76, 0x5e, 0x63, 0x3d, 0x84, 0x55, 0xf0, 0xb1, 0x9a, 0x62, 0x19, 0xe1, 0xc2, 0xa1, 0x93, 0x45, 0xb8, 0x6a, 0xfb, 0xb4, 0x4c, 0x77, 0xa4, 0x63, 0xe2, 0xd8, 0x42, 0x90, 0x40, 0xae, 0x06, 0x27, 0xbc, 0x17, 0x6f, 0x66, 0x88, 0xef, 0x5c, 0xf7, 0xab, 0xee, 0x78, 0xd3, 0x5f, 0x76, 0xc7, 0x6b, 0xd2, 0x53, 0xb0, 0x82, 0x20, 0xab, 0xd3, 0x58, 0xb3, 0xd1, 0x4e, 0xfd, 0xae, 0xc4, 0xd1, 0x5b, 0xb2, 0x49, 0x5a, 0x55, 0xb2, 0x89, 0xef, 0x06, 0x93, 0xdb, 0xdb, 0xb0, 0xee, 0xe4, 0x04, 0xb0, 0xc5, 0x17, 0x1f, 0x0a, 0xf5, 0x03, 0xae, 0x76, 0x64, 0x05, 0x34, 0x4f, 0x38, 0xb5, 0xd0, 0x9f, 0xe8, 0xa2, 0x58, 0x2d, 0xa6, 0x46, 0x63, 0xb1, 0x6d, 0xc4, 0xe6, 0xb4, 0x91, 0x2c, 0x3f, 0xa7, 0xba, 0xa9, 0xe3, 0x9d, 0xb0, 0xbd, 0xea, 0x3a, 0x93, 0x47, 0x8a, 0x4e, 0x98, 0x1a, 0x2b, 0xcc, 0x92, 0xde, 0x32, 0x3d, 0xc2, 0xad, 0x23, 0xe1, 0xf6, 0x13, 0x71, 0xe7, 0x68, 0x93, 0xfb, 0x03, 0x25, 0x19, 0xfa, 0xc6, 0xe1, 0xd4, 0x04, 0xa4, 0x5d, 0xb0, 0x5c, 0x48, 0x1c, 0x76, 0x83, 0x71, 0x22, 0x23, 0xbf, 0x6b, 0xf0, 0x45, 0x87, 0xc6, 0x01, 0x25, 0xb0, 0xea, 0x67, 0xab, 0x3f, 0x22, 0x19, 0x9b, 0x7b, 0x7b, 0x5b, 0x83, 0x45, 0xf7, 0xa4, 0xc5, 0x81, 0x94, 0x85, 0x3c, 0x3f, 0xcf, 0x33, 0x1c, 0x98, 0x08, 0x4c, 0xd4, 0x57, 0x18, 0xe4, 0x72, 0xad, 0xd2, 0xbd, 0x11, 0x97, 0xe9, 0xf4, 0x5f, 0xf6, 0x40, 0x0c, 0x89, 0x2e, 0x5d, 0x87, 0x2d, 0x0d, 0x6f, 0x41, 0xe7, 0x06, 0x68, 0x5f, 0x74, 0xcc, 0x24, 0xcb, 0x77, 0xb2, 0xe5, 0xd4, 0x49, 0xcf, 0xeb, 0xec, 0xb9, 0x63, 0xb8, 0x4b, 0x04, 0x18, 0x15, 0x42, 0x63, 0xa2, 0x9c, 0xfc, 0x44, 0xfe, 0x20, 0x4f, 0x30, 0xce, 0x8c, 0x64, 0x3d, 0x4a, 0x48, 0x57, 0x40, 0x72, 0xa0, 0x43, 0xd4, 0xd1, 0x33, 0x87, 0xc3, 0x5c, 0xe7, 0x16, 0x6b, 0x6d, 0x56, 0x48, 0xa7, 0xc8, 0x5f, 0x60, 0x92, 0xfe, 0x08, 0xdd, 0xb0, 0x8e, 0x44, 0xd4, 0x78, 0x81, 0x2a, 0x52, 0x5c, 0x97, 0x15, 0xa8, 0xb1, 0x56, 0xa2, 0xd6, 0x28, 0x83, 0xc4, 0x1d, 0x6d, 0x72, 0x7c, 0x3a, 0x24, 0x36, 0xe1, 0x16, 0x06, 0x3c, 0xe6, 0x11, 0x85, 0x36, 0x25, 0xde, 0x12, 0xdc, 0xdc, 0x11, 0xf0, 0x11, 0x9e, 0x39, 0x16, 0x5d, 0x77, 0xe3, 0x02, 0x01, 0x8d, 0xe3, 0x5c, 0xb2, 0xf2, 0xb9, 0x90, 0x73, 0x99, 0x93, 0x84, 0x90, 0x25, 0x69, 0xf4, 0x2f, 0x97, 0x2b, 0x3d, 0xd1, 0xb7, 0x5c, 0x00, 0xb2, 0xe8, 0x5c, 0x52, 0x74, 0x38, 0x8a, 0x02, 0xe2, 0xd8, 0x90, 0x2c, 0x88, 0x77, 0x4b, 0x8e, 0x5f, 0xac, 0x34, 0x06, 0x7f, 0xae, 0x05, 0xf4, 0x10, 0xfc, 0xe3, 0x79, 0x49, 0x75, 0xa7, 0x46, 0xcc, 0xe1, 0x7e, 0x02, 0x78, 0x88, 0x1e, 0x39, 0x44, 0x27, 0x26, 0x18, 0xbd, 0xe3, 0xcd, 0xb9, 0xb6, 0xa4, 0x13, 0x64, 0x21, 0x2b, 0x92, 0xd3, 0x50, 0x2d, 0x78, 0x91, 0x55, 0x2d, 0x78, 0x71, 0x7c, 0x18, 0xbf, 0xf4, 0x41, 0x05, 0xd9, 0x6b, 0x13, 0xaf, 0xb9, 0x55, 0xc1, 0x96, 0x3a, 0x18, 0x70, 0x64, 0xab, 0xb8, 0x6d, 0x14, 0x4c, 0xdc, 0x02, 0x53, 0x1c, 0x0d, 0x9a, 0xb4, 0x55, 0x2c, 0x07, 0x4b, 0xd8, 0xc0, 0x07, 0xeb, 0x57, 0x2d, 0x30, 0x6f, 0x87, 0xb8, 0x88, 0xe3, 0x98, 0x77, 0xeb, 0x42, 0x3b, 0xbc, 0x6b, 0x49, 0x76, 0xb7, 0xe2, 0xba, 0x22, 0xcf, 0x1a, 0x90, 0xdc, 0x31, 0x20, 0x4d, 0x0d, 0x3e, 0x6d, 0x5b, 0xb9, 0x1e, 0xfc, 0xa3, 0x6e, 0x6c, 0xe7, 0xba, 0x24, 0x47, 0x04, 0x62, 0xb6, 0x2a, 0xd9, 0xe4, 0x46, 0x40, 0xb8, 0xdc, 0x94, 0xc3, 0x75, 0x3d, 0xd1, 0xa2, 0x5c, 0x4f, 0xb2, 0x9d, 0x48, 0x5a, 0x1c, 0x84, 0xbf, 0xb6, 0xb5, 0xd8, 0xb1, 0x52, 0x66, 0x64, 0x12, 0xd5, 0x07, 0xb8, 0x11, 0x17, 0xdd, 0x5e, 0xb7, 0x44, 0x8a, 0x42, 0x41, 0x14, 0x55, 0x5b, 0x7b, 0x19, 0x72, 0x52, 0x46, 0x73, 0x29, 0xbd, 0xb9, 0x79, 0x56, 0x6c, 0x7a, 0x6d, 0xa3, 0x4c, 0x04, 0xb8, 0x27, 0x10, 0x19, 0xdc, 0x1f, 0x6c, 0x5e, 0x9d, 0x39, 0xaa, 0xd2, 0xc6, 0x51, 0x95, 0xae, 0x87, 0x67, 0x47, 0x1b, 0x90, 0x91, 0x40, 0x8a, 0x03, 0xdb, 0xf3, 0x5a, 0x89, 0x28, 0x27, 0xbc, 0x1c, 0x5e, 0x0d, 0xe7, 0xbd, 0xb9, 0x16, 0x45, 0x2a, 0xfb, 0x60, 0xdd, 0x8b, 0xe9, 0x86, 0x87, 0xed, 0x93, 0xa3, 0x2b, 0xe9, 0x0c, 0x74, 0x95, 0xe2, 0xdb, 0x15, 0xe8, 0x34, 0x57, 0x3d, 0x8e, 0x7f, 0x14, 0xce, 0x63, 0x54, 0xc2, 0xd7, 0x60, 0x67, 0xfa, 0xd0, 0x9f, 0xe7, 0x12, 0xa6, 0x87, 0x5e, 0x12, 0x0e, 0x29, 0xd9, 0x13, 0x94, 0x81, 0xed, 0xce, 0x0a, 0xea, 0xe5, 0x6b, 0x0c, 0xab, 0xa8, 0xd7, 0xa0, 0x31, 0xeb, 0x79, 0x5a, 0x47, 0x4f, 0x08, 0xb9, 0x7a, 0xcb, 0xaa, 0x17, 0x25, 0x51, 0xd9, 0xa2, 0x24, 0x86, 0xe7, 0x5a, 0xa6, 0x2c, 0x6d, 0x72, 0xd2, 0x62, 0x44, 0x9d, 0x4c, 0xd7, 0x8b, 0x61, 0x05, 0x38, 0x4b, 0x99, 0x98, 0xec, 0x6e, 0xca, 0x8a, 0x25, 0x47, 0xb2, 0xc8, 0xa4, 0xbe, 0x59, 0x0e, 0x91, 0x4b, 0xf6, 0x8b, 0x4c, 0x04, 0x93, 0xe3, 0x35, 0x4b, 0x69, 0x58, 0x65, 0x81, 0x10, 0xb5, 0x36, 0x66, 0x88, 0x62, 0x49, 0xa0, 0x80, 0xc9, 0xbc, 0x80, 0xa3, 0x5a, 0xdb, 0xee, 0x20, 0x8a, 0xc6, 0x5b, 0x10, 0x6a, 0x2a, 0xc2, 0x39, 0xad, 0x1d, 0xf9, 0xfb, 0x64, 0x83, 0xd6, 0x2e, 0x9e, 0x80, 0x96, 0xe1, 0xa6, 0x94, 0x68, 0x52, 0x44, 0x65, 0xba, 0xbb, 0xa1, 0x4f, 0x16, 0x6e, 0x53, 0x49, 0x96, 0x46, 0xba, 0x08, 0xd7, 0xac, 0x25, 0x54, 0xfd, 0x1b, 0x3d, 0x33, 0x2a, 0x7b, 0x53, 0xcd, 0x1c, 0xb4, 0x3f, 0xaa, 0x20, 0x52, 0xbd, 0xb0, 0x44, 0xba, 0x6b, 0x98, 0x0c, 0x8c, 0xc9, 0x8a, 0x18, 0x6e, 0x9d, 0x13, 0x50, 0x75, 0x04, 0x0d, 0xcd, 0x11, 0x29, 0x46, 0x2e, 0xf0, 0xad, 0x62, 0xb1, 0x5a, 0xa6, 0x2d, 0x7f, 0x5c, 0xce, 0x29, 0x99, 0x5d, 0x38, 0x8e, 0x93, 0x4c, 0x37, 0xc8, 0xa2, 0x98, 0x63, 0x65, 0x36, 0xb6, 0x70, 0x35, 0xa9, 0x45, 0x1b, 0x44, 0x4a, 0x52, 0x5c, 0x64, 0x2f, 0x2f, 0xc3, 0x03, 0x44, 0x8c, 0xab, 0xf7, 0xb3, 0x77, 0x31, 0x39, 0x6f, 0x82, 0x40, 0x34, 0xe4, 0x5b, 0x48, 0xaa, 0x55, 0x78, 0x74, 0xbc, 0xae, 0x53, 0x49, 0x3b, 0x32, 0xb1, 0xd1, 0x13, 0x54, 0xaa, 0x89, 0x92, 0xbc, 0x1c, 0x37, 0xc7, 0xc6, 0xba, 0x30, 0x75, 0xd9, 0x06, 0x37, 0x0a, 0xec, 0x9f, 0x88, 0x0b, 0x95, 0x65, 0x4d, 0x65, 0x39, 0x51, 0x11, 0x59, 0xb4, 0xff, 0x32, 0x12, 0x3f, 0xcf, 0x31, 0x9e, 0x9a, 0x84, 0xd2, 0xfe, 0x57, 0x5f, 0x83, 0xbf, 0xf4, 0xcd, 0x67, 0xf1, 0x97, 0x12, 0x3c, 0xbb, 0x86, 0xc0, 0xa8, 0x3c, 0x31, 0x48, 0xeb, 0x42, 0x70, 0x87, 0xca, 0x99, 0x43, 0x56, 0xba, 0x82, 0xac, 0x2c, 0xa0, 0xcd, 0x6d, 0xa8, 0x8c, 0x9e, 0x14, 0x14, 0xcb, 0x8d, 0xb0, 0x92, 0x65, 0x24, 0x7c, 0xde, 0xdb, 0x8b, 0x06, 0xd1, 0x4b, 0x9f, 0x87, 0x50, 0xc9, 0x21, 0x32, 0xe8, 0x37, 0x2c, 0xea, 0x27, 0x6b, 0x07, 0x0e, 0x43, 0x91, 0xca, 0xeb, 0x83, 0x46, 0x19, 0x64, 0x4c, 0x44, 0x1d, 0x1c, 0x0c, 0xee, 0x78, 0xc1, 0x24, 0x34, 0x90, 0xc7, 0x00, 0x06, 0x19, 0x52, 0x6c, 0xea, 0x14, 0xdb, 0xda, 0x07, 0x2d, 0x9d, 0x63, 0x62, 0xb2, 0xbe, 0x5c, 0x99, 0xd9, 0x8a, 0xf4, 0x82, 0xf3, 0x40, 0x3d, 0xc2, 0xf9, 0x46, 0x71, 0x0e, 0xb4, 0xd8, 0xed, 0x52, 0xc6, 0x08, 0x1a, 0x76, 0x50, 0xbf, 0xad, 0x41, 0x06, 0xe3, 0xcf, 0x02, 0xdb, 0xde, 0x52, 0xad, 0x60, 0xf0, 0x09, 0x2e, 0x47, 0x0d, 0xe6, 0xa8, 0x67, 0xbe, 0x2a, 0x11, 0xd3, 0x47, 0x31, 0x75, 0x55, 0xd7, 0xfa, 0x90, 0xf7, 0xb9, 0x68, 0xd3, 0xd9, 0xe9, 0x73, 0x15, 0xfd, 0xfe, 0x81, 0x55, 0x64, 0x44, 0x3e, 0x92, 0xe5, 0x4d, 0xf8, 0xdf, 0x4d, 0xb4, 0x63, 0x0e, 0x6c, 0x9f, 0xe2, 0x34, 0xdc, 0x34, 0x03, 0x94, 0xd3, 0x50, 0x5f, 0x27, 0xca, 0x70, 0xc8, 0x28, 0x0c, 0x4c, 0x87, 0x37, 0x16, 0x06, 0xeb, 0x00, 0x26, 0x8b, 0x0b, 0xee, 0x45, 0x57, 0x8e, 0xac, 0xef, 0x54, 0x19, 0x52, 0x29, 0xe6, 0xca, 0x9d, 0xd6, 0xe7, 0xe5, 0xac, 0x98, 0xeb, 0xd3, 0x02, 0x28, 0x22, 0x7b, 0xa2, 0x6f, 0x26, 0x1a, 0x6d, 0xc4, 0xf6, 0xf5, 0xaa, 0xfa, 0x30, 0x5a, 0x54, 0xd3, 0xa9, 0x65, 0xe2, 0x52, 0xf8, 0x96, 0x14, 0xf8, 0x16, 0xf5, 0x01, 0xa1, 0x05, 0xf4, 0x37, 0xff, 0x06, 0x62, 0xb2, 0xb2, 0xb7, 0xfb, 0x79, 0x2a, 0xe8, 0x2c, 0xc8, 0x55, 0x2e, 0x8a, 0x33, 0x2f, 0x83, 0xe0, 0xa4, 0x87, 0x0f, 0x95, 0xc6, 0xdf, 0x62, 0x24, 0xc8, 0x0e, 0x52, 0xaa, 0x57, 0x23, 0x83, 0x3d, 0x01, 0xab, 0xea, 0x70, 0xa1, 0x70, 0x5c, 0xaa, 0x0d, 0xc1, 0x77, 0x76, 0x85, 0xc2, 0x06, 0xfc, 0x7e, 0xbd, 0x58, 0x56, 0x51, 0x23, 0x22, 0x2c, 0x1f, 0x4b, 0x0e, 0xdb, 0x25, 0x05, 0xa0, 0xb9, 0x9b, 0xfd, 0x23, 0x16, 0xb3, 0xb6, 0x53, 0x38, 0x59, 0x09, 0xa4, 0x88, 0x58, 0x1f, 0x2e, 0x98, 0x7d, 0x19, 0xb4, 0xae, 0x99, 0x78, 0x46, 0xc5, 0x9e, 0x06, 0xd5, 0x2e, 0xa7, 0x90, 0x48, 0xf9, 0xa2, 0x26, 0xe5, 0x2d, 0xaf, 0x6a, 0x18, 0x8e, 0x1a, 0xd5, 0x16, 0x94, 0x12, 0x54, 0xfd, 0x4f, 0x35, 0xd8, 0x4e, 0xe4, 0x2c, 0x6c, 0x24, 0xb9, 0xbc, 0xe6, 0xa6, 0x48, 0xc2, 0xad, 0xc8, 0xfb, 0x33, 0x5b, 0xa2, 0xed, 0xd9, 0x2f, 0x81, 0x13, 0x66, 0x1b, 0xc5, 0x88, 0x4e, 0xbf, 0xb5, 0x91, 0xb1, 0x10, 0x14, 0xa1, 0x41, 0xf2, 0xcc, 0xa9, 0x6f, 0xe6, 0x06, 0xa3, 0x9e, 0xd2, 0x13, 0x04, 0xbf, 0x74, 0x30, 0xa0, 0x42, 0xfa, 0x5b, 0x06, 0x63, 0x6b, 0xf6, 0x4b, 0x30, 0xba, 0xf3, 0x83, 0x81, 0x08, 0x30, 0x4b, 0x45, 0xe2, 0x2d, 0x5a, 0x90, 0xc2, 0x87, 0x78, 0xbc, 0x9a, 0x99, 0x5f, 0x8c, 0xb2, 0x74, 0x95, 0x87, 0xcd, 0xcb, 0x9e, 0xdf, 0x75, 0xb9, 0x75, 0xb8, 0xe0, 0x3a, 0x54, 0xed, 0x5a, 0xe8, 0x5c, 0x67, 0x17, 0x9f, 0xa9, 0xd6, 0xa6, 0xd1, 0xd1, 0x8a, 0x83, 0x56, 0x99, 0x9f, 0x4a, 0x31, 0x92, 0x60, 0xca, 0xbb, 0x99, 0xf2, 0x64, 0xfe, 0x4c, 0x77, 0x37, 0x5b, 0x1e, 0x13, 0x40, 0x75, 0x4d, 0x47, 0x43, 0x14, 0xf2, 0x1c, 0x09, 0x10, 0xfd, 0x3a, 0x53, 0x3d, 0xea, 0xa6, 0x68, 0x33, 0xa4, 0x7c, 0x30, 0x62, 0x2a, 0xcf, 0xe9, 0x65, 0xf0, 0x63, 0x18, 0x93, 0xaa, 0x3b, 0xe0, 0x3c, 0xd0, 0xd7, 0x8c, 0xf0, 0xa5, 0x41, 0x1d, 0x47, 0xa5, 0x8b, 0x54, 0x66, 0xa2, 0xa8, 0xbd, 0xbf, 0xb6, 0xaf, 0x37, 0xb7, 0xd7, 0xb7, 0x1b, 0x7f, 0xbd, 0xd6, 0xdb, 0xf5, 0xca, 0x43, 0x21, 0xaf, 0x7c, 0x92, 0xb4, 0xc2, 0xc5, 0xa2, 0x05, 0x3e, 0x61, 0x28, 0x2c, 0x2a, 0xc6, 0x03, 0xb6, 0x7c, 0x39, 0x3e, 0xda, 0xe9, 0x15, 0x6a, 0x49, 0x2a, 0xb8, 0x2e, 0x83, 0x21, 0x0a, 0x1c, 0xf7, 0x0f, 0x05, 0x2e, 0x73, 0x8e, 0x9c, 0x5b, 0xcd, 0x18, 0xa3, 0xb7, 0x97, 0xfb, 0x02, 0x78, 0x55, 0x11, 0x21, 0xc5, 0xac, 0x8c, 0x3c, 0x12, 0xdc, 0x75, 0x17, 0xf2, 0x0f, 0xf3, 0x03, 0x0b, 0x53, 0x2b, 0x10, 0xb6, 0x8e, 0x0e, 0x1d, 0xcf, 0xef, 0x8b, 0x12, 0xa8, 0x11, 0xa4, 0x3e, 0x23, 0x49, 0x61, 0x48, 0x4e, 0xb9, 0xca, 0xc0, 0x78, 0xf6, 0x0b, 0x58, 0x1f, 0x13, 0x95, 0x9d, 0x24, 0x08, 0x87, 0x15, 0x10, 0x5d, 0x0b, 0x13, 0xb5, 0x20, 0x90, 0x35, 0x22, 0xa1, 0x5b, 0x6d, 0x88, 0xc4, 0xca, 0xc2, 0x69, 0x01, 0xe5, 0xd6, 0xb6, 0x41, 0x24, 0x40, 0x0f, 0xc9, 0x08, 0x11, 0xc0, 0x89, 0xf1, 0x30, 0x22, 0xa0, 0x52, 0x59, 0xc4, 0x57, 0xeb, 0xc8, 0x81, 0x04, 0x65, 0xc5, 0xb2, 0x6a, 0xc8, 0xaf, 0x49, 0x71, 0x01, 0x99, 0xf8, 0xd7, 0xcf, 0x14, 0x79, 0x0a, 0xc2, 0x74, 0xc0, 0xfb, 0x16, 0xfc, 0x51, 0xc9, 0xf9, 0x75, 0x4d, 0x1e, 0xaf, 0x2e, 0x47, 0x5f, 0x0d, 0x2a, 0x88, 0xf7, 0x26, 0x69, 0x9c, 0x54, 0x3d, 0x10, 0x77, 0x02, 0x8d, 0x78, 0x0e, 0x2b, 0xd8, 0x02, 0x32, 0x45, 0x20, 0xc9, 0x0d, 0xc1, 0xfb, 0x34, 0xb6, 0x18, 0x8d, 0xca, 0xf9, 0x4a, 0xa4, 0x7d, 0x20, 0xcf, 0x14, 0x68, 0x75, 0x20, 0xfc, 0x83, 0xa5, 0x47, 0x5d, 0x80, 0xdb, 0x5b, 0x09, 0x37, 0xb1, 0x3d, 0x06, 0x43, 0x2e, 0xa8, 0xa6, 0x5e, 0x08, 0x04, 0xb0, 0xe8, 0x04, 0x59, 0xde, 0x11, 0xe8, 0x00, 0x21, 0x4b, 0x2c, 0x16, 0x9e, 0xd7, 0xd9, 0xc1, 0xfd, 0x23, 0xa4, 0xea, 0x1f, 0xb9, 0xc7, 0x63, 0x60, 0x40, 0x94, 0x8d, 0x1a, 0x35, 0x84, 0xa1, 0xc6, 0x03, 0xb0, 0x75, 0x82, 0xf4, 0xd3, 0x78, 0x70, 0xca, 0x96, 0x62, 0x73, 0x01, 0x2a, 0x72, 0x81, 0x62, 0xf7, 0x2c, 0xf4, 0xe9, 0x14, 0x37, 0xaf, 0x3b, 0xe3, 0xee, 0xde, 0x58, 0xdf, 0x80, 0x5f, 0x74, 0xd9, 0xf9, 0xff, 0x86, 0x48, 0x1c, 0x10, 0xa8, 0x48, 0xac, 0xa5, 0x61, 0x65, 0xc7, 0x98, 0x5e, 0x90, 0x6d, 0x19, 0x2c, 0x20, 0xa8, 0xed, 0x73, 0xb9, 0x16, 0x2d, 0x5c, 0x8b, 0x44, 0x0d, 0xd8, 0xc5, 0x42, 0xc8, 0x5b, 0x6f, 0xdb, 0x56, 0x1f, 0x05, 0xc6, 0x2b, 0xa3, 0x38, 0x39, 0xab, 0x20, 0xb8, 0x64, 0x4d, 0xf4, 0x4a, 0x01, 0xd9, 0x29, 0xc0, 0xfe, 0x2a, 0x95, 0xf4, 0x09, 0x34, 0x2c, 0x5d, 0x2f, 0xb8, 0x86, 0xf8, 0xe2, 0x01, 0x6b, 0xfd, 0x73, 0xb8, 0xb0, 0x30, 0xd8, 0x3d, 0x22, 0x94, 0x62, 0x89, 0x89, 0x50, 0x87, 0x2e, 0xaf, 0x4c, 0x1f, 0xb8, 0xb4, 0x2c, 0xbd, 0x90, 0xd9, 0xa2, 0x7e, 0x4c, 0x8e, 0x9d, 0xea, 0x12, 0xb5, 0x01, 0x5c, 0x6f, 0x26, 0x14, 0x61, 0x4f, 0x24, 0x81, 0x22, 0x96, 0x78, 0x82, 0xaa, 0x4f, 0xd8, 0x00, 0x30, 0x29, 0x2b, 0x48, 0xc7, 0x2a, 0xa1, 0xf9, 0x0d, 0xca, 0x5e, 0x52, 0x6b, 0xc3, 0x35, 0xcb, 0xd9, 0x95, 0x8a, 0xa2, 0x9b, 0x4d, 0xa4, 0xb5, 0x29, 0x5b, 0xbf, 0x5b, 0x52, 0x42, 0xb8, 0x1e, 0x88, 0x74, 0x1a, 0xe9, 0x1b, 0x8c, 0xb8, 0x69, 0x2d, 0x4e, 0xbb, 0xbb, 0x84, 0x1c, 0x9f, 0xae, 0x13, 0x88, 0x22, 0x21, 0x5c, 0xe4, 0x38, 0xa5, 0x43, 0x4e, 0x9a, 0x57, 0xcd, 0xc3, 0x74, 0x0e, 0x47, 0x82, 0x87, 0x2a, 0xad, 0x6b, 0xcd, 0xe5, 0xad, 0x34, 0xe1, 0x37, 0x65, 0x09, 0x98, 0xe7, 0xd4, 0x73, 0x21, 0x8a, 0xea, 0xf4, 0xf8, 0x5d, 0xc3, 0x80, 0xca, 0xe6, 0xdb, 0xbb, 0x86, 0x7a, 0xa0, 0x4a, 0xbb, 0x98, 0x9d, 0x8f, 0x2d, 0x6d, 0x77, 0xe9, 0xa2, 0xe5, 0x01, 0x8d, 0xc2, 0x78, 0xc8, 0x71, 0x35, 0x20, 0xa5, 0x52, 0x0a, 0x9b, 0x96, 0x05, 0x78, 0x88, 0x8a, 0xe2, 0xb3, 0x34, 0xb2, 0x1e, 0xe5, 0x6d, 0x5c, 0xa6, 0xef, 0x84, 0xc9, 0x16, 0x83, 0xfa, 0x0c, 0xc9, 0x9e, 0xe0, 0xc2, 0x01, 0x90, 0xaa, 0x96, 0x42, 0x6a, 0x24, 0xce, 0xae, 0x29, 0xc0, 0xea, 0xf2, 0xb0, 0x0e, 0xfb, 0x6d, 0x64, 0xc1, 0x46, 0x4f, 0x4a, 0x0c, 0xaf, 0x40, 0x17, 0xde, 0x86, 0xd2, 0xc3, 0x6e, 0x04, 0xc5, 0x00, 0x2c, 0x92, 0x44, 0x41, 0x5a, 0x2f, 0xa7, 0xe7, 0x6e, 0x12, 0x49, 0x8d, 0x72, 0xde, 0xf3, 0xfe, 0xcd, 0x61, 0xb2, 0x30, 0x1e, 0xaa, 0x3e, 0x4c, 0x2b, 0x45, 0x10, 0x4d, 0x95, 0x61, 0x30, 0x30, 0x57, 0x8e, 0xb1, 0x48, 0xcc, 0x43, 0xef, 0x21, 0x12, 0x83, 0x8b, 0xcd, 0x04, 0x3b, 0x4f, 0x4e, 0x91, 0x1f, 0x24, 0xa9, 0x65, 0xf1, 0xbc, 0x8b, 0x7a, 0x45, 0x48, 0xec, 0x42, 0xd8, 0x69, 0x9f, 0xde, 0x8d, 0x42, 0x94, 0x43, 0x9b, 0x41, 0x62, 0x41, 0x18, 0x17, 0x69, 0x94, 0x4c, 0xd6, 0x3f, 0xd3, 0x38, 0x77, 0xc3, 0xb0, 0x48, 0xdb, 0x30, 0x2c, 0x3a, 0x26, 0x6f, 0xa5, 0xa5, 0x69, 0x3b, 0x02, 0xe4, 0xb1, 0x08, 0xeb, 0x67, 0x27, 0x9c, 0xdb, 0x62, 0xa1, 0x8a, 0x65, 0x82, 0x91, 0x5c, 0xef, 0x3c, 0x5f, 0x33, 0x13, 0x02, 0xe6, 0x95, 0x9f, 0x8b, 0x4c, 0xe9, 0x08, 0x4f, 0x4d, 0xf9, 0x24, 0x6d, 0xb2, 0xaa, 0xfd, 0x95, 0xd2, 0x55, 0xee, 0x40, 0x0e, 0xf2, 0x65, 0xab, 0x74, 0x91, 0x5a, 0x75, 0x48, 0x9c, 0xc8, 0xaf, 0x45, 0xc1, 0xbe, 0x69, 0x8a, 0x32, 0xe5, 0xfa, 0xcb, 0x1e, 0xfa, 0x7d, 0x96, 0xad, 0x34, 0x44, 0xbb, 0x6a, 0x43, 0x48, 0xad, 0xe2, 0x28, 0x22, 0x57, 0xb5, 0xbb, 0x15, 0x6c, 0x1d, 0x6b, 0x21, 0x51, 0x87, 0x36, 0xb8, 0x3c, 0x58, 0x6f, 0xa1, 0x39, 0x7a, 0x73, 0xbe, 0x67, 0xe8, 0xd1, 0xc2, 0x00, 0x77, 0x46, 0xa9, 0xd0, 0x67, 0x0c, 0xd0, 0x85, 0xf4, 0x9c, 0x2c, 0x7d, 0x39, 0x00, 0xa3, 0x39, 0x24, 0x72, 0x1b, 0xcd, 0x1a, 0xa8, 0x52, 0xb2, 0x77, 0xa8, 0x29, 0xa1, 0xa7, 0xa0, 0xbe, 0xf3, 0xb2, 0xc5, 0x56, 0x51, 0x51, 0xd9, 0xc2, 0x55, 0x9d, 0x9c, 0x1c, 0x63, 0xac, 0xc7, 0x28, 0x5c, 0xde, 0x85, 0xe0, 0x8b, 0x62, 0xa3, 0x70, 0xbe, 0x4a, 0xb0, 0x1f, 0x40, 0xda, 0x76, 0x83, 0x90, 0x46, 0x14, 0xe2, 0xa8, 0x78, 0xa1, 0xbd, 0x38, 0x8f, 0x1b, 0xfb, 0xdd, 0xc8, 0x7b, 0x26, 0x02, 0x6a, 0x34, 0x20, 0x15, 0xfd, 0x0c, 0x34, 0x20, 0x95, 0xf9, 0x0c, 0xf2, 0xa3, 0x2a, 0xe9, 0xd9, 0xf3, 0xb4, 0x4b, 0x2f, 0xdb, 0xd9, 0x24, 0x13, 0x5d, 0xe6, 0xc9, 0x44, 0x67, 0x59, 0x32, 0xd1, 0xf9, 0x36, 0x32, 0xd1, 0xc5, 0x16, 0x32, 0x91, 0xa2, 0x76, 0x46, 0x20, 0xba, 0x2c, 0x17, 0x53, 0xd0, 0x85, 0x9c, 0x90, 0x28, 0xc8, 0x25, 0xe0, 0xef, 0x40, 0xcc, 0x1b, 0xb7, 0x8f, 0xbf, 0x03, 0x89, 0xf1, 0x5e, 0xba, 0x09, 0x4c, 0x8e, 0xe6, 0x4e, 0x40, 0xa2, 0xbc, 0x69, 0x94, 0x47, 0x64, 0x1a, 0x31, 0x0e, 0x99, 0xb1, 0xc9, 0x36, 0xea, 0xb5, 0x1e, 0x9f, 0xb8, 0xb0, 0xa2, 0x9e, 0xc9, 0x88, 0x29, 0x41, 0xb7, 0xc7, 0x02, 0x88, 0x17, 0xa6, 0xb7, 0x82, 0xa6, 0x22, 0x3e, 0xb0, 0x8e, 0x18, 0xc9, 0x13, 0xc0, 0x44, 0x8a, 0xc9, 0x7f, 0x41, 0x46, 0x3e, 0x5e, 0x2c, 0x69, 0x19, 0x21, 0x4e, 0xee, 0xb1, 0xa7, 0x8f, 0xbc, 0xd5, 0xd7, 0x46, 0xca, 0x6e, 0xf9, 0xdc, 0x29, 0xe9, 0xa0, 0xa5, 0x3b, 0x19, 0x9c, 0xe9, 0x06, 0x64, 0x71, 0x28, 0xa6, 0xef, 0x0c, 0x36, 0x17, 0xf0, 0x92, 0x21, 0x38, 0x12, 0x5d, 0x08, 0x6d, 0xd0, 0xd8, 0x5f, 0xd8, 0x69, 0x60, 0x05, 0xbb, 0x31, 0x76, 0xc3, 0x65, 0xab, 0x19, 0x22, 0x36, 0x96, 0x3d, 0x19, 0x46, 0x8e, 0xc1, 0x42, 0x64, 0xcd, 0xb1, 0xf4, 0xbe, 0x9c, 0x10, 0xbc, 0x6d, 0x01, 0x80, 0x91, 0x22, 0xc2, 0xf5, 0xa1, 0x46, 0xd2, 0x6c, 0xb3, 0x15, 0x35, 0x48, 0xbf, 0x7f, 0xef, 0x7a, 0x44, 0x90, 0x41, 0xef, 0xfd, 0x0f, 0x55, 0x93, 0x2c, 0x01, 0x9e, 0xd7, 0xfe, 0xbe, 0x10, 0x21, 0x6d, 0xf6, 0x26, 0xcb, 0xd3, 0x70, 0xa8, 0xc6, 0x0a, 0x45, 0x23, 0xc0, 0xf5, 0x8b, 0x28, 0x1f, 0x06, 0x66, 0x33, 0x84, 0x0f, 0xb9, 0x35, 0x6d, 0x27, 0x7c, 0x84, 0xcb, 0x5c, 0x9d, 0xf0, 0x21, 0x19, 0x43, 0x81, 0x72, 0xbf, 0x07, 0x10, 0x4c, 0x4d, 0x66, 0x58, 0x28, 0x55, 0xd0, 0x35, 0x7a, 0x4b, 0x36, 0xbf, 0xd8, 0xb3, 0xd9, 0xfd, 0xf1, 0xd6, 0x48, 0xbe, 0xa5, 0xb8, 0x08, 0xe8, 0x66, 0x0b, 0x8c, 0x4e, 0xcc, 0x4c, 0x96, 0x6c, 0xa1, 0x86, 0xa9, 0xe4, 0xca, 0xb3, 0x28, 0x2b, 0xca, 0x25, 0xdc, 0x52, 0x8a, 0x9e, 0x38, 0xd9, 0x52, 0x14, 0x77, 0x4c, 0x13, 0x6e, 0xe9, 0x60, 0xc6, 0x20, 0x4a, 0x14, 0xe3, 0x3b, 0xa5, 0xc7, 0x18, 0xc8, 0x43, 0x06, 0x82, 0x6f, 0x47, 0xda, 0xb6, 0x40, 0x26, 0x32, 0x20, 0x9d, 0x9a, 0xe2, 0xd0, 0x79, 0xb7, 0x28, 0x16, 0x66, 0x90, 0x5c, 0xda, 0x32, 0x5b, 0x5f, 0x9c, 0x50, 0xba, 0xca, 0x67, 0x6d, 0xd2, 0x97, 0xa2, 0xcc, 0x42, 0xe9, 0xbc, 0x28, 0xae, 0xdb, 0xfa, 0x30, 0x99, 0xb5, 0x21, 0x78, 0xe3, 0xb3, 0x76, 0xf7, 0x89, 0xc5, 0xe9, 0xa1, 0x41, 0xb3, 0x23, 0x82, 0x56, 0x37, 0xca, 0xd2, 0x78, 0x39, 0xfd, 0xf9, 0x80, 0x1c, 0xc6, 0x1c, 0xd8, 0x9e, 0xc5, 0x12, 0x20, 0x8f, 0x3d, 0x39, 0x7a, 0x93, 0x74, 0x61, 0x1b, 0x69, 0x2b, 0x5a, 0xec, 0x0d, 0xd2, 0x96, 0x4d, 0x71, 0x08, 0xb0, 0xd9, 0x72, 0x01, 0x5c, 0xe4, 0xe1, 0x39, 0x2c, 0xaf, 0x10, 0x16, 0x2d, 0xba, 0x7b, 0x28, 0x60, 0xd5, 0xfc, 0xae, 0xb1, 0x77, 0xe5, 0x8a, 0xd8, 0x10, 0xe3, 0x13, 0x65, 0x1d, 0x53, 0x15, 0x37, 0xe5, 0x29, 0x08, 0xbd, 0x56, 0x26, 0xc1, 0xe6, 0xee, 0xd0, 0xd0, 0x54, 0x74, 0xec, 0x2f, 0x95, 0x94, 0xcd, 0x8d, 0x93, 0xc9, 0x5f, 0xe6, 0xa2, 0xa4, 0x36, 0x95, 0xae, 0x14, 0x66, 0x25, 0xce, 0x2d, 0x53, 0x60, 0xd9, 0x36, 0xe7, 0x72, 0xc8, 0xb8, 0x33, 0x9f, 0x22, 0xdc, 0xce, 0x42, 0xf6, 0x9c, 0x8d, 0x72, 0x56, 0xbc, 0x80, 0x1c, 0x2d, 0x14, 0xab, 0x14, 0xae, 0x93, 0xc4, 0xfd, 0x44, 0xa2, 0xef, 0x27, 0x0a, 0xcb, 0x4c, 0x7b, 0xd7, 0xcf, 0x71, 0x76, 0x5c, 0x43, 0xf9, 0x66, 0xc3, 0x87, 0x8d, 0x54, 0xba, 0x06, 0xe1, 0xed, 0xfa, 0x75, 0x05, 0xac, 0xed, 0x14, 0xd3, 0x8e, 0xe7, 0x57, 0x55, 0x4f, 0xcc, 0xd2, 0x01, 0x01, 0x42, 0x42, 0xc4, 0x00, 0xd6, 0x32, 0x62, 0x83, 0x88, 0x93, 0x0a, 0xcc, 0xaa, 0x0b, 0x58, 0x80, 0x58, 0xc3, 0x0c, 0xb9, 0xe0, 0x54, 0xa7, 0x38, 0xda, 0xdc, 0xb0, 0xa0, 0x1b, 0x68, 0x26, 0x4c, 0xa4, 0xb6, 0x74, 0x4b, 0x44, 0x0d, 0xa5, 0xf9, 0x2b, 0xd6, 0xf0, 0xfc, 0xb4, 0x77, 0x35, 0x19, 0xaf, 0xce, 0xf7, 0x5e, 0x88, 0xf9, 0x2b, 0x14, 0x8d, 0x90, 0xf3, 0x92, 0xf5, 0xed, 0xbd, 0x40, 0xb9, 0x97, 0xaf, 0x87, 0xae, 0x29, 0x97, 0xaf, 0xf0, 0x28, 0x2d, 0x79, 0xfa, 0xf4, 0x8c, 0xc1, 0xd2, 0x8e, 0x33, 0x86, 0x6a, 0x33, 0xa8, 0x00, 0x86, 0xca, 0xe2, 0x0d, 0x04, 0xe2, 0xd5, 0xcd, 0x32, 0xec, 0x8f, 0xfd, 0xae, 0xdf, 0x21, 0xae, 0x53, 0xa7, 0xfa, 0xdf, 0xd9, 0xf5, 0x89, 0xb4, 0x3e, 0x44, 0xf0, 0xaf, 0xd3, 0x51, 0x9b, 0x82, 0x8d, 0xdc, 0x5a, 0x25, 0x52, 0xe9, 0x43, 0x92, 0x1f, 0x0d, 0x43, 0x04, 0x7e, 0x3b, 0x9d, 0x3d, 0x48, 0x22, 0x49, 0x07, 0x9f, 0xb9, 0x6e, 0x75, 0x5e, 0x0f, 0x8b, 0x9c, 0xf1, 0x95, 0xda, 0x5a, 0x81, 0x06, 0xec, 0x67, 0x2c, 0x17, 0x10, 0xe1, 0xb9, 0xa2, 0xe3, 0x23, 0xd1, 0xb4, 0xc3, 0x13, 0x51, 0xcc, 0xe4, 0xd6, 0xe8, 0x4f, 0xac, 0xf6, 0x93, 0x03, 0x9e, 0xa8, 0xc8, 0x5e, 0x33, 0x57, 0xe0, 0x68, 0xc2, 0xb6, 0x39, 0x44, 0x9d, 0x29, 0x3d, 0x77, 0x1b, 0x48, 0x52, 0x7c, 0x35, 0x30, 0xb1, 0xc0, 0x04, 0x55, 0xb1, 0xa0, 0x1a, 0x8a, 0x5e, 0x0b, 0xad, 0x25, 0xae, 0x63, 0x86, 0xc9, 0x0d, 0x25, 0x3e, 0xc1, 0x89, 0x47, 0xba, 0xf3, 0x9b, 0xc4, 0x57, 0x39, 0xbd, 0x8f, 0x8e, 0x9b, 0xf8, 0x8f, 0x8a, 0x55, 0x3e, 0x8c, 0x29, 0x44, 0x7d, 0x49, 0x31, 0x2e, 0x45, 0x36, 0xa3, 0x1e, 0x84, 0x80, 0xb8, 0xf1, 0xa8, 0x78, 0x1c, 0xa3, 0xb1, 0x5b, 0x71, 0x03, 0x0f, 0x2c, 0x61, 0xce, 0xad, 0x3b, 0xee, 0xf4, 0x37, 0x30, 0xf7, 0x6e, 0x34, 0xf8, 0xcb, 0x26, 0x0d, 0x5e, 0x37, 0x93, 0x6e, 0x6c, 0xa5, 0x78, 0xf0, 0x39, 0xba, 0xf9, 0xea, 0x6b, 0x74, 0x27, 0xd5, 0x00, 0x4f, 0xaf, 0x47, 0xef, 0x41, 0x85, 0x9f, 0xa6, 0x54, 0x78, 0x34, 0x4f, 0xa2, 0x38, 0x96, 0xad, 0xee, 0xb9, 0x86, 0x40, 0xa8, 0xa4, 0x49, 0x84, 0x57, 0xd1, 0x91, 0x7f, 0x08, 0x11, 0xde, 0x5f, 0xae, 0xfa, 0x2f, 0xa8, 0x93, 0x9c, 0xca, 0xa7, 0x6c, 0xa5, 0xd1, 0xff, 0xe1, 0xff, 0xa7, 0x0c, 0xff, 0x98, 0xbd, 0x9f, 0x30, 0xf5, 0xb7, 0xb1, 0xe6, 0xe5, 0x56, 0x10, 0xd8, 0x69, 0x0d, 0xd1, 0xce, 0xd7, 0xc3, 0x17, 0x8e, 0x2d, 0xef, 0x54, 0x7e, 0x1e, 0xc3, 0x68, 0x27, 0x93, 0xfd, 0xb7, 0xf1, 0x34, 0x5d, 0x75, 0x9e, 0x5a, 0xa3, 0x4c, 0x4d, 0xa1, 0x8b, 0x43, 0x2f, 0x0e, 0x66, 0xdf, 0x71, 0x2a, 0x48, 0x0a, 0xe5, 0x84, 0xbd, 0x81, 0xfe, 0xa7, 0xc8, 0x38, 0x85, 0x70, 0xd9, 0x40, 0x2e, 0x18, 0xb9, 0xec, 0xb1, 0x9e, 0xf3, 0x5b, 0x9a, 0x46, 0xad, 0x65, 0xd3, 0x30, 0x60, 0xf6, 0xfc, 0x8f, 0x33, 0x40, 0x9d, 0x1c, 0x62, 0x54, 0x84, 0x6e, 0x7f, 0x9f, 0xee, 0xa5, 0x2c, 0x5b, 0xd7, 0x3b, 0xab, 0x68, 0xb7, 0x56, 0x31, 0x1a, 0x12, 0x4b, 0x18, 0x01, 0x49, 0x7c, 0x5c, 0xab, 0xb7, 0x0d, 0x84, 0xeb, 0xcf, 0x70, 0x78, 0xb0, 0x07, 0xf5, 0x67, 0x33, 0x56, 0x66, 0xa1, 0xb7, 0xb7, 0xca, 0xd2, 0x88, 0x43, 0x26, 0xcb, 0x3f, 0x15, 0x7f, 0xa2, 0x8c, 0x1e, 0x5f, 0x29, 0xba, 0x57, 0x1f, 0x19, 0x17, 0xc5, 0x01, 0x8a, 0xb9, 0xb8, 0x9a, 0xea, 0x8b, 0xd8, 0xb8, 0xae, 0x82, 0xc7, 0x73, 0x72, 0xdd, 0x42, 0xcd, 0x33, 0x73, 0xeb, 0xb1, 0xf7, 0x32, 0x4e, 0xeb, 0x95, 0x27, 0x08, 0x66, 0xbc, 0x42, 0x1d, 0xca, 0x78, 0x4f, 0xd8, 0xbd, 0x4c, 0x54, 0x4b, 0x73, 0x57, 0x5b, 0x56, 0x0f, 0x99, 0x9d, 0xdd, 0x4e, 0x39, 0xb0, 0x50, 0x2f, 0xc0, 0x29, 0xa2, 0x9b, 0xde, 0x16, 0x2d, 0x00, 0x0b, 0xc5, 0xf9, 0xf8, 0x48, 0x83, 0x41, 0x91, 0x05, 0x0b, 0xc1, 0x03, 0x23, 0xed, 0x3e, 0x93, 0x87, 0x9b, 0x07, 0x4d, 0xde, 0xe5, 0x00, 0xcb, 0x50, 0xcd, 0x0a, 0x0c, 0x8f, 0xe6, 0x94, 0x73, 0x9c, 0x43, 0x51, 0xfd, 0xb8, 0x5b, 0x1c, 0x62, 0x39, 0xb8, 0xb5, 0x45, 0x5b, 0x1c, 0x4c, 0xe3, 0x96, 0x5d, 0x7b, 0x0e, 0xde, 0x08, 0x96, 0xe4, 0x49, 0x75, 0xed, 0xa2, 0xbe, 0xfb, 0xae, 0xba, 0x6e, 0xe3, 0x36, 0x01, 0x79, 0x00, 0xdd, 0x55, 0x24, 0x2d, 0xea, 0xce, 0x96, 0x05, 0xec, 0xd2, 0xc9, 0xaa, 0x46, 0x7e, 0xe3, 0xb0, 0x49, 0x31, 0x63, 0x18, 0x44, 0xea, 0xf4, 0x47, 0x30, 0x90, 0x1f, 0x9b, 0x82, 0xa8, 0x92, 0x16, 0x44, 0xf4, 0x9b, 0x78, 0xef, 0xb3, 0x05, 0x71, 0x14, 0xde, 0x7d, 0x13, 0xe2, 0x70, 0xb7, 0xe3, 0xd0, 0x24, 0x8b, 0xde, 0x65, 0x0b, 0xb5, 0x69, 0x71, 0x42, 0xb7, 0xdb, 0xd0, 0x26, 0x8b, 0xde, 0x75, 0x0b, 0x3e, 0x86, 0x30, 0x90, 0x3b, 0xfe, 0x4d, 0xc3, 0x13, 0x32, 0xef, 0xd5, 0x8a, 0x77, 0x85, 0x6c, 0x1b, 0xb8, 0x90, 0xdc, 0x03, 0x09, 0x1b, 0xc5, 0xd0, 0xb5, 0x34, 0xcd, 0x07, 0xd7, 0xf7, 0x5c, 0x97, 0x7c, 0x21, 0x42, 0x07, 0x4a, 0x45, 0xa9, 0x32, 0xe8, 0x9b, 0x65, 0x1b, 0xde, 0x48, 0x5b, 0x23, 0xcd, 0xe5, 0xa4, 0xed, 0x08, 0x8c, 0xa1, 0x14, 0x5e, 0x5d, 0x6f, 0xa9, 0x88, 0xcc, 0xe6, 0xf4, 0x0f, 0x4c, 0xf6, 0x4c, 0x2c, 0x59, 0x6b, 0x72, 0x7b, 0x66, 0x3b, 0x16, 0xbe, 0xa2, 0xba, 0x08, 0x82, 0x5b, 0xcc, 0x5b, 0xa5, 0x10, 0x92, 0x93, 0xa6, 0x9b, 0x40, 0x66, 0xff, 0x96, 0x93, 0x33, 0x70, 0x15, 0x5a, 0x1a, 0x27, 0x6b, 0xe0, 0xdb, 0xf1, 0xcf, 0x21, 0x6e, 0x70, 0xb0, 0xff, 0xd9, 0x22, 0xb0, 0xb8, 0x03, 0x78, 0xb7, 0x49, 0xce, 0x22, 0x91, 0xdd, 0x55, 0xe5, 0x38, 0x70, 0x57, 0xc3, 0x2a, 0xba, 0x18, 0x2d, 0xf5, 0x56, 0x42, 0xd6, 0xbd, 0x3c, 0xd0, 0x4e, 0x1b, 0x6f, 0x27, 0xbb, 0xc4, 0x24, 0x70, 0xfb, 0x81, 0x70, 0x71, 0x92, 0xda, 0xee, 0x2e, 0x48, 0xae, 0x4f, 0x48, 0xaf, 0x17, 0x1f, 0x64, 0x00, 0x32, 0xcd, 0xca, 0x46, 0x62, 0x3b, 0xbd, 0xc5, 0xec, 0x6a, 0xbc, 0x71, 0x35, 0x6c, 0x49, 0x99, 0x50, 0x62, 0xd3, 0x7f, 0xb5, 0xa0, 0x04, 0x33, 0x9f, 0x9a, 0x08, 0xb7, 0x96, 0xa9, 0xe6, 0x21, 0x3a, 0xee, 0xb2, 0x68, 0xb1, 0xc8, 0x63, 0x0f, 0x21, 0x13, 0x53, 0x91, 0x94, 0xe1, 0x6b, 0xf0, 0xd6, 0x97, 0x70, 0x49, 0x6d, 0x8f, 0x5e, 0x0f, 0xf7, 0xd1, 0x3c, 0x31, 0xa4, 0x6e, 0x9d, 0xe9, 0x3c, 0x2f, 0x04, 0x3e, 0xba, 0xe2, 0x43, 0xfa, 0x0d, 0x4c, 0x5b, 0x69, 0x7a, 0xc4, 0xf9, 0xbe, 0xb8, 0xf4, 0xa1, 0xb5, 0x51, 0x0d, 0xaf, 0x5d, 0x0d, 0x6a, 0xa3, 0x5d, 0x6b, 0xea, 0xec, 0x6a, 0x8e, 0xa8, 0xad, 0x51, 0x25, 0xaf, 0x5d, 0x25, 0x1a, 0x8d, 0x3c, 0xbc, 0x13, 0xee, 0xba, 0xeb, 0xdf, 0x13, 0xd8, 0x3f, 0x8d, 0x04, 0x33, 0x84, 0xec, 0x95, 0x84, 0x40, 0x0f, 0x90, 0xa7, 0xfd, 0x02, 0xc6, 0xf8, 0x4c, 0x2e, 0xe3, 0xe7, 0xf9, 0x47, 0xb0, 0xdc, 0x29, 0xd2, 0x8c, 0x33, 0x3b, 0x32, 0x8f, 0x6d, 0x58, 0xad, 0xc3, 0x62, 0x1d, 0x56, 0xeb, 0xb0, 0xd7, 0xba, 0x39, 0x8b, 0x3a, 0xfa, 0xea, 0xb0, 0x5d, 0x87, 0xc0, 0xd6, 0xb0, 0x5d, 0xe5, 0x93, 0xd4, 0xb1, 0x5d, 0xc7, 0x2f, 0x69, 0x60, 0xbb, 0x6b, 0xc8, 0xa2, 0x24, 0x06, 0x74, 0x00, 0xf7, 0xb3, 0x06, 0x67, 0x0e, 0x5f, 0xec, 0xf7, 0x0f, 0x00, 0x3a, 0xfe, 0x07, 0xc5, 0x61, 0xff, 0x6b, 0x0d, 0xba, 0x32, 0x0b, 0x07, 0x3c, 0xc2, 0x58, 0x5c, 0x96, 0xdf, 0x42, 0x58, 0x70, 0xb4, 0xfa, 0x33, 0x75, 0x20, 0x85, 0xb7, 0xe2, 0x45, 0x65, 0x2f, 0x80, 0xba, 0xa1, 0x2e, 0x60, 0x50, 0x91, 0xdd, 0x0a, 0x94, 0x0e, 0xfa, 0xcb, 0xaa, 0xdf, 0x9a, 0xf1, 0x92, 0xb4, 0x15, 0x4b, 0x8f, 0x36, 0x64, 0xd1, 0xf0, 0x54, 0xc0, 0x8d, 0xe8, 0x98, 0x77, 0x00, 0xab, 0x35, 0x81, 0x4a, 0x8e, 0xb6, 0x17, 0xbc, 0xe5, 0xda, 0xa2, 0x85, 0x95, 0xe5, 0xe4, 0xbf, 0x3d, 0x52, 0xe3, 0x0e, 0x78, 0x17, 0xce, 0xe1, 0x93, 0x45, 0x8f, 0xd6, 0xeb, 0xd2, 0xa4, 0xda, 0x1d, 0x56, 0x35, 0xfe, 0x6c, 0xdd, 0x41, 0x26, 0x5b, 0xbc, 0x9f, 0x45, 0x78, 0x1b, 0x88, 0x70, 0xec, 0x54, 0x64, 0xdd, 0xe7, 0x94, 0x06, 0x56, 0xe0, 0x41, 0xee, 0xe8, 0x14, 0xea, 0x21, 0x74, 0x5b, 0xa3, 0x29, 0xf0, 0x0a, 0x41, 0x89, 0xba, 0xf6, 0x6d, 0xb7, 0xe0, 0xfd, 0x54, 0x46, 0xe8, 0xf6, 0x76, 0x2d, 0x64, 0x9e, 0xb1, 0x6c, 0x08, 0xd8, 0xdd, 0x51, 0x6a, 0xcd, 0x93, 0xb1, 0xa3, 0x1a, 0x71, 0xd1, 0x23, 0x58, 0xa8, 0x35, 0x08, 0x35, 0xc2, 0x89, 0xa6, 0xbb, 0xbd, 0xb5, 0x64, 0x7c, 0x40, 0x0a, 0xfe, 0xd9, 0x5e, 0x34, 0x79, 0x0b, 0xbd, 0xcc, 0x68, 0x57, 0x61, 0xdc, 0x52, 0x66, 0x62, 0x1c, 0xd9, 0x34, 0xba, 0x1c, 0x42, 0xa2, 0x11, 0x28, 0xa6, 0x1f, 0x26, 0xce, 0x20, 0x75, 0x3c, 0xae, 0x5f, 0x17, 0x06, 0xd2, 0xd6, 0x20, 0x2d, 0x41, 0x8a, 0x32, 0x97, 0x68, 0x83, 0x44, 0x06, 0xc7, 0xd6, 0xec, 0xc4, 0x25, 0xec, 0xb6, 0xe6, 0x6b, 0x2e, 0xae, 0x51, 0x71, 0xfb, 0xf2, 0x10, 0x05, 0xf5, 0xe1, 0x4b, 0xe6, 0x79, 0xfb, 0xec, 0x10, 0x15, 0xf3, 0xd1, 0x8b, 0x21, 0xc9, 0x14, 0x63, 0x4d, 0xc8, 0x2d, 0x6b, 0x89, 0xdd, 0x0e, 0xfb, 0x34, 0xe5, 0x1f, 0x0e, 0x71, 0x84, 0xb6, 0xca, 0x5d, 0x57, 0xce, 0x06, 0x42, 0xd2, 0xfe, 0xe5, 0x9a, 0x6f, 0x21, 0x8e, 0xb3, 0xd6, 0x9a, 0xf9, 0x57, 0x99, 0xd5, 0xd6, 0x95, 0x7f, 0xb7, 0xd9, 0x8c, 0xf2, 0xeb, 0x7c, 0x47, 0xa5, 0xa3, 0x04, 0xcd, 0x15, 0x95, 0xaa, 0xd9, 0x2c, 0x69, 0x5a, 0x9b, 0x05, 0xce, 0xea, 0x89, 0xb5, 0x8c, 0x10, 0x7c, 0x47, 0x3c, 0xa0, 0x55, 0x86, 0xa6, 0xa0, 0xdd, 0xb3, 0xb4, 0x1b, 0x33, 0x80, 0x96, 0x5a, 0x47, 0x42, 0x02, 0x2d, 0x2f, 0xca, 0xef, 0xba, 0x12, 0xa5, 0x71, 0x7d, 0x09, 0x89, 0x7c, 0x67, 0x92, 0xb2, 0x93, 0xee, 0xd4, 0x6b, 0xf5, 0x1d, 0x5a, 0xd6, 0xeb, 0x72, 0x5d, 0x0a, 0x11, 0xd9, 0x2b, 0xb1, 0x3a, 0x6f, 0x04, 0x96, 0x48, 0x49, 0x4d, 0x6f, 0x4d, 0xd3, 0xa6, 0x14, 0x3e, 0xc5, 0xb8, 0x28, 0xe0, 0xbb, 0x8c, 0xd1, 0x62, 0x2a, 0x0c, 0x78, 0xb9, 0xec, 0xa3, 0xc8, 0x7e, 0x53, 0xab, 0x05, 0xe4, 0xfe, 0x48, 0x0e, 0x9d, 0xae, 0x3b, 0x18, 0xec, 0xd0, 0x82, 0xbd, 0x1e, 0x39, 0x5a, 0x28, 0x18, 0x48, 0xc1, 0xb3, 0xaf, 0x44, 0xce, 0xcc, 0xca, 0x38, 0x9a, 0x41, 0x9c, 0x8c, 0x06, 0xb8, 0xe1, 0x7e, 0x84, 0x8f, 0xde, 0xff, 0x5e, 0xa8, 0x1f, 0x3e, 0xc8, 0x1a, 0xe2, 0xf0, 0x5f, 0x22, 0x7d, 0xac, 0x23, 0xd0, 0xb8, 0xab, 0x47, 0xa2, 0xc7, 0xd6, 0x2b, 0x27, 0x92, 0x6c, 0xf7, 0x58, 0x47, 0xd8, 0xf5, 0x02, 0x69, 0x24, 0xa4, 0xf8, 0x58, 0x77, 0x39, 0xd2, 0xd2, 0x59, 0x11, 0xf4, 0x40, 0x04, 0xe0, 0xe2, 0x2a, 0xca, 0xa2, 0xeb, 0x00, 0xd7, 0x11, 0xd6, 0x63, 0x78, 0xd8, 0x68, 0x03, 0x38, 0xb8, 0x04, 0x20, 0xf2, 0xcb, 0x83, 0xc4, 0xc0, 0x8b, 0x3b, 0x54, 0x01, 0x9a, 0x04, 0xee, 0xe8, 0x1f, 0x13, 0x28, 0xa0, 0xb1, 0x73, 0x1a, 0xd1, 0x9a, 0x0e, 0x09, 0xf4, 0x81, 0x49, 0x8c, 0x8a, 0x8c, 0x44, 0x24, 0xd5, 0xda, 0x3b, 0x52, 0x18, 0x28, 0x72, 0x49, 0x25, 0x85, 0xa0, 0x43, 0x51, 0xab, 0x7e, 0x9d, 0x4e, 0x66, 0x7f, 0x83, 0x5d, 0x2b, 0x36, 0x0e, 0x72, 0x04, 0x62, 0xa6, 0x73, 0x5b, 0xb4, 0xc0, 0xfc, 0x6c, 0xd7, 0x45, 0xa4, 0x51, 0x07, 0x0a, 0xc2, 0x3a, 0x40, 0x93, 0x43, 0x14, 0xa4, 0x8f, 0x94, 0x24, 0xbe, 0x70, 0x58, 0x97, 0xc8, 0xc9, 0x30, 0x29, 0x07, 0x1f, 0x14, 0x4f, 0x45, 0xcd, 0x17, 0x84, 0x34, 0xd4, 0x64, 0x07, 0x7a, 0x10, 0xc6, 0x0f, 0x4c, 0x18, 0x3d, 0xa3, 0x70, 0x86, 0xd6, 0xc2, 0x89, 0x82, 0x4f, 0x70, 0xa6, 0xd6, 0xc3, 0xe5, 0x3a, 0xd9, 0xd7, 0x43, 0x04, 0x22, 0x91, 0xb2, 0x85, 0xf6, 0xe1, 0xf2, 0x80, 0x68, 0x21, 0xf4, 0xf5, 0xb1, 0x97, 0xf7, 0xdd, 0x86, 0xdd, 0xef, 0x1a, 0xfa, 0x47, 0xa3, 0xcc, 0x6a, 0x72, 0x1d, 0xf3, 0x1f, 0x35, 0x0e, 0x4b, 0x4d, 0x2b, 0x17, 0xa9, 0x0c, 0x94, 0x2b, 0xf6, 0xd5, 0xd3, 0x24, 0x12, 0xfe, 0x88, 0xcb, 0x48, 0x66, 0x21, 0x8b, 0x0f, 0x2d, 0xb9, 0x30, 0xd7, 0x97, 0xb4, 0x67, 0xb6, 0x53, 0xf0, 0x24, 0xb7, 0x8c, 0x61, 0xea, 0x2f, 0xbf, 0x50, 0x81, 0x25, 0xd1, 0xfc, 0x24, 0x9b, 0x0d, 0xc4, 0x08, 0x7b, 0x63, 0x5e, 0x2d, 0x27, 0xe6, 0x34, 0x93, 0x1a, 0x83, 0x68, 0x18, 0xed, 0x92, 0xc9, 0x9b, 0x88, 0x22, 0xa6, 0xa5, 0x8b, 0x04, 0x62, 0xdc, 0x3d, 0x99, 0x1d, 0x60, 0x47, 0x69, 0xa8, 0xcd, 0x15, 0x90, 0xa3, 0x34, 0xdc, 0x8f, 0xd7, 0xb8, 0x16, 0x21, 0xa3, 0x04, 0x09, 0x13, 0x3f, 0x59, 0x69, 0xb4, 0x9b, 0x4c, 0xb8, 0xb7, 0x83, 0xb8, 0xc9, 0x08, 0x47, 0x1c, 0x25, 0xf2, 0x21, 0x4c, 0x42, 0xb9, 0x09, 0xdd, 0x7b, 0x99, 0x65, 0xc7, 0x8d, 0xa8, 0x5b, 0x52, 0x07, 0xe5, 0x02, 0x5d, 0xcf, 0x24, 0x83, 0xce, 0x4e, 0x7e, 0x6d, 0xf6, 0x0f, 0x06, 0xc9, 0x08, 0xc4, 0xab, 0x1d, 0x0c, 0x04, 0x63, 0xd4, 0xf8, 0x9d, 0x76, 0xe9, 0x76, 0xda, 0x25, 0x37, 0xda, 0xe1, 0xf9, 0x70, 0xf7, 0x6c, 0xef, 0xa2, 0xaf, 0xe9, 0x7c, 0x2c, 0x82, 0x19, 0x0a, 0x42, 0xb7, 0xec, 0x70, 0x97, 0x9b, 0xd8, 0xf0, 0xd9, 0xf0, 0xfc, 0xd9, 0x45, 0x87, 0x7c, 0x9d, 0x91, 0x6e, 0x6b, 0xe0, 0x2d, 0x64, 0x11, 0x0d, 0xcf, 0xa9, 0x38, 0xea, 0x36, 0x29, 0x02, 0xf5, 0xd1, 0xc2, 0xb5, 0x15, 0x08, 0x15, 0x06, 0xd3, 0xf0, 0x8c, 0x61, 0xd6, 0x0e, 0x04, 0xca, 0x93, 0x84, 0x2a, 0x86, 0xe6, 0xc7, 0x17, 0x5e, 0xd8, 0x70, 0xb9, 0xa8, 0x4d, 0xbf, 0x0e, 0xd3, 0xc6, 0xd9, 0xc6, 0x59, 0xb3, 0xfa, 0xd7, 0xb0, 0xc2, 0xec, 0xaa, 0xde, 0x40, 0x66, 0x9b, 0x30, 0x44, 0x7e, 0x69, 0x9e, 0x59, 0x81, 0x92, 0x7b, 0x18, 0x42, 0xc9, 0x64, 0x2d, 0xed, 0x40, 0x26, 0xd7, 0x06, 0xe6, 0x11, 0xa8, 0xa2, 0x7f, 0x78, 0x53, 0x50, 0x65, 0xff, 0xc8, 0xa3, 0xf8, 0x0d, 0x1c, 0x44, 0xb0, 0x50, 0xcf, 0x74, 0x92, 0xbe, 0x83, 0x6a, 0x6f, 0xe3, 0x13, 0x2a, 0xf1, 0xac, 0x27, 0x37, 0x10, 0x48, 0xc4, 0x9b, 0x86, 0xab, 0x20, 0x2a, 0x41, 0x2f, 0x77, 0x76, 0x3d, 0xf2, 0x35, 0x46, 0x05, 0x68, 0x53, 0xa6, 0x7a, 0xbb, 0x41, 0x7f, 0x05, 0x0c, 0xb8, 0x26, 0xee, 0xfa, 0x86, 0x2b, 0x18, 0xf0, 0x1d, 0x46, 0x04, 0x6f, 0x81, 0xde, 0x52, 0xa4, 0xf8, 0xd8, 0x00, 0x2e, 0x09, 0x4d, 0xf2, 0x35, 0x7e, 0x76, 0x4f, 0xf1, 0x43, 0xcf, 0x95, 0x02, 0x15, 0x1b, 0x3b, 0xc8, 0x00, 0xc9, 0x3a, 0x81, 0x19, 0x40, 0xf2, 0x38, 0x71, 0xb1, 0x55, 0x00, 0xac, 0xc8, 0x6d, 0x34, 0xc9, 0x18, 0xb7, 0x6d, 0x90, 0x05, 0x53, 0x04, 0xfa, 0x11, 0x24, 0x49, 0x8f, 0x51, 0xe4, 0x28, 0x92, 0x51, 0xe4, 0xde, 0x5f, 0xaf, 0xff, 0xe5, 0xf6, 0xaf, 0x1b, 0x7c, 0xaf, 0x37, 0x81, 0xdd, 0x2f, 0xb8, 0x43, 0xca, 0xeb, 0x8f, 0xd0, 0x4e, 0x12, 0xfb, 0x9c, 0x45, 0x3c, 0x31, 0xc7, 0xa5, 0xb8, 0x68, 0xb6, 0xc5, 0x92, 0x1e, 0x73, 0x12, 0xde, 0x48, 0xc8, 0xf6, 0xe4, 0xcf, 0xec, 0x99, 0x9a, 0xad, 0x38, 0x93, 0x50, 0x05, 0xfb, 0x1a, 0x77, 0xa0, 0xb8, 0x78, 0x83, 0x14, 0x5b, 0x1a, 0xa7, 0xb1, 0x24, 0x53, 0x6a, 0x32, 0xa3, 0x93, 0x46, 0x05, 0x3c, 0x30, 0x0f, 0x09, 0x75, 0x36, 0x42, 0x49, 0x1c, 0x21, 0x76, 0x6b, 0xd0, 0xbd, 0xa4, 0x59, 0x4d, 0x42, 0xfb, 0xc7, 0x0f, 0x50, 0xba, 0x34, 0xe1, 0xb7, 0xc0, 0xeb, 0x71, 0x3b, 0x80, 0x36, 0x64, 0xfd, 0x3c, 0xfa, 0x22, 0x62, 0xee, 0xc0, 0x2d, 0x0f, 0x9d, 0x5a, 0x89, 0xa6, 0x29, 0xe7, 0x50, 0x59, 0xa4, 0x2a, 0x90, 0x1f, 0xd1, 0xc3, 0xb6, 0xea, 0x68, 0xc5, 0x99, 0xe0, 0x49, 0x16, 0xea, 0x56, 0xf8, 0xd9, 0x40, 0xc2, 0x17, 0x8a, 0x5c, 0x7c, 0x25, 0xfd, 0xd0, 0x35, 0x5e, 0xa8, 0x95, 0xf2, 0x16, 0xe7, 0xea, 0xaa, 0xee, 0x58, 0xbd, 0x20, 0xe8, 0x81, 0x99, 0x1a, 0x58, 0xad, 0x5d, 0x52, 0x09, 0xa4, 0x45, 0x54, 0x73, 0x58, 0xa3, 0x60, 0x44, 0x79, 0x92, 0xd0, 0xe7, 0xac, 0x7f, 0x9d, 0xee, 0xef, 0x40, 0x95, 0x10, 0xfa, 0x1c, 0xc4, 0xcf, 0x62, 0xfa, 0x5c, 0x8c, 0x5c, 0x12, 0x9e, 0xf2, 0xcd, 0xa8, 0x73, 0xfa, 0x52, 0xd3, 0x15, 0x4a, 0x02, 0xbd, 0xb6, 0x90, 0x9f, 0x69, 0xd2, 0xf1, 0x48, 0x09, 0xf4, 0x74, 0x3c, 0x6b, 0x97, 0xa6, 0x50, 0x2a, 0x9e, 0xdb, 0x22, 0xb8, 0x66, 0x66, 0x88, 0x78, 0xe3, 0xff, 0x19, 0x22, 0xde, 0x16, 0xe5, 0xf8, 0x88, 0xb4, 0xf7, 0x90, 0x13, 0xed, 0x88, 0x4d, 0xa9, 0x45, 0x2d, 0x8a, 0x53, 0xcf, 0xab, 0xac, 0x7b, 0xc8, 0x0e, 0xee, 0xbd, 0x1e, 0xf0, 0x86, 0x16, 0x39, 0x1d, 0x33, 0x8b, 0xa8, 0x39, 0xae, 0xe5, 0xe3, 0x99, 0x96, 0xe6, 0x36, 0xcc, 0x69, 0x26, 0x18, 0x9d, 0xe4, 0x1b, 0x67, 0x80, 0xf2, 0xe5, 0x3e, 0x88, 0xc5, 0xb1, 0xe4, 0xbb, 0xd2, 0x4d, 0xf4, 0xcf, 0x59, 0xad, 0x9c, 0x2c, 0x95, 0x2a, 0x43, 0x87, 0xa6, 0x4a, 0x8c, 0xb9, 0xa4, 0x2d, 0x07, 0x12, 0x8f, 0x05, 0xb7, 0x8d, 0x37, 0x1c, 0x0c, 0x99, 0x87, 0xd4, 0xa2, 0xe5, 0x6e, 0x76, 0x42, 0x68, 0x74, 0x3e, 0xb6, 0x74, 0x2f, 0xfe, 0x35, 0xf1, 0xee, 0x4a, 0xcb, 0x9a, 0x67, 0x66, 0x7a, 0xc1, 0xb4, 0xa0, 0xa8, 0x04, 0x68, 0x0d, 0x28, 0x21, 0x45, 0xc3, 0xea, 0x0a, 0x85, 0x02, 0x62, 0xde, 0x68, 0xad, 0x5e, 0x50, 0x57, 0xe2, 0x7a, 0x91, 0x5e, 0xe9, 0x4a, 0x0d, 0x6f, 0x97, 0x49, 0x83, 0x6a, 0x3b, 0xfd, 0x28, 0x8d, 0x4c, 0xe4, 0x1c, 0x8f, 0x7b, 0x81, 0x5a, 0xd5, 0x25, 0x84, 0xf1, 0x03, 0x0d, 0xac, 0x2d, 0x35, 0xb0, 0x1f, 0xae, 0x5f, 0xb3, 0x7c, 0x27, 0x97, 0x08, 0xde, 0x0d, 0x23, 0xd1, 0xd9, 0x3b, 0x28, 0x5f, 0x2a, 0x4b, 0x89, 0x73, 0xf4, 0x6c, 0x39, 0x28, 0x5e, 0x0f, 0x0f, 0x84, 0xdc, 0xa8, 0xeb, 0x49, 0x48, 0x8d, 0x36, 0x14, 0xdf, 0x6d, 0x50, 0xd9, 0xf5, 0xb3, 0x82, 0x62, 0x41, 0xcf, 0x8a, 0x0e, 0x8d, 0x14, 0x09, 0x0f, 0x91, 0x71, 0x3f, 0x08, 0x46, 0xa5, 0xd1, 0x2e, 0xec, 0x23, 0x11, 0x32, 0x4d, 0x1b, 0x0f, 0xbe, 0xba, 0x40, 0x0b, 0x23, 0x28, 0xb2, 0xeb, 0xb5, 0x89, 0xcb, 0x4d, 0x04, 0x46, 0x56, 0xa8, 0x6a, 0x09, 0x4d, 0x2d, 0x08, 0xa7, 0x3b, 0xca, 0x98, 0x77, 0x7c, 0x9f, 0x8c, 0x1b, 0xee, 0xb0, 0x69, 0x80, 0x3b, 0x6c, 0xc0, 0xa9, 0x8b, 0xcd, 0x68, 0x88, 0x45, 0xbe, 0xcf, 0x30, 0xc1, 0x42, 0x84, 0xba, 0x66, 0xef, 0x80, 0x22, 0x50, 0xd2, 0x50, 0x0f, 0xce, 0xa9, 0x33, 0x9c, 0x48, 0x48, 0x0b, 0x7e, 0x89, 0x61, 0xf2, 0x46, 0xd6, 0x1c, 0x45, 0x81, 0xd8, 0x24, 0x07, 0x99, 0xc3, 0x06, 0x80, 0x6b, 0x1b, 0xdf, 0x38, 0x66, 0x85, 0x7b, 0x18, 0xb9, 0x07, 0x18, 0xb1, 0xd1, 0x07, 0x5a, 0x0a, 0xaf, 0x2d, 0xa8, 0x5a, 0x9d, 0xc9, 0x22, 0x1a, 0x03, 0x3f, 0x4b, 0x16, 0x51, 0x24, 0x34, 0x2d, 0x98, 0xaf, 0x4d, 0x3e, 0x9c, 0x89, 0xcd, 0xe9, 0x6a, 0x4f, 0x35, 0x7e, 0x5f, 0x41, 0x2e, 0x44, 0xf6, 0x34, 0x5d, 0x98, 0x3b, 0xb5, 0xe2, 0x10, 0x48, 0x1e, 0x93, 0xa5, 0x7c, 0x3d, 0xc6, 0x90, 0xa0, 0xe8, 0x7f, 0x27, 0x8e, 0x88, 0xe5, 0x66, 0x29, 0x46, 0x21, 0x9b, 0x4b, 0xf1, 0x6f, 0x82, 0x2e, 0xfa, 0x24, 0x03, 0x4f, 0xbe, 0x3b, 0xc5, 0xad, 0x3b, 0xb8, 0x41, 0xfc, 0x5e, 0x72, 0x09, 0x89, 0x61, 0xdc, 0x81, 0xb7, 0xeb, 0xd0, 0x26, 0x93, 0x16, 0xcb, 0x36, 0x4d, 0xc5, 0xc6, 0xb2, 0x0d, 0x34, 0xe9, 0xae, 0x7c, 0xdb, 0x9c, 0xec, 0x96, 0x8f, 0xbd, 0xe3, 0x94, 0x14, 0x87, 0x07, 0xfd, 0xf9, 0xe1, 0xee, 0x01, 0x60, 0x11, 0x67, 0x67, 0x84, 0xd7, 0x85, 0x7b, 0x8d, 0x96, 0x33, 0x30, 0x17, 0x97, 0x0d, 0xa3, 0x6c, 0xa5, 0x63, 0x11, 0x8b, 0xea, 0xf9, 0xda, 0xdc, 0xb4, 0xe2, 0x9d, 0xe0, 0x8c, 0x9a, 0x80, 0x4d, 0xc2, 0x4d, 0x62, 0xa5, 0x2d, 0x81, 0x3b, 0xe6, 0xfd, 0xa2, 0x61, 0x58, 0x26, 0x96, 0xda, 0x9e, 0x22, 0xa8, 0xb6, 0xa0, 0x05, 0x5d, 0x76, 0x48, 0x6c, 0xb4, 0x0e, 0xee, 0x63, 0x6d, 0x35, 0xcf, 0xba, 0x7b, 0x5d, 0x89, 0xe6, 0x5d, 0x0b, 0xd4, 0x5d, 0x06, 0xf0, 0xd8, 0xea, 0x7f, 0x1d, 0x99, 0x7b, 0x49, 0x7c, 0x08, 0x1c, 0xbc, 0x78, 0xf4, 0x31, 0xd8, 0xe0, 0x44, 0x38, 0xb1, 0x9d, 0x9a, 0xef, 0xce, 0x84, 0xef, 0x11, 0x1f, 0x81, 0x5b, 0xcf, 0xc0, 0xc0, 0x23, 0x19, 0xc1, 0xfc, 0xed, 0x55, 0xb1, 0x98, 0xbd, 0x07, 0x64, 0x82, 0xe9, 0xf4, 0xc4, 0x0c, 0x5d, 0xc6, 0x9f, 0x60, 0xc3, 0xb6, 0xa3, 0x0d, 0x97, 0x26, 0x35, 0x39, 0x39, 0x9f, 0xd0, 0xab, 0xba, 0xc5, 0x18, 0xaa, 0x36, 0xde, 0x92, 0xa6, 0xe8, 0x7a, 0x12, 0x65, 0xb6, 0x6b, 0x44, 0xcc, 0x8f, 0xa6, 0x86, 0xfa, 0x30, 0x93, 0x16, 0x37, 0x10, 0x4b, 0x03, 0x86, 0x30, 0xfe, 0xb8, 0xc0, 0x0d, 0x70, 0xd4, 0xfe, 0x0c, 0x1f, 0x6d, 0x21, 0x9f, 0xfa, 0x69, 0x6b, 0xc5, 0x83, 0xec, 0x4a, 0xad, 0x16, 0xf0, 0x0a, 0xb6, 0x03, 0x72, 0xcb, 0xce, 0x09, 0xb0, 0xb0, 0x9d, 0x71, 0x09, 0x30, 0x43, 0x83, 0xa7, 0xe3, 0xde, 0x0e, 0x2c, 0xb4, 0xef, 0xb8, 0x2c, 0x2a, 0x47, 0x68, 0x6a, 0x69, 0xed, 0x9b, 0x50, 0x74, 0x9f, 0x0e, 0x1e, 0xfe, 0x52, 0x4c, 0xd7, 0xe5, 0x5d, 0xa7, 0x87, 0x61, 0x8e, 0x1b, 0x0e, 0x63, 0xf4, 0xd5, 0xd5, 0xe7, 0xb7, 0xdb, 0x67, 0xcb, 0x35, 0x5b, 0x23, 0xbf, 0xac, 0xd5, 0xbe, 0xe0, 0xfb, 0x1a, 0xcd, 0xcb, 0xdd, 0x3b, 0xe9, 0x5e, 0xc3, 0x3e, 0xb3, 0xb1, 0xf3, 0xda, 0x4f, 0x70, 0x9f, 0x89, 0x7c, 0x1a, 0xc2, 0x38, 0x54, 0xea, 0xaf, 0x05, 0x9c, 0xc0, 0x98, 0x8f, 0x07, 0x85, 0x2d, 0x9c, 0x6c, 0x7d, 0xb2, 0x01, 0x63, 0x47, 0x29, 0xe0, 0xba, 0x46, 0x4e, 0x60, 0x51, 0x07, 0x8d, 0x4c, 0x35, 0x9a, 0x02, 0xd5, 0xea, 0xea, 0x6a, 0x5b, 0x4b, 0xd8, 0x8e, 0xa4, 0x21, 0xff, 0xb8, 0x76, 0xe8, 0x90, 0xdc, 0xdf, 0x1a, 0x31, 0x1b, 0xe9, 0xd3, 0xd2, 0xea, 0x8f, 0x5f, 0x26, 0x92, 0xd0, 0x24, 0xa3, 0x7d, 0xb7, 0x78, 0x87, 0x76, 0x53, 0x22, 0x09, 0xd2, 0x6a, 0x93, 0x4d, 0xf2, 0x58, 0x57, 0x8f, 0xd9, 0x1d, 0xf6, 0x48, 0xc7, 0x8f, 0x49, 0x9e, 0xdc, 0x9d, 0x33, 0x49, 0x90, 0x36, 0x76, 0xb9, 0xda, 0x4c, 0x4b, 0xe5, 0x32, 0xe4, 0x9b, 0x9a, 0xbf, 0x2a, 0xc7, 0xd9, 0x1e, 0xd7, 0xc8, 0x28, 0x47, 0xae, 0x89, 0x51, 0x74, 0xda, 0xc0, 0x1c, 0xfc, 0xca, 0x40, 0x3c, 0xef, 0x87, 0xc1, 0xdb, 0x5e, 0x34, 0x11, 0x6f, 0x40, 0xda, 0xb2, 0x77, 0xa2, 0x5c, 0x5a, 0x98, 0xe0, 0x05, 0x47, 0xb7, 0x7b, 0x80, 0x7b, 0xd4, 0xcb, 0xfe, 0xbf, 0xc2, 0x7b, 0xf4, 0xc1, 0x37, 0x77, 0xc0, 0x50, 0x34, 0x16, 0x22, 0x47, 0x2a, 0xbf, 0x3b, 0x02, 0xef, 0x63, 0xf4, 0xca, 0xdd, 0x2a, 0x4d, 0x13, 0x7c, 0x14, 0xfb, 0x44, 0xb3, 0x38, 0xf8, 0x01, 0xf4, 0x9e, 0xd0, 0xe8, 0x63, 0xe8, 0x09, 0x30, 0xe6, 0xd4, 0xe0, 0xf9, 0x13, 0xf5, 0x58, 0x72, 0x6b, 0xc1, 0x46, 0x82, 0xf1, 0xc9, 0x78, 0x25, 0x85, 0xdc, 0x1b, 0x8c, 0x70, 0xb6, 0x97, 0x89, 0xf4, 0x3d, 0x9c, 0xa5, 0xa9, 0x81, 0x40, 0x63, 0x2f, 0xcb, 0x4e, 0x2d, 0x86, 0x13, 0x86, 0xc7, 0x42, 0xd6, 0x0e, 0xf6, 0x42, 0x09, 0xc0, 0x49, 0xf8, 0xef, 0x80, 0x74, 0x5d, 0xbb, 0x50, 0xc6, 0x77, 0xc7, 0xa6, 0x1b, 0xa0, 0xfc, 0x2d, 0xb1, 0x76, 0x92, 0xa6, 0x47, 0x29, 0x4f, 0xc9, 0x97, 0x5f, 0x60, 0x0a, 0xcd, 0xa1, 0x97, 0x09, 0x31, 0x8c, 0xe4, 0x87, 0xda, 0x4e, 0xa5, 0x13, 0x5e, 0xe7, 0xf2, 0x53, 0xd1, 0x46, 0xc9, 0xcf, 0x94, 0xb5, 0x70, 0x87, 0x3f, 0xc3, 0x66, 0x84, 0x68, 0xd4, 0x61, 0xa1, 0x9a, 0x84, 0x6a, 0x6a, 0x5b, 0x41, 0x98, 0xde, 0x34, 0xc4, 0xed, 0x17, 0x0a, 0x44, 0xbe, 0x30, 0xd3, 0x13, 0xef, 0xf3, 0xee, 0xd5, 0x28, 0xf2, 0x7b, 0x87, 0x91, 0x2e, 0x20, 0x88, 0x36, 0xac, 0xf8, 0x07, 0x92, 0x38, 0x70, 0x29, 0x7f, 0xdc, 0x6a, 0x3d, 0x24, 0xc6, 0x4e, 0xbb, 0x60, 0xce, 0x08, 0xaa, 0xba, 0x76, 0x4c, 0x59, 0xbb, 0x53, 0xae, 0x9d, 0x36, 0x75, 0x50, 0xb3, 0x9f, 0x7b, 0x6b, 0x10, 0x75, 0x83, 0x0b, 0xb6, 0x80, 0x13, 0x77, 0x2b, 0xce, 0x8e, 0x3d, 0x71, 0x2c, 0x79, 0x1a, 0x05, 0xef, 0x7d, 0xa2, 0x90, 0x58, 0xf0, 0x07, 0xb4, 0xee, 0x81, 0x0c, 0xa6, 0x83, 0x8b, 0xa3, 0xce, 0x80, 0x0a, 0x05, 0x2e, 0xfe, 0xf4, 0x1e, 0x1f, 0x5b, 0x70, 0x64, 0x59, 0x29, 0x66, 0x8f, 0xde, 0x5a, 0x33, 0x20, 0x15, 0x40, 0xa4, 0x40, 0xb8, 0xfa, 0x8e, 0x36, 0xf4, 0x04, 0xb4, 0xda, 0xfa, 0x1d, 0xd1, 0x6e, 0x79, 0x3a, 0x03, 0x17, 0xc5, 0x6c, 0x5d, 0x4c, 0x85, 0x12, 0xef, 0x96, 0xe0, 0x14, 0x54, 0x78, 0xe8, 0xaf, 0x00, 0xeb, 0x9f, 0xad, 0xfe, 0x04, 0x20, 0xcd, 0xd6, 0x37, 0x3b, 0x9f, 0xf8, 0x72, 0x71, 0x60, 0x13, 0x98, 0xb3, 0xbf, 0xaf, 0x44, 0x8a, 0x87, 0x6c, 0x93, 0x77, 0xd1, 0xed, 0x5d, 0xed, 0x79, 0x13, 0x79, 0x19, 0x28, 0x22, 0xca, 0xf9, 0x16, 0x4d, 0xdf, 0xd7, 0xde, 0xc1, 0x9a, 0xe1, 0xf2, 0x9a, 0xd6, 0x58, 0x97, 0x60, 0x8a, 0x52, 0x33, 0xd7, 0x14, 0xa1, 0x01, 0xa0, 0xbc, 0xe9, 0xe0, 0x09, 0xd8, 0x06, 0xb1, 0x17, 0x81, 0xe0, 0x42, 0x00, 0x17, 0x48, 0x54, 0xb2, 0xc8, 0xd5, 0x6d, 0x16, 0x53, 0x60, 0x9d, 0x6b, 0x7d, 0xe4, 0x86, 0xc9, 0x33, 0x73, 0x71, 0xdc, 0x81, 0x2d, 0x1f, 0xcc, 0xfb, 0x3d, 0xdc, 0xb8, 0xea, 0xee, 0xcc, 0xcc, 0xc5, 0xba, 0xca, 0xeb, 0x66, 0x93, 0xe1, 0xa7, 0x61, 0x9b, 0x95, 0x06, 0x3f, 0x38, 0xe2, 0x4c, 0x2a, 0x4c, 0x1a, 0xed, 0x72, 0x26, 0xef, 0xa0, 0x2f, 0x3b, 0x6d, 0x7b, 0x8a, 0x4d, 0xea, 0xfe, 0x10, 0xe7, 0x69, 0x30, 0xd6, 0x0b, 0x86, 0xa0, 0x50, 0xe0, 0x63, 0x73, 0x8d, 0x61, 0x2f, 0xa9, 0xb9, 0x94, 0xb0, 0xda, 0x62, 0xa7, 0x40, 0xde, 0x76, 0xca, 0x1c, 0x17, 0xa6, 0x34, 0x89, 0x33, 0xa4, 0x02, 0xbb, 0x16, 0x72, 0x17, 0x4c, 0x6e, 0x8a, 0xb2, 0xad, 0x6a, 0x26, 0xfc, 0x78, 0x5f, 0x7d, 0xfe, 0x7c, 0xf9, 0x7a, 0xd8, 0x6c, 0x4b, 0x2c, 0x56, 0x06, 0x62, 0xbf, 0xf7, 0x88, 0x27, 0x79, 0xda, 0xc5, 0xf3, 0xe1, 0x58, 0xb4, 0x5a, 0x59, 0xf2, 0xed, 0x3e, 0x74, 0x5c, 0x26, 0xb5, 0x1c, 0x6e, 0xbe, 0xd5, 0x9c, 0x0b, 0xa0, 0x7d, 0x77, 0x4c, 0xc3, 0x29, 0x9a, 0xe1, 0x16, 0xa2, 0x55, 0x80, 0xb0, 0xde, 0x82, 0xa0, 0x97, 0xa8, 0x68, 0xb4, 0xe3, 0x35, 0x18, 0x8f, 0x2a, 0x44, 0xd3, 0x50, 0xc6, 0xae, 0x4b, 0x29, 0xd9, 0x95, 0xc1, 0x89, 0x29, 0xa5, 0x44, 0x2f, 0xa7, 0xdc, 0x5d, 0xbb, 0x48, 0x38, 0x1d, 0xef, 0x06, 0x31, 0xcc, 0x69, 0x7a, 0x3b, 0x65, 0x70, 0xa7, 0xe1, 0xed, 0x6e, 0x11, 0x4e, 0xb5, 0x3b, 0xeb, 0xe6, 0x67, 0x90, 0x50, 0xdd, 0xd8, 0x2e, 0xd3, 0xb0, 0x81, 0x33, 0x47, 0x76, 0xe6, 0x1c, 0x2c, 0x5d, 0xcd, 0xd1, 0x3f, 0x03, 0xdf, 0x15, 0x87, 0x4e, 0x7c, 0xb5, 0xfb, 0x61, 0x72, 0x31, 0x59, 0xf5, 0x0b, 0x10, 0xda, 0x92, 0x91, 0xe8, 0x43, 0x08, 0x1c, 0xac, 0x5b, 0x47, 0xa0, 0xf3, 0x17, 0xbf, 0xfe, 0x4d, 0x04, 0x30, 0x44, 0x8c, 0xaa, 0xb8, 0x96, 0xb4, 0xc9, 0x12, 0xc4, 0x29, 0x1d, 0xb0, 0x5e, 0xa5, 0xd0, 0x05, 0xd4, 0xdd, 0x0c, 0x89, 0x44, 0xd2, 0x57, 0x98, 0x92, 0x2e, 0xe8, 0xe1, 0x5a, 0x83, 0xb9, 0xc8, 0x5b, 0xa6, 0x04, 0x14, 0xc7, 0x46, 0xa3, 0x78, 0xb2, 0x5d, 0x36, 0xa1, 0x43, 0x62, 0x8f, 0x91, 0x4b, 0x56, 0xe8, 0x29, 0x15, 0xd3, 0x09, 0x2d, 0xe2, 0x5a, 0x7b, 0x17, 0x77, 0x03, 0xf8, 0x23, 0x8b, 0xee, 0xb9, 0x5f, 0x66, 0x20, 0x57, 0xc5, 0xa6, 0x69, 0xae, 0x27, 0x92, 0x54, 0x12, 0x21, 0xc8, 0xba, 0xa1, 0xca, 0x1b, 0x98, 0x84, 0xeb, 0x42, 0x9f, 0xdc, 0xd4, 0x29, 0x44, 0x2e, 0x36, 0x6d, 0xc1, 0xa3, 0x14, 0xa3, 0x1f, 0xdf, 0x82, 0x60, 0xae, 0x3c, 0xf1, 0xaf, 0x04, 0xd8, 0x5f, 0xb3, 0xb8, 0x2b, 0x21, 0xff, 0xb8, 0xc6, 0x7a, 0xf5, 0xf4, 0x07, 0xab, 0x25, 0x26, 0xd0, 0xf0, 0x0c, 0xd1, 0x30, 0x00, 0xe0, 0xa0, 0xa6, 0x59, 0x64, 0x34, 0x82, 0x7e, 0xa4, 0x91, 0xaf, 0x60, 0x82, 0xd6, 0x87, 0x53, 0x85, 0x6e, 0x1e, 0x1e, 0x1e, 0xb0, 0x37, 0x49, 0x58, 0xd1, 0x02, 0x06, 0x8a, 0x57, 0x50, 0xe0, 0x31, 0xd2, 0x70, 0x77, 0x89, 0x85, 0x62, 0x49, 0x4a, 0x09, 0xe0, 0xbd, 0x89, 0x56, 0xab, 0x01, 0x61, 0x3d, 0x3e, 0xa2, 0x4c, 0xb9, 0x51, 0x7b, 0x94, 0x0a, 0x18, 0x46, 0xcd, 0x77, 0x02, 0xa3, 0x14, 0x0c, 0x62, 0xa6, 0xe7, 0xe0, 0xec, 0x71, 0x07, 0xa0, 0xf0, 0x33, 0x6b, 0xbb, 0x38, 0x77, 0x27, 0x10, 0x8c, 0xc3, 0x69, 0x00, 0xe3, 0x62, 0xd0, 0x00, 0x82, 0xb8, 0x11, 0x8c, 0x3a, 0xfd, 0x46, 0xb0, 0xf0, 0xbc, 0xb2, 0x2a, 0x7c, 0x51, 0x73, 0x09, 0x28, 0xb7, 0xa4, 0x4a, 0x6e, 0x31, 0xf7, 0xa4, 0x8b, 0xe8, 0x07, 0xf7, 0x14, 0xe6, 0x2f, 0xeb, 0xd4, 0x81, 0x23, 0x78, 0xad, 0x5d, 0xbd, 0xd4, 0x46, 0x91, 0xc6, 0xc4, 0xb7, 0x1d, 0x10, 0xf8, 0x3d, 0x2c, 0x19, 0x07, 0xb8, 0x91, 0x07, 0x26, 0x11, 0x3d, 0xeb, 0xfc, 0x1e, 0xa4, 0x3c, 0xc3, 0xd0, 0xc9, 0xe1, 0xe9, 0xbf, 0x5d, 0x27, 0x6d, 0x8b, 0xd5, 0xe4, 0x1c, 0xe8, 0xef, 0x1f, 0x08, 0x31, 0xec, 0xab, 0x2f, 0xf0, 0xa8, 0x19, 0x09, 0x79, 0x3b, 0xe4, 0x2e, 0x6f, 0x77, 0xd0, 0xc8, 0x4f, 0xe4, 0x10, 0x9a, 0x73, 0x7d, 0x7d, 0x02, 0x9e, 0x37, 0x63, 0xc0, 0x3d, 0x22, 0xc4, 0xee, 0xa0, 0x4b, 0xe9, 0x68, 0x42, 0x5a, 0x4b, 0x28, 0x68, 0x31, 0x69, 0x8d, 0xa4, 0xb4, 0x80, 0x94, 0xd2, 0xca, 0x71, 0xfd, 0xc8, 0x68, 0xa7, 0xa7, 0xae, 0x6a, 0x26, 0xd7, 0xed, 0x05, 0xa7, 0xe0, 0xe4, 0xd1, 0x80, 0x2d, 0xb6, 0x79, 0x0e, 0x9d, 0x66, 0xfe, 0x89, 0x20, 0xcc, 0xfd, 0x86, 0x5f, 0x4d, 0xbe, 0x82, 0x76, 0x42, 0xc1, 0xbf, 0x58, 0x87, 0x37, 0x70, 0x97, 0xc7, 0x0d, 0x72, 0xbb, 0x8c, 0x2f, 0x90, 0x01, 0x78, 0x97, 0x74, 0x63, 0x0c, 0x54, 0x00, 0x12, 0x21, 0x22, 0x17, 0x3a, 0x7f, 0x85, 0x7f, 0x0a, 0x85, 0x62, 0x94, 0x0d, 0xcc, 0xc6, 0xa6, 0x3c, 0x87, 0xc1, 0x3c, 0x2e, 0xa4, 0x5f, 0x9d, 0x79, 0xdc, 0x4b, 0xa8, 0xe4, 0xf4, 0xc3, 0x3b, 0x78, 0xb6, 0x22, 0xcf, 0x7a, 0x09, 0xad, 0x69, 0x7d, 0x82, 0x4a, 0x33, 0xad, 0xe0, 0x5d, 0xd2, 0xe0, 0x4a, 0xea, 0x49, 0x43, 0xc4, 0xcb, 0x1c, 0x8e, 0x78, 0x06, 0xcb, 0x21, 0xb1, 0x63, 0x5f, 0x15, 0x64, 0x14, 0xa7, 0xff, 0x66, 0x80, 0xcf, 0x90, 0xe6, 0x6c, 0x9f, 0xe4, 0xa0, 0xa4, 0x98, 0xb9, 0x87, 0xbc, 0x82, 0xfd, 0xd7, 0xae, 0x8d, 0x55, 0xf7, 0x8c, 0x54, 0x20, 0x13, 0xdb, 0x13, 0x79, 0x40, 0x77, 0x67, 0x4b, 0xcc, 0xa2, 0x47, 0xb6, 0xda, 0xb1, 0xa4, 0xcf, 0xe4, 0xc6, 0x03, 0x06, 0xb3, 0x9f, 0x09, 0x80, 0x37, 0x3d, 0x07, 0xe0, 0xce, 0x54, 0xdd, 0xff, 0xa6, 0x38, 0x41, 0x1b, 0xca, 0xcd, 0x5a, 0x95, 0x23, 0x09, 0x92, 0x7c, 0x1e, 0xae, 0x61, 0x28, 0xd1, 0xc9, 0x2f, 0x41, 0xdc, 0x60, 0xfb, 0x15, 0xec, 0xac, 0x7b, 0x2e, 0x75, 0x5f, 0x34, 0xc7, 0xce, 0xac, 0x84, 0x7a, 0xe3, 0x4c, 0x20, 0x34, 0x79, 0x1c, 0xf5, 0x6c, 0x70, 0xb2, 0x28, 0x8b, 0xbf, 0xdd, 0x9d, 0x81, 0x3e, 0x79, 0x46, 0xca, 0x3d, 0xdd, 0xb4, 0x09, 0x70, 0x49, 0x16, 0x6e, 0x9f, 0x3e, 0x77, 0xb3, 0xd0, 0xe0, 0xfe, 0xdb, 0x7d, 0xe0, 0x0a, 0x1f, 0xbc, 0x24, 0x08, 0x78, 0xc8, 0xa9, 0x6e, 0xb4, 0x3d, 0x1f, 0xdc, 0x51, 0x5e, 0x7b, 0xa6, 0xde, 0x62, 0x17, 0xd1, 0x17, 0xba, 0x7d, 0x5c, 0xfd, 0xe7, 0xd8, 0x5c, 0x0f, 0x5b, 0xd0, 0x8d, 0x26, 0x97, 0x49, 0xe3, 0x5e, 0xe1, 0x21, 0x54, 0x90, 0x7a, 0xe7, 0x36, 0x4d, 0xd7, 0x5d, 0xc2, 0xc2, 0x3b, 0xaf, 0xa6, 0x63, 0x00, 0x25, 0x3e, 0x82, 0xb8, 0x55, 0x6c, 0xee, 0x81, 0x4c, 0x09, 0x22, 0x0f, 0x20, 0xd3, 0x3c, 0x16, 0xa4, 0x34, 0x5c, 0xaf, 0xb2, 0x71, 0x52, 0x3c, 0x22, 0x1f, 0x50, 0x08, 0x05, 0x09, 0x92, 0x0c, 0x14, 0xee, 0x84, 0x7f, 0x43, 0x69, 0x64, 0x69, 0xea, 0x99, 0xd5, 0x30, 0x6f, 0x1e, 0xee, 0x8c, 0x0f, 0x83, 0x2a, 0xba, 0x9a, 0x1b, 0xcc, 0x5e, 0x53, 0xe9, 0x05, 0xe7, 0x61, 0xb3, 0x02, 0x4c, 0x2f, 0x1f, 0xaa, 0xf5, 0x2a, 0x10, 0xc6, 0xb9, 0x76, 0x1b, 0xd8, 0x4d, 0xc4, 0x73, 0x74, 0x48, 0x0e, 0x64, 0x67, 0x45, 0x72, 0x23, 0xed, 0xd8, 0xe3, 0xb1, 0x43, 0xef, 0xd3, 0x2c, 0x78, 0x8b, 0x08, 0xb8, 0xdf, 0x13, 0xa0, 0x3f, 0x23, 0xe8, 0x9a, 0x2f, 0x5c, 0xf3, 0x72, 0xcd, 0x6f, 0x5a, 0x9c, 0xff, 0x2c, 0x50, 0x0e, 0x7f, 0xa3, 0x65, 0xc7, 0xc6, 0xa6, 0x09, 0xe8, 0x52, 0x83, 0xf0, 0x37, 0xe8, 0x3b, 0xeb, 0x7d, 0x03, 0x45, 0x2e, 0xbb, 0x45, 0xd4, 0xce, 0xff, 0xc0, 0xd0, 0x8a, 0x17, 0xfb, 0x43, 0xa6, 0xe1, 0x3f, 0x67, 0xaf, 0x39, 0x49, 0x98, 0xfa, 0x56, 0xb3, 0x70, 0xaa, 0xb6, 0xd4, 0x6a, 0x7f, 0xc8, 0x96, 0x6c, 0xd4, 0x3f, 0x66, 0xeb, 0x83, 0xdc, 0x15, 0x4c, 0x7d, 0xa5, 0x0e, 0xca, 0xfb, 0x2d, 0x8e, 0x7f, 0x4b, 0x85, 0x77, 0x55, 0x17, 0x14, 0x46, 0xc0, 0xa0, 0x40, 0x02, 0xb9, 0xf6, 0xe8, 0x2e, 0x68, 0x1a, 0x33, 0x41, 0x8d, 0xcf, 0xa9, 0xc7, 0xc4, 0x12, 0x1d, 0x6c, 0xb0, 0x69, 0xef, 0xa1, 0xcd, 0x10, 0x14, 0xfc, 0x20, 0x92, 0x1c, 0x07, 0xfb, 0x30, 0x83, 0x3d, 0x1b, 0xbb, 0x17, 0xbd, 0x30, 0xfe, 0x59, 0x04, 0x74, 0xfa, 0xc0, 0xd2, 0x96, 0x17, 0x55, 0xb5, 0x3a, 0x87, 0x2f, 0x00, 0x3f, 0x07, 0x14, 0xfd, 0x10, 0xe2, 0x28, 0xfb, 0xfa, 0x90, 0x4e, 0xbe, 0x8c, 0xb4, 0xb5, 0x86, 0xc4, 0x21, 0xbe, 0x5e, 0x54, 0xe3, 0xc9, 0xe9, 0x04, 0x3a, 0xab, 0x7b, 0xd4, 0xee, 0x69, 0x86, 0x3a, 0x4d, 0x1f, 0x17, 0xe3, 0x5c, 0x73, 0x88, 0x64, 0x9e, 0x83, 0x13, 0x99, 0x18, 0xc2, 0x83, 0x3f, 0xc3, 0xa0, 0x67, 0xb1, 0x25, 0x67, 0x7c, 0x84, 0x98, 0x4f, 0x10, 0x97, 0xd0, 0xaf, 0x72, 0x29, 0xc4, 0x87, 0xd6, 0xc1, 0x6d, 0x1a, 0xec, 0x65, 0xa4, 0x92, 0x50, 0xb3, 0xc3, 0x52, 0x0b, 0xa3, 0x52, 0x5b, 0xae, 0xf7, 0x1f, 0xa2, 0x12, 0x9a, 0x23, 0x20, 0x12, 0xb7, 0xdb, 0xa3, 0xe3, 0xcc, 0xa1, 0x07, 0xf5, 0xd6, 0xfa, 0x88, 0x5a, 0x7b, 0x7d, 0x78, 0xdc, 0xe2, 0x78, 0x8c, 0xe0, 0xe2, 0x22, 0x5a, 0x8a, 0xbd, 0xff, 0x4c, 0x47, 0x4b, 0x98, 0xce, 0x08, 0x09, 0xab, 0x39, 0x29, 0x00, 0x17, 0x21, 0xe1, 0x3c, 0x37, 0xcf, 0xd2, 0x74, 0x54, 0xc0, 0x40, 0xc8, 0x8c, 0xb4, 0x9e, 0x5f, 0xf9, 0xad, 0x16, 0xd5, 0xde, 0x3f, 0x10, 0x97, 0xf6, 0xb5, 0xae, 0xf4, 0x0f, 0x04, 0x1d, 0x6f, 0x8e, 0x48, 0xff, 0x40, 0x20, 0x45, 0x6d, 0xb2, 0xc1, 0xbe, 0x48, 0x43, 0x7d, 0x75, 0xd2, 0x5a, 0xb7, 0x78, 0xfb, 0x2f, 0xa4, 0xf6, 0xda, 0x35, 0xe1, 0x81, 0x01, 0xeb, 0xbf, 0x78, 0xc1, 0x44, 0x99, 0xb5, 0xdd, 0x7f, 0x21, 0x8d, 0xdc, 0x36, 0xe7, 0xfd, 0x17, 0xd2, 0xd4, 0x2d, 0x73, 0xde, 0x7f, 0x21, 0x4d, 0xae, 0x6d, 0xa4, 0xfe, 0x0b, 0x69, 0x70, 0x66, 0x81, 0xf5, 0x5f, 0xc8, 0x28, 0x67, 0x36, 0x12, 0x76, 0x73, 0x33, 0x26, 0xda, 0x48, 0xfd, 0x97, 0xd2, 0xcb, 0x87, 0x37, 0x52, 0xff, 0x25, 0x2f, 0x3a, 0x50, 0xf5, 0xfb, 0xbc, 0x8b, 0x4e, 0x1e, 0x69, 0x00, 0x5f, 0xa2, 0x46, 0x2c, 0xb0, 0x59, 0x10, 0x89, 0x90, 0x00, 0xc8, 0x40, 0x86, 0x51, 0x8b, 0x3c, 0xd3, 0xea, 0x8c, 0xea, 0x2a, 0x06, 0xc6, 0xa0, 0x8b, 0x7d, 0xb9, 0xdf, 0xd9, 0x5b, 0x00, 0xd2, 0x5e, 0xef, 0x9b, 0x69, 0x4b, 0x55, 0x0b, 0x17, 0x5b, 0xf8, 0x58, 0xb2, 0x9b, 0x66, 0xf0, 0x27, 0x9e, 0xb6, 0xfb, 0xce, 0x7b, 0x81, 0x86, 0x7b, 0x2b, 0xab, 0x22, 0x59, 0x85, 0x28, 0xf1, 0x6e, 0xa0, 0x5e, 0x14, 0x6c, 0x98, 0xc7, 0xbf, 0x50, 0xf1, 0xfc, 0x1a, 0x62, 0x68, 0xf4, 0x1c, 0xb0, 0xbf, 0x3b, 0x41, 0xbd, 0x51, 0xec, 0x27, 0xc6, 0x6e, 0x34, 0x76, 0xe3, 0x63, 0x61, 0xb7, 0x0a, 0x4e, 0x1d, 0x7b, 0xd3, 0xe2, 0xe2, 0x64, 0x5c, 0xfc, 0x7a, 0xb9, 0x3f, 0x5c, 0x48, 0x93, 0x11, 0x04, 0x85, 0xc3, 0x5f, 0x2f, 0xf1, 0xd9, 0x1f, 0x1e, 0xc0, 0xd0, 0x44, 0xd2, 0xa1, 0x98, 0x17, 0x43, 0x82, 0x91, 0x7a, 0xe7, 0x05, 0xbd, 0xe3, 0x37, 0x7a, 0x16, 0x15, 0xc4, 0xcd, 0x64, 0x6f, 0x6d, 0x98, 0xd1, 0xe7, 0x15, 0x94, 0x0e, 0xcc, 0xe6, 0x56, 0x7d, 0x6e, 0x1a, 0xce, 0xfe, 0xc2, 0xf4, 0xf0, 0x92, 0x1a, 0x4d, 0xcf, 0x22, 0x2b, 0xb7, 0xc6, 0xc1, 0xdc, 0xc5, 0xe0, 0x0a, 0x55, 0x9c, 0x76, 0xb9, 0x11, 0x6b, 0xb2, 0x16, 0x07, 0xbb, 0x6a, 0xdd, 0x0c, 0x20, 0xa5, 0xbd, 0x3b, 0x7b, 0xb6, 0xe8, 0x20, 0x9d, 0x1f, 0xa5, 0xce, 0x1e, 0x8d, 0xb1, 0xd9, 0xf8, 0xa8, 0x5a, 0x56, 0x34, 0x09, 0x94, 0xc4, 0xbd, 0x16, 0x4b, 0xaa, 0xd1, 0xd8, 0x33, 0x70, 0x53, 0x42, 0xf7, 0x0a, 0x33, 0xc7, 0xe8, 0x67, 0x10, 0xb4, 0xe0, 0x04, 0x32, 0xf4, 0xd9, 0x24, 0x08, 0x28, 0x55, 0x6a, 0x35, 0xeb, 0xff, 0xac, 0x0b, 0x40, 0x90, 0xd5, 0x64, 0x04, 0x2a, 0x85, 0xb9, 0xa6, 0x83, 0x3d, 0x28, 0x68, 0xc7, 0x20, 0x2b, 0x7e, 0x36, 0xfc, 0x09, 0x55, 0x46, 0x2f, 0x9f, 0xa8, 0xab, 0x0b, 0x66, 0x04, 0xaa, 0xa9, 0x60, 0x6a, 0x4b, 0xea, 0xa8, 0x7a, 0x9b, 0xbb, 0xd8, 0x17, 0x2b, 0x59, 0x23, 0x13, 0xca, 0xd8, 0x9b, 0x2c, 0x9c, 0xc4, 0x9d, 0x54, 0xeb, 0xd9, 0xf8, 0x9d, 0x8e, 0xde, 0x1f, 0x17, 0xbc, 0xaf, 0xaa, 0x52, 0x80, 0xb5, 0x38, 0xa9, 0x4c, 0xda, 0x1d, 0xd5, 0x58, 0x2b, 0xdc, 0x39, 0xf6, 0x34, 0x8b, 0x12, 0xb2, 0x82, 0x59, 0xa7, 0x0a, 0x1f, 0x79, 0x37, 0x8d, 0x41, 0x4e, 0x4d, 0x6f, 0x96, 0xb0, 0x37, 0xf5, 0x68, 0x4f, 0xb0, 0x31, 0xcb, 0xcd, 0x2f, 0xc1, 0xfb, 0xd6, 0x4f, 0x6e, 0xfa, 0x65, 0xea, 0x89, 0x8b, 0x7e, 0xde, 0xda, 0xea, 0x35, 0x30, 0x91, 0x41, 0xf9, 0x0a, 0x8e, 0x5b, 0x64, 0xa4, 0xa0, 0xc6, 0x0a, 0x68, 0xf6, 0x7e, 0x2d, 0x33, 0x08, 0x32, 0xaa, 0x4d, 0x19, 0x48, 0x47, 0x32, 0x6c, 0xb9, 0x68, 0x4c, 0x26, 0xa3, 0xa3, 0xdd, 0x22, 0x03, 0x19, 0x8f, 0x1e, 0x33, 0x27, 0x43, 0x99, 0x9f, 0xbe, 0x0f, 0xae, 0x61, 0x3a, 0x81, 0x90, 0xd2, 0xf6, 0xeb, 0x2d, 0xac, 0xb6, 0xcf, 0xab, 0x69, 0xdb, 0x5c, 0xfa, 0x31, 0xf0, 0x06, 0x7c, 0xb7, 0xcd, 0x6b, 0x6a, 0xe3, 0x3d, 0xc6, 0xc4, 0xa3, 0x19, 0x52, 0xf2, 0x85, 0x16, 0x14, 0x58, 0x88, 0xeb, 0x79, 0xa4, 0xa9, 0x2c, 0x9c, 0x44, 0x1f, 0xa2, 0x42, 0x75, 0xa4, 0xe4, 0x07, 0x37, 0xda, 0x91, 0xd7, 0xb7, 0x23, 0xf1, 0x6c, 0xff, 0x0b, 0xa4, 0xd7, 0xaf, 0x9f, 0x13, 0x5a, 0x76, 0x05, 0xb0, 0xe2, 0x75, 0xc3, 0xd7, 0x8d, 0xb9, 0xb5, 0xff, 0x05, 0xc6, 0xd2, 0x2d, 0xde, 0x84, 0xf4, 0x10, 0xa0, 0x29, 0xee, 0x60, 0x9b, 0x5e, 0x2e, 0x85, 0x35, 0x19, 0xe6, 0x54, 0x75, 0xbd, 0xc6, 0xe5, 0x31, 0x03, 0xbf, 0xe1, 0xdc, 0x4b, 0x4c, 0xfd, 0xd6, 0x2c, 0xfd, 0xc6, 0x32, 0xd7, 0x03, 0x38, 0xb9, 0xbb, 0xff, 0x76, 0x98, 0x8c, 0xd6, 0x50, 0xf8, 0xd2, 0x10, 0x29, 0xc5, 0x90, 0xfb, 0x89, 0x10, 0x75, 0xf2, 0x18, 0x65, 0x36, 0x8b, 0x18, 0x66, 0x1d, 0x9c, 0x28, 0xbd, 0x1b, 0x3d, 0x38, 0x05, 0xeb, 0x5e, 0x53, 0xfa, 0x79, 0x23, 0x22, 0xd0, 0x44, 0xd6, 0x97, 0x14, 0x93, 0x5e, 0xed, 0x8b, 0x87, 0x7f, 0xf9, 0xdd, 0x2c, 0x69, 0x65, 0xc3, 0xa1, 0xda, 0x90, 0x46, 0x74, 0xc0, 0x0f, 0xcf, 0x1e, 0xf6, 0x51, 0xb4, 0xda, 0xfb, 0xa6, 0x6d, 0x40, 0x90, 0x8c, 0x5f, 0xda, 0x49, 0xaf, 0x98, 0xcf, 0xa7, 0x1b, 0xf4, 0xc9, 0xe7, 0x48, 0x17, 0x6d, 0x26, 0x4f, 0x15, 0xf2, 0x08, 0x49, 0xfb, 0xcb, 0x78, 0x37, 0xca, 0x2d, 0x89, 0x5c, 0x1b, 0xd6, 0x39, 0x27, 0xb8, 0xf0, 0x93, 0x2b, 0x51, 0x5b, 0x94, 0xa8, 0x5c, 0x17, 0x65, 0xe0, 0xd6, 0x4f, 0xb0, 0xea, 0x22, 0x1e, 0x3d, 0xe0, 0x8e, 0xd0, 0xbe, 0x96, 0x42, 0xf2, 0x73, 0xb7, 0xe3, 0x1b, 0x88, 0xc2, 0xaa, 0xf0, 0x31, 0x28, 0x46, 0xbc, 0x24, 0x87, 0x4d, 0x12, 0x4b, 0xe8, 0x3a, 0xdb, 0xc3, 0xa9, 0x7f, 0x78, 0x31, 0x34, 0x1a, 0x7b, 0x3d, 0x8c, 0xdd, 0x19, 0x7a, 0x9f, 0x87, 0x02, 0xee, 0xa0, 0x8d, 0x1f, 0x73, 0x8e, 0xcb, 0xbb, 0x68, 0x29, 0x6d, 0xf7, 0x4c, 0x0d, 0x7f, 0x6a, 0xf5, 0x64, 0x16, 0xef, 0x14, 0x22, 0x20, 0x0f, 0x6b, 0xe6, 0x15, 0x01, 0x37, 0x55, 0x16, 0xa3, 0x76, 0x4b, 0xee, 0xc2, 0x52, 0x67, 0xa2, 0x43, 0x11, 0x49, 0xfb, 0x7a, 0x9a, 0x9f, 0x94, 0x7d, 0x2a, 0x9e, 0x8f, 0xbc, 0xaf, 0xbb, 0x53, 0x2a, 0x84, 0x41, 0x13, 0x68, 0xa5, 0xa3, 0x5c, 0xb2, 0x83, 0x6e, 0xcb, 0xb8, 0x20, 0x0e, 0xc0, 0x76, 0x47, 0x8d, 0x11, 0xca, 0xa0, 0x94, 0x33, 0x6a, 0x2d, 0x45, 0xe2, 0x09, 0x38, 0x1f, 0x1a, 0x2b, 0x85, 0x7e, 0xad, 0x1f, 0xbf, 0x4e, 0x28, 0xaa, 0x90, 0x01, 0x50, 0x35, 0xa6, 0xd5, 0x13, 0x2c, 0xe7, 0x08, 0x64, 0x05, 0x5a, 0x27, 0xc8, 0xd8, 0xe0, 0xb0, 0x57, 0x9e, 0x55, 0x0f, 0x13, 0xcb, 0x0d, 0x7e, 0x16, 0x24, 0xde, 0x9a, 0xac, 0x28, 0x87, 0xbe, 0x8c, 0xf3, 0x72, 0xf6, 0xa7, 0xf4, 0x8e, 0x0a, 0x02, 0x70, 0xa4, 0x50, 0x5b, 0xf7, 0x90, 0x45, 0xde, 0xf0, 0x3d, 0x6e, 0xaa, 0x40, 0xb3, 0x25, 0x8f, 0xd6, 0x49, 0x78, 0x43, 0xe0, 0x98, 0x76, 0x09, 0xbc, 0xd4, 0x8d, 0x37, 0x87, 0x23, 0x84, 0xdc, 0x5a, 0x7b, 0x67, 0x08, 0x04, 0xbd, 0x25, 0x9c, 0x15, 0xd7, 0x43, 0xf8, 0xe4, 0x18, 0xc3, 0xf8, 0x4f, 0xc6, 0x1b, 0xe6, 0xab, 0xaf, 0x41, 0x59, 0x39, 0x7b, 0x0d, 0x0e, 0x94, 0xdd, 0xef, 0xf5, 0xcd, 0x21, 0x92, 0x5d, 0x38, 0x7a, 0x4d, 0x16, 0xae, 0x40, 0x68, 0x03, 0x4f, 0x97, 0x84, 0x5c, 0xb2, 0x0e, 0xfa, 0x30, 0x0c, 0x21, 0x0e, 0x00, 0x49, 0x01, 0xe0, 0x81, 0x87, 0xf5, 0x84, 0xb7, 0xf7, 0xb3, 0xe9, 0x06, 0x21, 0x77, 0xf4, 0x09, 0xf2, 0xe4, 0x1a, 0x14, 0x9c, 0xfa, 0x8a, 0xc2, 0x92, 0xbb, 0x80, 0x1c, 0x32, 0x49, 0x2a, 0xf0, 0x09, 0x73, 0x42, 0x97, 0x97, 0xcb, 0xf3, 0x6a, 0x3d, 0x1d, 0xf3, 0xc0, 0x7b, 0xfa, 0xf4, 0x42, 0xe8, 0xdf, 0x6c, 0x53, 0x1b, 0xe3, 0x41, 0x83, 0xb5, 0xed, 0xeb, 0xdb, 0xdb, 0x73, 0x4a, 0x65, 0x25, 0xeb, 0x6e, 0xe2, 0x0f, 0x9c, 0x64, 0xd5, 0xc5, 0xde, 0x4c, 0xf7, 0xe1, 0xbc, 0x36, 0x1a, 0x93, 0x47, 0xec, 0x17, 0xa3, 0x4e, 0x85, 0xed, 0x02, 0x22, 0x16, 0xf0, 0x7d, 0x2a, 0x3e, 0x39, 0x20, 0x41, 0x5a, 0x62, 0x04, 0xcb, 0x61, 0x2c, 0x35, 0x7a, 0x4b, 0x01, 0x08, 0xc4, 0xa0, 0x74, 0x97, 0xc5, 0xad, 0xe8, 0x74, 0xaf, 0x0f, 0x11, 0x00, 0x50, 0xbe, 0x65, 0x2d, 0x5c, 0x5e, 0xa3, 0x06, 0xdc, 0x03, 0xb6, 0x45, 0x6f, 0x18, 0xbd, 0x3f, 0x3c, 0x13, 0x17, 0x8f, 0x80, 0x5f, 0x7e, 0xc5, 0x5d, 0x66, 0x16, 0xdc, 0x25, 0x0d, 0xbb, 0x4e, 0x88, 0x64, 0x5c, 0xd2, 0xb2, 0xeb, 0x84, 0x48, 0xc6, 0x83, 0x13, 0x02, 0x1d, 0x2b, 0x8f, 0x52, 0x3e, 0xa7, 0xdd, 0x47, 0xb6, 0x28, 0xe0, 0x94, 0x12, 0xc4, 0x56, 0xc4, 0x98, 0x0e, 0x44, 0xfb, 0x1a, 0x58, 0x2a, 0x90, 0x1c, 0xf4, 0xdc, 0x63, 0x23, 0x32, 0x74, 0xb8, 0x04, 0x59, 0x81, 0xb8, 0xf0, 0x58, 0x39, 0xc0, 0x83, 0xf0, 0xc3, 0x1b, 0x53, 0xb6, 0xcc, 0x3a, 0xea, 0x94, 0x81, 0x20, 0x79, 0x01, 0xfa, 0x7b, 0x38, 0xb9, 0x29, 0x00, 0x81, 0x88, 0xbc, 0xe4, 0xc5, 0x1a, 0xf3, 0x67, 0x03, 0xfc, 0x6a, 0x50, 0xdb, 0xfe, 0x9e, 0xb3, 0x01, 0x64, 0xc8, 0x54, 0x70, 0x3e, 0xd2, 0x26, 0xcb, 0xd0, 0x1e, 0x6b, 0xa8, 0x47, 0xff, 0xc5, 0x36, 0x3f, 0xab, 0x26, 0x33, 0xcf, 0x9b, 0xf2, 0x43, 0x6a, 0x62, 0xf9, 0x9b, 0x72, 0x51, 0x63, 0x84, 0x00, 0x48, 0xa9, 0x83, 0x21, 0x47, 0x66, 0xa7, 0xfd, 0x3f, 0xd9, 0x0d, 0xea, 0xee, 0x01, 0xdd, 0x34, 0x9b, 0xd6, 0x67, 0xd3, 0xea, 0xa4, 0x80, 0x75, 0x60, 0x04, 0xc5, 0x64, 0xf7, 0xba, 0xd1, 0xa0, 0x44, 0xcd, 0xcc, 0x9c, 0xba, 0xa6, 0xaa, 0x66, 0x41, 0xc3, 0xcc, 0x71, 0x0f, 0x6b, 0x58, 0x59, 0x62, 0x4f, 0xa8, 0x61, 0x4e, 0xe8, 0x06, 0x9e, 0x61, 0xa8, 0x62, 0x01, 0x6e, 0x4c, 0xaa, 0xfb, 0xe3, 0xfc, 0x9a, 0xd3, 0x97, 0x7a, 0xad, 0x97, 0xe6, 0xae, 0xc7, 0xf9, 0xe9, 0x41, 0x72, 0xc2, 0x75, 0x73, 0x46, 0x25, 0x72, 0xc3, 0x0d, 0xf9, 0x7d, 0x45, 0x0e, 0x22, 0x3f, 0x56, 0xe4, 0x40, 0x49, 0xe1, 0x00, 0xc9, 0xa0, 0x70, 0x83, 0x6f, 0xd4, 0xda, 0x69, 0x89, 0xd6, 0x2b, 0xc9, 0x0f, 0x8b, 0x09, 0x44, 0xca, 0xc5, 0x41, 0xf7, 0xaa, 0xbd, 0xb7, 0xf3, 0x7c, 0x8f, 0xb6, 0x76, 0x99, 0xb9, 0x58, 0x2c, 0x0a, 0xe2, 0x40, 0x41, 0x4a, 0xcb, 0x39, 0x62, 0xaa, 0x7b, 0xf6, 0xa2, 0x44, 0xeb, 0xca, 0xf9, 0xf2, 0x82, 0x79, 0x65, 0xf4, 0x12, 0x6d, 0x81, 0xb6, 0x33, 0x25, 0x9b, 0x9d, 0x57, 0x4d, 0x2a, 0xb9, 0x4b, 0xb9, 0x5e, 0x6e, 0x33, 0x14, 0x3c, 0xa6, 0x3a, 0x35, 0x84, 0xff, 0x98, 0x0d, 0xfa, 0xca, 0x47, 0x63, 0xd8, 0xb9, 0xf5, 0xf3, 0xba, 0x70, 0x45, 0x00, 0x07, 0x77, 0xb2, 0xda, 0x89, 0x46, 0x26, 0x44, 0x08, 0xe6, 0x47, 0xab, 0x63, 0xf9, 0x51, 0xe6, 0x3c, 0x84, 0xbd, 0xf9, 0x32, 0x04, 0xb7, 0x05, 0xea, 0xba, 0xf0, 0x57, 0x4c, 0x2f, 0x49, 0x26, 0xbc, 0x40, 0x59, 0xf0, 0xee, 0x8d, 0x9d, 0x93, 0xf0, 0xa1, 0x45, 0x47, 0x21, 0x1c, 0xc5, 0xd3, 0xd3, 0x7f, 0xc6, 0x61, 0x3c, 0x85, 0x68, 0xd9, 0x97, 0x8c, 0x23, 0xf2, 0x65, 0x06, 0x52, 0xb2, 0x6e, 0x1b, 0x44, 0x6d, 0xc4, 0xa9, 0xb3, 0x04, 0xb0, 0x62, 0x59, 0xb0, 0x48, 0x20, 0x3d, 0x6e, 0x9f, 0x0e, 0x65, 0x74, 0x6d, 0x35, 0x52, 0xdf, 0x07, 0x76, 0xa8, 0x19, 0x62, 0x8e, 0xdd, 0x4f, 0xe1, 0xd8, 0x5d, 0xaf, 0xef, 0xb0, 0x3b, 0x2d, 0xda, 0xb0, 0xf5, 0x21, 0x87, 0xe7, 0x2c, 0xdf, 0x0e, 0x71, 0x12, 0x73, 0xb2, 0x86, 0x41, 0xec, 0x06, 0xee, 0x5d, 0x30, 0x32, 0x38, 0xbe, 0xff, 0x16, 0xc6, 0x23, 0x00, 0xf2, 0xc1, 0x50, 0xb5, 0x53, 0xc3, 0x02, 0x34, 0x91, 0x18, 0xdf, 0xa2, 0x61, 0x42, 0xb1, 0x9e, 0x62, 0xcf, 0x51, 0x94, 0x37, 0x32, 0x6a, 0xd1, 0xde, 0x32, 0x61, 0x48, 0xa2, 0x36, 0x4a, 0x2d, 0x5e, 0x6d, 0x11, 0x4a, 0xa4, 0x6d, 0x38, 0xd1, 0xd4, 0x8f, 0x35, 0xb8, 0x18, 0x90, 0xa4, 0x08, 0x2a, 0x5d, 0x5b, 0x34, 0xbd, 0x68, 0xa4, 0x2f, 0x75, 0x3a, 0x87, 0x84, 0xb5, 0x10, 0xaa, 0x5e, 0x4e, 0x2b, 0x1c, 0x5b, 0x2c, 0xc4, 0x9e, 0x10, 0x96, 0x18, 0x19, 0xcb, 0x5e, 0x6e, 0x92, 0x14, 0x1c, 0xba, 0x9c, 0x19, 0xb2, 0x7b, 0x73, 0xc6, 0x09, 0xa5, 0x00, 0x9a, 0x64, 0x88, 0x0f, 0x9b, 0x60, 0xf8, 0x27, 0xc0, 0xa6, 0x48, 0x3e, 0x73, 0xf7, 0x60, 0x50, 0xc2, 0x08, 0xdc, 0xa0, 0xdc, 0xdd, 0xed, 0xa4, 0x09, 0xc8, 0xeb, 0x14, 0xf9, 0x25, 0xe0, 0xe7, 0xf1, 0xd4, 0x67, 0x5d, 0x81, 0x67, 0xc4, 0x84, 0x64, 0x95, 0x47, 0x62, 0x42, 0xd0, 0xbd, 0xcc, 0xe5, 0xc4, 0x40, 0x75, 0xfa, 0xf9, 0x38, 0xd6, 0x86, 0xdd, 0xff, 0xc6, 0xd6, 0x21, 0x3a, 0x10, 0xbd, 0x21, 0x4e, 0x57, 0x6a, 0x14, 0x9d, 0x06, 0x40, 0x74, 0xda, 0xf5, 0x47, 0x1c, 0xca, 0x3b, 0x6a, 0x3f, 0x7a, 0x11, 0x1f, 0x90, 0x41, 0x10, 0x27, 0x73, 0x3e, 0x3e, 0xe4, 0x7e, 0x3c, 0xeb, 0x69, 0x3c, 0x78, 0x14, 0xe7, 0x71, 0xf9, 0x90, 0x3a, 0x59, 0x9e, 0x7f, 0xbd, 0xcd, 0xa5, 0xb6, 0x13, 0x7d, 0xf6, 0x37, 0x26, 0x51, 0x07, 0xf8, 0x76, 0x36, 0x4e, 0x49, 0xf8, 0x10, 0x3a, 0x8b, 0xcf, 0xca, 0xda, 0x01, 0x67, 0x47, 0x65, 0x7a, 0xc0, 0xd9, 0x49, 0xe9, 0x8e, 0x46, 0x3b, 0x29, 0x23, 0xb9, 0x1a, 0x3b, 0x2c, 0x6b, 0x07, 0xac, 0x1d, 0x96, 0xf5, 0xd3, 0x38, 0x26, 0x61, 0xc4, 0x32, 0x38, 0xf4, 0x61, 0x17, 0xeb, 0xed, 0xe0, 0xe6, 0xd2, 0xf0, 0xea, 0x28, 0x26, 0x89, 0x9c, 0xfe, 0x47, 0xca, 0x56, 0xcc, 0x2c, 0x34, 0x78, 0xb6, 0x28, 0xa6, 0x57, 0xc5, 0x66, 0x79, 0x3b, 0x43, 0xca, 0xc5, 0x2d, 0xd9, 0x21, 0xc1, 0xb9, 0x45, 0x5d, 0x71, 0xa5, 0x56, 0x9c, 0xd3, 0x5d, 0xa1, 0x99, 0xb5, 0x9c, 0x9e, 0x4b, 0x3d, 0xf9, 0x21, 0x04, 0xc7, 0x58, 0x17, 0x84, 0x68, 0xa4, 0x36, 0x88, 0x13, 0x36, 0x75, 0x59, 0xd2, 0x4c, 0xe0, 0x69, 0x46, 0xdd, 0xc9, 0x4f, 0x57, 0xd2, 0x2d, 0x5b, 0x02, 0xdb, 0x4b, 0x14, 0xa9, 0x21, 0xad, 0x9e, 0xd7, 0x2e, 0x93, 0x65, 0x70, 0x2d, 0x23, 0x59, 0xe1, 0x50, 0x4e, 0x01, 0x65, 0x14, 0x44, 0x8b, 0xa2, 0xd3, 0x17, 0xcd, 0x5e, 0xa0, 0xa9, 0x0e, 0x7a, 0x14, 0xcb, 0xa5, 0xa0, 0x98, 0x7b, 0x7f, 0x15, 0x08, 0xda, 0x96, 0x2b, 0xc1, 0xad, 0xb8, 0x0c, 0x09, 0x06, 0x43, 0xc4, 0x15, 0x90, 0x68, 0x02, 0xc0, 0x62, 0xdc, 0xfb, 0x0f, 0xb7, 0xb7, 0x18, 0xf2, 0x44, 0xaf, 0xe5, 0x56, 0x32, 0x77, 0x9e, 0xb5, 0x49, 0x5e, 0x31, 0x67, 0xb6, 0x7b, 0xb8, 0xa4, 0x44, 0xd9, 0x6f, 0x6f, 0xe1, 0xf1, 0xdf, 0x61, 0x41, 0x4e, 0xe2, 0x07, 0x97, 0x41, 0xff, 0xc2, 0xeb, 0xce, 0x7c, 0x8d, 0x9b, 0xb0, 0x2c, 0x82, 0x2e, 0xf1, 0x23, 0x5c, 0x85, 0x8a, 0xee, 0x91, 0x20, 0x4b, 0xf8, 0x8c, 0x27, 0xb2, 0x7c, 0x87, 0xab, 0xc5, 0x1a, 0xfa, 0x20, 0xf9, 0xe0, 0x9d, 0x67, 0x2d, 0xd4, 0xd4, 0xec, 0x77, 0xe7, 0xce, 0xcb, 0x21, 0x9d, 0xc2, 0xf6, 0x99, 0x52, 0x81, 0x4c, 0xf6, 0x40, 0x6e, 0xfa, 0x2d, 0x45, 0xb0, 0x61, 0xf9, 0xec, 0x12, 0xc0, 0xf0, 0x52, 0xf4, 0x79, 0xe5, 0x78, 0xbf, 0x74, 0xc7, 0x3b, 0x4e, 0xbb, 0xa3, 0x4b, 0xb8, 0xd3, 0x8c, 0x51, 0x7c, 0x5c, 0x77, 0x3a, 0x77, 0x15, 0x0f, 0x4a, 0xe5, 0x2f, 0x89, 0xa8, 0x92, 0x1a, 0x04, 0xc9, 0x83, 0x60, 0xc0, 0xd9, 0x57, 0x44, 0x0a, 0x9b, 0x62, 0xf2, 0xa5, 0xab, 0x67, 0x36, 0x98, 0xe1, 0x10, 0xa9, 0x01, 0x62, 0x93, 0x58, 0x55, 0xaf, 0xf7, 0x6e, 0x1c, 0xd5, 0xad, 0x9f, 0x97, 0x5b, 0x77, 0x03, 0x09, 0x83, 0x87, 0x21, 0xdc, 0x2b, 0x35, 0x04, 0xfd, 0x20, 0x59, 0x1a, 0xde, 0xd6, 0xd4, 0x16, 0xf0, 0x41, 0xda, 0xd9, 0x6f, 0x02, 0x93, 0x79, 0xc8, 0x98, 0xd7, 0xcf, 0x0d, 0xf0, 0xb2, 0xae, 0xb3, 0x4b, 0xf8, 0xf9, 0xb9, 0x8a, 0x46, 0x41, 0x4f, 0x93, 0x2c, 0x15, 0x4f, 0xa9, 0x68, 0x43, 0x8c, 0xff, 0x89, 0x98, 0xa9, 0x26, 0x31, 0x80, 0x78, 0xdf, 0x13, 0x5c, 0x39, 0x42, 0x40, 0x04, 0x2e, 0x9b, 0xd4, 0xdb, 0xac, 0x6c, 0x4f, 0x4d, 0xf6, 0x50, 0x2f, 0xbc, 0x02, 0x39, 0xc5, 0x36, 0xa3, 0xf8, 0x78, 0xa0, 0x65, 0x9e, 0xd3, 0x53, 0xfc, 0xd6, 0xa4, 0xd1, 0xb7, 0x89, 0x6b, 0x7b, 0x9a, 0xc6, 0x16, 0x3d, 0x18, 0x21, 0x3a, 0xca, 0x0a, 0xd3, 0x62, 0xd1, 0x06, 0xc1, 0x66, 0xcc, 0xcd, 0xcb, 0x60, 0x79, 0x68, 0xfe, 0x41, 0xc0, 0x6d, 0xbc, 0x76, 0xc6, 0x72, 0xc5, 0xe3, 0x07, 0x02, 0x36, 0x6a, 0x0c, 0x17, 0xef, 0x89, 0x41, 0x39, 0xb0, 0xeb, 0xa0, 0x0c, 0x52, 0xb7, 0x43, 0x87, 0xd0, 0x4d, 0xb7, 0x25, 0xe6, 0x95, 0xe8, 0x62, 0x07, 0xba, 0x73, 0xce, 0x28, 0xaf, 0xcf, 0x67, 0x36, 0x66, 0xbb, 0x2d, 0xb5, 0xb6, 0x14, 0x92, 0x99, 0xf5, 0xa5, 0xd4, 0x06, 0x2f, 0x6e, 0xde, 0xd6, 0x34, 0x6d, 0x8f, 0x6b, 0x85, 0xaf, 0x99, 0xbc, 0x0d, 0x31, 0xb4, 0x44, 0x37, 0xb2, 0xf1, 0x35, 0x2a, 0x55, 0xc8, 0xf1, 0x3b, 0x59, 0xf5, 0xf4, 0x8a, 0x7b, 0xf4, 0xf4, 0x2c, 0x2e, 0xd6, 0xd3, 0xf3, 0x1c, 0x1b, 0x8c, 0xdb, 0x36, 0x01, 0x6f, 0x68, 0xd9, 0xd1, 0x3f, 0x91, 0xc6, 0x8a, 0xb8, 0x8f, 0xbb, 0x26, 0xdb, 0x5c, 0x22, 0xc1, 0xb0, 0xa0, 0x2e, 0x9e, 0x9f, 0x5e, 0xe2, 0xf1, 0xa6, 0x83, 0x10, 0xdb, 0xdc, 0xb8, 0x67, 0xaa, 0x1d, 0xc5, 0x4a, 0xc8, 0xca, 0x4a, 0xb3, 0x12, 0xd7, 0x85, 0x29, 0xd1, 0x0a, 0x87, 0xee, 0xcd, 0x98, 0xf4, 0x76, 0x58, 0xd6, 0x81, 0x3e, 0xce, 0x39, 0xac, 0x67, 0xab, 0x4c, 0x8c, 0xd2, 0xa3, 0x84, 0x68, 0xef, 0xe9, 0x54, 0x42, 0xe1, 0x0a, 0x8c, 0x36, 0x5d, 0x48, 0x70, 0xd6, 0x26, 0x3a, 0x53, 0x61, 0x69, 0x05, 0x1f, 0xb8, 0xaa, 0xb7, 0x53, 0x1b, 0xc1, 0x44, 0x61, 0xc7, 0x8d, 0x60, 0xa2, 0xa9, 0x53, 0xc0, 0x39, 0x2c, 0x48, 0x8b, 0x0f, 0xda, 0x7a, 0x40, 0x32, 0xc8, 0x4c, 0x9d, 0x8a, 0x8f, 0x22, 0x51, 0xc7, 0xd2, 0x3e, 0xfb, 0xce, 0xc3, 0x8c, 0x24, 0x0a, 0x0a, 0x33, 0x72, 0xca, 0x67, 0x19, 0xce, 0x74, 0xbc, 0x1a, 0xc3, 0x8f, 0x5c, 0x90, 0x70, 0x95, 0x51, 0x57, 0xfe, 0x13, 0x0a, 0x0b, 0x14, 0xba, 0xfa, 0x08, 0x90, 0xda, 0xe4, 0x53, 0x81, 0xca, 0xd3, 0x88, 0x07, 0x0d, 0x2a, 0xc4, 0x63, 0xc8, 0x91, 0x28, 0xcd, 0x81, 0x90, 0x46, 0x1a, 0xad, 0x4e, 0x88, 0x81, 0xee, 0x72, 0x87, 0x73, 0xd5, 0xcf, 0xc5, 0x10, 0xb0, 0x46, 0x93, 0x03, 0xec, 0xb8, 0xd4, 0x84, 0x37, 0x56, 0x86, 0x4d, 0x65, 0x77, 0x04, 0x24, 0x37, 0x26, 0x7c, 0x25, 0x6b, 0x27, 0x3d, 0x38, 0x6a, 0xf3, 0x94, 0x9c, 0x18, 0x6e, 0x9e, 0xc2, 0x51, 0xc1, 0x75, 0x05, 0x2b, 0x9d, 0xd4, 0x98, 0xa3, 0x10, 0x22, 0xa9, 0x59, 0xb4, 0xac, 0x14, 0xd3, 0xd1, 0x10, 0xe4, 0x09, 0x68, 0x43, 0x1a, 0x12, 0x86, 0x36, 0xa4, 0xf5, 0xea, 0x00, 0xcf, 0xd6, 0x44, 0x92, 0xc8, 0x58, 0xd2, 0x70, 0xe2, 0xdd, 0x02, 0x99, 0xb5, 0xf5, 0x2d, 0x26, 0x50, 0xe2, 0x95, 0x0e, 0x8f, 0xb3, 0x89, 0xad, 0x9d, 0x98, 0x6a, 0x5b, 0xe7, 0x21, 0x08, 0xe2, 0x02, 0xf3, 0x17, 0x8e, 0x5a, 0x08, 0xee, 0x5b, 0xe4, 0xda, 0xbf, 0xa3, 0x4c, 0xbd, 0x08, 0xf6, 0xb9, 0x78, 0x07, 0x09, 0xdd, 0x08, 0x86, 0xf5, 0xe2, 0x06, 0xd5, 0xd3, 0x84, 0x29, 0x4b, 0x96, 0xd2, 0x84, 0x61, 0x7a, 0x18, 0x0c, 0x5a, 0x0f, 0xa5, 0xc9, 0x4a, 0xe1, 0x3d, 0x22, 0x26, 0x45, 0xf2, 0x52, 0xe5, 0xb8, 0x0c, 0xb8, 0xfe, 0xf8, 0x0e, 0xe8, 0xce, 0x4a, 0x1a, 0x69, 0x04, 0xce, 0xd0, 0x02, 0x52, 0x60, 0x81, 0xde, 0x49, 0x15, 0x24, 0x64, 0x02, 0x5f, 0xe8, 0x2a, 0x83, 0xe5, 0xf1, 0x26, 0x5e, 0x14, 0x36, 0x24, 0x46, 0x25, 0x67, 0x67, 0xdf, 0xf9, 0x42, 0x30, 0xd1, 0xbe, 0xf8, 0x3a, 0x89, 0x5c, 0xbb, 0x9d, 0x8c, 0x7a, 0x9d, 0x1c, 0x1b, 0xc6, 0xad, 0xc9, 0x55, 0xc9, 0x8c, 0x56, 0x67, 0x00, 0x26, 0x46, 0x4c, 0x1a, 0xa7, 0x82, 0x49, 0x49, 0x05, 0x93, 0xd9, 0xea, 0x8f, 0x48, 0xaa, 0x6b, 0x7f, 0x5f, 0xdd, 0xa9, 0x26, 0x63, 0x00, 0xeb, 0x10, 0x38, 0x1f, 0xb7, 0xac, 0xef, 0xed, 0x7c, 0x15, 0x12, 0x5b, 0x6a, 0x2b, 0x3f, 0xf1, 0x49, 0xef, 0x56, 0x7e, 0xea, 0x8b, 0x1e, 0x64, 0xe8, 0x07, 0xa1, 0x13, 0xbc, 0x73, 0x63, 0x69, 0x73, 0x03, 0x43, 0x82, 0xd5, 0xa4, 0x11, 0x6e, 0xa4, 0x5a, 0x8e, 0x98, 0xe3, 0x22, 0xa0, 0xc7, 0xca, 0x33, 0x52, 0xf0, 0xfe, 0xcb, 0xa7, 0xed, 0x3d, 0xc8, 0x1a, 0xb4, 0xc5, 0xc4, 0x29, 0x04, 0xa6, 0x75, 0x90, 0x7b, 0x3b, 0x13, 0x77, 0x45, 0xf0, 0x3c, 0x07, 0x17, 0x1b, 0x56, 0x9a, 0xea, 0x96, 0x99, 0x8e, 0x2a, 0x58, 0xec, 0x75, 0xb1, 0xce, 0x9c, 0x7e, 0x81, 0x50, 0xd0, 0xa0, 0x1c, 0xa8, 0x6d, 0x4c, 0x2e, 0x33, 0x95, 0xf8, 0x01, 0xb3, 0x40, 0xa2, 0x1c, 0x0f, 0x03, 0x4b, 0x94, 0xd2, 0xec, 0x0f, 0xca, 0x1f, 0x47, 0x7b, 0xcf, 0x2c, 0x7c, 0x07, 0xe3, 0xac, 0xa9, 0x51, 0x56, 0x1e, 0x3f, 0x35, 0x10, 0x4e, 0xbe, 0x54, 0x08, 0x74, 0x4d, 0x92, 0x2b, 0x7c, 0xbc, 0xf5, 0x6e, 0x40, 0xdf, 0x0b, 0xc9, 0x6c, 0x21, 0x99, 0x94, 0x73, 0xda, 0xc0, 0xd4, 0x83, 0x2c, 0x36, 0x84, 0x5c, 0x42, 0xf2, 0x89, 0x1c, 0x03, 0x72, 0x4b, 0xaa, 0x1c, 0x03, 0x14, 0xf7, 0x43, 0xbf, 0xe1, 0xb6, 0x94, 0x2a, 0x4e, 0x44, 0x71, 0xc9, 0x99, 0x81, 0x59, 0x9a, 0x4a, 0x19, 0xd3, 0x52, 0x1f, 0x4d, 0xb6, 0xcb, 0x36, 0xfd, 0xe5, 0x53, 0x2c, 0x79, 0x08, 0x7a, 0xd9, 0xc3, 0xb6, 0xdf, 0x22, 0xb5, 0xa0, 0x04, 0xd5, 0xec, 0x7f, 0x75, 0x40, 0x04, 0xf9, 0xf3, 0x54, 0x74, 0x22, 0x04, 0x59, 0x4c, 0x21, 0xc6, 0xa6, 0x28, 0x48, 0xfc, 0x5b, 0x56, 0xd3, 0x4b, 0xb1, 0xe1, 0xfa, 0xc3, 0xe4, 0x6f, 0x10, 0xf5, 0xc8, 0x48, 0x72, 0x77, 0xb1, 0xfe, 0x68, 0xdd, 0x6f, 0xd3, 0x2d, 0x8f, 0x89, 0xd3, 0x3d, 0x26, 0xcf, 0xe7, 0x78, 0x03, 0x68, 0x28, 0xb7, 0x02, 0xa1, 0xce, 0x5a, 0x7a, 0x33, 0xd4, 0xdd, 0x44, 0x84, 0xa5, 0xb7, 0xde, 0xa0, 0x9b, 0xd5, 0xcb, 0x46, 0x99, 0xc0, 0x81, 0x07, 0xf2, 0x59, 0xa8, 0x4b, 0xc4, 0xd3, 0xe1, 0x65, 0xfe, 0x48, 0xa9, 0x69, 0x4f, 0x53, 0xdb, 0x3b, 0x2a, 0x17, 0x1d, 0x20, 0x4b, 0x40, 0xc7, 0x92, 0xee, 0x7b, 0x23, 0xdc, 0x9b, 0x7f, 0xe0, 0x73, 0xaa, 0x6b, 0x3d, 0x1a, 0x19, 0x88, 0xd0, 0x70, 0xb2, 0x85, 0x4a, 0xc3, 0x91, 0x11, 0x17, 0x63, 0xe4, 0x10, 0x11, 0x14, 0xcc, 0xda, 0xe5, 0x6c, 0x1f, 0xec, 0xc2, 0xd0, 0xa1, 0x1a, 0x43, 0xf5, 0x78, 0x32, 0xfd, 0xba, 0x08, 0x5a, 0xed, 0x0b, 0x91, 0x64, 0x66, 0x76, 0xf5, 0x61, 0x2c, 0xbb, 0x92, 0xb1, 0xc8, 0x8e, 0x42, 0x8a, 0x18, 0x35, 0x40, 0x19, 0x51, 0x55, 0x85, 0x27, 0xe2, 0x09, 0x28, 0xf2, 0x02, 0xf0, 0xc4, 0x5b, 0x23, 0x9f, 0x98, 0x6b, 0x48, 0xb0, 0x42, 0x97, 0xe4, 0xec, 0x22, 0xf1, 0x2f, 0x9f, 0x68, 0x64, 0x1e, 0x6c, 0x36, 0x88, 0x78, 0x83, 0xc5, 0x76, 0x97, 0x18, 0x78, 0xa6, 0x59, 0x28, 0xe8, 0x1d, 0x88, 0x91, 0x49, 0x37, 0x85, 0x60, 0x86, 0x16, 0xa2, 0x18, 0xf3, 0x64, 0x14, 0x8a, 0x15, 0x24, 0x46, 0x94, 0x26, 0x14, 0x8d, 0xf1, 0xa8, 0x8a, 0x19, 0x31, 0x18, 0x81, 0xe6, 0x54, 0xa0, 0x8e, 0x35, 0x7e, 0x37, 0xc0, 0x52, 0x1b, 0x68, 0xa3, 0xaf, 0x61, 0x00, 0x65, 0x28, 0xdc, 0x55, 0xc0, 0xc9, 0x86, 0x36, 0x14, 0x1f, 0x0e, 0xdb, 0x39, 0x27, 0xa5, 0xf4, 0x3f, 0x39, 0xd5, 0x89, 0xd8, 0x75, 0xde, 0x02, 0x50, 0x01, 0x75, 0x0a, 0xaf, 0x9f, 0xab, 0x7f, 0x00, 0xaf, 0x91, 0x55, 0xcb, 0xb8, 0x41, 0x46, 0x9d, 0x1b, 0xe4, 0x34, 0x9b, 0xb7, 0x68, 0x15, 0xb3, 0x6e, 0x90, 0x55, 0x6f, 0x43, 0x5b, 0x2a, 0xd5, 0x15, 0x50, 0xab, 0x50, 0xac, 0x8b, 0xdd, 0x5f, 0xa7, 0x2d, 0x8a, 0x7a, 0x7d, 0xb4, 0x3d, 0x66, 0x35, 0x72, 0xec, 0x20, 0x71, 0xb6, 0xcb, 0x51, 0x92, 0x61, 0x5c, 0xe3, 0x91, 0xbc, 0x4e, 0x87, 0xe9, 0x45, 0xb8, 0x21, 0x08, 0x4b, 0x30, 0x76, 0x1c, 0x21, 0x88, 0x08, 0x58, 0x47, 0xa3, 0xde, 0x06, 0x1a, 0x30, 0x06, 0x27, 0x9d, 0x7f, 0xa8, 0x27, 0xc6, 0x2a, 0xe7, 0x31, 0x63, 0x76, 0xb8, 0xbe, 0x83, 0xaa, 0x76, 0x38, 0x5e, 0xb2, 0xcb, 0x4e, 0xf0, 0x10, 0x2e, 0x36, 0x65, 0x27, 0xcb, 0xbe, 0xb3, 0x75, 0x26, 0xb7, 0x23, 0xb1, 0xaa, 0xcd, 0xcb, 0x91, 0xdb, 0x8c, 0x26, 0x2e, 0x11, 0x6d, 0x46, 0x91, 0xbd, 0x91, 0x30, 0x7f, 0xe1, 0x37, 0x75, 0x36, 0x0a, 0x21, 0x00, 0x07, 0x27, 0x1e, 0xbe, 0xb0, 0xe6, 0xe3, 0x36, 0xe2, 0x1f, 0xdd, 0xfe, 0xe5, 0x2d, 0x01, 0x7c, 0x8d, 0x6b, 0xca, 0xd8, 0xca, 0xd3, 0x06, 0x20, 0xce, 0x85, 0x51, 0x0e, 0x4c, 0xc3, 0x78, 0x1b, 0x93, 0x20, 0x5c, 0xc8, 0x18, 0x00, 0xac, 0x40, 0xae, 0xdf, 0x7e, 0xed, 0x0a, 0xc4, 0x81, 0xce, 0xb8, 0x18, 0x28, 0x95, 0xc0, 0x61, 0xd1, 0x34, 0x51, 0xea, 0xd4, 0x04, 0x62, 0xcd, 0x9f, 0x90, 0x3e, 0x67, 0x0f, 0xcd, 0x9d, 0x14, 0x8f, 0x77, 0xd7, 0xf3, 0x82, 0x3a, 0x1d, 0x2f, 0x1e, 0xd2, 0xde, 0x7a, 0xbc, 0xef, 0x41, 0x63, 0x04, 0xa3, 0x7f, 0xf7, 0x03, 0xeb, 0xbc, 0x16, 0x8a, 0x23, 0x1f, 0x47, 0x9d, 0xc7, 0x9e, 0x55, 0xda, 0x45, 0x32, 0x78, 0xe4, 0xb4, 0x12, 0x7f, 0xa0, 0x4d, 0x00, 0x41, 0x2b, 0xf8, 0x60, 0xa8, 0xc4, 0x2e, 0x9f, 0x15, 0xc9, 0xe0, 0xe3, 0x1d, 0xb6, 0x82, 0xa4, 0x95, 0x70, 0x49, 0x2c, 0x4f, 0x96, 0x3a, 0x24, 0x96, 0xb4, 0xdb, 0xfc, 0xb8, 0x44, 0xc7, 0x08, 0x76, 0x92, 0xb3, 0x1a, 0x7a, 0x6d, 0x2e, 0x5d, 0xec, 0xaa, 0xf1, 0x88, 0x23, 0x24, 0x73, 0xc3, 0xcf, 0x9d, 0x24, 0x02, 0xd7, 0x16, 0x1e, 0xae, 0xc5, 0xbe, 0x05, 0x54, 0x86, 0xaa, 0x1a, 0xe2, 0x9e, 0x60, 0x17, 0x61, 0x4c, 0x98, 0xd1, 0x7b, 0xe2, 0x0b, 0x86, 0x3b, 0x74, 0xaa, 0x43, 0xe9, 0xbd, 0x1c, 0x29, 0xcf, 0x21, 0xb5, 0xab, 0x43, 0xa0, 0xa7, 0x0f, 0xde, 0xaf, 0xdd, 0x40, 0xb8, 0x13, 0x43, 0xd2, 0xe8, 0x88, 0xd8, 0x49, 0xc3, 0x54, 0xf0, 0xc0, 0xf8, 0xc5, 0x27, 0x42, 0xb4, 0x53, 0xe5, 0x44, 0xd0, 0x46, 0x53, 0xc7, 0x35, 0x88, 0x32, 0x45, 0xd8, 0x6a, 0x64, 0x8e, 0x1d, 0xda, 0x74, 0x35, 0x3b, 0xdb, 0x62, 0xe3, 0xa5, 0x2e, 0x32, 0x35, 0xd2, 0xa6, 0xd0, 0xfa, 0x7c, 0xed, 0x3c, 0x81, 0x28, 0x26, 0xce, 0x13, 0xc8, 0x5f, 0xde, 0xe1, 0x50, 0x49, 0xce, 0x13, 0x1a, 0xa5, 0xbf, 0xde, 0x5c, 0x9d, 0x7f, 0xac, 0x3e, 0x4e, 0x4f, 0x60, 0xbb, 0x07, 0xbc, 0x4c, 0xb1, 0xf2, 0x88, 0x63, 0x05, 0xa6, 0x24, 0x6f, 0x6f, 0xe1, 0xfc, 0xad, 0x99, 0x02, 0x4a, 0x63, 0x21, 0x05, 0x5d, 0xb2, 0x8c, 0x51, 0xfe, 0x39, 0x7e, 0x37, 0x40, 0xa2, 0xe5, 0xe4, 0xe1, 0x76, 0x97, 0xbf, 0x70, 0x49, 0x16, 0xb3, 0xef, 0x30, 0x10, 0xef, 0xc1, 0xb0, 0x07, 0xcc, 0x62, 0x2d, 0xfe, 0xb9, 0xd2, 0xdb, 0x50, 0x06, 0xbd, 0xf7, 0xfb, 0x00, 0xb8, 0x9a, 0x0b, 0x16, 0xda, 0x5d, 0xe6, 0x18, 0x98, 0x3b, 0x1b, 0xf3, 0x20, 0x9c, 0x79, 0x77, 0x34, 0x52, 0x44, 0x2d, 0x18, 0x20, 0x5d, 0xcd, 0xc9, 0x1f, 0x9e, 0x65, 0x9b, 0x20, 0xeb, 0xc0, 0x88, 0x80, 0xe8, 0x0e, 0x4b, 0x88, 0x82, 0xd8, 0x0c, 0x67, 0xf3, 0xdd, 0xe5, 0x4f, 0x5b, 0xe1, 0xc8, 0x7c, 0xce, 0x53, 0x8e, 0x94, 0x90, 0x04, 0xa2, 0x05, 0x32, 0x3a, 0x67, 0x38, 0x77, 0xc8, 0xba, 0xc5, 0x08, 0xf1, 0xb0, 0xc4, 0x2a, 0xf3, 0x87, 0x0a, 0xf8, 0xa7, 0xd1, 0xa1, 0x02, 0xc3, 0x94, 0x21, 0x80, 0x87, 0xca, 0x79, 0x34, 0xa0, 0xd8, 0x17, 0x7a, 0xa8, 0xb0, 0x20, 0x71, 0x8f, 0xe6, 0x0f, 0x15, 0x90, 0xda, 0xa3, 0x43, 0xe5, 0x1c, 0x60, 0xf7, 0xef, 0x7e, 0xaa, 0x3c, 0x78, 0x84, 0xfc, 0x63, 0x8e, 0x8f, 0x59, 0xf5, 0x8e, 0x8b, 0xb3, 0x3f, 0xc7, 0x13, 0x04, 0xbd, 0xf1, 0x84, 0xd5, 0xd7, 0x3c, 0x52, 0xa6, 0x94, 0x3e, 0x49, 0x54, 0x6d, 0x20, 0x01, 0x96, 0xba, 0xa6, 0xab, 0x2b, 0x5f, 0xe5, 0x0e, 0x17, 0xcb, 0x19, 0x4e, 0x98, 0x70, 0xd8, 0x6c, 0x4f, 0xd3, 0xb4, 0x55, 0x9d, 0x55, 0x70, 0xfa, 0x2c, 0x33, 0xd4, 0x72, 0x8e, 0xf4, 0xbf, 0x16, 0x25, 0x9d, 0x58, 0xf6, 0x28, 0xd6, 0x33, 0xe2, 0xf9, 0xf5, 0x90, 0xfa, 0xef, 0xb6, 0xf3, 0xab, 0xa1, 0x8a, 0x76, 0xbf, 0xf3, 0x31, 0x3b, 0xd6, 0xdc, 0xe9, 0xd5, 0x38, 0xd6, 0x9c, 0x41, 0x9f, 0xc6, 0xb1, 0x06, 0x33, 0xd4, 0xea, 0x8a, 0x44, 0x4e, 0x1e, 0x73, 0x3f, 0xa2, 0x87, 0x13, 0x0e, 0x32, 0x8d, 0x8a, 0x62, 0xdc, 0xa9, 0xf5, 0xd9, 0x27, 0xd1, 0xb6, 0xd3, 0xc7, 0xd1, 0xe4, 0x12, 0x82, 0x69, 0x74, 0xf4, 0x6c, 0x07, 0xed, 0xf5, 0xf3, 0xca, 0x41, 0x6c, 0x72, 0x1e, 0xf2, 0x10, 0x3b, 0x0a, 0xf7, 0x10, 0xbb, 0x21, 0xe4, 0x6a, 0xd6, 0xaf, 0x0a, 0x90, 0xff, 0x23, 0x10, 0xeb, 0x4c, 0xb9, 0xa7, 0x5e, 0x45, 0x38, 0xae, 0x00, 0x89, 0x48, 0xf0, 0xb1, 0xfa, 0x05, 0x89, 0x21, 0x9a, 0xd7, 0x5c, 0xfa, 0x38, 0x14, 0x30, 0x1a, 0x00, 0xec, 0x00, 0xcc, 0x90, 0x49, 0x7f, 0x5c, 0x06, 0xd8, 0xb7, 0x92, 0x0c, 0xf3, 0x88, 0xe2, 0xef, 0x87, 0x9a, 0xfa, 0x49, 0xea, 0x5c, 0xc1, 0x8d, 0xb8, 0x68, 0x2c, 0x09, 0xc1, 0x5d, 0x4e, 0x8a, 0xe4, 0x86, 0x02, 0xe4, 0x4d, 0xb7, 0x28, 0xd6, 0x90, 0xec, 0xcf, 0x7a, 0xa4, 0xec, 0x5a, 0x11, 0xe6, 0xe2, 0x69, 0x00, 0xfa, 0xb3, 0x63, 0xdb, 0x4a, 0x59, 0x72, 0x0d, 0xf3, 0x6e, 0xbc, 0x46, 0x76, 0x2f, 0x08, 0x64, 0x6f, 0x3d, 0x79, 0xd2, 0x54, 0xce, 0x81, 0x45, 0x07, 0x40, 0xc2, 0x9f, 0x14, 0xf5, 0x72, 0xed, 0x42, 0x57, 0xc8, 0xc1, 0xb2, 0xb5, 0xdc, 0x24, 0x95, 0x2f, 0x97, 0x40, 0x97, 0xe7, 0x46, 0xa3, 0x50, 0xb9, 0x3a, 0x3a, 0xcf, 0x64, 0x23, 0xbd, 0xfd, 0x34, 0xca, 0x4c, 0x12, 0x99, 0x0f, 0x0e, 0x36, 0xd5, 0x9d, 0x26, 0xf5, 0x42, 0xf5, 0x0a, 0x5a, 0xe8, 0xe1, 0xb3, 0xad, 0xd0, 0x24, 0x91, 0x2b, 0x94, 0x94, 0x14, 0xa1, 0xf3, 0xd7, 0x01, 0xbe, 0x5d, 0x31, 0xec, 0x35, 0x86, 0x8d, 0xd4, 0x1b, 0xc4, 0x55, 0x25, 0x0f, 0x1a, 0x4d, 0xf1, 0x14, 0x76, 0x40, 0x1a, 0x90, 0x51, 0xf3, 0x05, 0xa0, 0x07, 0xa2, 0x7f, 0x1d, 0x30, 0xd6, 0x93, 0x04, 0xb8, 0x88, 0x5b, 0xce, 0xff, 0x10, 0x5c, 0xf4, 0x5a, 0x96, 0x04, 0x8e, 0x0f, 0xa9, 0x8b, 0x6f, 0x47, 0xee, 0x23, 0xc3, 0x64, 0x7f, 0x57, 0x3a, 0x0c, 0xcf, 0x7c, 0x81, 0x77, 0x4a, 0x01, 0x72, 0x8e, 0x11, 0x8d, 0x07, 0x6a, 0xfe, 0x10, 0x29, 0xaf, 0x6a, 0x5a, 0x6a, 0x1a, 0xf6, 0xb9, 0xa8, 0x75, 0xcc, 0x1d, 0x54, 0xdb, 0x56, 0x46, 0x9a, 0xe2, 0xc1, 0x2e, 0xa4, 0x1c, 0xe3, 0x32, 0x79, 0x04, 0x3c, 0x45, 0x49, 0xc1, 0x99, 0xa5, 0x07, 0x51, 0xa6, 0x04, 0x1c, 0xf9, 0x04, 0xba, 0x4d, 0x9d, 0x88, 0x05, 0x84, 0x50, 0x54, 0xd3, 0x81, 0xe0, 0x80, 0x6d, 0x78, 0x7b, 0x5b, 0x11, 0xce, 0xbc, 0x97, 0x20, 0xa4, 0xa7, 0xb1, 0xab, 0xba, 0xb9, 0x96, 0x41, 0x31, 0x2c, 0x88, 0xd4, 0x6e, 0x35, 0x1b, 0x45, 0xa5, 0x56, 0x61, 0xc7, 0x28, 0x27, 0xcd, 0x04, 0xf5, 0x28, 0xcb, 0x11, 0x21, 0xf8, 0xe4, 0x82, 0xa0, 0x6e, 0x69, 0x74, 0x07, 0xe7, 0xc4, 0xb5, 0xb3, 0x1d, 0x15, 0xe1, 0xff, 0xe0, 0xec, 0xce, 0x05, 0xf9, 0xcd, 0x44, 0x6d, 0x10, 0xb5, 0xb9, 0x0b, 0xfa, 0x81, 0x63, 0xe9, 0x66, 0xa3, 0x6f, 0x3a, 0x28, 0xec, 0x06, 0x58, 0x46, 0xf0, 0xa3, 0x13, 0x0f, 0xc6, 0x18, 0x60, 0xd3, 0x2b, 0xe4, 0x53, 0xe8, 0x10, 0xf6, 0xff, 0x48, 0x98, 0x8d, 0x67, 0xad, 0x19, 0x62, 0xf4, 0x6c, 0xaf, 0xf7, 0x72, 0x0a, 0x62, 0xf7, 0x29, 0x88, 0xdd, 0xd9, 0x54, 0x83, 0x53, 0x47, 0xf5, 0xbe, 0x1c, 0x5c, 0x0a, 0xd5, 0x37, 0x4e, 0x04, 0x9f, 0x8e, 0x32, 0x46, 0x67, 0xc3, 0x4b, 0x60, 0xe0, 0x67, 0xe8, 0xea, 0x05, 0x7e, 0x37, 0xd0, 0x54, 0x91, 0xcd, 0x8c, 0xb6, 0x29, 0x02, 0x0b, 0xa2, 0x97, 0x92, 0xc9, 0xce, 0x01, 0x2f, 0x38, 0x1e, 0x82, 0x5d, 0x23, 0xd4, 0xc8, 0x62, 0x17, 0x08, 0xde, 0x40, 0x1e, 0x5a, 0x04, 0x1b, 0x2d, 0x33, 0x9c, 0x41, 0x3a, 0x6e, 0xdd, 0xe3, 0x4f, 0xc6, 0xda, 0x25, 0xa8, 0x86, 0x48, 0x06, 0xa2, 0x44, 0x74, 0x01, 0x12, 0xeb, 0x9c, 0xce, 0xc7, 0x74, 0xdd, 0x50, 0xbe, 0x92, 0xf7, 0xa3, 0xfb, 0x4c, 0x07, 0x58, 0x44, 0x7c, 0xa3, 0x09, 0xf3, 0xc7, 0x99, 0x89, 0x57, 0x5e, 0x86, 0x1c, 0xdb, 0x58, 0x88, 0x5c, 0xda, 0xf1, 0xad, 0x92, 0x04, 0xab, 0x5d, 0xc0, 0x2d, 0x58, 0x1d, 0xc2, 0xfa, 0xc0, 0xc3, 0xe6, 0x8e, 0xe0, 0xb2, 0x98, 0xfe, 0x42, 0x57, 0x09, 0x22, 0x48, 0x57, 0x4c, 0x3f, 0xd1, 0xd8, 0xbf, 0xe7, 0x0c, 0x93, 0x16, 0x64, 0x3b, 0xf8, 0xd0, 0x3f, 0xd9, 0xe4, 0x61, 0x65, 0xe8, 0xe4, 0xe6, 0x67, 0x53, 0xa6, 0x2f, 0x58, 0xfd, 0x49, 0xa6, 0x10, 0xfa, 0x23, 0x6c, 0xcb, 0x39, 0x34, 0x41, 0xd8, 0x94, 0x0b, 0x68, 0x75, 0xec, 0x0f, 0x4e, 0x5e, 0xe1, 0x14, 0xb7, 0x2a, 0x6e, 0x6f, 0x8f, 0x8e, 0x3b, 0xae, 0xd8, 0x13, 0x57, 0xec, 0xd5, 0xe0, 0x6a, 0x58, 0x4b, 0x73, 0x74, 0xa2, 0x6b, 0xe4, 0xed, 0xf0, 0x0a, 0xc6, 0x46, 0x53, 0x4a, 0xf6, 0xdb, 0xce, 0xe1, 0xdb, 0xf6, 0xa6, 0x4b, 0x0c, 0xa0, 0xff, 0xb6, 0x0b, 0x32, 0x9f, 0xd9, 0x50, 0xc5, 0x10, 0xc7, 0x5e, 0x83, 0xe1, 0x83, 0xb3, 0x73, 0x88, 0x9f, 0xe7, 0xe7, 0x7d, 0x34, 0xac, 0x16, 0xb5, 0x61, 0xd4, 0xe6, 0xf9, 0x45, 0x1f, 0xe3, 0x23, 0x30, 0x2d, 0x8d, 0x96, 0x30, 0x26, 0xd1, 0x48, 0x10, 0x7b, 0xf8, 0x8f, 0xb5, 0x26, 0x74, 0xee, 0x8f, 0xa0, 0x4a, 0xa8, 0xfd, 0x57, 0x73, 0xca, 0xfa, 0x67, 0x49, 0x05, 0xf8, 0x18, 0xb9, 0xa1, 0xd6, 0x9c, 0xe0, 0xec, 0x3b, 0xf6, 0xbe, 0xca, 0x28, 0xcd, 0x71, 0xc5, 0x04, 0x8b, 0xdd, 0x8d, 0xc1, 0xfc, 0xd5, 0x78, 0x30, 0xe7, 0x38, 0x90, 0xa1, 0x33, 0xd7, 0x3e, 0x7f, 0x00, 0xdd, 0x44, 0x72, 0x77, 0xbf, 0xc7, 0xd3, 0x35, 0xfc, 0x03, 0x5c, 0x77, 0xdf, 0xe1, 0x69, 0x83, 0xa7, 0x4d, 0xf7, 0x0d, 0x46, 0xe3, 0x7c, 0x33, 0xaf, 0x56, 0xed, 0xef, 0xbb, 0xef, 0x3a, 0xdd, 0xf7, 0xc3, 0x37, 0xaf, 0x86, 0x1f, 0x06, 0x1f, 0xd4, 0x2d, 0xff, 0xd3, 0xa7, 0x1f, 0xb1, 0xba, 0xa5, 0x39, 0x7c, 0x94, 0x52, 0x70, 0xbb, 0x91, 0x98, 0xf6, 0x7b, 0x5c, 0x69, 0x3b, 0xdd, 0x8f, 0x5e, 0xc6, 0xf0, 0x49, 0xfb, 0xfd, 0x61, 0x94, 0xfc, 0x83, 0x26, 0x3c, 0x7c, 0xb3, 0xf7, 0xe1, 0xd5, 0xc7, 0xe0, 0x3e, 0xdc, 0x4a, 0xe9, 0x47, 0x35, 0x44, 0xc5, 0xde, 0xde, 0xbe, 0x89, 0x12, 0xf7, 0x9f, 0x44, 0xe5, 0xc5, 0x11, 0xf4, 0xfe, 0xef, 0x2a, 0x06, 0x25, 0x37, 0x44, 0x0c, 0xdf, 0xe0, 0x45, 0xca, 0x1b, 0x7e, 0xc0, 0x93, 0x65, 0x1e, 0xbe, 0x67, 0x92, 0xeb, 0xe1, 0xf7, 0xfc, 0xdb, 0x0c, 0xdf, 0x71, 0x0d, 0x6b, 0x1a, 0x65, 0x34, 0xfc, 0xe8, 0x36, 0x9a, 0x2b, 0xf3, 0xb0, 0xfd, 0x63, 0xed, 0x22, 0xea, 0x62, 0x7a, 0x50, 0xe4, 0x49, 0x6f, 0xa4, 0x3e, 0x86, 0xb7, 0xd8, 0x70, 0x03, 0x0d, 0x19, 0x92, 0xab, 0x68, 0x48, 0x0d, 0x8a, 0xee, 0x8f, 0xea, 0xff, 0x25, 0x64, 0x22, 0x57, 0x3d, 0x4e, 0x8d, 0x77, 0xbb, 0x31, 0xb3, 0xfd, 0x7a, 0x61, 0x66, 0x17, 0xa2, 0xfb, 0xf2, 0x8f, 0xb7, 0xb7, 0xd1, 0x20, 0xf9, 0x4b, 0x67, 0xb8, 0x26, 0xfb, 0xd8, 0x7f, 0x20, 0x65, 0x35, 0x05, 0xc8, 0x8f, 0x22, 0xae, 0xfa, 0x13, 0xc0, 0xdd, 0x89, 0x5d, 0x83, 0x85, 0x41, 0xfc, 0xa8, 0xeb, 0x71, 0xa7, 0x7b, 0xa3, 0x6b, 0xc9, 0xa6, 0xd3, 0x49, 0xb9, 0xf8, 0x31, 0x20, 0x8c, 0xf4, 0x83, 0x2b, 0xb0, 0xd2, 0x0f, 0x2d, 0xd0, 0x0a, 0x00, 0x34, 0xe6, 0xe4, 0xbf, 0xbc, 0x51, 0x3b, 0x57, 0xfe, 0xb9, 0xc7, 0xd2, 0x5b, 0x37, 0xe9, 0xb3, 0x23, 0xc4, 0xad, 0xca, 0x0f, 0x38, 0x95, 0xff, 0xf7, 0x62, 0x32, 0xce, 0x89, 0x30, 0xfb, 0xa0, 0xc4, 0x9e, 0xee, 0x94, 0x06, 0x4f, 0x69, 0x4b, 0x3c, 0x10, 0x1c, 0x3d, 0x95, 0x51, 0x38, 0x9f, 0x35, 0x1a, 0x24, 0x2e, 0x09, 0xd8, 0xd3, 0xb0, 0xa9, 0x0b, 0x9e, 0x6a, 0x24, 0xf8, 0xef, 0x0e, 0x79, 0x0c, 0x8f, 0x9c, 0x22, 0xf2, 0x86, 0xc5, 0x15, 0x8e, 0x11, 0x2c, 0x29, 0x63, 0xa6, 0x08, 0x4d, 0x66, 0x41, 0xbd, 0xa3, 0x76, 0xbb, 0xa4, 0x2d, 0x06, 0x24, 0xe4, 0xdd, 0x29, 0x0e, 0x07, 0xf3, 0x93, 0xe1, 0xc8, 0x63, 0xa6, 0x96, 0xaf, 0xfb, 0x9e, 0xa6, 0xa3, 0x28, 0x7b, 0xd7, 0x93, 0x76, 0x0c, 0xdb, 0xee, 0x16, 0xcf, 0x50, 0xd0, 0x73, 0x98, 0xed, 0xc4, 0x58, 0x46, 0x89, 0x49, 0xb4, 0x8a, 0xd2, 0x1a, 0x0d, 0x6a, 0x84, 0xc4, 0x9b, 0xe7, 0xb0, 0x45, 0x6e, 0xa0, 0x0b, 0x98, 0x96, 0xac, 0x42, 0xa0, 0xe6, 0x60, 0x33, 0x63, 0x18, 0x41, 0xe8, 0x4e, 0xb1, 0x6e, 0xb3, 0x92, 0x13, 0xd3, 0x21, 0x34, 0xdd, 0x17, 0x10, 0xb8, 0x1b, 0x56, 0x0e, 0xb7, 0x52, 0xbc, 0x1f, 0xb2, 0x62, 0xb4, 0x95, 0x62, 0x60, 0xcd, 0x75, 0xf8, 0x70, 0x03, 0xff, 0x75, 0x88, 0x71, 0x83, 0x06, 0x90, 0x5a, 0x1c, 0x14, 0x6a, 0xc1, 0xdf, 0x03, 0x53, 0xfe, 0x5c, 0xac, 0x38, 0x7b, 0x81, 0xf7, 0x17, 0x75, 0xdc, 0xcb, 0xa3, 0xab, 0x70, 0x0d, 0x09, 0x3f, 0x12, 0xf4, 0x43, 0xae, 0x84, 0xb4, 0x90, 0xcf, 0x6d, 0xc2, 0xbb, 0x2c, 0x9e, 0x31, 0xa2, 0x0d, 0x23, 0x4d, 0x46, 0x14, 0x07, 0x63, 0x7b, 0x7a, 0x0a, 0xcf, 0xc8, 0xd2, 0x13, 0x5c, 0xa4, 0x64, 0x35, 0x18, 0x09, 0x5b, 0xee, 0x6d, 0x5e, 0x36, 0xce, 0xfb, 0x19, 0x09, 0x32, 0x0d, 0x60, 0x43, 0x7e, 0x09, 0x69, 0xc2, 0xa3, 0x58, 0x04, 0x5a, 0x35, 0xbc, 0x8c, 0xf2, 0x03, 0x01, 0xef, 0xa9, 0x94, 0xb8, 0x70, 0xbd, 0xbb, 0x80, 0xce, 0x25, 0x71, 0x1f, 0xbc, 0x6c, 0xf4, 0x65, 0x13, 0x11, 0x05, 0xe2, 0x2c, 0x62, 0x75, 0xc1, 0xdd, 0x4a, 0x6d, 0x5a, 0x80, 0xc9, 0x79, 0x6c, 0x06, 0x67, 0x33, 0x0e, 0x64, 0x90, 0x17, 0x72, 0xd8, 0x8a, 0x9c, 0xd2, 0x82, 0xb2, 0x01, 0x9d, 0xae, 0xa5, 0x71, 0x27, 0x37, 0xac, 0x5c, 0x03, 0x77, 0xb2, 0xb3, 0xe9, 0x94, 0x1a, 0x19, 0x11, 0xda, 0x02, 0x8b, 0xb1, 0x90, 0xcd, 0x86, 0x55, 0x79, 0xa0, 0x2d, 0xe3, 0x2e, 0xcc, 0x2a, 0xb6, 0x83, 0xf8, 0x25, 0xde, 0x22, 0x29, 0x4b, 0xc6, 0x9d, 0xc2, 0x17, 0xd0, 0xa9, 0x5d, 0xa5, 0x4f, 0xe1, 0x08, 0xe8, 0xd4, 0x5f, 0xed, 0x1b, 0x5d, 0xd0, 0xdd, 0x78, 0x0a, 0x41, 0x35, 0x7f, 0x9b, 0x7e, 0xf8, 0xe4, 0x70, 0x44, 0xd1, 0xfc, 0x48, 0xd1, 0x9d, 0xa2, 0xaf, 0xc6, 0x39, 0x4c, 0xf4, 0xae, 0x13, 0xa3, 0xb8, 0x74, 0x9d, 0x0d, 0x8f, 0xb8, 0xae, 0x8f, 0x1d, 0x83, 0xd0, 0x1b, 0xef, 0x00, 0xde, 0x44, 0x51, 0x15, 0xb3, 0xfa, 0x03, 0x04, 0xa0, 0x09, 0x47, 0xec, 0xe6, 0x5e, 0xd5, 0x60, 0x89, 0xa6, 0x0f, 0xf0, 0xc4, 0x3b, 0xbc, 0x81, 0xde, 0x57, 0x26, 0x3a, 0x80, 0x1b, 0xa0, 0xff, 0x5f, 0x7a, 0x63, 0xdf, 0xab, 0x43, 0x1d, 0x11, 0x81, 0x36, 0x43, 0x46, 0x84, 0x40, 0x0f, 0xd9, 0x16, 0xcb, 0x19, 0x4d, 0x6d, 0x53, 0x63, 0x4b, 0x71, 0x9e, 0xea, 0x74, 0x07, 0xb4, 0xab, 0xd5, 0x39, 0x24, 0xa8, 0xe9, 0xf0, 0x65, 0x87, 0x2a, 0x5e, 0x6f, 0x17, 0x0b, 0x2c, 0xc2, 0xd6, 0xf7, 0xc5, 0x6c, 0x56, 0xad, 0x76, 0x46, 0x50, 0xef, 0xdd, 0x29, 0x76, 0x46, 0x53, 0xc8, 0xef, 0xef, 0xc0, 0x9b, 0x4c, 0xe1, 0x8f, 0x2a, 0x58, 0xaf, 0x8a, 0x05, 0x99, 0xb5, 0xbd, 0x26, 0xa6, 0x6f, 0x3a, 0x18, 0x91, 0x19, 0xb7, 0x48, 0xb3, 0xc8, 0xb7, 0x09, 0x2a, 0xae, 0x74, 0x28, 0x41, 0x67, 0x00, 0xd2, 0x32, 0xb4, 0x91, 0x5e, 0x26, 0x44, 0xed, 0xd8, 0x59, 0x53, 0x32, 0x53, 0xda, 0x0c, 0xc7, 0x36, 0xab, 0x68, 0x29, 0x9d, 0x56, 0x32, 0x33, 0xd1, 0xce, 0x52, 0x49, 0xec, 0x04, 0xcf, 0x0c, 0xfb, 0x78, 0xd5, 0xef, 0xbc, 0xee, 0xba, 0x2a, 0x40, 0x08, 0xe8, 0x29, 0xa6, 0xaa, 0x08, 0x55, 0x59, 0x46, 0x8c, 0xc7, 0x30, 0xb5, 0x4b, 0xf2, 0x8e, 0x17, 0x96, 0xa0, 0x77, 0xf6, 0x6e, 0x0c, 0x05, 0x98, 0x24, 0x01, 0xc7, 0x30, 0x49, 0xc2, 0x00, 0x9f, 0xc8, 0x10, 0xcf, 0x60, 0x36, 0x86, 0xa6, 0x01, 0xd4, 0xcc, 0x83, 0x5a, 0x5c, 0x68, 0xad, 0x30, 0xbb, 0x14, 0x50, 0xf4, 0xd2, 0x55, 0x71, 0x6d, 0x54, 0xab, 0x43, 0x59, 0x03, 0xb5, 0x6b, 0x63, 0x16, 0x65, 0x7c, 0xf7, 0xc0, 0x64, 0xa7, 0xc2, 0x01, 0xbb, 0xe5, 0x45, 0x91, 0xa1, 0x35, 0x53, 0x4f, 0x83, 0x1a, 0x98, 0xc4, 0x0a, 0xa9, 0xd6, 0x14, 0x7c, 0x7e, 0xf2, 0x04, 0x97, 0x75, 0x71, 0x59, 0x57, 0x40, 0x97, 0x0f, 0x7a, 0x0b, 0x0c, 0x65, 0x53, 0x44, 0xd5, 0xd4, 0x22, 0xcc, 0x3b, 0x7a, 0xf4, 0xee, 0xad, 0xdf, 0x87, 0xbe, 0xc1, 0x1d, 0x1c, 0x34, 0xec, 0xf7, 0xf5, 0x32, 0x1c, 0x15, 0x64, 0x06, 0xef, 0x5d, 0xcb, 0x01, 0xb6, 0x9a, 0x4d, 0xf2, 0x02, 0xae, 0x14, 0x46, 0xf4, 0x8e, 0x63, 0xd6, 0x27, 0x2b, 0x4e, 0xa8, 0xde, 0x4c, 0x73, 0x0a, 0x2c, 0x14, 0x12, 0xa2, 0x05, 0x99, 0xc4, 0xc9, 0x94, 0x98, 0x59, 0xd9, 0xf5, 0xb3, 0x47, 0x2b, 0x2b, 0xbb, 0x38, 0x0c, 0x74, 0xdc, 0xd5, 0xc8, 0x8a, 0x8f, 0x35, 0x1b, 0x2b, 0x2e, 0x5e, 0xa4, 0x98, 0x83, 0x97, 0x9d, 0xf1, 0xf8, 0x4b, 0xaa, 0x7e, 0x9e, 0x54, 0x0d, 0x4f, 0xf6, 0x49, 0xd5, 0x3e, 0xd6, 0xaa, 0x76, 0xf1, 0x69, 0xd5, 0xdb, 0x54, 0x92, 0x70, 0xc0, 0x36, 0xd6, 0x6c, 0x43, 0x15, 0x25, 0x2d, 0x8a, 0x0a, 0x76, 0x3f, 0xc1, 0x9a, 0x5c, 0x01, 0x17, 0xde, 0x89, 0x2b, 0x2f, 0x2b, 0x0b, 0x29, 0x5d, 0xdc, 0x07, 0x24, 0x9d, 0x8b, 0x38, 0x6e, 0xb3, 0x88, 0x77, 0x17, 0x17, 0x50, 0x84, 0xa1, 0x45, 0x90, 0x7b, 0xca, 0x9a, 0x64, 0x12, 0xb9, 0x42, 0xef, 0xad, 0xec, 0x8e, 0xad, 0x16, 0x60, 0x99, 0x01, 0x27, 0xfd, 0xaf, 0xfe, 0x00, 0x90, 0xf7, 0xf2, 0x73, 0xcc, 0xa7, 0xdd, 0x2f, 0xf8, 0xe9, 0xcc, 0xad, 0x10, 0x0f, 0x56, 0x21, 0x50, 0xf0, 0x5e, 0x12, 0xc3, 0x2b, 0xd0, 0x2d, 0x93, 0x35, 0x0f, 0x5e, 0x80, 0x1e, 0xa5, 0x58, 0xc4, 0xf3, 0x43, 0x9f, 0xd3, 0x2c, 0xa0, 0x21, 0x01, 0x78, 0x6a, 0xb4, 0x37, 0x64, 0xc7, 0xa0, 0x3f, 0x79, 0x69, 0xe0, 0xf8, 0x10, 0x3e, 0x4f, 0x78, 0xcc, 0xc2, 0x51, 0x42, 0x92, 0x0f, 0x8c, 0x5f, 0x9f, 0xe8, 0xf2, 0x90, 0x70, 0xa9, 0x82, 0x0a, 0x2f, 0x5d, 0xa3, 0x8c, 0x78, 0x2e, 0x93, 0x9a, 0x51, 0x17, 0xb2, 0xd5, 0xdc, 0x90, 0x19, 0x55, 0xd9, 0x51, 0x1c, 0x32, 0xa1, 0xad, 0xfd, 0x91, 0x47, 0xef, 0x20, 0xdd, 0xce, 0x26, 0xc1, 0x8d, 0x77, 0x54, 0x5d, 0xff, 0x0c, 0x47, 0x31, 0xb0, 0x8a, 0x8b, 0xa0, 0x71, 0x74, 0xe1, 0xf0, 0x08, 0x9c, 0xe9, 0x47, 0x17, 0x01, 0xf9, 0x10, 0xa7, 0xd5, 0x1b, 0x99, 0x24, 0x5e, 0x3e, 0xee, 0x3a, 0x67, 0x74, 0x5f, 0x6d, 0x01, 0xf4, 0x5f, 0xcd, 0x44, 0x27, 0x0a, 0x98, 0x3c, 0xb9, 0x68, 0xa3, 0x03, 0x27, 0x74, 0x52, 0x3c, 0x47, 0xde, 0x15, 0x61, 0x86, 0x3b, 0xd9, 0xc1, 0xb4, 0xb1, 0x70, 0x16, 0x52, 0xa3, 0xe0, 0x90, 0xf3, 0xac, 0x06, 0x12, 0x7d, 0x49, 0x2c, 0xd3, 0xa5, 0x52, 0xab, 0x12, 0xf0, 0x5b, 0x7e, 0x16, 0xf6, 0xa6, 0x16, 0x7a, 0xcf, 0xc2, 0xbb, 0xbd, 0x3d, 0xcb, 0x2c, 0x3b, 0x18, 0xdc, 0x78, 0x7e, 0xe0, 0x47, 0x04, 0xf6, 0xa5, 0x8f, 0xf0, 0x0e, 0x5f, 0x3f, 0x5a, 0x29, 0xb9, 0xc8, 0x69, 0x83, 0x3a, 0x2a, 0xa1, 0x2b, 0x7e, 0x6b, 0xd4, 0x3a, 0x0d, 0x7f, 0x21, 0x8e, 0x09, 0x06, 0x82, 0x83, 0xdc, 0x6b, 0x23, 0x25, 0x21, 0xaf, 0x42, 0xbf, 0xc3, 0x45, 0x43, 0x5c, 0xfa, 0xa1, 0x99, 0xe4, 0xfc, 0x45, 0xb0, 0xf3, 0xae, 0xd3, 0x3f, 0x53, 0xe7, 0x01, 0x04, 0xbb, 0xc3, 0x2b, 0x91, 0x7b, 0x14, 0x88, 0x39, 0xbc, 0x0a, 0x70, 0xd4, 0x01, 0xcf, 0xb3, 0xc4, 0x25, 0xd1, 0x6f, 0x70, 0xd9, 0x20, 0xa8, 0xaf, 0xac, 0x7f, 0xba, 0xb6, 0xca, 0x1c, 0x43, 0x24, 0x29, 0x5b, 0xaf, 0x71, 0x6b, 0x0f, 0xde, 0x14, 0x9c, 0xb9, 0x5c, 0x5c, 0xd6, 0xd5, 0x02, 0xb6, 0x99, 0x40, 0x84, 0x24, 0x34, 0x79, 0x7b, 0x69, 0x08, 0x6f, 0xf6, 0xee, 0x2a, 0x1f, 0xa1, 0xc0, 0xee, 0xe4, 0xc3, 0xed, 0x10, 0xfa, 0x46, 0x64, 0x71, 0xde, 0x3f, 0x86, 0xa0, 0x93, 0x47, 0x63, 0x08, 0x23, 0x76, 0x1c, 0xc3, 0x0a, 0x02, 0xe9, 0xa0, 0x23, 0x86, 0xbd, 0x01, 0x6a, 0xa9, 0xf3, 0x93, 0xa4, 0x17, 0x9f, 0x35, 0xf6, 0xc4, 0xfa, 0x15, 0x85, 0x1b, 0x64, 0x4f, 0xac, 0xdd, 0x9e, 0x18, 0x0f, 0xc6, 0xc3, 0x11, 0xf5, 0x4a, 0x94, 0xc4, 0x0c, 0xda, 0x98, 0x57, 0x0c, 0xa2, 0x99, 0x20, 0x9d, 0xfc, 0x11, 0x2c, 0x6c, 0xe2, 0x8a, 0xbd, 0x6b, 0xa5, 0xc3, 0xff, 0xb2, 0x3b, 0xc1, 0x5a, 0x62, 0x37, 0xd3, 0xc6, 0xc5, 0x1d, 0x94, 0x34, 0x06, 0xe4, 0x30, 0xe5, 0xd3, 0xc9, 0x94, 0x06, 0x95, 0xb2, 0x0c, 0xd6, 0xb0, 0xd2, 0x1d, 0x72, 0xcb, 0xd2, 0x9c, 0x4d, 0x37, 0xb1, 0xe6, 0xc4, 0x00, 0x31, 0x35, 0xcc, 0x11, 0x84, 0xc5, 0x62, 0x8d, 0xba, 0x23, 0x13, 0xc1, 0x55, 0x21, 0xe8, 0x99, 0x29, 0xe0, 0xc6, 0xca, 0xdb, 0xd1, 0xfd, 0x32, 0xd5, 0x32, 0x6b, 0x3a, 0x84, 0xdc, 0x72, 0x3d, 0x75, 0x0e, 0x66, 0xb2, 0x3e, 0x5e, 0x30, 0x53, 0x5e, 0xef, 0x31, 0x55, 0x78, 0x5c, 0x6f, 0x8b, 0x80, 0xbc, 0x54, 0xdc, 0x40, 0xcc, 0x1a, 0x87, 0x17, 0x33, 0x6a, 0xe3, 0x2b, 0xa1, 0xb6, 0x60, 0x30, 0xb3, 0xce, 0x45, 0x0c, 0xbc, 0x26, 0xf8, 0xab, 0x6f, 0x3c, 0x40, 0x70, 0xc1, 0x0c, 0xb1, 0xcd, 0x9a, 0x17, 0x97, 0x9a, 0x93, 0x97, 0xfa, 0x4d, 0x13, 0x87, 0x0f, 0xcd, 0x1b, 0xf4, 0xef, 0x53, 0xd9, 0xd4, 0x1d, 0xde, 0x8d, 0xf6, 0x25, 0x14, 0xd2, 0x38, 0xcd, 0xc7, 0x34, 0xc9, 0x9e, 0x9a, 0x74, 0xa2, 0xd1, 0xac, 0x5d, 0x5b, 0xa2, 0xbb, 0x9f, 0xed, 0xc7, 0x45, 0x36, 0x18, 0x36, 0x7c, 0x34, 0xcb, 0xb3, 0x63, 0xdc, 0xf4, 0x5d, 0x07, 0xe5, 0x32, 0xaf, 0xf6, 0xa7, 0x75, 0x19, 0x43, 0x4a, 0x3d, 0x6d, 0x81, 0x2a, 0xa8, 0xbb, 0x16, 0xfc, 0xc6, 0xca, 0x9d, 0xf1, 0x86, 0x19, 0x8d, 0x37, 0xc0, 0xdf, 0x79, 0x5a, 0xd5, 0xe7, 0xfb, 0x88, 0xf1, 0x60, 0x46, 0x00, 0x4c, 0x0c, 0x70, 0x78, 0x14, 0x7b, 0xf3, 0xdb, 0xa2, 0x73, 0x52, 0xe4, 0x21, 0x8f, 0xca, 0x08, 0x34, 0x7c, 0xb7, 0x34, 0xe0, 0x4f, 0xd3, 0xc3, 0x4b, 0xcd, 0x78, 0x77, 0x34, 0xc4, 0xc5, 0xb1, 0xc0, 0x52, 0x84, 0x83, 0xf0, 0xf4, 0x10, 0xc8, 0x86, 0x71, 0xd2, 0x08, 0xdc, 0xe0, 0xbe, 0x20, 0x20, 0x5b, 0xc6, 0x02, 0xbb, 0xb0, 0x31, 0x1f, 0xcd, 0x25, 0xf0, 0x18, 0xcc, 0xe4, 0xfe, 0x81, 0x8a, 0xe7, 0x0b, 0x9b, 0xb5, 0x06, 0x14, 0x44, 0x48, 0xd9, 0x01, 0x50, 0xdc, 0x9d, 0xc0, 0xe2, 0xfb, 0x92, 0x1e, 0xc9, 0x02, 0x8f, 0xc1, 0xa7, 0x00, 0xd4, 0x79, 0x0d, 0x8a, 0xc2, 0xc8, 0xfc, 0x60, 0xfc, 0x6a, 0xee, 0xa0, 0xe8, 0xd8, 0x41, 0xd1, 0x53, 0xd0, 0x1e, 0xe6, 0xb0, 0x2e, 0x22, 0x50, 0xf4, 0x72, 0x78, 0x3a, 0x08, 0xfe, 0xaf, 0x2e, 0xb7, 0x43, 0xd1, 0x35, 0xe8, 0x07, 0xc1, 0xb9, 0x96, 0x27, 0xf7, 0xfa, 0x21, 0x3b, 0x23, 0xbd, 0x1f, 0xf8, 0xd1, 0xfe, 0xe0, 0xfc, 0x55, 0x3d, 0xd5, 0xe0, 0xdc, 0xd5, 0x7d, 0x31, 0xb8, 0x00, 0x07, 0xca, 0x62, 0x8f, 0xce, 0xb5, 0x0d, 0x1b, 0xf8, 0x37, 0x80, 0x71, 0xb0, 0x07, 0x40, 0xec, 0xe0, 0xfa, 0x15, 0xdd, 0x74, 0x9f, 0x0d, 0xaf, 0x3b, 0x77, 0xb8, 0xd3, 0x3b, 0xc0, 0x7b, 0x46, 0x31, 0x3c, 0x5d, 0x21, 0x5b, 0x0c, 0xd4, 0x37, 0x96, 0x4d, 0x3a, 0xa4, 0xcd, 0x21, 0x8f, 0x06, 0x99, 0xf6, 0x94, 0xe8, 0x64, 0xa1, 0xbe, 0x74, 0x1e, 0x6b, 0x1f, 0xee, 0xc1, 0x45, 0xd3, 0x34, 0x67, 0x0f, 0x86, 0xc4, 0x97, 0x35, 0x58, 0x91, 0x12, 0x68, 0x2c, 0xc5, 0xca, 0xee, 0x9f, 0xa5, 0xde, 0x9e, 0xf4, 0x11, 0x9e, 0x44, 0x7e, 0x23, 0x70, 0xbc, 0x6f, 0x5f, 0xcf, 0xc2, 0xbe, 0xa6, 0xfb, 0x3a, 0x6b, 0xb1, 0x2e, 0x1f, 0xbf, 0x64, 0xb9, 0x6c, 0x92, 0x36, 0xcd, 0xb1, 0x64, 0x92, 0x66, 0x35, 0x48, 0xf5, 0xc1, 0x1c, 0x68, 0xaa, 0xba, 0xe0, 0x87, 0x59, 0x74, 0xa8, 0xd5, 0x9e, 0x46, 0x6d, 0x9c, 0x6d, 0x3c, 0x6d, 0x9c, 0x2d, 0x91, 0xbb, 0x74, 0xd8, 0x98, 0xdb, 0x7e, 0x74, 0x3b, 0x91, 0xae, 0xf7, 0xee, 0xda, 0x6b, 0xb4, 0xaa, 0x03, 0xf0, 0xf7, 0x90, 0xce, 0x94, 0x43, 0x15, 0xe5, 0xb0, 0xe3, 0xc5, 0x44, 0xb1, 0x45, 0x6a, 0x3e, 0x87, 0x91, 0x01, 0xc5, 0x51, 0x6c, 0x89, 0x25, 0xa6, 0xab, 0xef, 0x17, 0xc7, 0xcb, 0x68, 0x0a, 0x7d, 0x86, 0xc8, 0x49, 0xcd, 0x1b, 0x50, 0x82, 0x95, 0xf4, 0x5f, 0xc8, 0xf5, 0xee, 0x73, 0x6c, 0x7e, 0x45, 0xdc, 0xa7, 0xa8, 0xa4, 0x81, 0xc7, 0xbd, 0x80, 0x25, 0x0b, 0xc1, 0x82, 0x76, 0x2a, 0xc1, 0xba, 0x58, 0xd1, 0xc4, 0xb4, 0x3c, 0xc0, 0x13, 0x6a, 0xe7, 0x39, 0xce, 0xb2, 0xcf, 0xc2, 0x93, 0xf5, 0xd6, 0xe6, 0x91, 0x65, 0x9b, 0x2d, 0xee, 0x36, 0x83, 0x31, 0x82, 0x0e, 0xbb, 0xba, 0x41, 0xdf, 0x90, 0xba, 0x9d, 0xdf, 0x4f, 0xa7, 0x7a, 0x37, 0x21, 0x59, 0x38, 0x0f, 0x7d, 0xd4, 0x9e, 0xb8, 0x8c, 0x30, 0xbc, 0xc0, 0x0c, 0xaa, 0x57, 0x43, 0x30, 0x35, 0x6d, 0x29, 0xbb, 0xd0, 0x7f, 0x2b, 0x66, 0x63, 0xda, 0x21, 0xca, 0x42, 0x1f, 0xb3, 0x98, 0x79, 0xcf, 0x8e, 0x86, 0x7e, 0x7b, 0x04, 0xd5, 0xeb, 0xbb, 0x1b, 0xf8, 0x23, 0xa9, 0xd9, 0x58, 0x67, 0xa9, 0x8f, 0xd0, 0x9c, 0x8b, 0x8a, 0x5c, 0xb3, 0xe8, 0xcf, 0x90, 0xbb, 0xd0, 0x85, 0x66, 0xdb, 0x4e, 0xa5, 0xb4, 0x4c, 0x8f, 0xd4, 0xa4, 0x9c, 0xf9, 0xd3, 0x89, 0x38, 0x26, 0x0e, 0x29, 0x4d, 0x9d, 0x9d, 0x64, 0xd6, 0x3f, 0x1d, 0xf0, 0x26, 0xa1, 0x76, 0x33, 0x83, 0xad, 0x82, 0x70, 0xa5, 0x38, 0xca, 0xe3, 0x75, 0x20, 0x22, 0x02, 0x3f, 0x04, 0xd0, 0x52, 0x3d, 0x75, 0x7f, 0x1b, 0x08, 0x1a, 0xea, 0xb8, 0x0b, 0x40, 0x33, 0x3d, 0x71, 0x43, 0x0f, 0x65, 0xaa, 0xce, 0x5d, 0x44, 0x05, 0x6e, 0x4e, 0x21, 0x99, 0x71, 0xb2, 0x0c, 0x1c, 0x79, 0x99, 0x49, 0xc0, 0x2e, 0x51, 0xf7, 0x0b, 0x91, 0x8f, 0x8b, 0x6a, 0xf6, 0xa7, 0xf2, 0x0a, 0x93, 0x53, 0xcd, 0xa8, 0xd9, 0x3a, 0xe6, 0xd6, 0x9f, 0x8d, 0xe9, 0xd5, 0x43, 0xcb, 0xeb, 0x93, 0x83, 0x71, 0xaf, 0x4f, 0x8f, 0x97, 0x34, 0x00, 0xf4, 0xf2, 0xf1, 0xfe, 0xe4, 0xeb, 0x42, 0x5a, 0x59, 0xb3, 0x3d, 0x59, 0x37, 0xf2, 0xa9, 0xd5, 0x9e, 0x86, 0x49, 0x0a, 0x77, 0x67, 0xd0, 0x60, 0xd8, 0x34, 0x33, 0xed, 0x0b, 0x80, 0x9b, 0x33, 0x7a, 0x95, 0x8f, 0x27, 0xa8, 0x71, 0xee, 0xe7, 0x0e, 0x01, 0x47, 0x52, 0x11, 0x4d, 0x5d, 0xa3, 0x05, 0x70, 0x0f, 0xca, 0xb5, 0xb4, 0xee, 0x62, 0x30, 0x50, 0x7f, 0x33, 0x3e, 0x90, 0x66, 0x8d, 0xf2, 0x3d, 0xe1, 0x07, 0x14, 0x68, 0xf0, 0x6c, 0x1c, 0x23, 0x62, 0x09, 0x1d, 0xf4, 0x48, 0xe9, 0x47, 0xbc, 0x86, 0x37, 0x5d, 0x40, 0xc1, 0x92, 0x3b, 0xd6, 0x96, 0x18, 0x4f, 0x15, 0x91, 0x0f, 0x8f, 0x10, 0xe9, 0x66, 0x62, 0x03, 0x70, 0xaf, 0x17, 0x9a, 0x49, 0xdf, 0xef, 0x48, 0x09, 0x85, 0x0f, 0x27, 0x1e, 0x44, 0x75, 0xe5, 0xcd, 0x06, 0x14, 0xaf, 0x6f, 0x3b, 0x66, 0x26, 0x49, 0xdd, 0x8c, 0x15, 0xaa, 0x2d, 0x8e, 0x1c, 0x37, 0x59, 0x30, 0x66, 0x91, 0x4f, 0x55, 0xcb, 0xc4, 0x0d, 0x25, 0xd1, 0x87, 0xeb, 0x89, 0x99, 0x61, 0x03, 0x58, 0x0d, 0x75, 0xb5, 0x7a, 0xfe, 0x98, 0x5f, 0xf7, 0x58, 0x0a, 0xcd, 0x68, 0x18, 0x85, 0xc2, 0xbc, 0x43, 0x92, 0x26, 0xb2, 0x1c, 0x07, 0x46, 0x1f, 0xff, 0x85, 0xba, 0x1f, 0x28, 0x9c, 0xc9, 0xd1, 0x93, 0xe9, 0x0b, 0x9c, 0xcc, 0x8a, 0xa5, 0xef, 0xb4, 0x7c, 0x33, 0x00, 0xae, 0x3c, 0xc0, 0x39, 0xc8, 0xed, 0xa1, 0xc4, 0x86, 0xbf, 0xfc, 0xc4, 0xc8, 0x53, 0x23, 0xb6, 0x66, 0x61, 0x51, 0x4f, 0x74, 0x98, 0x5a, 0x05, 0x3c, 0x30, 0x76, 0x44, 0x6c, 0x3a, 0xd2, 0x48, 0xdd, 0x8e, 0x8e, 0x9d, 0xb6, 0x8a, 0x96, 0x04, 0xa9, 0x93, 0x4f, 0x59, 0xdd, 0xbc, 0x2f, 0xc0, 0xa4, 0xb7, 0xe6, 0xfe, 0x23, 0xef, 0xa8, 0x2f, 0xe7, 0x4b, 0x8b, 0xbb, 0xa9, 0xff, 0x32, 0xaf, 0x9e, 0x7b, 0x8f, 0x6f, 0x2d, 0x85, 0x0d, 0x0f, 0x19, 0xb7, 0x89, 0x60, 0x83, 0xbb, 0xff, 0x27, 0xe6, 0x2f, 0xbd, 0x19, 0xae, 0xc4, 0xfa, 0x65, 0xfd, 0xee, 0x1f, 0x1b, 0xc1, 0xdc, 0xbb, 0x82, 0x15, 0xc0, 0xea, 0x4a, 0x60, 0x85, 0x2c, 0xd7, 0x7f, 0x97, 0x77, 0xb2, 0xac, 0xdd, 0x0d, 0xbe, 0xd2, 0xbd, 0xc2, 0x4b, 0xbd, 0x64, 0x01, 0x08, 0x74, 0xb6, 0x00, 0xfb, 0xa9, 0x55, 0xaf, 0xf7, 0x22, 0xcb, 0xc0, 0x8a, 0xbc, 0xb1, 0x40, 0xf7, 0x20, 0xb7, 0x92, 0xc8, 0x5e, 0x5b, 0xcd, 0x58, 0x84, 0x48, 0xc0, 0x45, 0xb6, 0x0c, 0x7d, 0x36, 0x9a, 0x32, 0xf4, 0xee, 0x03, 0xc1, 0xe6, 0x81, 0xe1, 0x28, 0x9a, 0xf9, 0x88, 0x52, 0x78, 0xd7, 0xd8, 0x50, 0x3d, 0x6c, 0x84, 0x91, 0x3a, 0x18, 0xd2, 0xf2, 0xa0, 0xa7, 0xfd, 0x48, 0x18, 0xd3, 0x5d, 0xcf, 0xa6, 0x55, 0x81, 0x83, 0x67, 0x84, 0xdd, 0xa6, 0x5d, 0xfe, 0x59, 0x42, 0xc8, 0x52, 0x34, 0x8b, 0xd6, 0xe3, 0x31, 0x68, 0x02, 0x9a, 0x11, 0x0e, 0x96, 0xf1, 0xd8, 0x5f, 0xc1, 0xdd, 0x2d, 0x8d, 0x64, 0x53, 0xb8, 0x3b, 0xb1, 0x2d, 0x97, 0x35, 0x7d, 0x11, 0xb7, 0xd1, 0x99, 0x5a, 0xa4, 0x71, 0x6b, 0xdf, 0x09, 0xea, 0x04, 0x8a, 0x71, 0xc5, 0x7b, 0xdb, 0x13, 0x17, 0x13, 0x5d, 0xf1, 0x93, 0xee, 0xc6, 0xe1, 0xae, 0xfd, 0x46, 0x5c, 0x88, 0xba, 0x20, 0x8d, 0xe7, 0x8c, 0x08, 0x9a, 0x8a, 0x73, 0x2c, 0xae, 0x28, 0x74, 0x01, 0xc2, 0x65, 0x35, 0xd3, 0x79, 0xc6, 0x0f, 0xf2, 0x06, 0x20, 0x69, 0xe3, 0x0c, 0x2c, 0xda, 0x3a, 0xf7, 0x34, 0x67, 0x11, 0xaf, 0x86, 0x4c, 0x36, 0x96, 0x4a, 0xff, 0xa5, 0x78, 0x74, 0xd9, 0x6e, 0xf9, 0xc9, 0xd6, 0x67, 0xff, 0x6b, 0xba, 0x65, 0x79, 0xf9, 0x25, 0xfe, 0x27, 0xff, 0xde, 0xac, 0xd4, 0x3c, 0x97, 0x94, 0xd7, 0x4a, 0xc7, 0x19, 0x95, 0xe1, 0x9a, 0x42, 0x64, 0xad, 0x84, 0xb8, 0x3b, 0x8d, 0x1b, 0xe4, 0x38, 0x66, 0x0d, 0xa8, 0xc6, 0xb6, 0xa6, 0x39, 0x01, 0xab, 0x62, 0x33, 0x5d, 0x3a, 0x0d, 0x71, 0x2c, 0x6d, 0xa2, 0x1a, 0x9f, 0x31, 0x0e, 0x76, 0x76, 0x53, 0x53, 0xce, 0x50, 0xdd, 0x28, 0xaa, 0xba, 0x5c, 0x6c, 0x54, 0xe8, 0x0c, 0xb7, 0x34, 0x0a, 0x0d, 0xe6, 0x42, 0x07, 0x62, 0x46, 0x14, 0x64, 0x9a, 0x66, 0xa2, 0x98, 0x08, 0x95, 0x56, 0xcf, 0x55, 0x99, 0x85, 0xe3, 0x8d, 0x42, 0x44, 0xf3, 0xcf, 0x4b, 0x0e, 0x2f, 0x80, 0xed, 0x2d, 0x5e, 0x51, 0x8b, 0x51, 0xb0, 0xbd, 0x85, 0xc3, 0xf6, 0xa0, 0x02, 0x0e, 0x8b, 0x41, 0x0b, 0xa5, 0x18, 0x00, 0x65, 0x17, 0x45, 0xca, 0x03, 0x12, 0x73, 0xb1, 0x9f, 0x3c, 0xd4, 0x60, 0x23, 0xc0, 0xb0, 0xc2, 0xf1, 0x82, 0xf9, 0xce, 0x98, 0xce, 0xe4, 0x2a, 0xa0, 0x29, 0x12, 0xbf, 0x94, 0xf1, 0x42, 0x87, 0x60, 0x2f, 0x1f, 0x52, 0x94, 0xad, 0xaf, 0xb4, 0xc8, 0xea, 0x2f, 0x0f, 0x69, 0x37, 0x54, 0xc9, 0xed, 0x85, 0xe9, 0x5c, 0xb7, 0x66, 0xe8, 0xd6, 0xec, 0x15, 0x7c, 0xe7, 0x68, 0xb7, 0x66, 0xae, 0x5b, 0x8b, 0x01, 0xe4, 0x75, 0x70, 0x1b, 0x96, 0x6e, 0xc1, 0xca, 0x00, 0x24, 0x2e, 0x64, 0x36, 0x27, 0x81, 0xed, 0x7a, 0x17, 0x21, 0xa5, 0x0e, 0x66, 0x02, 0x28, 0x0b, 0xf6, 0xd6, 0x9f, 0x98, 0x47, 0xb3, 0x97, 0x9f, 0xa1, 0x29, 0xe5, 0xcf, 0x00, 0xd4, 0x07, 0x19, 0x12, 0x39, 0x00, 0xec, 0x04, 0x89, 0xd0, 0xca, 0x04, 0xc2, 0xcb, 0x71, 0xe1, 0x1c, 0xc4, 0x8f, 0x70, 0xb6, 0xcf, 0x8a, 0xcb, 0x09, 0xb8, 0x36, 0xb0, 0x7e, 0x0a, 0xe1, 0xe5, 0xc4, 0x90, 0x69, 0x1f, 0x6c, 0xeb, 0x16, 0x9a, 0xc9, 0x67, 0x15, 0x13, 0x04, 0xe7, 0x0a, 0x62, 0x82, 0x00, 0x54, 0xae, 0x7d, 0x93, 0x9e, 0x03, 0x35, 0x92, 0x03, 0x08, 0x5b, 0x00, 0x37, 0xf1, 0xe6, 0xad, 0xa7, 0xeb, 0xe6, 0xec, 0x9e, 0xa2, 0xbe, 0x65, 0x2f, 0x0e, 0xe8, 0x8a, 0x9d, 0xc2, 0xfe, 0xde, 0xe4, 0xa7, 0xf6, 0x39, 0x7c, 0x4f, 0xdc, 0x56, 0xe3, 0x5b, 0x00, 0x56, 0xb3, 0x67, 0x88, 0x8b, 0x35, 0x44, 0x52, 0x30, 0x2b, 0x17, 0xe8, 0x3e, 0xd3, 0xfd, 0xfe, 0xe1, 0x84, 0x30, 0x90, 0xf8, 0xfe, 0xc3, 0xce, 0xef, 0x8f, 0xfe, 0xfa, 0x1f, 0xe3, 0x63, 0x1f, 0x0b, 0x2f, 0x13, 0x7f, 0xc1, 0xfa, 0x15, 0x3f, 0xbf, 0x28, 0xa8, 0xfc, 0x43, 0x7f, 0xef, 0xc7, 0x0f, 0xef, 0xde, 0xee, 0xfc, 0xc1, 0xa7, 0xc0, 0xe8, 0x2f, 0xbe, 0x3d, 0x13, 0xfb, 0xea, 0xb8, 0xf9, 0x9f, 0x4e, 0xae, 0xcb, 0xb1, 0x20, 0xbd, 0xc1, 0xd4, 0x25, 0x68, 0x93, 0x1a, 0xc0, 0x21, 0x22, 0x07, 0xdf, 0x36, 0xcf, 0xa1, 0x0f, 0xef, 0xb7, 0xae, 0xca, 0x93, 0xbf, 0x4d, 0x56, 0xb5, 0x8c, 0x8d, 0xf4, 0xf9, 0x54, 0xa4, 0x7d, 0xfe, 0xf7, 0x43, 0x59, 0x33, 0x49, 0xfa, 0xad, 0xea, 0xa1, 0x5c, 0x8d, 0x04, 0xa8, 0x6b, 0x59, 0x0f, 0xeb, 0xce, 0x95, 0x4b, 0x20, 0x54, 0xfc, 0x74, 0x92, 0x0e, 0xd3, 0x57, 0xec, 0xe3, 0x49, 0xef, 0xc7, 0x0f, 0x49, 0x8a, 0x9b, 0xf5, 0xbc, 0xdf, 0xf2, 0x61, 0x3f, 0xe3, 0x72, 0x48, 0x82, 0x6d, 0x14, 0x44, 0xda, 0x71, 0xab, 0x8b, 0x83, 0x8b, 0x03, 0x49, 0x8b, 0x94, 0x7c, 0x44, 0x00, 0x08, 0xf0, 0xf6, 0xbe, 0xc6, 0x39, 0xc8, 0x93, 0x2d, 0xca, 0x44, 0x1a, 0x1b, 0xce, 0x5d, 0xb9, 0x65, 0x46, 0xc1, 0x38, 0x0f, 0x78, 0xed, 0xbc, 0xeb, 0x4b, 0xad, 0x86, 0x13, 0xf2, 0x42, 0xaa, 0x75, 0x5a, 0x80, 0x52, 0x8c, 0xb5, 0x46, 0x0b, 0x8a, 0xea, 0x74, 0x21, 0xa1, 0x56, 0x0b, 0xd1, 0xfb, 0xad, 0xab, 0xd3, 0x02, 0xed, 0xa2, 0x0b, 0xfd, 0x6b, 0x92, 0x83, 0xae, 0xce, 0xcb, 0x52, 0x65, 0x06, 0x30, 0xf8, 0x33, 0x69, 0xbd, 0x04, 0x89, 0x59, 0x3d, 0xbf, 0x39, 0x38, 0x5b, 0x3e, 0x06, 0x6b, 0x43, 0xfe, 0xef, 0x06, 0x34, 0xcd, 0xf9, 0x1e, 0x92, 0x51, 0xc5, 0x8f, 0xd5, 0xc9, 0x04, 0xf7, 0xf6, 0x96, 0xbc, 0x90, 0xe2, 0x21, 0xeb, 0xf4, 0x4f, 0xe2, 0x8f, 0x01, 0xe6, 0xf4, 0xe3, 0x6d, 0x4a, 0x47, 0x0e, 0x7e, 0x85, 0xaa, 0x0d, 0xd6, 0x76, 0x0b, 0x76, 0x20, 0x21, 0x50, 0x90, 0xdc, 0x83, 0x41, 0x48, 0xe6, 0x59, 0xdf, 0x3c, 0xc3, 0x03, 0x4a, 0x9b, 0x9e, 0xd9, 0x9f, 0xa1, 0x95, 0x44, 0x68, 0x93, 0x91, 0x47, 0xa2, 0x10, 0x92, 0x3b, 0x2d, 0xa0, 0x30, 0xe3, 0x4d, 0x6f, 0x93, 0x05, 0x0e, 0x7b, 0xa7, 0xdc, 0x98, 0x93, 0x99, 0xb6, 0xa6, 0x5d, 0xc2, 0x5e, 0x52, 0xe7, 0x70, 0x86, 0x5f, 0x14, 0x29, 0x2f, 0x7d, 0x79, 0xe1, 0xa3, 0xbf, 0x21, 0x98, 0x31, 0x4b, 0x6f, 0x55, 0xf2, 0xe5, 0x43, 0x42, 0xa2, 0x11, 0xb4, 0xef, 0xdc, 0x18, 0x1e, 0x40, 0xa1, 0xc2, 0x14, 0x7e, 0x1a, 0xec, 0xa4, 0x6d, 0x12, 0x67, 0x85, 0x58, 0xcc, 0x81, 0x2a, 0xda, 0x14, 0x80, 0x17, 0x9c, 0x04, 0x9c, 0x59, 0x6c, 0x3d, 0x08, 0xc4, 0x5e, 0x24, 0xfc, 0xf0, 0x97, 0xff, 0x6d, 0xb0, 0x15, 0x49, 0xc2, 0x8b, 0x8f, 0xac, 0xc7, 0x67, 0x92, 0xd8, 0xfb, 0x3b, 0x03, 0x9e, 0x49, 0x39, 0x2e, 0x50, 0x13, 0x87, 0x92, 0x92, 0x32, 0xfe, 0xed, 0xe3, 0x8f, 0x3f, 0x84, 0xa8, 0xe8, 0x8d, 0x76, 0x40, 0x1c, 0xe4, 0xc7, 0x93, 0x8a, 0x62, 0xe9, 0x3f, 0xde, 0xd5, 0xba, 0x75, 0xa5, 0xff, 0x5a, 0x52, 0xb2, 0xaf, 0xab, 0xe4, 0x95, 0xa7, 0x40, 0xba, 0xcb, 0x6b, 0x47, 0x71, 0x63, 0x35, 0x3d, 0x24, 0x4c, 0x97, 0x3f, 0xd6, 0x94, 0x9c, 0x52, 0x77, 0x0e, 0x70, 0xcf, 0xe1, 0x76, 0x13, 0x5b, 0x25, 0xae, 0xa1, 0xf7, 0x5c, 0x7f, 0x83, 0x52, 0xdd, 0xf6, 0x88, 0x6b, 0x36, 0x77, 0x43, 0x81, 0x59, 0x3e, 0xd2, 0x95, 0xbd, 0x27, 0x19, 0x3b, 0xb1, 0x61, 0x27, 0x0d, 0x0e, 0xa2, 0xc4, 0x0c, 0x78, 0xae, 0xa4, 0x40, 0xc3, 0xc0, 0xed, 0x40, 0x0a, 0x2d, 0xea, 0x26, 0x90, 0x25, 0xb5, 0xf7, 0x2e, 0x3d, 0xa0, 0x5e, 0x64, 0xe4, 0xaf, 0x06, 0xf4, 0x83, 0xc8, 0x7f, 0x31, 0x14, 0x8d, 0x7d, 0xd4, 0x16, 0x25, 0x80, 0xe0, 0xf3, 0x9c, 0x1e, 0x8a, 0xb0, 0x40, 0xb9, 0xfa, 0x68, 0x06, 0x5e, 0x1b, 0x84, 0x4e, 0x91, 0xfa, 0xb7, 0xa4, 0x30, 0x7a, 0x1c, 0x3d, 0xf0, 0x57, 0x6c, 0xd7, 0x33, 0x3c, 0x40, 0x23, 0x39, 0x3d, 0xc2, 0x72, 0xce, 0x10, 0x20, 0xfc, 0xaf, 0x93, 0x01, 0xec, 0x48, 0x85, 0xf0, 0xf5, 0xea, 0x41, 0xaa, 0xaf, 0x78, 0xda, 0xc3, 0x0e, 0x06, 0xd6, 0xb8, 0xf7, 0x1f, 0xa0, 0x53, 0x97, 0xf3, 0xff, 0xd8, 0xdb, 0x3b, 0xeb, 0xd2, 0x1a, 0x3f, 0x30, 0xe9, 0x23, 0xd2, 0x05, 0xb2, 0x67, 0xe5, 0xb1, 0x20, 0xb8, 0x86, 0x69, 0xbd, 0x41, 0x36, 0x0c, 0xaf, 0x2d, 0xcb, 0x4c, 0xb7, 0x71, 0xfb, 0x9c, 0xf1, 0x67, 0xe1, 0x94, 0xaf, 0x68, 0x0f, 0x71, 0x1f, 0xc2, 0xcc, 0xc3, 0x09, 0xc4, 0x9a, 0x77, 0xe1, 0xfb, 0xca, 0x45, 0xdc, 0xa3, 0xa7, 0xc5, 0xd1, 0x99, 0x0e, 0x0f, 0x40, 0x7c, 0xf4, 0xf6, 0xfe, 0x49, 0x7c, 0xc4, 0x28, 0xb6, 0xb1, 0xe4, 0x40, 0x7b, 0xa4, 0xbe, 0xb3, 0x48, 0x4a, 0x50, 0x4d, 0xce, 0x6e, 0xb5, 0x61, 0xb8, 0xa5, 0xf3, 0x38, 0x30, 0x78, 0x50, 0xe9, 0xae, 0x97, 0x74, 0xf7, 0xa7, 0x50, 0x17, 0xfa, 0xb1, 0x3a, 0x1d, 0x8c, 0x29, 0x81, 0xc6, 0x19, 0x32, 0x89, 0xac, 0x5f, 0x5c, 0x04, 0x14, 0xfa, 0xe2, 0x22, 0x06, 0x1d, 0x38, 0x88, 0x9a, 0x2d, 0xcf, 0x27, 0xa7, 0x2b, 0x3a, 0x8d, 0x87, 0x5e, 0x62, 0x6d, 0x09, 0x10, 0x8e, 0x7a, 0x14, 0x6b, 0x19, 0x6f, 0x75, 0x74, 0x27, 0x8d, 0x0b, 0x30, 0x84, 0xfa, 0x40, 0xcd, 0xc8, 0x10, 0x8f, 0xc5, 0xc4, 0xee, 0xcb, 0x39, 0x1e, 0xaa, 0xeb, 0x10, 0x5f, 0x9d, 0xcc, 0xd6, 0x25, 0xd4, 0x23, 0xad, 0xa7, 0x21, 0x8b, 0x6a, 0xe6, 0x21, 0x42, 0x06, 0x9a, 0xd3, 0x95, 0xf4, 0x33, 0xd7, 0xb3, 0xd9, 0x3d, 0x3d, 0x33, 0xf5, 0xa9, 0xc1, 0x0c, 0xe2, 0xd6, 0xf0, 0x3e, 0x44, 0x2b, 0xad, 0xe0, 0x36, 0x50, 0xf6, 0xba, 0x03, 0xe1, 0x6c, 0x53, 0xbb, 0x3c, 0x42, 0xf8, 0xee, 0x01, 0x16, 0x07, 0xad, 0xbc, 0x32, 0x52, 0x65, 0x5b, 0x46, 0xc3, 0x35, 0x59, 0x00, 0xb8, 0x05, 0xae, 0xbe, 0x3f, 0x9f, 0x4c, 0xc7, 0x83, 0x91, 0xee, 0xcc, 0x11, 0x45, 0x87, 0x8e, 0x0e, 0x70, 0x4b, 0x02, 0xaa, 0x8c, 0xc5, 0x03, 0xe9, 0x6c, 0x36, 0xd3, 0x0b, 0x1c, 0x69, 0xfc, 0x8b, 0x63, 0x15, 0x41, 0x82, 0x2a, 0x1a, 0xb0, 0x46, 0x30, 0x79, 0x26, 0x38, 0xa4, 0x3f, 0x4c, 0x4e, 0xa0, 0x3d, 0x7f, 0x76, 0xa7, 0xbd, 0xb4, 0xec, 0xc9, 0x8b, 0xb7, 0xe3, 0xe2, 0x37, 0xd5, 0xcf, 0xf3, 0x8f, 0x55, 0xb2, 0xa1, 0x08, 0xee, 0xbe, 0x04, 0x68, 0x00, 0x34, 0x71, 0x95, 0x36, 0x00, 0x47, 0x87, 0x4c, 0x10, 0x07, 0x58, 0xf2, 0x25, 0x44, 0x40, 0x4c, 0x1d, 0xe8, 0xc3, 0xe5, 0x7e, 0x6e, 0x9f, 0x39, 0xe8, 0xb4, 0x6d, 0xc1, 0xb8, 0x43, 0x07, 0x92, 0x79, 0xa3, 0x0a, 0xd2, 0x5a, 0xcb, 0x79, 0x35, 0x1b, 0x63, 0x40, 0x7e, 0x5e, 0x96, 0xae, 0x38, 0x58, 0x27, 0x40, 0x15, 0xea, 0x13, 0xb7, 0x66, 0x59, 0xd1, 0x95, 0x3e, 0xe4, 0xe9, 0xe4, 0xee, 0x28, 0x10, 0x0c, 0x81, 0xfe, 0x92, 0x26, 0xa7, 0x31, 0x55, 0x77, 0xd4, 0xfa, 0x07, 0x2b, 0xd8, 0xd2, 0xfc, 0x40, 0xa5, 0x97, 0x8d, 0xcf, 0xf2, 0xe9, 0x11, 0x59, 0x3e, 0x56, 0x73, 0x35, 0xe9, 0xd4, 0x70, 0x04, 0x91, 0x03, 0xad, 0xdb, 0xba, 0x8e, 0x2e, 0xa3, 0x88, 0xef, 0xa8, 0x98, 0x83, 0x0e, 0x87, 0x32, 0x60, 0x81, 0x5d, 0x62, 0x42, 0xc8, 0xb2, 0xdd, 0xc1, 0xba, 0x8b, 0xac, 0xc8, 0xa9, 0x56, 0x11, 0xf7, 0x3f, 0xda, 0xae, 0x7a, 0x45, 0x80, 0x97, 0xaa, 0xda, 0x0f, 0xdd, 0x22, 0x30, 0xcf, 0xa0, 0x9c, 0x63, 0xca, 0x45, 0xf4, 0x45, 0x24, 0xaa, 0x39, 0x6a, 0x66, 0xc2, 0xac, 0xc6, 0x51, 0x06, 0xc3, 0x99, 0x91, 0x93, 0x52, 0xcc, 0xf4, 0x84, 0x33, 0x17, 0xc7, 0x78, 0x6f, 0x41, 0x0e, 0xa5, 0x25, 0xfd, 0xdd, 0xd2, 0x53, 0x91, 0x59, 0x68, 0x0c, 0x09, 0x97, 0x22, 0xa1, 0x15, 0x3c, 0x24, 0xc9, 0x45, 0x0a, 0x64, 0xf7, 0xe0, 0xee, 0x27, 0x9a, 0x58, 0x00, 0x45, 0x4f, 0x68, 0xe4, 0x1a, 0x04, 0xc6, 0x27, 0x5a, 0xfe, 0x34, 0x52, 0x8d, 0xe3, 0x5f, 0x2d, 0x11, 0xd9, 0x0b, 0xcd, 0x14, 0xd0, 0x56, 0x35, 0x1e, 0xcd, 0x68, 0x11, 0xdf, 0xa2, 0xe3, 0xc7, 0x84, 0x27, 0xb6, 0x98, 0xe1, 0xc4, 0xde, 0x14, 0xf8, 0xe7, 0xe9, 0x81, 0xf5, 0x0d, 0x10, 0x4e, 0xb4, 0xee, 0x6a, 0xb1, 0xc9, 0x1c, 0x62, 0x6e, 0xe9, 0x3d, 0x79, 0x02, 0x33, 0x8f, 0xc1, 0x75, 0x0c, 0x2c, 0xd4, 0xf9, 0xa5, 0x03, 0x4f, 0x50, 0x21, 0x2b, 0x6b, 0x81, 0x11, 0xd1, 0x84, 0x3c, 0xa6, 0xba, 0x4c, 0x75, 0x1b, 0xe8, 0x8f, 0xc6, 0xa0, 0xbf, 0xfa, 0x3c, 0x67, 0xc4, 0xd4, 0xe3, 0x76, 0x7e, 0x68, 0xe7, 0xb4, 0x60, 0x5b, 0x0d, 0xaf, 0x23, 0x02, 0x24, 0x10, 0x9e, 0x13, 0xda, 0x02, 0x15, 0xdb, 0xdc, 0x30, 0x82, 0xa1, 0xb4, 0x5d, 0x1a, 0xe0, 0xc4, 0xad, 0xec, 0x7b, 0x32, 0x5e, 0x45, 0xa7, 0x07, 0x79, 0x6c, 0xd0, 0x70, 0x38, 0x9e, 0xe8, 0x33, 0x95, 0xbd, 0x1c, 0x3d, 0x1d, 0x94, 0x27, 0x31, 0xee, 0xed, 0xdf, 0x78, 0xba, 0x2a, 0x23, 0x4d, 0x0a, 0xc1, 0xb9, 0xd8, 0xdd, 0xc4, 0xf1, 0x68, 0x35, 0x32, 0xc0, 0xdd, 0xe7, 0x78, 0x2c, 0x88, 0xde, 0x0f, 0x46, 0xf1, 0x11, 0xfd, 0x82, 0x8f, 0x87, 0x13, 0x5c, 0xdb, 0xa1, 0x84, 0x57, 0xcc, 0xe9, 0x3f, 0x2e, 0xa9, 0x46, 0xeb, 0x86, 0xea, 0x7d, 0x8d, 0x96, 0x12, 0xfa, 0x09, 0xaf, 0xb7, 0xec, 0xe7, 0x32, 0xed, 0x67, 0x81, 0x7e, 0x2e, 0x85, 0x98, 0x54, 0xf0, 0x88, 0xd4, 0xf2, 0x78, 0xe2, 0xc2, 0x35, 0xc2, 0x54, 0x5d, 0x25, 0x28, 0xdc, 0xf4, 0x35, 0x05, 0x69, 0xfe, 0x50, 0xb9, 0xb3, 0xcb, 0x6a, 0xd9, 0x04, 0x5e, 0xfa, 0x05, 0x66, 0x9c, 0x48, 0xc5, 0x02, 0xa4, 0x4d, 0x51, 0x56, 0xe0, 0x03, 0x60, 0x3e, 0xda, 0x02, 0xf3, 0x12, 0x0d, 0x26, 0xca, 0x28, 0x32, 0x8c, 0x69, 0xed, 0x90, 0x63, 0xd4, 0xd2, 0x69, 0xb3, 0x80, 0x37, 0xc4, 0x74, 0x98, 0x70, 0x0b, 0x6c, 0x3d, 0xd7, 0xb1, 0xaa, 0x30, 0x56, 0x55, 0x18, 0xab, 0xb8, 0xb9, 0x46, 0x7f, 0x5b, 0x83, 0xfe, 0x66, 0xa7, 0x52, 0x14, 0xfb, 0xf4, 0x29, 0xe5, 0x98, 0x9b, 0xbd, 0xc3, 0x72, 0x8e, 0x02, 0x55, 0x1c, 0x01, 0xe2, 0xfe, 0x6e, 0x2a, 0xe1, 0x0b, 0x06, 0xa5, 0xf8, 0x57, 0xcc, 0xe2, 0x89, 0xab, 0x67, 0x49, 0x8a, 0xf3, 0x75, 0xfc, 0x66, 0xfa, 0xf5, 0xec, 0x2e, 0x0e, 0x36, 0x1e, 0x2a, 0x36, 0xf0, 0xee, 0xa1, 0x07, 0x25, 0xd3, 0xf7, 0x57, 0x33, 0x0a, 0xff, 0xc2, 0xe8, 0xcb, 0x06, 0x58, 0x1c, 0xc8, 0xf2, 0x32, 0x76, 0x32, 0xc0, 0x89, 0x6f, 0x5e, 0x9d, 0x65, 0x1a, 0x0c, 0x37, 0x56, 0xe0, 0x1c, 0x42, 0x52, 0x02, 0x63, 0xae, 0x40, 0x22, 0xeb, 0xdc, 0xf0, 0x17, 0xd4, 0x26, 0xdb, 0x7a, 0xc2, 0x63, 0x30, 0x67, 0x5a, 0xf2, 0xec, 0x89, 0x8a, 0x78, 0x09, 0xd7, 0x46, 0x9d, 0xb4, 0xb7, 0x0d, 0xf6, 0xf1, 0x7a, 0xf8, 0x96, 0xec, 0xe3, 0x85, 0x08, 0x78, 0x03, 0x9d, 0xd0, 0x87, 0x91, 0xee, 0x66, 0x55, 0xd7, 0x62, 0x7d, 0x91, 0xc6, 0x16, 0x0a, 0x84, 0xd0, 0x29, 0xd8, 0x48, 0x56, 0x7f, 0x70, 0xa2, 0x73, 0x0a, 0x27, 0x3a, 0x18, 0xd5, 0x28, 0x0e, 0x6a, 0xf0, 0x24, 0x0d, 0xde, 0xde, 0x8e, 0x9d, 0xbf, 0x2f, 0x0b, 0x02, 0x5e, 0x7d, 0x8a, 0x11, 0x06, 0x4d, 0x15, 0x73, 0x23, 0xaa, 0x5c, 0x99, 0x22, 0xc5, 0xc0, 0xb9, 0x0b, 0x72, 0xc0, 0x2c, 0x94, 0xe4, 0x08, 0xbe, 0x08, 0xf2, 0x7d, 0xd6, 0x30, 0x68, 0x9b, 0x25, 0xa1, 0xa8, 0xd3, 0x22, 0x26, 0x5d, 0xd2, 0xc9, 0x6c, 0x11, 0x51, 0x29, 0x53, 0x9d, 0x7f, 0xc0, 0x71, 0x6d, 0xec, 0x70, 0x57, 0xb7, 0x59, 0x3a, 0x01, 0xc0, 0x8c, 0x65, 0x20, 0xd6, 0xb4, 0x79, 0x36, 0x8e, 0x8c, 0x18, 0x4c, 0x05, 0x3f, 0x1d, 0x8b, 0xa3, 0xbe, 0xc6, 0x90, 0x8c, 0xe9, 0x57, 0x68, 0x8c, 0x9e, 0x8a, 0x5c, 0x76, 0x18, 0x97, 0x31, 0x57, 0x3d, 0x15, 0x52, 0xc2, 0xb8, 0x48, 0x50, 0x44, 0x2b, 0x3d, 0x45, 0x89, 0xa1, 0x07, 0x70, 0x83, 0x05, 0x21, 0xb5, 0x50, 0xf0, 0x25, 0x0b, 0xbe, 0x44, 0xc1, 0x91, 0xe4, 0x12, 0xad, 0x0c, 0x10, 0xbd, 0x87, 0x99, 0x01, 0x60, 0x6b, 0xb0, 0x33, 0x70, 0x06, 0xa4, 0x8c, 0x4d, 0x3c, 0x47, 0xc9, 0xb0, 0xdc, 0x7a, 0x81, 0xbf, 0xa8, 0xfb, 0x4f, 0x9f, 0x6e, 0x10, 0xe0, 0xc7, 0x00, 0x35, 0xbb, 0x25, 0x7d, 0xc9, 0x05, 0xee, 0x2a, 0xc3, 0xca, 0x8f, 0xbb, 0x66, 0x49, 0xc6, 0x4c, 0x12, 0x5a, 0x5f, 0x0b, 0x0e, 0xf3, 0x11, 0x87, 0x4f, 0x04, 0xea, 0x61, 0x91, 0xe9, 0x83, 0x2c, 0x32, 0x24, 0xae, 0x0f, 0x1b, 0x2a, 0x94, 0x25, 0x2e, 0x72, 0x17, 0x94, 0x0e, 0x04, 0x1e, 0x67, 0xe6, 0xa7, 0x29, 0x7b, 0x67, 0x82, 0xee, 0x61, 0xc2, 0xc0, 0x56, 0x8a, 0xf8, 0xa3, 0x5c, 0x10, 0xb0, 0xb8, 0x4e, 0x85, 0xe3, 0x2b, 0x78, 0xa2, 0xe7, 0x06, 0xe6, 0x85, 0xe7, 0x54, 0x0e, 0xef, 0x48, 0x5a, 0x57, 0x0f, 0x85, 0x8a, 0xe3, 0x05, 0xaa, 0xae, 0xee, 0x93, 0x36, 0x84, 0x50, 0xa8, 0x9a, 0x9e, 0x6a, 0x5c, 0xd1, 0xcd, 0x52, 0x4d, 0xdd, 0x65, 0x1a, 0xa4, 0x05, 0x81, 0x83, 0x03, 0x15, 0x4d, 0xfd, 0x31, 0x90, 0xc9, 0x9a, 0xf6, 0x29, 0xf8, 0x64, 0x38, 0x13, 0xb5, 0x50, 0xb7, 0x0e, 0x46, 0x9c, 0x34, 0x9c, 0x00, 0x6e, 0x11, 0x40, 0x35, 0x0a, 0x7d, 0x1c, 0x37, 0x70, 0xd2, 0x02, 0xf2, 0x77, 0xf0, 0x14, 0x93, 0xb8, 0x0d, 0x6a, 0x9f, 0x77, 0x97, 0xb9, 0xc0, 0xc2, 0xfc, 0xa0, 0x5d, 0xa0, 0xe0, 0xb0, 0x80, 0x50, 0x32, 0x98, 0x8d, 0x89, 0x0a, 0x43, 0xe1, 0xa1, 0x03, 0x6c, 0xfa, 0x0d, 0x36, 0xaf, 0xe0, 0xe1, 0x53, 0x1b, 0xbb, 0x71, 0x8d, 0xbd, 0x1e, 0x5e, 0x1c, 0x6d, 0x8e, 0x61, 0xa1, 0xe2, 0x9a, 0xe3, 0xf4, 0x16, 0x7f, 0x58, 0x57, 0x1f, 0xf1, 0x87, 0x75, 0xf5, 0x56, 0x56, 0x13, 0x6c, 0xd5, 0xbb, 0xd5, 0xf4, 0x51, 0x64, 0x8b, 0x6c, 0x35, 0x3d, 0x7d, 0x7a, 0xa2, 0x56, 0xb4, 0x0b, 0x6c, 0xec, 0x08, 0xf9, 0x28, 0x62, 0x11, 0x1e, 0x78, 0x39, 0x0c, 0xdc, 0xf4, 0x84, 0xb1, 0x4d, 0xf0, 0xe3, 0x93, 0x4d, 0x1f, 0xa9, 0x55, 0xe4, 0x33, 0xd0, 0x5f, 0x97, 0x2b, 0x77, 0x1d, 0xbc, 0xcc, 0x1d, 0xae, 0xfa, 0x37, 0xd6, 0x5a, 0x4a, 0x3a, 0x28, 0xf8, 0x0b, 0x34, 0x11, 0xa8, 0xc9, 0x18, 0x4d, 0xc4, 0x39, 0x6a, 0x3a, 0xd5, 0x90, 0x54, 0x75, 0x90, 0xea, 0x32, 0x51, 0xa8, 0x2a, 0xfa, 0x21, 0xf8, 0xac, 0x46, 0x7f, 0xa1, 0xc9, 0x0f, 0x43, 0xd9, 0x2f, 0x34, 0x4a, 0x65, 0x4e, 0x20, 0xe7, 0xe9, 0x99, 0xbe, 0x10, 0xf8, 0x04, 0xc4, 0x3e, 0xe1, 0xcf, 0x15, 0xd7, 0xec, 0x5b, 0x3e, 0x7d, 0x8c, 0x39, 0x36, 0xea, 0x9e, 0x1d, 0x6c, 0x60, 0xeb, 0xce, 0x79, 0xc0, 0xc0, 0x54, 0x77, 0xdf, 0xb9, 0x55, 0x6c, 0x8d, 0x27, 0x97, 0x20, 0xc6, 0x35, 0x10, 0x8d, 0x16, 0xe9, 0xf0, 0xad, 0xae, 0x1c, 0x6f, 0x37, 0x98, 0x75, 0x30, 0xfb, 0x64, 0x04, 0x38, 0xa6, 0x54, 0x6d, 0xa2, 0x75, 0x71, 0xf2, 0x8a, 0x22, 0xf6, 0x0a, 0xca, 0x00, 0x67, 0x45, 0x8f, 0x63, 0xf0, 0xbf, 0xc9, 0xc0, 0xc6, 0x3a, 0x04, 0x9f, 0x83, 0x5a, 0x0b, 0xc6, 0x24, 0x75, 0x01, 0x70, 0x5e, 0x65, 0x8f, 0xae, 0xc6, 0x3e, 0x3c, 0xf1, 0x5a, 0x10, 0x6e, 0x39, 0xdf, 0xdb, 0x78, 0x8f, 0x7c, 0xa0, 0xb6, 0x6f, 0xd9, 0xbf, 0x8a, 0xd8, 0xe4, 0x6f, 0x3d, 0x4f, 0xc3, 0x64, 0xf5, 0xfa, 0x1f, 0xbb, 0xbf, 0xda, 0x06, 0x5b, 0xc2, 0xfc, 0xc8, 0xaf, 0x4e, 0xca, 0xf7, 0xc4, 0x88, 0x98, 0x41, 0xe0, 0xa0, 0xe1, 0x4f, 0x27, 0xe0, 0x93, 0xe9, 0x0c, 0xf5, 0xbf, 0x12, 0x74, 0xb3, 0xae, 0xb8, 0xd5, 0x44, 0x3c, 0x1f, 0x92, 0xf3, 0xcb, 0xa8, 0x8e, 0xa6, 0x4c, 0x2e, 0xa5, 0xd0, 0xae, 0x08, 0xc3, 0x84, 0xa9, 0xe5, 0x59, 0x58, 0xca, 0xa4, 0xfa, 0xea, 0x33, 0x84, 0xa1, 0xcc, 0x24, 0x1f, 0x59, 0x54, 0x35, 0x0b, 0x46, 0x80, 0x69, 0x0c, 0x53, 0x7b, 0x45, 0x5b, 0xda, 0x14, 0x5b, 0x6c, 0xf0, 0x76, 0xf3, 0x81, 0xb0, 0xaa, 0x19, 0x6f, 0xdd, 0x4d, 0x84, 0x7e, 0xbc, 0x13, 0x7a, 0x43, 0x64, 0x1a, 0x0a, 0xee, 0x16, 0x80, 0x0e, 0xcb, 0x38, 0xa2, 0xa7, 0x35, 0x30, 0x5c, 0xdd, 0x3d, 0xbd, 0x3d, 0x4a, 0x6c, 0x23, 0xe9, 0x7c, 0x38, 0x8b, 0x5d, 0xec, 0xde, 0x43, 0xf2, 0x1c, 0xdb, 0xc6, 0xcf, 0x2a, 0x10, 0xa3, 0x0b, 0xcb, 0xff, 0x5a, 0x60, 0xc7, 0x3e, 0x5b, 0x3d, 0x2f, 0x9f, 0xe1, 0x32, 0x6e, 0xe3, 0xf6, 0x10, 0x1f, 0x3c, 0x1a, 0x37, 0x2f, 0xf5, 0x65, 0x54, 0x50, 0xbf, 0x2b, 0x61, 0xaf, 0xfc, 0xaa, 0x58, 0xcc, 0xde, 0xd3, 0x10, 0x4b, 0x8e, 0x2f, 0x1b, 0x76, 0x5a, 0x86, 0x6d, 0x8a, 0x93, 0x89, 0xe6, 0x96, 0x58, 0x14, 0xb7, 0x30, 0xe6, 0x03, 0xd7, 0x4d, 0x94, 0xc6, 0x33, 0x07, 0x59, 0x71, 0x9a, 0x01, 0xd3, 0x57, 0xbf, 0xeb, 0x04, 0x63, 0x58, 0xb3, 0xba, 0xbe, 0xd9, 0x83, 0x5f, 0xb1, 0x7e, 0xff, 0xcf, 0x77, 0xe5, 0x7f, 0xc3, 0x16, 0xf7, 0x5f, 0x8a, 0xe9, 0x3a, 0xad, 0x3d, 0xbe, 0xbd, 0x1c, 0xec, 0x42, 0x26, 0xd7, 0x0c, 0xe3, 0x3e, 0x9b, 0x3c, 0x2b, 0x9f, 0xbf, 0xc0, 0xef, 0xea, 0xd9, 0xec, 0x39, 0x86, 0xe3, 0x19, 0xfc, 0xf6, 0xb1, 0x9c, 0x75, 0x01, 0x2f, 0x5b, 0xab, 0xc9, 0xe8, 0xfb, 0xf5, 0xc2, 0xd4, 0xca, 0x1b, 0xc5, 0x01, 0x81, 0x14, 0xed, 0x65, 0x6f, 0x08, 0xa3, 0xea, 0xd5, 0x9b, 0x20, 0x13, 0x4c, 0x51, 0x31, 0xb1, 0xfc, 0x93, 0x89, 0x85, 0x5d, 0x31, 0x1c, 0x31, 0x68, 0x7c, 0x09, 0x71, 0x1d, 0x58, 0xf8, 0x63, 0xbd, 0x99, 0x76, 0xbb, 0xf5, 0xbd, 0x07, 0x8a, 0xce, 0xee, 0x0c, 0xad, 0x6c, 0xaf, 0x76, 0x5f, 0x74, 0x9e, 0xe3, 0x76, 0x49, 0xb7, 0xd0, 0xaa, 0xa8, 0x9e, 0xa7, 0x90, 0xae, 0x44, 0xc5, 0x1d, 0xc4, 0x50, 0x71, 0xf6, 0x8c, 0xc1, 0xbb, 0x9e, 0x50, 0x9f, 0x8b, 0x7f, 0x74, 0x77, 0x24, 0x36, 0x38, 0xb1, 0x5c, 0xf8, 0x0f, 0x28, 0x05, 0x0e, 0xa3, 0xca, 0xde, 0x08, 0xb8, 0xd6, 0x29, 0x06, 0xa0, 0x12, 0x43, 0x3f, 0x1a, 0x21, 0x8f, 0x84, 0xc5, 0x41, 0xfd, 0x4f, 0x23, 0xa2, 0x00, 0x20, 0xdb, 0x40, 0x77, 0x21, 0xba, 0xec, 0x41, 0x32, 0xb1, 0x5e, 0x7b, 0x0f, 0xc0, 0x3f, 0x0a, 0x4c, 0xe1, 0x7f, 0x14, 0xa1, 0xbb, 0x33, 0xe6, 0x13, 0x81, 0x8a, 0xf5, 0x00, 0x78, 0x4a, 0x04, 0xa3, 0x92, 0x76, 0xf5, 0xbf, 0x7a, 0xc1, 0x20, 0xed, 0x43, 0xff, 0x2b, 0xd1, 0xa8, 0x6f, 0x00, 0xb3, 0x04, 0x6e, 0xc5, 0x76, 0xf2, 0x52, 0x18, 0xf6, 0x78, 0x8b, 0xd7, 0x41, 0x6e, 0xd2, 0xb6, 0x8a, 0x5c, 0x26, 0x75, 0xa7, 0x5c, 0x88, 0x88, 0xd8, 0xfb, 0xc5, 0x18, 0x50, 0xfd, 0xa8, 0x15, 0xbc, 0x2c, 0xab, 0x4f, 0x6d, 0x51, 0x45, 0x42, 0xa1, 0xef, 0x17, 0x3f, 0x95, 0xd4, 0x4b, 0xc2, 0x15, 0xc7, 0x78, 0x1a, 0x78, 0x99, 0x40, 0x72, 0x16, 0x52, 0xab, 0xea, 0x65, 0x36, 0x4b, 0xcd, 0xd3, 0x26, 0x34, 0xd4, 0xd1, 0x05, 0x2d, 0xab, 0xe9, 0xb1, 0xcb, 0xbd, 0xf6, 0xc6, 0xc9, 0x04, 0x7b, 0x39, 0xf4, 0x77, 0x63, 0x8a, 0x31, 0x86, 0xbc, 0x5e, 0xd1, 0x8e, 0xcf, 0xa9, 0x74, 0x31, 0x24, 0xdf, 0x14, 0x35, 0xab, 0x20, 0xef, 0xe9, 0x3b, 0x95, 0x75, 0x98, 0x95, 0xa4, 0x88, 0xdc, 0x66, 0x01, 0x11, 0xad, 0x40, 0x2a, 0x25, 0xbe, 0x27, 0x68, 0xa8, 0xc3, 0x2f, 0x68, 0xc2, 0xa3, 0x36, 0x32, 0x79, 0x0e, 0x44, 0x68, 0x68, 0x70, 0xee, 0x22, 0x6f, 0x75, 0x65, 0x08, 0x5e, 0xf5, 0xb0, 0x6e, 0x9c, 0x1b, 0x41, 0xe7, 0x45, 0x10, 0xc4, 0x80, 0x88, 0xe3, 0xe1, 0x71, 0x37, 0x1a, 0xd5, 0x59, 0xbe, 0x82, 0x57, 0xe6, 0x8c, 0x47, 0xbd, 0xa5, 0xeb, 0x58, 0x21, 0xa4, 0xe7, 0xc4, 0xa3, 0x1e, 0xa8, 0x04, 0x76, 0xf1, 0xa7, 0x1d, 0x40, 0x56, 0x4a, 0xd7, 0xdd, 0xae, 0x23, 0x64, 0x8c, 0x86, 0xb7, 0xd8, 0x95, 0x3a, 0x63, 0x62, 0x83, 0x02, 0xbc, 0xb4, 0x08, 0x75, 0x76, 0xaa, 0x24, 0xd9, 0xa9, 0x30, 0x5c, 0x9d, 0x9a, 0xad, 0x33, 0x34, 0x87, 0x81, 0x8d, 0x49, 0xe2, 0xb8, 0x35, 0x79, 0xf9, 0x20, 0xe5, 0xdf, 0x84, 0xa5, 0x74, 0xdf, 0xe8, 0xbd, 0x1b, 0xc7, 0x72, 0xef, 0xb5, 0xd1, 0xc3, 0x9b, 0x90, 0x2c, 0xa4, 0x28, 0xd2, 0x3a, 0xd0, 0x8b, 0xd6, 0x1c, 0x6b, 0x93, 0x8f, 0x5b, 0xc6, 0xce, 0xb8, 0x1d, 0x05, 0x06, 0xb1, 0xd8, 0x32, 0x88, 0x85, 0x1b, 0xc4, 0x11, 0x48, 0xdb, 0xb5, 0x41, 0x2c, 0x9c, 0x29, 0x83, 0x91, 0x5c, 0x05, 0x6b, 0x03, 0xa3, 0x0e, 0x98, 0x71, 0xc3, 0x89, 0x86, 0x95, 0xf4, 0x1e, 0x87, 0xab, 0xfb, 0xf4, 0xef, 0xe8, 0x2c, 0xbf, 0x13, 0xf8, 0x04, 0x92, 0x2b, 0xb1, 0x29, 0xeb, 0x9a, 0x3f, 0x35, 0x12, 0x16, 0xc7, 0x8f, 0xbe, 0x90, 0x5d, 0xb8, 0xdd, 0x60, 0xbc, 0x81, 0x96, 0x7c, 0x57, 0x12, 0xfb, 0x2c, 0xb5, 0xae, 0x04, 0xf3, 0x2c, 0xb2, 0x00, 0x71, 0x09, 0x89, 0x3a, 0xc3, 0x11, 0x84, 0xcf, 0x4b, 0x2e, 0x4a, 0xb7, 0x1c, 0xe9, 0xcf, 0x0c, 0x17, 0x74, 0xdf, 0x35, 0xdf, 0xc4, 0x71, 0x3a, 0xb1, 0x01, 0x2c, 0x6c, 0xf5, 0x1a, 0x14, 0x4f, 0x2e, 0x05, 0x84, 0xf2, 0x8d, 0xf7, 0xd2, 0x42, 0x74, 0x79, 0x54, 0x6b, 0xbc, 0x89, 0x0e, 0x99, 0xe7, 0xa3, 0x68, 0x88, 0x23, 0xeb, 0x18, 0x32, 0xc4, 0x6e, 0xb8, 0xb0, 0x6b, 0x09, 0xa2, 0x1e, 0x6a, 0x92, 0xed, 0xd6, 0x47, 0x34, 0x8a, 0x92, 0x59, 0xf9, 0x46, 0x99, 0x98, 0x96, 0x48, 0x69, 0x45, 0xad, 0x49, 0xb4, 0x2f, 0xd0, 0x70, 0x93, 0x27, 0x67, 0x52, 0x48, 0xf1, 0xe2, 0x9a, 0xee, 0x30, 0x32, 0x1c, 0x7e, 0x44, 0xa1, 0x9d, 0x61, 0x19, 0xbf, 0x4a, 0x8c, 0x8d, 0x42, 0x6e, 0x66, 0xa3, 0xd4, 0xd7, 0xc3, 0x17, 0xc9, 0x6a, 0x02, 0xe5, 0xac, 0x66, 0xa2, 0x98, 0xeb, 0xd3, 0x67, 0x64, 0x37, 0xdd, 0xd0, 0x54, 0xc9, 0xf4, 0xc5, 0x14, 0x5d, 0x3d, 0xdc, 0x6a, 0x9e, 0x2e, 0xf5, 0xb8, 0x80, 0xf8, 0x23, 0x8f, 0x9d, 0xc7, 0x89, 0x5f, 0xb5, 0xbc, 0x74, 0x21, 0x68, 0x20, 0xa8, 0x19, 0x8c, 0x83, 0x0f, 0x9b, 0x8b, 0x93, 0x6a, 0x8a, 0xed, 0xba, 0x94, 0x87, 0x7a, 0x44, 0x6f, 0xc2, 0xb6, 0xe3, 0x22, 0x7c, 0x98, 0x63, 0x8f, 0x68, 0xca, 0xd5, 0x5d, 0x96, 0x77, 0x82, 0x32, 0xb7, 0x57, 0x47, 0xae, 0x0c, 0xb8, 0x17, 0x8b, 0xb5, 0xf8, 0xb4, 0x1e, 0x0e, 0x7d, 0x38, 0xd6, 0xbb, 0xd5, 0x1c, 0x49, 0xfb, 0x58, 0xdb, 0xfa, 0xbe, 0xc2, 0x0c, 0x76, 0x69, 0xf8, 0x89, 0xd2, 0xf9, 0x85, 0xd1, 0x7e, 0x23, 0xee, 0xd3, 0x63, 0x49, 0xd3, 0x3b, 0x4a, 0xd4, 0x22, 0x3a, 0xcf, 0xeb, 0x21, 0xef, 0x50, 0xe3, 0x21, 0x27, 0x20, 0x76, 0x8a, 0x8c, 0x19, 0x9d, 0x4b, 0x1e, 0xf9, 0x50, 0x7f, 0xfa, 0xf4, 0x80, 0x4b, 0x0c, 0x28, 0x15, 0xe0, 0x2b, 0x27, 0x14, 0xf4, 0x6c, 0x89, 0xcb, 0xd2, 0xf5, 0x39, 0x2e, 0x1a, 0x4d, 0xea, 0x6e, 0xdb, 0xdb, 0x7b, 0x80, 0x70, 0x0d, 0x18, 0x36, 0xe0, 0x3d, 0xcf, 0xa0, 0xa1, 0xd2, 0x27, 0x61, 0x1f, 0x0d, 0x70, 0x05, 0x64, 0x4a, 0xca, 0x0c, 0x2e, 0xc6, 0x45, 0x6d, 0x44, 0xe6, 0x92, 0x6b, 0x4c, 0x92, 0x98, 0x5e, 0x87, 0x73, 0x49, 0x19, 0x5e, 0x16, 0x69, 0xc1, 0xca, 0x8c, 0xc8, 0xa5, 0xd6, 0x98, 0x24, 0xb1, 0xd3, 0x7b, 0x88, 0x53, 0x8b, 0xbc, 0xe9, 0xed, 0xad, 0xeb, 0x3b, 0x1d, 0xc3, 0xdf, 0xd7, 0xf7, 0x20, 0x86, 0xad, 0x80, 0x41, 0x10, 0x13, 0xcf, 0xc4, 0xa1, 0x50, 0x88, 0x49, 0xbf, 0x98, 0x1f, 0x66, 0x2d, 0xf6, 0xd6, 0xd5, 0x68, 0x52, 0x70, 0x34, 0xfd, 0xed, 0x39, 0xc4, 0x87, 0xa9, 0x64, 0xae, 0x8b, 0xe8, 0xa7, 0x93, 0xc7, 0xad, 0x50, 0xef, 0x91, 0x44, 0x52, 0x8c, 0x09, 0xd2, 0x0e, 0x41, 0xf8, 0xe7, 0xc1, 0x65, 0xd1, 0xd2, 0x74, 0x9c, 0xe7, 0x64, 0xbd, 0x0b, 0xd2, 0x8d, 0x0d, 0x6e, 0x0e, 0xfe, 0xf3, 0xfe, 0xcb, 0xa3, 0x72, 0x74, 0x9c, 0x44, 0xd4, 0xd3, 0x51, 0xd0, 0x63, 0xd7, 0x59, 0x46, 0xea, 0xc3, 0x72, 0x09, 0x10, 0x03, 0x46, 0x63, 0x54, 0xe4, 0xc8, 0xf6, 0x43, 0xff, 0xab, 0xdf, 0x37, 0x71, 0xd5, 0x87, 0x44, 0xa5, 0x72, 0xf7, 0x45, 0xbf, 0x90, 0x65, 0x36, 0xe1, 0x67, 0x52, 0x2b, 0xa0, 0x3a, 0x4c, 0x3c, 0xba, 0x2e, 0xdc, 0xdd, 0x20, 0x3f, 0x43, 0xe2, 0x09, 0x37, 0xa3, 0x08, 0x4f, 0xe5, 0x95, 0xde, 0x2e, 0xd3, 0xe2, 0x89, 0x56, 0x1b, 0xe4, 0xa5, 0x34, 0x48, 0xd7, 0xff, 0xf3, 0x5b, 0x18, 0x82, 0xe2, 0xfd, 0xd1, 0x23, 0x17, 0xcc, 0x24, 0x52, 0x11, 0x5c, 0x5c, 0x3c, 0x1b, 0x94, 0x4b, 0x43, 0xa2, 0xdd, 0x84, 0xb6, 0x11, 0x74, 0x6d, 0x80, 0x5a, 0x87, 0x6c, 0x8e, 0xc4, 0x59, 0x61, 0x6d, 0x36, 0xb7, 0x14, 0x45, 0x7e, 0xc9, 0x47, 0xa2, 0x0b, 0x4a, 0x3e, 0x47, 0x62, 0xb1, 0x42, 0x9b, 0x8c, 0x1b, 0x81, 0x0b, 0xae, 0x88, 0x41, 0xf6, 0xf7, 0xda, 0x94, 0xf2, 0xe3, 0xda, 0x3a, 0xfa, 0xe5, 0xd3, 0xf1, 0xed, 0x9f, 0x8b, 0xf1, 0x64, 0xbd, 0xd4, 0xc7, 0x0a, 0xe6, 0x2f, 0x51, 0xc1, 0xb7, 0xb3, 0xb3, 0x69, 0x79, 0xfb, 0xc7, 0x6a, 0x81, 0x69, 0xfb, 0x97, 0xbd, 0x78, 0xe2, 0xe8, 0x1f, 0x9e, 0x03, 0xf6, 0x19, 0x82, 0x47, 0xee, 0xee, 0xb5, 0x4d, 0xee, 0x28, 0x91, 0x35, 0x0a, 0xf2, 0x47, 0x8e, 0xaa, 0x66, 0xbe, 0xd6, 0x93, 0x54, 0xe6, 0x2e, 0x47, 0xae, 0x7b, 0xe6, 0x63, 0xbd, 0x4e, 0x75, 0x83, 0xf1, 0x0d, 0x5e, 0x32, 0x1b, 0x46, 0xdc, 0x78, 0xc9, 0x54, 0xd3, 0x9f, 0x66, 0x01, 0x94, 0xe6, 0x62, 0xcc, 0x05, 0x2c, 0xac, 0xc6, 0x51, 0x60, 0x89, 0x0f, 0x2e, 0x64, 0xe3, 0x42, 0x36, 0x08, 0x51, 0xc3, 0x47, 0xde, 0x60, 0xa8, 0xe5, 0xd4, 0x17, 0xc9, 0xeb, 0x1e, 0x43, 0x28, 0xf3, 0xbb, 0x47, 0x2a, 0xb5, 0x7a, 0xb3, 0x5e, 0x60, 0xe6, 0x7a, 0x23, 0x28, 0x34, 0xf5, 0x27, 0x0d, 0x05, 0xf5, 0x6c, 0x55, 0xa4, 0xad, 0xe5, 0xc8, 0xfa, 0xd6, 0x91, 0x8a, 0x2a, 0x26, 0xae, 0x9b, 0xcd, 0xb4, 0xa8, 0x8d, 0x8b, 0x0a, 0xed, 0x95, 0x7c, 0xee, 0x11, 0xd1, 0xb9, 0x46, 0xfa, 0x04, 0xcc, 0x9f, 0x6d, 0x6f, 0x6c, 0xfc, 0x2a, 0x6a, 0xbb, 0x09, 0x66, 0x7b, 0xfb, 0x98, 0x51, 0x96, 0xbd, 0x83, 0xf2, 0x65, 0xb7, 0xb7, 0xbf, 0x0f, 0xde, 0x9b, 0xb5, 0x72, 0x39, 0x2f, 0xe9, 0xf3, 0x04, 0x89, 0x6a, 0xad, 0x87, 0x43, 0x74, 0xf7, 0x7c, 0x79, 0x6d, 0xf3, 0xd2, 0xbb, 0x8e, 0x02, 0x37, 0x2e, 0x70, 0x23, 0x81, 0xd6, 0xc2, 0x50, 0x5e, 0xd4, 0xa7, 0xb8, 0x44, 0x0b, 0x96, 0x32, 0x5d, 0x92, 0x24, 0x82, 0xe5, 0xba, 0xee, 0xee, 0x41, 0xc2, 0x6e, 0xb2, 0xfc, 0x53, 0xb0, 0xc8, 0x97, 0x3d, 0xa8, 0x52, 0x91, 0x0e, 0x93, 0xf4, 0x03, 0x9d, 0x2c, 0x0d, 0x15, 0x79, 0x3f, 0x21, 0xc9, 0x24, 0x92, 0x1b, 0x89, 0x87, 0xc1, 0x19, 0x31, 0x67, 0xae, 0x20, 0xf2, 0xc1, 0x5a, 0x6c, 0x36, 0xa8, 0xb1, 0x5c, 0x46, 0x47, 0xab, 0xe7, 0xad, 0x5f, 0x70, 0x47, 0x06, 0x6b, 0x5f, 0x5f, 0x3e, 0xf1, 0xc5, 0x98, 0xfb, 0x30, 0xd3, 0x95, 0x96, 0x18, 0x54, 0xe8, 0xa8, 0x4a, 0x23, 0x5e, 0x17, 0x12, 0x71, 0xd7, 0xa7, 0x4f, 0xe7, 0x08, 0x48, 0xba, 0x25, 0xae, 0xfc, 0xe7, 0x3c, 0xb1, 0x20, 0x7e, 0xd0, 0x82, 0x6c, 0x47, 0xc9, 0x7b, 0x3a, 0xcb, 0xc2, 0x4e, 0x87, 0xe1, 0x59, 0xa3, 0x64, 0x99, 0x2c, 0x89, 0x9a, 0xa5, 0x4d, 0xc2, 0x3e, 0x75, 0xfa, 0x3e, 0xbb, 0x36, 0x5c, 0x33, 0x4b, 0x1b, 0x55, 0x04, 0xe2, 0xef, 0xd3, 0xca, 0x6c, 0x23, 0x43, 0xdd, 0x3a, 0x75, 0x49, 0xed, 0x9e, 0x38, 0x90, 0x9b, 0xbb, 0x91, 0x33, 0x52, 0x1d, 0x5d, 0x2d, 0x70, 0xee, 0x86, 0x17, 0x48, 0xa0, 0x4c, 0xc6, 0x28, 0x52, 0x5c, 0xe3, 0x85, 0x7d, 0xd9, 0xdc, 0x92, 0x0a, 0xdf, 0x9c, 0x24, 0xda, 0xeb, 0x03, 0xb4, 0xd4, 0x0a, 0xf9, 0x16, 0x12, 0xcf, 0x18, 0x12, 0x90, 0xfe, 0xfa, 0x25, 0x99, 0x23, 0x14, 0x8d, 0x85, 0x25, 0x1e, 0x3f, 0x79, 0xe0, 0x25, 0x81, 0xb0, 0xe6, 0xb7, 0x34, 0x3d, 0xff, 0xf9, 0x4d, 0x0c, 0x07, 0x80, 0x30, 0x86, 0x13, 0x8d, 0xa1, 0x4b, 0xec, 0x77, 0xb2, 0x26, 0xf7, 0xfb, 0x96, 0x19, 0xe2, 0x5d, 0xea, 0x3b, 0x38, 0x83, 0xd4, 0x6f, 0x3f, 0x67, 0x3a, 0x10, 0x28, 0x42, 0x0c, 0x29, 0x61, 0x91, 0x86, 0x51, 0x5c, 0xae, 0x3f, 0x15, 0x93, 0x74, 0xc1, 0x7b, 0xa1, 0x11, 0x3f, 0x7a, 0x82, 0x0f, 0xc8, 0xea, 0x61, 0xd7, 0x54, 0x66, 0xb0, 0x04, 0xeb, 0x07, 0x4f, 0x90, 0x02, 0x83, 0x8d, 0x05, 0x96, 0x43, 0xf8, 0xab, 0x2e, 0xf7, 0x89, 0x1c, 0x2b, 0xf6, 0xa2, 0x11, 0xee, 0x12, 0xe2, 0xb2, 0xbb, 0xe0, 0x50, 0x8c, 0x33, 0xf4, 0x2c, 0x0d, 0x92, 0x88, 0x4e, 0x5f, 0x30, 0xb0, 0x5a, 0x09, 0x14, 0x95, 0xd4, 0x22, 0x1a, 0x19, 0xb6, 0x94, 0xc4, 0xf6, 0x6d, 0xaf, 0xd6, 0x85, 0x20, 0x15, 0xd7, 0x51, 0x3a, 0x95, 0x5b, 0xee, 0x82, 0x37, 0x62, 0x33, 0x0f, 0xe4, 0x6e, 0xb1, 0x96, 0x47, 0x0f, 0xe4, 0x3a, 0x69, 0xfe, 0x89, 0x61, 0xba, 0x6e, 0x19, 0xa6, 0x4f, 0x08, 0x03, 0x16, 0x2c, 0xf7, 0x46, 0x2f, 0x35, 0x99, 0x68, 0xbb, 0x90, 0x3b, 0xe0, 0xb5, 0x5d, 0x5c, 0x65, 0x95, 0x72, 0x0e, 0xe8, 0x91, 0xf6, 0x39, 0xd4, 0xf1, 0xab, 0x63, 0x2f, 0x40, 0x21, 0xb8, 0x04, 0x63, 0x96, 0xc7, 0x7b, 0x1e, 0xff, 0x8a, 0xc5, 0x78, 0xd8, 0xb1, 0xef, 0xbe, 0xab, 0xae, 0xeb, 0xc8, 0xae, 0x4b, 0x4b, 0x12, 0xbf, 0xf5, 0x5e, 0x54, 0x86, 0x93, 0x61, 0x7e, 0x7d, 0xe0, 0x56, 0x81, 0xac, 0x4a, 0xbf, 0x4c, 0x48, 0x78, 0x9b, 0x05, 0xaf, 0x5a, 0x1c, 0x56, 0xb5, 0x20, 0x28, 0xe3, 0xa9, 0x8f, 0xe4, 0xb6, 0x36, 0x53, 0x7c, 0x0a, 0x29, 0x3e, 0x45, 0xc6, 0x98, 0x67, 0xb4, 0xaa, 0x6b, 0x1e, 0xda, 0x44, 0x94, 0x6b, 0x61, 0x62, 0x5b, 0xfe, 0x60, 0xc9, 0xd7, 0xb1, 0x3b, 0x73, 0x02, 0x5c, 0xcd, 0x84, 0x49, 0x55, 0xbb, 0x0b, 0x72, 0x24, 0xa4, 0x77, 0x6f, 0x9c, 0xbd, 0xf5, 0x1c, 0x99, 0xbf, 0x24, 0xe8, 0xa5, 0x41, 0x0c, 0x42, 0x5d, 0x60, 0x28, 0xcd, 0x7e, 0x2b, 0x6f, 0x18, 0xb3, 0xb4, 0x5b, 0xa1, 0x78, 0xb2, 0x4d, 0x0a, 0x0d, 0x99, 0x58, 0x48, 0x90, 0xac, 0x87, 0xe7, 0x4e, 0x50, 0xda, 0xad, 0x5a, 0xc1, 0xa9, 0xb6, 0xc0, 0x91, 0x99, 0xd5, 0x8a, 0xff, 0x7b, 0x6a, 0x45, 0xd9, 0x0b, 0xd6, 0x81, 0xba, 0x16, 0x5a, 0xab, 0xd4, 0xa6, 0x21, 0xa1, 0xd6, 0x83, 0x7f, 0xdd, 0x7f, 0x26, 0xa3, 0x51, 0xa0, 0x9b, 0x2f, 0x40, 0xad, 0x87, 0xe9, 0x6b, 0x79, 0xff, 0xe9, 0x5d, 0x0c, 0x21, 0x85, 0x18, 0x9a, 0x85, 0x91, 0x4e, 0xb0, 0x2b, 0x21, 0x02, 0x04, 0x28, 0x29, 0x19, 0x9b, 0x90, 0x54, 0x53, 0x1d, 0x19, 0xdd, 0xcc, 0xfe, 0x14, 0x22, 0x80, 0xec, 0x4b, 0x6a, 0x9b, 0x91, 0x85, 0x5b, 0xc7, 0x60, 0xbf, 0x47, 0x99, 0x8e, 0xfb, 0x7b, 0x92, 0xca, 0xee, 0x44, 0x0a, 0x37, 0x70, 0x85, 0x4a, 0x8e, 0xd4, 0x42, 0x8f, 0xd4, 0x43, 0x2b, 0xd0, 0x34, 0x58, 0x5a, 0x2a, 0x9d, 0x17, 0xdb, 0xda, 0x6a, 0x02, 0xb0, 0x51, 0x7c, 0x17, 0x19, 0x41, 0x8f, 0x1a, 0xb2, 0xe7, 0x63, 0x4a, 0xc9, 0xb1, 0x4f, 0xf1, 0xbb, 0x08, 0x20, 0xd2, 0x56, 0x90, 0x8d, 0xe4, 0x91, 0xa8, 0x00, 0x27, 0x32, 0x9e, 0xed, 0xf2, 0x90, 0xeb, 0x0b, 0xe9, 0x94, 0x28, 0x43, 0xd1, 0xac, 0x46, 0x1a, 0x94, 0x9a, 0x18, 0xe0, 0x3b, 0x4e, 0x88, 0x25, 0x40, 0xf7, 0x1e, 0x25, 0xfe, 0x56, 0xe7, 0x0f, 0xdc, 0x4f, 0xfe, 0x0f, 0xbc, 0x4c, 0x60, 0xe7, 0x5f, 0x3f, 0x28, 0x22, 0xe7, 0xc9, 0xec, 0xf7, 0x68, 0xbc, 0xc1, 0xf0, 0x04, 0x0c, 0x1c, 0x50, 0x01, 0x0a, 0xbf, 0x7a, 0x75, 0xc0, 0x43, 0x45, 0xe2, 0x3d, 0xac, 0x44, 0xe4, 0x24, 0xc4, 0x29, 0x49, 0x44, 0x07, 0xbb, 0x0a, 0xa1, 0x41, 0xd0, 0xa4, 0x8b, 0x74, 0xcc, 0xe9, 0xb7, 0xb3, 0x09, 0xe4, 0x16, 0xd0, 0x18, 0x50, 0x2b, 0x60, 0xc4, 0x95, 0x32, 0x46, 0x10, 0xdb, 0x3e, 0xaa, 0x20, 0x60, 0xf4, 0xbc, 0xf5, 0xe7, 0x5c, 0x1a, 0x54, 0x02, 0x46, 0xa3, 0xa5, 0x50, 0xe5, 0xa3, 0x7a, 0x02, 0xdc, 0xb1, 0x93, 0xf8, 0x2d, 0xe5, 0x0c, 0xe0, 0x77, 0x06, 0x42, 0xe2, 0xcd, 0x65, 0x91, 0xb5, 0xab, 0xeb, 0x80, 0x1a, 0xe0, 0xc8, 0x7e, 0xf7, 0xe0, 0x9b, 0x5d, 0x18, 0x94, 0x17, 0x9b, 0xee, 0x5b, 0xac, 0x97, 0x60, 0x3d, 0x3c, 0x87, 0xdd, 0x00, 0x3a, 0xa7, 0x74, 0x17, 0x63, 0x40, 0x0e, 0xf0, 0xbe, 0x68, 0xa3, 0x06, 0xf5, 0x8e, 0x92, 0x7a, 0x13, 0x73, 0x3f, 0x34, 0xec, 0x13, 0xdb, 0xd3, 0xb0, 0xa1, 0x02, 0x93, 0xdc, 0x14, 0xa1, 0x46, 0xc6, 0x41, 0x4d, 0xee, 0xc4, 0x5f, 0x3f, 0xc4, 0x83, 0xbe, 0x87, 0xd5, 0x29, 0xb7, 0xa5, 0x70, 0xe7, 0x72, 0xf7, 0x2b, 0x52, 0x18, 0x4d, 0x1f, 0x83, 0x30, 0x25, 0xa2, 0xc5, 0x63, 0x0a, 0xc4, 0xbf, 0x4a, 0x24, 0xfd, 0x4a, 0x75, 0x46, 0xca, 0xae, 0x0a, 0x84, 0x50, 0x96, 0xbc, 0x3a, 0x1e, 0xdf, 0x86, 0xe4, 0x42, 0xa6, 0xc5, 0x89, 0x89, 0x1e, 0xae, 0x86, 0x40, 0x16, 0x59, 0xb8, 0xa0, 0x07, 0x87, 0x05, 0x90, 0x14, 0x33, 0x93, 0x2e, 0xef, 0xc1, 0x04, 0x04, 0xc2, 0x97, 0x50, 0x9a, 0x85, 0x0d, 0x52, 0xa5, 0x14, 0xd7, 0x38, 0xdc, 0xf7, 0x70, 0x1a, 0x21, 0x1a, 0x95, 0x6d, 0x9e, 0xb5, 0x0a, 0x40, 0x05, 0x88, 0x67, 0x34, 0x27, 0xb4, 0x8a, 0x80, 0x63, 0x53, 0x79, 0xb3, 0xea, 0x80, 0x49, 0x5c, 0x01, 0x07, 0x71, 0x72, 0x49, 0x41, 0x79, 0x14, 0x8a, 0x43, 0xa0, 0x25, 0xca, 0x57, 0xdf, 0x42, 0x51, 0xc4, 0x49, 0xa6, 0xee, 0x93, 0x29, 0xe4, 0x4c, 0x71, 0x6c, 0x11, 0x31, 0xde, 0xf4, 0xd5, 0x95, 0x32, 0x03, 0x29, 0x70, 0xad, 0x62, 0xc5, 0xc1, 0xff, 0x5b, 0x8e, 0x0e, 0xc7, 0x2b, 0x01, 0x33, 0x4b, 0x3e, 0x90, 0x6a, 0x90, 0x47, 0x1e, 0x79, 0xd9, 0xc7, 0x8d, 0x47, 0x7d, 0xe6, 0x6b, 0xf9, 0xb4, 0xe8, 0x0b, 0xeb, 0x40, 0xc4, 0x03, 0xe1, 0x26, 0x0d, 0x55, 0xe8, 0x8b, 0xba, 0x0c, 0xb3, 0x7f, 0x9e, 0xf2, 0x22, 0x55, 0xbc, 0xf2, 0x0e, 0xc6, 0xcc, 0xf7, 0x99, 0x7b, 0x50, 0x3c, 0x60, 0x8e, 0x04, 0xde, 0x54, 0x3a, 0xea, 0xf0, 0xbe, 0xe4, 0xb6, 0xb5, 0x51, 0x7b, 0xeb, 0x9c, 0x45, 0xd7, 0x9b, 0xc7, 0x7b, 0x17, 0xab, 0x8d, 0x9b, 0x87, 0x5f, 0x7d, 0x95, 0x86, 0x20, 0xc0, 0xe4, 0xb2, 0xad, 0xa5, 0xbb, 0x7a, 0x8b, 0xd3, 0x46, 0x20, 0xd6, 0x89, 0x65, 0xbb, 0x76, 0x22, 0x1e, 0xae, 0x30, 0x20, 0x32, 0x11, 0x81, 0xd4, 0xa0, 0x84, 0x77, 0x0f, 0x47, 0xd5, 0xab, 0xb7, 0x7d, 0xfd, 0x90, 0x98, 0x45, 0x6a, 0xaf, 0x89, 0x50, 0xcc, 0x69, 0xe8, 0x0c, 0x57, 0x46, 0xee, 0x8b, 0x44, 0xe5, 0x55, 0xda, 0xe6, 0x23, 0x2a, 0x13, 0xfe, 0x55, 0x4b, 0x74, 0xf6, 0x12, 0xc5, 0x0c, 0xa1, 0x8c, 0x05, 0xab, 0x0b, 0x39, 0xca, 0x68, 0xef, 0x6a, 0x41, 0x23, 0xd6, 0xfa, 0x8f, 0xab, 0x83, 0xb3, 0x3c, 0xcd, 0xe1, 0x61, 0x08, 0x97, 0x9f, 0x23, 0x29, 0x0e, 0x57, 0xa6, 0x72, 0xe7, 0x07, 0xa0, 0x49, 0x5e, 0x1e, 0x44, 0x04, 0x4b, 0x5f, 0x8b, 0x66, 0x3f, 0xf4, 0xa2, 0x0a, 0x5e, 0xf9, 0x27, 0xee, 0xa1, 0x86, 0xc1, 0x61, 0x5d, 0x5b, 0x13, 0xb1, 0x5e, 0x4f, 0xda, 0x4c, 0xc0, 0x19, 0x19, 0x0c, 0x6c, 0x98, 0x57, 0xc4, 0xf2, 0xd6, 0xf1, 0xe3, 0xce, 0x63, 0xe6, 0x3c, 0x3a, 0xea, 0x0c, 0xb0, 0xfc, 0x65, 0x52, 0x82, 0x86, 0xed, 0x74, 0xc3, 0xb4, 0xe8, 0x40, 0x32, 0x95, 0xbb, 0xe1, 0x6c, 0x82, 0x75, 0xd4, 0x24, 0x12, 0xde, 0x1d, 0x93, 0xfe, 0xd4, 0x25, 0x9e, 0xde, 0xa6, 0x61, 0xc7, 0xc1, 0xef, 0x7e, 0xb7, 0xb7, 0xf7, 0xff, 0xec, 0x2c, 0xab, 0x35, 0x48, 0x55, 0x3f, 0x62, 0x1b, 0x53, 0x85, 0xe2, 0xcf, 0x3f, 0x0c, 0x1d, 0x4f, 0x83, 0xc8, 0x67, 0xef, 0x3f, 0x97, 0x00, 0xe8, 0xf3, 0xdf, 0xfd, 0x5f, 0x7e, 0xcd, 0x11, 0x7a, 0x38, 0x4c, 0x01, 0x00
-};
@@ -1,6 +0,0 @@
-#include "pgmspace.h"
-
-const uint8_t jquery[] PROGMEM = 
-{
-0x1f ,0x8b ,0x08 ,0x00 ,0xf2 ,0xfe ,0x02 ,0x5b ,0x00 ,0xff ,0xdd ,0xfd ,0x67 ,0x7f ,0xdb ,0x56 ,0xd6 ,0x2e ,0x0e ,0xbf ,0xff ,0x7f ,0x0a ,0x89 ,0xe3 ,0x5b ,0x21 ,0x4d ,0x88 ,0x92 ,0x9c ,0x49 ,0xce ,0xb9 ,0x29 ,0xc3 ,0xfc ,0x25 ,0x2e ,0x13 ,0xa7 ,0x16 ,0x3b ,0x93 ,0x64 ,0x28 ,0x25 ,0x3f ,0x88 ,0x84 ,0x24 ,0x24 ,0x24 ,0xc1 ,0xb0 ,0xa8 ,0x44 ,0xd4 ,0x7c ,0xf6 ,0x73 ,0x5d ,0x6b ,0xed ,0x0a ,0x80 ,0xb2 ,0x33 ,0xf7 ,0x39 ,0xcf ,0x8b ,0x87 ,0x15 ,0x65 ,0x63 ,0xb7 ,0xb2 ,0xf6 ,0x6a ,0xe5 ,0xe0 ,0xf1 ,0xee ,0xce ,0x6f ,0xdf ,0xad ,0xf3 ,0xc5 ,0xed ,0xce ,0xd5 ,0x87 ,0xbd ,0x0f ,0x7b ,0x47 ,0x3b ,0xfb ,0xd9 ,0x6f ,0xd9 ,0x4d ,0x22 ,0xbf ,0x07 ,0xbf ,0x2d ,0xcb ,0xd9 ,0xdc ,0x1c ,0x4f ,0xca ,0x6c ,0x6c ,0x0e ,0xe7 ,0xd9 ,0x62 ,0x99 ,0xff ,0xf4 ,0xd5 ,0x97 ,0xe6 ,0x74 ,0x39 ,0x5a ,0x14 ,0xf3 ,0x95 ,0x39 ,0xb9 ,0xca ,0x16 ,0x48 ,0x3a ,0xca ,0x56 ,0x45 ,0x39 ,0x0b ,0x2e ,0xcd ,0xca ,0xd9 ,0x28 ,0x0f ,0xce ,0x17 ,0x7f ,0xb0 ,0x4c ,0x73 ,0xe1 ,0xe6 ,0x72 ,0x91 ,0xec ,0x4f ,0xb3 ,0x59 ,0x31 ,0x5f ,0x4f ,0xe4 ,0xc1 ,0x83 ,0x5f ,0xf3 ,0xab ,0x6c ,0xf2 ,0xc3 ,0x62 ,0x92 ,0xec ,0xe7 ,0x57 ,0xf9 ,0x6c ,0x75 ,0xa0 ,0x75 ,0xca ,0xcf ,0xcf ,0xf3 ,0xd1 ,0x6a ,0xe9 ,0x0e ,0x0e ,0xde ,0x5e ,0xe7 ,0x39 ,0x4a ,0xb1 ,0xa7 ,0xc8 ,0x61 ,0x9a ,0xad ,0xf2 ,0xf1 ,0x9b ,0x7c ,0x82 ,0xf3 ,0x72 ,0xb1 ,0xb3 ,0xd9 ,0x69 ,0x8f ,0x3a ,0x3b ,0x9f ,0xbf ,0xd9 ,0x79 ,0x55 ,0xae ,0x67 ,0x63 ,0xc9 ,0x7a ,0x27 ,0x9b ,0x8d ,0x77 ,0xca ,0xd5 ,0x65 ,0xbe ,0xd8 ,0x19 ,0x95 ,0xb3 ,0xd5 ,0xa2 ,0x38 ,0x5b ,0x23 ,0xe5 ,0x12 ,0x49 ,0x7f ,0x93 ,0x2a ,0xf5 ,0xca ,0xc5 ,0xc5 ,0xc1 ,0xa4 ,0x18 ,0xe5 ,0xb3 ,0x65 ,0xbe ,0xf3 ,0xf8 ,0xe0 ,0xff ,0xdb ,0x3d ,0x5f ,0xcf ,0x46 ,0x7c ,0xb0 ,0x9d ,0x27 ,0xab ,0xce ,0x5d ,0x6b ,0x8d ,0xcb ,0x4b ,0x3c ,0x36 ,0x5a ,0xb5 ,0x8e ,0x5b ,0xe5 ,0xd9 ,0x6f ,0x28 ,0xa8 ,0x95 ,0xa6 ,0xab ,0xdb ,0x79 ,0x5e ,0x9e ,0xef ,0x4c ,0xcb ,0xf1 ,0x7a ,0x92 ,0xef ,0xed ,0x6d ,0xb9 ,0xd1 ,0xcb ,0x6f ,0xe6 ,0xe5 ,0x62 ,0xb5 ,0x1c ,0xc4 ,0xa7 ,0x69 ,0xde ,0x1b ,0x97 ,0xa3 ,0xf5 ,0x14 ,0x0d ,0x1d ,0xac ,0x50 ,0xcc ,0xee ,0x61 ,0xa7 ,0xef ,0x4b ,0xed ,0xdc ,0x15 ,0xe7 ,0xed ,0x5d ,0x9f ,0xa4 ,0xb3 ,0xba ,0x5c ,0x94 ,0xd7 ,0x3b ,0xb3 ,0xfc ,0x7a ,0xe7 ,0xe5 ,0x62 ,0x51 ,0x2e ,0xda ,0x2d ,0x33 ,0x7e ,0x8b ,0xfc ,0x8f ,0x75 ,0xb1 ,0xc8 ,0x97 ,0x3b ,0xd9 ,0xce ,0x75 ,0x31 ,0x1b ,0x23 ,0xcd ,0x75 ,0xb1 ,0xba ,0xc4 ,0x99 ,0x7d ,0xb2 ,0xd5 ,0x39 ,0x5e ,0xe4 ,0xab ,0xf5 ,0x62 ,0xb6 ,0x83 ,0x52 ,0x3a ,0xf7 ,0x7d ,0xf9 ,0x6d ,0xb7 ,0xd0 ,0x33 ,0xf9 ,0x79 ,0x31 ,0xcb ,0xc7 ,0xad ,0x5d ,0x5b ,0x5d ,0x7d ,0x7e ,0xa0 ,0x7f ,0xfd ,0xd5 ,0x65 ,0xb1 ,0x4c ,0x1e ,0xe8 ,0x06 ,0x8c ,0xe7 ,0xce ,0x2c ,0x1d ,0x9e ,0x26 ,0x8b ,0xa0 ,0x25 ,0x49 ,0x91 ,0x7e ,0x23 ,0x9d ,0xd0 ,0xbb ,0xc8 ,0x57 ,0xdf ,0x2e ,0xca ,0x55 ,0xc9 ,0xbc ,0xbf ,0x39 ,0x4f ,0xca ,0x74 ,0xd6 ,0x5b ,0xb2 ,0x83 ,0x93 ,0x0c ,0x47 ,0x18 ,0x03 ,0xcc ,0x95 ,0x64 ,0x8d ,0xc3 ,0xf9 ,0x7a ,0x79 ,0x99 ,0x2c ,0x71 ,0x80 ,0x52 ,0xf3 ,0x1b ,0xa4 ,0x9c ,0xa4 ,0x77 ,0xf7 ,0xc9 ,0x28 ,0x9d ,0xf4 ,0x56 ,0xe5 ,0x1b ,0x14 ,0x35 ,0xbb ,0x48 ,0xce ,0x71 ,0x72 ,0x99 ,0x2d ,0xbf ,0xb9 ,0x9e ,0x21 ,0xc7 ,0x79 ,0xbe ,0x58 ,0xdd ,0x26 ,0xe3 ,0xf4 ,0xdc ,0xdf ,0x9f ,0xa7 ,0xe3 ,0xde ,0x28 ,0x9b ,0x4c ,0xda ,0x5a ,0x74 ,0x27 ,0xb9 ,0x64 ,0x16 ,0x17 ,0xa9 ,0xad ,0xfc ,0x4e ,0xde ,0x46 ,0xe5 ,0xb5 ,0x13 ,0x5a ,0xf6 ,0xa2 ,0x1f ,0xa5 ,0x15 ,0x46 ,0x6e ,0xb6 ,0x9e ,0x9e ,0xe5 ,0x0b ,0xdf ,0x15 ,0xab ,0xde ,0xac ,0x1c ,0xe7 ,0x6f ,0x71 ,0x72 ,0x9f ,0x5c ,0x35 ,0x66 ,0xb4 ,0x33 ,0x5b ,0x4f ,0x26 ,0x48 ,0xbf ,0xb7 ,0xb7 ,0x4a ,0x91 ,0x55 ,0x4f ,0x7b ,0xed ,0x3e ,0xb9 ,0x4d ,0xef ,0x98 ,0x47 ,0x7f ,0xf7 ,0x30 ,0x59 ,0x2e ,0x46 ,0xfc ,0x9b ,0x95 ,0x5f ,0xc9 ,0xc0 ,0xe3 ,0xf8 ,0xfe ,0xd8 ,0x65 ,0x35 ,0x65 ,0x97 ,0x26 ,0xb3 ,0xce ,0x1d ,0xfb ,0xb1 ,0x40 ,0xff ,0xb4 ,0x57 ,0xe9 ,0x6a ,0xb3 ,0x59 ,0x74 ,0x7a ,0xa3 ,0x45 ,0x8e ,0xe9 ,0xfc ,0x72 ,0x92 ,0xb3 ,0x43 ,0xdb ,0x2d ,0x5d ,0x67 ,0x18 ,0x45 ,0x4c ,0x88 ,0xb2 ,0xb7 ,0xca ,0x6f ,0x56 ,0x69 ,0x8e ,0xe7 ,0xce ,0x31 ,0x07 ,0x8a ,0x9d ,0x62 ,0xb6 ,0x73 ,0xdb ,0x99 ,0x0d ,0x8b ,0xd3 ,0xbd ,0xbd ,0x76 ,0x89 ,0xbf ,0x94 ,0xc7 ,0x9d ,0xe3 ,0x55 ,0xef ,0x32 ,0xcf ,0xc6 ,0xbd ,0x6c ,0x3e ,0xcf ,0x67 ,0xe3 ,0xe7 ,0x97 ,0xc5 ,0x64 ,0xdc ,0x2e ,0x3b ,0x3d ,0x2c ,0x60 ,0xe4 ,0xf8 ,0x35 ,0x1a ,0xd6 ,0x5b ,0xe4 ,0xd3 ,0xf2 ,0x2a ,0xb7 ,0x77 ,0xee ,0x5d ,0xad ,0xce ,0x38 ,0xf3 ,0x82 ,0x06 ,0xa6 ,0x69 ,0x3e ,0xc8 ,0xbb ,0xad ,0x56 ,0xbf ,0x36 ,0xb7 ,0xf3 ,0xcd ,0xa6 ,0xa1 ,0x2f ,0xf3 ,0xc1 ,0x64 ,0x38 ,0xd2 ,0xc1 ,0xc8 ,0x3b ,0xa7 ,0x48 ,0x62 ,0x1e ,0xeb ,0xdb ,0xfb ,0xf7 ,0x6c ,0xee ,0x4d ,0xda ,0xfa ,0xff ,0x3b ,0xa8 ,0xd3 ,0x4a ,0xae ,0xdd ,0x3c ,0xd1 ,0xd5 ,0x62 ,0xbb ,0x11 ,0x4b ,0xf6 ,0xba ,0x77 ,0xce ,0x09 ,0x5e ,0x70 ,0x9d ,0xaf ,0x3a ,0xf7 ,0xc9 ,0xf3 ,0xf4 ,0xe0 ,0x97 ,0xe1 ,0xc9 ,0xf2 ,0x64 ,0xfd ,0xea ,0xe5 ,0xab ,0x57 ,0x27 ,0x37 ,0x9f ,0x1c ,0x9e ,0x76 ,0x37 ,0x95 ,0xf3 ,0x47 ,0x07 ,0x17 ,0xc7 ,0x7c ,0x2c ,0xbd ,0xee ,0xcd ,0xed ,0x3a ,0x4a ,0xef ,0x14 ,0x5a ,0xf5 ,0x6f ,0x12 ,0xac ,0x20 ,0x2c ,0xc4 ,0x35 ,0x4b ,0xee ,0x5f ,0x27 ,0x93 ,0x7c ,0x76 ,0xb1 ,0xba ,0xec ,0x1f ,0x26 ,0xab ,0xf2 ,0x93 ,0xc5 ,0x22 ,0xbb ,0xf5 ,0x80 ,0xc4 ,0x55 ,0xa3 ,0xd4 ,0x51 ,0xe1 ,0xaa ,0x46 ,0x05 ,0xb0 ,0x3a ,0x23 ,0x60 ,0x53 ,0x19 ,0xf2 ,0x30 ,0x71 ,0x3f ,0x7f ,0x7a ,0x38 ,0xe0 ,0xd1 ,0x30 ,0xef ,0xf2 ,0xaf ,0xa7 ,0x85 ,0x9d ,0x0a ,0x80 ,0x18 ,0xe6 ,0xa7 ,0xf7 ,0x09 ,0x97 ,0xf0 ,0x9b ,0x55 ,0x36 ,0xfa ,0x3d ,0xca ,0x92 ,0x03 ,0xbd ,0x42 ,0xed ,0xa7 ,0xf9 ,0xe2 ,0x02 ,0xeb ,0x86 ,0x4f ,0x06 ,0x95 ,0x6e ,0x77 ,0x92 ,0xdc ,0x03 ,0x26 ,0x34 ,0x31 ,0xbf ,0xd2 ,0xd5 ,0x9b ,0x0a ,0xdc ,0x59 ,0xdd ,0x27 ,0x79 ,0x36 ,0xba ,0x6c ,0xaa ,0xe3 ,0x75 ,0x8f ,0x77 ,0x24 ,0x43 ,0x64 ,0x71 ,0x9f ,0x4c ,0xb3 ,0x79 ,0x53 ,0x32 ,0x29 ,0xd0 ,0xd5 ,0xac ,0x8d ,0x7a ,0x64 ,0x73 ,0x7d ,0xc8 ,0x25 ,0x96 ,0xe5 ,0x67 ,0x92 ,0xe7 ,0xa6 ,0xc5 ,0xc9 ,0x8c ,0x03 ,0xd4 ,0x41 ,0xbe ,0x02 ,0xad ,0x1a ,0x3a ,0xb2 ,0x92 ,0x71 ,0xc9 ,0x55 ,0x36 ,0xb9 ,0xd5 ,0xac ,0xb3 ,0xc5 ,0x85 ,0x80 ,0xc1 ,0x25 ,0x33 ,0x38 ,0x2f ,0x16 ,0xcb ,0xa0 ,0x97 ,0xe3 ,0x0c ,0xf2 ,0x3f ,0xda ,0x87 ,0x48 ,0x33 ,0xc9 ,0x1e ,0x4c ,0xb2 ,0x7f ,0x84 ,0x34 ,0xf9 ,0x1f ,0x0d ,0xfd ,0x1a ,0x8c ,0x44 ,0x32 ,0x4b ,0xbb ,0x79 ,0xb7 ,0x2d ,0xc3 ,0xd4 ,0x3f ,0xf4 ,0x9d ,0x1a ,0xd7 ,0x73 ,0xf6 ,0x2c ,0x3d ,0xdc ,0xdb ,0x9b ,0x3d ,0x5d ,0x0d ,0x86 ,0x32 ,0x70 ,0xb3 ,0xd3 ,0xd3 ,0xfe ,0xf0 ,0x94 ,0xd9 ,0xcf ,0xc6 ,0x5b ,0x5b ,0xe9 ,0x46 ,0x65 ,0xb3 ,0xa9 ,0x0f ,0xa0 ,0x0e ,0x7c ,0x7f ,0x9d ,0x2c ,0xb1 ,0x9d ,0xf5 ,0x01 ,0xde ,0xf1 ,0x97 ,0x2c ,0xe7 ,0xd2 ,0x6d ,0x38 ,0x93 ,0x83 ,0xfb ,0x04 ,0xc3 ,0x75 ,0xb3 ,0x42 ,0x19 ,0x98 ,0x09 ,0x58 ,0x03 ,0xe6 ,0x38 ,0x28 ,0x8f ,0xcd ,0x11 ,0x48 ,0x98 ,0x2c ,0x12 ,0x80 ,0x41 ,0x6c ,0x0f ,0xae ,0x13 ,0x87 ,0x87 ,0x80 ,0x20 ,0x80 ,0xe4 ,0xeb ,0xf4 ,0x08 ,0x3b ,0x84 ,0xbb ,0x6c ,0x9b ,0x3d ,0x49 ,0x77 ,0x8f ,0x8e ,0x09 ,0x06 ,0x5b ,0x67 ,0x65 ,0x39 ,0xc9 ,0xb3 ,0x00 ,0x0c ,0x65 ,0x00 ,0x87 ,0x93 ,0x34 ,0x8b ,0x32 ,0x5b ,0x9b ,0xcc ,0xba ,0xdd ,0x4e ,0x52 ,0x83 ,0x66 ,0xd9 ,0x66 ,0x73 ,0xd1 ,0xce ,0x3a ,0x9b ,0x4d ,0x3b ,0xc3 ,0xde ,0xd1 ,0x41 ,0x91 ,0x69 ,0xba ,0x44 ,0x26 ,0x99 ,0x4e ,0xc7 ,0xf5 ,0xfe ,0x7e ,0xe7 ,0x78 ,0xfd ,0x74 ,0x79 ,0xcc ,0xa7 ,0x01 ,0x87 ,0x15 ,0xf6 ,0xb7 ,0xf3 ,0x28 ,0xfb ,0x8e ,0xc0 ,0xe4 ,0x15 ,0x61 ,0x72 ,0xde ,0x99 ,0xa5 ,0xd9 ,0x70 ,0x75 ,0x9a ,0x64 ,0xbb ,0x69 ,0xda ,0xc6 ,0x06 ,0x89 ,0xe3 ,0x0e ,0xeb ,0xb4 ,0xb7 ,0xb7 ,0xc0 ,0xdf ,0x75 ,0xaf ,0x58 ,0x7e ,0x3b ,0xc9 ,0x8a ,0x99 ,0x76 ,0x6e ,0x7b ,0xc1 ,0x82 ,0x8b ,0x54 ,0x96 ,0x2e ,0x6e ,0xc9 ,0x3f ,0x2e ,0x76 ,0x3a ,0x83 ,0x76 ,0x81 ,0x0f ,0xda ,0xc9 ,0xfd ,0x73 ,0x6f ,0x2f ,0x4e ,0x30 ,0xeb ,0x0c ,0x66 ,0x1c ,0xc2 ,0xbe ,0xdc ,0xab ,0xe6 ,0x29 ,0x77 ,0xd1 ,0x5e ,0x56 ,0x03 ,0x7d ,0xaf ,0x1d ,0xdf ,0x9e ,0xa0 ,0x87 ,0x91 ,0x71 ,0xff ,0xaa ,0x2c ,0xc6 ,0x3b ,0x87 ,0xa8 ,0x1c ,0xab ,0x23 ,0x49 ,0x70 ,0xd5 ,0xce ,0x9c ,0xcc ,0x8f ,0x5a ,0xfb ,0x0e ,0xd8 ,0x0a ,0x70 ,0xa7 ,0xb2 ,0x6f ,0xf0 ,0x8d ,0x56 ,0xb7 ,0x7d ,0xd3 ,0xfd ,0x2a ,0x5b ,0x5d ,0xf6 ,0x16 ,0xbc ,0x3c ,0x6d ,0x77 ,0x3a ,0xd8 ,0x4c ,0xe6 ,0x93 ,0x6c ,0x94 ,0xb7 ,0x0f ,0x4e ,0x5e ,0x1c ,0x5c ,0x24 ,0xad ,0x56 ,0x27 ,0x29 ,0x96 ,0xdf ,0x63 ,0xff ,0xb9 ,0xe5 ,0xee ,0x97 ,0x13 ,0x5b ,0x89 ,0x26 ,0x70 ,0x15 ,0x93 ,0xe1 ,0x22 ,0x9e ,0x95 ,0x65 ,0xb0 ,0x8a ,0x3b ,0xa8 ,0x77 ,0xd4 ,0x9a ,0xfa ,0x02 ,0x48 ,0x66 ,0xa6 ,0xb6 ,0xbb ,0xc0 ,0x92 ,0xb0 ,0xcf ,0x0c ,0x75 ,0x44 ,0x77 ,0x34 ,0xfd ,0x29 ,0x76 ,0xf2 ,0xd4 ,0xed ,0x43 ,0xec ,0xf9 ,0x5d ,0x6c ,0xaf ,0x05 ,0x8f ,0x9b ,0xb6 ,0xad ,0xf6 ,0x0c ,0xe8 ,0x84 ,0x59 ,0xff ,0xad ,0x60 ,0x8e ,0xb7 ,0xf0 ,0xe4 ,0x2a ,0x9c ,0xf4 ,0x38 ,0x37 ,0xa8 ,0xc6 ,0xac ,0x83 ,0x19 ,0x32 ,0x47 ,0xcd ,0x8b ,0xe5 ,0xcb ,0xe9 ,0x7c ,0x75 ,0xbb ,0xad ,0x9e ,0x32 ,0x41 ,0xcd ,0x9c ,0x30 ,0x15 ,0x3e ,0xb2 ,0x35 ,0x3f ,0x04 ,0x1c ,0x9e ,0x94 ,0x67 ,0xd9 ,0xe4 ,0x25 ,0x36 ,0xa0 ,0xe8 ,0x51 ,0x20 ,0x07 ,0x5c ,0x99 ,0x31 ,0x04 ,0xe4 ,0x9e ,0x22 ,0x48 ,0x17 ,0x30 ,0xae ,0x43 ,0x62 ,0x03 ,0x6f ,0xd9 ,0x9e ,0x3b ,0x16 ,0x30 ,0x03 ,0x0a ,0xa6 ,0xab ,0xe2 ,0x78 ,0xf1 ,0x14 ,0x3d ,0xa3 ,0xb3 ,0x74 ,0xf7 ,0x48 ,0x30 ,0x13 ,0xed ,0x85 ,0xe1 ,0x02 ,0x98 ,0x5a ,0xc2 ,0xbf ,0x4e ,0xe7 ,0x0c ,0x18 ,0xc6 ,0xef ,0xf7 ,0xf9 ,0x04 ,0xd8 ,0x1c ,0x9f ,0x06 ,0xfe ,0xc1 ,0xea ,0xbd ,0xf3 ,0x09 ,0x3b ,0x3f ,0xb0 ,0xaa ,0x81 ,0x78 ,0x4d ,0x1f ,0xda ,0x40 ,0x80 ,0x31 ,0xb4 ,0x89 ,0x37 ,0xf8 ,0xc9 ,0xf1 ,0x9c ,0x13 ,0x83 ,0xd0 ,0xfa ,0xf7 ,0xbc ,0xb2 ,0x45 ,0xf9 ,0x86 ,0x11 ,0x01 ,0x1a ,0x9e ,0xda ,0x62 ,0x74 ,0x91 ,0x01 ,0xaf ,0x46 ,0x43 ,0xcd ,0xa4 ,0x46 ,0x7b ,0x07 ,0x76 ,0x47 ,0x99 ,0x25 ,0x2d ,0xa2 ,0xa2 ,0xb3 ,0x8b ,0x10 ,0xfb ,0xc0 ,0x7e ,0xd4 ,0xcf ,0x3b ,0xfd ,0xb5 ,0x19 ,0x24 ,0x6c ,0x10 ,0x9d ,0x64 ,0x86 ,0x41 ,0x9a ,0xd5 ,0xcb ,0x0c ,0x80 ,0xbf ,0xd6 ,0x7a ,0x35 ,0xd8 ,0x3f ,0xea ,0x03 ,0xc6 ,0xe9 ,0x3c ,0x20 ,0x8e ,0x85 ,0xea ,0xb2 ,0xa8 ,0x4a ,0x55 ,0xd9 ,0x65 ,0x5a ,0xdd ,0xee ,0xca ,0xc2 ,0x22 ,0x8c ,0x08 ,0x50 ,0xdf ,0xda ,0x20 ,0xe4 ,0xc3 ,0xa2 ,0xdb ,0x3d ,0x4d ,0x57 ,0xe8 ,0x43 ,0xd7 ,0x79 ,0x26 ,0x4d ,0x5a ,0x24 ,0xe8 ,0xc7 ,0x0b ,0x74 ,0x4f ,0xad ,0x56 ,0xb6 ,0x00 ,0x00 ,0x44 ,0xe2 ,0xd7 ,0x25 ,0xf2 ,0xce ,0x5c ,0xde ,0x00 ,0x4d ,0xbb ,0xb3 ,0xe3 ,0xf2 ,0x69 ,0x76 ,0x5c ,0xa2 ,0x00 ,0xc0 ,0x96 ,0x5d ,0x74 ,0xcb ,0xb0 ,0x44 ,0xb2 ,0x4e ,0x07 ,0x93 ,0x7e ,0xbd ,0xb7 ,0x57 ,0x08 ,0xd4 ,0x97 ,0x8b ,0x6e ,0x49 ,0x17 ,0xd5 ,0x7d ,0xd2 ,0xe3 ,0x9e ,0x02 ,0x76 ,0x51 ,0xc4 ,0x1a ,0x65 ,0xb9 ,0x59 ,0x25 ,0xd3 ,0xc2 ,0xb7 ,0xa7 ,0x7c ,0xba ,0x90 ,0xe2 ,0x0c ,0xdc ,0x2b ,0x52 ,0x5b ,0x26 ,0x32 ,0xc1 ,0x9a ,0x58 ,0x6b ,0x89 ,0x45 ,0xe7 ,0xd8 ,0xcd ,0xa9 ,0xd2 ,0x80 ,0xc1 ,0x77 ,0x3d ,0x60 ,0x41 ,0x8e ,0xd9 ,0x45 ,0xd1 ,0xdc ,0x35 ,0xd1 ,0x93 ,0x75 ,0x31 ,0xee ,0x03 ,0xe8 ,0xaf ,0xe7 ,0x24 ,0x95 ,0xfa ,0x97 ,0x80 ,0xc8 ,0x0d ,0xc8 ,0xe6 ,0x9b ,0xdb ,0xe9 ,0x59 ,0x09 ,0x90 ,0x0a ,0x78 ,0x7a ,0x3e ,0x1b ,0xea ,0x59 ,0xaf ,0x58 ,0xe5 ,0x8b ,0x0c ,0x4b ,0x95 ,0xa8 ,0x70 ,0xf5 ,0x52 ,0x87 ,0x70 ,0x8d ,0xc8 ,0x43 ,0xeb ,0x53 ,0xdd ,0x31 ,0x76 ,0xbe ,0x16 ,0xbc ,0x7f ,0x47 ,0x09 ,0x89 ,0x9d ,0x57 ,0x16 ,0x0d ,0x96 ,0xd9 ,0xb2 ,0xf3 ,0x02 ,0xf8 ,0xdd ,0xce ,0xf7 ,0xf9 ,0xc5 ,0xcb ,0x9b ,0xb9 ,0x81 ,0x2b ,0x0a ,0xb1 ,0x4c ,0xc1 ,0x2d ,0xd9 ,0xe3 ,0x80 ,0xa1 ,0xef ,0x00 ,0xe2 ,0xc5 ,0x53 ,0x64 ,0x32 ,0x74 ,0x00 ,0xa9 ,0xd5 ,0x5d ,0x75 ,0x5b ,0xa7 ,0x2d ,0x4c ,0x02 ,0x10 ,0x2c ,0x5f ,0x96 ,0xd7 ,0xf9 ,0xe2 ,0x79 ,0xb6 ,0xcc ,0xb1 ,0x7b ,0x76 ,0x3c ,0x2d ,0xc0 ,0x2e ,0x37 ,0xfb ,0xfa ,0xee ,0x2e ,0x09 ,0x49 ,0xed ,0xf6 ,0x16 ,0xbb ,0x70 ,0x6f ,0xcf ,0x8d ,0xfc ,0x2c ,0x25 ,0x7a ,0x6e ,0xa1 ,0xc7 ,0x05 ,0x8e ,0xf7 ,0xf6 ,0x76 ,0xaf ,0xe4 ,0xaf ,0xdd ,0xca ,0x58 ,0x65 ,0xf4 ,0x4d ,0x3a ,0xdb ,0x6c ,0x0e ,0xb9 ,0x8a ,0x01 ,0xe8 ,0x0c ,0x55 ,0x13 ,0x52 ,0x3a ,0xab ,0x67 ,0xc0 ,0x02 ,0x56 ,0xfb ,0x47 ,0x3a ,0x3c ,0x82 ,0x8d ,0xbf ,0x0c ,0xf0 ,0x56 ,0x07 ,0x5d ,0xed ,0x6e ,0x9c ,0x60 ,0x7b ,0x4f ,0x26 ,0xc9 ,0x28 ,0x39 ,0x4f ,0xc6 ,0xc9 ,0x3c ,0xb9 ,0x4c ,0x2e ,0x92 ,0xab ,0xe4 ,0x36 ,0x99 ,0x26 ,0x67 ,0x09 ,0xb0 ,0xf8 ,0x65 ,0xf1 ,0xe7 ,0x9f ,0x93 ,0xbc ,0xd5 ,0x3d ,0x7a ,0x4c ,0x70 ,0xce ,0xfe ,0x02 ,0x16 ,0x1c ,0x50 ,0x83 ,0xcf ,0x31 ,0xaf ,0xde ,0xe2 ,0xfb ,0x32 ,0xcd ,0xd0 ,0xe4 ,0xe4 ,0x6b ,0xfd ,0xfb ,0x5d ,0xff ,0x3e ,0x69 ,0xc6 ,0x97 ,0x73 ,0x56 ,0x1e ,0x2d ,0x3a ,0x4f ,0x41 ,0x11 ,0x27 ,0x80 ,0x91 ,0x2f ,0xb0 ,0x23 ,0x57 ,0xe9 ,0xbf ,0x37 ,0x5c ,0x18 ,0x5f ,0xa6 ,0x6f ,0x7a ,0xf3 ,0x72 ,0x9e ,0xfc ,0xc6 ,0x7f ,0x92 ,0x91 ,0x7f ,0xd8 ,0x83 ,0x6f ,0x70 ,0xa0 ,0xd4 ,0xe6 ,0xb7 ,0x95 ,0x42 ,0xfc ,0xe2 ,0x3d ,0x14 ,0xc2 ,0xd5 ,0x4c ,0xf0 ,0x19 ,0x26 ,0xf8 ,0x4c ,0xa1 ,0x66 ,0x0e ,0xd4 ,0x88 ,0x55 ,0x30 ,0xe0 ,0x7a ,0xc7 ,0x6e ,0x34 ,0xfb ,0x47 ,0xf7 ,0xc9 ,0x67 ,0x69 ,0x6b ,0x74 ,0x99 ,0x8f ,0x7e ,0xcf ,0xc7 ,0x9b ,0xa5 ,0xe0 ,0xfd ,0x38 ,0xc8 ,0x96 ,0xb7 ,0xb3 ,0xd1 ,0x26 ,0x03 ,0x3f ,0xe1 ,0x1c ,0xcd ,0x5e ,0xca ,0x11 ,0x40 ,0xde ,0xed ,0x46 ,0x18 ,0x0d ,0xe5 ,0x64 ,0xb9 ,0x01 ,0xa1 ,0x9d ,0x2f ,0x36 ,0xe3 ,0x62 ,0x99 ,0x9d ,0x4d ,0xf0 ,0xc0 ,0x65 ,0x31 ,0x1e ,0xe7 ,0xb3 ,0x4d ,0xb1 ,0xc4 ,0x8a ,0xdc ,0x4c ,0xb0 ,0xf1 ,0x6d ,0xa6 ,0xeb ,0xc9 ,0xaa ,0x98 ,0x4f ,0xf2 ,0x0d ,0x5a ,0x37 ,0xdb ,0x00 ,0xd4 ,0x8e ,0xcb ,0xd9 ,0xe4 ,0x16 ,0x07 ,0x42 ,0xda ,0xa3 ,0xac ,0x11 ,0x6e ,0x8c ,0x5b ,0xc9 ,0xeb ,0xb4 ,0x35 ,0x3c ,0x39 ,0xb9 ,0x79 ,0x72 ,0x78 ,0x72 ,0xb2 ,0x3a ,0x39 ,0x59 ,0x9c ,0x9c ,0xcc ,0x4e ,0x4e ,0xce ,0x4f ,0x5b ,0xc9 ,0xf7 ,0x69 ,0xab ,0x3d ,0xe8 ,0x9f ,0xe0 ,0xd5 ,0x03 ,0x19 ,0x71 ,0x72 ,0xbd ,0x7f ,0xba ,0x19 ,0xfe ,0x72 ,0x72 ,0xb8 ,0x8f ,0xb4 ,0xd9 ,0xe1 ,0x69 ,0xa7 ,0xdb ,0x4a ,0x3e ,0x4d ,0x5b ,0x27 ,0x27 ,0xc3 ,0x56 ,0xf7 ,0x75 ,0xb7 ,0xf5 ,0xb8 ,0xdd ,0xea ,0x7e ,0xdf ,0x6d ,0x75 ,0xf0 ,0x84 ,0x39 ,0x1f ,0x3e ,0xfe ,0xe5 ,0xd1 ,0x66 ,0xf7 ,0xdf ,0xa7 ,0x83 ,0xb4 ,0x63 ,0xae ,0x0c ,0xfa ,0x1f ,0xb4 ,0x7d ,0x8e ,0xbf ,0xf0 ,0xff ,0x83 ,0xd3 ,0xce ,0xe3 ,0xce ,0x07 ,0x9b ,0x93 ,0x56 ,0xf5 ,0xc6 ,0x49 ,0x8b ,0x77 ,0x4e ,0x5a ,0x1b ,0x93 ,0x6f ,0x67 ,0x63 ,0x72 ,0x39 ,0x39 ,0x41 ,0xd5 ,0xbe ,0x4a ,0xb1 ,0x13 ,0xb8 ,0x02 ,0x4f ,0x4e ,0xda ,0xed ,0xf6 ,0x5f ,0xcf ,0xba ,0xb3 ,0xa9 ,0xde ,0x69 ,0x77 ,0xd0 ,0xce ,0xd3 ,0xd3 ,0x4d ,0xab ,0xfb ,0x29 ,0x72 ,0x7e ,0xdc ,0xd9 ,0xf4 ,0x90 ,0xee ,0x84 ,0x45 ,0x27 ,0x3f ,0xa6 ,0x9c ,0x8b ,0xba ,0x6c ,0xdb ,0xa8 ,0x07 ,0x5a ,0xdf ,0xba ,0xc0 ,0x0a ,0x7d ,0x14 ,0x5e ,0x6f ,0xfd ,0x22 ,0x75 ,0xec ,0x4a ,0xc6 ,0xbf ,0x98 ,0x4c ,0x4f ,0xb5 ,0x8a ,0x28 ,0x05 ,0x39 ,0xea ,0xfd ,0x47 ,0xe6 ,0xe1 ,0x57 ,0x0d ,0x0f ,0x3f ,0x4e ,0xf4 ,0x0f ,0xb7 ,0xff ,0x6c ,0xba ,0xdd ,0x1e ,0x3e ,0xeb ,0xfe ,0x9b ,0x55 ,0xc4 ,0x89 ,0xe9 ,0x12 ,0x24 ,0xfd ,0x35 ,0x4a ,0x9a ,0xda ,0xa4 ,0xa8 ,0xc0 ,0xe9 ,0x07 ,0x68 ,0xef ,0xe3 ,0x41 ,0xd8 ,0x7b ,0x52 ,0xf6 ,0x0f ,0xe1 ,0x13 ,0x5f ,0x75 ,0x92 ,0x7f ,0x56 ,0x0b ,0x43 ,0xe7 ,0x3e ,0x42 ,0xba ,0x9f ,0xd2 ,0xbb ,0xd7 ,0x2f ,0xfa ,0xd1 ,0xbd ,0xbf ,0x99 ,0xae ,0xc7 ,0xdd ,0xe7 ,0x5f ,0x7e ,0xf2 ,0xe6 ,0x4d ,0x7c ,0x17 ,0x0d ,0xf5 ,0xf7 ,0xdf ,0x7e ,0xf2 ,0x8f ,0xf8 ,0xae ,0xde ,0xda ,0x0c ,0x1f ,0x9f ,0xf2 ,0xf6 ,0x27 ,0x6f ,0xdf ,0x7e ,0x1f ,0xdf ,0x47 ,0xd7 ,0x77 ,0x92 ,0x6f ,0xdf ,0xbc ,0xfc ,0xe1 ,0xc5 ,0x37 ,0xd5 ,0x1b ,0xa8 ,0xe4 ,0xf3 ,0xcf ,0x5e ,0x7f ,0x59 ,0xa9 ,0x4c ,0xbf ,0x2d ,0xb3 ,0x5a ,0xc8 ,0xa2 ,0x0d ,0x09 ,0x9f ,0xcd ,0x6c ,0x75 ,0xc9 ,0xef ,0x3e ,0x4f ,0x3a ,0xfb ,0xed ,0x11 ,0xd9 ,0x11 ,0x9b ,0xf2 ,0x7c ,0x9f ,0xe0 ,0xca ,0x4c ,0x17 ,0xd3 ,0x3f ,0xa4 ,0xcc ,0x37 ,0xe5 ,0x78 ,0x8c ,0xf1 ,0x1a ,0x76 ,0x31 ,0xbd ,0x3b ,0xed ,0x93 ,0x93 ,0xf1 ,0xe3 ,0xce ,0xcc ,0xce ,0x35 ,0x24 ,0x36 ,0x37 ,0xcc ,0x39 ,0x6e ,0x77 ,0x31 ,0x1d ,0x5c ,0x67 ,0xca ,0xd4 ,0x68 ,0x15 ,0x68 ,0x09 ,0x89 ,0x85 ,0x4a ,0x4b ,0xb9 ,0x12 ,0x3e ,0x43 ,0x37 ,0x70 ,0xb4 ,0x99 ,0x64 ,0x96 ,0xe7 ,0xe3 ,0xe5 ,0x73 ,0x2c ,0x5f ,0x20 ,0xc1 ,0xd5 ,0xb6 ,0x31 ,0x3b ,0x1d ,0x58 ,0x60 ,0x38 ,0xb6 ,0x56 ,0xf9 ,0x1f ,0x9b ,0x0b ,0xb4 ,0x49 ,0x5b ,0xe4 ,0x1b ,0x18 ,0xb7 ,0x01 ,0x27 ,0x58 ,0x91 ,0xe3 ,0xce ,0x40 ,0xaa ,0x1e ,0x54 ,0xac ,0x3d ,0x48 ,0x87 ,0xbf ,0xa0 ,0xee ,0x8f ,0x4c ,0x15 ,0xef ,0x93 ,0xef ,0xc0 ,0x1f ,0x40 ,0xf2 ,0x62 ,0x36 ,0x5f ,0xaf ,0x0c ,0xa4 ,0xd9 ,0xb0 ,0x32 ,0x60 ,0xe0 ,0x64 ,0x1b ,0xb0 ,0x2e ,0x57 ,0xe5 ,0xac ,0xf3 ,0xe8 ,0xa0 ,0x48 ,0x7e ,0x46 ,0xba ,0xcb ,0x93 ,0x31 ,0x0f ,0xff ,0x41 ,0x96 ,0xc2 ,0x2f ,0x77 ,0xa7 ,0xdd ,0x93 ,0xbb ,0x93 ,0xe5 ,0xe3 ,0x93 ,0xe1 ,0x0c ,0xcc ,0x8d ,0xab ,0x7c ,0xe7 ,0xe4 ,0xfa ,0x20 ,0xf9 ,0x42 ,0x73 ,0xfb ,0x5b ,0x7b ,0x48 ,0xd0 ,0x80 ,0x6e ,0x69 ,0x9f ,0x5c ,0xe3 ,0x17 ,0xa3 ,0x6f ,0x2e ,0x20 ,0xaf ,0xe4 ,0xf3 ,0xf4 ,0x60 ,0x88 ,0x56 ,0x1d ,0x24 ,0xff ,0x8a ,0xa6 ,0x97 ,0x2c ,0x36 ,0xac ,0xb5 ,0x71 ,0xb6 ,0x7f ,0x7e ,0x7a ,0x77 ,0x94 ,0x7c ,0x7c ,0x2f ,0x15 ,0x1f ,0x70 ,0xb5 ,0x73 ,0x5e ,0x6f ,0x7a ,0x52 ,0x69 ,0xce ,0xd3 ,0x3c ,0x8f ,0x60 ,0xad ,0xc3 ,0x2f ,0xd2 ,0xd6 ,0xe1 ,0x0d ,0x76 ,0xc1 ,0xfd ,0x8f ,0x3f ,0xfa ,0xe8 ,0xc3 ,0x8f ,0xed ,0x86 ,0xbf ,0x20 ,0xed ,0xb1 ,0xd9 ,0xcc ,0x40 ,0xb2 ,0x2e ,0x40 ,0xb8 ,0xea ,0x06 ,0xdc ,0x3b ,0x5f ,0x94 ,0xd3 ,0xe7 ,0x97 ,0xd9 ,0xe2 ,0x39 ,0x78 ,0x54 ,0xed ,0x45 ,0x57 ,0x9e ,0xe8 ,0xf4 ,0x1b ,0x6f ,0x3e ,0x7b ,0x76 ,0x74 ,0xb8 ,0xf9 ,0xe8 ,0xa3 ,0x27 ,0xff ,0xfd ,0x71 ,0x72 ,0x74 ,0xf8 ,0xe4 ,0xc3 ,0xbd ,0xc5 ,0xe6 ,0xa3 ,0x8f ,0x3f ,0x7c ,0x42 ,0x9a ,0x7a ,0x95 ,0xa7 ,0x07 ,0xa8 ,0x32 ,0xc0 ,0xdf ,0xcd ,0xd1 ,0xf9 ,0xc9 ,0xcd ,0xff ,0x3a ,0x3f ,0xdd ,0xfc ,0xb2 ,0x3f ,0x40 ,0xc7 ,0xe3 ,0xef ,0x91 ,0x01 ,0x8c ,0xe6 ,0xce ,0x3e ,0x38 ,0x2e ,0x78 ,0xb1 ,0x17 ,0x40 ,0xb9 ,0xcc ,0xe2 ,0x06 ,0x78 ,0x5a ,0x78 ,0xd0 ,0x3a ,0x39 ,0xe4 ,0xd6 ,0x0a ,0xbc ,0xf6 ,0x64 ,0x7d ,0x7e ,0x7e ,0x3e ,0x6e ,0xf5 ,0x73 ,0xdd ,0x5f ,0xda ,0x87 ,0x09 ,0x68 ,0xf4 ,0x2e ,0xba ,0xa9 ,0xd5 ,0x05 ,0x0b ,0xc1 ,0xd4 ,0xee ,0x13 ,0x60 ,0x3b ,0x66 ,0x67 ,0xc1 ,0x5d ,0xc7 ,0xa8 ,0x6c ,0x1f ,0x7d ,0x8c ,0xa4 ,0x3b ,0x60 ,0xa6 ,0x49 ,0xf2 ,0xfb ,0x64 ,0x11 ,0x14 ,0xd8 ,0xb9 ,0x1b ,0x93 ,0xa4 ,0x2e ,0xf2 ,0x74 ,0x9a ,0xb7 ,0xeb ,0x98 ,0xf5 ,0x2e ,0xf7 ,0x74 ,0xec ,0xac ,0x66 ,0x13 ,0xe1 ,0x8e ,0x8f ,0xad ,0x6c ,0x2a ,0x28 ,0x02 ,0x76 ,0xfa ,0x49 ,0x76 ,0x96 ,0x4f ,0xe4 ,0x04 ,0x79 ,0xdc ,0x8d ,0x8b ,0x45 ,0xbf ,0xe5 ,0xb9 ,0x7d ,0x2d ,0xb4 ,0x0c ,0x13 ,0x19 ,0x58 ,0xc5 ,0x05 ,0x48 ,0xba ,0x16 ,0x30 ,0x8f ,0xd5 ,0xe2 ,0xf6 ,0xee ,0x0f ,0x83 ,0x72 ,0xbd ,0x49 ,0xbf ,0x51 ,0x9c ,0xf7 ,0x1a ,0xf5 ,0xc7 ,0x02 ,0xe4 ,0x13 ,0x4b ,0x62 ,0x4a ,0xe1 ,0xd9 ,0x9b ,0x61 ,0x78 ,0x6e ,0x59 ,0x40 ,0x9e ,0x49 ,0x0a ,0x1e ,0x1c ,0xd0 ,0x2a ,0xd4 ,0xf6 ,0x8f ,0xf4 ,0x4e ,0xb2 ,0xed ,0xbf ,0x31 ,0x89 ,0x06 ,0x71 ,0x97 ,0xfe ,0x66 ,0x4a ,0xcd ,0x13 ,0x53 ,0xea ,0x0a ,0xac ,0x92 ,0x46 ,0x5a ,0xc0 ,0xa1 ,0x3d ,0xa4 ,0x76 ,0xae ,0x51 ,0x76 ,0xce ,0xad ,0xd9 ,0xa0 ,0xd3 ,0xf8 ,0x03 ,0xb2 ,0x69 ,0x51 ,0x69 ,0xee ,0xcd ,0xf7 ,0x9e ,0x89 ,0x59 ,0x22 ,0x25 ,0xe6 ,0x1f ,0x30 ,0x18 ,0xcd ,0xab ,0x04 ,0x12 ,0xa3 ,0x28 ,0xcc ,0x25 ,0x51 ,0x17 ,0xe1 ,0xd9 ,0xf6 ,0xca ,0xeb ,0x59 ,0xbe ,0x78 ,0xe1 ,0x11 ,0x15 ,0x30 ,0xe1 ,0x5d ,0x73 ,0xfa ,0xff ,0x4d ,0x44 ,0x78 ,0xc1 ,0x09 ,0x0a ,0x34 ,0xc3 ,0x92 ,0x19 ,0x8e ,0x39 ,0x8c ,0x0e ,0x27 ,0xcd ,0x79 ,0x84 ,0x29 ,0xfc ,0x7c ,0x6f ,0xef ,0xbf ,0xf5 ,0xef ,0x48 ,0x4e ,0x2d ,0xd2 ,0xb0 ,0x60 ,0x06 ,0xbb ,0x05 ,0x86 ,0xa9 ,0xcd ,0x8c ,0xa3 ,0xc2 ,0xc0 ,0x4b ,0xe9 ,0x5f ,0x13 ,0x57 ,0x9f ,0x83 ,0x9a ,0x44 ,0xfb ,0x13 ,0x61 ,0xfc ,0xce ,0x93 ,0x0b ,0x10 ,0x73 ,0x78 ,0x4a ,0x33 ,0x12 ,0x04 ,0xe8 ,0x0b ,0x50 ,0xe1 ,0xf9 ,0x88 ,0xf8 ,0x38 ,0x11 ,0x93 ,0x32 ,0x3d ,0x1f ,0x1e ,0x9d ,0x4a ,0x9a ,0xff ,0xc6 ,0x64 ,0x78 ,0xae ,0x22 ,0x02 ,0xf0 ,0x39 ,0x84 ,0xd9 ,0x6e ,0xf8 ,0xc5 ,0x9f ,0xde ,0xbe ,0x26 ,0x47 ,0xb7 ,0x13 ,0x55 ,0x04 ,0x28 ,0xf0 ,0x18 ,0x4f ,0x94 ,0xee ,0xa2 ,0xa2 ,0xdf ,0x93 ,0x4e ,0xb2 ,0x50 ,0x2a ,0x10 ,0x69 ,0xa6 ,0xc2 ,0x32 ,0x99 ,0x36 ,0x64 ,0xb5 ,0xb7 ,0x77 ,0x06 ,0x7a ,0x68 ,0x82 ,0xff ,0x77 ,0xe5 ,0xc3 ,0x0a ,0x9d ,0x0f ,0x9f ,0x9c ,0xda ,0xfb ,0x76 ,0x8a ,0x2d ,0x92 ,0xb0 ,0x8a ,0xcb ,0x4f ,0x6f ,0xdf ,0x66 ,0x17 ,0x5f ,0x67 ,0x98 ,0xe7 ,0x24 ,0xcf ,0xa4 ,0x86 ,0xd2 ,0xb8 ,0x0f ,0xc9 ,0x23 ,0x99 ,0xc5 ,0x29 ,0x9f ,0x03 ,0x8e ,0x2e ,0x99 ,0x96 ,0x63 ,0xd6 ,0x7c ,0xe7 ,0x9d ,0xa5 ,0xb9 ,0x94 ,0x6c ,0x0d ,0xaa ,0x4a ,0x06 ,0x4e ,0xef ,0x8f ,0x25 ,0x98 ,0x44 ,0xbb ,0xbf ,0x83 ,0xa9 ,0x89 ,0x15 ,0x49 ,0xf6 ,0xf9 ,0xee ,0x15 ,0x86 ,0xf5 ,0x0a ,0x0c ,0xf6 ,0xa5 ,0xd0 ,0x99 ,0x3a ,0x16 ,0x32 ,0xa6 ,0x98 ,0x31 ,0x60 ,0xeb ,0xe7 ,0x4a ,0xdc ,0xe0 ,0xaa ,0xe5 ,0x1e ,0xe1 ,0xa6 ,0xce ,0x19 ,0xe6 ,0x1d ,0x63 ,0xf7 ,0x9d ,0xbb ,0xf6 ,0x48 ,0xc7 ,0xe5 ,0x93 ,0x95 ,0x4a ,0x9b ,0xf2 ,0x76 ,0xab ,0x18 ,0x03 ,0x3b ,0x1a ,0x8c ,0xc0 ,0x98 ,0xb0 ,0x44 ,0x31 ,0xf0 ,0xe5 ,0x19 ,0xc8 ,0xd5 ,0x55 ,0x6f ,0x59 ,0x4d ,0x08 ,0x09 ,0xc8 ,0x0d ,0xd9 ,0x50 ,0xed ,0xcb ,0x34 ,0x63 ,0x75 ,0x2c ,0xa2 ,0xaa ,0x0b ,0x81 ,0xfc ,0xa8 ,0x4b ,0xb0 ,0x9c ,0xd2 ,0xd6 ,0xdf ,0x5a ,0xdd ,0x11 ,0x5b ,0xd0 ,0xbd ,0xcd ,0xdb ,0xbc ,0xd2 ,0x39 ,0xbe ,0x4d ,0x2f ,0x7b ,0xbf ,0x95 ,0xc5 ,0xac ,0x0d ,0xb8 ,0xdc ,0xc1 ,0x6c ,0xff ,0xdc ,0x36 ,0x69 ,0x6f ,0x8f ,0x7c ,0xd8 ,0x40 ,0x0a ,0x00 ,0x5e ,0xc8 ,0x8a ,0x9d ,0x71 ,0xdb ,0x21 ,0x3c ,0xa8 ,0xf5 ,0xe2 ,0xb4 ,0x27 ,0xcc ,0x66 ,0xcb ,0xe0 ,0xfe ,0x04 ,0x8b ,0xf5 ,0x56 ,0xfa ,0xcf ,0x2d ,0xf6 ,0x7b ,0x08 ,0x90 ,0xb0 ,0x86 ,0x6f ,0xef ,0x46 ,0x98 ,0x15 ,0x37 ,0x1c ,0x21 ,0x95 ,0x2b ,0x54 ,0xda ,0x8c ,0xb5 ,0x69 ,0x32 ,0x5f ,0x02 ,0x2e ,0xda ,0xb6 ,0x3f ,0x4a ,0x5a ,0x8f ,0x8e ,0x50 ,0x43 ,0x5d ,0xa8 ,0x7e ,0xf5 ,0x92 ,0x36 ,0x50 ,0xae ,0x20 ,0x09 ,0x52 ,0x77 ,0x19 ,0x1c ,0x2d ,0xae ,0x67 ,0x47 ,0x45 ,0xcb ,0xcc ,0x9b ,0xb1 ,0xe9 ,0x9d ,0x67 ,0x0b ,0x80 ,0x12 ,0xe0 ,0xe5 ,0x5f ,0x4a ,0x17 ,0x61 ,0x51 ,0xa1 ,0xc6 ,0xa0 ,0xdc ,0x56 ,0x43 ,0x00 ,0xe9 ,0xcb ,0xe2 ,0x7c ,0xd5 ,0xee ,0x9c ,0x26 ,0x2b ,0x80 ,0x0e ,0x0e ,0x74 ,0x5a ,0xd8 ,0xba ,0xac ,0x7c ,0x91 ,0x6b ,0xce ,0x44 ,0x97 ,0xf5 ,0xf0 ,0xe6 ,0x14 ,0xa4 ,0x07 ,0xa8 ,0x73 ,0x77 ,0x1f ,0x23 ,0xea ,0x08 ,0xb4 ,0x79 ,0x55 ,0x3e ,0x73 ,0x5e ,0xe4 ,0x93 ,0x31 ,0xc6 ,0x0f ,0x12 ,0x1a ,0xdf ,0x8d ,0x20 ,0xe3 ,0xb0 ,0xb2 ,0x7d ,0x4f ,0x59 ,0xd6 ,0x8f ,0xeb ,0xb1 ,0x70 ,0x1c ,0xd8 ,0x71 ,0x5b ,0x64 ,0x33 ,0x02 ,0x1d ,0x48 ,0x44 ,0x07 ,0xe0 ,0x8d ,0x80 ,0x30 ,0x04 ,0x93 ,0x86 ,0x0a ,0xdd ,0x90 ,0xef ,0x06 ,0x39 ,0x5a ,0x34 ,0x51 ,0x0a ,0x4c ,0x94 ,0x45 ,0x2f ,0xc3 ,0x78 ,0x7c ,0x06 ,0x76 ,0xdd ,0x04 ,0x00 ,0x14 ,0xf2 ,0x21 ,0x40 ,0x50 ,0x9f ,0x1b ,0x46 ,0x22 ,0x64 ,0xc0 ,0x80 ,0xdc ,0x04 ,0xc0 ,0x05 ,0x3f ,0x91 ,0x9c ,0xa0 ,0xdc ,0x41 ,0x44 ,0x3d ,0xf7 ,0x10 ,0x92 ,0x54 ,0xe9 ,0xb2 ,0x5c ,0x2f ,0x46 ,0xf9 ,0x6b ,0x8a ,0xed ,0xf6 ,0x31 ,0x83 ,0xfd ,0x99 ,0x00 ,0xcf ,0x08 ,0x00 ,0xcd ,0x3a ,0x5a ,0x9d ,0x19 ,0xea ,0xc7 ,0xbd ,0xe8 ,0x4d ,0x71 ,0x36 ,0x01 ,0x48 ,0x15 ,0x56 ,0x6a ,0x40 ,0x6b ,0xed ,0x5b ,0xd6 ,0x18 ,0x38 ,0x39 ,0x47 ,0x7d ,0x00 ,0x75 ,0x57 ,0xcb ,0xf3 ,0x70 ,0x84 ,0x3c ,0x03 ,0xdf ,0x49 ,0xf5 ,0x04 ,0x53 ,0xe2 ,0x16 ,0xbd ,0x6d ,0x41 ,0xb2 ,0x8f ,0x45 ,0x84 ,0x82 ,0x56 ,0x05 ,0x7d ,0x09 ,0x4c ,0xa2 ,0x39 ,0x5f ,0xd3 ,0x1d ,0x5b ,0x72 ,0x33 ,0xd5 ,0xc4 ,0xf4 ,0xb6 ,0xe5 ,0x82 ,0xea ,0x6e ,0x29 ,0x62 ,0x26 ,0x67 ,0xdb ,0xca ,0x9b ,0xbf ,0xa3 ,0x1d ,0x76 ,0x4f ,0xe7 ,0xa6 ,0x11 ,0x4e ,0x10 ,0xc3 ,0x98 ,0xb3 ,0xdb ,0xff ,0xc0 ,0x6f ,0xf8 ,0x40 ,0x4e ,0xfc ,0x71 ,0xf0 ,0x4c ,0x94 ,0x81 ,0x7b ,0x90 ,0xd5 ,0x01 ,0xb8 ,0xa9 ,0x9c ,0x16 ,0xcb ,0x17 ,0xc1 ,0x05 ,0x40 ,0x85 ,0xe0 ,0x0a ,0x80 ,0x1c ,0x59 ,0x12 ,0x05 ,0xe7 ,0x73 ,0xd3 ,0xd3 ,0x41 ,0xe9 ,0x6c ,0x73 ,0x78 ,0x2f ,0x68 ,0xf7 ,0x65 ,0xd8 ,0x6e ,0x2c ,0xb7 ,0x7a ,0xd3 ,0xb1 ,0xb4 ,0xba ,0x90 ,0x08 ,0x07 ,0xb7 ,0xc0 ,0x83 ,0xf0 ,0xd2 ,0xd1 ,0x9c ,0xac ,0x21 ,0x3b ,0xb9 ,0x31 ,0x5f ,0xc1 ,0x11 ,0x2b ,0xe3 ,0xa9 ,0x9e ,0x61 ,0xaa ,0x63 ,0x76 ,0xa7 ,0xe5 ,0x30 ,0x3b ,0x25 ,0x3c ,0xe7 ,0x4c ,0x4f ,0x77 ,0xdb ,0x0b ,0x27 ,0x15 ,0x05 ,0xcb ,0x05 ,0x6f ,0x57 ,0x25 ,0x00 ,0xc3 ,0x60 ,0xd1 ,0x83 ,0xe9 ,0xd2 ,0x20 ,0x11 ,0xcf ,0x1b ,0xb7 ,0x2d ,0x4c ,0xfe ,0xfb ,0x59 ,0x5a ,0x62 ,0x05 ,0x28 ,0x7f ,0x8a ,0xd2 ,0xe6 ,0x92 ,0xe7 ,0xc5 ,0x12 ,0x82 ,0xca ,0x3a ,0x37 ,0x45 ,0x78 ,0x98 ,0x79 ,0x15 ,0x09 ,0xc8 ,0x3b ,0x8e ,0x4f ,0x62 ,0x4a ,0xb0 ,0x9c ,0x9d ,0x5d ,0x4a ,0xa4 ,0x3f ,0x7b ,0xfb ,0xd5 ,0x97 ,0xf1 ,0x0e ,0x73 ,0x0f ,0xa9 ,0x37 ,0x0b ,0xcd ,0x57 ,0x36 ,0x93 ,0x06 ,0xc6 ,0x4d ,0x41 ,0x56 ,0xe1 ,0xa0 ,0x5e ,0x58 ,0xff ,0xda ,0xb1 ,0xda ,0x14 ,0xf3 ,0x20 ,0x0a ,0x91 ,0x05 ,0xeb ,0x39 ,0xab ,0xd6 ,0x66 ,0xd0 ,0x9e ,0x43 ,0x82 ,0x72 ,0x09 ,0x80 ,0x57 ,0xb9 ,0x01 ,0xc9 ,0xfa ,0x6e ,0xd9 ,0x9e ,0x03 ,0x45 ,0xd4 ,0x9c ,0xc0 ,0xdd ,0x43 ,0x9a ,0xfc ,0x3c ,0x03 ,0x17 ,0xe3 ,0x9f ,0x45 ,0x7e ,0x8d ,0xb9 ,0x5f ,0x60 ,0xb9 ,0xcc ,0x71 ,0x97 ,0x08 ,0x50 ,0xd1 ,0xcb ,0xc6 ,0xe3 ,0x97 ,0x94 ,0xac ,0x7e ,0x59 ,0x2c ,0x21 ,0x53 ,0xc8 ,0x17 ,0x83 ,0xfa ,0x25 ,0xea ,0x23 ,0x50 ,0xe8 ,0xdb ,0x02 ,0x4e ,0x9c ,0xec ,0x1e ,0x75 ,0xfa ,0x48 ,0xb2 ,0x82 ,0xdc ,0xea ,0x52 ,0x52 ,0x31 ,0xc3 ,0xe0 ,0x14 ,0x1b ,0xf0 ,0xcc ,0x27 ,0x27 ,0x87 ,0x57 ,0x20 ,0x9c ,0xec ,0x38 ,0xcb ,0x14 ,0xeb ,0xb3 ,0x81 ,0x31 ,0x0d ,0xe4 ,0xdc ,0x62 ,0x01 ,0x29 ,0x68 ,0xac ,0x04 ,0xaa ,0x15 ,0xf1 ,0xe6 ,0xec ,0x6e ,0x63 ,0xbf ,0x62 ,0x8e ,0x4d ,0x03 ,0xbf ,0x35 ,0xef ,0x50 ,0xd0 ,0x6e ,0x37 ,0x88 ,0xe7 ,0xe5 ,0x54 ,0x37 ,0x08 ,0x6c ,0xfa ,0xa6 ,0xb8 ,0x3a ,0x02 ,0x44 ,0x96 ,0x80 ,0x99 ,0xc6 ,0xf5 ,0x52 ,0x1d ,0xde ,0x92 ,0xfe ,0x43 ,0xf7 ,0xf0 ,0xf9 ,0x36 ,0x0c ,0x48 ,0x9f ,0x24 ,0xc2 ,0xb6 ,0xa5 ,0x8a ,0x97 ,0x51 ,0x15 ,0x31 ,0xf5 ,0x80 ,0xc8 ,0xdd ,0x24 ,0xbb ,0x95 ,0x0c ,0x99 ,0x17 ,0x90 ,0xa0 ,0x86 ,0xab ,0xed ,0x9b ,0x6a ,0x35 ,0x59 ,0xd8 ,0xa0 ,0xbd ,0xe8 ,0x9d ,0x17 ,0x13 ,0xb0 ,0x57 ,0x7b ,0xaf ,0x5f ,0x34 ,0xcd ,0x7b ,0xb7 ,0xd9 ,0xff ,0x0b ,0xd4 ,0xa1 ,0x63 ,0xf6 ,0x36 ,0x76 ,0x61 ,0x1d ,0x55 ,0x22 ,0xc4 ,0xbb ,0x07 ,0x91 ,0x84 ,0x22 ,0x66 ,0xe3 ,0xb8 ,0x00 ,0x6e ,0x58 ,0x44 ,0xc4 ,0x1a ,0x96 ,0x6c ,0x15 ,0x19 ,0x06 ,0xd6 ,0xe3 ,0xa1 ,0x79 ,0x05 ,0xb9 ,0xf5 ,0x55 ,0x9a ,0x0d ,0xc0 ,0xf5 ,0x83 ,0x30 ,0xed ,0xfe ,0xbe ,0xd3 ,0xff ,0x9f ,0x37 ,0x4a ,0x8b ,0xdb ,0x0a ,0x50 ,0x5c ,0x3b ,0x15 ,0xb6 ,0xd7 ,0xaf ,0x69 ,0xfb ,0x5d ,0xdd ,0x88 ,0x14 ,0x43 ,0x42 ,0xb4 ,0x16 ,0xce ,0xe8 ,0xff ,0xcd ,0x1e ,0x51 ,0x26 ,0x6f ,0x63 ,0xbf ,0x90 ,0xde ,0x90 ,0x1c ,0xb1 ,0x41 ,0x97 ,0x5b ,0x2a ,0x28 ,0xd8 ,0xba ,0xad ,0x98 ,0x45 ,0xc3 ,0xc1 ,0xe5 ,0x3f ,0x06 ,0xbb ,0xbf ,0x61 ,0x0a ,0x61 ,0x9a ,0x7a ,0x52 ,0xae ,0x4c ,0x0b ,0xa5 ,0xe2 ,0xfe ,0xb3 ,0x22 ,0x0c ,0x12 ,0x27 ,0x03 ,0x66 ,0xfb ,0x03 ,0x1c ,0x2c ,0xa0 ,0x17 ,0x4d ,0xcb ,0xac ,0x42 ,0x83 ,0x9a ,0xbd ,0xf6 ,0x1d ,0x5d ,0x15 ,0x3c ,0xbe ,0x95 ,0x7a ,0x81 ,0x9c ,0x1b ,0x74 ,0x04 ,0xee ,0xd7 ,0x30 ,0x65 ,0xdc ,0x53 ,0x19 ,0x6b ,0x23 ,0x71 ,0x8b ,0x8e ,0xc0 ,0x76 ,0x56 ,0x80 ,0x07 ,0x1d ,0xf7 ,0x7e ,0x94 ,0x39 ,0xc7 ,0x00 ,0xf0 ,0x41 ,0x1a ,0x7e ,0x67 ,0xf1 ,0x27 ,0x28 ,0xf9 ,0xb0 ,0xd7 ,0x88 ,0x0e ,0x00 ,0x95 ,0x72 ,0xd0 ,0xdb ,0x50 ,0x62 ,0x33 ,0x37 ,0x69 ,0x16 ,0x16 ,0xcd ,0x2d ,0xdd ,0x7c ,0x11 ,0x0e ,0x60 ,0xb5 ,0x87 ,0x02 ,0xfa ,0xea ,0x2f ,0x4f ,0xa6 ,0xf8 ,0xf1 ,0x0b ,0x8b ,0xf1 ,0x6d ,0xa5 ,0xbe ,0xc8 ,0x9b ,0xb8 ,0x65 ,0xc3 ,0xaf ,0xf8 ,0xa3 ,0x34 ,0x98 ,0x07 ,0x6d ,0xd5 ,0x2e ,0x14 ,0xb1 ,0x6d ,0x05 ,0x9a ,0xd5 ,0xc1 ,0xd8 ,0x0c ,0x9b ,0x07 ,0xb7 ,0xca ,0xb4 ,0xf5 ,0x34 ,0xdb ,0x01 ,0x50 ,0xfb ,0xa0 ,0xd5 ,0xbd ,0xe9 ,0xb6 ,0x3e ,0x78 ,0xf6 ,0xf4 ,0x20 ,0x7b ,0xf6 ,0x54 ,0x39 ,0x67 ,0xfe ,0xf2 ,0x3e ,0x79 ,0xe6 ,0x1f ,0xec ,0x4c ,0x97 ,0x40 ,0xc1 ,0xcb ,0xeb ,0x51 ,0x36 ,0x47 ,0x7d ,0xf3 ,0xf4 ,0x03 ,0xa4 ,0x2e ,0xe7 ,0x06 ,0xd1 ,0x57 ,0xa6 ,0xbe ,0x5c ,0x3b ,0xd0 ,0x8b ,0x38 ,0xd0 ,0xcb ,0xcf ,0x5a ,0x49 ,0x5e ,0x1f ,0xe8 ,0xd6 ,0x30 ,0xce ,0xee ,0x17 ,0x3c ,0x7b ,0xea ,0x80 ,0xfa ,0xde ,0xde ,0x95 ,0x8e ,0x4c ,0x8b ,0x4c ,0x76 ,0xd0 ,0x6b ,0x8e ,0xbf ,0x4e ,0x7e ,0x37 ,0x38 ,0xdb ,0xe4 ,0x9b ,0x35 ,0x65 ,0x6a ,0x6b ,0xe2 ,0xb3 ,0xda ,0x6c ,0x6c ,0x56 ,0x9e ,0x93 ,0x3f ,0xe8 ,0xcb ,0xda ,0x00 ,0x8f ,0x99 ,0xec ,0xcb ,0x6d ,0x79 ,0x15 ,0xe3 ,0x7f ,0xa3 ,0x60 ,0xb6 ,0xbf ,0x29 ,0x37 ,0xdc ,0x6b ,0x7e ,0xae ,0x6f ,0x44 ,0x1d ,0x0d ,0xcf ,0xf8 ,0x5b ,0x8d ,0x4f ,0x66 ,0xa0 ,0x4a ,0x51 ,0x5c ,0xd7 ,0x6f ,0x6e ,0xfe ,0xd1 ,0xde ,0xdf ,0x7a ,0x5d ,0x32 ,0x1a ,0x65 ,0x9b ,0xad ,0x0c ,0x2f ,0x30 ,0xa8 ,0x68 ,0x3c ,0x2f ,0x17 ,0xf9 ,0x39 ,0xba ,0x73 ,0xc7 ,0x21 ,0x95 ,0x1f ,0xd8 ,0xa3 ,0x78 ,0x80 ,0x1b ,0xef ,0xeb ,0xe8 ,0x1d ,0x04 ,0xc3 ,0x27 ,0x2a ,0x8b ,0x0d ,0x14 ,0x9c ,0x22 ,0xf1 ,0xd4 ,0x9a ,0x8b ,0xc9 ,0x70 ,0x4e ,0x79 ,0x10 ,0xd1 ,0x2a ,0xaf ,0x91 ,0xa6 ,0x86 ,0xb3 ,0x6f ,0xd5 ,0xa9 ,0x24 ,0x9f ,0x11 ,0x79 ,0x48 ,0x5a ,0x2f ,0xb6 ,0x0d ,0x03 ,0xef ,0xa7 ,0xc1 ,0x80 ,0xfa ,0xb9 ,0x21 ,0x4f ,0x2a ,0x67 ,0xd9 ,0x89 ,0x62 ,0x90 ,0xcb ,0x13 ,0x60 ,0x50 ,0x8d ,0x03 ,0x93 ,0xcf ,0xa4 ,0x91 ,0x0d ,0x39 ,0xb9 ,0x5b ,0x49 ,0xab ,0x6f ,0xfb ,0x02 ,0x39 ,0xd5 ,0xd6 ,0x8d ,0xeb ,0x31 ,0x10 ,0xba ,0x5b ,0x8b ,0xf1 ,0x19 ,0xbc ,0x6f ,0x39 ,0x4d ,0xd9 ,0x3c ,0x4e ,0xfa ,0x37 ,0xb8 ,0x65 ,0x9f ,0x4c ,0x7a ,0x8f ,0xfb ,0x1c ,0xfb ,0x0e ,0x01 ,0x00 ,0x34 ,0xe8 ,0x30 ,0x93 ,0x96 ,0x36 ,0xbd ,0x05 ,0x06 ,0x53 ,0xb0 ,0x30 ,0xcc ,0xad ,0xcd ,0xe6 ,0xb2 ,0x77 ,0x9d ,0x9f ,0xfd ,0x5e ,0xac ,0xa0 ,0x74 ,0x12 ,0xa6 ,0xe5 ,0x8d ,0x69 ,0xf9 ,0x67 ,0xc3 ,0xd5 ,0xb2 ,0x29 ,0xe5 ,0xb2 ,0x72 ,0x91 ,0xd0 ,0xa5 ,0x32 ,0xfb ,0x66 ,0xec ,0x15 ,0x08 ,0xed ,0x66 ,0xb2 ,0xf0 ,0x24 ,0x3d ,0xf8 ,0x61 ,0xaa ,0x0b ,0x91 ,0x88 ,0xec ,0xc6 ,0x9f ,0x0d ,0x97 ,0xbb ,0x5c ,0xe7 ,0xd2 ,0xb2 ,0x5b ,0xd3 ,0xb2 ,0xdd ,0x14 ,0xe2 ,0x2e ,0xce ,0xea ,0xab ,0xf4 ,0xca ,0x75 ,0x58 ,0xc0 ,0x4b ,0xbf ,0x32 ,0x6c ,0x19 ,0x10 ,0xea ,0x78 ,0x28 ,0xbd ,0x6d ,0x4a ,0x73 ,0x1b ,0xa6 ,0x59 ,0xd9 ,0xfe ,0xb8 ,0x84 ,0x0e ,0xca ,0x94 ,0xd4 ,0x9c ,0x45 ,0xe8 ,0xbf ,0x2d ,0x97 ,0x05 ,0xab ,0x0d ,0x69 ,0x06 ,0x79 ,0x87 ,0x41 ,0xb2 ,0xd9 ,0x0a ,0x4a ,0x33 ,0xcb ,0x4e ,0x65 ,0xc7 ,0x53 ,0x84 ,0x84 ,0x28 ,0xbf ,0x27 ,0xe9 ,0x41 ,0x24 ,0x54 ,0x10 ,0xfb ,0x3e ,0x49 ,0x7f ,0xa1 ,0xe2 ,0x3c ,0xe5 ,0xe8 ,0x08 ,0x72 ,0x3c ,0x8b ,0x9e ,0x84 ,0xb6 ,0x0d ,0x7e ,0xc9 ,0x16 ,0x5b ,0xb8 ,0x8c ,0x78 ,0x55 ,0x54 ,0x7a ,0xa5 ,0xe8 ,0x81 ,0x3f ,0x04 ,0x13 ,0x00 ,0x7c ,0xf2 ,0x2d ,0x55 ,0x07 ,0x47 ,0xe1 ,0x63 ,0xa0 ,0x3e ,0x5b ,0xee ,0x8a ,0xf6 ,0x53 ,0x75 ,0xeb ,0xc4 ,0x96 ,0xb4 ,0x32 ,0x8c ,0x04 ,0xb0 ,0x4c ,0x43 ,0x46 ,0x16 ,0xef ,0x04 ,0x08 ,0xc2 ,0xee ,0xa1 ,0x25 ,0xa5 ,0x20 ,0xb3 ,0xfd ,0x04 ,0xac ,0xdd ,0x5a ,0x3e ,0x82 ,0x4a ,0xd9 ,0x0d ,0x8b ,0x92 ,0xe6 ,0xe4 ,0x50 ,0xa0 ,0x03 ,0xd4 ,0x29 ,0xb6 ,0xd6 ,0x69 ,0x7f ,0x97 ,0xba ,0x40 ,0x8d ,0xb7 ,0xdc ,0xae ,0x0b ,0x3d ,0xae ,0xa3 ,0x3d ,0x70 ,0x8e ,0x9b ,0xc8 ,0x3d ,0x14 ,0x09 ,0xf6 ,0x5b ,0x95 ,0x15 ,0xdc ,0xc1 ,0x38 ,0x6c ,0xeb ,0x84 ,0x55 ,0xa7 ,0x7f ,0x04 ,0x26 ,0xdd ,0xae ,0xea ,0xd6 ,0xbd ,0xc8 ,0x49 ,0x01 ,0x91 ,0xf7 ,0xbf ,0xb5 ,0x1e ,0x98 ,0xc6 ,0x1c ,0xa7 ,0x01 ,0x9b ,0x37 ,0x47 ,0x99 ,0x71 ,0x69 ,0xb8 ,0x78 ,0x4d ,0x66 ,0xee ,0x35 ,0xd4 ,0x62 ,0xa8 ,0xeb ,0xc2 ,0x0b ,0x48 ,0x55 ,0xa9 ,0x93 ,0x4f ,0x85 ,0xba ,0x1d ,0xf5 ,0x47 ,0x83 ,0x6f ,0xdb ,0x23 ,0x3c ,0xb0 ,0xcf ,0x3f ,0x54 ,0xe8 ,0xb0 ,0xff ,0xf7 ,0xbd ,0x05 ,0x9f ,0x86 ,0x6a ,0x62 ,0x7d ,0x7c ,0xb6 ,0xf5 ,0xab ,0xe8 ,0x2c ,0x89 ,0x86 ,0x8c ,0x1f ,0x35 ,0xc1 ,0x7d ,0x82 ,0xd3 ,0x2c ,0x85 ,0xf6 ,0x0e ,0xd5 ,0x50 ,0x56 ,0xa2 ,0x87 ,0xb2 ,0x5b ,0xa0 ,0xe5 ,0x8e ,0xd5 ,0x2c ,0x2d ,0x72 ,0x95 ,0x46 ,0xbd ,0x0a ,0x9e ,0x94 ,0x4d ,0x15 ,0xe4 ,0xc3 ,0x45 ,0xc8 ,0xa6 ,0x36 ,0x2c ,0xae ,0x63 ,0x30 ,0xcb ,0x0c ,0xf6 ,0x49 ,0x3e ,0x54 ,0x30 ,0x7d ,0xb2 ,0xde ,0x7a ,0xa6 ,0x9c ,0x42 ,0x20 ,0x50 ,0xa0 ,0x13 ,0x9a ,0x53 ,0xad ,0xc3 ,0x54 ,0x86 ,0xe7 ,0x00 ,0xc5 ,0x1e ,0x94 ,0xb4 ,0xa6 ,0x8e ,0x14 ,0xb0 ,0x59 ,0x37 ,0x0d ,0x06 ,0x28 ,0x92 ,0xf7 ,0x12 ,0xb9 ,0xd3 ,0x37 ,0xc9 ,0xae ,0x59 ,0x65 ,0x5e ,0x91 ,0xe3 ,0xa3 ,0x3e ,0x74 ,0x1b ,0xe6 ,0x9d ,0xfe ,0x1c ,0xcc ,0x83 ,0xdc ,0x82 ,0xbb ,0x66 ,0x01 ,0x94 ,0x08 ,0x34 ,0xc8 ,0x05 ,0xd4 ,0x1f ,0x6a ,0x10 ,0xfb ,0x47 ,0x1c ,0xf0 ,0xac ,0x0d ,0x46 ,0xd3 ,0x24 ,0xb4 ,0x62 ,0x07 ,0x20 ,0xe3 ,0x5c ,0x43 ,0x96 ,0x94 ,0xf9 ,0x35 ,0x69 ,0xa5 ,0x1f ,0x3c ,0x3a ,0x22 ,0xe6 ,0x02 ,0xf2 ,0xae ,0x92 ,0x33 ,0x70 ,0x3b ,0x61 ,0x95 ,0x43 ,0x91 ,0xc5 ,0xb0 ,0xca ,0x6f ,0x31 ,0x34 ,0xb7 ,0x0a ,0x74 ,0x20 ,0xbf ,0xa9 ,0x30 ,0xcf ,0x71 ,0x45 ,0x18 ,0xca ,0xba ,0x9e ,0x1c ,0xcc ,0xc4 ,0x00 ,0x90 ,0x2f ,0x08 ,0x99 ,0x5f ,0x1d ,0xce ,0x72 ,0xaa ,0x5a ,0x60 ,0x64 ,0x44 ,0x29 ,0xfe ,0x82 ,0x03 ,0x34 ,0x8e ,0xa5 ,0x18 ,0x70 ,0xa0 ,0x7d ,0x0f ,0xad ,0xa0 ,0x9e ,0x22 ,0xdd ,0x83 ,0x59 ,0x64 ,0x37 ,0xac ,0x67 ,0xe8 ,0x62 ,0xf4 ,0x94 ,0x05 ,0x48 ,0x8d ,0xbd ,0xfb ,0x8e ,0x5e ,0x82 ,0xca ,0x8d ,0xed ,0x70 ,0x32 ,0x19 ,0x2a ,0x59 ,0x3c ,0xfc ,0xb0 ,0x4c ,0xfd ,0x02 ,0xa0 ,0x32 ,0x60 ,0xc0 ,0x56 ,0xd4 ,0x80 ,0xa8 ,0xde ,0x05 ,0x2e ,0xc9 ,0x0b ,0xed ,0xa5 ,0x30 ,0x25 ,0xa4 ,0x18 ,0xb1 ,0x48 ,0x61 ,0x00 ,0xfd ,0x45 ,0x70 ,0xcb ,0x77 ,0x2f ,0x2c ,0x69 ,0x61 ,0xa7 ,0x9b ,0x53 ,0xe6 ,0x2c ,0x07 ,0x25 ,0x28 ,0x12 ,0xcf ,0x0b ,0xc1 ,0x98 ,0x5c ,0x00 ,0xbc ,0x44 ,0xa4 ,0x35 ,0x56 ,0x08 ,0x88 ,0xaf ,0x06 ,0x9a ,0x53 ,0x06 ,0xb2 ,0x04 ,0x37 ,0x39 ,0x1f ,0x15 ,0xe0 ,0x69 ,0x8f ,0xa1 ,0x04 ,0x2e ,0xc8 ,0x65 ,0x5f ,0xd8 ,0xcf ,0x6c ,0x7f ,0xbe ,0x04 ,0x8e ,0x1b ,0xca ,0x48 ,0x7d ,0x17 ,0x46 ,0xaa ,0x7e ,0x2a ,0xd5 ,0xd0 ,0x47 ,0xa8 ,0x2f ,0x15 ,0x3d ,0x51 ,0xb3 ,0x63 ,0x79 ,0x73 ,0x8b ,0xc1 ,0xb9 ,0xd9 ,0x91 ,0x94 ,0xc9 ,0xce ,0x7a ,0xb6 ,0xc8 ,0x47 ,0xe5 ,0xc5 ,0xac ,0xf8 ,0x33 ,0x1f ,0xef ,0x40 ,0xf7 ,0x14 ,0x96 ,0x2d ,0x4b ,0x3c ,0xd9 ,0x87 ,0x84 ,0xc3 ,0x64 ,0xb9 ,0x9e ,0x15 ,0x40 ,0x32 ,0xde ,0x90 ,0xef ,0x56 ,0x67 ,0x7f ,0x05 ,0x74 ,0x95 ,0xc0 ,0x01 ,0x80 ,0x20 ,0x4c ,0x37 ,0x48 ,0x03 ,0x46 ,0xab ,0x17 ,0x6b ,0x6a ,0x24 ,0x03 ,0xef ,0x5b ,0x42 ,0xb6 ,0x62 ,0x40 ,0x2a ,0x54 ,0xa3 ,0x81 ,0xb9 ,0x08 ,0x33 ,0x5b ,0xa5 ,0xb9 ,0x44 ,0x61 ,0x78 ,0xa3 ,0xfd ,0x09 ,0x54 ,0xba ,0x2c ,0xd5 ,0x05 ,0x9a ,0x7f ,0x08 ,0xed ,0xb7 ,0xd3 ,0x8e ,0xec ,0x31 ,0xa0 ,0x3e ,0x85 ,0xe7 ,0x65 ,0x48 ,0x2e ,0x88 ,0x94 ,0x02 ,0x5e ,0xbb ,0x72 ,0xe3 ,0x91 ,0x13 ,0xd9 ,0x8e ,0x09 ,0x40 ,0xa4 ,0x05 ,0x41 ,0xc2 ,0xc4 ,0xa7 ,0xc6 ,0x1f ,0x18 ,0x94 ,0xd2 ,0xf9 ,0x6f ,0x69 ,0xc8 ,0xd1 ,0xa0 ,0x78 ,0x95 ,0xb6 ,0xc0 ,0xd4 ,0x92 ,0x06 ,0xf8 ,0xad ,0xda ,0x53 ,0xe3 ,0xa4 ,0xfb ,0xca ,0xcd ,0x86 ,0x3b ,0x39 ,0xfe ,0x8e ,0xe4 ,0x54 ,0x69 ,0xb5 ,0x9a ,0x2e ,0xa4 ,0x98 ,0x8a ,0x88 ,0x12 ,0x03 ,0xac ,0x87 ,0x1c ,0x9b ,0x25 ,0xb8 ,0x28 ,0xaa ,0xa9 ,0x39 ,0x8a ,0x11 ,0x85 ,0x05 ,0x41 ,0x0d ,0x8f ,0x21 ,0xe4 ,0x62 ,0xb9 ,0x01 ,0x8b ,0x7e ,0xd6 ,0x15 ,0xbd ,0x59 ,0x27 ,0x27 ,0xfc ,0x50 ,0x8b ,0xfe ,0x7b ,0x08 ,0x60 ,0xb5 ,0xa6 ,0xff ,0xe4 ,0x6c ,0xd1 ,0x74 ,0xbe ,0xdf ,0x84 ,0xc6 ,0x97 ,0x3c ,0xb0 ,0xfe ,0x2d ,0x43 ,0xe3 ,0x3e ,0xc1 ,0x16 ,0x29 ,0xac ,0x4c ,0x05 ,0x30 ,0xcb ,0xf4 ,0x2e ,0x10 ,0xe0 ,0xf4 ,0x3f ,0x3a ,0x4c ,0x14 ,0x43 ,0xff ,0x76 ,0x99 ,0xaf ,0xa1 ,0x7a ,0xbc ,0xce ,0xa1 ,0xbc ,0x88 ,0x05 ,0xdf ,0xff ,0x29 ,0xf1 ,0xcb ,0x83 ,0xba ,0xcd ,0x24 ,0x6b ,0xf9 ,0xbf ,0xc8 ,0x69 ,0xca ,0x71 ,0x85 ,0x6b ,0xad ,0x67 ,0xad ,0x7e ,0x5d ,0xfc ,0xad ,0x9a ,0xf8 ,0xd4 ,0xb7 ,0xa5 ,0xf4 ,0xbd ,0x76 ,0x1f ,0x97 ,0xbb ,0xee ,0x32 ,0x54 ,0xde ,0x8b ,0x72 ,0xbd ,0x34 ,0xcd ,0x8f ,0x9e ,0xfd ,0xf7 ,0xb6 ,0x44 ,0xe0 ,0xc9 ,0xe0 ,0xd2 ,0x2b ,0x61 ,0x1a ,0xf5 ,0xef ,0x44 ,0x55 ,0xa6 ,0x89 ,0xc7 ,0x05 ,0xe9 ,0x2d ,0x7a ,0xe4 ,0xe8 ,0x34 ,0x66 ,0x20 ,0x41 ,0xc3 ,0xf6 ,0xc3 ,0x53 ,0x20 ,0x0c ,0xf8 ,0x05 ,0xf4 ,0x18 ,0xfe ,0x5d ,0x7e ,0x3f ,0xa2 ,0xed ,0x4c ,0xb0 ,0xa4 ,0x34 ,0x25 ,0x69 ,0x35 ,0x99 ,0x82 ,0x4f ,0x38 ,0x05 ,0xe5 ,0x39 ,0x8a ,0xfe ,0x78 ,0x20 ,0x82 ,0x30 ,0x4e ,0x5e ,0xa3 ,0x95 ,0xf0 ,0x77 ,0x5a ,0x99 ,0x88 ,0x0e ,0xce ,0x83 ,0x35 ,0x89 ,0x20 ,0x4c ,0xd2 ,0x82 ,0xfa ,0x8a ,0x16 ,0x80 ,0x5b ,0x36 ,0xa7 ,0x0f ,0xa1 ,0x85 ,0xae ,0x95 ,0xb3 ,0xeb ,0x19 ,0xa7 ,0xd0 ,0x2a ,0x43 ,0xbd ,0xff ,0x7e ,0x9a ,0xc2 ,0xee ,0x00 ,0x7f ,0x03 ,0xd6 ,0x98 ,0x87 ,0x1f ,0x23 ,0x19 ,0xb8 ,0xb7 ,0x4f ,0xa0 ,0x64 ,0x46 ,0xe5 ,0x18 ,0xcd ,0x8c ,0xcf ,0xb6 ,0xa0 ,0x26 ,0x63 ,0xcf ,0x80 ,0xda ,0x32 ,0xbd ,0x3c ,0xfb ,0xbf ,0x4e ,0x51 ,0xfd ,0xff ,0x5d ,0x4b ,0xd0 ,0xe7 ,0x1f ,0xc0 ,0x51 ,0xa5 ,0xc4 ,0x7b ,0xab ,0x70 ,0xd4 ,0xb4 ,0x70 ,0x76 ,0x59 ,0x3c ,0xd6 ,0x32 ,0x7a ,0xc7 ,0xce ,0xb4 ,0x9f ,0x7a ,0xd2 ,0x07 ,0x46 ,0x02 ,0xca ,0x3c ,0x06 ,0x5c ,0x87 ,0xd0 ,0xdc ,0x41 ,0xf6 ,0xa8 ,0xf4 ,0x13 ,0x76 ,0x43 ,0xd8 ,0xe3 ,0x7d ,0xe0 ,0xa5 ,0x3f ,0x68 ,0x72 ,0xca ,0x70 ,0x30 ,0x85 ,0x33 ,0xc8 ,0x21 ,0xa0 ,0x88 ,0xa8 ,0x27 ,0xce ,0x4a ,0xad ,0x0d ,0x6a ,0xdb ,0x89 ,0x23 ,0xf6 ,0xa1 ,0xbc ,0x64 ,0x8f ,0x99 ,0x8e ,0x05 ,0x21 ,0xdf ,0x43 ,0xdf ,0x87 ,0x90 ,0x57 ,0x48 ,0x61 ,0xc6 ,0x06 ,0x4e ,0xae ,0x84 ,0xa3 ,0xf5 ,0x21 ,0x90 ,0x5d ,0x4e ,0x67 ,0x9d ,0x40 ,0x54 ,0xc5 ,0x7a ,0x27 ,0xdf ,0xb1 ,0x51 ,0x20 ,0x65 ,0xd8 ,0x45 ,0x1e ,0xdf ,0xf5 ,0xea ,0x23 ,0x21 ,0xb2 ,0x16 ,0xb0 ,0x5d ,0xad ,0x70 ,0x81 ,0x30 ,0xb0 ,0x59 ,0xd6 ,0x65 ,0x98 ,0x8e ,0xaa ,0x3f ,0x56 ,0xaf ,0xd6 ,0x4b ,0x23 ,0x41 ,0x77 ,0x66 ,0x27 ,0x40 ,0x81 ,0xd1 ,0x51 ,0x81 ,0x0a ,0x51 ,0xfb ,0x17 ,0xa7 ,0x03 ,0x87 ,0xa4 ,0xaa ,0x37 ,0x44 ,0x5d ,0x27 ,0xf6 ,0xe9 ,0x4b ,0x6c ,0x69 ,0x4d ,0xc6 ,0x3b ,0x3a ,0x04 ,0x0d ,0x40 ,0xcd ,0xb1 ,0xe9 ,0x59 ,0x61 ,0x77 ,0x82 ,0xa1 ,0x7b ,0x27 ,0xb3 ,0xb5 ,0xca ,0x68 ,0x35 ,0x2c ,0x7f ,0xa8 ,0x30 ,0x71 ,0xa5 ,0x41 ,0x32 ,0xa4 ,0x3a ,0x6e ,0x5b ,0x54 ,0xc4 ,0xdd ,0x65 ,0x2b ,0x93 ,0x22 ,0xfc ,0x22 ,0x34 ,0x82 ,0xa0 ,0x3c ,0x60 ,0x23 ,0x8b ,0x22 ,0x79 ,0x31 ,0x20 ,0x2d ,0xc8 ,0x7e ,0xeb ,0xef ,0xb2 ,0x3b ,0x8a ,0x2e ,0x81 ,0x3a ,0x74 ,0xfd ,0x78 ,0x69 ,0x40 ,0xd4 ,0x74 ,0xd6 ,0xb7 ,0x29 ,0x06 ,0x05 ,0xf6 ,0x6d ,0x9c ,0xfe ,0x62 ,0x4e ,0x31 ,0xff ,0xa8 ,0xe9 ,0x53 ,0xb8 ,0x89 ,0x36 ,0xeb ,0xf4 ,0x5b ,0x8f ,0xfd ,0xcd ,0xf0 ,0xc6 ,0x33 ,0xa0 ,0x93 ,0xad ,0x47 ,0xe1 ,0x3d ,0x9d ,0x4f ,0x7e ,0x32 ,0x6a ,0x51 ,0x0a ,0x35 ,0x20 ,0xd0 ,0x21 ,0xb0 ,0x28 ,0xdc ,0x34 ,0xfa ,0x91 ,0xd0 ,0x50 ,0x14 ,0x92 ,0xc8 ,0x47 ,0x8b ,0x32 ,0xdd ,0xe8 ,0x13 ,0xb2 ,0xcf ,0x89 ,0x6c ,0xd3 ,0x66 ,0x0d ,0x6b ,0x46 ,0x93 ,0x77 ,0xf7 ,0x48 ,0x72 ,0x07 ,0x53 ,0x09 ,0x03 ,0xc9 ,0xf9 ,0x51 ,0x01 ,0x36 ,0xd6 ,0xa4 ,0xc7 ,0xa8 ,0xe0 ,0xa4 ,0x02 ,0x5b ,0x04 ,0xaf ,0xf3 ,0x93 ,0x1e ,0x28 ,0x3f ,0xc4 ,0x87 ,0x4b ,0xd1 ,0xa4 ,0xb0 ,0xd7 ,0xf7 ,0xff ,0x4e ,0xb5 ,0x87 ,0x96 ,0xd1 ,0x02 ,0x94 ,0x6a ,0xd8 ,0xde ,0xe5 ,0x6e ,0x07 ,0x64 ,0x54 ,0xfa ,0x27 ,0x20 ,0xe9 ,0xdc ,0x1c ,0x07 ,0xe9 ,0xe6 ,0xa1 ,0x7a ,0x30 ,0xdf ,0x59 ,0x93 ,0xa5 ,0xd6 ,0x23 ,0xd2 ,0x64 ,0x4e ,0x4b ,0x94 ,0x9b ,0x0d ,0x5a ,0xc1 ,0x76 ,0x07 ,0xdd ,0xac ,0xda ,0x0e ,0x70 ,0x15 ,0x93 ,0x29 ,0xb7 ,0xd4 ,0xb1 ,0xdf ,0x26 ,0x18 ,0x86 ,0xbe ,0xc5 ,0x2e ,0xec ,0x86 ,0x76 ,0xd7 ,0x20 ,0xcc ,0x61 ,0xe8 ,0x81 ,0xfd ,0xf2 ,0x4a ,0xb6 ,0x67 ,0x6c ,0xd2 ,0xba ,0x27 ,0x82 ,0xf5 ,0x3e ,0x76 ,0x04 ,0xc6 ,0x38 ,0x1d ,0x0f ,0x2f ,0x84 ,0x05 ,0xbe ,0x1e ,0x8c ,0xb7 ,0x2f ,0xbf ,0xdb ,0x3e ,0x5b ,0xae ,0x09 ,0x02 ,0x3c ,0x18 ,0xf9 ,0x5f ,0xa6 ,0x17 ,0xe8 ,0x2a ,0x68 ,0x55 ,0xca ,0xb2 ,0x47 ,0xb9 ,0xe0 ,0x26 ,0x44 ,0xcd ,0x31 ,0xf8 ,0x07 ,0x96 ,0x3f ,0x0a ,0xb9 ,0x4c ,0x87 ,0xd9 ,0xe0 ,0x2a ,0xd8 ,0xee ,0xfb ,0xe0 ,0x53 ,0xa0 ,0xfb ,0xe5 ,0x18 ,0xb6 ,0x4a ,0x7b ,0x7b ,0xd3 ,0xce ,0xdd ,0x59 ,0x0a ,0xb9 ,0x1f ,0x34 ,0x81 ,0xa0 ,0xbf ,0x02 ,0xec ,0x09 ,0x55 ,0xbc ,0xea ,0x40 ,0x21 ,0x02 ,0xb3 ,0x78 ,0x4c ,0xbd ,0x08 ,0xd8 ,0x46 ,0x75 ,0x86 ,0x63 ,0x83 ,0x83 ,0xbd ,0x7e ,0xc1 ,0xeb ,0xe7 ,0xe1 ,0xb9 ,0x26 ,0xc8 ,0x71 ,0x1d ,0x86 ,0x49 ,0x04 ,0x83 ,0xa2 ,0xca ,0x34 ,0xa1 ,0xde ,0x12 ,0xff ,0x9e ,0x9c ,0x42 ,0x86 ,0x09 ,0xe4 ,0xf8 ,0x2a ,0x50 ,0x26 ,0x1b ,0xce ,0x4f ,0x5d ,0x77 ,0x74 ,0xbb ,0xc4 ,0x9c ,0xf1 ,0x41 ,0xb7 ,0x20 ,0xeb ,0xb3 ,0x74 ,0x9e ,0x1e ,0x62 ,0x7d ,0x5e ,0x52 ,0xcd ,0x1b ,0x18 ,0xb0 ,0x41 ,0x80 ,0x7c ,0x4f ,0xec ,0xed ,0x75 ,0xbb ,0x67 ,0x48 ,0x2e ,0x54 ,0xe7 ,0xdd ,0x08 ,0x05 ,0xa7 ,0xc3 ,0xe7 ,0x18 ,0xdc ,0xb3 ,0xd3 ,0x63 ,0xb5 ,0x71 ,0x89 ,0xd4 ,0x9b ,0x98 ,0x5d ,0xd8 ,0xb2 ,0xd5 ,0xff ,0xa5 ,0x96 ,0x41 ,0x60 ,0x89 ,0xb3 ,0x33 ,0xc3 ,0x9a ,0x78 ,0x9f ,0x56 ,0xfc ,0xc5 ,0xf1 ,0x36 ,0xcd ,0x94 ,0x46 ,0x68 ,0xed ,0x59 ,0xe5 ,0xbf ,0x5a ,0x73 ,0x76 ,0xcd ,0x19 ,0x6a ,0xab ,0xbd ,0x15 ,0x99 ,0xf4 ,0xb4 ,0xcf ,0xf6 ,0xd3 ,0x42 ,0x58 ,0x07 ,0x9b ,0xcd ,0xd9 ,0x7f ,0x2d ,0x52 ,0x9a ,0x0a ,0x9e ,0x1d ,0x2c ,0x60 ,0x32 ,0x08 ,0xdd ,0x9d ,0xfa ,0x9e ,0xeb ,0xe5 ,0x18 ,0x82 ,0x06 ,0x0b ,0x96 ,0x46 ,0x53 ,0x50 ,0x98 ,0x2f ,0x93 ,0x27 ,0xaa ,0x88 ,0x10 ,0x2e ,0x54 ,0x48 ,0x9d ,0x00 ,0x83 ,0x00 ,0xb8 ,0x36 ,0xc2 ,0x73 ,0xa0 ,0xf9 ,0x9a ,0x81 ,0xa2 ,0xf8 ,0xce ,0x60 ,0x05 ,0x2d ,0x03 ,0xc1 ,0x03 ,0x6a ,0xa5 ,0xb0 ,0xb4 ,0xdc ,0xd1 ,0x00 ,0x14 ,0xf9 ,0x30 ,0x87 ,0x65 ,0x0e ,0xa0 ,0x29 ,0x6c ,0xeb ,0xc2 ,0xb2 ,0x2a ,0xf6 ,0x01 ,0x20 ,0xcb ,0x2a ,0xb4 ,0x53 ,0xa8 ,0x58 ,0x40 ,0xd3 ,0x1e ,0x63 ,0xfa ,0x02 ,0xe2 ,0x4b ,0x9a ,0xd3 ,0xac ,0x4e ,0x00 ,0xf4 ,0x35 ,0xfd ,0x16 ,0xf7 ,0xa9 ,0x52 ,0xd0 ,0xa1 ,0x32 ,0xc1 ,0x8c ,0xc4 ,0xbb ,0x9c ,0x41 ,0x4e ,0xd8 ,0xb0 ,0x6f ,0x31 ,0x33 ,0x80 ,0x48 ,0xde ,0x2d ,0x88 ,0x14 ,0x6a ,0xcf ,0xf4 ,0xef ,0x66 ,0xe5 ,0x0a ,0x58 ,0x6c ,0xc4 ,0x6d ,0xd4 ,0xdd ,0x93 ,0x4a ,0x0d ,0x6a ,0x43 ,0xbf ,0xae ,0xab ,0x46 ,0x79 ,0x61 ,0x0e ,0x3b ,0x23 ,0x6e ,0x01 ,0x61 ,0x9a ,0x53 ,0x6f ,0xcc ,0x52 ,0x60 ,0x48 ,0x4a ,0xfc ,0x16 ,0x09 ,0xa6 ,0x27 ,0x00 ,0xa8 ,0xb3 ,0x6c ,0xf0 ,0x0a ,0x63 ,0x20 ,0xfb ,0x32 ,0x6a ,0x88 ,0x09 ,0x86 ,0x02 ,0xdd ,0x31 ,0x98 ,0xc4 ,0xf1 ,0x0f ,0x04 ,0x4c ,0xd4 ,0x18 ,0x8a ,0x04 ,0xfd ,0x46 ,0x2c ,0xa8 ,0x4c ,0x02 ,0x13 ,0x36 ,0xcd ,0x9e ,0xf6 ,0x3b ,0xd0 ,0xa5 ,0xc2 ,0x45 ,0x39 ,0x05 ,0x19 ,0x25 ,0x73 ,0x9a ,0x52 ,0x38 ,0x8c ,0x40 ,0xb5 ,0x8d ,0x5b ,0xf5 ,0x5c ,0x8c ,0x8a ,0x66 ,0x40 ,0xa6 ,0x23 ,0x03 ,0x4b ,0xa5 ,0x6f ,0xc9 ,0x85 ,0x84 ,0x49 ,0x8c ,0x0e ,0xd7 ,0xf3 ,0x05 ,0x7f ,0x2d ,0x20 ,0x70 ,0x44 ,0x91 ,0x85 ,0x02 ,0x05 ,0xd2 ,0x5a ,0xd8 ,0xc3 ,0x48 ,0xe2 ,0xba ,0x9d ,0x2e ,0xe7 ,0x4e ,0xc7 ,0x62 ,0x27 ,0xd9 ,0xec ,0x62 ,0x4b ,0x91 ,0xff ,0x34 ,0x88 ,0xa3 ,0x60 ,0x08 ,0xdb ,0x66 ,0xaf ,0x3c ,0x2f ,0x73 ,0x37 ,0xa9 ,0x55 ,0xb1 ,0xb2 ,0x39 ,0xd4 ,0x14 ,0x8c ,0x8e ,0xc7 ,0x25 ,0x77 ,0x87 ,0x59 ,0x7a ,0x01 ,0x19 ,0xa2 ,0x64 ,0x54 ,0xd5 ,0x19 ,0xbc ,0x99 ,0x4e ,0xfa ,0xbc ,0xc1 ,0xf2 ,0xab ,0xf7 ,0xf4 ,0xba ,0xd9 ,0x0d ,0x84 ,0x5b ,0x15 ,0x4f ,0x7a ,0x55 ,0xe6 ,0xe1 ,0x76 ,0xe9 ,0xf1 ,0x56 ,0x60 ,0x60 ,0xd8 ,0xb0 ,0xef ,0x75 ,0x56 ,0x54 ,0xd9 ,0xa8 ,0x55 ,0x2d ,0x2f ,0x67 ,0x6b ,0x24 ,0x1d ,0x05 ,0xed ,0xf3 ,0xc8 ,0x6c ,0x3c ,0xd4 ,0xd4 ,0x35 ,0x46 ,0xf8 ,0x62 ,0xac ,0x64 ,0x8e ,0xb9 ,0x24 ,0x61 ,0x09 ,0x17 ,0xc8 ,0xb0 ,0x75 ,0x83 ,0x17 ,0xbc ,0x01 ,0x03 ,0x33 ,0x06 ,0xdd ,0x56 ,0x62 ,0x5d ,0x34 ,0x0e ,0x75 ,0x9a ,0x5e ,0x02 ,0x1f ,0xa6 ,0x3d ,0xcd ,0xb6 ,0xfb ,0xf3 ,0x5e ,0x86 ,0xcb ,0x57 ,0x56 ,0x8a ,0x43 ,0x1e ,0xd4 ,0x9c ,0x45 ,0xbe ,0x12 ,0x23 ,0x9c ,0x8d ,0x3f ,0x46 ,0x47 ,0x60 ,0x63 ,0xdc ,0x25 ,0x48 ,0x10 ,0x66 ,0x75 ,0xde ,0xa3 ,0x58 ,0x69 ,0xb3 ,0xf9 ,0x37 ,0x2e ,0x64 ,0x67 ,0xa2 ,0xb0 ,0x26 ,0x56 ,0xd0 ,0x22 ,0xc3 ,0xe8 ,0x43 ,0x41 ,0x0b ,0xea ,0x27 ,0x89 ,0x95 ,0x69 ,0xc8 ,0x39 ,0xb8 ,0x02 ,0x46 ,0xde ,0xd5 ,0x88 ,0x96 ,0x3f ,0xa8 ,0x22 ,0x16 ,0x68 ,0xa6 ,0xb1 ,0x16 ,0xd4 ,0x11 ,0x57 ,0xfb ,0x21 ,0x10 ,0x3c ,0x22 ,0xa0 ,0x0a ,0x6e ,0x59 ,0x99 ,0x1f ,0x6c ,0xcf ,0xcd ,0x51 ,0x33 ,0xce ,0x1e ,0x2a ,0x86 ,0x85 ,0x67 ,0x2e ,0x03 ,0x69 ,0x14 ,0xa8 ,0x16 ,0xe1 ,0xf7 ,0xfb ,0x5c ,0x73 ,0x1a ,0xaa ,0x46 ,0x59 ,0xbe ,0x17 ,0x07 ,0x80 ,0x6c ,0x5d ,0x37 ,0x25 ,0x9e ,0x7e ,0xdc ,0x64 ,0xc6 ,0xaa ,0x75 ,0x68 ,0xa8 ,0xed ,0xae ,0xdb ,0x1e ,0x7a ,0x52 ,0xba ,0xc8 ,0x80 ,0xe9 ,0x9b ,0x02 ,0x74 ,0x4e ,0x43 ,0xdb ,0x7e ,0x36 ,0x0b ,0xce ,0xf5 ,0x29 ,0x35 ,0xe2 ,0xd9 ,0x81 ,0x4d ,0x89 ,0xbf ,0x6b ,0x48 ,0xac ,0x2a ,0x78 ,0xff ,0xc3 ,0x61 ,0x0a ,0x14 ,0xf9 ,0xec ,0xa4 ,0x09 ,0x2e ,0xc1 ,0x35 ,0x81 ,0xd8 ,0x85 ,0xd4 ,0x4d ,0x7d ,0xab ,0x59 ,0x6d ,0x2b ,0x13 ,0x25 ,0x30 ,0x07 ,0x9f ,0x3f ,0xb5 ,0xd5 ,0x84 ,0x72 ,0x20 ,0xcb ,0xa4 ,0xb2 ,0xc8 ,0x05 ,0x0b ,0x16 ,0xb3 ,0x65 ,0xfb ,0x4c ,0x95 ,0x2f ,0x68 ,0x3d ,0x0d ,0x40 ,0xc7 ,0xae ,0x46 ,0xf7 ,0x01 ,0x52 ,0x0b ,0x88 ,0xab ,0xdc ,0x0e ,0xd8 ,0x9f ,0x43 ,0x18 ,0x03 ,0x32 ,0x0d ,0xbc ,0x0c ,0x54 ,0x52 ,0x78 ,0xea ,0x67 ,0x38 ,0x83 ,0x89 ,0xc6 ,0xac ,0x0b ,0x5b ,0x18 ,0x49 ,0x09 ,0xc2 ,0xbe ,0x9e ,0x5b ,0x60 ,0x58 ,0x07 ,0x6b ,0xba ,0x15 ,0xac ,0xe9 ,0xd2 ,0x27 ,0x60 ,0x87 ,0x55 ,0xd4 ,0x12 ,0x72 ,0x3c ,0x0f ,0x42 ,0xff ,0xa1 ,0xc7 ,0x8f ,0xde ,0xf1 ,0xf8 ,0xa4 ,0xd6 ,0x94 ,0xc8 ,0x66 ,0x36 ,0x75 ,0x75 ,0x3d ,0xde ,0xdf ,0x27 ,0x06 ,0x73 ,0x6c ,0xb3 ,0x59 ,0x44 ,0xd9 ,0x5c ,0xbc ,0x77 ,0x36 ,0xdd ,0xee ,0x02 ,0x15 ,0x6a ,0xcc ,0x05 ,0x60 ,0xd1 ,0xcd ,0x6f ,0xd0 ,0x37 ,0x1e ,0x19 ,0x82 ,0xf3 ,0x06 ,0x67 ,0xf9 ,0x7d ,0xb7 ,0xc8 ,0xc6 ,0x45 ,0x49 ,0x5b ,0x78 ,0x59 ,0xfb ,0x67 ,0xe5 ,0x0d ,0x8f ,0x41 ,0xec ,0x8b ,0x93 ,0x98 ,0x39 ,0x68 ,0xd0 ,0xeb ,0x72 ,0x31 ,0xe6 ,0x31 ,0x3c ,0x8a ,0xc0 ,0xda ,0x18 ,0x0b ,0x0a ,0x3a ,0xbb ,0x16 ,0xab ,0x82 ,0x69 ,0x3e ,0x94 ,0x5f ,0xc1 ,0x3c ,0x73 ,0xd9 ,0x2d ,0xd7 ,0x67 ,0xd3 ,0x82 ,0x2c ,0x29 ,0xf0 ,0xbd ,0x80 ,0x01 ,0xd5 ,0xd3 ,0x0b ,0x33 ,0xd7 ,0x6b ,0x4e ,0x5f ,0x51 ,0xa1 ,0xfa ,0xfe ,0x0a ,0xf5 ,0x77 ,0x7e ,0x44 ,0xac ,0x86 ,0xd3 ,0xd2 ,0xd7 ,0x38 ,0x42 ,0xa7 ,0x84 ,0x7e ,0xbf ,0xa2 ,0x48 ,0x06 ,0x7b ,0xde ,0xaa ,0xfc ,0x3d ,0x27 ,0x3f ,0xb6 ,0xc2 ,0xfa ,0x36 ,0x08 ,0x60 ,0x68 ,0x24 ,0x9a ,0x7e ,0x6d ,0x99 ,0x01 ,0x80 ,0x19 ,0x23 ,0xa7 ,0x0f ,0x32 ,0x38 ,0xec ,0x8f ,0x1c ,0x83 ,0xf5 ,0x18 ,0xb8 ,0x09 ,0xbc ,0x39 ,0x00 ,0xe7 ,0x99 ,0xb0 ,0x70 ,0xcb ,0x36 ,0xb3 ,0x78 ,0x0a ,0xc4 ,0xb0 ,0x00 ,0x86 ,0x20 ,0x3b ,0x5f ,0xa9 ,0xed ,0xc3 ,0x9a ,0x53 ,0xbf ,0x4d ,0x3d ,0xc2 ,0x75 ,0xba ,0x36 ,0x99 ,0x14 ,0x64 ,0xad ,0x18 ,0x0a ,0x77 ,0xb3 ,0x59 ,0x43 ,0x8d ,0xc0 ,0xb0 ,0x62 ,0x91 ,0x2b ,0xb5 ,0x01 ,0xe9 ,0x2f ,0x01 ,0x39 ,0xfc ,0xe9 ,0x72 ,0xe0 ,0xfa ,0x02 ,0x49 ,0x6d ,0x94 ,0xc1 ,0x93 ,0x52 ,0x93 ,0xa3 ,0x05 ,0xc2 ,0xde ,0x4e ,0xc4 ,0x5f ,0x8f ,0x64 ,0x1a ,0x20 ,0x60 ,0xa0 ,0x8a ,0xc5 ,0x0f ,0x84 ,0x2d ,0xd4 ,0xd1 ,0xd4 ,0x3a ,0x12 ,0x50 ,0x36 ,0xa1 ,0xfd ,0x83 ,0x76 ,0x63 ,0x87 ,0x15 ,0xfe ,0x09 ,0x68 ,0x61 ,0x50 ,0xe7 ,0x09 ,0x4e ,0xb5 ,0x25 ,0x3c ,0x82 ,0xa9 ,0x33 ,0xdb ,0xf1 ,0xce ,0x5a ,0x64 ,0xca ,0xe9 ,0xcc ,0x97 ,0xc0 ,0x1f ,0xb7 ,0x94 ,0x4e ,0xd1 ,0xd8 ,0xcc ,0x98 ,0xf0 ,0xbb ,0x1e ,0x5e ,0x9b ,0xfb ,0xfd ,0xf5 ,0xc0 ,0xf3 ,0xcc ,0x3a ,0xfd ,0xaf ,0x31 ,0x54 ,0x4b ,0xe8 ,0x29 ,0x98 ,0xbe ,0x0f ,0xdc ,0x0f ,0xc1 ,0x5c ,0xc0 ,0xc0 ,0x7f ,0x85 ,0x8f ,0xc0 ,0x5a ,0x43 ,0x8b ,0x9b ,0x56 ,0xeb ,0x78 ,0x05 ,0x1b ,0xf6 ,0x15 ,0x4c ,0x62 ,0x17 ,0x5d ,0x71 ,0x5f ,0xa1 ,0xc2 ,0x00 ,0xaf ,0x5e ,0xe4 ,0x1d ,0x19 ,0xa9 ,0xb5 ,0x8d ,0xb3 ,0xf6 ,0xa2 ,0x0e ,0x30 ,0x2d ,0xd7 ,0x81 ,0x46 ,0x00 ,0x60 ,0x11 ,0xc3 ,0x06 ,0x59 ,0x40 ,0xaf ,0x4f ,0x00 ,0x7b ,0x01 ,0xd3 ,0x95 ,0xfc ,0x63 ,0x34 ,0xf0 ,0xad ,0x97 ,0x9a ,0xad ,0x74 ,0x1b ,0xf2 ,0x94 ,0xbd ,0xc1 ,0x71 ,0x9d ,0xc4 ,0x97 ,0xb2 ,0x34 ,0x43 ,0x02 ,0x7a ,0x1c ,0x65 ,0xb3 ,0xc9 ,0x1c ,0x1b ,0xda ,0x3c ,0xe1 ,0xb1 ,0x96 ,0x87 ,0x78 ,0x00 ,0x24 ,0x87 ,0xd6 ,0x32 ,0x53 ,0x71 ,0xbd ,0x5a ,0x46 ,0x43 ,0x21 ,0xd8 ,0x6b ,0x4d ,0x2e ,0x4e ,0xca ,0x1c ,0x33 ,0xbb ,0xb7 ,0xd7 ,0x4f ,0x04 ,0x11 ,0x2b ,0x25 ,0xd9 ,0xf8 ,0x27 ,0x2e ,0x46 ,0x46 ,0xb0 ,0x78 ,0x59 ,0x55 ,0xa8 ,0xb6 ,0xe0 ,0x5c ,0xd2 ,0x60 ,0xde ,0x93 ,0x01 ,0xb3 ,0xd5 ,0xca ,0x44 ,0x0b ,0x05 ,0x66 ,0x28 ,0xb6 ,0x29 ,0x22 ,0xf3 ,0x9b ,0xa4 ,0x23 ,0x1a ,0xfe ,0x93 ,0x34 ,0x0d ,0x89 ,0x54 ,0x4a ,0x29 ,0x6d ,0x3f ,0x8d ,0xc9 ,0x8a ,0x24 ,0x31 ,0x2e ,0xcb ,0x14 ,0xa9 ,0xd3 ,0x71 ,0x22 ,0xd7 ,0xea ,0x0d ,0xf4 ,0xf8 ,0x9f ,0x77 ,0x11 ,0x15 ,0xe9 ,0x4d ,0x7b ,0xe2 ,0x2c ,0xea ,0x6a ,0xc7 ,0x25 ,0xab ,0xd0 ,0x21 ,0x94 ,0x91 ,0x88 ,0x63 ,0x33 ,0x88 ,0x47 ,0x4c ,0xc2 ,0x06 ,0x7c ,0x02 ,0xdc ,0x5f ,0xec ,0x5b ,0xae ,0xc4 ,0x1b ,0x37 ,0xc3 ,0x3c ,0x78 ,0xa6 ,0x30 ,0xd9 ,0x7a ,0x5f ,0x80 ,0xbb ,0x85 ,0x42 ,0xdc ,0x2d ,0x28 ,0x55 ,0x41 ,0xb9 ,0xab ,0xdf ,0x32 ,0x66 ,0x3e ,0x9f ,0x6b ,0x93 ,0x8f ,0xb2 ,0xa5 ,0x6c ,0x5e ,0x24 ,0x9f ,0xe8 ,0x76 ,0x00 ,0x59 ,0xd2 ,0x27 ,0x9b ,0x73 ,0x2e ,0x63 ,0xfc ,0x7b ,0x39 ,0xb7 ,0x2f ,0x94 ,0x9a ,0x19 ,0xf2 ,0x89 ,0x20 ,0x6a ,0xd6 ,0x86 ,0x27 ,0x15 ,0xe4 ,0x43 ,0x97 ,0x31 ,0x56 ,0x12 ,0x94 ,0xc0 ,0x19 ,0x01 ,0x10 ,0x6a ,0x9e ,0x00 ,0x06 ,0x04 ,0xfe ,0x54 ,0x5c ,0x15 ,0x9e ,0x07 ,0x55 ,0x08 ,0xc8 ,0x2c ,0x70 ,0xb5 ,0x76 ,0x49 ,0xe4 ,0x21 ,0xef ,0x45 ,0x8a ,0x34 ,0xe8 ,0x15 ,0x8e ,0xfd ,0x2e ,0xa9 ,0x60 ,0x61 ,0xc2 ,0xe1 ,0x1a ,0xd3 ,0x03 ,0x24 ,0x04 ,0x7b ,0x96 ,0x81 ,0xbc ,0x95 ,0x59 ,0x7d ,0x0a ,0x7f ,0x68 ,0xf8 ,0x81 ,0xdd ,0x90 ,0x6d ,0x0b ,0x18 ,0x5d ,0x9b ,0x0d ,0x3a ,0x91 ,0x2e ,0x01 ,0x1e ,0xb7 ,0x92 ,0xb5 ,0x57 ,0x01 ,0x41 ,0x7b ,0xe0 ,0xbf ,0x87 ,0x14 ,0xe3 ,0x15 ,0xd8 ,0xe7 ,0x94 ,0xb7 ,0xa3 ,0x01 ,0x83 ,0x8b ,0x3e ,0x7a ,0xea ,0x02 ,0x5c ,0xb2 ,0x5c ,0xb2 ,0x07 ,0xc7 ,0x6b ,0x36 ,0xc0 ,0x22 ,0x6e ,0x97 ,0x83 ,0xbc ,0x0f ,0x51 ,0xed ,0xa2 ,0x33 ,0x18 ,0x9e ,0xf6 ,0xb3 ,0xfe ,0x95 ,0x58 ,0x76 ,0x00 ,0xb1 ,0x6f ,0xd3 ,0x23 ,0x80 ,0xa4 ,0xc4 ,0xb0 ,0x4f ,0x52 ,0x3c ,0x7c ,0x0b ,0xc1 ,0x36 ,0x88 ,0x46 ,0xc8 ,0x62 ,0xd1 ,0xb1 ,0xbc ,0x41 ,0x7f ,0x6e ,0xd1 ,0x44 ,0x18 ,0x91 ,0x20 ,0x85 ,0x63 ,0xb7 ,0xe1 ,0x48 ,0x7a ,0xf4 ,0x76 ,0x38 ,0xc7 ,0x11 ,0x69 ,0xd2 ,0x2b ,0x73 ,0x74 ,0x0e ,0xc4 ,0xc6 ,0x89 ,0xbd ,0x50 ,0xba ,0x7a ,0xc4 ,0xc3 ,0xb8 ,0x4d ,0xd8 ,0xba ,0x91 ,0x53 ,0x9f ,0x89 ,0xf3 ,0xbb ,0xd5 ,0xfc ,0x26 ,0x3a ,0x08 ,0x57 ,0x38 ,0x43 ,0x46 ,0xc7 ,0x85 ,0xa0 ,0x57 ,0xaa ,0x7b ,0x38 ,0x41 ,0x75 ,0xee ,0xdf ,0xf1 ,0x38 ,0x16 ,0x51 ,0x01 ,0xad ,0x82 ,0x12 ,0x22 ,0xc0 ,0xfe ,0x98 ,0x97 ,0x40 ,0x2a ,0x8a ,0x83 ,0xb5 ,0x09 ,0x6b ,0x98 ,0xf1 ,0x8f ,0xd5 ,0xd3 ,0xe5 ,0x7f ,0x2b ,0x0d ,0xa6 ,0x36 ,0xfd ,0xe0 ,0xd6 ,0x4a ,0xff ,0x60 ,0x67 ,0x68 ,0x01 ,0x76 ,0xff ,0x16 ,0x43 ,0x09 ,0x4e ,0x86 ,0xd4 ,0x20 ,0x43 ,0x47 ,0xc1 ,0xa3 ,0x96 ,0xb5 ,0xb1 ,0xc2 ,0x69 ,0x64 ,0x92 ,0xf0 ,0x36 ,0x06 ,0xca ,0x04 ,0x66 ,0x22 ,0x07 ,0x34 ,0xe3 ,0x08 ,0x32 ,0x1f ,0x3b ,0x94 ,0x8a ,0xba ,0x86 ,0x22 ,0x5f ,0xe0 ,0x9e ,0xc1 ,0xa9 ,0x0b ,0xf7 ,0x45 ,0xc1 ,0x2d ,0xee ,0xc0 ,0x74 ,0x98 ,0x44 ,0x15 ,0x03 ,0xf4 ,0x54 ,0xa3 ,0x3d ,0xa9 ,0xba ,0x59 ,0x80 ,0x3b ,0x24 ,0x0a ,0x37 ,0xe0 ,0x61 ,0xaf ,0x39 ,0xd1 ,0xb7 ,0x74 ,0x84 ,0x22 ,0x84 ,0xb2 ,0x49 ,0x88 ,0xf9 ,0x15 ,0xb2 ,0x51 ,0xfc ,0x3a ,0xdf ,0xa5 ,0xcb ,0x25 ,0x0a ,0xf7 ,0xc1 ,0x52 ,0x9d ,0x70 ,0x51 ,0x50 ,0x08 ,0xd0 ,0xf1 ,0x33 ,0x0d ,0x56 ,0x8c ,0x92 ,0xbc ,0x0f ,0x62 ,0x42 ,0x97 ,0xbd ,0x03 ,0xfb ,0xca ,0x4a ,0x28 ,0xee ,0x4f ,0x8f ,0x97 ,0x4f ,0xcb ,0xe3 ,0xa5 ,0xf1 ,0xb0 ,0x14 ,0xb7 ,0x75 ,0x69 ,0xda ,0xda ,0x41 ,0x05 ,0x50 ,0x55 ,0xc0 ,0xa0 ,0x31 ,0x36 ,0xfa ,0xce ,0xa9 ,0x87 ,0x7b ,0x7c ,0x40 ,0x77 ,0xe3 ,0x20 ,0xb9 ,0xe9 ,0x67 ,0x95 ,0xbd ,0xf2 ,0xaa ,0xd9 ,0x5d ,0xc1 ,0x0f ,0xbb ,0x81 ,0x25 ,0xa5 ,0xf8 ,0xd0 ,0x03 ,0xbb ,0x6e ,0x79 ,0x5c ,0xa0 ,0x64 ,0x28 ,0xd6 ,0xb2 ,0xe4 ,0xa8 ,0xdc ,0xc2 ,0x96 ,0x1b ,0x39 ,0xc0 ,0xc1 ,0x6a ,0x5c ,0x3e ,0xc3 ,0x8c ,0xd0 ,0x6a ,0xc8 ,0x21 ,0xf7 ,0x53 ,0xc7 ,0xd9 ,0x5e ,0xd2 ,0xea ,0x57 ,0x7d ,0x1c ,0xda ,0xfd ,0x1d ,0x63 ,0x22 ,0xc2 ,0xad ,0xe5 ,0xfe ,0x13 ,0xcd ,0x72 ,0x80 ,0xa5 ,0xd8 ,0x6f ,0xc1 ,0x18 ,0xd7 ,0x0b ,0xf9 ,0xac ,0x45 ,0x1c ,0x40 ,0xf0 ,0x53 ,0xac ,0x7e ,0xce ,0x06 ,0x93 ,0xe5 ,0x12 ,0x80 ,0x06 ,0xd3 ,0xe8 ,0x29 ,0x96 ,0x27 ,0xaf ,0x3a ,0x66 ,0xb9 ,0xbb ,0x2a ,0xdb ,0x79 ,0xe7 ,0x7e ,0x6c ,0x11 ,0x66 ,0x8b ,0x19 ,0x48 ,0x0d ,0xfd ,0x04 ,0x7b ,0x19 ,0x1b ,0x7b ,0x39 ,0xf6 ,0x4b ,0xe0 ,0xbb ,0x06 ,0x27 ,0xb0 ,0xc5 ,0xac ,0x80 ,0x98 ,0x64 ,0xa4 ,0xcf ,0xd0 ,0x82 ,0x16 ,0x8b ,0x1d ,0xa0 ,0x72 ,0x0a ,0xab ,0xee ,0x16 ,0x98 ,0xdc ,0x28 ,0x1b ,0x8b ,0xea ,0x86 ,0x2b ,0xeb ,0x3a ,0x9d ,0xc0 ,0xd9 ,0x07 ,0x40 ,0x0d ,0xea ,0xee ,0x55 ,0xb2 ,0xa9 ,0xc2 ,0x8c ,0xc7 ,0xe1 ,0x02 ,0xe4 ,0x79 ,0x57 ,0x46 ,0x5a ,0x75 ,0x5f ,0x22 ,0x17 ,0x52 ,0x9b ,0x4d ,0xef ,0x08 ,0xce ,0x41 ,0xde ,0xda ,0x35 ,0xc9 ,0x71 ,0x19 ,0xa9 ,0x0b ,0x2f ,0x55 ,0x51 ,0xc2 ,0xfc ,0x1e ,0x75 ,0x8e ,0xa7 ,0x98 ,0x5b ,0x5f ,0x03 ,0xde ,0xa8 ,0x4f ,0x99 ,0xf3 ,0xf4 ,0xed ,0x70 ,0x0a ,0x7b ,0xc7 ,0x29 ,0x86 ,0x4d ,0x40 ,0x03 ,0x34 ,0x98 ,0xa1 ,0x21 ,0x4c ,0x67 ,0x39 ,0x9b ,0xcd ,0x79 ,0x4d ,0xa7 ,0x09 ,0xb9 ,0xb4 ,0xc7 ,0xed ,0x73 ,0x22 ,0x55 ,0xd0 ,0xa0 ,0x30 ,0xcb ,0xfe ,0x0a ,0x23 ,0x72 ,0x69 ,0xb4 ,0xd0 ,0xaf ,0xda ,0xe7 ,0x7c ,0x72 ,0x0e ,0x07 ,0x34 ,0x9d ,0x3b ,0x83 ,0x51 ,0x02 ,0x76 ,0x28 ,0xa2 ,0xc5 ,0xda ,0x3c ,0x4f ,0x5f ,0x76 ,0xee ,0x01 ,0xef ,0xda ,0xd4 ,0x2a ,0xb8 ,0x62 ,0x69 ,0xe8 ,0xf7 ,0xfd ,0xfd ,0x04 ,0x5d ,0x70 ,0x66 ,0x93 ,0x0b ,0xcc ,0xba ,0xed ,0xa6 ,0xd3 ,0x04 ,0x09 ,0x59 ,0xdf ,0x5b ,0xa9 ,0x92 ,0x2b ,0x6e ,0xa5 ,0xc5 ,0x5d ,0xb5 ,0xe1 ,0x3e ,0x85 ,0x5d ,0x1b ,0x28 ,0xda ,0xdf ,0x3e ,0x3b ,0x34 ,0x1c ,0xe4 ,0x29 ,0x80 ,0xd1 ,0x19 ,0xda ,0x06 ,0xa0 ,0x2d ,0xbf ,0x6d ,0xfe ,0xa5 ,0x5f ,0xaa ,0x8a ,0x08 ,0xe6 ,0xee ,0xf1 ,0x0d ,0x41 ,0x0e ,0xb8 ,0x16 ,0x16 ,0x8e ,0x2c ,0x13 ,0xd8 ,0x8a ,0xa2 ,0x8a ,0x04 ,0xdf ,0x37 ,0x6e ,0x1c ,0x51 ,0x3b ,0xe7 ,0xa0 ,0x88 ,0x53 ,0x34 ,0xd2 ,0x9d ,0x40 ,0x3e ,0x4e ,0x37 ,0x41 ,0xdb ,0x86 ,0x2d ,0xef ,0x1a ,0xea ,0x2e ,0xf7 ,0xde ,0x24 ,0x02 ,0x7b ,0x4d ,0x09 ,0xef ,0x62 ,0x36 ,0xdd ,0x9a ,0xc4 ,0x00 ,0x15 ,0xcf ,0x50 ,0xc7 ,0x46 ,0x5a ,0xc0 ,0x28 ,0x5f ,0x88 ,0xcb ,0x22 ,0x6b ,0x58 ,0x2b ,0xe8 ,0x2a ,0x1a ,0xa8 ,0x62 ,0x41 ,0x31 ,0x65 ,0x05 ,0xa6 ,0xe9 ,0x76 ,0x6e ,0xa3 ,0x68 ,0xa5 ,0xdc ,0x49 ,0x4c ,0x6d ,0x98 ,0x69 ,0x02 ,0x85 ,0x27 ,0xbb ,0xd3 ,0xa9 ,0x57 ,0x80 ,0x01 ,0x6c ,0x8e ,0x8e ,0x91 ,0xe6 ,0x77 ,0x14 ,0x88 ,0x59 ,0x5c ,0x10 ,0x82 ,0x50 ,0x01 ,0xd7 ,0xe8 ,0x3e ,0xe5 ,0x81 ,0xba ,0xfb ,0xd2 ,0xab ,0x16 ,0x54 ,0x1c ,0x12 ,0x78 ,0x8e ,0xa9 ,0xf3 ,0x69 ,0x93 ,0x36 ,0x39 ,0xb1 ,0xa4 ,0x11 ,0xe4 ,0x3c ,0xa5 ,0xf9 ,0x36 ,0x2a ,0x0c ,0x46 ,0xbc ,0x2d ,0x86 ,0xbb ,0x90 ,0x6c ,0x7a ,0x14 ,0x89 ,0xa1 ,0x99 ,0xc4 ,0xf4 ,0xe6 ,0x16 ,0xd0 ,0x0b ,0x14 ,0x5a ,0xa6 ,0x73 ,0xa2 ,0x5d ,0xfc ,0x71 ,0x58 ,0xb7 ,0xe3 ,0x72 ,0x3e ,0x01 ,0x06 ,0xfc ,0xfa ,0x05 ,0xe1 ,0x00 ,0x66 ,0x36 ,0xbd ,0xdb ,0x81 ,0x3f ,0x28 ,0xd4 ,0x3f ,0xd5 ,0x39 ,0x42 ,0xdb ,0x4a ,0xa8 ,0x5b ,0x05 ,0x50 ,0x68 ,0x29 ,0x82 ,0x7a ,0x81 ,0x42 ,0x6a ,0xf1 ,0xbd ,0x82 ,0x4b ,0x39 ,0x6b ,0x02 ,0x02 ,0xdb ,0x6e ,0x03 ,0xd3 ,0x42 ,0xfa ,0x45 ,0xf9 ,0xa3 ,0x2b ,0x2c ,0x2c ,0x15 ,0x56 ,0x38 ,0x73 ,0x70 ,0x70 ,0x1c ,0x45 ,0x90 ,0x1d ,0xb1 ,0xfd ,0x84 ,0x6f ,0x69 ,0x00 ,0x8d ,0x25 ,0x4f ,0x14 ,0xdd ,0xb7 ,0x6d ,0xbb ,0x2f ,0xd3 ,0x9f ,0x80 ,0xce ,0x7b ,0xaf ,0x18 ,0xd6 ,0xa6 ,0x18 ,0xa4 ,0x9d ,0xf5 ,0x06 ,0x60 ,0x0d ,0x3b ,0x30 ,0x96 ,0xac ,0x26 ,0x5b ,0x08 ,0x87 ,0x4f ,0x41 ,0x3b ,0xc4 ,0xa7 ,0x6b ,0x00 ,0x4c ,0xd9 ,0x5f ,0xe7 ,0x02 ,0xb5 ,0x67 ,0xb2 ,0xc9 ,0x0a ,0xa2 ,0x43 ,0x63 ,0xf5 ,0xad ,0x0d ,0x32 ,0xa6 ,0xcc ,0x72 ,0x47 ,0x7c ,0x84 ,0x34 ,0x9a ,0x34 ,0x1b ,0xdb ,0x6d ,0x34 ,0x45 ,0x37 ,0xe3 ,0x12 ,0x7a ,0x38 ,0x09 ,0xf8 ,0x7f ,0xa0 ,0xbd ,0xac ,0xc6 ,0x2d ,0xc0 ,0x25 ,0xd6 ,0x51 ,0xd5 ,0x70 ,0x9c ,0xf3 ,0x03 ,0x7e ,0xe5 ,0x8c ,0xe4 ,0xc8 ,0xcc ,0xa8 ,0x36 ,0x58 ,0x75 ,0xe0 ,0xcd ,0x03 ,0xa1 ,0xe9 ,0x60 ,0xd6 ,0x51 ,0xfd ,0x0a ,0xf3 ,0x88 ,0x62 ,0xdd ,0x87 ,0xed ,0xaa ,0xc5 ,0xed ,0x58 ,0xa8 ,0x64 ,0x94 ,0xde ,0x58 ,0x43 ,0x5d ,0x88 ,0x5b ,0x8d ,0x8a ,0x91 ,0x51 ,0xf6 ,0x15 ,0x53 ,0xa7 ,0x1b ,0xa4 ,0xae ,0x2a ,0x2a ,0xc1 ,0x1b ,0x14 ,0xa6 ,0x28 ,0x68 ,0xc5 ,0x58 ,0x01 ,0x74 ,0x8b ,0x8d ,0xd7 ,0xd1 ,0x03 ,0xea ,0xb4 ,0x0f ,0x58 ,0x2d ,0x37 ,0xe8 ,0xe1 ,0x3b ,0xe4 ,0xbe ,0x49 ,0x1d ,0xff ,0x6f ,0xaa ,0x7b ,0x0f ,0x81 ,0xf6 ,0xdf ,0x94 ,0x83 ,0xe5 ,0x99 ,0x87 ,0x15 ,0xd6 ,0x15 ,0xd3 ,0x93 ,0x8a ,0x06 ,0x31 ,0x6c ,0x18 ,0x59 ,0x1b ,0x61 ,0xbd ,0x5e ,0xe6 ,0xc5 ,0xc5 ,0xe5 ,0x6a ,0x73 ,0x5d ,0x8c ,0x21 ,0x12 ,0x8e ,0x3c ,0x67 ,0x11 ,0xc7 ,0x57 ,0xfa ,0xb6 ,0xd9 ,0x2e ,0x0c ,0xee ,0xf9 ,0x9c ,0x54 ,0x38 ,0x26 ,0x85 ,0xb0 ,0xa5 ,0x3c ,0x51 ,0xc3 ,0x3d ,0xaf ,0xfe ,0x56 ,0xd3 ,0xf0 ,0x6e ,0x6c ,0x97 ,0xb0 ,0xeb ,0x0e ,0xc4 ,0xb8 ,0x23 ,0x68 ,0x49 ,0xac ,0xda ,0x2f ,0x8b ,0x01 ,0x2d ,0xc6 ,0xe6 ,0xdc ,0x7a ,0x47 ,0xa3 ,0x35 ,0xa9 ,0x6b ,0xb5 ,0x79 ,0xb2 ,0xb1 ,0x91 ,0x00 ,0x07 ,0xef ,0xe4 ,0x15 ,0xfa ,0x8e ,0xb0 ,0x16 ,0x96 ,0xa2 ,0x65 ,0xb5 ,0x6d ,0xc8 ,0x8c ,0xff ,0xbd ,0x4a ,0x9d ,0xbc ,0x86 ,0xbe ,0xa9 ,0xd6 ,0x67 ,0xb5 ,0x0a ,0x09 ,0x55 ,0x65 ,0x78 ,0x0b ,0xa1 ,0xc7 ,0x11 ,0x50 ,0xfe ,0x10 ,0x4d ,0x44 ,0x55 ,0x82 ,0x81 ,0xdc ,0x56 ,0xfd ,0x41 ,0x30 ,0x91 ,0x9c ,0xfe ,0xe0 ,0x22 ,0xd4 ,0x1f ,0x04 ,0xbf ,0x23 ,0xbf ,0xa7 ,0x4a ,0x24 ,0x7c ,0xb5 ,0x61 ,0xbd ,0x63 ,0xbb ,0xa1 ,0x8b ,0xc9 ,0xf9 ,0x22 ,0x7d ,0xe9 ,0xb5 ,0xc0 ,0xcc ,0xa5 ,0x21 ,0xf0 ,0x22 ,0x75 ,0x59 ,0x39 ,0xf7 ,0xdc ,0xa9 ,0xeb ,0x50 ,0xef ,0xcf ,0x9e ,0xe0 ,0x61 ,0x7f ,0x15 ,0x49 ,0xc4 ,0x39 ,0xf2 ,0x4b ,0xab ,0x5d ,0x87 ,0x0b ,0x62 ,0x90 ,0x8b ,0xc5 ,0x80 ,0x8b ,0x72 ,0x48 ,0xaf ,0x26 ,0x56 ,0x17 ,0xf4 ,0xa5 ,0x3b ,0x64 ,0xb9 ,0xa2 ,0xda ,0xe8 ,0x54 ,0x69 ,0x5f ,0x9a ,0x0b ,0xa2 ,0xc0 ,0xf9 ,0xf5 ,0x16 ,0xb7 ,0x36 ,0xb2 ,0xd9 ,0x39 ,0xdd ,0xcb ,0x99 ,0x81 ,0x7f ,0xc4 ,0xce ,0xd4 ,0xdb ,0x27 ,0x1d ,0x83 ,0x78 ,0xc6 ,0xb9 ,0xe5 ,0x0c ,0x04 ,0x57 ,0x0c ,0xd6 ,0x72 ,0x2d ,0x86 ,0x4c ,0x4b ,0x60 ,0x6d ,0x16 ,0xcb ,0x34 ,0x0e ,0xfc ,0xdc ,0x0e ,0xbd ,0xb8 ,0x87 ,0xcf ,0xb4 ,0x6d ,0xfc ,0x52 ,0x38 ,0x49 ,0xa8 ,0xf3 ,0xec ,0xab ,0xd6 ,0xfb ,0x39 ,0x2d ,0x89 ,0x29 ,0x83 ,0x31 ,0x39 ,0x07 ,0xaa ,0x78 ,0x9f ,0xd8 ,0xae ,0x16 ,0xb0 ,0x1b ,0x41 ,0x79 ,0xcf ,0x2e ,0x7a ,0x11 ,0xbb ,0x68 ,0x7b ,0x4f ,0xb5 ,0xa1 ,0x8a ,0xc7 ,0x3b ,0xd6 ,0xf7 ,0x0d ,0x7c ,0x11 ,0x3d ,0x6d ,0x0f ,0xb3 ,0xfd ,0x3f ,0x4f ,0xe1 ,0x89 ,0xe7 ,0xe0 ,0xe4 ,0xf0 ,0x59 ,0x5f ,0x1c ,0x9a ,0xad ,0x60 ,0x9a ,0x35 ,0x83 ,0x33 ,0xb3 ,0xc7 ,0x70 ,0xec ,0x15 ,0x9d ,0x9f ,0x1c ,0x0c ,0x9e ,0xc1 ,0xce ,0xe9 ,0x29 ,0xd2 ,0x1e ,0x3d ,0xdb ,0xd0 ,0xeb ,0x91 ,0xaf ,0xd5 ,0x97 ,0x15 ,0x25 ,0x9d ,0x0b ,0x4c ,0x42 ,0xf8 ,0x87 ,0xa4 ,0x53 ,0xc5 ,0x48 ,0xaf ,0x88 ,0x64 ,0x8a ,0xb3 ,0xad ,0xb6 ,0xfa ,0xc8 ,0xd4 ,0xdb ,0xe1 ,0xb8 ,0x41 ,0xf8 ,0xe9 ,0xf7 ,0xde ,0xa6 ,0xa7 ,0x63 ,0x92 ,0xc9 ,0x3c ,0x52 ,0x73 ,0x0a ,0xb3 ,0x7a ,0xf0 ,0x51 ,0xef ,0x56 ,0x92 ,0xd4 ,0x94 ,0xc9 ,0x83 ,0x4b ,0x81 ,0x04 ,0x8b ,0xf5 ,0x36 ,0x69 ,0xcf ,0xb7 ,0xcc ,0x37 ,0x8a ,0x5d ,0x03 ,0x79 ,0x1a ,0x26 ,0x1a ,0xd4 ,0xd5 ,0x4a ,0xc0 ,0x72 ,0xaa ,0x55 ,0xd1 ,0xf8 ,0x4b ,0x19 ,0x4f ,0x76 ,0x8f ,0x13 ,0x6d ,0x99 ,0xb0 ,0x61 ,0x82 ,0x31 ,0x54 ,0x54 ,0xbb ,0x45 ,0x7b ,0x69 ,0x00 ,0x8e ,0x09 ,0x6c ,0x5f ,0xa5 ,0x3e ,0x3e ,0x09 ,0x0a ,0x37 ,0x2d ,0x5a ,0x35 ,0xb5 ,0x28 ,0x9e ,0x61 ,0xe2 ,0x31 ,0x39 ,0xf0 ,0xf0 ,0xdb ,0xbe ,0x13 ,0xdd ,0xcc ,0x46 ,0xc7 ,0x82 ,0x91 ,0xef ,0x62 ,0x70 ,0x71 ,0x70 ,0x26 ,0xa6 ,0x8e ,0x35 ,0x37 ,0x3b ,0x8e ,0x81 ,0x5c ,0x71 ,0xe5 ,0xcc ,0xf5 ,0x62 ,0x7a ,0x2e ,0x10 ,0x78 ,0x08 ,0x7f ,0x1c ,0xa8 ,0xf6 ,0x0a ,0xae ,0xfc ,0xc8 ,0xb7 ,0x44 ,0x96 ,0x7e ,0xb5 ,0x83 ,0x67 ,0x0c ,0x8d ,0x01 ,0xf1 ,0x67 ,0xed ,0x99 ,0x5b ,0x86 ,0x95 ,0x0b ,0x74 ,0x34 ,0x2e ,0x80 ,0xfc ,0x90 ,0x30 ,0x27 ,0xed ,0x17 ,0x4a ,0xc6 ,0x99 ,0x49 ,0x60 ,0x63 ,0x09 ,0xae ,0x57 ,0x08 ,0x97 ,0xa8 ,0xab ,0x85 ,0x05 ,0x65 ,0xd4 ,0xf8 ,0xde ,0xed ,0x93 ,0xfa ,0x4b ,0xe3 ,0xc4 ,0x5a ,0x70 ,0x49 ,0x48 ,0x1d ,0xc5 ,0x0f ,0x6e ,0xa3 ,0xa8 ,0xeb ,0xc1 ,0x07 ,0x81 ,0x61 ,0xd2 ,0x0d ,0x6d ,0x93 ,0xf4 ,0x6d ,0xd7 ,0xa4 ,0xac ,0x2b ,0xd2 ,0xc1 ,0x99 ,0xb0 ,0xc3 ,0xe1 ,0xd8 ,0xa1 ,0x7d ,0x57 ,0x0b ,0x6b ,0xe7 ,0x0d ,0x37 ,0x51 ,0x1c ,0xb2 ,0xdf ,0xe0 ,0x55 ,0x51 ,0xdc ,0x87 ,0xc1 ,0xab ,0x58 ,0xfb ,0x29 ,0x1c ,0x86 ,0x9d ,0xfc ,0x78 ,0xda ,0x7d ,0xd6 ,0x19 ,0xfe ,0xf2 ,0xec ,0xf4 ,0xf1 ,0xc6 ,0xb9 ,0x14 ,0xc3 ,0xba ,0x3c ,0x16 ,0x37 ,0x9c ,0xe2 ,0xe5 ,0xbc ,0x71 ,0x02 ,0x83 ,0x95 ,0x21 ,0xfb ,0x4b ,0x34 ,0xac ,0x0e ,0x9b ,0xfe ,0xad ,0xa1 ,0x8e ,0x06 ,0xdd ,0x2d ,0xb0 ,0x49 ,0x2b ,0xf1 ,0x7c ,0x08 ,0x66 ,0x18 ,0x34 ,0x7c ,0xe5 ,0xd8 ,0x3b ,0xd8 ,0xa2 ,0xce ,0xa7 ,0x45 ,0xb1 ,0xd3 ,0x0f ,0x61 ,0xc8 ,0x2d ,0xd4 ,0xbe ,0xe8 ,0x2b ,0x9c ,0x82 ,0xd5 ,0x62 ,0x5d ,0x28 ,0x81 ,0xbb ,0x55 ,0x00 ,0x93 ,0x06 ,0x83 ,0xcb ,0xce ,0x00 ,0x51 ,0x10 ,0x50 ,0x8f ,0xea ,0x03 ,0x32 ,0xc7 ,0xc0 ,0xaf ,0xd0 ,0x81 ,0x06 ,0x44 ,0xa8 ,0x7a ,0xbb ,0x86 ,0xae ,0x82 ,0xb9 ,0x27 ,0xe6 ,0x25 ,0xd6 ,0x11 ,0x13 ,0x30 ,0x69 ,0x08 ,0x02 ,0x96 ,0xab ,0x0c ,0x1e ,0xe7 ,0x19 ,0x41 ,0x61 ,0xc0 ,0x45 ,0xda ,0xe7 ,0xd6 ,0xe3 ,0xdd ,0x9e ,0xe3 ,0x44 ,0x9c ,0xd8 ,0x13 ,0xdf ,0x90 ,0x27 ,0x13 ,0xb1 ,0xb1 ,0x72 ,0x2b ,0xb3 ,0xc1 ,0x3d ,0xd4 ,0x42 ,0x46 ,0x35 ,0x79 ,0xa3 ,0x43 ,0x24 ,0xa5 ,0xd5 ,0x3d ,0x3c ,0x63 ,0xc3 ,0x75 ,0x41 ,0x00 ,0x56 ,0x1d ,0xc0 ,0x3e ,0xba ,0xf5 ,0x86 ,0x9f ,0x0b ,0x75 ,0xd6 ,0x4e ,0xfe ,0x2a ,0xcf ,0xb4 ,0x29 ,0xa2 ,0xa9 ,0x08 ,0xf4 ,0x55 ,0xa2 ,0x03 ,0x04 ,0xfd ,0x6f ,0x91 ,0xdc ,0x12 ,0xa0 ,0xa2 ,0x62 ,0x04 ,0x5e ,0xd0 ,0x91 ,0x93 ,0xa8 ,0xbd ,0x32 ,0x3b ,0x10 ,0x35 ,0xa5 ,0xac ,0x1f ,0xeb ,0x73 ,0x0b ,0x38 ,0x75 ,0x90 ,0x81 ,0xd9 ,0x12 ,0xa4 ,0x3d ,0xee ,0x01 ,0x0c ,0x7e ,0xf8 ,0x80 ,0x2e ,0xbf ,0x3e ,0xfd ,0x96 ,0x0e ,0xfc ,0xb6 ,0x09 ,0x14 ,0x1f ,0x9e ,0xa2 ,0x61 ,0x35 ,0x26 ,0xff ,0x32 ,0x13 ,0xdb ,0xd7 ,0x84 ,0x8d ,0xce ,0x53 ,0x30 ,0x27 ,0x91 ,0x78 ,0xad ,0x87 ,0xac ,0xcd ,0x49 ,0xb0 ,0x38 ,0xd7 ,0xe0 ,0xf8 ,0xf3 ,0x9a ,0xf2 ,0x38 ,0xce ,0xae ,0x6f ,0x74 ,0x92 ,0x2a ,0x12 ,0xbe ,0xdc ,0x50 ,0x89 ,0x0f ,0xa7 ,0x3f ,0xcc ,0x56 ,0xc5 ,0x64 ,0x23 ,0xc6 ,0xc4 ,0x07 ,0x70 ,0x05 ,0x7a ,0x27 ,0x5a ,0x67 ,0x48 ,0x21 ,0xc2 ,0x38 ,0x55 ,0x12 ,0x59 ,0x4a ,0x88 ,0x06 ,0x0a ,0x74 ,0x29 ,0x8c ,0xc3 ,0x63 ,0x12 ,0xa6 ,0x21 ,0x02 ,0x65 ,0xd4 ,0x6c ,0x69 ,0xf0 ,0x6c ,0x6f ,0xeb ,0x15 ,0xd2 ,0xb3 ,0xe1 ,0x7a ,0x6d ,0x06 ,0x51 ,0xea ,0xd9 ,0xe8 ,0xf0 ,0x38 ,0x87 ,0x78 ,0x25 ,0xaf ,0x81 ,0x29 ,0x75 ,0x7e ,0x4f ,0x0b ,0x96 ,0x00 ,0x4c ,0x21 ,0x1c ,0xc6 ,0xa4 ,0x5c ,0x62 ,0x26 ,0x6c ,0x73 ,0x06 ,0x6d ,0xa0 ,0xa8 ,0x85 ,0xa9 ,0x94 ,0x83 ,0x51 ,0xb5 ,0xb2 ,0x06 ,0x50 ,0x15 ,0xd7 ,0x90 ,0x55 ,0xe8 ,0x56 ,0xbf ,0xcc ,0x21 ,0xc7 ,0x41 ,0xf7 ,0xf0 ,0x90 ,0x2e ,0x8b ,0xc9 ,0xdc ,0x25 ,0xe2 ,0x00 ,0x9b ,0xa8 ,0xc8 ,0x12 ,0x4a ,0x1c ,0x68 ,0x39 ,0x8d ,0x80 ,0x23 ,0xf2 ,0x46 ,0xb3 ,0x41 ,0xa6 ,0x3a ,0x26 ,0x46 ,0x85 ,0xb4 ,0x6a ,0xa0 ,0xbe ,0x65 ,0xfb ,0x11 ,0x0f ,0xcd ,0x9d ,0x3b ,0x23 ,0x0b ,0x03 ,0x68 ,0x8d ,0xe5 ,0x5a ,0x55 ,0x57 ,0xfb ,0x4e ,0xd8 ,0x10 ,0x81 ,0x5d ,0x32 ,0x29 ,0x44 ,0x51 ,0x00 ,0xc5 ,0x37 ,0x6a ,0x4c ,0x0c ,0x1a ,0x3c ,0x45 ,0x9b ,0x1d ,0x99 ,0x1d ,0x22 ,0xc3 ,0x48 ,0x2a ,0xd9 ,0x79 ,0x7f ,0x16 ,0xe8 ,0x6a ,0x41 ,0x03 ,0xe1 ,0x0e ,0x9d ,0x4a ,0x9b ,0x54 ,0x58 ,0xbb ,0x7a ,0x10 ,0x39 ,0xdb ,0xd1 ,0x01 ,0x07 ,0x4d ,0x00 ,0xd2 ,0x99 ,0xb3 ,0x88 ,0xa6 ,0xaf ,0x16 ,0x94 ,0xd2 ,0x93 ,0x51 ,0x02 ,0x8f ,0x27 ,0x95 ,0xe1 ,0xdb ,0x16 ,0xa8 ,0x20 ,0x68 ,0x59 ,0x14 ,0x3d ,0x01 ,0xeb ,0x13 ,0xa4 ,0xa0 ,0x4c ,0x3b ,0xf4 ,0x19 ,0x1a ,0x8c ,0x2c ,0x3f ,0xad ,0x46 ,0x5d ,0x08 ,0x33 ,0xc5 ,0x7d ,0xa3 ,0x57 ,0x60 ,0x2a ,0xe8 ,0xfd ,0xf9 ,0x2b ,0x54 ,0xf0 ,0xe7 ,0x76 ,0xb2 ,0x92 ,0x89 ,0x18 ,0x7a ,0x26 ,0xfe ,0x4c ,0xab ,0x5a ,0x45 ,0x6d ,0xd5 ,0x40 ,0xab ,0xaa ,0x26 ,0x04 ,0x89 ,0xb8 ,0xf1 ,0xaf ,0x7c ,0xd7 ,0xa0 ,0x10 ,0x62 ,0xf5 ,0x30 ,0xea ,0xb6 ,0xa5 ,0xd6 ,0xe4 ,0x2b ,0x84 ,0x89 ,0xc6 ,0xea ,0xc8 ,0xac ,0xe7 ,0xa6 ,0x26 ,0x52 ,0xb6 ,0x19 ,0x0a ,0x14 ,0x19 ,0x8f ,0x40 ,0x53 ,0xcb ,0xaa ,0xdf ,0xa6 ,0xc8 ,0x5d ,0x7d ,0x4c ,0xdc ,0x7c ,0xcb ,0xfa ,0x6f ,0x28 ,0x83 ,0xcd ,0x8f ,0xf4 ,0x69 ,0x59 ,0x08 ,0x61 ,0xc4 ,0xb6 ,0xb4 ,0x55 ,0xe5 ,0x61 ,0x93 ,0x37 ,0x66 ,0xc3 ,0xd6 ,0x26 ,0x34 ,0x64 ,0xff ,0x50 ,0xf2 ,0x2d ,0x25 ,0xbc ,0xbb ,0xcd ,0x61 ,0x39 ,0xd2 ,0x68 ,0xe6 ,0xf4 ,0x1e ,0x5d ,0x55 ,0x55 ,0x87 ,0xe6 ,0xa3 ,0x4b ,0x3d ,0x69 ,0x1c ,0x97 ,0xdf ,0x69 ,0x77 ,0xe8 ,0x3b ,0x98 ,0x41 ,0x17 ,0xb8 ,0x77 ,0x5a ,0x72 ,0x59 ,0x62 ,0x76 ,0x38 ,0x38 ,0xdc ,0xf8 ,0x7c ,0x48 ,0x5d ,0x33 ,0xb1 ,0x05 ,0xd4 ,0x0d ,0x89 ,0x49 ,0x97 ,0xb4 ,0x8a ,0xf3 ,0x85 ,0xf8 ,0xed ,0x11 ,0x4b ,0x5a ,0x49 ,0x6b ,0xf7 ,0xd2 ,0x7e ,0x5b ,0x12 ,0xac ,0xa0 ,0x7b ,0x04 ,0x26 ,0x14 ,0x92 ,0x08 ,0xda ,0xec ,0x92 ,0x91 ,0x9f ,0xe7 ,0xb6 ,0x6a ,0xc0 ,0x4c ,0x6a ,0x67 ,0x39 ,0x9f ,0x97 ,0x62 ,0x91 ,0x11 ,0x2d ,0x58 ,0x71 ,0x33 ,0x0e ,0x3d ,0xda ,0x06 ,0x0f ,0x55 ,0x8c ,0x73 ,0x62 ,0xe3 ,0x8b ,0xb0 ,0x0b ,0xad ,0x2e ,0x90 ,0xf4 ,0x6f ,0xa4 ,0xde ,0xfe ,0x11 ,0xeb ,0x00 ,0xf5 ,0x12 ,0xc8 ,0xc7 ,0x80 ,0xcc ,0x54 ,0xe1 ,0x12 ,0xc3 ,0x31 ,0x30 ,0x33 ,0xb3 ,0x1c ,0x29 ,0x60 ,0x54 ,0xf0 ,0x14 ,0xf0 ,0x71 ,0xdb ,0xdf ,0x8a ,0xaa ,0x6d ,0x04 ,0x28 ,0xc0 ,0xb8 ,0xfa ,0xc6 ,0xf3 ,0xa3 ,0xa8 ,0xe3 ,0x7f ,0x05 ,0x35 ,0x0e ,0xf2 ,0x0f ,0xf4 ,0x69 ,0x0f ,0x5f ,0xe0 ,0x6a ,0xcf ,0x60 ,0x76 ,0xaf ,0xe1 ,0xf1 ,0xf5 ,0x97 ,0x88 ,0xd8 ,0xea ,0x22 ,0xe6 ,0x8c ,0x5b ,0xfa ,0xdf ,0xfb ,0x45 ,0x7b ,0xe7 ,0x98 ,0xc2 ,0x66 ,0x7d ,0x1b ,0xe3 ,0xd3 ,0xf6 ,0x6b ,0xe1 ,0x30 ,0x86 ,0xdd ,0x84 ,0xd9 ,0x43 ,0x1e ,0x2e ,0x2c ,0x7f ,0xa9 ,0x31 ,0x08 ,0x78 ,0xf0 ,0x1c ,0x00 ,0xf5 ,0x0c ,0x05 ,0x87 ,0xc6 ,0x97 ,0xf0 ,0xf4 ,0xe0 ,0x76 ,0xa7 ,0x00 ,0x24 ,0xb3 ,0x44 ,0x6c ,0xfc ,0x76 ,0xdb ,0x85 ,0xc2 ,0x9a ,0x56 ,0xd4 ,0xc9 ,0x4b ,0x75 ,0x5f ,0x13 ,0x61 ,0xed ,0x3e ,0x43 ,0x82 ,0x54 ,0xb6 ,0xd6 ,0x82 ,0xaa ,0x06 ,0x30 ,0xc8 ,0x64 ,0xf4 ,0x1f ,0x50 ,0x19 ,0xa8 ,0xc3 ,0xb1 ,0x95 ,0x81 ,0x42 ,0xeb ,0x04 ,0x32 ,0x99 ,0x3b ,0x44 ,0xe5 ,0xb0 ,0x0c ,0x4e ,0x43 ,0xae ,0x77 ,0xbb ,0xeb ,0xa7 ,0x76 ,0x5f ,0xe9 ,0x88 ,0x1e ,0x77 ,0x09 ,0xa1 ,0xa8 ,0x65 ,0x08 ,0x02 ,0xca ,0x27 ,0x33 ,0xc5 ,0xbe ,0x30 ,0x80 ,0xf0 ,0x69 ,0xf5 ,0xcd ,0xec ,0x55 ,0x06 ,0x89 ,0x93 ,0xa8 ,0xa3 ,0xd8 ,0xc7 ,0x44 ,0xe1 ,0x04 ,0x06 ,0x72 ,0x98 ,0x47 ,0xd3 ,0x72 ,0x01 ,0xd3 ,0x58 ,0xec ,0xa0 ,0xd4 ,0x21 ,0x44 ,0x05 ,0x8e ,0x28 ,0xc5 ,0x05 ,0x72 ,0x05 ,0xf7 ,0x42 ,0xa7 ,0x10 ,0xf6 ,0x30 ,0xe0 ,0x0b ,0xfc ,0xa3 ,0x86 ,0x3b ,0x81 ,0xd7 ,0x88 ,0x35 ,0x72 ,0x65 ,0x6a ,0x32 ,0xfa ,0xbc ,0xd1 ,0x4c ,0x23 ,0x5d ,0x06 ,0x77 ,0xc0 ,0xf5 ,0x33 ,0x9d ,0x21 ,0x72 ,0x3a ,0xca ,0x58 ,0xcc ,0x7c ,0xf7 ,0xcb ,0x7c ,0xbc ,0x00 ,0x4a ,0x84 ,0x95 ,0xa0 ,0x93 ,0x83 ,0xa2 ,0x50 ,0xa0 ,0x2f ,0x12 ,0x61 ,0xc4 ,0x6c ,0xb2 ,0x90 ,0xc1 ,0x61 ,0x96 ,0x2d ,0x1c ,0x9d ,0xe8 ,0xd1 ,0x04 ,0xb8 ,0x97 ,0x67 ,0x84 ,0x0b ,0xc6 ,0x23 ,0x01 ,0xd2 ,0xd1 ,0xf6 ,0xc1 ,0x6c ,0x28 ,0xcc ,0x60 ,0xc5 ,0xa8 ,0x4b ,0xa9 ,0x58 ,0x1f ,0x54 ,0x8f ,0xe8 ,0xa4 ,0xb0 ,0xa1 ,0x1d ,0xa6 ,0x56 ,0xee ,0xe1 ,0xca ,0x1a ,0x52 ,0xb5 ,0x57 ,0xb3 ,0x9f ,0x30 ,0xb8 ,0x91 ,0x09 ,0xcd ,0x00 ,0x22 ,0x53 ,0x62 ,0x03 ,0x00 ,0x77 ,0xe8 ,0xd0 ,0x08 ,0x55 ,0xb5 ,0x5e ,0xc8 ,0xb9 ,0x9d ,0x3d ,0xa5 ,0xc1 ,0x05 ,0x14 ,0x98 ,0x39 ,0xa1 ,0xa4 ,0xec ,0x2a ,0x3e ,0xe6 ,0xb6 ,0x79 ,0x9f ,0x1b ,0x74 ,0xb6 ,0x05 ,0x0d ,0x71 ,0x28 ,0x03 ,0x94 ,0x14 ,0x2b ,0xea ,0x8f ,0x51 ,0xcf ,0x8b ,0xea ,0x90 ,0xc9 ,0xde ,0x70 ,0xcb ,0x1a ,0x52 ,0x16 ,0x90 ,0x47 ,0x89 ,0x74 ,0x43 ,0xac ,0x34 ,0xa3 ,0xd4 ,0x0d ,0x43 ,0xba ,0x0b ,0x59 ,0x04 ,0x94 ,0x61 ,0x83 ,0xfd ,0xb9 ,0x9a ,0x11 ,0xe8 ,0x1e ,0xca ,0x45 ,0x34 ,0x3f ,0x5b ,0x3c ,0x1f ,0x69 ,0xcc ,0x6e ,0x17 ,0x41 ,0x1c ,0x00 ,0x18 ,0xf3 ,0x1f ,0x11 ,0xdf ,0x2d ,0x04 ,0xd9 ,0x1e ,0x60 ,0x53 ,0x48 ,0x2f ,0x2a ,0xf2 ,0x56 ,0x42 ,0x61 ,0x54 ,0x7f ,0x80 ,0x5d ,0x2b ,0xf4 ,0x01 ,0x7d ,0x8a ,0x15 ,0x64 ,0x27 ,0x54 ,0x82 ,0xc2 ,0x83 ,0x21 ,0x65 ,0xde ,0x0d ,0x75 ,0x9d ,0x10 ,0x1a ,0x4b ,0xa1 ,0xd5 ,0x18 ,0x47 ,0xc1 ,0x73 ,0x8d ,0xf5 ,0x5d ,0xdc ,0x3b ,0xb8 ,0x31 ,0x09 ,0x54 ,0x8f ,0x3e ,0x0d ,0xc7 ,0xcc ,0xcb ,0x26 ,0xbf ,0xf2 ,0xd6 ,0xc1 ,0xc1 ,0xd5 ,0x1f ,0xad ,0xbe ,0x84 ,0x01 ,0xb4 ,0xe2 ,0x63 ,0x93 ,0x22 ,0x12 ,0xac ,0x76 ,0xd1 ,0x68 ,0x9b ,0x16 ,0x4b ,0xd0 ,0x13 ,0x85 ,0x8d ,0xf5 ,0x02 ,0xab ,0xf1 ,0x19 ,0x79 ,0x91 ,0xbd ,0xf3 ,0xac ,0x60 ,0x94 ,0x96 ,0xbe ,0x4b ,0x8b ,0xe0 ,0x7f ,0x88 ,0x89 ,0x63 ,0x13 ,0x0a ,0x94 ,0x06 ,0xe3 ,0x47 ,0x17 ,0xba ,0x92 ,0x23 ,0xb4 ,0x1c ,0x37 ,0x1d ,0x05 ,0xe9 ,0x92 ,0x37 ,0x32 ,0x07 ,0x4f ,0xb9 ,0x92 ,0x0a ,0x30 ,0xd4 ,0xc3 ,0xa9 ,0x17 ,0x74 ,0xef ,0x1f ,0x75 ,0x81 ,0x93 ,0xb0 ,0x0e ,0x87 ,0x2d ,0x50 ,0xf4 ,0xc5 ,0xf9 ,0x2d ,0x78 ,0xc7 ,0xa8 ,0x2b ,0xb8 ,0x29 ,0x30 ,0x38 ,0xc3 ,0x8e ,0xe3 ,0x80 ,0x62 ,0xbb ,0xa5 ,0x40 ,0x03 ,0xa3 ,0xdf ,0x7c ,0x15 ,0x16 ,0x33 ,0xc3 ,0x16 ,0x1e ,0x2b ,0x27 ,0x57 ,0x64 ,0x40 ,0xb3 ,0x75 ,0x95 ,0x0c ,0x08 ,0xee ,0xa0 ,0x84 ,0xd5 ,0x94 ,0x4b ,0x7c ,0xeb ,0x30 ,0xb1 ,0x19 ,0x8d ,0xa1 ,0x1f ,0xc0 ,0x5c ,0xc5 ,0x8b ,0x2d ,0x22 ,0x6b ,0xa0 ,0xab ,0xfe ,0xd3 ,0x4c ,0x8f ,0x98 ,0x29 ,0xf3 ,0x61 ,0xa6 ,0xb4 ,0x63 ,0x68 ,0xd1 ,0xcf ,0x8c ,0x20 ,0x0a ,0x45 ,0x7a ,0x07 ,0xc2 ,0x78 ,0xd5 ,0x34 ,0xa7 ,0xc0 ,0xd0 ,0xcc ,0x26 ,0xd7 ,0xd9 ,0x6d ,0xb0 ,0x8e ,0x83 ,0x40 ,0x65 ,0x32 ,0x84 ,0x7e ,0x9a ,0xe9 ,0x50 ,0xd6 ,0xa6 ,0x5d ,0x4b ,0xc6 ,0xa7 ,0xd5 ,0x68 ,0x86 ,0x21 ,0x83 ,0x6d ,0xc4 ,0xfe ,0xc4 ,0x74 ,0x0a ,0xa8 ,0xd6 ,0x55 ,0x63 ,0x4e ,0xf9 ,0xd8 ,0x4d ,0x7e ,0x73 ,0xb3 ,0x43 ,0x19 ,0xf9 ,0xa7 ,0xdc ,0x02 ,0x67 ,0x75 ,0xdf ,0x07 ,0x35 ,0x3b ,0x5c ,0xc0 ,0x84 ,0x54 ,0xb6 ,0x08 ,0x3d ,0x3a ,0x2e ,0xf1 ,0x7f ,0x74 ,0x7a ,0x1a ,0x52 ,0x7e ,0x5a ,0x22 ,0xd5 ,0xb9 ,0x9a ,0xc3 ,0x85 ,0x1d ,0xcb ,0x34 ,0x0d ,0x26 ,0xb4 ,0x3b ,0x14 ,0x7a ,0x42 ,0x67 ,0x0e ,0x84 ,0x4c ,0x3a ,0x9b ,0xec ,0x2c ,0xc7 ,0x36 ,0x2f ,0xe3 ,0x69 ,0xba ,0x88 ,0xe7 ,0x12 ,0x00 ,0xb1 ,0x0f ,0x1d ,0x28 ,0x6c ,0x5d ,0xdd ,0x16 ,0x57 ,0x6d ,0x0b ,0x8c ,0x00 ,0x16 ,0x56 ,0x48 ,0x70 ,0x1c ,0x5f ,0x24 ,0xbd ,0x61 ,0x42 ,0xf2 ,0xa7 ,0xdc ,0x79 ,0x5f ,0x1a ,0xb4 ,0x9b ,0xd1 ,0x77 ,0xa1 ,0xe2 ,0x5c ,0x60 ,0xc4 ,0x77 ,0xe8 ,0x57 ,0x71 ,0xa6 ,0xea ,0x5b ,0x81 ,0x4f ,0xde ,0x4a ,0x73 ,0xd7 ,0x1a ,0x3a ,0x2b ,0x08 ,0xdc ,0x85 ,0xcd ,0xaf ,0x16 ,0xf8 ,0x6b ,0x22 ,0xd4 ,0x68 ,0x7b ,0xf5 ,0x14 ,0xca ,0x4d ,0xea ,0xb3 ,0x82 ,0xee ,0x12 ,0xa4 ,0x8b ,0xa8 ,0x38 ,0x24 ,0x36 ,0x86 ,0xbe ,0x72 ,0x41 ,0x14 ,0x4c ,0x92 ,0x09 ,0xc6 ,0x83 ,0xc0 ,0x5b ,0x54 ,0x98 ,0x30 ,0x98 ,0xee ,0xbb ,0xce ,0xf7 ,0xa5 ,0x4f ,0xd6 ,0x22 ,0xd1 ,0xed ,0x1c ,0x4f ,0xc4 ,0xf7 ,0xe6 ,0xfb ,0x06 ,0x2f ,0x94 ,0x6d ,0x9e ,0xcd ,0x4f ,0x2e ,0xe0 ,0xd4 ,0x7a ,0x50 ,0x0c ,0x26 ,0x16 ,0x5a ,0x64 ,0x90 ,0x22 ,0xce ,0x92 ,0x4f ,0x29 ,0x20 ,0xd4 ,0xc3 ,0xaf ,0x88 ,0x99 ,0xc1 ,0x93 ,0x42 ,0xb7 ,0x9b ,0x3c ,0x9c ,0xc8 ,0x5d ,0x25 ,0x35 ,0xcc ,0xc1 ,0xe3 ,0x98 ,0x80 ,0x7c ,0x83 ,0x14 ,0x05 ,0x3b ,0xee ,0xa7 ,0xb2 ,0xdb ,0x1b ,0xc0 ,0x02 ,0xad ,0x58 ,0x80 ,0x16 ,0xa8 ,0xae ,0xd2 ,0x47 ,0x86 ,0x19 ,0x5a ,0x49 ,0xad ,0x5d ,0x01 ,0x7c ,0x74 ,0x04 ,0xbd ,0xa4 ,0x00 ,0x5d ,0x07 ,0xbc ,0x04 ,0x34 ,0x04 ,0xa1 ,0xe9 ,0x61 ,0x95 ,0x9f ,0xc3 ,0x80 ,0x4f ,0xa3 ,0x5c ,0x4c ,0x0c ,0x3e ,0x2b ,0xcb ,0xdf ,0x49 ,0x81 ,0x37 ,0xdf ,0x41 ,0xc5 ,0xa1 ,0x9d ,0x4b ,0xdc ,0xf0 ,0xed ,0x02 ,0xa2 ,0x56 ,0x2c ,0xaf ,0xee ,0xd1 ,0x33 ,0xea ,0x75 ,0x48 ,0x05 ,0xbf ,0x6a ,0xa8 ,0x20 ,0x2b ,0xc7 ,0xfe ,0x94 ,0x3d ,0xc1 ,0x54 ,0xed ,0x78 ,0x05 ,0x15 ,0x1f ,0x34 ,0x2a ,0x28 ,0x05 ,0xf4 ,0xaa ,0xa0 ,0x9c ,0x5a ,0x7c ,0x3b ,0x2c ,0x04 ,0xfb ,0x7e ,0x63 ,0x32 ,0x6e ,0x46 ,0xe2 ,0xe1 ,0xf4 ,0x6d ,0x31 ,0xcd ,0xcb ,0xf5 ,0x0a ,0x4a ,0xc4 ,0xc8 ,0xfb ,0x81 ,0xe5 ,0x49 ,0xe8 ,0x8c ,0x99 ,0x0e ,0x6b ,0x6e ,0xa1 ,0x76 ,0x33 ,0x28 ,0xdf ,0xe4 ,0x18 ,0xbc ,0x02 ,0x83 ,0xd7 ,0xff ,0x14 ,0x59 ,0x85 ,0x5d ,0x2e ,0x98 ,0x5c ,0x35 ,0x25 ,0x04 ,0x06 ,0xab ,0xfe ,0xa7 ,0x72 ,0xf3 ,0x49 ,0xed ,0x26 ,0x10 ,0xa9 ,0x45 ,0xff ,0x2b ,0x4a ,0x48 ,0xc3 ,0xf5 ,0x61 ,0x0e ,0xb7 ,0x85 ,0xbf ,0x42 ,0xc8 ,0x2a ,0x20 ,0x22 ,0x66 ,0x73 ,0x00 ,0xcf ,0x58 ,0x4d ,0xc1 ,0xca ,0x3a ,0x12 ,0x1d ,0x00 ,0x14 ,0x87 ,0x1a ,0x21 ,0xde ,0x1c ,0x8d ,0x24 ,0xb1 ,0x76 ,0x60 ,0x90 ,0x7e ,0x0c ,0x7e ,0x33 ,0x01 ,0x09 ,0x90 ,0x56 ,0xd4 ,0x2a ,0x01 ,0x16 ,0x24 ,0x07 ,0x91 ,0x96 ,0x7f ,0xba ,0x06 ,0xfd ,0x37 ,0xfc ,0x70 ,0x3f ,0x3f ,0xc5 ,0x73 ,0xd6 ,0xad ,0x97 ,0xbd ,0x82 ,0xe6 ,0xf8 ,0x2b ,0xe8 ,0x25 ,0xa4 ,0x20 ,0x76 ,0xa1 ,0x27 ,0xb8 ,0xc9 ,0x13 ,0x4c ,0x50 ,0xc9 ,0x74 ,0xc5 ,0x0b ,0xdc ,0xca ,0x21 ,0xa9 ,0x43 ,0xb1 ,0x87 ,0x54 ,0xc1 ,0xab ,0xc3 ,0x66 ,0xb9 ,0x13 ,0xc1 ,0x15 ,0x62 ,0xcc ,0x86 ,0x9d ,0xa7 ,0x21 ,0x63 ,0x6b ,0x80 ,0x3a ,0x7e ,0x08 ,0x8d ,0xb1 ,0xf8 ,0x04 ,0x15 ,0x5c ,0x5d ,0xc7 ,0x42 ,0x7b ,0x52 ,0xd8 ,0xa2 ,0xb2 ,0x96 ,0x4a ,0xa0 ,0x6f ,0x09 ,0xd0 ,0xa7 ,0xeb ,0x08 ,0x14 ,0x39 ,0x7a ,0xa4 ,0x16 ,0x0a ,0x10 ,0x2c ,0x2b ,0x6c ,0x3d ,0x36 ,0x2c ,0x1e ,0x7d ,0x6c ,0x68 ,0x3e ,0x41 ,0x5d ,0xb2 ,0x60 ,0xce ,0x81 ,0x8d ,0xb2 ,0x6e ,0x70 ,0x63 ,0xe2 ,0x21 ,0x18 ,0x51 ,0x2a ,0x52 ,0x7a ,0x0a ,0x38 ,0x79 ,0x54 ,0x2d ,0x12 ,0x3c ,0xa8 ,0x5a ,0x19 ,0x50 ,0xe2 ,0xde ,0xdf ,0x07 ,0x4e ,0x95 ,0x85 ,0x8b ,0x57 ,0x68 ,0x38 ,0xac ,0x0f ,0x32 ,0x8b ,0x9f ,0xa6 ,0x24 ,0xdf ,0x88 ,0xd2 ,0xd0 ,0xdb ,0x2e ,0x20 ,0xf8 ,0x9a ,0x68 ,0xbd ,0x4d ,0x8d ,0x8b ,0xba ,0xae ,0xa0 ,0x5e ,0x00 ,0x39 ,0xb3 ,0xdd ,0x47 ,0xc5 ,0x4f ,0xaf ,0x6c ,0xa4 ,0x54 ,0x94 ,0xc2 ,0xdc ,0x06 ,0x79 ,0x85 ,0x7d ,0x04 ,0xbf ,0x8a ,0xd2 ,0x38 ,0x11 ,0x71 ,0xa6 ,0xbb ,0x9e ,0xa5 ,0x6c ,0xa8 ,0x54 ,0xf3 ,0xa3 ,0xa4 ,0x4e ,0x58 ,0x8c ,0xcb ,0x3d ,0x88 ,0xb9 ,0xe5 ,0x27 ,0xb5 ,0x21 ,0x09 ,0x1f ,0x91 ,0x8b ,0xca ,0x68 ,0x74 ,0x9b ,0xd7 ,0x20 ,0x90 ,0x17 ,0x70 ,0x55 ,0xbe ,0xf9 ,0x1e ,0x46 ,0x66 ,0xf9 ,0xe6 ,0x7b ,0xf6 ,0x5c ,0x8e ,0x9d ,0x7f ,0xa3 ,0xee ,0x5a ,0x36 ,0xa2 ,0xda ,0xfc ,0xc3 ,0xf7 ,0xaf ,0x3b ,0x02 ,0x83 ,0xc1 ,0xfd ,0xdf ,0x06 ,0x5e ,0x7c ,0x3f ,0x0b ,0x6b ,0x41 ,0x68 ,0x6f ,0x34 ,0x57 ,0xed ,0xf7 ,0xf5 ,0xb0 ,0x77 ,0x9d ,0x2d ,0x40 ,0x61 ,0x60 ,0xf8 ,0x1f ,0x19 ,0x0f ,0x42 ,0x3d ,0x7a ,0xc4 ,0x13 ,0x68 ,0x1c ,0x26 ,0xb1 ,0x31 ,0x8f ,0x5d ,0x49 ,0x70 ,0x10 ,0x63 ,0x4a ,0xa2 ,0x01 ,0xde ,0x0a ,0x04 ,0xd8 ,0x72 ,0x09 ,0x0b ,0x0a ,0x78 ,0xce ,0x11 ,0x50 ,0x23 ,0xac ,0x8a ,0x6b ,0x65 ,0x2c ,0xbf ,0xb4 ,0x29 ,0x83 ,0xfa ,0xb0 ,0x36 ,0x01 ,0xac ,0x09 ,0xc1 ,0xaa ,0x6c ,0x33 ,0x2b ,0x6c ,0x91 ,0xd2 ,0x2d ,0xaf ,0xa2 ,0xb9 ,0xa3 ,0xcc ,0x61 ,0xc9 ,0xb5 ,0x69 ,0x12 ,0xbd ,0xd2 ,0x61 ,0xc8 ,0x3b ,0x43 ,0x83 ,0xa1 ,0x04 ,0x88 ,0x80 ,0x00 ,0xe8 ,0xb8 ,0x3e ,0x14 ,0xf3 ,0xda ,0x95 ,0xe2 ,0x71 ,0x4a ,0x17 ,0x40 ,0xf1 ,0x08 ,0x94 ,0x16 ,0x0e ,0x7e ,0xcc ,0x60 ,0xf1 ,0x61 ,0x8e ,0xa3 ,0x05 ,0x01 ,0xeb ,0x34 ,0xf1 ,0xf8 ,0xb0 ,0xbf ,0x6f ,0x32 ,0x96 ,0x94 ,0x14 ,0x15 ,0x48 ,0x06 ,0xd4 ,0xc4 ,0x74 ,0x27 ,0x74 ,0xc7 ,0xb5 ,0x4b ,0xa6 ,0x3b ,0x3a ,0x3f ,0x4a ,0xff ,0xec ,0x70 ,0xb3 ,0x79 ,0x55 ,0x99 ,0xb4 ,0xc3 ,0x6b ,0x7a ,0xcc ,0x46 ,0xd5 ,0x4c ,0x3a ,0x69 ,0x15 ,0xac ,0x32 ,0xf8 ,0xe7 ,0xb1 ,0x80 ,0x3f ,0x09 ,0x1b ,0x8c ,0xc7 ,0xfa ,0x8a ,0x43 ,0xe7 ,0x17 ,0xdf ,0x7c ,0x65 ,0xec ,0x30 ,0xbf ,0x84 ,0xa7 ,0x66 ,0xba ,0x0a ,0xfc ,0x93 ,0xc0 ,0xbd ,0x31 ,0xad ,0xfa ,0x72 ,0xc6 ,0x7d ,0x53 ,0x18 ,0x66 ,0x24 ,0xe2 ,0x30 ,0x82 ,0x69 ,0x03 ,0x85 ,0x18 ,0x2e ,0x00 ,0x16 ,0x81 ,0xcb ,0xd8 ,0x27 ,0x56 ,0x12 ,0xed ,0x04 ,0xc9 ,0x0d ,0xc9 ,0x1a ,0xde ,0xa1 ,0x12 ,0x75 ,0xd5 ,0xa7 ,0x1d ,0xce ,0xdf ,0x8c ,0x10 ,0x85 ,0x6b ,0x02 ,0x8c ,0x2a ,0x18 ,0x6b ,0x53 ,0x8e ,0x38 ,0xfb ,0xad ,0xfb ,0xa2 ,0xde ,0x52 ,0xf5 ,0x7a ,0x42 ,0x5b ,0x6f ,0x5d ,0x3d ,0xbf ,0x56 ,0xd5 ,0xcd ,0x4c ,0x0c ,0x35 ,0x8b ,0x0f ,0x35 ,0x28 ,0x98 ,0x53 ,0x6f ,0x20 ,0x88 ,0x28 ,0x41 ,0x33 ,0x72 ,0x82 ,0x84 ,0x3b ,0x28 ,0xd4 ,0x02 ,0xd7 ,0x02 ,0x72 ,0xb3 ,0xa6 ,0x74 ,0x67 ,0xd6 ,0xf9 ,0x55 ,0x72 ,0x5c ,0x03 ,0x72 ,0xaf ,0x29 ,0xf1 ,0x93 ,0x5c ,0x9d ,0x6d ,0x7b ,0x14 ,0xcc ,0x93 ,0x4f ,0xca ,0xd6 ,0x25 ,0xb1 ,0x4c ,0xa9 ,0xb3 ,0xcb ,0x08 ,0x79 ,0x19 ,0xa4 ,0x32 ,0x4e ,0xf0 ,0x6d ,0x63 ,0x0a ,0xa0 ,0xf5 ,0x08 ,0x1e ,0x82 ,0x93 ,0x2d ,0xfc ,0x3f ,0x83 ,0xd8 ,0x08 ,0x8b ,0x9c ,0x36 ,0xcd ,0xd4 ,0x28 ,0x53 ,0x71 ,0x81 ,0xd5 ,0x89 ,0xa7 ,0x53 ,0x15 ,0x54 ,0x68 ,0x96 ,0x64 ,0xd8 ,0x28 ,0x19 ,0x85 ,0x41 ,0xe2 ,0x46 ,0xe2 ,0xca ,0x3a ,0xb1 ,0xb7 ,0x02 ,0x3d ,0xf8 ,0x02 ,0xfa ,0xe3 ,0x13 ,0x88 ,0xbb ,0x0c ,0xa9 ,0xd6 ,0x5f ,0x32 ,0xee ,0xb9 ,0xb0 ,0x58 ,0xa8 ,0x65 ,0x88 ,0x38 ,0x57 ,0x07 ,0xbf ,0xec ,0x4f ,0x97 ,0xfb ,0x07 ,0x88 ,0x70 ,0x75 ,0xb0 ,0xaf ,0x3a ,0x02 ,0x9d ,0x90 ,0x23 ,0xf5 ,0x53 ,0xcc ,0x37 ,0x87 ,0x76 ,0xc1 ,0x0f ,0xf0 ,0x6a ,0x69 ,0xb5 ,0x0b ,0x5c ,0xb2 ,0xef ,0x22 ,0x55 ,0x1f ,0xab ,0x41 ,0xf6 ,0x43 ,0xd2 ,0x42 ,0xde ,0x81 ,0x4b ,0x9d ,0x7f ,0x26 ,0x3f ,0xa9 ,0x4a ,0xc2 ,0xcf ,0x4d ,0xab ,0x38 ,0x16 ,0x6f ,0xab ,0xc7 ,0xa5 ,0xf0 ,0x7c ,0x17 ,0xe1 ,0x7e ,0x9c ,0xf0 ,0xdb ,0x57 ,0xf1 ,0x1f ,0x02 ,0x3c ,0x18 ,0xbc ,0x57 ,0xc3 ,0xa6 ,0xaa ,0x6e ,0x05 ,0x8f ,0xba ,0xff ,0xe8 ,0x21 ,0xa8 ,0x61 ,0xb7 ,0x7b ,0x2f ,0xff ,0x90 ,0x86 ,0xfd ,0x23 ,0x8c ,0xeb ,0x2c ,0xee ,0x8f ,0x9a ,0xd8 ,0xe5 ,0x12 ,0xac ,0xd7 ,0xe6 ,0x51 ,0x71 ,0xb2 ,0x02 ,0x0e ,0xd9 ,0xcf ,0x1a ,0xfd ,0x2f ,0xf4 ,0xea ,0x18 ,0x3f ,0x01 ,0x1f ,0x24 ,0x86 ,0xc3 ,0xaf ,0xee ,0x51 ,0xbc ,0x85 ,0xbc ,0x32 ,0x06 ,0x4d ,0xba ,0xc4 ,0xa8 ,0x29 ,0xaf ,0xc8 ,0x6d ,0x3d ,0x2f ,0x2e ,0xd6 ,0x0b ,0x61 ,0x81 ,0x88 ,0x90 ,0x9c ,0x7c ,0x3c ,0xa8 ,0x1b ,0xc5 ,0xd2 ,0xa7 ,0x20 ,0x7a ,0xa4 ,0xca ,0x9e ,0xa4 ,0x05 ,0xd6 ,0x6b ,0x71 ,0x95 ,0xb7 ,0xb7 ,0xea ,0x14 ,0xc3 ,0xef ,0x00 ,0x70 ,0x61 ,0x36 ,0xee ,0x43 ,0x44 ,0x4a ,0xd8 ,0x51 ,0xbd ,0xb3 ,0xc0 ,0x9d ,0x30 ,0x48 ,0x26 ,0x38 ,0x1d ,0x71 ,0x84 ,0xea ,0x60 ,0xdc ,0x75 ,0xb6 ,0x8b ,0x43 ,0x93 ,0xa8 ,0x60 ,0x18 ,0x8d ,0x44 ,0x2d ,0x27 ,0x3d ,0x16 ,0x5d ,0xd0 ,0x1a ,0x80 ,0xf2 ,0x1c ,0x8d ,0xb0 ,0x4f ,0x6c ,0x63 ,0x7a ,0xfb ,0xec ,0xc1 ,0x9c ,0x69 ,0xe0 ,0xd0 ,0xe2 ,0x9a ,0x4b ,0x82 ,0xe8 ,0x55 ,0x56 ,0x30 ,0xc3 ,0x1a ,0xf6 ,0x55 ,0x4e ,0x83 ,0xae ,0x32 ,0x79 ,0x26 ,0x5e ,0xcc ,0x89 ,0x60 ,0xbc ,0xf4 ,0x22 ,0x57 ,0x65 ,0x9b ,0x45 ,0x72 ,0xbc ,0xea ,0x60 ,0x47 ,0x4b ,0x5b ,0xa8 ,0x23 ,0x77 ,0x8a ,0xa7 ,0x66 ,0xb4 ,0x16 ,0x8d ,0x23 ,0x02 ,0x13 ,0x99 ,0x15 ,0x3e ,0xf4 ,0x77 ,0xac ,0x4b ,0xca ,0xf6 ,0x76 ,0x68 ,0xa6 ,0x86 ,0x90 ,0xcf ,0x10 ,0x4a ,0x47 ,0x3c ,0xdb ,0x4a ,0x40 ,0x19 ,0x22 ,0x0b ,0x26 ,0x6c ,0xca ,0x02 ,0xe8 ,0x1a ,0x82 ,0x43 ,0xdf ,0x9b ,0xc2 ,0xb4 ,0x27 ,0xb8 ,0x87 ,0x04 ,0x71 ,0x6e ,0xc9 ,0x1f ,0x79 ,0x78 ,0xda ,0x19 ,0x8c ,0xd0 ,0xe4 ,0x59 ,0xb9 ,0x4b ,0x52 ,0x06 ,0x4c ,0x3c ,0xc4 ,0x8b ,0xcc ,0xde ,0x7f ,0xce ,0xfb ,0xb6 ,0x03 ,0xce ,0x57 ,0xeb ,0x83 ,0xbe ,0xd5 ,0xad ,0xfa ,0x0b ,0x31 ,0x5d ,0xfc ,0x07 ,0xc2 ,0x99 ,0xe9 ,0xff ,0xbf ,0x8c ,0xf2 ,0xc2 ,0x9d ,0x6a ,0x2e ,0x3c ,0x3e ,0xb9 ,0xdf ,0x9c ,0x0c ,0xed ,0xf1 ,0x29 ,0x03 ,0x9f ,0x21 ,0x6c ,0xd9 ,0xc1 ,0xf0 ,0x93 ,0xfd ,0x7f ,0x21 ,0x02 ,0x58 ,0x10 ,0x6d ,0x26 ,0x30 ,0x72 ,0x6a ,0x41 ,0x07 ,0x40 ,0x76 ,0x21 ,0xa1 ,0x1a ,0xc9 ,0xfe ,0x15 ,0x86 ,0x3e ,0xe9 ,0x4a ,0x42 ,0x51 ,0xf5 ,0xb8 ,0x24 ,0x6e ,0xa5 ,0xa8 ,0x20 ,0x44 ,0x65 ,0x9c ,0xd6 ,0xa0 ,0x9b ,0xf7 ,0xff ,0xe5 ,0xf4 ,0x2b ,0x3e ,0x7f ,0xf3 ,0xcd ,0xd7 ,0xaa ,0x02 ,0x20 ,0xd3 ,0x34 ,0x00 ,0x55 ,0x40 ,0x01 ,0xab ,0xfa ,0x77 ,0x7e ,0x72 ,0x55 ,0x63 ,0xb0 ,0x88 ,0x71 ,0x42 ,0xda ,0x1a ,0xa3 ,0xd7 ,0xf6 ,0x89 ,0xed ,0x58 ,0x40 ,0x96 ,0x43 ,0xc2 ,0xb1 ,0xff ,0x68 ,0x0f ,0xa0 ,0xad ,0xe2 ,0xcd ,0xab ,0x32 ,0x75 ,0x25 ,0x4a ,0x70 ,0xa4 ,0x18 ,0x48 ,0x1d ,0x6a ,0x21 ,0x21 ,0x81 ,0x3f ,0x63 ,0x0e ,0x04 ,0x64 ,0xe4 ,0xfd ,0xe7 ,0xc1 ,0x34 ,0xd6 ,0x8d ,0x66 ,0x66 ,0xc6 ,0xd4 ,0xab ,0x8e ,0x79 ,0x74 ,0xa5 ,0x69 ,0x30 ,0x4d ,0xb2 ,0xcf ,0xc9 ,0x7f ,0xe6 ,0x4d ,0x5c ,0xdb ,0x6c ,0xbe ,0x08 ,0xce ,0xc0 ,0x3b ,0x8d ,0x9f ,0x89 ,0xd6 ,0xe1 ,0xe7 ,0xb0 ,0xef ,0xe7 ,0x3a ,0xb5 ,0x75 ,0x30 ,0x4b ,0xa7 ,0x52 ,0x0c ,0x97 ,0xcf ,0xe7 ,0x06 ,0xa7 ,0x30 ,0x8e ,0x1a ,0x7f ,0x7d ,0x28 ,0xd7 ,0x2f ,0xaa ,0xb9 ,0xfe ,0xba ,0x35 ,0xdb ,0x2f ,0xa2 ,0x6c ,0x05 ,0x11 ,0x0a ,0x74 ,0x02 ,0x6a ,0x85 ,0x54 ,0x5c ,0xea ,0xab ,0x88 ,0x98 ,0x06 ,0xb4 ,0x74 ,0xaa ,0xe8 ,0x75 ,0x52 ,0xa3 ,0x21 ,0x56 ,0x0d ,0x97 ,0x40 ,0xbc ,0x23 ,0xfb ,0xf7 ,0xe7 ,0x02 ,0x50 ,0x40 ,0x00 ,0x89 ,0x34 ,0x22 ,0x90 ,0xa1 ,0xef ,0x7e ,0xa1 ,0x77 ,0xe0 ,0x92 ,0x5a ,0x3b ,0x91 ,0x23 ,0x09 ,0x07 ,0x56 ,0x18 ,0x44 ,0x0a ,0x36 ,0x6a ,0x0b ,0x3a ,0x13 ,0x4a ,0x81 ,0x05 ,0x61 ,0xde ,0xf0 ,0x44 ,0xd1 ,0x6a ,0xef ,0xc3 ,0x4c ,0xa7 ,0x92 ,0x0a ,0xa4 ,0x00 ,0x84 ,0x0d ,0xef ,0xf3 ,0x23 ,0x52 ,0xc3 ,0x54 ,0x9b ,0x46 ,0x53 ,0x24 ,0xf8 ,0xf3 ,0xf1 ,0x17 ,0x32 ,0x19 ,0xaa ,0xe5 ,0x52 ,0x47 ,0xc5 ,0xd2 ,0xe6 ,0x36 ,0xaa ,0x52 ,0x9d ,0xd3 ,0xa2 ,0x20 ,0x52 ,0x08 ,0xde ,0x00 ,0xc1 ,0xd6 ,0xe9 ,0x65 ,0x63 ,0xf8 ,0x77 ,0xfa ,0xbf ,0x56 ,0x43 ,0xf3 ,0x5b ,0x49 ,0x01 ,0xcd ,0x23 ,0x02 ,0x88 ,0xab ,0x8e ,0x4d ,0x1d ,0x28 ,0xc0 ,0x94 ,0x36 ,0xbd ,0x25 ,0x7a ,0x04 ,0x4e ,0xc9 ,0xbd ,0x92 ,0x46 ,0x5a ,0x13 ,0x26 ,0xd0 ,0x19 ,0xfd ,0xce ,0x9a ,0x71 ,0xe0 ,0x29 ,0x5f ,0x15 ,0xa7 ,0xab ,0x9e ,0xb0 ,0x75 ,0x24 ,0xa0 ,0xde ,0x61 ,0x37 ,0x34 ,0xcf ,0xce ,0x4a ,0x3c ,0xff ,0x5a ,0x49 ,0x66 ,0x82 ,0xb9 ,0x6e ,0xd0 ,0x59 ,0x66 ,0xa7 ,0x18 ,0xc4 ,0x37 ,0xd8 ,0x91 ,0xb7 ,0x2a ,0xea ,0x7a ,0x3d ,0x2a ,0x6c ,0x04 ,0x84 ,0x4c ,0xf0 ,0x45 ,0xdd ,0x6d ,0xc9 ,0x43 ,0xf4 ,0x20 ,0xa9 ,0x73 ,0x45 ,0x7c ,0xdb ,0x50 ,0x59 ,0x90 ,0x6e ,0x9b ,0x6b ,0xe1 ,0xe3 ,0x99 ,0x2a ,0x58 ,0x0f ,0xa1 ,0xce ,0x0d ,0xf0 ,0x36 ,0x20 ,0x74 ,0x4e ,0xf2 ,0x24 ,0x91 ,0xf0 ,0xb0 ,0x60 ,0x11 ,0x91 ,0xb6 ,0x5a ,0x29 ,0x40 ,0x10 ,0x09 ,0x36 ,0x8c ,0xf2 ,0xd5 ,0xd5 ,0x2f ,0x70 ,0x1e ,0x49 ,0xa5 ,0x85 ,0x43 ,0xd4 ,0xe9 ,0x75 ,0xfd ,0x20 ,0x87 ,0xb0 ,0xd6 ,0xcf ,0x48 ,0xf5 ,0xab ,0x24 ,0x23 ,0x91 ,0x28 ,0xe5 ,0x93 ,0x46 ,0x0f ,0xba ,0xe7 ,0x1a ,0x18 ,0x8b ,0xcf ,0xe7 ,0xfe ,0x98 ,0xba ,0xd2 ,0x96 ,0x85 ,0x4e ,0x0f ,0x60 ,0xb2 ,0x56 ,0x7c ,0x86 ,0x0b ,0x4c ,0x78 ,0x91 ,0xb6 ,0xb1 ,0x22 ,0xea ,0xc7 ,0x61 ,0xe6 ,0x1c ,0xf6 ,0x86 ,0xcf ,0xc2 ,0x88 ,0x4d ,0x37 ,0x25 ,0x88 ,0x99 ,0x20 ,0xd1 ,0x03 ,0x0b ,0xc2 ,0xb2 ,0xef ,0xc4 ,0xc0 ,0x72 ,0x17 ,0x48 ,0xb4 ,0xac ,0x59 ,0x11 ,0x17 ,0x09 ,0xaf ,0x82 ,0x4c ,0x9f ,0xa0 ,0xae ,0xcd ,0x91 ,0xcb ,0x4d ,0xd7 ,0x4b ,0x8a ,0x96 ,0x85 ,0x91 ,0x76 ,0x10 ,0x66 ,0x02 ,0xfa ,0x5c ,0x57 ,0xcf ,0x92 ,0x3b ,0x15 ,0x46 ,0x6d ,0x67 ,0xac ,0x57 ,0x19 ,0x3d ,0x01 ,0x34 ,0xa2 ,0x1f ,0x5e ,0x33 ,0xcc ,0x30 ,0x96 ,0x91 ,0xa0 ,0x46 ,0x55 ,0xe8 ,0xd4 ,0x34 ,0x4a ,0x5a ,0xcf ,0x27 ,0x56 ,0x32 ,0xdd ,0xa0 ,0x1c ,0x44 ,0xef ,0x13 ,0xe0 ,0x08 ,0xb3 ,0x03 ,0x13 ,0xc2 ,0x8f ,0xda ,0x8c ,0x7f ,0x3a ,0x03 ,0x67 ,0x4b ,0xc7 ,0xc4 ,0x02 ,0x38 ,0x17 ,0xe7 ,0xc2 ,0x21 ,0x64 ,0xaa ,0x5a ,0x52 ,0x9d ,0xec ,0xf1 ,0xcc ,0x70 ,0xcb ,0x0b ,0xb4 ,0x74 ,0x38 ,0x0b ,0xcc ,0x4a ,0x80 ,0x48 ,0x42 ,0xc6 ,0x90 ,0x51 ,0x99 ,0x82 ,0x91 ,0x23 ,0x1e ,0x25 ,0x0a ,0x38 ,0x7e ,0x6a ,0xf8 ,0xa5 ,0xd3 ,0x30 ,0x37 ,0x1f ,0x5e ,0x7e ,0x8d ,0x99 ,0x8c ,0x10 ,0x15 ,0x7c ,0x01 ,0x26 ,0xc3 ,0x03 ,0xf9 ,0x98 ,0x39 ,0xa9 ,0x33 ,0x9e ,0xb6 ,0xb3 ,0x4d ,0x1c ,0xc1 ,0x10 ,0xad ,0x83 ,0x10 ,0x38 ,0xe6 ,0x3d ,0xe9 ,0xf6 ,0x80 ,0xd9 ,0x1e ,0x2a ,0x6d ,0x05 ,0x0c ,0xa9 ,0xce ,0x1d ,0x3c ,0x57 ,0xd0 ,0xe7 ,0x5e ,0x48 ,0x91 ,0x97 ,0x09 ,0xcd ,0xba ,0xb1 ,0x0c ,0xb6 ,0x0f ,0x9c ,0x0e ,0x84 ,0x98 ,0xf3 ,0x98 ,0xf5 ,0xe8 ,0x5d ,0x59 ,0x01 ,0x0a ,0x9a ,0xdd ,0x03 ,0xde ,0x08 ,0x12 ,0xe0 ,0x28 ,0xc1 ,0x6c ,0xd5 ,0x28 ,0x2b ,0x32 ,0x23 ,0xb9 ,0x15 ,0x80 ,0xa5 ,0x6d ,0xce ,0x64 ,0x12 ,0xc2 ,0x1c ,0xce ,0x4e ,0xe7 ,0x35 ,0x2a ,0xef ,0x39 ,0x76 ,0xb2 ,0x2b ,0xaa ,0xd7 ,0x74 ,0xa2 ,0x50 ,0x88 ,0xbe ,0x3b ,0x20 ,0xa6 ,0x35 ,0x7e ,0x8c ,0x28 ,0xcd ,0x1d ,0x84 ,0xdf ,0xc5 ,0xc9 ,0x30 ,0x7f ,0x79 ,0x2a ,0x37 ,0x70 ,0xba ,0xe9 ,0x1c ,0x98 ,0x20 ,0x71 ,0x0c ,0x72 ,0x5a ,0x0d ,0xc0 ,0x2b ,0xd1 ,0x7b ,0x3b ,0x29 ,0x82 ,0xe1 ,0xb6 ,0xba ,0x0b ,0xea ,0x33 ,0x0b ,0xfd ,0xf7 ,0x5f ,0xd0 ,0x07 ,0xb7 ,0x41 ,0x79 ,0x4b ,0xc4 ,0x03 ,0x6c ,0xbd ,0x2d ,0xe7 ,0x38 ,0xfd ,0x9e ,0xf6 ,0x23 ,0xf8 ,0xff ,0xb4 ,0x84 ,0x53 ,0x96 ,0x29 ,0x0e ,0xbe ,0xcc ,0xcf ,0x57 ,0x90 ,0x69 ,0x65 ,0xcd ,0x01 ,0x5c ,0x21 ,0x83 ,0x83 ,0xd4 ,0x8c ,0xdb ,0x60 ,0x4e ,0x48 ,0x85 ,0x1d ,0x70 ,0xb9 ,0xba ,0x05 ,0x4f ,0x09 ,0xbc ,0x51 ,0x09 ,0xd4 ,0x0d ,0xef ,0x4e ,0xea ,0x29 ,0x27 ,0xbc ,0xca ,0x59 ,0xe6 ,0xd4 ,0xf2 ,0x2a ,0x5e ,0x9e ,0x31 ,0x59 ,0xe8 ,0x67 ,0xcf ,0xe4 ,0x8a ,0x74 ,0xb2 ,0xaa ,0x69 ,0x66 ,0xc1 ,0x27 ,0x29 ,0xe6 ,0x87 ,0x6d ,0x42 ,0x95 ,0x17 ,0xe0 ,0xb4 ,0x60 ,0x31 ,0xf0 ,0xe0 ,0x05 ,0xbb ,0x20 ,0xf9 ,0x2b ,0xec ,0xd3 ,0x40 ,0x98 ,0x4d ,0xf1 ,0xb4 ,0x99 ,0xf2 ,0x87 ,0x20 ,0x8a ,0x24 ,0x9c ,0x8e ,0x95 ,0x40 ,0x82 ,0x78 ,0x17 ,0xe4 ,0x3d ,0x7c ,0x3a ,0x48 ,0xcd ,0x8c ,0x3c ,0x09 ,0xe5 ,0xb1 ,0x59 ,0x22 ,0x9e ,0xf5 ,0x4a ,0x3c ,0x61 ,0xcc ,0xff ,0x45 ,0xdd ,0x57 ,0x28 ,0xdc ,0x5a ,0x8c ,0xd6 ,0x0b ,0x00 ,0xbd ,0x46 ,0xe9 ,0xbe ,0xb6 ,0x15 ,0x86 ,0x38 ,0x6c ,0xe6 ,0x12 ,0x6e ,0xcb ,0xc0 ,0x60 ,0x20 ,0xae ,0x0a ,0x96 ,0x33 ,0x4d ,0x15 ,0x25 ,0x81 ,0x46 ,0xd5 ,0xa7 ,0xe9 ,0x08 ,0x3c ,0xaa ,0xb6 ,0xe6 ,0x0c ,0x92 ,0x00 ,0xaf ,0x75 ,0xf1 ,0x2d ,0xf4 ,0x3a ,0x6e ,0xd0 ,0x5a ,0x18 ,0xde ,0xed ,0x96 ,0x54 ,0x5a ,0x81 ,0xdf ,0x0a ,0xaa ,0xea ,0xba ,0x22 ,0xd4 ,0xd7 ,0x05 ,0xac ,0x13 ,0x47 ,0xc8 ,0x5a ,0xcc ,0x8a ,0xef ,0x96 ,0x07 ,0xe9 ,0x13 ,0x14 ,0x37 ,0x81 ,0x39 ,0x28 ,0xae ,0x21 ,0xd3 ,0x2e ,0x5c ,0x3d ,0x1d ,0x05 ,0xd3 ,0xfc ,0x5a ,0x3b ,0x43 ,0x6a ,0x38 ,0xea ,0x22 ,0x30 ,0x69 ,0xfb ,0x68 ,0xbf ,0xec ,0x3c ,0xc6 ,0x2f ,0xa4 ,0xec ,0xa8 ,0xeb ,0x01 ,0xd2 ,0xf7 ,0x80 ,0xe0 ,0x3c ,0xa5 ,0x87 ,0x3b ,0xf0 ,0x47 ,0xe8 ,0xda ,0xe9 ,0x20 ,0x2d ,0x8f ,0x47 ,0x8f ,0x91 ,0x71 ,0xed ,0x61 ,0x23 ,0x45 ,0xb7 ,0x48 ,0x0e ,0xf7 ,0x51 ,0x14 ,0x39 ,0xda ,0x6c ,0x58 ,0x2c ,0xb5 ,0x2e ,0x29 ,0x51 ,0x18 ,0x8c ,0xba ,0x50 ,0x14 ,0x39 ,0x3a ,0x85 ,0x43 ,0xcc ,0xc7 ,0x14 ,0x22 ,0xf4 ,0xbb ,0xfc ,0xa5 ,0x76 ,0x0f ,0x30 ,0x2a ,0x68 ,0x61 ,0xac ,0x60 ,0x16 ,0x0b ,0xd4 ,0x0a ,0xde ,0xb3 ,0x56 ,0xe9 ,0x08 ,0x47 ,0x00 ,0xd0 ,0xf0 ,0xb5 ,0x87 ,0x85 ,0x24 ,0xcc ,0x07 ,0x18 ,0x86 ,0x71 ,0x32 ,0x84 ,0xd1 ,0x18 ,0xbd ,0x47 ,0xdb ,0xea ,0xb4 ,0xa3 ,0xdd ,0x8d ,0xb5 ,0xb6 ,0x40 ,0xe9 ,0x18 ,0xf4 ,0x80 ,0x64 ,0x56 ,0xbf ,0xab ,0xbd ,0xb3 ,0x12 ,0xbc ,0xba ,0x30 ,0xda ,0x07 ,0xe2 ,0x31 ,0x44 ,0xa6 ,0x5f ,0xe2 ,0x5b ,0xc0 ,0x4c ,0x5a ,0x0c ,0xa3 ,0x9b ,0xb4 ,0xe0 ,0x9a ,0x6e ,0x0f ,0x42 ,0xe9 ,0x26 ,0xbb ,0x6e ,0xbb ,0xad ,0x33 ,0x8a ,0x0e ,0xf0 ,0x8c ,0x54 ,0x21 ,0x2d ,0xa2 ,0x00 ,0x9e ,0x8c ,0xd5 ,0x18 ,0x99 ,0xa8 ,0x10 ,0x91 ,0x54 ,0xbd ,0x09 ,0xd8 ,0xe6 ,0x7a ,0x8f ,0x10 ,0xe5 ,0xd3 ,0xec ,0x18 ,0xf2 ,0xb3 ,0x0e ,0xcd ,0x89 ,0x08 ,0xdb ,0xb4 ,0xf7 ,0xc5 ,0x57 ,0x0b ,0xfb ,0x2b ,0x58 ,0x8b ,0x09 ,0x7d ,0x97 ,0xda ,0x1a ,0x70 ,0x14 ,0x0a ,0xce ,0x76 ,0x85 ,0x67 ,0x8b ,0xa0 ,0x09 ,0x90 ,0x9b ,0x89 ,0x29 ,0x39 ,0xee ,0xa2 ,0x37 ,0x2a ,0x99 ,0x50 ,0xc5 ,0xc2 ,0x98 ,0x6f ,0x55 ,0xee ,0x40 ,0xae ,0x42 ,0x5a ,0xc8 ,0xe6 ,0xab ,0xe2 ,0x7f ,0x98 ,0x78 ,0x48 ,0x89 ,0xdc ,0x74 ,0xec ,0x1d ,0xbd ,0x92 ,0x28 ,0x3a ,0x1c ,0x14 ,0xac ,0x5c ,0x2e ,0x59 ,0x93 ,0x10 ,0x91 ,0xda ,0x76 ,0xa9 ,0x30 ,0x88 ,0x0f ,0x8a ,0xc7 ,0xbd ,0x12 ,0xba ,0x05 ,0x51 ,0x7d ,0x78 ,0x27 ,0x52 ,0x9d ,0x0c ,0x36 ,0xf0 ,0xe5 ,0x65 ,0x79 ,0xdd ,0xb0 ,0xfc ,0xe8 ,0x09 ,0x88 ,0x5b ,0x87 ,0xa0 ,0x9c ,0x88 ,0x4b ,0xd3 ,0x24 ,0x5b ,0x37 ,0x69 ,0x28 ,0xc8 ,0x2d ,0x2f ,0x2e ,0x42 ,0x3d ,0x16 ,0x4f ,0xd1 ,0x32 ,0x06 ,0x7a ,0x9e ,0x85 ,0xa2 ,0xcf ,0x81 ,0x41 ,0xd4 ,0x59 ,0x30 ,0xe4 ,0x78 ,0x72 ,0xcc ,0x02 ,0xec ,0x71 ,0x75 ,0xf7 ,0x44 ,0x8f ,0x49 ,0x29 ,0x30 ,0x1e ,0x90 ,0x7f ,0xfb ,0xa0 ,0x3d ,0xd5 ,0x67 ,0x05 ,0x35 ,0x91 ,0x2d ,0x62 ,0x8c ,0x2d ,0x82 ,0x70 ,0xde ,0xba ,0x40 ,0xda ,0x88 ,0x53 ,0x24 ,0x09 ,0x62 ,0x0e ,0xfe ,0xd7 ,0x41 ,0x6c ,0x12 ,0x14 ,0x2b ,0xa5 ,0x75 ,0x90 ,0xe6 ,0x92 ,0x8f ,0x3f ,0xda ,0xfc ,0x32 ,0x2d ,0xc7 ,0xeb ,0x49 ,0xfe ,0x68 ,0x73 ,0x72 ,0x80 ,0xbc ,0x7e ,0xcb ,0xae ,0xb2 ,0x4d ,0x3e ,0x9a ,0x66 ,0x9d ,0xe5 ,0x68 ,0x51 ,0xcc ,0x57 ,0x48 ,0x77 ,0x81 ,0xe5 ,0xa4 ,0x7e ,0xd5 ,0xfa ,0x43 ,0xa8 ,0x26 ,0xd8 ,0x00 ,0x41 ,0x53 ,0x18 ,0xce ,0x15 ,0xe0 ,0x26 ,0xa7 ,0x1f ,0xd8 ,0xa3 ,0x0f ,0x68 ,0xc0 ,0xe8 ,0x43 ,0x03 ,0xd1 ,0x36 ,0x04 ,0x0c ,0x61 ,0x7d ,0x48 ,0xec ,0x35 ,0xf5 ,0xbe ,0x39 ,0x04 ,0xa8 ,0x41 ,0xd0 ,0xf8 ,0xe1 ,0x13 ,0x77 ,0xf3 ,0x29 ,0xce ,0x2f ,0x16 ,0xe5 ,0x7a ,0xae ,0xc9 ,0xdc ,0x59 ,0xf0 ,0xc4 ,0x6a ,0x11 ,0x3d ,0xb0 ,0xe2 ,0xc2 ,0x34 ,0x99 ,0xca ,0x61 ,0x98 ,0x14 ,0x05 ,0x7f ,0x58 ,0x4d ,0xfa ,0x74 ,0xb5 ,0x30 ,0xc9 ,0x17 ,0x4c ,0x5b ,0x7d ,0xe6 ,0x57 ,0x63 ,0x0f ,0xd8 ,0x1f ,0x42 ,0xaf ,0x83 ,0xa6 ,0x89 ,0xa7 ,0xf7 ,0xc7 ,0x17 ,0x00 ,0x18 ,0xf3 ,0x95 ,0xd4 ,0x24 ,0xd5 ,0x63 ,0x74 ,0x04 ,0xfa ,0xa4 ,0x27 ,0x4f ,0xf3 ,0xd2 ,0xea ,0x1c ,0x2e ,0xf7 ,0x78 ,0x60 ,0x6b ,0x2c ,0xc7 ,0x88 ,0x5c ,0x45 ,0xc9 ,0x08 ,0xef ,0xb3 ,0x17 ,0xe4 ,0x09 ,0xb8 ,0x96 ,0xc5 ,0xef ,0x38 ,0x72 ,0x23 ,0x15 ,0x68 ,0x70 ,0x59 ,0x90 ,0xb8 ,0x3d ,0xca ,0x5d ,0x3d ,0x8c ,0xda ,0x96 ,0x18 ,0x88 ,0xea ,0x96 ,0x04 ,0xeb ,0xad ,0x31 ,0xa7 ,0x6a ,0x40 ,0x21 ,0xe4 ,0x52 ,0x8b ,0x31 ,0x64 ,0x73 ,0x60 ,0x68 ,0xb1 ,0x98 ,0x7d ,0xa7 ,0x76 ,0x6b ,0xc0 ,0x5a ,0x8d ,0x8e ,0x27 ,0xbc ,0x65 ,0x88 ,0x91 ,0x4e ,0xe4 ,0x07 ,0xa9 ,0xe2 ,0xbe ,0x4c ,0xc0 ,0xac ,0x81 ,0x51 ,0x33 ,0x98 ,0x00 ,0x21 ,0xe6 ,0x78 ,0x47 ,0x97 ,0x3c ,0xc2 ,0xe7 ,0x22 ,0x1c ,0xf8 ,0xc5 ,0xa4 ,0x3c ,0xcb ,0x26 ,0x94 ,0x92 ,0x81 ,0x04 ,0x46 ,0x31 ,0x0a ,0x87 ,0xc8 ,0x34 ,0x8b ,0xee ,0x41 ,0x7a ,0xc2 ,0x0c ,0x11 ,0xf3 ,0xe9 ,0xe0 ,0xe9 ,0x66 ,0xef ,0x6f ,0x03 ,0xc4 ,0xdc ,0x3f ,0x3e ,0xf0 ,0xdd ,0x49 ,0x37 ,0x3a ,0x8d ,0xce ,0x68 ,0xac ,0x33 ,0x2d ,0x38 ,0xe5 ,0x00 ,0xab ,0x5c ,0x40 ,0xb7 ,0xdd ,0x00 ,0x5e ,0x2d ,0xb2 ,0x0b ,0x81 ,0xe1 ,0xe2 ,0x88 ,0x83 ,0x8e ,0x5e ,0x0e ,0xe1 ,0xe7 ,0xc5 ,0x55 ,0x76 ,0xfe ,0x14 ,0x5f ,0x35 ,0x29 ,0x10 ,0x67 ,0x35 ,0xf3 ,0x53 ,0x40 ,0x44 ,0xf6 ,0x45 ,0xc9 ,0x4b ,0x91 ,0x8c ,0x01 ,0x94 ,0x8e ,0xed ,0x93 ,0x31 ,0x3c ,0x51 ,0x79 ,0x87 ,0x30 ,0xe5 ,0x29 ,0x74 ,0xe9 ,0x5d ,0xa4 ,0x6b ,0x1a ,0xf5 ,0x91 ,0x89 ,0x45 ,0xe5 ,0x8c ,0x8c ,0x5e ,0x46 ,0xce ,0xe3 ,0x10 ,0x58 ,0x55 ,0xab ,0xe2 ,0x71 ,0x71 ,0x45 ,0x20 ,0x8b ,0xb0 ,0xd5 ,0x73 ,0xb3 ,0x9b ,0x97 ,0xe4 ,0x36 ,0xea ,0xfc ,0xec ,0xd4 ,0x1d ,0xce ,0x2f ,0x31 ,0xc9 ,0x20 ,0x25 ,0x80 ,0x58 ,0x33 ,0xef ,0xd9 ,0x09 ,0x0d ,0x41 ,0xa5 ,0x37 ,0xcf ,0xa5 ,0xed ,0x7b ,0xf7 ,0xba ,0x77 ,0xb9 ,0x9a ,0x4e ,0xbe ,0x85 ,0xe9 ,0xb0 ,0x6a ,0xc5 ,0x96 ,0x9d ,0xee ,0x92 ,0x5b ,0xec ,0x48 ,0x8c ,0xe8 ,0x03 ,0x0f ,0x2e ,0xa8 ,0xa2 ,0x77 ,0x68 ,0x0c ,0xd2 ,0xc2 ,0x36 ,0x30 ,0x8b ,0x62 ,0xd9 ,0x63 ,0xdb ,0x3f ,0x0f ,0x35 ,0x8c ,0x43 ,0x97 ,0xa1 ,0xd8 ,0x24 ,0x94 ,0x37 ,0x60 ,0x3c ,0x69 ,0xd8 ,0x16 ,0xd2 ,0x9e ,0x54 ,0xac ,0x5c ,0x19 ,0xee ,0xe1 ,0xbc ,0xf2 ,0x04 ,0xc7 ,0xc1 ,0x85 ,0x35 ,0x1c ,0x0f ,0x31 ,0x04 ,0xe2 ,0x50 ,0x02 ,0x18 ,0x80 ,0x57 ,0x48 ,0x04 ,0x37 ,0x45 ,0x74 ,0x1b ,0x45 ,0x05 ,0xc8 ,0xfa ,0x33 ,0xb0 ,0xdd ,0x0c ,0xcf ,0x0b ,0x1e ,0xd7 ,0x2c ,0x2b ,0x9b ,0x3e ,0x18 ,0x41 ,0x59 ,0x8a ,0xc5 ,0x17 ,0x77 ,0x3d ,0xae ,0xb6 ,0x14 ,0xea ,0x71 ,0x17 ,0x16 ,0x8b ,0xf6 ,0x8c ,0x52 ,0x1a ,0x84 ,0xe2 ,0xf6 ,0x75 ,0xc9 ,0x86 ,0x23 ,0xd6 ,0xe5 ,0xd2 ,0x8e ,0xa2 ,0x75 ,0x66 ,0x48 ,0x96 ,0x8f ,0x31 ,0x05 ,0x85 ,0xe1 ,0x84 ,0xdd ,0x37 ,0xee ,0x77 ,0x6b ,0x0a ,0x4b ,0xc0 ,0x04 ,0xb7 ,0x4c ,0xc0 ,0xa8 ,0x32 ,0x36 ,0x59 ,0x75 ,0x1e ,0xac ,0x5c ,0x06 ,0xef ,0x1b ,0x6b ,0x4d ,0x76 ,0x05 ,0xc1 ,0x45 ,0xe2 ,0xdb ,0x36 ,0xde ,0x1c ,0xb4 ,0xbe ,0x5c ,0xe4 ,0xb9 ,0x6a ,0x1a ,0x13 ,0x7f ,0x8d ,0x1d ,0x52 ,0x8d ,0xd4 ,0x86 ,0x00 ,0x68 ,0xf2 ,0xdc ,0xf3 ,0x09 ,0x36 ,0x70 ,0xea ,0x7f ,0xf3 ,0x5f ,0xc6 ,0x13 ,0x3b ,0x69 ,0xe5 ,0xcc ,0x4d ,0x20 ,0xeb ,0xaa ,0x13 ,0xb9 ,0x85 ,0xf6 ,0xe2 ,0x1c ,0x7b ,0xe0 ,0x49 ,0xd9 ,0xb3 ,0x1b ,0x40 ,0x63 ,0x7b ,0xdc ,0x42 ,0x09 ,0xb3 ,0x52 ,0xb2 ,0x7f ,0xae ,0x4f ,0xc1 ,0x76 ,0xbf ,0x5a ,0x8e ,0xcf ,0x39 ,0xb2 ,0xe5 ,0x86 ,0x44 ,0x99 ,0xbd ,0x7d ,0xc3 ,0xee ,0xae ,0x86 ,0xda ,0xbd ,0xe6 ,0xbe ,0xf7 ,0x7b ,0x7e ,0x7b ,0x90 ,0x3c ,0x37 ,0x1b ,0xe8 ,0x14 ,0xba ,0xf8 ,0xf9 ,0x66 ,0x0e ,0xc7 ,0x01 ,0x58 ,0x0a ,0x1b ,0x51 ,0x64 ,0xbf ,0x59 ,0x21 ,0xed ,0x7a ,0x33 ,0xc6 ,0xe0 ,0xe0 ,0xa7 ,0x9c ,0x77 ,0x36 ,0x23 ,0x30 ,0xf2 ,0x7e ,0x3f ,0x48 ,0xde ,0xca ,0x33 ,0xc3 ,0x5f ,0x7a ,0x20 ,0xa3 ,0x48 ,0x9a ,0xf5 ,0xda ,0xbd ,0x6e ,0x07 ,0x74 ,0x98 ,0x87 ,0x42 ,0x70 ,0xa5 ,0x11 ,0x84 ,0x08 ,0x70 ,0x97 ,0xbf ,0x0e ,0x2e ,0x07 ,0x51 ,0xb8 ,0x7f ,0xe7 ,0xe5 ,0x20 ,0x56 ,0x3c ,0x64 ,0xa7 ,0xa1 ,0x0f ,0xd6 ,0x80 ,0x7d ,0xec ,0x9f ,0xf9 ,0xa4 ,0xe2 ,0xf1 ,0x4a ,0xb4 ,0x5c ,0x92 ,0x75 ,0x2c ,0xf5 ,0x74 ,0x62 ,0xa2 ,0xbb ,0x1a ,0x79 ,0x4b ,0xe4 ,0x6b ,0x41 ,0xbf ,0xd4 ,0x33 ,0x20 ,0xc4 ,0x86 ,0xc2 ,0xf5 ,0x92 ,0xd1 ,0x55 ,0x47 ,0xf2 ,0x87 ,0x60 ,0x14 ,0xf9 ,0xd3 ,0x9d ,0x31 ,0x8a ,0xf0 ,0x28 ,0x15 ,0xed ,0x94 ,0x44 ,0xc8 ,0x8a ,0xa5 ,0x68 ,0x5d ,0xf3 ,0x93 ,0x69 ,0x44 ,0xa6 ,0x94 ,0xcd ,0x4b ,0x0c ,0x4d ,0x14 ,0xaf ,0xad ,0xc9 ,0x7a ,0x66 ,0x4c ,0xbd ,0x40 ,0x6a ,0x9b ,0xd6 ,0x9c ,0x06 ,0x55 ,0x31 ,0xce ,0xbf ,0x8b ,0x4e ,0x91 ,0x7e ,0x0d ,0x33 ,0x6c ,0xb3 ,0xa0 ,0x77 ,0x0b ,0x67 ,0xb7 ,0x1f ,0x3a ,0xaf ,0xa7 ,0x52 ,0x55 ,0x06 ,0x6c ,0x99 ,0x7e ,0x2e ,0xea ,0xdc ,0x05 ,0xa0 ,0x4f ,0xbd ,0xf2 ,0x9c ,0x8c ,0x3d ,0xaa ,0xe4 ,0x34 ,0x69 ,0x09 ,0x42 ,0x0f ,0xe9 ,0x82 ,0xc2 ,0xc3 ,0x4c ,0xfe ,0xc4 ,0xf3 ,0x98 ,0x9c ,0xc3 ,0x4e ,0x57 ,0x64 ,0x8b ,0xa2 ,0x3d ,0x55 ,0xe7 ,0x73 ,0xd0 ,0x61 ,0x27 ,0x34 ,0x5d ,0xa9 ,0xe4 ,0xa3 ,0xf6 ,0x09 ,0xf0 ,0x9e ,0x22 ,0x02 ,0x5d ,0x72 ,0xf0 ,0x79 ,0x2f ,0xbd ,0xd3 ,0x7d ,0x8b ,0xb1 ,0x54 ,0xaa ,0x76 ,0x4a ,0x91 ,0x17 ,0xff ,0x70 ,0x77 ,0xb2 ,0x5e ,0xf4 ,0xe1 ,0x3a ,0xcc ,0xb0 ,0xb9 ,0x84 ,0x5e ,0x83 ,0xbf ,0x7b ,0xba ,0xfe ,0x65 ,0x88 ,0x16 ,0x92 ,0x40 ,0x90 ,0x52 ,0x41 ,0xbd ,0x19 ,0xf8 ,0xa0 ,0x5e ,0x11 ,0xd5 ,0x1c ,0x6b ,0xf0 ,0x2f ,0xfc ,0xba ,0x2d ,0x86 ,0x61 ,0x37 ,0xd4 ,0x9c ,0x62 ,0xa4 ,0x61 ,0x6d ,0xa8 ,0x1e ,0xf8 ,0x86 ,0x26 ,0xf0 ,0xb4 ,0x72 ,0xa5 ,0x95 ,0x5f ,0x52 ,0xd2 ,0xed ,0xcf ,0xc4 ,0x6f ,0x1e ,0x7a ,0xf9 ,0xca ,0x14 ,0xa9 ,0x72 ,0x70 ,0x7b ,0x16 ,0x69 ,0x7f ,0x6c ,0x8f ,0x03 ,0x8b ,0x00 ,0x68 ,0xb6 ,0xdb ,0x30 ,0x25 ,0x2e ,0x2e ,0xa0 ,0xfb ,0xc2 ,0x40 ,0xe8 ,0x1a ,0xd2 ,0x9d ,0xda ,0x5d ,0x72 ,0x8b ,0x88 ,0xbc ,0xd8 ,0xcc ,0x5b ,0xe2 ,0x3c ,0x50 ,0x05 ,0x32 ,0xc1 ,0x5f ,0x49 ,0x1c ,0xd3 ,0x5f ,0x0b ,0x31 ,0x14 ,0x30 ,0xf5 ,0x02 ,0x09 ,0x1c ,0x37 ,0xc4 ,0x98 ,0x65 ,0x3f ,0xc1 ,0x0e ,0x06 ,0x7c ,0x2c ,0x85 ,0xbe ,0xdd ,0x5b ,0xb3 ,0x7b ,0xae ,0xe0 ,0x6a ,0xcc ,0x38 ,0x71 ,0x81 ,0xd9 ,0xe8 ,0x25 ,0x6e ,0x61 ,0xdf ,0xd3 ,0xac ,0x8c ,0x33 ,0x91 ,0x9e ,0xf5 ,0x26 ,0xd2 ,0x49 ,0x18 ,0x8a ,0xfb ,0x9c ,0x02 ,0x67 ,0xa9 ,0x9c ,0xf8 ,0x61 ,0xc8 ,0x26 ,0x40 ,0x02 ,0x68 ,0x81 ,0x83 ,0x2d ,0xaa ,0x8d ,0x98 ,0x09 ,0x00 ,0x3c ,0x93 ,0xfc ,0x82 ,0xfb ,0x19 ,0x9d ,0x4d ,0x9e ,0xf7 ,0xce ,0xd0 ,0xf5 ,0x22 ,0x5a ,0xa2 ,0xdf ,0xa3 ,0xad ,0xcf ,0x8e ,0x44 ,0x8a ,0xad ,0x84 ,0x89 ,0x78 ,0xa9 ,0x9c ,0x27 ,0x25 ,0x7a ,0x45 ,0xf2 ,0x80 ,0x9b ,0x38 ,0xf2 ,0xbc ,0x17 ,0x90 ,0xe7 ,0xc9 ,0x00 ,0x43 ,0x07 ,0x8a ,0x43 ,0x84 ,0x30 ,0x54 ,0xfc ,0x33 ,0x8e ,0x8c ,0xcb ,0x45 ,0xbf ,0x80 ,0x48 ,0xc1 ,0x3b ,0x16 ,0xe8 ,0xcb ,0xc0 ,0x6f ,0xf1 ,0x3a ,0x60 ,0x8c ,0x5e ,0x31 ,0xfa ,0x00 ,0xe8 ,0xe8 ,0xe1 ,0x11 ,0xbc ,0xce ,0x19 ,0x4f ,0x29 ,0x68 ,0x2d ,0xf4 ,0xc9 ,0x30 ,0xbe ,0xf0 ,0x81 ,0xa2 ,0xe8 ,0x4d ,0xdb ,0x1c ,0x52 ,0x7f ,0xdf ,0xb5 ,0xee ,0x79 ,0xb9 ,0xc6 ,0xa4 ,0x86 ,0x8f ,0x55 ,0xee ,0x10 ,0x6b ,0xf4 ,0xcb ,0x2e ,0xcd ,0xcb ,0xcc ,0x99 ,0xb7 ,0xff ,0x87 ,0x47 ,0x35 ,0xe4 ,0x50 ,0xd7 ,0xeb ,0xa0 ,0xde ,0x51 ,0x4d ,0xd7 ,0x63 ,0x8e ,0xc4 ,0xb0 ,0xc0 ,0xe0 ,0x0d ,0xf6 ,0x33 ,0xff ,0x6d ,0x4e ,0xf0 ,0x6e ,0x35 ,0xb2 ,0x13 ,0xdc ,0x4e ,0xd8 ,0xf8 ,0x02 ,0xa3 ,0xee ,0xe2 ,0x8f ,0x94 ,0x37 ,0x1c ,0xff ,0x1b ,0xeb ,0x06 ,0x6e ,0x03 ,0x41 ,0x7d ,0xc1 ,0x76 ,0x83 ,0x51 ,0x2a ,0x1c ,0xce ,0xe9 ,0xc6 ,0x8c ,0x4c ,0xed ,0x70 ,0xe8 ,0xe2 ,0x64 ,0x23 ,0x49 ,0xf7 ,0x35 ,0x0a ,0x91 ,0xdf ,0x6f ,0x95 ,0x7a ,0xd9 ,0xdb ,0xde ,0x5e ,0xb4 ,0x66 ,0x19 ,0x69 ,0xd7 ,0xaf ,0x27 ,0xfa ,0xd8 ,0xfb ,0x2b ,0x93 ,0x96 ,0xf1 ,0x2b ,0xea ,0x53 ,0x16 ,0x53 ,0xee ,0x02 ,0x91 ,0xf1 ,0xde ,0x63 ,0xde ,0x02 ,0xfd ,0xdd ,0x36 ,0xf5 ,0x64 ,0x70 ,0x21 ,0xbe ,0x7a ,0x78 ,0xea ,0x4a ,0x50 ,0x06 ,0x7a ,0x4b ,0x95 ,0xc0 ,0x48 ,0x95 ,0xd8 ,0x33 ,0x27 ,0x27 ,0x3d ,0x44 ,0x9e ,0xb1 ,0x33 ,0x08 ,0x67 ,0xd8 ,0x09 ,0x7b ,0x8f ,0xf1 ,0xbf ,0x81 ,0xcf ,0x04 ,0xc4 ,0xa3 ,0xe1 ,0x11 ,0xa3 ,0xd1 ,0x50 ,0x56 ,0x07 ,0x5f ,0x4f ,0x35 ,0x67 ,0x46 ,0x23 ,0xa0 ,0x74 ,0x60 ,0xca ,0xd1 ,0x1b ,0xd4 ,0x05 ,0x66 ,0xd1 ,0xa8 ,0x67 ,0xe7 ,0x3e ,0xb6 ,0x24 ,0xa2 ,0x51 ,0x1c ,0x58 ,0xb9 ,0xae ,0x23 ,0x0f ,0x2d ,0xcd ,0xdd ,0xb5 ,0x4e ,0xe1 ,0x91 ,0xc8 ,0xdb ,0x64 ,0x06 ,0xa3 ,0x96 ,0x34 ,0xba ,0x91 ,0x74 ,0x76 ,0x4d ,0x70 ,0xc7 ,0x79 ,0xfc ,0x58 ,0x94 ,0x98 ,0xa0 ,0x4f ,0xe2 ,0xaf ,0x73 ,0x56 ,0xbb ,0x49 ,0x22 ,0xce ,0x8b ,0xc2 ,0x67 ,0x2a ,0xb3 ,0x06 ,0xfe ,0xc7 ,0xce ,0x0d ,0xb3 ,0x06 ,0x1e ,0xc9 ,0xcc ,0x91 ,0x9f ,0x98 ,0x9d ,0x63 ,0xf8 ,0xe5 ,0xdb ,0xb5 ,0xad ,0x92 ,0x89 ,0xbb ,0x02 ,0x87 ,0x7b ,0x0c ,0x14 ,0xd3 ,0xad ,0x0a ,0x7b ,0xc1 ,0x3e ,0x05 ,0x17 ,0x6f ,0x1e ,0x76 ,0x52 ,0x51 ,0xca ,0x29 ,0x6c ,0xd1 ,0x0d ,0x92 ,0xbf ,0x69 ,0xe5 ,0x28 ,0xb2 ,0x12 ,0x15 ,0x6b ,0xe6 ,0xbe ,0x3c ,0xe7 ,0xbe ,0xbc ,0x04 ,0x79 ,0xa1 ,0x03 ,0xea ,0xc4 ,0x16 ,0xf3 ,0x2e ,0xa7 ,0x86 ,0x4c ,0x54 ,0x4c ,0x63 ,0x60 ,0xe7 ,0xb1 ,0x04 ,0x9f ,0x2c ,0xc0 ,0x40 ,0xc8 ,0x01 ,0x51 ,0x23 ,0x0b ,0xd9 ,0xd1 ,0x29 ,0x89 ,0x65 ,0x2f ,0x96 ,0x36 ,0x02 ,0x6e ,0x9b ,0x6c ,0xb1 ,0x4d ,0x61 ,0xe7 ,0xc5 ,0x8d ,0x28 ,0x2b ,0x59 ,0xcd ,0x2b ,0xae ,0x03 ,0x61 ,0x35 ,0x2b ,0x12 ,0x5e ,0x95 ,0x67 ,0x08 ,0x74 ,0x36 ,0xe4 ,0x9b ,0xb8 ,0x49 ,0xb0 ,0xa5 ,0x89 ,0xd1 ,0x22 ,0x43 ,0xf5 ,0xd1 ,0x5d ,0x95 ,0x4c ,0x2e ,0x81 ,0x81 ,0xd1 ,0x0c ,0x75 ,0x77 ,0x0d ,0x33 ,0x57 ,0x4c ,0xde ,0xc9 ,0xb5 ,0xa3 ,0x03 ,0xeb ,0x6a ,0x49 ,0x42 ,0x44 ,0x2e ,0x69 ,0x18 ,0xe7 ,0xee ,0xe0 ,0x44 ,0x94 ,0x42 ,0xfd ,0xc4 ,0x16 ,0xff ,0xfa ,0x2a ,0x1b ,0xc0 ,0x74 ,0x80 ,0xe1 ,0xe5 ,0x0b ,0xd3 ,0x62 ,0x4c ,0x0f ,0x0e ,0x55 ,0x74 ,0x2d ,0xb0 ,0x54 ,0x06 ,0xa7 ,0xf4 ,0x6e ,0xed ,0xea ,0x67 ,0xe0 ,0x4e ,0x68 ,0xca ,0xbc ,0x4a ,0x84 ,0x99 ,0x69 ,0x09 ,0x03 ,0xb2 ,0x42 ,0x87 ,0xa8 ,0x10 ,0x6d ,0x16 ,0xe0 ,0x0f ,0x05 ,0x5e ,0x05 ,0x80 ,0x34 ,0x66 ,0xa8 ,0x02 ,0xfa ,0xf4 ,0x0d ,0x44 ,0x62 ,0x73 ,0x4a ,0x29 ,0x80 ,0xe8 ,0x91 ,0x0d ,0x4c ,0x86 ,0xa0 ,0xa9 ,0x18 ,0x44 ,0x62 ,0xc0 ,0xf3 ,0x82 ,0x18 ,0xee ,0xd8 ,0x57 ,0x4b ,0x57 ,0x9c ,0x46 ,0x7a ,0x33 ,0x19 ,0xbe ,0x9e ,0x4e ,0xf3 ,0x71 ,0xc1 ,0x08 ,0x6e ,0x4d ,0x39 ,0x63 ,0x52 ,0xb8 ,0x85 ,0x21 ,0x0f ,0xf8 ,0x53 ,0x5d ,0x38 ,0x59 ,0xb4 ,0x70 ,0xd0 ,0x45 ,0x5a ,0x08 ,0x66 ,0x4a ,0x9a ,0x01 ,0xed ,0xe7 ,0x8e ,0x03 ,0x1c ,0x88 ,0x7f ,0x5e ,0xc3 ,0x06 ,0x38 ,0x55 ,0x1b ,0xbc ,0xe3 ,0x78 ,0x8c ,0x32 ,0xb7 ,0x58 ,0x65 ,0x9c ,0x2c ,0x1a ,0x42 ,0x15 ,0x5d ,0x53 ,0x6f ,0x21 ,0x64 ,0xb0 ,0x79 ,0x9b ,0xc6 ,0x01 ,0xf8 ,0x71 ,0x5d ,0x68 ,0xa8 ,0x56 ,0x88 ,0x5f ,0x80 ,0xa4 ,0x03 ,0xb7 ,0xa3 ,0x84 ,0x45 ,0x8c ,0xa5 ,0x69 ,0x5a ,0xaa ,0xa8 ,0x3b ,0xe0 ,0x16 ,0xb5 ,0x4c ,0xcb ,0x79 ,0xd0 ,0x42 ,0x34 ,0xcd ,0x3b ,0xd5 ,0x43 ,0x60 ,0x8c ,0xe5 ,0xca ,0x0e ,0x16 ,0x78 ,0xd8 ,0xd1 ,0x79 ,0x34 ,0x78 ,0xc8 ,0x48 ,0x4b ,0x12 ,0xad ,0x18 ,0xed ,0xcd ,0xed ,0xaa ,0x05 ,0x9c ,0xd4 ,0xa4 ,0xfd ,0x97 ,0x74 ,0xb4 ,0x1c ,0x42 ,0x02 ,0xcc ,0x65 ,0x46 ,0x34 ,0xe0 ,0x50 ,0x89 ,0x53 ,0x63 ,0x9a ,0xfe ,0x05 ,0xba ,0x03 ,0x0c ,0x77 ,0x05 ,0xa2 ,0x20 ,0x74 ,0x3a ,0x9f ,0xf7 ,0xd4 ,0xab ,0xfd ,0x33 ,0x38 ,0x73 ,0x50 ,0xbd ,0x3e ,0xf0 ,0x2b ,0xd5 ,0x1f ,0x0b ,0x78 ,0xec ,0x91 ,0x0d ,0xaf ,0x30 ,0xf5 ,0x8c ,0x07 ,0xa3 ,0x30 ,0x5b ,0x9b ,0xab ,0x58 ,0xb8 ,0x2a ,0x75 ,0x29 ,0x1a ,0xa6 ,0x13 ,0x17 ,0x61 ,0x1a ,0x13 ,0x49 ,0x19 ,0xa3 ,0x62 ,0xbb ,0x09 ,0x90 ,0xae ,0x0e ,0xe2 ,0x97 ,0xb2 ,0x22 ,0x1c ,0xb7 ,0x26 ,0x1b ,0x62 ,0xf8 ,0xe8 ,0xe2 ,0x06 ,0x12 ,0x4d ,0x07 ,0xec ,0x6c ,0xb8 ,0x51 ,0xdc ,0x3c ,0xa5 ,0x2b ,0x9b ,0x00 ,0x47 ,0x00 ,0xdb ,0x11 ,0xde ,0x2c ,0x84 ,0xd3 ,0xa8 ,0x5e ,0x07 ,0x26 ,0x62 ,0xee ,0x67 ,0x3c ,0xb5 ,0xe8 ,0x2d ,0x13 ,0x0d ,0x14 ,0xdb ,0x91 ,0x5b ,0xee ,0xcc ,0x89 ,0xb2 ,0x5d ,0xeb ,0xc9 ,0xdd ,0x9a ,0x07 ,0xc2 ,0xbe ,0xd0 ,0x78 ,0xe3 ,0xe6 ,0x2c ,0xe8 ,0x4f ,0xfc ,0x38 ,0x94 ,0xc0 ,0x92 ,0xad ,0x3a ,0xa4 ,0x31 ,0x68 ,0x79 ,0xea ,0x7d ,0xec ,0x6c ,0x7b ,0x0a ,0x53 ,0x43 ,0xdd ,0xe9 ,0x89 ,0x0f ,0x71 ,0x41 ,0xaa ,0x39 ,0x4f ,0x2a ,0xa3 ,0xda ,0xac ,0x98 ,0x77 ,0xdd ,0x13 ,0x58 ,0xeb ,0xb5 ,0x03 ,0x21 ,0x28 ,0xbd ,0x03 ,0x7d ,0x07 ,0x66 ,0x86 ,0xd1 ,0xc9 ,0xab ,0xea ,0xe8 ,0x89 ,0xae ,0x9c ,0x98 ,0x32 ,0x04 ,0x68 ,0xbf ,0x55 ,0x2c ,0xe1 ,0x02 ,0x28 ,0xa0 ,0xc8 ,0x2d ,0x99 ,0x3a ,0x95 ,0x81 ,0xa6 ,0x7b ,0x91 ,0xbc ,0xe7 ,0xe1 ,0xc7 ,0x6b ,0x77 ,0xc0 ,0x58 ,0xab ,0xe8 ,0x08 ,0x6e ,0x6d ,0x9f ,0x91 ,0xfd ,0xbe ,0xa3 ,0x49 ,0xd7 ,0x8b ,0x42 ,0x58 ,0x9d ,0x3c ,0x36 ,0xaa ,0x89 ,0xc2 ,0x4c ,0xa6 ,0xb9 ,0x61 ,0xb3 ,0x93 ,0x87 ,0xa1 ,0x53 ,0xb5 ,0x44 ,0x64 ,0xbf ,0x3e ,0x81 ,0xbe ,0xe9 ,0x49 ,0x51 ,0x35 ,0x32 ,0x10 ,0xa1 ,0x7f ,0x47 ,0x95 ,0x5d ,0x06 ,0xe4 ,0xf9 ,0x74 ,0x7d ,0x66 ,0x34 ,0x1c ,0x4d ,0x9c ,0x11 ,0x10 ,0xb6 ,0x82 ,0xe9 ,0x37 ,0xf4 ,0x02 ,0x26 ,0x34 ,0x49 ,0x5f ,0xf5 ,0xfc ,0xd0 ,0x93 ,0xe4 ,0x51 ,0x57 ,0xc8 ,0x15 ,0x40 ,0x04 ,0x86 ,0x9b ,0x8e ,0xd0 ,0x94 ,0x96 ,0xdc ,0x29 ,0x66 ,0x08 ,0x31 ,0x79 ,0x36 ,0x59 ,0x23 ,0xb4 ,0xdf ,0xf6 ,0x32 ,0xb0 ,0x08 ,0x82 ,0x32 ,0x98 ,0x3a ,0x2a ,0x82 ,0x17 ,0xb6 ,0x97 ,0x00 ,0x95 ,0x66 ,0x14 ,0x21 ,0x4b ,0x71 ,0x5b ,0x19 ,0xca ,0x38 ,0x01 ,0xe7 ,0x5d ,0x94 ,0x23 ,0x98 ,0xa5 ,0x02 ,0x01 ,0xd5 ,0xa1 ,0xe4 ,0x93 ,0xe4 ,0x96 ,0xea ,0x36 ,0x68 ,0x98 ,0x34 ,0x51 ,0x05 ,0x24 ,0x89 ,0xa9 ,0x81 ,0xe3 ,0x3d ,0x37 ,0x5b ,0xe4 ,0x1b ,0x28 ,0x94 ,0xb4 ,0x32 ,0xd9 ,0xb7 ,0xcf ,0x72 ,0x00 ,0x80 ,0x7c ,0x3d ,0xd3 ,0x9e ,0x0f ,0xc1 ,0x60 ,0xbc ,0x93 ,0x5b ,0x48 ,0x4e ,0xe1 ,0x13 ,0xc1 ,0x21 ,0x01 ,0x54 ,0x34 ,0xc9 ,0x44 ,0xe3 ,0x30 ,0xba ,0x82 ,0x94 ,0x2c ,0x54 ,0xf8 ,0x28 ,0xee ,0x39 ,0x94 ,0x89 ,0x52 ,0x23 ,0xc4 ,0xa5 ,0xa6 ,0xe1 ,0xdc ,0xa8 ,0x87 ,0xce ,0x02 ,0x9b ,0xd4 ,0xd3 ,0x55 ,0x53 ,0xcc ,0xcc ,0xa6 ,0x7a ,0x98 ,0x65 ,0x58 ,0xaf ,0xa1 ,0x83 ,0x22 ,0x37 ,0x40 ,0x9a ,0xd4 ,0xeb ,0x1b ,0x85 ,0x93 ,0x91 ,0x5a ,0x0f ,0x02 ,0x7c ,0x85 ,0x96 ,0x6c ,0x58 ,0x65 ,0xd6 ,0x6f ,0x8e ,0x68 ,0x06 ,0x6b ,0x32 ,0xbd ,0x50 ,0x2c ,0xcd ,0xe6 ,0x03 ,0x56 ,0x28 ,0x13 ,0x82 ,0xc9 ,0xe4 ,0xdc ,0x02 ,0xba ,0x4b ,0x9b ,0x8d ,0x57 ,0x2f ,0xab ,0xdd ,0x34 ,0x7b ,0x1b ,0x9b ,0xe9 ,0xfa ,0x6d ,0xf0 ,0x32 ,0xef ,0x7f ,0x6d ,0x8b ,0xd4 ,0x9d ,0xde ,0x8e ,0xe0 ,0xde ,0x1e ,0xa3 ,0xbd ,0xda ,0xb3 ,0x30 ,0x72 ,0xbc ,0xb9 ,0xe2 ,0xb7 ,0x08 ,0x04 ,0x7a ,0x37 ,0xa3 ,0xae ,0xb3 ,0x25 ,0xc2 ,0x1c ,0x80 ,0x90 ,0x86 ,0xe7 ,0x9a ,0x44 ,0xfc ,0x82 ,0xe6 ,0x63 ,0x97 ,0x24 ,0x3a ,0x37 ,0x52 ,0x27 ,0xed ,0x02 ,0x1a ,0x06 ,0x39 ,0x0a ,0xd4 ,0x6d ,0x9a ,0x72 ,0x1f ,0xea ,0xfc ,0x50 ,0xfd ,0x9f ,0xce ,0xa9 ,0x2a ,0x82 ,0x1a ,0xd8 ,0xd3 ,0xcd ,0x06 ,0x74 ,0x0e ,0x65 ,0xa5 ,0xe0 ,0xa9 ,0xa8 ,0x77 ,0x17 ,0x0f ,0x1c ,0xe8 ,0x9a ,0xc0 ,0x0e ,0x66 ,0xa4 ,0x82 ,0xed ,0xbd ,0x3d ,0x61 ,0x1f ,0x91 ,0xdb ,0xf0 ,0xaa ,0x55 ,0xed ,0x71 ,0x76 ,0x55 ,0x13 ,0xc2 ,0xa4 ,0xd7 ,0x1f ,0xc0 ,0x7b ,0x34 ,0xc1 ,0x9b ,0x02 ,0x02 ,0x28 ,0x36 ,0x93 ,0x96 ,0x1d ,0x31 ,0x46 ,0x51 ,0x37 ,0x50 ,0xad ,0x4f ,0x8d ,0xe3 ,0x6d ,0xf3 ,0xe0 ,0x25 ,0x76 ,0x09 ,0xa2 ,0x52 ,0x7a ,0xdb ,0x95 ,0x22 ,0xf1 ,0x81 ,0x2a ,0x78 ,0x0b ,0x60 ,0x61 ,0x8c ,0xb6 ,0xfc ,0x95 ,0x82 ,0xeb ,0xed ,0x7a ,0xa8 ,0xe8 ,0x1a ,0x7e ,0xa4 ,0x65 ,0x37 ,0xf5 ,0xd2 ,0x5f ,0xa9 ,0xc4 ,0x03 ,0xbd ,0xfc ,0xae ,0xda ,0x34 ,0x3d ,0x6a ,0xa6 ,0x48 ,0x43 ,0x6d ,0xc5 ,0x22 ,0x47 ,0xfc ,0xd9 ,0x64 ,0x93 ,0xd5 ,0x17 ,0x39 ,0xcc ,0x71 ,0x0e ,0x11 ,0x61 ,0x88 ,0xfb ,0x86 ,0x78 ,0x8d ,0x1a ,0x71 ,0xb9 ,0x4f ,0xdc ,0x0e ,0x86 ,0xdd ,0xff ,0x02 ,0xf3 ,0xb7 ,0x5c ,0x4b ,0xfc ,0x0e ,0x5e ,0x59 ,0x2d ,0x26 ,0xe6 ,0x29 ,0x78 ,0x76 ,0x85 ,0x85 ,0x2e ,0x8f ,0x64 ,0x30 ,0xbe ,0x05 ,0x25 ,0x2e ,0x0f ,0x4d ,0x71 ,0xdd ,0x24 ,0x41 ,0xb9 ,0xf9 ,0x4f ,0xf6 ,0xe0 ,0x67 ,0x1e ,0x88 ,0xee ,0x9a ,0xb9 ,0x7b ,0x55 ,0xe4 ,0xd7 ,0xfc ,0x07 ,0x18 ,0xcf ,0x16 ,0x2d ,0x53 ,0xde ,0xe2 ,0x39 ,0x57 ,0x1e ,0x8e ,0xc1 ,0x21 ,0x36 ,0x7f ,0xf6 ,0x8a ,0x09 ,0x84 ,0xe4 ,0x8e ,0xb4 ,0x42 ,0x93 ,0x02 ,0x85 ,0x4b ,0x21 ,0x7a ,0x28 ,0xc5 ,0x80 ,0xe7 ,0x88 ,0x9d ,0x5b ,0xae ,0xea ,0xa1 ,0x5c ,0x35 ,0x1c ,0xe6 ,0xd7 ,0x12 ,0x98 ,0xc6 ,0x9c ,0xc8 ,0x8e ,0xc3 ,0x8a ,0x81 ,0xa9 ,0x9f ,0xcf ,0xe4 ,0x09 ,0x3d ,0x94 ,0x27 ,0x74 ,0xfd ,0x07 ,0xed ,0x5f ,0x95 ,0x86 ,0x31 ,0xac ,0x27 ,0xee ,0x3a ,0xa8 ,0x87 ,0x46 ,0x2a ,0xce ,0xe2 ,0xa3 ,0x71 ,0x34 ,0x55 ,0xd8 ,0x7e ,0x31 ,0x3d ,0x40 ,0x80 ,0xa1 ,0x0e ,0x14 ,0x24 ,0x6a ,0x24 ,0x5f ,0x18 ,0x5b ,0x82 ,0x4d ,0xaf ,0x1d ,0x41 ,0xf7 ,0x2f ,0xb6 ,0x4f ,0xf2 ,0x9e ,0xeb ,0x0b ,0xf7 ,0x7c ,0xa8 ,0x40 ,0xfe ,0xbc ,0x92 ,0xd7 ,0x11 ,0xc2 ,0x1e ,0xc0 ,0x83 ,0x2c ,0x7e ,0x3f ,0xec ,0xff ,0x1d ,0xbf ,0x4f ,0xfa ,0x87 ,0xc8 ,0x43 ,0x1e ,0xd4 ,0x59 ,0x60 ,0x59 ,0xa8 ,0x9c ,0x20 ,0xc2 ,0x99 ,0x91 ,0x69 ,0x21 ,0xcc ,0x78 ,0xae ,0x40 ,0x04 ,0x85 ,0x96 ,0x63 ,0xec ,0x1d ,0x8b ,0x56 ,0x22 ,0x87 ,0x10 ,0xb0 ,0x83 ,0x49 ,0x63 ,0x2e ,0x63 ,0x3b ,0xb5 ,0x9d ,0x68 ,0x92 ,0x9b ,0x33 ,0x7d ,0xc0 ,0x9c ,0x98 ,0x47 ,0xec ,0x2d ,0xd9 ,0xd4 ,0xab ,0x2e ,0x68 ,0x62 ,0x02 ,0x07 ,0x96 ,0x89 ,0x77 ,0x11 ,0x3e ,0xb0 ,0x4a ,0x2c ,0x63 ,0x04 ,0x87 ,0x8a ,0x8f ,0xd6 ,0x7a ,0xda ,0xfa ,0x60 ,0x14 ,0xaf ,0xef ,0x11 ,0xd8 ,0x95 ,0x68 ,0x03 ,0x8e ,0xd8 ,0x72 ,0xaa ,0x25 ,0x26 ,0x0e ,0x2c ,0xd8 ,0x14 ,0x81 ,0x9c ,0x4a ,0x7c ,0xd3 ,0x80 ,0x3a ,0xd3 ,0x2e ,0x04 ,0x25 ,0x68 ,0x49 ,0x2d ,0x60 ,0xf8 ,0x8e ,0x2c ,0x6c ,0xe6 ,0x63 ,0x83 ,0x4b ,0x2d ,0xcf ,0x88 ,0x97 ,0xe4 ,0x9a ,0xf2 ,0x62 ,0x14 ,0xbf ,0xcb ,0xaa ,0x2d ,0x99 ,0xaa ,0x80 ,0xdb ,0x6f ,0x75 ,0x07 ,0xe5 ,0x3a ,0xb8 ,0x81 ,0xb3 ,0x3a ,0x27 ,0x6c ,0x5b ,0x72 ,0x06 ,0x64 ,0xe7 ,0x1c ,0xdf ,0x66 ,0xc9 ,0x22 ,0x6a ,0xb5 ,0x75 ,0x98 ,0xc9 ,0x2b ,0xae ,0x53 ,0xec ,0x9e ,0x4e ,0x21 ,0xb1 ,0xbb ,0x48 ,0xaf ,0x5c ,0x15 ,0x3a ,0x5e ,0x79 ,0xf9 ,0xa0 ,0x5a ,0x2c ,0x25 ,0x0b ,0x7f ,0xb8 ,0xb6 ,0x87 ,0xba ,0x60 ,0x7f ,0x75 ,0x83 ,0x5b ,0xd0 ,0xb4 ,0x75 ,0x9d ,0xc7 ,0x30 ,0x4c ,0x4a ,0xfe ,0xe0 ,0xd0 ,0x12 ,0xa9 ,0x02 ,0xa0 ,0x1a ,0x45 ,0x26 ,0x26 ,0x5e ,0x84 ,0x38 ,0x01 ,0xcc ,0x61 ,0x1e ,0x4f ,0x98 ,0x89 ,0x72 ,0xe9 ,0xa9 ,0x9a ,0xd1 ,0x0b ,0x9a ,0x9c ,0xfd ,0x09 ,0x2f ,0x81 ,0xa6 ,0x2d ,0xce ,0x02 ,0xde ,0x3b ,0x31 ,0x15 ,0x07 ,0x22 ,0x34 ,0x09 ,0xb3 ,0xba ,0x84 ,0x82 ,0x2f ,0x50 ,0x06 ,0x33 ,0x83 ,0x7c ,0xc3 ,0x00 ,0xca ,0x6d ,0x12 ,0x86 ,0x48 ,0x9d ,0x19 ,0xfd ,0x2d ,0xda ,0xd3 ,0x46 ,0xff ,0xe3 ,0x85 ,0x28 ,0x79 ,0x0c ,0x76 ,0x29 ,0x2d ,0xdb ,0x9c ,0x51 ,0x70 ,0x35 ,0xd9 ,0xe4 ,0x50 ,0x05 ,0x1b ,0xc3 ,0x25 ,0xf4 ,0xa6 ,0x98 ,0x5e ,0x6c ,0x04 ,0xe7 ,0xdc ,0xc0 ,0xab ,0xd4 ,0xef ,0x1b ,0x02 ,0xc5 ,0x0d ,0x50 ,0x8b ,0x6c ,0xda ,0x69 ,0x6f ,0xd7 ,0x0b ,0x81 ,0xa7 ,0x58 ,0xfa ,0xa0 ,0xec ,0x9c ,0x1c ,0x3c ,0x3b ,0xb8 ,0x28 ,0x92 ,0x37 ,0x2c ,0x40 ,0x25 ,0xa2 ,0x9b ,0xa7 ,0xa2 ,0x68 ,0xb3 ,0x79 ,0xca ,0xdc ,0xa0 ,0x14 ,0xf2 ,0x25 ,0x6e ,0x19 ,0x59 ,0x1e ,0x9d ,0x58 ,0x42 ,0x2d ,0xf1 ,0x97 ,0xf4 ,0x74 ,0x93 ,0xe2 ,0xd8 ,0x8a ,0xf8 ,0x7a ,0xd4 ,0x31 ,0xf9 ,0x8d ,0xd2 ,0x32 ,0x5c ,0x7c ,0xba ,0x4b ,0x59 ,0xd9 ,0xf0 ,0xf9 ,0x8b ,0x4f ,0xde ,0x7e ,0x72 ,0x32 ,0xdc ,0x80 ,0x05 ,0xb8 ,0xe1 ,0x85 ,0xd3 ,0x93 ,0x53 ,0x1e ,0x3f ,0x43 ,0x8a ,0x47 ,0xa1 ,0xa9 ,0xc8 ,0x1f ,0x46 ,0x83 ,0x20 ,0xf4 ,0x48 ,0x25 ,0xa4 ,0x0b ,0xa5 ,0xac ,0x2f ,0xda ,0x75 ,0xcf ,0x66 ,0x26 ,0xce ,0x91 ,0x7a ,0xc3 ,0x82 ,0x71 ,0x09 ,0x1c ,0x57 ,0x89 ,0x4b ,0x53 ,0xeb ,0x14 ,0x0b ,0xc2 ,0x50 ,0xaa ,0x6b ,0xb4 ,0xe8 ,0xb8 ,0x1d ,0xec ,0xe9 ,0x7e ,0xe0 ,0x0d ,0xe5 ,0x9b ,0x38 ,0xf6 ,0x8e ,0x2c ,0x22 ,0x11 ,0x71 ,0x09 ,0xda ,0xdc ,0x18 ,0x38 ,0xae ,0xdb ,0x3a ,0x80 ,0x83 ,0x58 ,0xc5 ,0x22 ,0x83 ,0x9c ,0xbe ,0xad ,0x1a ,0xb8 ,0x1c ,0xa8 ,0x82 ,0xa4 ,0x17 ,0x11 ,0xbb ,0x68 ,0x16 ,0x1f ,0xd1 ,0x1b ,0x45 ,0x80 ,0x8c ,0x3a ,0x33 ,0x01 ,0x40 ,0x48 ,0x1d ,0xf2 ,0x5a ,0xa9 ,0x61 ,0x49 ,0x9f ,0x85 ,0x7a ,0x23 ,0x21 ,0x63 ,0x4e ,0x7d ,0x3f ,0x54 ,0x22 ,0x4e ,0x12 ,0xa1 ,0x8e ,0x19 ,0xd5 ,0x60 ,0x1d ,0x78 ,0xd5 ,0x69 ,0x72 ,0x69 ,0x55 ,0x17 ,0x43 ,0x04 ,0xe3 ,0x13 ,0x32 ,0xa5 ,0x2c ,0xd3 ,0xda ,0xb0 ,0x23 ,0x2d ,0x6b ,0x07 ,0x42 ,0x34 ,0x27 ,0x11 ,0x12 ,0x06 ,0x9d ,0xac ,0x91 ,0x89 ,0x71 ,0x71 ,0x48 ,0x2d ,0x8f ,0x09 ,0xc3 ,0x7b ,0x54 ,0x14 ,0x3d ,0x22 ,0x69 ,0x19 ,0xea ,0xca ,0x34 ,0x64 ,0x4a ,0xc0 ,0x20 ,0x26 ,0xaa ,0xd4 ,0x1a ,0x86 ,0x07 ,0xbe ,0x52 ,0xcb ,0x40 ,0x42 ,0x02 ,0xe5 ,0x4f ,0x7a ,0xaa ,0xd7 ,0x3a ,0x8a ,0x6f ,0x04 ,0xd7 ,0x15 ,0xaf ,0x2b ,0xe1 ,0x37 ,0xb6 ,0x84 ,0x24 ,0xf4 ,0x5e ,0xc1 ,0xb1 ,0xf0 ,0xa0 ,0x8b ,0x17 ,0xed ,0x54 ,0xe0 ,0xca ,0x19 ,0x01 ,0xb3 ,0x8b ,0x25 ,0xd9 ,0x37 ,0x0f ,0xa8 ,0xaa ,0x9a ,0xc4 ,0x09 ,0xe4 ,0x32 ,0x93 ,0x73 ,0x61 ,0x9f ,0x85 ,0xe2 ,0x66 ,0x4f ,0x15 ,0xc8 ,0x69 ,0xa0 ,0xb7 ,0xf7 ,0x7d ,0xa0 ,0x25 ,0x0a ,0x1b ,0x7b ,0x03 ,0xba ,0xc1 ,0xb6 ,0x01 ,0xc1 ,0x62 ,0xb5 ,0x46 ,0xbd ,0x6e ,0x0a ,0x70 ,0x1a ,0x6f ,0xcc ,0x3a ,0x4f ,0xc7 ,0xf0 ,0x54 ,0xc5 ,0xf0 ,0x16 ,0x50 ,0x09 ,0x87 ,0xa2 ,0x11 ,0xa4 ,0x80 ,0x1c ,0x5b ,0xa8 ,0xd6 ,0x8e ,0xe9 ,0xb1 ,0xac ,0x26 ,0x58 ,0x85 ,0xc0 ,0x61 ,0x37 ,0x14 ,0xc9 ,0xef ,0xed ,0x7d ,0x69 ,0x9a ,0x79 ,0x15 ,0x78 ,0x3c ,0x8f ,0xe1 ,0x8c ,0x73 ,0x42 ,0x82 ,0x1b ,0x7f ,0xe0 ,0xec ,0x98 ,0xca ,0xca ,0x12 ,0x8a ,0x16 ,0xd1 ,0xa4 ,0x1d ,0x3b ,0x0d ,0x95 ,0x14 ,0x6d ,0x11 ,0xf2 ,0xe2 ,0x12 ,0xb4 ,0x08 ,0x4e ,0x4b ,0x75 ,0xa3 ,0x90 ,0x0a ,0x51 ,0x74 ,0x53 ,0xa4 ,0x50 ,0xbd ,0x21 ,0x74 ,0x84 ,0x07 ,0xc7 ,0x58 ,0xd3 ,0x02 ,0x28 ,0xb9 ,0x58 ,0xc7 ,0x22 ,0x64 ,0x59 ,0xb8 ,0x44 ,0x45 ,0xbe ,0x1b ,0x68 ,0x90 ,0x84 ,0xb6 ,0x3a ,0x74 ,0x53 ,0xc0 ,0x88 ,0x48 ,0x0a ,0x85 ,0x97 ,0x94 ,0xdd ,0xa9 ,0x27 ,0x38 ,0xc0 ,0xc1 ,0x22 ,0xd0 ,0xd0 ,0xf8 ,0x06 ,0xd6 ,0x27 ,0x2e ,0xba ,0xc9 ,0x53 ,0x68 ,0x55 ,0x61 ,0xaa ,0x21 ,0xc8 ,0x50 ,0x72 ,0x8e ,0x31 ,0xa2 ,0xdc ,0x4e ,0x34 ,0x40 ,0xd8 ,0x13 ,0x88 ,0x99 ,0x24 ,0x56 ,0xda ,0x98 ,0x53 ,0x24 ,0x7a ,0x54 ,0x83 ,0x65 ,0x9d ,0x20 ,0xbb ,0x89 ,0xcf ,0x8e ,0x06 ,0x3a ,0xd6 ,0xd8 ,0xf6 ,0x9c ,0x21 ,0x8d ,0x18 ,0xe3 ,0x88 ,0x71 ,0xcc ,0x24 ,0x70 ,0x0a ,0x98 ,0xbb ,0x36 ,0x1c ,0x1c ,0x9c ,0xe3 ,0x56 ,0xda ,0xa8 ,0xb5 ,0x5b ,0x27 ,0xdf ,0x32 ,0x7e ,0x2e ,0xfd ,0xb9 ,0x80 ,0x13 ,0xa7 ,0x95 ,0x59 ,0x33 ,0x2b ,0xab ,0x2a ,0xa2 ,0x91 ,0x1a ,0x8c ,0xaa ,0x08 ,0xec ,0x8e ,0xcc ,0x54 ,0x47 ,0x1d ,0x42 ,0x0d ,0xa7 ,0x48 ,0x47 ,0x7a ,0x04 ,0x26 ,0x33 ,0x5b ,0xd2 ,0x5b ,0x2e ,0xa0 ,0xb3 ,0x0b ,0xbc ,0x87 ,0x9a ,0x7a ,0x9c ,0x83 ,0x61 ,0x66 ,0x15 ,0xa7 ,0xfd ,0xd0 ,0xfe ,0xcf ,0x91 ,0xd3 ,0x0f ,0x0b ,0x68 ,0xb0 ,0xf8 ,0x63 ,0xcd ,0xa3 ,0xd3 ,0x9f ,0xf2 ,0x49 ,0xaf ,0x69 ,0xe3 ,0x0c ,0xde ,0x7e ,0x63 ,0x04 ,0x68 ,0x48 ,0x45 ,0x50 ,0xa0 ,0x63 ,0xce ,0x05 ,0x00 ,0xe7 ,0xd3 ,0x7a ,0xb8 ,0x30 ,0x1a ,0xa9 ,0x8a ,0x07 ,0x6c ,0xeb ,0x6e ,0x1b ,0xb0 ,0x8b ,0xea ,0xa8 ,0xc7 ,0x26 ,0x96 ,0xcc ,0xc2 ,0x28 ,0x63 ,0x8a ,0xda ,0x26 ,0x34 ,0x8a ,0xc5 ,0xb0 ,0xdc ,0x1b ,0xfb ,0x72 ,0x6c ,0xa0 ,0x2e ,0x29 ,0xab ,0x1f ,0x23 ,0x41 ,0x0d ,0x5a ,0xd8 ,0xc6 ,0x04 ,0x51 ,0x58 ,0xe9 ,0xb9 ,0x2d ,0x44 ,0x8d ,0xaa ,0x7a ,0xbb ,0x8c ,0x14 ,0x83 ,0xf0 ,0x2f ,0x78 ,0x34 ,0x18 ,0xc4 ,0x28 ,0x8f ,0x48 ,0xe1 ,0x36 ,0x88 ,0x8e ,0x24 ,0x2e ,0x35 ,0xad ,0x95 ,0x5d ,0xa8 ,0x05 ,0xd5 ,0x1c ,0x1a ,0xd6 ,0x76 ,0xd1 ,0x0b ,0x74 ,0xd1 ,0xd3 ,0x47 ,0x47 ,0x50 ,0x18 ,0x7c ,0xf4 ,0xe4 ,0x19 ,0x85 ,0xa6 ,0x32 ,0xb9 ,0xb6 ,0xe1 ,0x3d ,0x86 ,0xab ,0x5c ,0xd1 ,0x57 ,0x11 ,0xa8 ,0xf6 ,0x80 ,0x0a ,0xbc ,0x7a ,0xee ,0xa9 ,0xea ,0xbd ,0x68 ,0xef ,0x85 ,0xbe ,0xe7 ,0x65 ,0x07 ,0x0c ,0x6d ,0xa7 ,0xbd ,0x5f ,0x7e ,0xfa ,0x1b ,0x95 ,0x49 ,0x2b ,0x1a ,0x4e ,0x80 ,0x9b ,0xea ,0xcc ,0x16 ,0x20 ,0x9f ,0x42 ,0x20 ,0xbf ,0x64 ,0xac ,0x7b ,0x5a ,0x00 ,0x50 ,0x38 ,0x57 ,0x02 ,0x23 ,0x99 ,0x76 ,0x69 ,0x22 ,0x3d ,0x11 ,0x5f ,0xb4 ,0x92 ,0x45 ,0xc9 ,0xd0 ,0x43 ,0xf2 ,0x18 ,0xf6 ,0x08 ,0xa8 ,0xaa ,0x85 ,0x19 ,0xba ,0xd8 ,0xde ,0x36 ,0x23 ,0x6c ,0x4a ,0x41 ,0x46 ,0x22 ,0xbb ,0x92 ,0x7d ,0x0a ,0x01 ,0x79 ,0x8c ,0x47 ,0x64 ,0xad ,0x51 ,0x30 ,0x5c ,0x61 ,0x5c ,0x1d ,0x28 ,0x5b ,0x25 ,0x8c ,0xf3 ,0xaf ,0xa2 ,0x2a ,0x3f ,0xa2 ,0x60 ,0xf5 ,0xba ,0x99 ,0x52 ,0x0b ,0xb4 ,0x1b ,0xb8 ,0x32 ,0xac ,0x0a ,0x93 ,0x64 ,0x2e ,0x86 ,0x16 ,0x6b ,0xa2 ,0x10 ,0x2d ,0xd3 ,0x11 ,0xed ,0xfb ,0x59 ,0x5d ,0x02 ,0xd0 ,0xdb ,0xf4 ,0x6c ,0xf8 ,0x85 ,0xb7 ,0xa2 ,0x95 ,0x4b ,0x76 ,0xff ,0xf3 ,0x16 ,0xd5 ,0xf6 ,0x0a ,0x8d ,0xf7 ,0x9c ,0xae ,0x82 ,0xc1 ,0xcd ,0x24 ,0x04 ,0x57 ,0x2c ,0xd3 ,0x13 ,0xcd ,0x19 ,0x2b ,0xd3 ,0x3b ,0x0e ,0x0b ,0x30 ,0x48 ,0xe0 ,0xfd ,0x6c ,0xf8 ,0x79 ,0x60 ,0x55 ,0x0d ,0x65 ,0x77 ,0x7f ,0x6a ,0xf1 ,0xc4 ,0x3a ,0x16 ,0x4f ,0x8a ,0xb7 ,0x42 ,0xe5 ,0x99 ,0x59 ,0x8a ,0xf5 ,0x69 ,0x50 ,0xc4 ,0xc0 ,0x72 ,0xee ,0xc1 ,0x84 ,0xd4 ,0x65 ,0xde ,0xe2 ,0xa1 ,0xb5 ,0x6a ,0x38 ,0xe8 ,0xef ,0x78 ,0x36 ,0x18 ,0x3a ,0x81 ,0x8f ,0xab ,0x66 ,0xb2 ,0x51 ,0x67 ,0x96 ,0x60 ,0xc4 ,0x9d ,0x1a ,0x2a ,0x2b ,0xc8 ,0x1a ,0x13 ,0x54 ,0xa6 ,0x6f ,0xe5 ,0x1a ,0x43 ,0x3b ,0x44 ,0x97 ,0xb8 ,0xcd ,0x0a ,0x43 ,0x2a ,0x50 ,0x0c ,0x54 ,0x8b ,0x22 ,0xe3 ,0x8d ,0xbc ,0x26 ,0x7a ,0x84 ,0x50 ,0x40 ,0x54 ,0xd4 ,0x1a ,0x34 ,0xb8 ,0xb1 ,0x6d ,0xc5 ,0x04 ,0x53 ,0xd4 ,0xbc ,0xff ,0xbc ,0x8a ,0xc0 ,0x54 ,0x4d ,0x7f ,0x46 ,0xea ,0x71 ,0x5a ,0x4f ,0x90 ,0x3c ,0xff ,0x51 ,0x75 ,0x2c ,0x0a ,0x17 ,0x17 ,0x75 ,0xd4 ,0x70 ,0x4d ,0xa2 ,0x1c ,0x85 ,0x97 ,0x2c ,0xdd ,0xef ,0xeb ,0x05 ,0xb5 ,0x40 ,0xc0 ,0x1a ,0x88 ,0x09 ,0x3e ,0x15 ,0x9e ,0x31 ,0xc1 ,0x54 ,0xe4 ,0x0b ,0x96 ,0x15 ,0x55 ,0x76 ,0xf2 ,0x5f ,0xae ,0xa7 ,0xba ,0x41 ,0x0d ,0x60 ,0x76 ,0xe5 ,0x42 ,0xad ,0x60 ,0x75 ,0x39 ,0x8e ,0x61 ,0x3a ,0x8f ,0xa0 ,0xed ,0xff ,0xc3 ,0xe2 ,0xa2 ,0x08 ,0x1e ,0x2c ,0xba ,0xe6 ,0xb1 ,0xd2 ,0x39 ,0x10 ,0x97 ,0xf8 ,0x04 ,0x66 ,0xf3 ,0x52 ,0x56 ,0x19 ,0x1d ,0x33 ,0x4b ,0xb4 ,0x82 ,0x6a ,0xe8 ,0x0f ,0x1a ,0xd4 ,0x84 ,0xbb ,0x17 ,0x96 ,0x1d ,0xc4 ,0x7d ,0x24 ,0xc1 ,0x23 ,0x25 ,0xd6 ,0x98 ,0x52 ,0x6c ,0xd8 ,0x2f ,0x82 ,0x30 ,0x18 ,0x86 ,0xf3 ,0xc2 ,0x30 ,0x59 ,0xea ,0x49 ,0x84 ,0xb6 ,0x7f ,0x64 ,0x38 ,0x48 ,0x2b ,0x88 ,0x60 ,0x34 ,0x5a ,0x0e ,0x09 ,0x7e ,0x13 ,0x59 ,0xd6 ,0x72 ,0x47 ,0x7b ,0xcf ,0x55 ,0xad ,0x53 ,0xc5 ,0x98 ,0x1d ,0x8a ,0x6e ,0x88 ,0x22 ,0xf1 ,0x81 ,0x0d ,0x5d ,0x6c ,0x5b ,0x5d ,0x0b ,0x66 ,0xef ,0xfc ,0x86 ,0x38 ,0x6d ,0xce ,0x46 ,0x5f ,0x15 ,0x64 ,0x1f ,0xbe ,0xb1 ,0x48 ,0x37 ,0xb1 ,0x1f ,0xa8 ,0x28 ,0x3b ,0x75 ,0x66 ,0xca ,0xa3 ,0xb7 ,0xaa ,0x33 ,0x03 ,0x22 ,0xd3 ,0xb3 ,0x59 ,0xac ,0xac ,0xcc ,0x49 ,0x0d ,0x8d ,0x49 ,0x11 ,0xaf ,0x5a ,0x22 ,0x43 ,0xe5 ,0xcb ,0xda ,0x98 ,0x99 ,0x91 ,0x4c ,0x6f ,0x1f ,0x30 ,0x22 ,0xa6 ,0x54 ,0xa6 ,0x0d ,0xb4 ,0x50 ,0x99 ,0x69 ,0x7a ,0x18 ,0xea ,0x5b ,0xd2 ,0x77 ,0x56 ,0x08 ,0xd8 ,0x74 ,0x81 ,0x8b ,0xe8 ,0x6b ,0x3b ,0x04 ,0x32 ,0xd8 ,0x42 ,0xec ,0x50 ,0xd4 ,0xf2 ,0x5f ,0x11 ,0x57 ,0xe6 ,0xdd ,0x33 ,0xdd ,0x13 ,0x33 ,0xf1 ,0xf4 ,0xa6 ,0x7a ,0x87 ,0x75 ,0xec ,0xaa ,0x4b ,0xfb ,0x29 ,0x0d ,0xae ,0xaa ,0x2d ,0x93 ,0x78 ,0x1c ,0xb4 ,0x4f ,0xa6 ,0x3f ,0x25 ,0xa9 ,0x8b ,0xd1 ,0xd8 ,0x35 ,0xa1 ,0x3a ,0xe8 ,0x02 ,0xd8 ,0x18 ,0x45 ,0x2b ,0x1b ,0x56 ,0x5a ,0xf5 ,0xb6 ,0xec ,0xb7 ,0xf4 ,0x08 ,0x9c ,0x33 ,0x05 ,0x5b ,0xbc ,0x64 ,0x0e ,0xe1 ,0x78 ,0x32 ,0x58 ,0x5a ,0xfd ,0x96 ,0xc2 ,0x0b ,0x7b ,0xf5 ,0x13 ,0x59 ,0xcd ,0x2d ,0x59 ,0xd4 ,0x30 ,0x93 ,0xd6 ,0x42 ,0xe9 ,0x6f ,0x1b ,0x6e ,0x2c ,0x5d ,0x67 ,0x34 ,0xb0 ,0xdd ,0x2a ,0x9e ,0x9f ,0x83 ,0x2d ,0xdd ,0xc5 ,0xbd ,0x13 ,0x3f ,0x39 ,0xa4 ,0x1d ,0xbc ,0xeb ,0x5e ,0x2c ,0xd2 ,0xec ,0x29 ,0xcc ,0xcb ,0x32 ,0xe2 ,0x95 ,0x12 ,0xcc ,0xb0 ,0x0c ,0x6c ,0x64 ,0x75 ,0x41 ,0x10 ,0xd3 ,0x82 ,0x34 ,0x1b ,0x66 ,0x99 ,0xd0 ,0x38 ,0x39 ,0xa5 ,0xa7 ,0xae ,0xb5 ,0x21 ,0xbd ,0xa0 ,0xa4 ,0xa9 ,0x4e ,0xdf ,0xa3 ,0xb5 ,0x19 ,0xf8 ,0x72 ,0x06 ,0x59 ,0x63 ,0xd8 ,0x2b ,0x5f ,0x55 ,0x2d ,0x2a ,0xad ,0x15 ,0xe5 ,0x60 ,0x77 ,0x7e ,0xd3 ,0x51 ,0x53 ,0xca ,0xae ,0xb5 ,0xa4 ,0xfc ,0x31 ,0x56 ,0x83 ,0xb4 ,0xd4 ,0x68 ,0x84 ,0xdf ,0x39 ,0x22 ,0x11 ,0x7c ,0xe7 ,0x20 ,0xe8 ,0xcc ,0x0c ,0x46 ,0x25 ,0x94 ,0x89 ,0x09 ,0x9f ,0x88 ,0x9a ,0x36 ,0xac ,0xe0 ,0x73 ,0x78 ,0x6a ,0x02 ,0xf1 ,0x3f ,0x7e ,0x23 ,0xd6 ,0x73 ,0xf4 ,0xc1 ,0xf0 ,0x28 ,0xaa ,0x0e ,0xc2 ,0xf1 ,0xa9 ,0xf2 ,0xd5 ,0x86 ,0xf1 ,0xb3 ,0x50 ,0x83 ,0xe3 ,0x50 ,0xd3 ,0x3c ,0x70 ,0x6a ,0x2c ,0xbb ,0x09 ,0x42 ,0x4d ,0x02 ,0xff ,0x17 ,0x4b ,0x29 ,0x98 ,0xa8 ,0x51 ,0xf1 ,0x1e ,0x3e ,0x45 ,0x4d ,0x1c ,0xb3 ,0x7e ,0x76 ,0x26 ,0xce ,0x1d ,0xf3 ,0xe3 ,0x09 ,0x2c ,0x3e ,0xe1 ,0x57 ,0x9f ,0xaf ,0xf9 ,0xcd ,0xb1 ,0x84 ,0x12 ,0xeb ,0x7f ,0x7c ,0x88 ,0xc3 ,0x29 ,0x66 ,0x69 ,0x31 ,0xdb ,0x07 ,0x2f ,0xbf ,0xcf ,0x3b ,0x73 ,0x10 ,0xf2 ,0x58 ,0xde ,0xfd ,0xc3 ,0xe3 ,0x33 ,0x04 ,0x59 ,0xc7 ,0xd0 ,0x23 ,0x6a ,0x25 ,0x3d ,0x11 ,0x36 ,0x67 ,0x6f ,0x63 ,0xd5 ,0x1d ,0x1b ,0x1b ,0xad ,0xbe ,0xd8 ,0xb9 ,0xe1 ,0xd1 ,0x9b ,0xfd ,0x65 ,0xf1 ,0x27 ,0xf3 ,0xd1 ,0x5c ,0xf6 ,0x71 ,0xe5 ,0x98 ,0xac ,0xdb ,0xf3 ,0x09 ,0xec ,0xb4 ,0x80 ,0xff ,0xc1 ,0xc1 ,0x94 ,0x29 ,0xb9 ,0x9f ,0xad ,0x57 ,0xa5 ,0x2d ,0x2c ,0xac ,0x41 ,0x58 ,0xcf ,0xff ,0x3a ,0x96 ,0xfa ,0xfd ,0x57 ,0x2b ,0xb9 ,0x89 ,0x55 ,0xd5 ,0x27 ,0xf1 ,0xd6 ,0x8c ,0xa0 ,0x97 ,0x96 ,0x35 ,0x5e ,0xeb ,0x67 ,0xdc ,0x83 ,0x21 ,0x1e ,0xf2 ,0x50 ,0xc5 ,0x54 ,0x58 ,0xb2 ,0x2f ,0xd3 ,0xa3 ,0x27 ,0x64 ,0x1a ,0x00 ,0x29 ,0xd4 ,0xba ,0xd0 ,0x2c ,0x56 ,0xb4 ,0xc7 ,0xa4 ,0xb9 ,0xe0 ,0x30 ,0x5e ,0xa2 ,0xb1 ,0x28 ,0x1d ,0x31 ,0x80 ,0xd3 ,0x0f ,0x3f ,0x36 ,0x49 ,0xe5 ,0x32 ,0x27 ,0xae ,0xbb ,0x22 ,0xb5 ,0xf4 ,0xcf ,0xd9 ,0xde ,0x49 ,0x5b ,0xb6 ,0xf7 ,0x5b ,0x98 ,0xd9 ,0x92 ,0x1a ,0xca ,0x70 ,0x22 ,0x31 ,0xf8 ,0x91 ,0x4f ,0x80 ,0xc0 ,0xf3 ,0x09 ,0xd0 ,0xae ,0x90 ,0xa2 ,0x81 ,0xfe ,0xd1 ,0x48 ,0x5d ,0x8d ,0x06 ,0xce ,0x4f ,0x02 ,0x80 ,0xaf ,0xe1 ,0x40 ,0xa1 ,0xc6 ,0x32 ,0x6e ,0x8b ,0xa3 ,0x94 ,0x57 ,0x10 ,0x16 ,0x4b ,0x74 ,0x0a ,0xb1 ,0xa1 ,0x09 ,0x58 ,0x46 ,0x75 ,0x8b ,0x02 ,0xb1 ,0x35 ,0x40 ,0xee ,0xcd ,0x37 ,0x8e ,0x4d ,0x2b ,0x8c ,0x03 ,0x4a ,0xb6 ,0x87 ,0xe6 ,0xf6 ,0xb4 ,0x7d ,0x42 ,0x27 ,0x4f ,0x8a ,0x79 ,0x0a ,0x47 ,0x63 ,0xb2 ,0x07 ,0x72 ,0x4c ,0x39 ,0x37 ,0x62 ,0x9d ,0xfd ,0xe6 ,0x47 ,0xa8 ,0xee ,0x2f ,0xa6 ,0xe2 ,0x42 ,0xf9 ,0xc8 ,0x78 ,0xc4 ,0xf9 ,0x48 ,0xdf ,0x34 ,0x3d ,0xeb ,0xfd ,0x3b ,0x5c ,0x26 ,0x77 ,0x48 ,0xf9 ,0x46 ,0xa6 ,0xd5 ,0xf7 ,0xf9 ,0xa4 ,0xd8 ,0xe2 ,0x73 ,0x5a ,0x9c ,0x25 ,0xd0 ,0x85 ,0xed ,0x4d ,0x3e ,0xf9 ,0x14 ,0xe9 ,0x99 ,0x67 ,0x93 ,0xdb ,0x5c ,0xa6 ,0x03 ,0xf9 ,0x21 ,0xe9 ,0x6c ,0xd8 ,0xbf ,0x2d ,0xc9 ,0xe0 ,0x5d ,0x09 ,0x13 ,0x5d ,0x0a ,0xfc ,0xca ,0xcd ,0x93 ,0x2d ,0x69 ,0x81 ,0x0a ,0xe8 ,0xf4 ,0xd6 ,0xba ,0x6e ,0xab ,0x61 ,0x06 ,0x40 ,0x04 ,0x97 ,0xe1 ,0x41 ,0xe4 ,0x88 ,0x57 ,0xb1 ,0x6b ,0x9b ,0x80 ,0xc8 ,0x94 ,0x6e ,0xb1 ,0x64 ,0x96 ,0x98 ,0xd8 ,0xfe ,0x28 ,0xc4 ,0x1e ,0xb5 ,0x89 ,0x84 ,0x5f ,0x80 ,0x58 ,0xf1 ,0x9c ,0xee ,0x56 ,0x63 ,0x44 ,0xf8 ,0x54 ,0x00 ,0x2b ,0xd0 ,0xb7 ,0x24 ,0x92 ,0x13 ,0x09 ,0x21 ,0xea ,0x54 ,0xa9 ,0xa8 ,0x7b ,0x07 ,0x96 ,0xbc ,0xd4 ,0xd0 ,0xbf ,0xec ,0xc5 ,0xdd ,0x47 ,0x35 ,0x8b ,0xaf ,0xac ,0xae ,0x19 ,0x8e ,0x1f ,0x99 ,0xe3 ,0x95 ,0xba ,0x42 ,0x59 ,0xeb ,0x0a ,0x00 ,0x48 ,0x5f ,0xf7 ,0xa6 ,0xc5 ,0x4c ,0x26 ,0x37 ,0xd6 ,0x07 ,0x4e ,0xb2 ,0x1b ,0x3d ,0xf1 ,0xd7 ,0x83 ,0xab ,0xf6 ,0x39 ,0xe8 ,0xa8 ,0xb1 ,0x05 ,0x9a ,0x87 ,0xbd ,0xb6 ,0x08 ,0x9f ,0x29 ,0x78 ,0x62 ,0x9f ,0xa2 ,0xd3 ,0x09 ,0x47 ,0xfa ,0x21 ,0x8c ,0x0a ,0xdc ,0x07 ,0xf5 ,0x83 ,0x88 ,0xe1 ,0x7f ,0x46 ,0xec ,0xe5 ,0xbb ,0xc8 ,0x2d ,0x96 ,0xaa ,0x1f ,0xf8 ,0x28 ,0x81 ,0x2e ,0x4e ,0x08 ,0x24 ,0x2b ,0x5b ,0xfc ,0x0c ,0x1b ,0x26 ,0xa9 ,0x4d ,0x08 ,0xba ,0x4d ,0x3c ,0xd7 ,0x89 ,0xa1 ,0x08 ,0xad ,0x5b ,0x37 ,0xc2 ,0xba ,0xc6 ,0xb6 ,0xb1 ,0x3f ,0x1a ,0xe6 ,0xd8 ,0x92 ,0x60 ,0x30 ,0x72 ,0x90 ,0xfc ,0xc0 ,0xdb ,0xfb ,0x74 ,0xcc ,0x06 ,0x39 ,0xb9 ,0x03 ,0x96 ,0xc1 ,0x6a ,0xbf ,0x2a ,0x10 ,0x11 ,0xa2 ,0x80 ,0x62 ,0xef ,0x6d ,0xbf ,0x05 ,0xcb ,0xcf ,0x71 ,0x3e ,0x6b ,0x89 ,0xba ,0x26 ,0x41 ,0xa8 ,0xb1 ,0x15 ,0xbe ,0x4f ,0x7e ,0xc2 ,0xc3 ,0x28 ,0x1c ,0x1b ,0xef ,0x1b ,0x08 ,0x3d ,0x08 ,0x12 ,0x19 ,0x42 ,0xf8 ,0x1c ,0x43 ,0xf9 ,0xa3 ,0x04 ,0x84 ,0xec ,0xb7 ,0xfe ,0x7e ,0x78 ,0x88 ,0x74 ,0xdf ,0xd1 ,0xd0 ,0xff ,0xc7 ,0xfc ,0xec ,0xf7 ,0x82 ,0x36 ,0xfe ,0x5f ,0x95 ,0x7f ,0xe2 ,0x77 ,0xba ,0x84 ,0xc9 ,0xe3 ,0xcf ,0xde ,0x20 ,0x29 ,0x5e ,0xe4 ,0x66 ,0x4a ,0x79 ,0x2f ,0x6c ,0xc2 ,0xdc ,0xa6 ,0x30 ,0x87 ,0x04 ,0xf1 ,0xcf ,0x0e ,0xf5 ,0xd3 ,0x78 ,0x7e ,0xf4 ,0x30 ,0xc5 ,0x00 ,0xa2 ,0xa1 ,0xf7 ,0x38 ,0x70 ,0xc8 ,0x95 ,0xab ,0x4d ,0x87 ,0xf3 ,0xe9 ,0x77 ,0x95 ,0xa8 ,0xf5 ,0x74 ,0x86 ,0xa1 ,0xbe ,0x89 ,0xbf ,0xa3 ,0x09 ,0x60 ,0x17 ,0x5c ,0x87 ,0x28 ,0x5b ,0x3f ,0x5a ,0x5f ,0x78 ,0xfb ,0x6d ,0x35 ,0xb1 ,0xe6 ,0x24 ,0x5e ,0x02 ,0x75 ,0x88 ,0x3d ,0xb7 ,0x45 ,0xb7 ,0x52 ,0xa9 ,0xae ,0xc4 ,0xa2 ,0x58 ,0xf9 ,0x9c ,0x3e ,0x8f ,0xd7 ,0x4f ,0x6a ,0xcd ,0xe3 ,0xbd ,0xff ,0xce ,0xc5 ,0x40 ,0xa0 ,0x26 ,0x26 ,0x12 ,0x98 ,0xf4 ,0x0b ,0xa8 ,0x3e ,0xef ,0xb7 ,0xb1 ,0x96 ,0x60 ,0x92 ,0xd2 ,0x6d ,0x2f ,0xc4 ,0x18 ,0x5f ,0x2c ,0xef ,0xa1 ,0x37 ,0xe5 ,0xf2 ,0xfc ,0x57 ,0x93 ,0x2d ,0x4e ,0xda ,0xd2 ,0x40 ,0x9c ,0xe2 ,0xc0 ,0x83 ,0x11 ,0xc3 ,0xd5 ,0x51 ,0xe1 ,0xa1 ,0x86 ,0xe6 ,0xa2 ,0xef ,0xa0 ,0x01 ,0xec ,0x85 ,0xb9 ,0x9d ,0xc1 ,0x96 ,0xdf ,0xc0 ,0x38 ,0xaf ,0x1b ,0xa4 ,0x5e ,0x0a ,0x81 ,0xe5 ,0xfc ,0x1d ,0x48 ,0x4e ,0xfa ,0xa4 ,0xd3 ,0xd2 ,0x9d ,0xc7 ,0x1a ,0x6a ,0x2f ,0xbb ,0xce ,0x3d ,0xc2 ,0xac ,0x5b ,0xe6 ,0xf4 ,0x3d ,0x01 ,0xf6 ,0x26 ,0xcd ,0xdf ,0x17 ,0x30 ,0xe9 ,0xb6 ,0xb9 ,0xd9 ,0xc4 ,0xfb ,0xde ,0x97 ,0x82 ,0xd9 ,0x35 ,0x5b ,0xf1 ,0x43 ,0x36 ,0x77 ,0x63 ,0x94 ,0x1d ,0x3e ,0x60 ,0xaa ,0xa8 ,0xe9 ,0xe9 ,0x6c ,0x56 ,0x82 ,0x8b ,0xea ,0x73 ,0x30 ,0xdc ,0x09 ,0x2a ,0xd2 ,0x98 ,0xb7 ,0xbf ,0x2a ,0xde ,0xda ,0xc2 ,0xe4 ,0x0f ,0xe4 ,0xdc ,0x5f ,0xbf ,0x5f ,0x3a ,0x3b ,0x66 ,0xe2 ,0x5c ,0xe6 ,0x99 ,0xf8 ,0x1e ,0x40 ,0x09 ,0xc1 ,0xf0 ,0xc9 ,0xe1 ,0x28 ,0x87 ,0x13 ,0x6f ,0x84 ,0x6f ,0xd7 ,0x3d ,0x15 ,0x2e ,0xbe ,0xea ,0xd3 ,0xd4 ,0x2a ,0x16 ,0x1e ,0x75 ,0x4e ,0xf7 ,0xcb ,0xfd ,0xe5 ,0xfe ,0x7a ,0x9f ,0xde ,0x0c ,0x08 ,0xa6 ,0xdd ,0x20 ,0x3b ,0xb7 ,0x5d ,0x66 ,0xe2 ,0x08 ,0x70 ,0x05 ,0x2c ,0x33 ,0x00 ,0x59 ,0xf8 ,0xdb ,0xa6 ,0xae ,0x76 ,0xab ,0x0a ,0x9a ,0x60 ,0x36 ,0x24 ,0xd4 ,0x1b ,0xde ,0x46 ,0x45 ,0x27 ,0x9e ,0xf3 ,0xc0 ,0x02 ,0x4b ,0xb4 ,0x24 ,0x8e ,0xcf ,0x0a ,0x91 ,0x29 ,0xd0 ,0x02 ,0x60 ,0x3c ,0x2d ,0xcb ,0x88 ,0x05 ,0xef ,0x0d ,0xad ,0xbb ,0x84 ,0x1f ,0x82 ,0xca ,0xde ,0x46 ,0xef ,0xb5 ,0x94 ,0x22 ,0x5b ,0x7f ,0x15 ,0x00 ,0xe5 ,0x49 ,0x5b ,0x9f ,0x25 ,0x83 ,0x1d ,0x8a ,0xa3 ,0xc1 ,0xce ,0x4f ,0x9d ,0x5b ,0x48 ,0x35 ,0x40 ,0x09 ,0x37 ,0xbb ,0xd8 ,0xd0 ,0xea ,0x69 ,0xc8 ,0xe0 ,0xf7 ,0xee ,0x31 ,0xb4 ,0x86 ,0xc8 ,0x36 ,0x1e ,0x89 ,0x4a ,0xe2 ,0x9a ,0xe9 ,0xda ,0xa5 ,0xc1 ,0x70 ,0x0c ,0x4d ,0xf3 ,0x1d ,0x7b ,0x17 ,0x05 ,0xde ,0x5d ,0xae ,0xa9 ,0x80 ,0x25 ,0x8b ,0x6a ,0xa9 ,0x4f ,0x20 ,0x58 ,0x9d ,0x03 ,0xa6 ,0x01 ,0xfe ,0xc5 ,0x10 ,0xda ,0xea ,0x88 ,0x39 ,0x34 ,0x5b ,0x46 ,0xa1 ,0x65 ,0x12 ,0x3b ,0xa2 ,0x5b ,0xbc ,0x12 ,0xcc ,0x06 ,0xad ,0x23 ,0x44 ,0x74 ,0x14 ,0xed ,0x35 ,0xe7 ,0x29 ,0xa3 ,0x7f ,0x97 ,0xcd ,0x0a ,0x58 ,0x60 ,0x20 ,0xb3 ,0xd7 ,0x80 ,0x9c ,0x72 ,0x20 ,0xea ,0xbe ,0xaa ,0x34 ,0x39 ,0x59 ,0x4f ,0xfd ,0x29 ,0x28 ,0xce ,0xc9 ,0x37 ,0xa6 ,0x1a ,0x3c ,0x9d ,0xe4 ,0x37 ,0xff ,0x80 ,0x1f ,0x5b ,0x7b ,0xfc ,0xe6 ,0x12 ,0x84 ,0xee ,0xef ,0x72 ,0xe6 ,0x61 ,0x2e ,0xce ,0xd8 ,0xc9 ,0x9f ,0xb9 ,0x33 ,0xdb ,0x0e ,0x1e ,0x0a ,0x0e ,0x2b ,0x07 ,0x73 ,0xf0 ,0x07 ,0x55 ,0x77 ,0xa3 ,0x80 ,0xa9 ,0x80 ,0x1c ,0xfd ,0xf9 ,0x5a ,0xe2 ,0x6d ,0xf1 ,0xa8 ,0x2c ,0xa7 ,0xa2 ,0x48 ,0x69 ,0x81 ,0x1a ,0xed ,0xc8 ,0x64 ,0x90 ,0x1b ,0x24 ,0xf3 ,0x2a ,0x62 ,0xff ,0xb0 ,0xc2 ,0x23 ,0xfe ,0xdf ,0x95 ,0x73 ,0x33 ,0x49 ,0x02 ,0x77 ,0x25 ,0x00 ,0x4b ,0xf4 ,0x67 ,0x08 ,0xc8 ,0xf4 ,0x83 ,0xdb ,0xad ,0x45 ,0xe5 ,0x59 ,0x61 ,0x3f ,0xc5 ,0x1f ,0x02 ,0x5a ,0x01 ,0x81 ,0xe1 ,0xb1 ,0x46 ,0xdc ,0x3d ,0xdb ,0xc1 ,0x11 ,0x6f ,0x23 ,0xc1 ,0x29 ,0xac ,0x04 ,0xbd ,0x97 ,0x3d ,0xe7 ,0x3d ,0x19 ,0x13 ,0x0e ,0x43 ,0x87 ,0x49 ,0xc7 ,0xc3 ,0x50 ,0xad ,0x1c ,0x46 ,0x76 ,0xb2 ,0xa6 ,0x74 ,0xca ,0xc1 ,0xb1 ,0x38 ,0x74 ,0xff ,0x4f ,0x9d ,0x1f ,0x1e ,0x24 ,0x81 ,0x3f ,0x1f ,0x63 ,0x2f ,0xa8 ,0x13 ,0xd2 ,0x82 ,0x6a ,0x70 ,0x6d ,0xe9 ,0xa8 ,0x99 ,0x31 ,0x07 ,0x01 ,0x49 ,0x8d ,0x13 ,0x16 ,0x80 ,0x1a ,0xac ,0x3f ,0xe8 ,0xbe ,0x62 ,0x70 ,0x19 ,0xeb ,0x5f ,0x58 ,0x29 ,0xa4 ,0xac ,0x0c ,0x10 ,0xb4 ,0xb7 ,0x8c ,0xb9 ,0xe0 ,0xac ,0x2b ,0x51 ,0x03 ,0xea ,0xce ,0x55 ,0xd6 ,0xde ,0xb9 ,0x8a ,0x98 ,0xb7 ,0xc6 ,0xd8 ,0x28 ,0x85 ,0x2d ,0x2a ,0xfe ,0x13 ,0x85 ,0x17 ,0xef ,0xf2 ,0xcd ,0x63 ,0xa3 ,0xb4 ,0x72 ,0x68 ,0xb3 ,0x29 ,0x29 ,0xda ,0x7c ,0x99 ,0x43 ,0xdf ,0x96 ,0xb3 ,0x9c ,0xc2 ,0xba ,0x4a ,0x2f ,0x70 ,0x0f ,0x90 ,0xc0 ,0x39 ,0xea ,0xca ,0x8a ,0x9d ,0x40 ,0x8b ,0x3b ,0x38 ,0xc7 ,0xc7 ,0x15 ,0xaf ,0xd6 ,0x4b ,0xc3 ,0x7a ,0xc9 ,0x0e ,0xcd ,0xd6 ,0x19 ,0xdc ,0x30 ,0xfa ,0xd5 ,0xe1 ,0xb4 ,0x7b ,0x99 ,0x1f ,0xd3 ,0x70 ,0x10 ,0x05 ,0x93 ,0xdb ,0x3e ,0x8a ,0x84 ,0x11 ,0x7e ,0xc8 ,0xc2 ,0x91 ,0x42 ,0x44 ,0x3f ,0x87 ,0x55 ,0x39 ,0xa7 ,0x25 ,0x0e ,0x00 ,0x8a ,0x3b ,0x93 ,0xc5 ,0x14 ,0x12 ,0x2c ,0xbd ,0xc7 ,0x10 ,0x8e ,0x3b ,0x3f ,0x91 ,0x44 ,0x28 ,0xd2 ,0x9f ,0x14 ,0x30 ,0xe9 ,0x82 ,0x04 ,0xc6 ,0x39 ,0xc0 ,0xe8 ,0x46 ,0xd0 ,0x02 ,0x99 ,0xeb ,0xad ,0x62 ,0xf9 ,0x8a ,0xb1 ,0x2e ,0x69 ,0x12 ,0x3e ,0x80 ,0xe4 ,0xe1 ,0xb0 ,0xaf ,0x9e ,0xde ,0x1d ,0xb3 ,0x62 ,0xd8 ,0xd2 ,0x38 ,0xd7 ,0xc0 ,0x5e ,0x74 ,0x83 ,0x8d ,0xe2 ,0x24 ,0x09 ,0x53 ,0x21 ,0x68 ,0x1a ,0x4c ,0x30 ,0x63 ,0xb8 ,0x61 ,0x17 ,0x8b ,0x0b ,0xc7 ,0xfc ,0xab ,0xe9 ,0xa2 ,0xba ,0xbb ,0x21 ,0x31 ,0x62 ,0x23 ,0x7d ,0x28 ,0x3a ,0x5d ,0xdf ,0x43 ,0x3f ,0x04 ,0x18 ,0xae ,0x93 ,0x52 ,0xca ,0xad ,0x4f ,0x39 ,0xe2 ,0x98 ,0xae ,0x3e ,0x09 ,0x52 ,0x48 ,0xb5 ,0x06 ,0x66 ,0xbf ,0x80 ,0x5c ,0x40 ,0x5c ,0xad ,0xfd ,0x33 ,0x88 ,0x5f ,0xeb ,0x59 ,0x7e ,0x36 ,0x0d ,0x99 ,0x76 ,0x15 ,0x57 ,0xb0 ,0xe1 ,0xb8 ,0x9a ,0xcd ,0x06 ,0x38 ,0xc5 ,0x7b ,0x6d ,0x30 ,0x90 ,0x9e ,0xc2 ,0x03 ,0xd1 ,0xde ,0x9e ,0x01 ,0xbe ,0x0b ,0x71 ,0xc1 ,0xe6 ,0xdc ,0x93 ,0xef ,0xed ,0x5d ,0xf6 ,0x22 ,0xda ,0x43 ,0x82 ,0x0a ,0x43 ,0x79 ,0xdf ,0x20 ,0xa0 ,0x94 ,0xc2 ,0xef ,0xeb ,0x26 ,0xfa ,0x17 ,0x77 ,0xce ,0x60 ,0x40 ,0xe1 ,0x9c ,0xfe ,0xb4 ,0xb3 ,0x6f ,0x2a ,0x60 ,0xe1 ,0xbe ,0xd6 ,0x4d ,0xb6 ,0x56 ,0x7a ,0xdd ,0xaf ,0x2e ,0x69 ,0xe3 ,0xb8 ,0x08 ,0x3c ,0x1b ,0x87 ,0x65 ,0x89 ,0x6a ,0xb2 ,0xdd ,0xd7 ,0xc4 ,0x3e ,0x38 ,0x70 ,0x63 ,0x94 ,0x08 ,0x2e ,0x37 ,0x83 ,0x70 ,0xc9 ,0x88 ,0x49 ,0xec ,0xb8 ,0x07 ,0x64 ,0x7a ,0x8a ,0xe6 ,0x81 ,0x02 ,0xae ,0x91 ,0x65 ,0x95 ,0x39 ,0x23 ,0x5b ,0x89 ,0x41 ,0xf6 ,0x83 ,0x56 ,0xe8 ,0xae ,0xe2 ,0x73 ,0xf3 ,0x73 ,0xa2 ,0x71 ,0xe0 ,0xc9 ,0x3c ,0xd9 ,0x97 ,0xd1 ,0xbe ,0xf3 ,0xcf ,0xf4 ,0xa9 ,0x09 ,0x5f ,0x1f ,0xf9 ,0x07 ,0x33 ,0x01 ,0xd1 ,0xa7 ,0x3b ,0x62 ,0xa0 ,0x12 ,0xa7 ,0x5c ,0x10 ,0x7a ,0x45 ,0x30 ,0x8c ,0x0f ,0x1c ,0x1a ,0x76 ,0x88 ,0xc1 ,0x89 ,0xea ,0xdc ,0x35 ,0xb7 ,0x10 ,0xf2 ,0x2e ,0x97 ,0x82 ,0x4a ,0x97 ,0xfc ,0x24 ,0x0b ,0x45 ,0xb9 ,0x22 ,0xcf ,0xc3 ,0xfe ,0x02 ,0x20 ,0x5a ,0x37 ,0xd7 ,0x86 ,0x3b ,0x40 ,0x35 ,0x2f ,0xdc ,0xa1 ,0x37 ,0x10 ,0x18 ,0x58 ,0x2d ,0x80 ,0x97 ,0x52 ,0xde ,0x07 ,0x1f ,0xfe ,0xc4 ,0xcb ,0x16 ,0xc0 ,0xdd ,0x11 ,0xc8 ,0x14 ,0xff ,0x08 ,0x87 ,0x35 ,0x5c ,0xec ,0xd3 ,0x28 ,0xb1 ,0x0c ,0xc2 ,0x2a ,0x33 ,0x52 ,0x43 ,0x80 ,0x63 ,0x1a ,0x66 ,0x6c ,0x58 ,0x39 ,0xc2 ,0xbc ,0xf4 ,0x73 ,0xf1 ,0xd9 ,0x1e ,0x89 ,0xbb ,0xaa ,0xe0 ,0x6e ,0x3b ,0x2b ,0xbb ,0x42 ,0x14 ,0xb3 ,0x2d ,0xe4 ,0x13 ,0x62 ,0x64 ,0xab ,0xce ,0x7c ,0xb5 ,0xd5 ,0x1e ,0x83 ,0x73 ,0x51 ,0x46 ,0x33 ,0x48 ,0x31 ,0xc9 ,0x52 ,0x64 ,0x64 ,0x85 ,0x0c ,0x81 ,0x1a ,0xdc ,0x5c ,0x13 ,0x74 ,0x96 ,0xdb ,0x94 ,0x6d ,0x50 ,0x69 ,0xd1 ,0xb2 ,0xc0 ,0x13 ,0x71 ,0xe8 ,0xe6 ,0x0a ,0x30 ,0xdb ,0x4f ,0x54 ,0x70 ,0x5b ,0x1b ,0xdd ,0x5c ,0x7a ,0xff ,0x82 ,0xa0 ,0x1e ,0xe1 ,0xb8 ,0x28 ,0xf6 ,0xe8 ,0xef ,0xbc ,0x50 ,0x22 ,0xc5 ,0x0d ,0x85 ,0xec ,0x37 ,0x94 ,0x6a ,0xc2 ,0x54 ,0x47 ,0x00 ,0x36 ,0xd4 ,0x9d ,0xd4 ,0x8d ,0x96 ,0x78 ,0xcb ,0x0b ,0x1c ,0xe8 ,0x35 ,0x87 ,0xd3 ,0x89 ,0x9c ,0xb4 ,0x53 ,0x83 ,0x0c ,0xc1 ,0xd0 ,0xa9 ,0x97 ,0x1b ,0x3a ,0xc7 ,0xa3 ,0x98 ,0x1a ,0x9b ,0x9d ,0x4d ,0x25 ,0x01 ,0xed ,0xa2 ,0xa9 ,0x1b ,0xfb ,0xae ,0xa8 ,0xba ,0x9e ,0x68 ,0xf2 ,0x4a ,0xa1 ,0x2a ,0x77 ,0xf4 ,0xba ,0xf8 ,0x90 ,0x57 ,0x0b ,0xf5 ,0xa7 ,0x83 ,0xb5 ,0x75 ,0x6c ,0xf4 ,0xa1 ,0xbc ,0x4d ,0x85 ,0x75 ,0x30 ,0xf1 ,0x0d ,0x23 ,0x79 ,0x09 ,0x2e ,0x23 ,0x46 ,0x2b ,0xb8 ,0x8c ,0x87 ,0xd4 ,0xa8 ,0x1d ,0x1a ,0x3b ,0xf4 ,0x58 ,0xa1 ,0x87 ,0x89 ,0xc4 ,0xb9 ,0x69 ,0xae ,0x60 ,0x47 ,0x9f ,0x4d ,0xe1 ,0xc9 ,0xc2 ,0x2a ,0x4a ,0x1a ,0xbf ,0x18 ,0xc8 ,0x4e ,0x0e ,0x54 ,0x91 ,0x07 ,0xf7 ,0x05 ,0x9d ,0x96 ,0xd4 ,0xd6 ,0x8b ,0xc4 ,0x0a ,0xdd ,0x2d ,0xf6 ,0x90 ,0xb4 ,0xad ,0xa6 ,0xdb ,0xd9 ,0xcf ,0x44 ,0xb0 ,0x1b ,0x07 ,0xb4 ,0xe5 ,0xf5 ,0x07 ,0x67 ,0xeb ,0xb5 ,0x3c ,0xba ,0x75 ,0x3a ,0x18 ,0x99 ,0x2d ,0xd5 ,0xbe ,0xfe ,0x82 ,0xbb ,0x45 ,0xff ,0xd0 ,0x36 ,0x8f ,0xa7 ,0xb5 ,0x7a ,0xc5 ,0x2b ,0xc5 ,0x23 ,0x88 ,0x5c ,0x2d ,0x44 ,0x21 ,0x81 ,0x21 ,0x11 ,0x73 ,0xc4 ,0xdf ,0x13 ,0xfe ,0x19 ,0xc8 ,0x18 ,0x58 ,0xf4 ,0x7b ,0xa9 ,0x4e ,0xa4 ,0x1d ,0x87 ,0x69 ,0x0a ,0xcd ,0x7f ,0xc6 ,0x6a ,0x97 ,0x25 ,0x20 ,0x12 ,0x4c ,0x64 ,0x12 ,0x29 ,0x26 ,0x00 ,0x11 ,0xa1 ,0x9c ,0x5e ,0xfa ,0x50 ,0x37 ,0xe9 ,0x8a ,0xb4 ,0x47 ,0x10 ,0xb2 ,0xc0 ,0x86 ,0x9d ,0x4e ,0xb5 ,0x2c ,0x16 ,0x33 ,0x58 ,0xad ,0x8c ,0x0b ,0x80 ,0x90 ,0xbb ,0x03 ,0x00 ,0x25 ,0xc2 ,0x32 ,0x1c ,0xc8 ,0xb5 ,0xa8 ,0x4f ,0xc4 ,0x83 ,0x38 ,0xb0 ,0x11 ,0x8b ,0x7f ,0xe1 ,0xd0 ,0x63 ,0xa1 ,0xa0 ,0xff ,0x1d ,0xfe ,0x05 ,0xc0 ,0x00 ,0x6f ,0xfb ,0xdc ,0x6f ,0x42 ,0x7d ,0x3f ,0x34 ,0x04 ,0x9c ,0x23 ,0xba ,0x80 ,0x91 ,0x4c ,0x0c ,0x5e ,0x84 ,0x43 ,0xa3 ,0x1e ,0x28 ,0x59 ,0x58 ,0x97 ,0xb0 ,0xcc ,0x40 ,0xab ,0x82 ,0xcb ,0xc6 ,0x03 ,0x83 ,0x84 ,0x88 ,0xd6 ,0x9b ,0xc6 ,0x79 ,0x37 ,0xd5 ,0x6b ,0x5d ,0xf3 ,0x61 ,0x57 ,0x44 ,0xa5 ,0xe2 ,0xbb ,0xaa ,0x23 ,0x78 ,0x25 ,0x08 ,0xc3 ,0x89 ,0x89 ,0xd2 ,0x75 ,0xba ,0xaa ,0x17 ,0x56 ,0x0d ,0xd1 ,0x69 ,0xa6 ,0xb6 ,0xa1 ,0x82 ,0xcc ,0xa4 ,0x75 ,0x4a ,0x2e ,0x8d ,0xce ,0x60 ,0x8c ,0xe7 ,0x5a ,0x93 ,0x96 ,0x11 ,0x33 ,0xc9 ,0xae ,0xda ,0x32 ,0xf9 ,0x6a ,0xf1 ,0x90 ,0x19 ,0x4b ,0xc6 ,0x5a ,0xae ,0x4b ,0xc8 ,0xee ,0x9a ,0x3b ,0x6d ,0xc3 ,0xdb ,0x81 ,0xea ,0x8f ,0x98 ,0xae ,0xd6 ,0x95 ,0x19 ,0x61 ,0xf5 ,0xc3 ,0xd0 ,0x1c ,0x70 ,0x8f ,0xd1 ,0xe4 ,0xfd ,0xde ,0x2a ,0xd3 ,0x0a ,0xdf ,0xa4 ,0x32 ,0x92 ,0x8c ,0x3b ,0x17 ,0xb7 ,0x09 ,0x28 ,0x81 ,0x28 ,0x3b ,0xdb ,0x7d ,0xb2 ,0x3e ,0x73 ,0xd4 ,0x37 ,0xa6 ,0xa9 ,0xf3 ,0x01 ,0xbc ,0x45 ,0x1d ,0x5c ,0xf8 ,0x88 ,0x8f ,0xa1 ,0xde ,0x20 ,0xac ,0xed ,0x14 ,0x15 ,0x76 ,0xc3 ,0x76 ,0x2c ,0x97 ,0x62 ,0x23 ,0xa7 ,0xc8 ,0xd5 ,0x63 ,0x65 ,0xea ,0x3a ,0x0e ,0x92 ,0x06 ,0x1f ,0x94 ,0x6d ,0x43 ,0x7e ,0xe9 ,0xc9 ,0xcf ,0x48 ,0x77 ,0x6d ,0x2e ,0x83 ,0x4c ,0x66 ,0x8a ,0xb9 ,0x0f ,0x8c ,0x8d ,0x38 ,0xae ,0x7a ,0xfd ,0x5c ,0xa9 ,0x47 ,0x1a ,0xd5 ,0xdc ,0x55 ,0xc8 ,0xb6 ,0xb1 ,0xca ,0x87 ,0x1b ,0x55 ,0xe5 ,0x17 ,0x07 ,0x6f ,0x70 ,0x81 ,0x28 ,0x09 ,0xb3 ,0x0d ,0xef ,0xf0 ,0x52 ,0x0c ,0x8e ,0xb8 ,0x14 ,0xdf ,0x01 ,0x8e ,0x98 ,0xe4 ,0x5d ,0xe0 ,0xa8 ,0x62 ,0x61 ,0xf9 ,0x30 ,0x38 ,0x0a ,0xf8 ,0xa0 ,0xb0 ,0x0d ,0x62 ,0xf6 ,0xaf ,0x8a ,0x1b ,0x89 ,0xab ,0x0a ,0x4b ,0xc6 ,0x0a ,0x58 ,0xaa ,0xd5 ,0xef ,0x3f ,0x03 ,0x4b ,0xd6 ,0x05 ,0x4c ,0x15 ,0xca ,0x10 ,0x5c ,0xdb ,0x0a ,0xc8 ,0x96 ,0x29 ,0xfa ,0x41 ,0xbc ,0x62 ,0x89 ,0x83 ,0x08 ,0x84 ,0xbc ,0x3f ,0x88 ,0x50 ,0x5c ,0xf4 ,0x3d ,0xc1 ,0x01 ,0x13 ,0x8b ,0x27 ,0x5b ,0x2d ,0x15 ,0xcb ,0x3d ,0x3b ,0x53 ,0x0a ,0xbf ,0x42 ,0x99 ,0x78 ,0xf6 ,0x66 ,0x08 ,0x36 ,0xa8 ,0xf2 ,0x2c ,0x44 ,0x66 ,0xa0 ,0x48 ,0x30 ,0x10 ,0x0c ,0x15 ,0x91 ,0x84 ,0x00 ,0x9c ,0x8e ,0xe0 ,0x3d ,0x67 ,0x61 ,0x5c ,0x7b ,0x78 ,0x27 ,0x96 ,0x64 ,0x09 ,0xd5 ,0x2f ,0x8a ,0xbe ,0x3d ,0x04 ,0xe8 ,0x83 ,0x43 ,0x46 ,0xce ,0xc6 ,0x9a ,0x31 ,0xbd ,0xd3 ,0xbf ,0x83 ,0xb5 ,0x23 ,0xb9 ,0x32 ,0x94 ,0xb0 ,0xbf ,0xc2 ,0x11 ,0xac ,0x61 ,0xe0 ,0x53 ,0x69 ,0x49 ,0x3e ,0x0d ,0xff ,0xf9 ,0x70 ,0x8b ,0x43 ,0x17 ,0xed ,0xba ,0x02 ,0xa6 ,0x5d ,0xbb ,0xdc ,0x0e ,0x5c ,0x25 ,0xb8 ,0xde ,0x11 ,0xa0 ,0x3a ,0xb4 ,0x75 ,0x8b ,0xcf ,0x5c ,0x8e ,0xd2 ,0x5b ,0x42 ,0xd0 ,0x57 ,0x69 ,0xa4 ,0xc6 ,0xbc ,0x69 ,0xce ,0xe8 ,0x11 ,0x02 ,0x7d ,0xf8 ,0x7d ,0x4b ,0x09 ,0x85 ,0xe2 ,0x43 ,0x76 ,0xbd ,0x5c ,0xa5 ,0xff ,0x2c ,0xb8 ,0xef ,0xfb ,0x66 ,0x36 ,0x61 ,0xbc ,0x49 ,0x30 ,0x16 ,0xbf ,0x94 ,0x25 ,0xc2 ,0x6e ,0xca ,0x27 ,0x13 ,0xc3 ,0x74 ,0x37 ,0x67 ,0xdf ,0x1a ,0x6e ,0x27 ,0x1e ,0x29 ,0xaf ,0x71 ,0x0b ,0x0c ,0x7b ,0x30 ,0xbb ,0x98 ,0x88 ,0x47 ,0x30 ,0x59 ,0xf9 ,0x2a ,0xa3 ,0xa7 ,0x5d ,0x89 ,0xac ,0xfc ,0xa9 ,0xa1 ,0x8a ,0x2c ,0x37 ,0xec ,0xe5 ,0x58 ,0x6d ,0x73 ,0x43 ,0x8a ,0x96 ,0x1b ,0xbc ,0x9b ,0xc4 ,0xa2 ,0x09 ,0x15 ,0xed ,0x95 ,0xa2 ,0x1f ,0x10 ,0x06 ,0x16 ,0x2f ,0x29 ,0xdd ,0x33 ,0x2b ,0xb4 ,0x12 ,0x4e ,0xb8 ,0x63 ,0xa4 ,0xc5 ,0xc0 ,0xe1 ,0x3d ,0x57 ,0x53 ,0xa4 ,0x81 ,0x11 ,0x51 ,0xe2 ,0x60 ,0xab ,0x21 ,0x71 ,0x43 ,0x6f ,0x61 ,0x32 ,0x2b ,0x90 ,0x19 ,0xbc ,0xb9 ,0xb9 ,0x1c ,0x80 ,0x2a ,0xfa ,0x1c ,0x62 ,0x54 ,0x9b ,0xf1 ,0x16 ,0xfb ,0x0d ,0x01 ,0x89 ,0xe3 ,0x7a ,0xc1 ,0xbd ,0x60 ,0xec ,0xa4 ,0x13 ,0x5d ,0xf8 ,0x9c ,0x25 ,0xd5 ,0x47 ,0xba ,0xe2 ,0x81 ,0x42 ,0xb0 ,0x7b ,0x84 ,0x77 ,0x8c ,0x2d ,0x6a ,0x63 ,0x90 ,0x44 ,0x3a ,0xc8 ,0xf8 ,0xce ,0xb4 ,0xf9 ,0xa2 ,0x5f ,0x42 ,0x1f ,0x0e ,0xe8 ,0x02 ,0xd5 ,0x8a ,0x30 ,0xca ,0xcc ,0x00 ,0x1c ,0xd2 ,0x26 ,0x67 ,0xde ,0x6e ,0x37 ,0x34 ,0x01 ,0x6a ,0x4b ,0xe3 ,0x85 ,0x0e ,0x5c ,0x11 ,0x46 ,0x0b ,0xa6 ,0x1f ,0xea ,0x4a ,0x48 ,0x7e ,0x74 ,0x70 ,0x17 ,0xc3 ,0x40 ,0xa6 ,0x26 ,0xba ,0x1a ,0xfe ,0xfd ,0xbc ,0xe3 ,0x38 ,0xc0 ,0x7a ,0x3e ,0xbe ,0xf0 ,0x7c ,0x23 ,0xa6 ,0x95 ,0x74 ,0xa2 ,0xc7 ,0xb1 ,0xe8 ,0xa6 ,0x7a ,0x76 ,0x5c ,0x10 ,0x96 ,0x20 ,0x5e ,0xb1 ,0x09 ,0x09 ,0x02 ,0x02 ,0xac ,0x61 ,0x24 ,0x48 ,0xf9 ,0x46 ,0xda ,0x45 ,0x46 ,0x34 ,0xfc ,0xff ,0xa2 ,0xf3 ,0x82 ,0xac ,0xdf ,0xd1 ,0x7f ,0xb0 ,0x45 ,0xa9 ,0x68 ,0xc4 ,0x44 ,0xc1 ,0xf3 ,0x09 ,0xd7 ,0x6c ,0xfd ,0xa9 ,0x1e ,0xf5 ,0xff ,0x93 ,0x1e ,0xd7 ,0xd3 ,0xa6 ,0x7e ,0xa7 ,0xf3 ,0x40 ,0xf8 ,0x41 ,0x73 ,0x1a ,0xbe ,0xee ,0x4e ,0xf2 ,0x3f ,0x18 ,0x07 ,0xf5 ,0x10 ,0x5b ,0x1d ,0x87 ,0xc0 ,0x44 ,0xc1 ,0xac ,0x04 ,0xc6 ,0x75 ,0x75 ,0xcb ,0x83 ,0xd4 ,0x5c ,0x75 ,0xfd ,0x58 ,0x3e ,0x76 ,0xcd ,0xb1 ,0x2c ,0xa0 ,0xdc ,0x62 ,0x60 ,0x22 ,0xf5 ,0xf8 ,0x79 ,0x6d ,0xb4 ,0x30 ,0xa3 ,0xb1 ,0xea ,0xc0 ,0x85 ,0x01 ,0xed ,0x1b ,0xea ,0xa3 ,0xcb ,0x58 ,0xd7 ,0x66 ,0x74 ,0x83 ,0x0a ,0x47 ,0xa3 ,0x8b ,0x08 ,0x54 ,0x66 ,0x74 ,0xc5 ,0x36 ,0x98 ,0x21 ,0x25 ,0xb6 ,0xba ,0xa1 ,0xa7 ,0x59 ,0x07 ,0x26 ,0x17 ,0x07 ,0x94 ,0x2c ,0x36 ,0xa0 ,0x8b ,0x08 ,0x46 ,0x60 ,0x1e ,0xce ,0x74 ,0x80 ,0xcd ,0xb0 ,0xc0 ,0x0a ,0x62 ,0x58 ,0x70 ,0x58 ,0x68 ,0xcf ,0xb6 ,0xd4 ,0x52 ,0x81 ,0xdb ,0x97 ,0x51 ,0xc5 ,0x81 ,0xb5 ,0x23 ,0xc0 ,0x87 ,0x6d ,0x1a ,0x8a ,0x16 ,0x6d ,0x62 ,0x6f ,0xcd ,0x8e ,0x61 ,0xb7 ,0xbd ,0x62 ,0x0c ,0x32 ,0x98 ,0xaf ,0x9d ,0x8b ,0x74 ,0x7a ,0xe3 ,0x02 ,0x4e ,0xb4 ,0x7e ,0xfd ,0xd5 ,0x6d ,0x64 ,0xbf ,0xfe ,0x2a ,0x18 ,0xb0 ,0x8d ,0x28 ,0x14 ,0x40 ,0xbb ,0xda ,0x25 ,0x37 ,0xbc ,0x10 ,0x2e ,0xaa ,0x7d ,0x37 ,0x59 ,0xc3 ,0xa1 ,0x5f ,0x9b ,0x38 ,0x5f ,0x01 ,0x8c ,0x5c ,0x05 ,0x12 ,0x85 ,0xe7 ,0x81 ,0x55 ,0x88 ,0xf9 ,0x09 ,0x85 ,0x11 ,0x4c ,0x34 ,0xa8 ,0x12 ,0xed ,0x58 ,0x6f ,0xf2 ,0x66 ,0xb6 ,0x0b ,0xce ,0x6c ,0x94 ,0x3f ,0xc3 ,0x39 ,0xae ,0x13 ,0x13 ,0x72 ,0x75 ,0xae ,0x01 ,0x9d ,0xe8 ,0x6e ,0x36 ,0xaf ,0x74 ,0x16 ,0x1b ,0x77 ,0x83 ,0x56 ,0x26 ,0x86 ,0x2d ,0x5e ,0x11 ,0xca ,0x25 ,0xf0 ,0xc4 ,0x93 ,0x05 ,0x6c ,0xab ,0x22 ,0x28 ,0x0b ,0xec ,0x7f ,0x1b ,0x8c ,0xb0 ,0xea ,0x80 ,0xc7 ,0xa4 ,0x41 ,0xb6 ,0xad ,0xe6 ,0x05 ,0x63 ,0xf4 ,0x36 ,0x5a ,0xae ,0x19 ,0x2c ,0xae ,0x38 ,0xae ,0x29 ,0xab ,0x92 ,0xf1 ,0xae ,0xe4 ,0x11 ,0x1c ,0xfe ,0xd1 ,0xae ,0x34 ,0x98 ,0x68 ,0x76 ,0x2a ,0xa2 ,0x5e ,0x10 ,0xbc ,0x23 ,0x9c ,0xcf ,0x00 ,0x22 ,0x30 ,0xa0 ,0x20 ,0x8e ,0x6f ,0x6f ,0x66 ,0x7e ,0x31 ,0x28 ,0xba ,0xbc ,0x11 ,0x2f ,0x15 ,0x71 ,0x26 ,0x43 ,0xfc ,0x8e ,0x5a ,0x92 ,0xb0 ,0xff ,0x68 ,0x8e ,0x21 ,0x6a ,0x86 ,0x90 ,0xa1 ,0x84 ,0x18 ,0x76 ,0x4d ,0x50 ,0x44 ,0x94 ,0x67 ,0xf0 ,0x41 ,0x6b ,0x19 ,0x2f ,0x44 ,0x40 ,0x7c ,0xb9 ,0xd9 ,0xa2 ,0x48 ,0x38 ,0xe5 ,0x06 ,0x67 ,0x74 ,0xf1 ,0xab ,0x44 ,0x2e ,0xe0 ,0xa6 ,0x1e ,0x8c ,0x55 ,0x84 ,0xcc ,0x12 ,0xa9 ,0x80 ,0x64 ,0xa5 ,0x54 ,0x17 ,0x24 ,0x7e ,0x0a ,0x2d ,0xad ,0x47 ,0xc3 ,0xb8 ,0x2e ,0x88 ,0xb4 ,0x5c ,0xab ,0x48 ,0xf1 ,0x50 ,0x2d ,0x0c ,0x22 ,0x1a ,0xd6 ,0x82 ,0x33 ,0x4a ,0xe6 ,0xaa ,0xaf ,0x03 ,0x8c ,0x7b ,0x6b ,0xfb ,0x31 ,0x29 ,0x35 ,0xad ,0x14 ,0xee ,0x3a ,0x30 ,0xb8 ,0x14 ,0x4f ,0xf4 ,0x86 ,0x98 ,0x85 ,0x04 ,0x4d ,0x05 ,0x68 ,0x21 ,0xf6 ,0x6e ,0xeb ,0x45 ,0x11 ,0x9d ,0xe8 ,0x2d ,0xbc ,0x1f ,0x3e ,0x6b ,0x6a ,0x12 ,0xda ,0x22 ,0xc3 ,0x4c ,0x12 ,0xe6 ,0x7b ,0x98 ,0xdb ,0x46 ,0x9f ,0x9c ,0xea ,0x49 ,0x44 ,0xf5 ,0x88 ,0x98 ,0x6d ,0xc9 ,0xd5 ,0xcc ,0x53 ,0xeb ,0x8b ,0x79 ,0x29 ,0xe4 ,0x42 ,0x8c ,0xf3 ,0x81 ,0x59 ,0xae ,0x17 ,0xf6 ,0x8d ,0x83 ,0x73 ,0x63 ,0xac ,0xb7 ,0x86 ,0x32 ,0x88 ,0x44 ,0x95 ,0x12 ,0x67 ,0x3f ,0xd9 ,0xa0 ,0xec ,0x1e ,0xf5 ,0xad ,0x6e ,0xa1 ,0x08 ,0xdd ,0x17 ,0x69 ,0xf9 ,0xf4 ,0x70 ,0xb0 ,0xec ,0xe3 ,0x16 ,0xd4 ,0xdb ,0x16 ,0x30 ,0xe4 ,0x11 ,0x4e ,0x27 ,0xb6 ,0x29 ,0x25 ,0x6a ,0x9d ,0x27 ,0x1d ,0xe2 ,0xc0 ,0x0b ,0x71 ,0x03 ,0x0c ,0x6d ,0x56 ,0x30 ,0xf1 ,0x8c ,0x67 ,0x1e ,0x46 ,0x85 ,0x81 ,0x17 ,0x58 ,0x8f ,0x62 ,0xda ,0x1b ,0x80 ,0x22 ,0x2f ,0xe0 ,0x71 ,0xd1 ,0xdf ,0xa1 ,0xc0 ,0x52 ,0xdd ,0x4a ,0x4b ,0xb0 ,0x21 ,0xb1 ,0x44 ,0xb8 ,0xc6 ,0xf2 ,0xd1 ,0x35 ,0x00 ,0xc7 ,0x78 ,0x76 ,0x53 ,0x39 ,0x36 ,0x0e ,0x71 ,0x00 ,0x05 ,0x6d ,0xc8 ,0x88 ,0x7a ,0xe8 ,0xb8 ,0xc0 ,0x14 ,0x30 ,0xea ,0x98 ,0x30 ,0xfc ,0x8c ,0x04 ,0x83 ,0x71 ,0xad ,0x0d ,0xc2 ,0x58 ,0x88 ,0xa9 ,0x0e ,0xf5 ,0x52 ,0x1c ,0x1e ,0xef ,0x35 ,0x4d ,0xfd ,0x1c ,0x34 ,0xb9 ,0xaa ,0x83 ,0x78 ,0x08 ,0xdc ,0x04 ,0xee ,0x88 ,0x14 ,0x8e ,0xae ,0xc7 ,0xec ,0x90 ,0x8a ,0xf1 ,0x72 ,0x34 ,0x18 ,0x29 ,0x92 ,0x41 ,0xdb ,0xca ,0xce ,0x20 ,0x45 ,0xaf ,0x0d ,0xef ,0xcd ,0x33 ,0xfb ,0x2a ,0x68 ,0x6f ,0xb4 ,0x02 ,0xc1 ,0xbd ,0x6e ,0xe4 ,0x90 ,0xd4 ,0x78 ,0xbb ,0x0e ,0x95 ,0xb5 ,0xe6 ,0x7c ,0x41 ,0x3b ,0x68 ,0x0d ,0xaa ,0x5d ,0x2b ,0x10 ,0x93 ,0x7e ,0xa1 ,0x2c ,0x7b ,0x51 ,0xa8 ,0x99 ,0xb8 ,0x44 ,0x51 ,0xf8 ,0xd9 ,0x0a ,0x48 ,0x6a ,0x76 ,0xa1 ,0x66 ,0x62 ,0x0f ,0x10 ,0x6f ,0x06 ,0x10 ,0xc6 ,0x70 ,0x0f ,0xc9 ,0xcf ,0xbe ,0x54 ,0x3f ,0x36 ,0x05 ,0x58 ,0x98 ,0x70 ,0xc6 ,0x63 ,0x1c ,0xd7 ,0xd0 ,0xac ,0x58 ,0x80 ,0x33 ,0x1c ,0x61 ,0x09 ,0x11 ,0x6f ,0x6e ,0xc8 ,0xdf ,0xc6 ,0x3a ,0x9f ,0x11 ,0x77 ,0x35 ,0x88 ,0xa5 ,0x36 ,0x8a ,0x2b ,0xd2 ,0xe4 ,0x01 ,0x02 ,0xc0 ,0xdd ,0xac ,0x4c ,0x63 ,0x9a ,0x92 ,0xd4 ,0x1d ,0xd6 ,0x70 ,0xd9 ,0x84 ,0xce ,0x62 ,0x8d ,0xd1 ,0xa1 ,0xba ,0x32 ,0xbc ,0x4d ,0x87 ,0x50 ,0x16 ,0x80 ,0xed ,0xce ,0x14 ,0xbe ,0xeb ,0x14 ,0x30 ,0x83 ,0xfa ,0x14 ,0xb3 ,0x53 ,0x18 ,0x47 ,0x0a ,0x93 ,0x0a ,0x46 ,0xf0 ,0xc1 ,0x3d ,0x67 ,0x66 ,0x2d ,0x09 ,0xbc ,0xab ,0x31 ,0xef ,0x89 ,0x10 ,0x4b ,0x8c ,0x20 ,0x6e ,0x9d ,0x5e ,0xa6 ,0xcb ,0x14 ,0xc2 ,0x1e ,0x64 ,0x9f ,0x90 ,0x8e ,0x57 ,0x48 ,0xe6 ,0x25 ,0xd4 ,0xe1 ,0xf9 ,0xee ,0xc4 ,0x10 ,0xae ,0x53 ,0xf8 ,0xa7 ,0xae ,0xb8 ,0x0a ,0xe5 ,0x54 ,0x9b ,0x7a ,0x1c ,0x0e ,0x25 ,0x60 ,0x14 ,0x79 ,0x2d ,0x6d ,0x9f ,0xa5 ,0xd3 ,0xa0 ,0x60 ,0xba ,0xcd ,0xd7 ,0xf0 ,0x45 ,0x67 ,0xc6 ,0x1b ,0x22 ,0x35 ,0x19 ,0x83 ,0x47 ,0xfb ,0x8a ,0x70 ,0x73 ,0xac ,0xba ,0x53 ,0x70 ,0xae ,0x57 ,0xa1 ,0x97 ,0xa3 ,0x55 ,0xe4 ,0xe5 ,0x68 ,0x8a ,0x55 ,0x5a ,0xf5 ,0xa7 ,0x0b ,0x64 ,0x41 ,0x14 ,0xc7 ,0x97 ,0x6f ,0xb5 ,0x6a ,0x50 ,0x3f ,0x7e ,0xd2 ,0xff ,0x10 ,0x57 ,0x5c ,0x2f ,0xa4 ,0x67 ,0xde ,0xb5 ,0x26 ,0x1d ,0x91 ,0xf9 ,0x1b ,0x41 ,0xa2 ,0x41 ,0xa3 ,0x4b ,0x45 ,0xfb ,0xe4 ,0x76 ,0x97 ,0x8a ,0xca ,0x39 ,0x72 ,0x8e ,0xd4 ,0x4c ,0x14 ,0x71 ,0x74 ,0x94 ,0x58 ,0xc8 ,0x8b ,0x69 ,0xaa ,0xf1 ,0x38 ,0x43 ,0x6f ,0x9f ,0x36 ,0x20 ,0xaa ,0x44 ,0x2b ,0x8c ,0x62 ,0x51 ,0x21 ,0xe4 ,0x11 ,0x78 ,0x20 ,0xf3 ,0x9a ,0x0b ,0xbe ,0xa9 ,0x1a ,0x02 ,0x40 ,0xfa ,0xba ,0x3b ,0xb7 ,0xbd ,0x6f ,0x7c ,0xe5 ,0xb9 ,0x73 ,0xa3 ,0x07 ,0x07 ,0xff ,0xa3 ,0x06 ,0x74 ,0xed ,0x82 ,0x05 ,0x83 ,0xe4 ,0xd6 ,0x03 ,0x14 ,0x4e ,0xae ,0x44 ,0xaf ,0x85 ,0x20 ,0x75 ,0x82 ,0xe7 ,0x42 ,0x77 ,0x0a ,0x9b ,0xcd ,0x34 ,0xb1 ,0xe3 ,0x3c ,0xe9 ,0x4e ,0xb9 ,0x37 ,0xc2 ,0xcb ,0x64 ,0x00 ,0x19 ,0x3b ,0xc7 ,0xeb ,0xe3 ,0xca ,0x95 ,0x5b ,0x05 ,0x81 ,0xb0 ,0x3d ,0x43 ,0x74 ,0x94 ,0x63 ,0xfa ,0x75 ,0x6a ,0x17 ,0xb1 ,0x96 ,0x22 ,0x0d ,0x46 ,0x61 ,0x44 ,0xa6 ,0xe9 ,0x96 ,0xa1 ,0xa6 ,0xf5 ,0x66 ,0x63 ,0x95 ,0xe8 ,0x7f ,0xc4 ,0x14 ,0x28 ,0x71 ,0x0e ,0x26 ,0xb9 ,0x27 ,0x13 ,0x50 ,0xf8 ,0xad ,0xd2 ,0x09 ,0x0f ,0x39 ,0xee ,0x83 ,0x22 ,0x22 ,0xfb ,0x98 ,0x72 ,0x83 ,0x0c ,0x61 ,0xaa ,0x27 ,0xfd ,0xb9 ,0x73 ,0x96 ,0xc9 ,0xf6 ,0xc0 ,0x61 ,0xaa ,0xf1 ,0x79 ,0x08 ,0xeb ,0xb6 ,0x46 ,0x87 ,0x87 ,0xd6 ,0x39 ,0x28 ,0xee ,0xab ,0x59 ,0x98 ,0x44 ,0x08 ,0xc2 ,0xd6 ,0x68 ,0xc2 ,0xf2 ,0x83 ,0xb6 ,0x41 ,0x26 ,0x30 ,0xf2 ,0x5c ,0x0f ,0x47 ,0xac ,0x8a ,0xb9 ,0xb3 ,0xb7 ,0xf7 ,0x33 ,0x5a ,0x2d ,0x5c ,0x0d ,0x33 ,0xe0 ,0xd1 ,0x23 ,0xca ,0x29 ,0x75 ,0xbe ,0x9d ,0xea ,0x0e ,0xf5 ,0x3c ,0xe3 ,0x48 ,0x2b ,0x3f ,0xe5 ,0xc0 ,0xb2 ,0x95 ,0x55 ,0x6f ,0x37 ,0xd4 ,0x24 ,0x9a ,0x3b ,0x7f ,0xf1 ,0xc6 ,0x8f ,0xa5 ,0xbf ,0x60 ,0x0a ,0x45 ,0xff ,0x82 ,0xc3 ,0x4f ,0x86 ,0x38 ,0xa6 ,0xc4 ,0xcf ,0xa2 ,0xe7 ,0x83 ,0x2a ,0x33 ,0x7e ,0xf6 ,0x54 ,0xfa ,0x8f ,0xa3 ,0x8e ,0xca ,0xc2 ,0x68 ,0xb7 ,0xd0 ,0x66 ,0xe0 ,0xce ,0x08 ,0xfc ,0x32 ,0x06 ,0xc6 ,0x75 ,0x1e ,0x3f ,0xdc ,0x92 ,0x46 ,0x6d ,0xb6 ,0x75 ,0x38 ,0xe5 ,0xd4 ,0x35 ,0x77 ,0xb1 ,0x53 ,0xc0 ,0x42 ,0xf0 ,0x4a ,0x51 ,0x96 ,0x78 ,0x0a ,0xdc ,0xfe ,0x64 ,0x93 ,0xc3 ,0x29 ,0x7d ,0xb8 ,0x5e ,0x07 ,0x1b ,0x86 ,0xdf ,0xd6 ,0x95 ,0xc6 ,0x13 ,0x81 ,0xf3 ,0xc0 ,0xa5 ,0xf1 ,0x76 ,0xd3 ,0xcc ,0xab ,0xf4 ,0x26 ,0xea ,0x01 ,0xd4 ,0x60 ,0x28 ,0x32 ,0x01 ,0x99 ,0x15 ,0xe7 ,0x44 ,0xf0 ,0x5c ,0x4c ,0x40 ,0x1d ,0x96 ,0x4f ,0x73 ,0x04 ,0x59 ,0xce ,0xf5 ,0x70 ,0x63 ,0x35 ,0x00 ,0x1e ,0xc5 ,0xe9 ,0x7d ,0xc8 ,0x65 ,0x84 ,0xcd ,0x9b ,0x15 ,0x75 ,0x16 ,0x57 ,0xe6 ,0xa2 ,0x4a ,0xae ,0x1a ,0x99 ,0xfc ,0x0e ,0xf1 ,0x0f ,0x14 ,0x24 ,0x18 ,0x56 ,0xbf ,0x96 ,0xe7 ,0x4c ,0x6c ,0x0c ,0xc3 ,0xcd ,0x8d ,0xa8 ,0xaa ,0x4a ,0xaa ,0xd5 ,0xed ,0x9b ,0x73 ,0xd1 ,0xa6 ,0x1e ,0xda ,0x42 ,0x7f ,0x6a ,0x4d ,0x05 ,0xc7 ,0xa1 ,0xbc ,0x0d ,0x38 ,0x32 ,0xfd ,0x46 ,0xc3 ,0x62 ,0xeb ,0x05 ,0x2b ,0xf6 ,0x48 ,0xaa ,0xdb ,0x5e ,0xec ,0x3e ,0x54 ,0x31 ,0x85 ,0x75 ,0xc0 ,0x59 ,0xb6 ,0x03 ,0xa5 ,0x5e ,0x3c ,0x62 ,0x88 ,0x61 ,0xfc ,0xb5 ,0x38 ,0x4b ,0x6c ,0xd8 ,0x6c ,0x02 ,0x2d ,0x07 ,0x24 ,0xa9 ,0x4f ,0x3d ,0x32 ,0x80 ,0xa9 ,0xe7 ,0x16 ,0xa6 ,0x85 ,0xd2 ,0x9b ,0xa8 ,0xb9 ,0x91 ,0x5b ,0x6e ,0xfd ,0xbd ,0xfe ,0xe7 ,0x05 ,0xef ,0x1f ,0x1d ,0x17 ,0x83 ,0x28 ,0x7b ,0xe8 ,0xbe ,0x80 ,0x6b ,0xd1 ,0x34 ,0x97 ,0x7d ,0x6d ,0x8c ,0x09 ,0x2a ,0x33 ,0x10 ,0x45 ,0x08 ,0x41 ,0x2b ,0xa0 ,0xf9 ,0x70 ,0x70 ,0x32 ,0x3c ,0x39 ,0x05 ,0xf2 ,0x30 ,0x16 ,0xf2 ,0x6f ,0x70 ,0x32 ,0x3b ,0xb8 ,0x48 ,0xe6 ,0x06 ,0xdb ,0x58 ,0xae ,0xcf ,0xa6 ,0xc5 ,0xca ,0x08 ,0x13 ,0xe0 ,0x27 ,0x04 ,0xae ,0x91 ,0x36 ,0x98 ,0xef ,0xd8 ,0x3c ,0xa0 ,0xec ,0x96 ,0x8b ,0x74 ,0x01 ,0x36 ,0x0d ,0x0f ,0x88 ,0x21 ,0xe0 ,0x06 ,0xe8 ,0x02 ,0x41 ,0xf2 ,0x21 ,0x72 ,0x70 ,0x8c ,0xc0 ,0x0b ,0xa3 ,0x20 ,0xe9 ,0x44 ,0x24 ,0x8d ,0xb2 ,0x77 ,0x33 ,0x4b ,0x02 ,0x05 ,0x0c ,0xb6 ,0xf2 ,0x0e ,0xf3 ,0xe7 ,0xdc ,0x72 ,0xac ,0xc1 ,0x36 ,0x47 ,0x4e ,0x68 ,0x3a ,0x73 ,0xec ,0xb6 ,0x86 ,0xad ,0x6e ,0xdd ,0x3f ,0x8b ,0xe3 ,0xb8 ,0x17 ,0xd8 ,0xae ,0x41 ,0xa9 ,0x74 ,0x5b ,0xa7 ,0x30 ,0x45 ,0xb2 ,0x2e ,0x09 ,0xac ,0xbf ,0x78 ,0xca ,0xc7 ,0xcd ,0x93 ,0x00 ,0x65 ,0x67 ,0x82 ,0x1f ,0x1a ,0x4f ,0x71 ,0xd6 ,0xad ,0xae ,0x78 ,0xaf ,0x58 ,0x75 ,0x5c ,0x51 ,0x85 ,0xe4 ,0xb4 ,0x82 ,0x7b ,0x0a ,0xcd ,0x0c ,0xec ,0x57 ,0x7a ,0x4c ,0xa9 ,0xb8 ,0xa7 ,0x8b ,0x0c ,0x94 ,0x9a ,0xe6 ,0xb3 ,0xb8 ,0x8d ,0x04 ,0xf0 ,0xed ,0xaf ,0x8e ,0x17 ,0xc3 ,0x85 ,0x41 ,0xb8 ,0x11 ,0x8d ,0x6c ,0x36 ,0xc2 ,0x5e ,0x86 ,0xf8 ,0xfe ,0xb4 ,0x39 ,0x01 ,0x5d ,0x22 ,0x5e ,0x14 ,0xbb ,0xad ,0x14 ,0xac ,0x80 ,0xfa ,0x9d ,0x90 ,0xf8 ,0xc2 ,0x4c ,0xaf ,0xf5 ,0xa6 ,0x28 ,0x37 ,0xf7 ,0x7e ,0x93 ,0xb0 ,0x2d ,0x26 ,0x76 ,0xef ,0xb7 ,0x13 ,0xa8 ,0xef ,0x1b ,0xcf ,0xbf ,0x58 ,0x1e ,0xa6 ,0xb3 ,0x23 ,0xd5 ,0xa3 ,0x42 ,0xc9 ,0x50 ,0x22 ,0x21 ,0x4a ,0xbc ,0x2b ,0xed ,0x67 ,0x7b ,0x4d ,0xdc ,0x78 ,0xa8 ,0xd7 ,0x1b ,0xf4 ,0xc9 ,0x0c ,0xfe ,0x1c ,0x10 ,0x7f ,0x85 ,0x43 ,0xe4 ,0x84 ,0x5b ,0x06 ,0x3d ,0x41 ,0x60 ,0x5c ,0x4a ,0xdd ,0xc2 ,0xe0 ,0x4a ,0x50 ,0x76 ,0xcb ,0x26 ,0xcd ,0xc6 ,0x0c ,0xa6 ,0x1b ,0x6d ,0x24 ,0x67 ,0x93 ,0x50 ,0xdb ,0x41 ,0x7b ,0xb4 ,0xf8 ,0x52 ,0x93 ,0x35 ,0x44 ,0x83 ,0x09 ,0xa4 ,0x2a ,0x24 ,0x18 ,0x99 ,0xb3 ,0xf1 ,0x34 ,0x6c ,0xc2 ,0xe0 ,0x78 ,0x0a ,0x93 ,0x42 ,0x69 ,0x8f ,0xf3 ,0x18 ,0x16 ,0x19 ,0x0c ,0x03 ,0x8d ,0x1d ,0x61 ,0xb3 ,0x7f ,0x34 ,0xce ,0xb2 ,0xc8 ,0x38 ,0x8c ,0xdd ,0xc5 ,0x3e ,0x36 ,0x4c ,0x8a ,0x02 ,0x71 ,0x25 ,0xfb ,0x96 ,0xae ,0xa3 ,0x9a ,0xd2 ,0xa5 ,0x99 ,0xbc ,0x11 ,0xb7 ,0x80 ,0xdb ,0xe1 ,0xdc ,0xcd ,0x6a ,0xee ,0xe0 ,0x62 ,0x9e ,0x66 ,0x0d ,0xfa ,0x77 ,0x9d ,0x0f ,0x12 ,0x32 ,0x03 ,0xe2 ,0xc6 ,0x05 ,0x53 ,0x29 ,0x62 ,0x8c ,0xc4 ,0x3e ,0xbc ,0x54 ,0xf0 ,0x5d ,0x61 ,0x85 ,0x20 ,0x00 ,0xa9 ,0xb2 ,0x41 ,0x02 ,0x55 ,0x10 ,0x47 ,0xbd ,0xdc ,0xb1 ,0x21 ,0x70 ,0x95 ,0x23 ,0xc3 ,0xaf ,0x0e ,0x40 ,0xbd ,0x77 ,0x83 ,0x31 ,0xb0 ,0x7a ,0x7a ,0x01 ,0xa2 ,0x7b ,0xc9 ,0x0e ,0x9c ,0x79 ,0xd6 ,0x92 ,0x7a ,0xfe ,0x40 ,0x94 ,0x54 ,0xad ,0xe9 ,0x6a ,0xdb ,0xd7 ,0xf5 ,0x22 ,0x9b ,0xd3 ,0x04 ,0xb0 ,0x46 ,0xbd ,0x87 ,0x3d ,0x2b ,0x81 ,0x27 ,0x85 ,0x0f ,0x4d ,0x99 ,0x34 ,0x7d ,0x25 ,0x58 ,0x9e ,0x10 ,0xee ,0x48 ,0xac ,0x13 ,0x90 ,0x6d ,0xea ,0x6b ,0xb0 ,0xea ,0x58 ,0x04 ,0x66 ,0xe6 ,0x7f ,0xb4 ,0x6d ,0x9c ,0x11 ,0xb1 ,0xf7 ,0xb3 ,0xc9 ,0x62 ,0x69 ,0x4f ,0x64 ,0x12 ,0x6c ,0x73 ,0xc6 ,0x06 ,0xdf ,0x38 ,0x9b ,0xc4 ,0x23 ,0x94 ,0xa2 ,0x85 ,0xb9 ,0xda ,0x48 ,0x1b ,0x3d ,0x12 ,0x35 ,0x95 ,0x66 ,0x0d ,0x6b ,0x57 ,0xbd ,0x53 ,0x09 ,0x67 ,0x20 ,0x6a ,0x4c ,0x30 ,0x95 ,0x1d ,0xcc ,0x8e ,0x78 ,0x4d ,0x23 ,0xd3 ,0x26 ,0x31 ,0xea ,0x36 ,0xee ,0x6c ,0xc0 ,0x7b ,0x77 ,0xcf ,0xc7 ,0x9c ,0x77 ,0xce ,0x9a ,0x07 ,0xd8 ,0xb1 ,0x8e ,0xf9 ,0x4a ,0x3e ,0x90 ,0x11 ,0x31 ,0x41 ,0x81 ,0xf1 ,0xd8 ,0xc6 ,0x8d ,0x05 ,0xb7 ,0xc7 ,0x8c ,0x90 ,0xac ,0x8a ,0xc0 ,0xb4 ,0x95 ,0x0b ,0x1b ,0x77 ,0x1a ,0x98 ,0x39 ,0xac ,0x6c ,0xb4 ,0x2e ,0xb6 ,0x72 ,0x94 ,0x6d ,0xd6 ,0x30 ,0x60 ,0x0e ,0xd9 ,0x7c ,0x12 ,0xa7 ,0x9b ,0x81 ,0x1c ,0x67 ,0xb5 ,0x12 ,0x22 ,0x5b ,0x4c ,0x19 ,0x40 ,0xd2 ,0xeb ,0x33 ,0xf0 ,0x85 ,0xc0 ,0xe8 ,0xa5 ,0xdf ,0xa6 ,0x3a ,0xb6 ,0xe3 ,0x64 ,0x13 ,0xce ,0xc4 ,0xd4 ,0x2e ,0x31 ,0x17 ,0x96 ,0x88 ,0x9a ,0x06 ,0x1c ,0x04 ,0xc3 ,0xbb ,0x82 ,0x6e ,0xc0 ,0x7c ,0x99 ,0xaf ,0xc7 ,0xa5 ,0x84 ,0x61 ,0x83 ,0x41 ,0x4d ,0x03 ,0x85 ,0x0f ,0x48 ,0x1a ,0x25 ,0x14 ,0x2b ,0x1c ,0xce ,0x07 ,0x01 ,0x78 ,0x4d ,0xb7 ,0x9a ,0x32 ,0xd9 ,0xa5 ,0x11 ,0x55 ,0x68 ,0xc5 ,0x67 ,0x4f ,0x55 ,0x27 ,0xfc ,0x01 ,0xdd ,0x52 ,0xf2 ,0x8f ,0x8d ,0x0e ,0x13 ,0xad ,0x92 ,0xed ,0x74 ,0x0f ,0x75 ,0xb5 ,0xac ,0x2a ,0x56 ,0x31 ,0x45 ,0xcc ,0x35 ,0xde ,0x14 ,0x04 ,0xb8 ,0xe1 ,0x21 ,0x98 ,0x7e ,0x75 ,0x24 ,0x76 ,0xa1 ,0xd7 ,0x09 ,0x09 ,0x83 ,0xee ,0x60 ,0x49 ,0x4c ,0xe1 ,0xcc ,0x44 ,0xff ,0xc2 ,0x93 ,0x56 ,0x42 ,0x93 ,0x47 ,0x72 ,0x51 ,0x2a ,0xee ,0x79 ,0xa0 ,0x10 ,0x45 ,0xbd ,0x01 ,0x4a ,0xa0 ,0x25 ,0x8f ,0x2a ,0x4e ,0x1c ,0x98 ,0x7e ,0xfb ,0x68 ,0x63 ,0x06 ,0x95 ,0x04 ,0x3b ,0xa0 ,0x51 ,0x92 ,0x61 ,0x7c ,0xa3 ,0xc1 ,0x1c ,0xdb ,0x39 ,0x44 ,0xca ,0x42 ,0xc3 ,0x9e ,0xa6 ,0xde ,0x18 ,0xb4 ,0xe9 ,0x99 ,0x9c ,0x3a ,0x67 ,0xef ,0xd5 ,0x07 ,0x80 ,0x12 ,0xb1 ,0x52 ,0xd8 ,0x19 ,0x78 ,0xa7 ,0xbc ,0x4c ,0x81 ,0x38 ,0x32 ,0x81 ,0x2d ,0x95 ,0x3e ,0xce ,0x73 ,0xfa ,0xed ,0x80 ,0xc0 ,0x37 ,0xd2 ,0x5a ,0x03 ,0x29 ,0xdb ,0x47 ,0x69 ,0xd4 ,0x32 ,0x7f ,0x63 ,0x6d ,0xd6 ,0x69 ,0xf8 ,0x00 ,0x55 ,0x1a ,0x86 ,0x60 ,0x04 ,0x71 ,0x5d ,0x29 ,0xa1 ,0x84 ,0x82 ,0x7a ,0xe7 ,0xb4 ,0x0f ,0x19 ,0x14 ,0xfc ,0x22 ,0x31 ,0x40 ,0x1a ,0x24 ,0x65 ,0xa2 ,0x08 ,0x6e ,0x23 ,0x8a ,0x43 ,0x63 ,0x01 ,0x56 ,0x72 ,0x16 ,0x7d ,0x63 ,0xaf ,0x9a ,0x60 ,0x6a ,0xc8 ,0x2e ,0x9c ,0xc1 ,0x32 ,0xeb ,0x74 ,0xea ,0x08 ,0x6a ,0xfb ,0x8d ,0x1c ,0x3e ,0xec ,0x73 ,0x46 ,0x39 ,0x3b ,0x81 ,0x69 ,0x8e ,0xd1 ,0xed ,0x05 ,0x33 ,0x02 ,0x31 ,0x21 ,0x58 ,0x75 ,0x08 ,0xea ,0x25 ,0xe8 ,0x2d ,0x5a ,0x3d ,0x12 ,0xb3 ,0x4a ,0xaf ,0x6a ,0x1b ,0x58 ,0xa6 ,0x5a ,0xc3 ,0x5d ,0x3c ,0x87 ,0x40 ,0xba ,0xa6 ,0x16 ,0x26 ,0xcc ,0xb4 ,0xc9 ,0x1a ,0x44 ,0x17 ,0xee ,0x8a ,0x4f ,0x1b ,0xbd ,0x40 ,0x05 ,0x56 ,0x5c ,0x01 ,0xd1 ,0x0f ,0x33 ,0x14 ,0x6b ,0xca ,0xc6 ,0x12 ,0xa8 ,0xac ,0x08 ,0x7b ,0x41 ,0x6a ,0x8f ,0xa5 ,0x23 ,0xf1 ,0x40 ,0x86 ,0x00 ,0xa5 ,0x9e ,0x27 ,0x23 ,0x26 ,0x2b ,0xc2 ,0x51 ,0x1c ,0x40 ,0x41 ,0x1d ,0x0c ,0xc9 ,0x73 ,0x57 ,0x11 ,0xa0 ,0x08 ,0x62 ,0x89 ,0x0b ,0xa9 ,0x81 ,0xe8 ,0xc7 ,0x02 ,0x2b ,0xce ,0x42 ,0xf5 ,0x71 ,0x46 ,0x43 ,0xa3 ,0x76 ,0x52 ,0x70 ,0x89 ,0xe1 ,0x6b ,0xb0 ,0x23 ,0x10 ,0x0f ,0x93 ,0x40 ,0xbe ,0x18 ,0x1e ,0x0d ,0xc3 ,0x00 ,0x49 ,0x43 ,0xe4 ,0x53 ,0x8c ,0x86 ,0xf2 ,0xca ,0x84 ,0x66 ,0x11 ,0x48 ,0x3b ,0xe6 ,0xbf ,0x9e ,0xed ,0x23 ,0xe2 ,0x44 ,0x39 ,0xef ,0x32 ,0x02 ,0x98 ,0x49 ,0xc2 ,0xd2 ,0x25 ,0x0d ,0x0f ,0xcc ,0x39 ,0x52 ,0xf1 ,0xaf ,0x4b ,0x6b ,0x27 ,0x92 ,0x3c ,0x17 ,0xc2 ,0x89 ,0x07 ,0x4f ,0x4c ,0x4e ,0x6c ,0xb9 ,0xe3 ,0x0e ,0xa2 ,0x6b ,0xb0 ,0x8b ,0xe8 ,0x6f ,0xa3 ,0xe2 ,0x99 ,0xb1 ,0x3a ,0xa2 ,0xb2 ,0x8c ,0xb6 ,0x09 ,0x5e ,0x02 ,0x07 ,0x2c ,0xdb ,0xe2 ,0x42 ,0x8b ,0xf2 ,0xaf ,0xe6 ,0x4a ,0x51 ,0x84 ,0xce ,0x98 ,0xd0 ,0x45 ,0x84 ,0xea ,0x34 ,0x8a ,0x2c ,0x2a ,0x20 ,0xf9 ,0x9c ,0x6b ,0x6c ,0x44 ,0x57 ,0x69 ,0x06 ,0x4d ,0xf0 ,0xab ,0x8c ,0x21 ,0xd8 ,0xa2 ,0xba ,0x8c ,0x8d ,0xa6 ,0xe2 ,0xa1 ,0x29 ,0xe4 ,0xc1 ,0x80 ,0x20 ,0x86 ,0xba ,0x8f ,0x74 ,0x6b ,0x97 ,0x4c ,0x70 ,0x38 ,0x63 ,0xd5 ,0x7a ,0x21 ,0xd8 ,0x29 ,0xb4 ,0xa4 ,0xb5 ,0x2b ,0xcd ,0x9d ,0x9f ,0xf4 ,0x0e ,0x91 ,0x10 ,0x3e ,0x04 ,0x5b ,0x1a ,0x55 ,0xa4 ,0x86 ,0xca ,0x4a ,0x83 ,0x09 ,0xae ,0xf1 ,0xf4 ,0xcd ,0x5d ,0x5d ,0x01 ,0xa3 ,0x52 ,0x21 ,0xb6 ,0x65 ,0xd4 ,0x6b ,0x8e ,0x72 ,0x11 ,0xf7 ,0x14 ,0x6e ,0x26 ,0xea ,0xbc ,0x85 ,0x03 ,0x29 ,0xbf ,0x46 ,0x3a ,0x0f ,0x34 ,0x52 ,0xb0 ,0x64 ,0x86 ,0x66 ,0x37 ,0x2e ,0x21 ,0x75 ,0x3d ,0xd4 ,0x5a ,0x8e ,0x60 ,0xd1 ,0xb8 ,0x22 ,0xb7 ,0xbf ,0x95 ,0xbd ,0x0c ,0x36 ,0x0f ,0xd5 ,0x28 ,0x64 ,0x16 ,0xcd ,0x10 ,0xc4 ,0x87 ,0xd2 ,0x3e ,0xc2 ,0x69 ,0xec ,0x0b ,0x72 ,0x5c ,0x49 ,0x2b ,0x92 ,0x26 ,0xb7 ,0x58 ,0x1b ,0xd6 ,0xb5 ,0x60 ,0x26 ,0x81 ,0x1a ,0x0c ,0xd5 ,0x37 ,0xe8 ,0x6e ,0xab ,0xaa ,0x9e ,0x47 ,0xd6 ,0x8c ,0xfa ,0x54 ,0x70 ,0xb5 ,0x97 ,0xb5 ,0x55 ,0x33 ,0xb8 ,0x43 ,0x48 ,0x68 ,0x67 ,0x6a ,0xc7 ,0xf0 ,0xd4 ,0x32 ,0x3c ,0xd5 ,0x44 ,0x54 ,0x70 ,0xf7 ,0xa9 ,0xac ,0x74 ,0xc2 ,0x8f ,0xf4 ,0x3e ,0x04 ,0x59 ,0xf8 ,0x75 ,0x7d ,0xac ,0x3a ,0xe0 ,0x12 ,0x6d ,0x9a ,0xb9 ,0x06 ,0x23 ,0x8f ,0x94 ,0xf2 ,0x57 ,0x49 ,0x2a ,0x5a ,0xf7 ,0xca ,0x6c ,0x10 ,0x17 ,0xa3 ,0xae ,0x3f ,0xff ,0x12 ,0x89 ,0x10 ,0x0c ,0x96 ,0x3e ,0xed ,0xbb ,0xfe ,0x3d ,0x7a ,0x35 ,0x7a ,0xd0 ,0x6e ,0xa3 ,0x9b ,0xcd ,0x0d ,0xd9 ,0xfb ,0x81 ,0x86 ,0xbe ,0xda ,0x54 ,0x88 ,0xca ,0x3f ,0x8c ,0x1e ,0xdd ,0x24 ,0x6e ,0x19 ,0x43 ,0x6f ,0x34 ,0x5a ,0xaf ,0x9b ,0x69 ,0xbf ,0x85 ,0x11 ,0x12 ,0x25 ,0x21 ,0x67 ,0x4f ,0xa4 ,0xb6 ,0x91 ,0x93 ,0x0c ,0xef ,0x87 ,0xb5 ,0xae ,0x04 ,0xef ,0xa3 ,0x15 ,0x89 ,0xd7 ,0x16 ,0xe2 ,0x96 ,0x10 ,0x8d ,0xf5 ,0xe9 ,0x23 ,0x28 ,0x9a ,0x03 ,0x94 ,0x97 ,0x05 ,0x8b ,0x33 ,0x34 ,0xea ,0xb1 ,0x40 ,0xa0 ,0x1c ,0xd0 ,0x88 ,0x03 ,0x0a ,0x6c ,0x08 ,0x86 ,0x8c ,0x63 ,0x63 ,0x33 ,0xf2 ,0xb6 ,0x6c ,0xcf ,0x70 ,0x12 ,0x34 ,0x90 ,0x31 ,0xa8 ,0x60 ,0xbd ,0xa5 ,0xd7 ,0x4c ,0xcd ,0x81 ,0xe6 ,0x49 ,0x00 ,0x63 ,0xaa ,0xbe ,0xc3 ,0xfc ,0xa4 ,0xe6 ,0x22 ,0x25 ,0x52 ,0xb3 ,0x92 ,0xd8 ,0xe3 ,0xb2 ,0x6b ,0x3c ,0x6c ,0xca ,0x23 ,0xa6 ,0x1c ,0x91 ,0x21 ,0x7e ,0x98 ,0x5c ,0x71 ,0x0f ,0xc7 ,0xb5 ,0x32 ,0x26 ,0x81 ,0xe0 ,0xf7 ,0x59 ,0x23 ,0x4b ,0xd2 ,0x45 ,0x9c ,0xf6 ,0x7e ,0x53 ,0x41 ,0xa6 ,0x62 ,0x66 ,0x01 ,0xd9 ,0xa6 ,0x1a ,0x1e ,0xe8 ,0x40 ,0x1a ,0xa3 ,0x3d ,0x67 ,0x67 ,0x24 ,0x13 ,0xbc ,0x6f ,0xac ,0x8d ,0x1a ,0x3c ,0x07 ,0xcb ,0x43 ,0xce ,0x2a ,0x43 ,0xd0 ,0x2b ,0xd0 ,0xf3 ,0x0c ,0xbd ,0x40 ,0x94 ,0x1b ,0x52 ,0x13 ,0x8a ,0xb1 ,0xc1 ,0xfa ,0x92 ,0xcb ,0xc1 ,0xf3 ,0xc2 ,0x29 ,0x91 ,0xd1 ,0x45 ,0x57 ,0x79 ,0x7f ,0x8c ,0xde ,0x82 ,0xb8 ,0xda ,0x6f ,0xc4 ,0x94 ,0xb0 ,0x89 ,0x7a ,0xb5 ,0x07 ,0xcb ,0x0c ,0xe1 ,0xee ,0x4c ,0x11 ,0x96 ,0xd8 ,0x50 ,0xd1 ,0xe4 ,0x53 ,0xa2 ,0x93 ,0x0e ,0xac ,0xc9 ,0x05 ,0x6c ,0xc5 ,0x55 ,0xd5 ,0xcc ,0xe1 ,0xee ,0xd5 ,0x89 ,0x23 ,0x92 ,0x21 ,0x3b ,0x71 ,0xec ,0x3e ,0x43 ,0x16 ,0x06 ,0x33 ,0x0a ,0xd4 ,0x66 ,0xb4 ,0x15 ,0xa0 ,0x57 ,0x86 ,0xae ,0x9d ,0xa7 ,0x58 ,0xc0 ,0x16 ,0x58 ,0x55 ,0xa1 ,0xd6 ,0x90 ,0x61 ,0x4c ,0x68 ,0xe7 ,0xc9 ,0x64 ,0xe2 ,0xa7 ,0xca ,0x3b ,0x6c ,0xa5 ,0x72 ,0x4e ,0x2d ,0x2e ,0xa3 ,0x33 ,0xdd ,0x5d ,0x09 ,0x30 ,0x1c ,0xd2 ,0x07 ,0x1c ,0x26 ,0x1d ,0x9f ,0x4f ,0xca ,0xe8 ,0xcc ,0x26 ,0xb0 ,0xa6 ,0x49 ,0x9a ,0x20 ,0x3e ,0xf3 ,0x85 ,0x03 ,0x79 ,0xf3 ,0x13 ,0x1c ,0xe4 ,0xb1 ,0x06 ,0xe9 ,0xa6 ,0xe9 ,0x10 ,0x24 ,0x22 ,0x6a ,0xb6 ,0xa1 ,0xc2 ,0x31 ,0x68 ,0xf2 ,0x10 ,0x51 ,0xc3 ,0x7c ,0x36 ,0x4c ,0xe1 ,0x4c ,0xcc ,0x20 ,0xdc ,0xe4 ,0x80 ,0xd5 ,0xfd ,0x1a ,0xdc ,0x35 ,0x32 ,0x33 ,0xf5 ,0x17 ,0x5b ,0xbd ,0x65 ,0x6d ,0x22 ,0x5e ,0x3f ,0xbc ,0x99 ,0x20 ,0x70 ,0x93 ,0xd4 ,0x72 ,0x47 ,0x22 ,0x3b ,0xec ,0x8c ,0xcf ,0x26 ,0x7a ,0x20 ,0x0e ,0xab ,0xc9 ,0x1f ,0xd4 ,0xa3 ,0xf5 ,0x5c ,0xff ,0x89 ,0xfc ,0xe9 ,0x11 ,0xfd ,0x9e ,0x98 ,0x23 ,0xe4 ,0xe5 ,0x5d ,0x60 ,0xeb ,0xa1 ,0xf8 ,0xb0 ,0xde ,0x51 ,0x67 ,0xe8 ,0x08 ,0x3c ,0x2f ,0xe1 ,0x97 ,0x95 ,0x8b ,0x87 ,0xf0 ,0x91 ,0xb7 ,0x92 ,0x2f ,0xfe ,0xc1 ,0xfb ,0x5f ,0x2e ,0x79 ,0x80 ,0xec ,0x83 ,0x18 ,0x96 ,0xad ,0xc0 ,0x7e ,0xa7 ,0xc9 ,0x05 ,0x4f ,0xac ,0xe4 ,0xec ,0x8d ,0x4f ,0x6a ,0x5a ,0xc1 ,0x87 ,0x4a ,0xa9 ,0xea ,0x8c ,0x51 ,0xff ,0x47 ,0x20 ,0xe9 ,0x94 ,0x65 ,0x62 ,0xd8 ,0xc3 ,0x0d ,0x7c ,0xec ,0x4b ,0x36 ,0xed ,0x01 ,0x2e ,0xb6 ,0x6f ,0x2b ,0xd7 ,0xa7 ,0x6f ,0x2e ,0x23 ,0xa5 ,0x59 ,0x47 ,0x45 ,0x41 ,0x76 ,0x94 ,0xba ,0x6c ,0x51 ,0x1b ,0x37 ,0x21 ,0x54 ,0xa4 ,0x15 ,0xc2 ,0x54 ,0x97 ,0x10 ,0x13 ,0xeb ,0x59 ,0xed ,0x91 ,0xca ,0x03 ,0x0c ,0x0f ,0xe9 ,0xd8 ,0xf0 ,0x2e ,0x12 ,0xc8 ,0x76 ,0x07 ,0xd8 ,0xbe ,0x17 ,0xd4 ,0x50 ,0x8f ,0x65 ,0x6c ,0x79 ,0xca ,0x3d ,0xc3 ,0x7d ,0xb8 ,0xda ,0xa1 ,0xa6 ,0x3b ,0xa5 ,0x78 ,0x06 ,0x2d ,0x33 ,0x7d ,0xc9 ,0x0b ,0xc8 ,0x9a ,0xe1 ,0x97 ,0x1f ,0x33 ,0x0a ,0xba ,0x76 ,0x01 ,0xd8 ,0x5c ,0x37 ,0x81 ,0x95 ,0x50 ,0x2c ,0xf2 ,0x6f ,0xf4 ,0xb9 ,0xa5 ,0xb4 ,0x15 ,0x55 ,0x90 ,0x41 ,0x5e ,0xc1 ,0x4f ,0x31 ,0x95 ,0xfd ,0x43 ,0x95 ,0x3f ,0x08 ,0x2e ,0x15 ,0x3d ,0xf5 ,0x2e ,0xa8 ,0x9e ,0xd0 ,0x22 ,0xaa ,0xc9 ,0x5e ,0xcd ,0xf8 ,0xbd ,0x30 ,0x9c ,0x6b ,0x18 ,0xd9 ,0x94 ,0x33 ,0x90 ,0x4c ,0x08 ,0xf0 ,0x14 ,0x67 ,0x40 ,0x35 ,0x40 ,0x60 ,0x0b ,0x12 ,0x9d ,0x0f ,0x14 ,0xae ,0xff ,0xa3 ,0x80 ,0x40 ,0xa3 ,0x4c ,0xd2 ,0x51 ,0x0a ,0xdc ,0x79 ,0x95 ,0x93 ,0xf1 ,0xf7 ,0xa0 ,0xb2 ,0xc2 ,0x16 ,0x41 ,0xb4 ,0x2d ,0x2a ,0xff ,0xb8 ,0xfa ,0x63 ,0x56 ,0xc0 ,0xeb ,0x9a ,0xf8 ,0x54 ,0xc4 ,0x19 ,0xb9 ,0x3b ,0x7c ,0xc8 ,0xf0 ,0xb8 ,0xd2 ,0x88 ,0xe3 ,0x65 ,0xe9 ,0xd1 ,0xcf ,0xdf ,0x7c ,0xf3 ,0x75 ,0xca ,0x1f ,0x3d ,0xc5 ,0x65 ,0xcb ,0x88 ,0x4b ,0x5f ,0xc8 ,0xb3 ,0xaf ,0x4c ,0x41 ,0xe9 ,0x85 ,0x9c ,0xaa ,0x2c ,0x30 ,0xbd ,0xa2 ,0xe5 ,0x20 ,0x12 ,0x4d ,0xa8 ,0x4e ,0x93 ,0x7e ,0x87 ,0x33 ,0x11 ,0x93 ,0x9d ,0xc9 ,0xf3 ,0xd7 ,0xa9 ,0x8d ,0x78 ,0x21 ,0x8f ,0xc0 ,0x48 ,0x18 ,0x8c ,0xca ,0x51 ,0x54 ,0x65 ,0xab ,0xe6 ,0xc2 ,0xa7 ,0x3c ,0x7b ,0x24 ,0x34 ,0x38 ,0x66 ,0xc0 ,0x3f ,0xaf ,0xe6 ,0x47 ,0x5c ,0x6e ,0x17 ,0x59 ,0x65 ,0x5f ,0xb7 ,0xf3 ,0xd0 ,0x64 ,0x92 ,0x5c ,0x40 ,0x68 ,0x06 ,0x5b ,0xe7 ,0xe1 ,0x6e ,0x10 ,0xd5 ,0xe6 ,0x86 ,0x1e ,0x8b ,0xf9 ,0xdf ,0xcb ,0xa6 ,0xd0 ,0x30 ,0xd1 ,0xe3 ,0x76 ,0x4b ,0x99 ,0xbf ,0xad ,0x04 ,0x34 ,0x63 ,0x03 ,0xcf ,0xd5 ,0xe0 ,0xf9 ,0x57 ,0xd4 ,0x90 ,0xfe ,0xed ,0x3b ,0xa6 ,0x4c ,0x6e ,0x79 ,0xfc ,0xc8 ,0x82 ,0x78 ,0xb6 ,0x10 ,0xae ,0xea ,0xce ,0x01 ,0xa0 ,0x02 ,0xf6 ,0x42 ,0xe0 ,0x92 ,0xae ,0xf7 ,0x88 ,0x78 ,0x91 ,0x90 ,0x86 ,0x8f ,0xd2 ,0x5b ,0x0a ,0xbd ,0xa9 ,0x15 ,0xac ,0x79 ,0xb9 ,0x3b ,0xe6 ,0xf4 ,0x8a ,0xb2 ,0x35 ,0x40 ,0x4f ,0x51 ,0xff ,0x30 ,0xd7 ,0xf8 ,0x18 ,0x90 ,0x0b ,0xd6 ,0xe4 ,0xff ,0x00 ,0x87 ,0xec ,0x59 ,0x6e ,0x1c ,0x11 ,0x01 ,0x00    
-};
\ No newline at end of file
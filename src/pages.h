@@ -1,23 +0,0 @@
-/*
- *  This includes all the HTML/CSS/JS pages
- */
-
-// This is the original source HTML/CSS/JS:
-// https://jsfiddle.net/jkirsons/ngrgguk2/270/
-
-// Use this page to compress the HTML/CSS:
-// https://htmlcompressor.com/compressor/
-
-// Use this page to convert the HTML/CSS/JS to C++ strings:
-// http://easyonlineconverter.com/converters/cpp-string-escape.html
-
-// Use this to gzip the large files:
-// https://gchq.github.io/CyberChef/#recipe=Gzip('Dynamic%20Huffman%20Coding','','',false)To_Hex('Space')
-
-#include "pgmspace.h"
-
-#include "pages-css.h"
-#include "pages-html.h"
-#include "pages-virt_joystick.h"
-#include "pages-interact.h"
-#include "pages-jquery.h"
\ No newline at end of file
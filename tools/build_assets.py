@@ -0,0 +1,139 @@
+# Builds src/assets.h from the web client sources in web/
+#
+# Every file is minified, gzipped and written out as a PROGMEM array with
+# its size and a content hash used as the ETag. The page references the
+# other assets as /name?v=<hash>, so they can be cached for good and a new
+# build still reaches every browser.
+#
+# Runs before each firmware build (extra_scripts in platformio.ini), or by
+# hand with:
+#   python3 tools/build_assets.py
+# The header is only rewritten when an asset changed.
+
+import gzip
+import hashlib
+import os
+import re
+
+try:
+    Import("env")
+    ROOT = env.subst("$PROJECT_DIR")
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+WEB = os.path.join(ROOT, "web")
+OUTPUT = os.path.join(ROOT, "src", "assets.h")
+
+# path served, source file, content type - the page last, it links the rest
+ASSETS = [
+    ("/style.css", "style.css", "text/css"),
+    ("/jquery.js", "jquery.js", "application/javascript"),
+    ("/virt_joystick.js", "virt_joystick.js", "application/javascript"),
+    ("/interact.js", "interact.js", "application/javascript"),
+    ("/", "index.html", "text/html"),
+]
+
+
+def minify_css(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"\s+", " ", text)
+    text = re.sub(r"\s*([{};,>])\s*", r"\1", text)
+    return text.replace(";}", "}").strip()
+
+
+# Only whitespace at the start of lines goes, the scripts are shipped
+# minified already and anything cleverer needs a real JS parser
+def minify_js(text):
+    lines = [line.strip() for line in text.splitlines()]
+    return "\n".join(line for line in lines if line)
+
+
+def minify_html(text):
+    text = minify_js(text)
+    return re.sub(r">\s+<", "><", text)
+
+
+def minify(name, text):
+    if name.endswith(".css"):
+        return minify_css(text)
+    if name.endswith(".js"):
+        return minify_js(text)
+    return minify_html(text)
+
+
+def symbol(name):
+    return "asset_" + re.sub(r"\W", "_", name)
+
+
+def c_array(name, data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "const uint8_t %s[] PROGMEM =\n{\n%s\n};\n" % (symbol(name), "\n".join(lines))
+
+
+def build():
+    hashes = {}
+    arrays = []
+    rows = []
+    for path, name, content_type in ASSETS:
+        with open(os.path.join(WEB, name), encoding="utf-8") as f:
+            text = minify(name, f.read())
+        if name.endswith(".html"):
+            for other, tag in hashes.items():
+                text = text.replace('"%s"' % other, '"%s?v=%s"' % (other, tag))
+        source = text.encode("utf-8")
+        tag = hashlib.sha256(source).hexdigest()[:16]
+        hashes[path] = tag
+        # mtime 0 keeps the output identical from build to build
+        packed = gzip.compress(source, compresslevel=9, mtime=0)
+        arrays.append(c_array(name, packed))
+        rows.append('  { "%s", "%s", %s, sizeof(%s), %d, "\\"%s\\"", %s },' % (
+            path, content_type, symbol(name), symbol(name), len(source), tag,
+            "false" if name.endswith(".html") else "true"))
+
+    return """/*
+ * Generated by tools/build_assets.py from web/ - edit the sources there,
+ * this file is rebuilt with the firmware
+ */
+
+#ifndef assets_h
+#define assets_h
+
+#include <stddef.h>
+#include <stdint.h>
+#include "pgmspace.h"
+
+// One gzipped file served from flash
+struct StaticAsset {
+  const char *path;
+  const char *contentType;
+  const uint8_t *data;      // gzip
+  size_t length;
+  size_t sourceLength;      // minified, before gzip
+  const char *etag;
+  bool immutable;           // only ever linked with ?v=<hash>
+};
+
+%s
+const StaticAsset staticAssets[] =
+{
+%s
+};
+
+#define STATIC_ASSET_COUNT  (sizeof(staticAssets) / sizeof(staticAssets[0]))
+
+#endif
+""" % ("\n".join(arrays), "\n".join(rows))
+
+
+output = build()
+try:
+    with open(OUTPUT, encoding="utf-8") as f:
+        current = f.read()
+except IOError:
+    current = None
+if output != current:
+    with open(OUTPUT, "w", encoding="utf-8") as f:
+        f.write(output)
+    print("build_assets: wrote %s" % os.path.relpath(OUTPUT, ROOT))